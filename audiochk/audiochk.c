@@ -0,0 +1,315 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SECTOR_SIZE		512
+#define FRAMES_PER_SECTOR	(SECTOR_SIZE / 4)
+#define MAX_GAPS		1024
+
+// Check a wav file (or raw disk image) captured from the radio while it was
+// running one of the audioin test pattern sources, and report every sample
+// that was lost, repeated or reordered along with the LBA it was found at
+//
+// Each stereo frame is a 32 bit little-endian word.  With the counter pattern
+// the word is a frame count, with the sine pattern the low 16 bits are the
+// frame count and the high 16 bits are a sine of period 64 frames
+//
+enum event
+{
+	EV_NONE,
+	EV_LOST,
+	EV_REPEATED,
+	EV_REORDERED,
+	EV_UNDERRUN,
+	EV_BADSINE,
+};
+
+static const char *s_event_names[] =
+{
+	"", "lost", "repeated", "reordered", "underrun (zero sector)", "bad sine sample",
+};
+
+static const int16_t s_sine[64] =
+{
+	     0,   1606,   3196,   4756,   6270,   7723,   9102,  10394,
+	 11585,  12665,  13623,  14449,  15137,  15679,  16069,  16305,
+	 16384,  16305,  16069,  15679,  15137,  14449,  13623,  12665,
+	 11585,  10394,   9102,   7723,   6270,   4756,   3196,   1606,
+	     0,  -1606,  -3196,  -4756,  -6270,  -7723,  -9102, -10394,
+	-11585, -12665, -13623, -14449, -15137, -15679, -16069, -16305,
+	-16384, -16305, -16069, -15679, -15137, -14449, -13623, -12665,
+	-11585, -10394,  -9102,  -7723,  -6270,  -4756,  -3196,  -1606,
+};
+
+// samples skipped over going forward, which may turn up later (reordered)
+//
+static struct gap
+{
+	uint32_t first;
+	uint32_t count;
+	uint32_t lba;
+}
+s_gaps[MAX_GAPS];
+static int s_num_gaps;
+
+static uint32_t s_totals[EV_BADSINE + 1];
+
+// consecutive events of the same kind are reported as one run
+//
+static struct run
+{
+	enum event event;
+	uint32_t lba;
+	uint32_t offset;
+	uint32_t first;
+	uint32_t count;
+}
+s_run;
+
+static void flush_run(void)
+{
+	if (s_run.event != EV_NONE)
+	{
+		printf("LBA %u +%u: %s %u sample%s from %08X\n",
+				s_run.lba, s_run.offset, s_event_names[s_run.event],
+				s_run.count, s_run.count == 1 ? "" : "s", s_run.first);
+	}
+	s_run.event = EV_NONE;
+}
+
+static void report(enum event event, uint32_t lba, uint32_t offset, uint32_t first, uint32_t count)
+{
+	s_totals[event] += count;
+
+	if (s_run.event == event && event != EV_LOST && s_run.first + s_run.count == first)
+	{
+		s_run.count += count;
+		return;
+	}
+
+	flush_run();
+	s_run.event = event;
+	s_run.lba = lba;
+	s_run.offset = offset;
+	s_run.first = first;
+	s_run.count = count;
+}
+
+// a sample behind the expected one, see if it fills a hole we reported
+// as lost earlier.  If so it was reordered, else it is a repeat
+//
+static int fill_gap(uint32_t value, uint32_t mask)
+{
+	int gap;
+
+	for (gap = 0; gap < s_num_gaps; gap++)
+	{
+		struct gap *pg = &s_gaps[gap];
+
+		if (((value - pg->first) & mask) < pg->count)
+		{
+			if (value == pg->first)
+			{
+				pg->first = (pg->first + 1) & mask;
+				pg->count--;
+			}
+			else if (((value - pg->first + 1) & mask) == pg->count)
+			{
+				pg->count--;
+			}
+			else
+			{
+				// split the gap in two
+				if (s_num_gaps < MAX_GAPS)
+				{
+					s_gaps[s_num_gaps].first = (value + 1) & mask;
+					s_gaps[s_num_gaps].count = pg->count - ((value - pg->first + 1) & mask);
+					s_gaps[s_num_gaps].lba = pg->lba;
+					s_num_gaps++;
+				}
+				pg->count = (value - pg->first) & mask;
+			}
+
+			if (pg->count == 0)
+			{
+				*pg = s_gaps[--s_num_gaps];
+			}
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static void add_gap(uint32_t first, uint32_t count, uint32_t lba)
+{
+	if (s_num_gaps >= MAX_GAPS)
+	{
+		// forget the oldest, it will never be filled now
+		memmove(s_gaps, s_gaps + 1, sizeof(s_gaps) - sizeof(s_gaps[0]));
+		s_num_gaps--;
+	}
+
+	s_gaps[s_num_gaps].first = first;
+	s_gaps[s_num_gaps].count = count;
+	s_gaps[s_num_gaps].lba = lba;
+	s_num_gaps++;
+}
+
+int main(int argc, char **argv)
+{
+	FILE *in;
+	char *progname;
+	char *filename = NULL;
+	uint32_t base_lba = 0;
+	uint32_t skip = 1;
+	uint32_t mask = 0xFFFFFFFF;
+	uint32_t expected = 0;
+	uint32_t lba;
+	uint32_t frames = 0;
+	uint32_t lost;
+	int have_first = 0;
+	int sine = 0;
+	uint8_t sector[SECTOR_SIZE];
+
+	progname = *argv++;
+	argc--;
+
+	while (argc > 0)
+	{
+		if (!strcmp(*argv, "-s"))
+		{
+			sine = 1;
+			mask = 0xFFFF;
+		}
+		else if (!strcmp(*argv, "-l") && argc > 1)
+		{
+			argv++;
+			argc--;
+			base_lba = strtoul(*argv, NULL, 0);
+		}
+		else if (!strcmp(*argv, "-k") && argc > 1)
+		{
+			argv++;
+			argc--;
+			skip = strtoul(*argv, NULL, 0);
+		}
+		else if (**argv == '-')
+		{
+			break;
+		}
+		else
+		{
+			filename = *argv;
+		}
+		argv++;
+		argc--;
+	}
+
+	if (!filename || argc > 0)
+	{
+		fprintf(stderr, "Usage %s [-s] [-l <base lba>] [-k <skip sectors>] <file>\n"
+				"  -s  file holds the sine pattern (default is counter)\n"
+				"  -l  LBA of the file's first sector, to report disk LBAs (default 0)\n"
+				"  -k  sectors to skip before pattern data, (default 1, the header sector)\n",
+				progname);
+		return -1;
+	}
+
+	in = fopen(filename, "rb");
+	if (!in)
+	{
+		fprintf(stderr, "Can't open %s\n", filename);
+		return -1;
+	}
+
+	if (fseek(in, (long)skip * SECTOR_SIZE, SEEK_SET))
+	{
+		fprintf(stderr, "Can't skip %u sectors\n", skip);
+		fclose(in);
+		return -1;
+	}
+
+	for (lba = base_lba + skip; fread(sector, 1, SECTOR_SIZE, in) == SECTOR_SIZE; lba++)
+	{
+		uint32_t offset;
+		int zero = 1;
+
+		for (offset = 0; offset < SECTOR_SIZE; offset++)
+		{
+			if (sector[offset])
+			{
+				zero = 0;
+				break;
+			}
+		}
+
+		if (zero)
+		{
+			report(EV_UNDERRUN, lba, 0, expected, FRAMES_PER_SECTOR);
+			continue;
+		}
+
+		for (offset = 0; offset < SECTOR_SIZE; offset += 4)
+		{
+			uint32_t word = sector[offset] | (sector[offset + 1] << 8)
+					| (sector[offset + 2] << 16) | ((uint32_t)sector[offset + 3] << 24);
+			uint32_t value = word & mask;
+
+			frames++;
+
+			if (sine && (int16_t)(word >> 16) != s_sine[value & 63])
+			{
+				report(EV_BADSINE, lba, offset, value, 1);
+			}
+
+			if (!have_first)
+			{
+				printf("LBA %u +%u: first sample %08X\n", lba, offset, value);
+				have_first = 1;
+				expected = (value + 1) & mask;
+				continue;
+			}
+
+			if (value == expected)
+			{
+				expected = (expected + 1) & mask;
+				flush_run();
+				continue;
+			}
+
+			// distance ahead of where we expected, with wrap, a "negative"
+			// distance means the sample is from the past
+			//
+			lost = (value - expected) & mask;
+
+			if (lost <= (mask >> 1))
+			{
+				report(EV_LOST, lba, offset, expected, lost);
+				add_gap(expected, lost, lba);
+				expected = (value + 1) & mask;
+			}
+			else if (fill_gap(value, mask))
+			{
+				report(EV_REORDERED, lba, offset, value, 1);
+				s_totals[EV_LOST]--;
+			}
+			else
+			{
+				report(EV_REPEATED, lba, offset, value, 1);
+			}
+		}
+	}
+
+	flush_run();
+	fclose(in);
+
+	printf("%u frames checked through LBA %u\n", frames, lba - 1);
+	printf("  lost %u  repeated %u  reordered %u  underrun sectors %u  bad sine %u\n",
+			s_totals[EV_LOST], s_totals[EV_REPEATED], s_totals[EV_REORDERED],
+			s_totals[EV_UNDERRUN] / FRAMES_PER_SECTOR, s_totals[EV_BADSINE]);
+
+	return (s_totals[EV_LOST] || s_totals[EV_REPEATED] || s_totals[EV_REORDERED]
+			|| s_totals[EV_UNDERRUN] || s_totals[EV_BADSINE]) ? 1 : 0;
+}
@@ -0,0 +1,917 @@
+/*
+ * Copyright (c) 2024, Level Home Inc.
+ *
+ * All rights reserved.
+ *
+ * Proprietary and confidential. Unauthorized copying of this file,
+ * via any medium is strictly prohibited.
+ *
+ */
+
+#include "audiodsp.h"
+#include "asserts.h"
+
+#include <errno.h>
+#include <string.h>
+#include <math.h>
+
+//#define UNIT_TEST 1
+
+// short-term loudness window
+//
+#define DSP_SHORT_TERM_MS       (3000)
+
+// below this short-term rms (about -60dBFS) the agc holds its gain rather
+// than pumping up noise between stations or in quiet passages
+//
+#define DSP_AGC_GATE_RMS        (33)
+
+// log2(1 + i/16) in Q8, and 2^(i/16) in Q15
+//
+static DSP_RAMCONST uint16_t s_log2_table[17] =
+{
+    0, 22, 44, 63, 82, 100, 118, 134, 150, 165, 179, 193, 207, 220, 232, 244, 256
+};
+
+static DSP_RAMCONST uint32_t s_exp2_table[17] =
+{
+    32768, 34219, 35734, 37316, 38968, 40693, 42495, 44376, 46341,
+    48393, 50535, 52773, 55109, 57549, 60097, 62757, 65536
+};
+
+DSP_RAMFUNC static uint32_t _Sqrt64(uint64_t value)
+{
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+
+    while (bit)
+    {
+        if (value >= result + bit)
+        {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else
+        {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)result;
+}
+
+// log2 of value in Q8, value must be non-zero
+//
+DSP_RAMFUNC static int32_t _Log2Q8(uint32_t value)
+{
+    int32_t msb = 31 - __builtin_clz(value);
+    uint32_t frac;
+    uint32_t index;
+
+    // 8 bits of mantissa below the leading one
+    //
+    frac = (msb >= 8) ? (value >> (msb - 8)) & 0xFF : (value << (8 - msb)) & 0xFF;
+    index = frac >> 4;
+
+    return (msb << 8)
+        + s_log2_table[index]
+        + (((s_log2_table[index + 1] - s_log2_table[index]) * (frac & 0xF)) >> 4);
+}
+
+DSP_RAMFUNC int16_t AudioDspLevelDb10(uint32_t in_level)
+{
+    int32_t db10;
+
+    if (in_level == 0)
+    {
+        return DSP_LEVEL_MIN_DB10;
+    }
+
+    // 20 * log10(x) is 6.0206 * log2(x)
+    //
+    db10 = (_Log2Q8(in_level) - (15 << 8)) * 60206 / (256 * 1000);
+
+    if (db10 < DSP_LEVEL_MIN_DB10)
+    {
+        db10 = DSP_LEVEL_MIN_DB10;
+    }
+
+    return (int16_t)db10;
+}
+
+DSP_RAMFUNC uint32_t AudioDspDb10ToLevel(int in_db10)
+{
+    int32_t log2q8;
+    int32_t whole;
+    uint32_t frac;
+    uint32_t index;
+    uint32_t mant;
+
+    if (in_db10 <= DSP_LEVEL_MIN_DB10)
+    {
+        return 0;
+    }
+
+    log2q8 = in_db10 * (256 * 1000) / 60206;
+
+    // split into whole and fractional octaves, fraction always positive
+    //
+    whole = log2q8 >> 8;
+    frac = (uint32_t)(log2q8 - (whole << 8));
+    index = frac >> 4;
+
+    mant = s_exp2_table[index]
+        + (((s_exp2_table[index + 1] - s_exp2_table[index]) * (frac & 0xF)) >> 4);
+
+    // mant is Q15 so full scale (2^15) times it is just mant, shifted
+    //
+    if (whole >= 0)
+    {
+        return mant << whole;
+    }
+    if (whole <= -31)
+    {
+        return 0;
+    }
+    return mant >> -whole;
+}
+
+int AudioDspMeterInit(struct dsp_meter *meter, uint32_t in_block_frames, uint32_t in_sample_rate)
+{
+    int ret = -EINVAL;
+    uint32_t blocks;
+
+    require(meter, exit);
+    require(in_block_frames > 0, exit);
+
+    memset(meter, 0, sizeof(*meter));
+
+    // smoothing is a one-pole filter with a time constant of 2^shift
+    // blocks, pick the shift that is closest to the short-term window
+    //
+    blocks = (uint32_t)((uint64_t)in_sample_rate * DSP_SHORT_TERM_MS / 1000 / in_block_frames);
+    meter->st_shift = 0;
+    while ((2U << meter->st_shift) <= blocks)
+    {
+        meter->st_shift++;
+    }
+
+    meter->loudness_db10 = DSP_LEVEL_MIN_DB10;
+    ret = 0;
+exit:
+    return ret;
+}
+
+DSP_RAMFUNC int AudioDspMeter(struct dsp_meter *meter, const uint32_t *in_frames, uint32_t in_count)
+{
+    int ret = -EINVAL;
+    uint64_t sum = 0;
+    uint32_t peak_left = 0;
+    uint32_t peak_right = 0;
+    uint64_t ms;
+    int64_t delta;
+
+    require(meter, exit);
+    require(in_frames, exit);
+    require(in_count > 0, exit);
+
+    for (uint32_t frame = 0; frame < in_count; frame++)
+    {
+        int32_t left  = (int16_t)(in_frames[frame] >> 16);
+        int32_t right = (int16_t)(in_frames[frame] & 0xFFFF);
+
+        sum += (uint32_t)(left * left) + (uint32_t)(right * right);
+
+        left  = (left < 0) ? -left : left;
+        right = (right < 0) ? -right : right;
+
+        if ((uint32_t)left > peak_left)
+        {
+            peak_left = left;
+        }
+        if ((uint32_t)right > peak_right)
+        {
+            peak_right = right;
+        }
+    }
+
+    // -32768 has no positive 16 bit peer
+    //
+    meter->peak_left  = (peak_left > 32767) ? 32767 : peak_left;
+    meter->peak_right = (peak_right > 32767) ? 32767 : peak_right;
+
+    if (meter->peak_left > meter->peak_hold)
+    {
+        meter->peak_hold = meter->peak_left;
+    }
+    if (meter->peak_right > meter->peak_hold)
+    {
+        meter->peak_hold = meter->peak_right;
+    }
+
+    ms = sum / (2 * in_count);
+    meter->rms = (uint16_t)_Sqrt64(ms);
+
+    // short-term mean square is kept with 16 extra bits of precision
+    //
+    delta = (int64_t)(ms << 16) - (int64_t)meter->short_term_ms;
+    meter->short_term_ms += delta >> meter->st_shift;
+
+    meter->loudness_db10 = AudioDspLevelDb10(_Sqrt64(meter->short_term_ms >> 16));
+    ret = 0;
+exit:
+    return ret;
+}
+
+int AudioDspAgcInit(struct dsp_agc *agc, int in_target_db10)
+{
+    int ret = -EINVAL;
+
+    require(agc, exit);
+
+    agc->target_rms = (uint16_t)AudioDspDb10ToLevel(in_target_db10);
+    agc->min_gain   = DSP_GAIN_UNITY / 4;   // -12dB
+    agc->max_gain   = DSP_GAIN_UNITY * 4;   // +12dB
+    agc->ceiling    = AudioDspDb10ToLevel(-10);
+    agc->gain       = DSP_GAIN_UNITY;
+    agc->applied    = DSP_GAIN_UNITY;
+    agc->limited    = 0;
+    ret = 0;
+exit:
+    return ret;
+}
+
+// the meter has to have seen the block first, this uses its peaks and
+// short-term level.  Since the whole block is at hand before it is published
+// the limiter gets to look ahead at the block's peak for free
+//
+DSP_RAMFUNC int AudioDspAgc(struct dsp_agc *agc, const struct dsp_meter *meter, uint32_t *io_frames, uint32_t in_count)
+{
+    int ret = -EINVAL;
+    uint32_t st_rms;
+    uint32_t desired;
+    uint32_t peak;
+    uint32_t block_gain;
+    int32_t gain_q16;
+    int32_t step_q16;
+
+    require(agc, exit);
+    require(meter, exit);
+    require(io_frames, exit);
+    require(in_count > 0, exit);
+
+    ret = 0;
+
+    if (!agc->enabled)
+    {
+        goto exit;
+    }
+
+    // steer the gain towards the target, attacking quickly and releasing
+    // slowly so the gain doesn't breathe with the program material
+    //
+    st_rms = _Sqrt64(meter->short_term_ms >> 16);
+    if (st_rms > DSP_AGC_GATE_RMS)
+    {
+        desired = agc->target_rms * DSP_GAIN_UNITY / st_rms;
+        if (desired < agc->min_gain)
+        {
+            desired = agc->min_gain;
+        }
+        if (desired > agc->max_gain)
+        {
+            desired = agc->max_gain;
+        }
+
+        if (desired < agc->gain)
+        {
+            agc->gain -= (agc->gain - desired) >> 2;
+        }
+        else
+        {
+            agc->gain += (desired - agc->gain) >> 7;
+        }
+    }
+
+    // limit this block so its peak can't exceed the ceiling
+    //
+    block_gain = agc->gain;
+    peak = (meter->peak_left > meter->peak_right) ? meter->peak_left : meter->peak_right;
+    if (peak > 0 && ((peak * block_gain) >> 12) > agc->ceiling)
+    {
+        block_gain = (uint32_t)agc->ceiling * DSP_GAIN_UNITY / peak;
+        agc->limited++;
+    }
+
+    // ramp gain up across the block to avoid zipper noise, but drop
+    // it immediately so a limited block never overshoots
+    //
+    if (block_gain < agc->applied)
+    {
+        agc->applied = block_gain;
+    }
+
+    gain_q16 = (int32_t)agc->applied << 16;
+    step_q16 = (int32_t)(((int32_t)block_gain - (int32_t)agc->applied) << 16) / (int32_t)in_count;
+
+    for (uint32_t frame = 0; frame < in_count; frame++)
+    {
+        int32_t left  = (int16_t)(io_frames[frame] >> 16);
+        int32_t right = (int16_t)(io_frames[frame] & 0xFFFF);
+        int32_t gain = gain_q16 >> 16;
+
+        left  = (left * gain) >> 12;
+        right = (right * gain) >> 12;
+
+        left  = (left > 32767) ? 32767 : (left < -32768) ? -32768 : left;
+        right = (right > 32767) ? 32767 : (right < -32768) ? -32768 : right;
+
+        io_frames[frame] = ((uint32_t)left << 16) | ((uint32_t)right & 0xFFFF);
+        gain_q16 += step_q16;
+    }
+
+    agc->applied = block_gain;
+exit:
+    return ret;
+}
+
+int AudioDspGoertzelInit(struct dsp_goertzel *bank, const uint16_t *in_freqs, uint32_t in_bands, uint32_t in_sample_rate)
+{
+    int ret = -EINVAL;
+
+    require(bank, exit);
+    require(in_freqs, exit);
+    require(in_bands > 0 && in_bands <= DSP_MAX_BANDS, exit);
+    require(in_sample_rate > 0, exit);
+
+    // only done once so the float math is fine here
+    //
+    for (uint32_t band = 0; band < in_bands; band++)
+    {
+        require(in_freqs[band] < in_sample_rate / 2, exit);
+
+        bank->coeff[band] = (int32_t)lroundf(2.0f * 16384.0f
+                * cosf(2.0f * 3.14159265f * (float)in_freqs[band] / (float)in_sample_rate));
+    }
+
+    bank->bands = in_bands;
+    ret = 0;
+exit:
+    return ret;
+}
+
+// out_levels gets the amplitude of each band's frequency in the block, in
+// the same units as the samples (a full scale sine reads 32767)
+//
+int AudioDspGoertzel(const struct dsp_goertzel *bank, const int16_t *in_samples, uint32_t in_count, uint32_t *out_levels)
+{
+    int ret = -EINVAL;
+
+    require(bank, exit);
+    require(in_samples, exit);
+    require(out_levels, exit);
+    require(in_count > 0 && in_count <= 4096, exit);
+
+    for (uint32_t band = 0; band < bank->bands; band++)
+    {
+        int32_t coeff = bank->coeff[band];
+        int32_t s0;
+        int32_t s1 = 0;
+        int32_t s2 = 0;
+        int64_t power;
+
+        // the filter state grows to at most count * 32768 so it fits in
+        // 32 bits for up to 4096 samples, only the product needs 64
+        //
+        for (uint32_t sample = 0; sample < in_count; sample++)
+        {
+            s0 = in_samples[sample] + (int32_t)(((int64_t)coeff * s1) >> 14) - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+
+        power = (int64_t)s1 * s1 + (int64_t)s2 * s2 - ((((int64_t)coeff * s1) >> 14) * s2);
+        if (power < 0)
+        {
+            power = 0;
+        }
+
+        // magnitude is amplitude * count / 2
+        //
+        out_levels[band] = _Sqrt64((uint64_t)power) * 2 / in_count;
+    }
+
+    ret = 0;
+exit:
+    return ret;
+}
+
+// ima adpcm step sizes and index adjustments
+//
+static const uint16_t s_adpcm_steps[89] =
+{
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+static const int8_t s_adpcm_index_adjust[16] =
+{
+    -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+// reconstruct a sample from a code and step the state, the encoder runs
+// this too so both sides track the same predictor
+//
+static int16_t _AdpcmStep(struct dsp_adpcm *state, uint8_t code)
+{
+    int32_t step = s_adpcm_steps[state->index];
+    int32_t diff = step >> 3;
+    int32_t predictor = state->predictor;
+    int32_t index;
+
+    if (code & 4)
+    {
+        diff += step;
+    }
+    if (code & 2)
+    {
+        diff += step >> 1;
+    }
+    if (code & 1)
+    {
+        diff += step >> 2;
+    }
+
+    predictor += (code & 8) ? -diff : diff;
+    if (predictor > 32767)
+    {
+        predictor = 32767;
+    }
+    else if (predictor < -32768)
+    {
+        predictor = -32768;
+    }
+
+    index = state->index + s_adpcm_index_adjust[code];
+    if (index < 0)
+    {
+        index = 0;
+    }
+    else if (index > 88)
+    {
+        index = 88;
+    }
+
+    state->predictor = (int16_t)predictor;
+    state->index = (uint8_t)index;
+    return state->predictor;
+}
+
+static uint8_t _AdpcmEncodeSample(struct dsp_adpcm *state, int16_t sample)
+{
+    int32_t step = s_adpcm_steps[state->index];
+    int32_t delta = sample - state->predictor;
+    uint8_t code = 0;
+
+    if (delta < 0)
+    {
+        code = 8;
+        delta = -delta;
+    }
+    if (delta >= step)
+    {
+        code |= 4;
+        delta -= step;
+    }
+    if (delta >= (step >> 1))
+    {
+        code |= 2;
+        delta -= step >> 1;
+    }
+    if (delta >= (step >> 2))
+    {
+        code |= 1;
+    }
+
+    _AdpcmStep(state, code);
+    return code;
+}
+
+int AudioDspAdpcmEncode(struct dsp_adpcm *io_state, const uint32_t *in_frames, uint32_t in_count, uint8_t *out_codes)
+{
+    int ret = -EINVAL;
+
+    require(io_state && in_frames && out_codes, exit);
+
+    for (uint32_t frame = 0; frame < in_count; frame++)
+    {
+        uint8_t low = _AdpcmEncodeSample(&io_state[0], (int16_t)(in_frames[frame] & 0xFFFF));
+        uint8_t high = _AdpcmEncodeSample(&io_state[1], (int16_t)(in_frames[frame] >> 16));
+
+        out_codes[frame] = (uint8_t)((high << 4) | low);
+    }
+
+    ret = 0;
+exit:
+    return ret;
+}
+
+int AudioDspAdpcmDecode(struct dsp_adpcm *io_state, const uint8_t *in_codes, uint32_t in_count, uint32_t *out_frames)
+{
+    int ret = -EINVAL;
+
+    require(io_state && in_codes && out_frames, exit);
+
+    for (uint32_t frame = 0; frame < in_count; frame++)
+    {
+        int16_t low = _AdpcmStep(&io_state[0], in_codes[frame] & 0xF);
+        int16_t high = _AdpcmStep(&io_state[1], in_codes[frame] >> 4);
+
+        out_frames[frame] = ((uint32_t)(uint16_t)high << 16) | (uint16_t)low;
+    }
+
+    ret = 0;
+exit:
+    return ret;
+}
+
+int AudioDspAdpcmEncodeMono(struct dsp_adpcm *io_state, const int16_t *in_samples, uint32_t in_count, uint8_t *out_codes)
+{
+    int ret = -EINVAL;
+
+    require(io_state && in_samples && out_codes && !(in_count & 1), exit);
+
+    for (uint32_t sample = 0; sample < in_count; sample += 2)
+    {
+        uint8_t low = _AdpcmEncodeSample(io_state, in_samples[sample]);
+        uint8_t high = _AdpcmEncodeSample(io_state, in_samples[sample + 1]);
+
+        *out_codes++ = (uint8_t)((high << 4) | low);
+    }
+
+    ret = 0;
+exit:
+    return ret;
+}
+
+int AudioDspAdpcmDecodeMono(struct dsp_adpcm *io_state, const uint8_t *in_codes, uint32_t in_count, int16_t *out_samples)
+{
+    int ret = -EINVAL;
+
+    require(io_state && in_codes && out_samples && !(in_count & 1), exit);
+
+    for (uint32_t sample = 0; sample < in_count; sample += 2, in_codes++)
+    {
+        *out_samples++ = _AdpcmStep(io_state, *in_codes & 0xF);
+        *out_samples++ = _AdpcmStep(io_state, *in_codes >> 4);
+    }
+
+    ret = 0;
+exit:
+    return ret;
+}
+
+int AudioDspResamplerInit(struct dsp_resampler *rs, uint32_t in_rate, uint32_t out_rate, uint32_t out_channels)
+{
+    int ret = -EINVAL;
+
+    require(rs && in_rate && out_rate, exit);
+    require(out_channels == 1 || out_channels == 2, exit);
+
+    memset(rs, 0, sizeof(*rs));
+    rs->step = (uint32_t)(((uint64_t)in_rate << 16) / out_rate);
+    rs->channels = out_channels;
+
+    // zero at nyquist when going to half the rate or less
+    //
+    rs->smooth = (out_rate * 2 <= in_rate);
+
+    // the first output needs one input frame
+    //
+    rs->phase = 65536;
+    ret = 0;
+exit:
+    return ret;
+}
+
+int AudioDspResample(struct dsp_resampler *rs, const uint32_t *in_frames, uint32_t in_count,
+                     int16_t *out_samples, uint32_t out_max, uint32_t *out_made)
+{
+    uint32_t used = 0;
+    uint32_t made = 0;
+    int32_t sample[2];
+    int ret = -EINVAL;
+
+    require(rs && in_frames && out_samples && out_made, exit);
+
+    while (made < out_max)
+    {
+        if (rs->phase >= 65536)
+        {
+            if (used >= in_count)
+            {
+                break;
+            }
+
+            for (int ch = 0; ch < 2; ch++)
+            {
+                int32_t in = (int16_t)(in_frames[used] >> (16 * ch));
+
+                rs->prev[ch] = rs->cur[ch];
+                if (rs->smooth)
+                {
+                    rs->cur[ch] = (rs->hist[ch][1] + 2 * rs->hist[ch][0] + in) / 4;
+                    rs->hist[ch][1] = rs->hist[ch][0];
+                    rs->hist[ch][0] = in;
+                }
+                else
+                {
+                    rs->cur[ch] = in;
+                }
+            }
+
+            used++;
+            rs->phase -= 65536;
+            continue;
+        }
+
+        for (int ch = 0; ch < 2; ch++)
+        {
+            sample[ch] = rs->prev[ch] + (int32_t)(((int64_t)(rs->cur[ch] - rs->prev[ch]) * rs->phase) >> 16);
+        }
+
+        if (rs->channels == 1)
+        {
+            *out_samples++ = (int16_t)((sample[0] + sample[1]) / 2);
+        }
+        else
+        {
+            *out_samples++ = (int16_t)sample[0];
+            *out_samples++ = (int16_t)sample[1];
+        }
+
+        made++;
+        rs->phase += rs->step;
+    }
+
+    *out_made = made;
+    ret = (int)used;
+exit:
+    return ret;
+}
+
+#ifdef UNIT_TEST
+#define UT_FRAMES   (128)
+
+static void _UnitTestFill(uint32_t *frames, int16_t amplitude)
+{
+    for (int frame = 0; frame < UT_FRAMES; frame++)
+    {
+        int16_t value = (frame & 1) ? amplitude : -amplitude;
+
+        frames[frame] = ((uint32_t)(uint16_t)value << 16) | (uint16_t)value;
+    }
+}
+
+int AudioDspUnitTest(void)
+{
+    int ret = -1;
+    struct dsp_meter meter;
+    struct dsp_agc agc;
+    uint32_t frames[UT_FRAMES];
+    uint32_t level;
+    int db10;
+
+    // level conversions, to within a tenth of a dB or so
+    //
+    db10 = AudioDspLevelDb10(32768);
+    require(db10 == 0, exit);
+    db10 = AudioDspLevelDb10(16384);
+    require(db10 >= -61 && db10 <= -59, exit);
+    db10 = AudioDspLevelDb10(328);
+    require(db10 >= -401 && db10 <= -399, exit);
+    require(AudioDspLevelDb10(0) == DSP_LEVEL_MIN_DB10, exit);
+
+    level = AudioDspDb10ToLevel(0);
+    require(level == 32768, exit);
+    level = AudioDspDb10ToLevel(-60);
+    require(level >= 16300 && level <= 16480, exit);
+    level = AudioDspDb10ToLevel(-200);
+    require(level >= 3260 && level <= 3290, exit);
+
+    // meter a half scale square wave, short-term loudness converges on it
+    //
+    ret = AudioDspMeterInit(&meter, UT_FRAMES, 44100);
+    require_noerr(ret, exit);
+    require_action(meter.st_shift == 10, exit, ret = -1);
+
+    _UnitTestFill(frames, 16384);
+    for (int block = 0; block < 20000; block++)
+    {
+        ret = AudioDspMeter(&meter, frames, UT_FRAMES);
+        require_noerr(ret, exit);
+    }
+    require_action(meter.peak_left == 16384 && meter.peak_right == 16384, exit, ret = -1);
+    require_action(meter.rms == 16384, exit, ret = -1);
+    require_action(meter.loudness_db10 >= -62 && meter.loudness_db10 <= -58, exit, ret = -1);
+
+    // quiet input is turned up towards the target, to the max gain
+    //
+    ret = AudioDspMeterInit(&meter, UT_FRAMES, 44100);
+    require_noerr(ret, exit);
+    ret = AudioDspAgcInit(&agc, -200);
+    require_noerr(ret, exit);
+    agc.enabled = true;
+
+    for (int block = 0; block < 20000; block++)
+    {
+        _UnitTestFill(frames, 500);
+        AudioDspMeter(&meter, frames, UT_FRAMES);
+        ret = AudioDspAgc(&agc, &meter, frames, UT_FRAMES);
+        require_noerr(ret, exit);
+    }
+    require_action(agc.gain > agc.max_gain - 128, exit, ret = -1);
+
+    // loud input is turned down, and the limiter keeps every sample under
+    // the ceiling even while the gain is still high from the quiet part
+    //
+    for (int block = 0; block < 20000; block++)
+    {
+        _UnitTestFill(frames, 30000);
+        AudioDspMeter(&meter, frames, UT_FRAMES);
+        ret = AudioDspAgc(&agc, &meter, frames, UT_FRAMES);
+        require_noerr(ret, exit);
+
+        for (int frame = 0; frame < UT_FRAMES; frame++)
+        {
+            int32_t left = (int16_t)(frames[frame] >> 16);
+
+            require_action(left <= agc.ceiling && left >= -agc.ceiling, exit, ret = -1);
+        }
+    }
+    require_action(agc.limited > 0, exit, ret = -1);
+    require_action(agc.gain < DSP_GAIN_UNITY / 2, exit, ret = -1);
+
+    // a tone lands in its own band and not much in the others
+    //
+    {
+        static const uint16_t freqs[3] = { 500, 1000, 2000 };
+        struct dsp_goertzel bank;
+        int16_t tone[256];
+        uint32_t levels[3];
+
+        ret = AudioDspGoertzelInit(&bank, freqs, 3, 8000);
+        require_noerr(ret, exit);
+
+        // 1kHz at 8kHz sampling is a period of 8, make a half scale sine
+        //
+        for (int sample = 0; sample < 256; sample++)
+        {
+            static const int16_t period[8] = { 0, 11585, 16384, 11585, 0, -11585, -16384, -11585 };
+
+            tone[sample] = period[sample & 7];
+        }
+
+        ret = AudioDspGoertzel(&bank, tone, 256, levels);
+        require_noerr(ret, exit);
+        require_action(levels[1] > 16000 && levels[1] < 16800, exit, ret = -1);
+        require_action(levels[0] < 200 && levels[2] < 200, exit, ret = -1);
+    }
+
+    // adpcm round trip of a tone tracks the input closely once the step
+    // size has settled, and decoding from a saved state picks up mid stream
+    //
+    {
+        static uint32_t pcm[1024];
+        static uint8_t codes[1024];
+        static uint32_t decoded[1024];
+        struct dsp_adpcm enc_state[2] = { 0 };
+        struct dsp_adpcm dec_state[2] = { 0 };
+        struct dsp_adpcm mid_state[2];
+        int32_t error;
+        int32_t max_error = 0;
+
+        for (int frame = 0; frame < 1024; frame++)
+        {
+            int16_t left = (int16_t)(12000 * sin(2 * M_PI * 440 * frame / 44100.0));
+            int16_t right = (int16_t)(8000 * sin(2 * M_PI * 1000 * frame / 44100.0));
+
+            pcm[frame] = ((uint32_t)(uint16_t)right << 16) | (uint16_t)left;
+        }
+
+        ret = AudioDspAdpcmEncode(enc_state, pcm, 512, codes);
+        require_noerr(ret, exit);
+        memcpy(mid_state, enc_state, sizeof(mid_state));
+        ret = AudioDspAdpcmEncode(enc_state, pcm + 512, 512, codes + 512);
+        require_noerr(ret, exit);
+
+        ret = AudioDspAdpcmDecode(dec_state, codes, 1024, decoded);
+        require_noerr(ret, exit);
+
+        for (int frame = 64; frame < 1024; frame++)
+        {
+            for (int shift = 0; shift < 32; shift += 16)
+            {
+                error = (int16_t)(decoded[frame] >> shift) - (int16_t)(pcm[frame] >> shift);
+                if (error < 0)
+                {
+                    error = -error;
+                }
+                if (error > max_error)
+                {
+                    max_error = error;
+                }
+            }
+        }
+        require_action(max_error < 600, exit, ret = -1);
+
+        ret = AudioDspAdpcmDecode(mid_state, codes + 512, 512, decoded);
+        require_noerr(ret, exit);
+        require_action(enc_state[0].predictor == mid_state[0].predictor, exit, ret = -1);
+        require_action(enc_state[1].index == mid_state[1].index, exit, ret = -1);
+
+        // mono packs the same codes two samples to a byte
+        //
+        memset(enc_state, 0, sizeof(enc_state));
+        memset(dec_state, 0, sizeof(dec_state));
+        for (int sample = 0; sample < 1024; sample++)
+        {
+            ((int16_t *)decoded)[sample] = (int16_t)(pcm[sample] & 0xFFFF);
+        }
+        ret = AudioDspAdpcmEncodeMono(&enc_state[0], (int16_t *)decoded, 1024, codes);
+        require_noerr(ret, exit);
+        ret = AudioDspAdpcmDecodeMono(&dec_state[0], codes, 1024, (int16_t *)decoded + 1024);
+        require_noerr(ret, exit);
+        for (int sample = 64; sample < 1024; sample++)
+        {
+            error = ((int16_t *)decoded)[1024 + sample] - (int16_t)(pcm[sample] & 0xFFFF);
+            require_action(error > -600 && error < 600, exit, ret = -1);
+        }
+        require_action(enc_state[0].predictor == dec_state[0].predictor, exit, ret = -1);
+    }
+
+    // resampling a tone keeps its level and makes the right number of
+    // frames, fed in odd sized pieces
+    //
+    {
+        static uint32_t pcm[4410];
+        static int16_t out[2 * 4800 + 16];
+        static const uint32_t rates[2][2] = { { 48000, 2 }, { 22050, 1 } };
+        struct dsp_resampler rs;
+        uint32_t total;
+        uint32_t made;
+        uint32_t used;
+        int32_t peak;
+
+        for (int frame = 0; frame < 4410; frame++)
+        {
+            int16_t value = (int16_t)(10000 * sin(2 * M_PI * 1000 * frame / 44100.0));
+
+            pcm[frame] = ((uint32_t)(uint16_t)value << 16) | (uint16_t)value;
+        }
+
+        for (int rate = 0; rate < 2; rate++)
+        {
+            ret = AudioDspResamplerInit(&rs, 44100, rates[rate][0], rates[rate][1]);
+            require_noerr(ret, exit);
+
+            total = 0;
+            for (used = 0; used < 4410; )
+            {
+                uint32_t chunk = (4410 - used < 97) ? 4410 - used : 97;
+
+                ret = AudioDspResample(&rs, pcm + used, chunk, out + total * rates[rate][1], 4800 + 8 - total, &made);
+                require_action(ret == chunk, exit, ret = -1);
+                used += chunk;
+                total += made;
+            }
+            require_action(total >= rates[rate][0] / 10 - 1 && total <= rates[rate][0] / 10 + 1, exit, ret = -1);
+
+            peak = 0;
+            for (uint32_t sample = 100; sample < total * rates[rate][1]; sample++)
+            {
+                if (out[sample] > peak)
+                {
+                    peak = out[sample];
+                }
+            }
+            require_action(peak > 9500 && peak <= 10000, exit, ret = -1);
+        }
+    }
+
+    ret = 0;
+exit:
+    return ret;
+}
+#endif
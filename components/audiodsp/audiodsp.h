@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2024, Level Home Inc.
+ *
+ * All rights reserved.
+ *
+ * Proprietary and confidential. Unauthorized copying of this file,
+ * via any medium is strictly prohibited.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// Fixed point audio processing on blocks of packed 16 bit stereo frames,
+// left channel in the high half-word.  No OS dependencies so it can be
+// built and tested on a host
+//
+
+// functions that run on every block, and the tables they use, can be
+// placed in RAM on the target (CONFIG_AUDIO_RAMFUNC).  On a host they are
+// ordinary code and const data.  Other modules use these for their own
+// hot paths
+//
+#if defined(CONFIG_AUDIO_RAMFUNC) && CONFIG_AUDIO_RAMFUNC
+#include <zephyr/linker/section_tags.h>
+#define DSP_RAMFUNC             __ramfunc
+#define DSP_RAMCONST
+#else
+#define DSP_RAMFUNC
+#define DSP_RAMCONST            const
+#endif
+
+// gains are Q12, 4096 is unity
+//
+#define DSP_GAIN_UNITY          (4096)
+
+// levels are reported in tenths of a dB relative to full scale
+//
+#define DSP_LEVEL_MIN_DB10      (-1000)
+
+struct dsp_meter
+{
+    // last block
+    //
+    uint16_t    peak_left;
+    uint16_t    peak_right;
+    uint16_t    rms;
+
+    // short-term loudness, mean square smoothed over about 3 seconds.
+    // this is unweighted (no K-filter) so it reads a bit higher than LUFS
+    // for bass heavy material
+    //
+    int16_t     loudness_db10;
+
+    // peak hold since the meter was cleared
+    //
+    uint16_t    peak_hold;
+
+    // internal state
+    //
+    uint64_t    short_term_ms;
+    uint32_t    st_shift;
+};
+
+struct dsp_agc
+{
+    bool        enabled;
+
+    // where the agc aims the short-term rms level, and the gain limits
+    //
+    uint16_t    target_rms;
+    uint16_t    min_gain;
+    uint16_t    max_gain;
+
+    // limiter ceiling, blocks that would peak above this are turned down
+    //
+    uint16_t    ceiling;
+
+    // current gain, and how often the limiter had to act
+    //
+    uint16_t    gain;
+    uint32_t    limited;
+
+    // gain applied at the end of the last block, ramped from
+    //
+    uint16_t    applied;
+};
+
+// goertzel filter bank, a handful of single frequency dfts which is much
+// cheaper than an fft when only a few bands are wanted
+//
+#define DSP_MAX_BANDS           (8)
+
+struct dsp_goertzel
+{
+    uint32_t    bands;
+    int32_t     coeff[DSP_MAX_BANDS];   // 2cos(w) in Q14
+};
+
+int AudioDspMeterInit(struct dsp_meter *meter, uint32_t in_block_frames, uint32_t in_sample_rate);
+int AudioDspMeter(struct dsp_meter *meter, const uint32_t *in_frames, uint32_t in_count);
+
+int AudioDspAgcInit(struct dsp_agc *agc, int in_target_db10);
+int AudioDspAgc(struct dsp_agc *agc, const struct dsp_meter *meter, uint32_t *io_frames, uint32_t in_count);
+
+int AudioDspGoertzelInit(struct dsp_goertzel *bank, const uint16_t *in_freqs, uint32_t in_bands, uint32_t in_sample_rate);
+int AudioDspGoertzel(const struct dsp_goertzel *bank, const int16_t *in_samples, uint32_t in_count, uint32_t *out_levels);
+
+// ima adpcm, 4 bits a sample.  the state is per channel and small enough
+// to store alongside the codes so decoding can start anywhere it was saved
+//
+struct dsp_adpcm
+{
+    int16_t     predictor;
+    uint8_t     index;
+    uint8_t     reserved;
+};
+
+// one byte per stereo frame, channel in the low half-word in the low
+// nibble.  io_state is an array of two, one per channel
+//
+int AudioDspAdpcmEncode(struct dsp_adpcm *io_state, const uint32_t *in_frames, uint32_t in_count, uint8_t *out_codes);
+int AudioDspAdpcmDecode(struct dsp_adpcm *io_state, const uint8_t *in_codes, uint32_t in_count, uint32_t *out_frames);
+
+// mono, two samples to a byte with the first in the low nibble, in_count
+// is in samples and must be even
+//
+int AudioDspAdpcmEncodeMono(struct dsp_adpcm *io_state, const int16_t *in_samples, uint32_t in_count, uint8_t *out_codes);
+int AudioDspAdpcmDecodeMono(struct dsp_adpcm *io_state, const uint8_t *in_codes, uint32_t in_count, int16_t *out_samples);
+
+// rate and channel conversion from packed stereo frames to 16 bit pcm,
+// linear interpolation with a [1 2 1] pre-filter when decimating, which
+// is plenty for a speech or lower bandwidth stream
+//
+struct dsp_resampler
+{
+    uint32_t    step;       // input frames per output frame, Q16
+    uint32_t    phase;      // position of the next output past prev, Q16
+    uint32_t    channels;   // 1 or 2 out
+    bool        smooth;
+
+    int32_t     prev[2];
+    int32_t     cur[2];
+    int32_t     hist[2][2];
+};
+
+int AudioDspResamplerInit(struct dsp_resampler *rs, uint32_t in_rate, uint32_t out_rate, uint32_t out_channels);
+
+// convert until the input is used up or out_max output frames are made.
+// returns the input frames used, and the output frames in out_made
+//
+int AudioDspResample(struct dsp_resampler *rs, const uint32_t *in_frames, uint32_t in_count,
+                     int16_t *out_samples, uint32_t out_max, uint32_t *out_made);
+
+int16_t AudioDspLevelDb10(uint32_t in_level);
+uint32_t AudioDspDb10ToLevel(int in_db10);
+
+#ifdef UNIT_TEST
+int AudioDspUnitTest(void);
+#endif
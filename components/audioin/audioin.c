@@ -9,14 +9,18 @@
  */
 
 #include "audioin.h"
+#include "audiodsp.h"
 #include "asserts.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(audioin, LOG_LEVEL_INF);
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/audio/codec.h>
 
+#include <string.h>
+
 #define I2S_RX_NODE DT_NODELABEL(i2s_rx)
 
 // Frequency source of audio clock (xtal 32MHz)
@@ -27,27 +31,76 @@ LOG_MODULE_REGISTER(audioin, LOG_LEVEL_INF);
 #define AUDIO_CHANNELS              (2)
 
 // bytes per sample
+#if CONFIG_473X_DIGITAL
+// 16 bit stereo straight from the tuner, one frame per word with the
+// first slot in the low half-word
+//
+#define AUDIO_IN_SAMPLE_BITS        (16)
+#define AUDIO_IN_BYTES_PER_SAMPLE   (2)
+#else
+#define AUDIO_IN_SAMPLE_BITS        (24)
 #define AUDIO_IN_BYTES_PER_SAMPLE   (4) /* 24 bit stereo from codec, 4 bytes per channel */
+#endif
 #define AUDIO_OUT_BYTES_PER_SAMPLE  (2) /* 16 bit stereo to reader, 2 bytes per channel */
 
-// sector size we want (in bytes)
-#define AUDIO_SECTOR_SIZE           (512)
+// The I2S DMA block, the output ring block and the sector size the
+// reader pulls are all independent.  The packer moves samples one at a
+// time from DMA blocks into ring blocks, and readers copy any number of
+// bytes out of the ring, so any ratio between them works.
+//
+// Bigger DMA blocks mean fewer interrupts and audio thread wake-ups, at
+// the cost of more latency and more RAM in the input slab.  The DMA block
+// size can be changed at run time (up to the configured max) with the
+// "audio dma" shell command to measure that trade-off
+//
+#define AUDIO_DMA_FRAMES_MAX        (CONFIG_AUDIO_DMA_BLOCK_FRAMES_MAX)
+#define AUDIO_DMA_FRAMES_DEFAULT    (CONFIG_AUDIO_DMA_BLOCK_FRAMES)
+#define AUDIO_DMA_FRAMES_MIN        (16)
+
+// stereo frames per output ring block
+//
+#define AUDIO_SAMPLES_PER_BLOCK     (CONFIG_AUDIO_RING_BLOCK_FRAMES)
+
+BUILD_ASSERT(AUDIO_DMA_FRAMES_DEFAULT <= AUDIO_DMA_FRAMES_MAX, "default dma block is bigger than max");
 
-// at 4 bytes per stereo sample we fit 128 samples per sector
+#define AUDIO_IN_FRAME_SIZE     (AUDIO_IN_BYTES_PER_SAMPLE * AUDIO_CHANNELS)
+#define AUDIO_IN_FRAME_WORDS    (AUDIO_IN_FRAME_SIZE / sizeof(uint32_t))
+#define AUDIO_OUT_FRAME_SIZE    (AUDIO_OUT_BYTES_PER_SAMPLE * AUDIO_CHANNELS)
+
+#define AUDIO_IN_BLOCK_SIZE     (AUDIO_DMA_FRAMES_MAX * AUDIO_IN_FRAME_SIZE)
+#define AUDIO_OUT_BLOCK_SIZE    (AUDIO_SAMPLES_PER_BLOCK * AUDIO_OUT_FRAME_SIZE)
+
+// concealment of underruns: the last AUDIO_CONCEAL_FRAMES frames read are
+// kept and looped, fading to silence over AUDIO_CONCEAL_FADE_FRAMES, with
+// AUDIO_CONCEAL_XFADE_FRAMES of crossfade going into and out of it
+//
+#define AUDIO_CONCEAL_FRAMES        (128)
+#define AUDIO_CONCEAL_FADE_FRAMES   (1024)
+#define AUDIO_CONCEAL_XFADE_FRAMES  (32)
+#define AUDIO_UNITY_GAIN            (32768)
+
+// blocks buffered after waking from idle before the reader is served
 //
-#define AUDIO_SAMPLES_PER_BLOCK (AUDIO_SECTOR_SIZE / (AUDIO_OUT_BYTES_PER_SAMPLE * AUDIO_CHANNELS))
+#define AUDIO_PREROLL_BLOCKS        (AUDIO_RING_SIZE / 2)
 
-// how many bytes per sample block.. easiest to provide one sectors worth per
-#define AUDIO_IN_BLOCK_SIZE     (AUDIO_SAMPLES_PER_BLOCK * AUDIO_IN_BYTES_PER_SAMPLE * AUDIO_CHANNELS)
-#define AUDIO_OUT_BLOCK_SIZE    (AUDIO_SAMPLES_PER_BLOCK * AUDIO_OUT_BYTES_PER_SAMPLE * AUDIO_CHANNELS)
+// block taps
+//
+#define AUDIO_MAX_TAPS              (4)
 
 // input blocks in flight total, need at least 3 for proper operation
 #define AUDIO_IN_BLOCK_COUNT    (4)
 
-// output blocks in flight total,
-#define AUDIO_OUT_BLOCK_COUNT   (6)
+// output blocks in flight total, must be a power of 2 since the ring
+// indices are free-running and wrap at 2^32.  One block is always owned
+// by the producer so there are AUDIO_RING_SIZE - 1 blocks of buffering
+//
+#define AUDIO_OUT_BLOCK_COUNT   (CONFIG_AUDIO_RING_BLOCKS)
 #define AUDIO_RING_SIZE         (AUDIO_OUT_BLOCK_COUNT)
 
+#include "audioring.h"
+
+BUILD_ASSERT((AUDIO_RING_SIZE & AUDIO_RING_MASK) == 0, "audio ring size must be a power of 2");
+
 // I2S interface requires a slab alloctor for audio blocks.  This block
 // allocator fills up at the audio rate we set of about 47kHz
 //
@@ -64,7 +117,7 @@ static struct playback_ctx
 
     const struct device *i2s_dev;
     struct k_sem        start_sem;
-    struct k_mutex      block_lock;
+    struct k_sem        data_sem;
 
     uint32_t            channels;
     uint32_t            block_size;
@@ -72,26 +125,118 @@ static struct playback_ctx
     uint32_t            sample_rate;
 
     bool                active;
+    bool                capturing;
+    enum audio_source   source;
+    enum audio_source   capture_source;
     uint32_t            rx_blocks;
+    uint32_t            dma_frames;
+    uint64_t            busy_cycles;
+    uint32_t            max_block_cycles;
+    uint64_t            stats_start_ms;
     uint64_t            start_time_ms;
     uint64_t            duration_ms;
 
     uint32_t            drop_rate;
     uint32_t            drop_frac;
+
+    // when the reader last asked for samples, only ever set by the reader.
+    // The audio thread used to stamp it for every dma block too, which
+    // hid a stalled host, and idle parking, the overflow warning and
+    // AudioReadIdleMs all need it to mean the host is reading
+    //
     uint64_t            last_read;
     uint64_t            last_warn;
 
-    // the head/tail/count all represent whole blocks
-    // of output-format data
+    // ring of whole blocks of output-format data
+    //
+    struct audio_ring   outring;
+
+    // telemetry
     //
-    uint32_t            *outring[AUDIO_RING_SIZE];
-    int                 head;
-    int                 tail;
-    int                 count;
+    uint32_t            overruns;
+    uint32_t            underruns;
+    uint32_t            i2s_errors;
+    uint32_t            max_wait_us;
+    uint64_t            rx_frames;
+    uint64_t            tx_bytes;
+    uint32_t            fill_hist[AUDIO_FILL_BINS];
+    uint32_t            concealed;
+    uint64_t            conceal_frames;
+    uint32_t            max_conceal_cycles;
+    uint32_t            retunes;
+    uint32_t            retune_discards;
+    uint32_t            retune_tune_ms;
+    uint32_t            retune_last_ms;
+    uint32_t            retune_max_ms;
+    uint32_t            idles;
+    uint32_t            idle_ms;
+    uint32_t            idle_saved_us;
+    uint32_t            wake_last_ms;
+    uint32_t            wake_max_ms;
+    uint32_t            max_dsp_cycles;
+
+    // level meter and agc/limiter, run on each output block
+    //
+    struct dsp_meter    meter;
+    struct dsp_agc      agc;
+
+    // block taps, only added to, never removed
+    //
+    audio_tap_t         taps[AUDIO_MAX_TAPS];
+    void                *tap_ctx[AUDIO_MAX_TAPS];
+    atomic_t            num_taps;
+
+    // told when capture starts or stops
+    //
+    audio_notify_t      notify;
+    void                *notify_ctx;
+
+    // retune handling.  blocks are stamped with the generation they were
+    // captured in, which moves on each time a retune completes, and the
+    // reader throws away anything from an older generation, or anything at
+    // all while muted waiting for the tuner to settle
+    //
+    atomic_t            generation;
+    atomic_t            muted;
+    uint32_t            capture_gen;
+    bool                retune_pending;
+    uint64_t            retune_start_ms;
+
+    // idle gating.  capture is parked when nobody reads for a while and
+    // restarted by the next read, which waits for a pre-roll of blocks.
+    // holds keep it running for taps that need audio with no reader
+    //
+    atomic_t            idle;
+    atomic_t            holds;
+    bool                resuming;
+    bool                prerolling;
+    uint32_t            idle_busy_ppm;
+    uint64_t            idle_start_ms;
+    uint64_t            wake_start_ms;
+
+    // test pattern generator state
+    //
+    uint32_t            pattern_count;
+    uint64_t            pattern_frames;
+    int64_t             pattern_start;
 
     // the sample count refers to the current (head) block
     //
     int                 samples;
+
+    // bytes of the tail block already copied out by the reader, only
+    // touched by the consumer
+    //
+    uint32_t            read_offset;
+
+    // concealment state, also only touched by the consumer.  history is a
+    // ring of the most recent frames read, hist_pos is the oldest
+    //
+    uint32_t            conceal_hist[AUDIO_CONCEAL_FRAMES];
+    uint32_t            hist_pos;
+    uint32_t            conceal_pos;
+    int32_t             conceal_gain;
+    bool                concealing;
 }
 m_playback_state;
 
@@ -186,8 +331,14 @@ static int _SetupAudioClock(uint32_t sample_rate)
         // audio pll can only do 43800kHz or 47500kHz and its a lot easier to drop
         // oversamples vs invent undersamples
         //
-        p_clks->HFCLKAUDIO.FREQUENCY = 36000;
-        LOG_INF("new HFCLKAUDIO = %08X\n", p_clks->HFCLKAUDIO.FREQUENCY);
+        // when supplying the clock to a digital tuner it resamples to whatever
+        // rate it is clocked at, so leave the pll at its nominal rate
+        //
+        if (!m_playback_state.supply_clock)
+        {
+            p_clks->HFCLKAUDIO.FREQUENCY = 36000;
+            LOG_INF("new HFCLKAUDIO = %08X\n", p_clks->HFCLKAUDIO.FREQUENCY);
+        }
     }
 
     p_reg->CONFIG.MCKEN = 1;
@@ -196,32 +347,147 @@ exit:
     return ret;
 }
 
+// one period of a sine at -6dBFS for the sine test pattern
+//
+static const int16_t s_pattern_sine[64] =
+{
+         0,   1606,   3196,   4756,   6270,   7723,   9102,  10394,
+     11585,  12665,  13623,  14449,  15137,  15679,  16069,  16305,
+     16384,  16305,  16069,  15679,  15137,  14449,  13623,  12665,
+     11585,  10394,   9102,   7723,   6270,   4756,   3196,   1606,
+         0,  -1606,  -3196,  -4756,  -6270,  -7723,  -9102, -10394,
+    -11585, -12665, -13623, -14449, -15137, -15679, -16069, -16305,
+    -16384, -16305, -16069, -15679, -15137, -14449, -13623, -12665,
+    -11585, -10394,  -9102,  -7723,  -6270,  -4756,  -3196,  -1606,
+};
 
-static int _ReceiveBlock(struct playback_ctx *playback)
+static void _PatternStart(struct playback_ctx *playback)
+{
+    playback->pattern_count = 0;
+    playback->pattern_frames = 0;
+    playback->pattern_start = k_uptime_ticks();
+}
+
+// stand-in for i2s_read that makes a dma block of test pattern in the
+// capture format (24 bits right justified in 32 from the codec, or 16 bit
+// frames from a digital tuner) at the real i2s cadence
+//
+static int _PatternRead(struct playback_ctx *playback, void **out_mem_block, uint32_t *out_block_size)
+{
+    uint32_t *dst;
+    uint16_t left;
+    uint16_t right;
+    int64_t deadline;
+    int ret;
+
+    // sleep until this block would have been captured.  the deadline is
+    // computed from the start each time so the rate doesn't drift
+    //
+    playback->pattern_frames += playback->dma_frames;
+    deadline = playback->pattern_start
+            + (int64_t)(playback->pattern_frames * CONFIG_SYS_CLOCK_TICKS_PER_SEC / playback->sample_rate);
+    k_sleep(K_TIMEOUT_ABS_TICKS(deadline));
+
+    ret = k_mem_slab_alloc(&in_slab, out_mem_block, K_NO_WAIT);
+    require_noerr(ret, exit);
+
+    dst = (uint32_t *)*out_mem_block;
+
+    for (int frame = 0; frame < playback->dma_frames; frame++)
+    {
+        if (playback->capture_source == AUDIO_SOURCE_SINE)
+        {
+            left = (uint16_t)s_pattern_sine[playback->pattern_count & 63];
+        }
+        else
+        {
+            left = (uint16_t)(playback->pattern_count >> 16);
+        }
+
+        right = (uint16_t)(playback->pattern_count & 0xFFFF);
+        playback->pattern_count++;
+
+#if CONFIG_473X_DIGITAL
+        *dst++ = ((uint32_t)right << 16) | left;
+#else
+        *dst++ = (uint32_t)left << 8;
+        *dst++ = (uint32_t)right << 8;
+#endif
+    }
+
+    *out_block_size = playback->dma_frames * AUDIO_IN_FRAME_SIZE;
+exit:
+    return ret;
+}
+
+// meter, and optionally level, a full output block before it's published
+//
+DSP_RAMFUNC static void _ProcessBlock(struct playback_ctx *playback, uint32_t *samples)
+{
+    uint32_t start = k_cycle_get_32();
+    uint32_t cycles;
+
+    AudioDspMeter(&playback->meter, samples, AUDIO_SAMPLES_PER_BLOCK);
+    AudioDspAgc(&playback->agc, &playback->meter, samples, AUDIO_SAMPLES_PER_BLOCK);
+
+    for (int tap = 0; tap < atomic_get(&playback->num_taps); tap++)
+    {
+        playback->taps[tap](samples, AUDIO_SAMPLES_PER_BLOCK, playback->tap_ctx[tap]);
+    }
+
+    cycles = k_cycle_get_32() - start;
+    if (cycles > playback->max_dsp_cycles)
+    {
+        playback->max_dsp_cycles = cycles;
+    }
+}
+
+DSP_RAMFUNC static int _ReceiveBlock(struct playback_ctx *playback)
 {
     int ret;
     void *mem_block;
     uint32_t *src;
+    uint32_t *dst;
     uint32_t block_size;
+    uint32_t start;
+    uint32_t cycles;
     uint64_t now;
+    int frames;
     int count;
 
-    now = k_uptime_get();
+    if (playback->capture_source == AUDIO_SOURCE_I2S)
+    {
+        ret = i2s_read(playback->i2s_dev, &mem_block, &block_size);
+    }
+    else
+    {
+        ret = _PatternRead(playback, &mem_block, &block_size);
+    }
 
-    ret = i2s_read(playback->i2s_dev, &mem_block, &block_size);
+    now = k_uptime_get();
+    start = k_cycle_get_32();
 
     if (ret < 0)
     {
-        LOG_ERR("Failed to read i2s: %d at block %u %u\n", ret, playback->rx_blocks, playback->count);
+        LOG_ERR("Failed to read i2s: %d at block %u %u\n", ret, playback->rx_blocks, _RingCount(&playback->outring));
+        playback->i2s_errors++;
         playback->active = 0;
     }
     else
     {
-        k_mutex_lock(&playback->block_lock, K_FOREVER);
+        verify(block_size == playback->dma_frames * AUDIO_IN_FRAME_SIZE);
+        frames = block_size / AUDIO_IN_FRAME_SIZE;
 
-        verify(block_size == AUDIO_IN_BLOCK_SIZE);
-
-        playback->last_read = k_uptime_get();
+        // a retune completed, restart the block being packed so it
+        // holds no audio from before the new station settled
+        //
+        if ((uint32_t)atomic_get(&playback->generation) != playback->capture_gen)
+        {
+            playback->capture_gen = (uint32_t)atomic_get(&playback->generation);
+            playback->samples = 0;
+        }
+        playback->rx_frames += frames;
+        playback->fill_hist[_RingCount(&playback->outring) * AUDIO_FILL_BINS / AUDIO_RING_SIZE]++;
 
         // calculate a drop rate based on the fullness of the input ring
         // and the output ring to adust for sample rate differences
@@ -233,9 +499,14 @@ static int _ReceiveBlock(struct playback_ctx *playback)
         // and we aim to keep this output ring about 1/2 full at all times
         // and a stable drop-rate which is the rate-adaptation ration
         //
-        uint32_t drop_rate = 65536 * playback->count / (2 * AUDIO_RING_SIZE);
+        uint32_t drop_rate = 65536 * _RingCount(&playback->outring) / (2 * AUDIO_RING_SIZE);
         uint32_t new_drop = (drop_rate + playback->drop_rate) / 2;
 
+        // adaptation is switched off, for the codec and the digital tuner
+        // alike, so nothing here tracks host drift.  A host reading slower
+        // than the frame clock overflows the ring and loses whole blocks,
+        // one reading faster underruns and gets concealed
+        //
         new_drop = 0;
         if (new_drop != playback->drop_rate)
         {
@@ -243,12 +514,18 @@ static int _ReceiveBlock(struct playback_ctx *playback)
             playback->drop_rate = new_drop;
         }
 
+        dst = _RingHeadBlock(&playback->outring)->samples;
+
         // copy raw data, dropping some bits.  the format is 24 bit data
-        // padded into a2 bits of data right justified and sign-extended
+        // padded into a2 bits of data right justified and sign-extended,
+        // or 16 bit frames from a digital tuner which only need swapping
         //
         src = (uint32_t*)mem_block;
-        for (count = 0; count < AUDIO_SECTOR_SIZE; count += 4, src+= 2)
+        for (count = 0; count < frames; count++, src += AUDIO_IN_FRAME_WORDS)
         {
+#if CONFIG_473X_DIGITAL
+            uint32_t frame = (src[0] << 16) | (src[0] >> 16);
+#else
             // scale preserving sign
             int32_t left  = (int32_t)src[0];
             int32_t right = (int32_t)src[1];
@@ -256,20 +533,29 @@ static int _ReceiveBlock(struct playback_ctx *playback)
             left <<= 8;
             right >>= 8;
 
+            uint32_t frame = (uint32_t)(left & 0xFFFF0000) | (uint32_t)(right & 0xFFFF);
+#endif
             playback->drop_frac += playback->drop_rate;
 
             if (playback->drop_frac < 65536)
             {
-                (playback->outring[playback->head])[playback->samples] =
-                        (uint32_t)(left & 0xFFFF0000) | (uint32_t)(right & 0xFFFF);
+                dst[playback->samples] = frame;
                 playback->samples++;
 
                 if (playback->samples >= AUDIO_SAMPLES_PER_BLOCK)
                 {
-                    if (playback->count >= AUDIO_OUT_BLOCK_COUNT)
+                    // block is full, put it on output ring
+                    //
+                    playback->samples = 0;
+
+                    _ProcessBlock(playback, dst);
+
+                    _RingHeadBlock(&playback->outring)->gen = playback->capture_gen;
+                    if (_RingPublish(&playback->outring, AUDIO_OUT_BLOCK_SIZE))
                     {
-                        // overflow, drop it
-                        playback->samples--;
+                        // overflow, drop it by refilling the same block
+                        //
+                        playback->overruns++;
 
                         if ((now - playback->last_read) < 1000)
                         {
@@ -282,16 +568,10 @@ static int _ReceiveBlock(struct playback_ctx *playback)
                     }
                     else
                     {
-                        // put output block on output ring
-                        //
-                        playback->samples = 0;
-                        playback->count++;
-                        playback->head++;
-                        if (playback->head >= AUDIO_OUT_BLOCK_COUNT)
-                        {
-                            playback->head = 0;
-                        }
+                        k_sem_give(&playback->data_sem);
                     }
+
+                    dst = _RingHeadBlock(&playback->outring)->samples;
                 }
             }
             else
@@ -300,19 +580,136 @@ static int _ReceiveBlock(struct playback_ctx *playback)
             }
         }
 
-        k_mutex_unlock(&playback->block_lock);
-
         playback->rx_blocks++;
         k_mem_slab_free(&in_slab, mem_block);
+
+        cycles = k_cycle_get_32() - start;
+        playback->busy_cycles += cycles;
+        if (cycles > playback->max_block_cycles)
+        {
+            playback->max_block_cycles = cycles;
+        }
     }
 
     return ret;
 }
 
+static void _Notify(struct playback_ctx *playback)
+{
+    if (playback->notify)
+    {
+        playback->notify(playback->notify_ctx);
+    }
+}
+
+// park capture if nobody has read anything for a while
+//
+static bool _IdleCheck(struct playback_ctx *playback)
+{
+#if CONFIG_AUDIO_IDLE_TIMEOUT_MS > 0
+    uint64_t now = k_uptime_get();
+    uint64_t last = MAX(playback->last_read, playback->start_time_ms);
+    uint64_t elapsed_ms;
+
+    if ((now - last) > CONFIG_AUDIO_IDLE_TIMEOUT_MS && !atomic_get(&playback->holds))
+    {
+        // remember how busy capture was to estimate what idling saves
+        //
+        elapsed_ms = now - playback->stats_start_ms;
+        playback->idle_busy_ppm = elapsed_ms ?
+                (uint32_t)(k_cyc_to_us_floor64(playback->busy_cycles) * 1000 / elapsed_ms) : 0;
+
+        playback->idle_start_ms = now;
+        playback->idles++;
+        atomic_set(&playback->idle, 1);
+
+        LOG_INF("No reads for %u ms, capture idle", (uint32_t)(now - last));
+
+        // kick any reader that is waiting so it sees the idle and wakes us
+        //
+        k_sem_give(&playback->data_sem);
+        return true;
+    }
+#endif
+    return false;
+}
+
+// reader side: restart idle capture
+//
+static void _IdleWake(struct playback_ctx *playback)
+{
+    uint32_t idle_ms;
+
+    if (atomic_cas(&playback->idle, 1, 0))
+    {
+        playback->wake_start_ms = k_uptime_get();
+
+        idle_ms = (uint32_t)(playback->wake_start_ms - playback->idle_start_ms);
+        playback->idle_ms += idle_ms;
+        playback->idle_saved_us += (uint32_t)((uint64_t)idle_ms * playback->idle_busy_ppm / 1000);
+
+        playback->resuming = true;
+        playback->prerolling = true;
+
+        k_sem_give(&playback->start_sem);
+    }
+}
+
+static int _StartI2S(struct playback_ctx *playback)
+{
+    struct audio_codec_cfg codec_cfg;
+    int ret;
+
+    codec_cfg.dai_cfg.i2s.word_size         = playback->bytes_per_sample * 8;
+    codec_cfg.dai_cfg.i2s.channels          = playback->channels;
+    codec_cfg.dai_cfg.i2s.format            = I2S_FMT_DATA_FORMAT_LEFT_JUSTIFIED;
+    if (playback->supply_clock)
+    {
+        codec_cfg.dai_cfg.i2s.options       = I2S_OPT_BIT_CLK_MASTER | I2S_OPT_FRAME_CLK_MASTER;
+    }
+    else
+    {
+        codec_cfg.dai_cfg.i2s.options       = I2S_OPT_BIT_CLK_SLAVE | I2S_OPT_FRAME_CLK_SLAVE;
+    }
+    codec_cfg.dai_cfg.i2s.frame_clk_freq    = playback->sample_rate;
+    codec_cfg.dai_cfg.i2s.mem_slab          = &in_slab;
+    codec_cfg.dai_cfg.i2s.block_size        = playback->block_size;
+    codec_cfg.dai_cfg.i2s.timeout           = 1000;
+
+    // configure i2s rx
+    ret = i2s_configure(playback->i2s_dev, I2S_DIR_RX, &codec_cfg.dai_cfg.i2s);
+    if (ret)
+    {
+        LOG_ERR("Can't config i2s");
+        goto exit;
+    }
+
+    // stop any previous i2s activity
+    i2s_trigger(playback->i2s_dev, I2S_DIR_RX, I2S_TRIGGER_DROP);
+    i2s_trigger(playback->i2s_dev, I2S_DIR_RX, I2S_TRIGGER_PREPARE);
+
+    // start i2s
+    ret = i2s_trigger(playback->i2s_dev, I2S_DIR_RX, I2S_TRIGGER_START);
+    if (ret)
+    {
+        LOG_ERR("Can't start i2s");
+        goto exit;
+    }
+
+    // The Zephyr I2S interface is too "smart" about picking an MCLK to match
+    // the data-rate and source clock to get minimum bit-rate error. Unfortunately
+    // audio codec needs an mclk 256* the sample rate, so this code hand-sets the
+    // i2s register divisors
+    //
+    _SetupAudioClock(playback->sample_rate);
+    ret = 0;
+exit:
+    return ret;
+}
+
 static void _AudioTaskMain(void * parameter)
 {
     int ret = -1;
-    struct audio_codec_cfg codec_cfg;
 
     m_playback_state.i2s_dev = DEVICE_DT_GET(I2S_RX_NODE);
 
@@ -323,12 +720,13 @@ static void _AudioTaskMain(void * parameter)
 
     for (int block = 0; block < AUDIO_OUT_BLOCK_COUNT; block++)
     {
-        k_mem_slab_alloc(&out_slab, (void *)&m_playback_state.outring[block], K_NO_WAIT);
+        k_mem_slab_alloc(&out_slab, (void **)&m_playback_state.outring.blocks[block].samples, K_NO_WAIT);
     }
 
     m_playback_state.samples = 0;
 
     k_sem_init(&m_playback_state.start_sem, 0, 1);
+    k_sem_init(&m_playback_state.data_sem, 0, 1);
 
     while(true)
     {
@@ -336,59 +734,43 @@ static void _AudioTaskMain(void * parameter)
         ret = k_sem_take(&m_playback_state.start_sem, K_FOREVER);
         if (!ret)
         {
-            m_playback_state.head = 0;
-            m_playback_state.tail = 0;
-            m_playback_state.count = 0;
-
-            codec_cfg.dai_cfg.i2s.word_size         = m_playback_state.bytes_per_sample * 8;
-            codec_cfg.dai_cfg.i2s.channels          = m_playback_state.channels;
-            codec_cfg.dai_cfg.i2s.format            = I2S_FMT_DATA_FORMAT_LEFT_JUSTIFIED;
-            if (m_playback_state.supply_clock)
+            // anything left in the ring is from the previous capture.  The
+            // reader may be part way through copying the tail block, so
+            // rather than emptying the ring from this side, move on a
+            // generation and let the reader throw the old blocks away
+            //
+            atomic_inc(&m_playback_state.generation);
+            m_playback_state.capture_gen = (uint32_t)atomic_get(&m_playback_state.generation);
+            m_playback_state.samples = 0;
+            m_playback_state.capture_source = m_playback_state.source;
+            m_playback_state.capturing = true;
+            atomic_set(&m_playback_state.idle, 0);
+
+            if (m_playback_state.capture_source == AUDIO_SOURCE_I2S)
             {
-                codec_cfg.dai_cfg.i2s.options       = I2S_OPT_BIT_CLK_MASTER | I2S_OPT_FRAME_CLK_MASTER;
+                ret = _StartI2S(&m_playback_state);
+                if (ret)
+                {
+                    goto failed_start;
+                }
             }
             else
             {
-                codec_cfg.dai_cfg.i2s.options       = I2S_OPT_BIT_CLK_SLAVE | I2S_OPT_FRAME_CLK_SLAVE;
-            }
-            codec_cfg.dai_cfg.i2s.frame_clk_freq    = m_playback_state.sample_rate;
-            codec_cfg.dai_cfg.i2s.mem_slab          = &in_slab;
-            codec_cfg.dai_cfg.i2s.block_size        = m_playback_state.block_size;
-            codec_cfg.dai_cfg.i2s.timeout           = 1000;
-
-            // configure i2s rx
-            ret = i2s_configure(m_playback_state.i2s_dev, I2S_DIR_RX, &codec_cfg.dai_cfg.i2s);
-            if (ret)
-            {
-                LOG_ERR("Can't config i2s");
-                goto failed_start;
+                _PatternStart(&m_playback_state);
             }
 
-            // stop any previous i2s activity
-            i2s_trigger(m_playback_state.i2s_dev, I2S_DIR_RX, I2S_TRIGGER_DROP);
-            i2s_trigger(m_playback_state.i2s_dev, I2S_DIR_RX, I2S_TRIGGER_PREPARE);
-
             m_playback_state.start_time_ms = k_uptime_get();
 
-            // start i2s
-            ret = i2s_trigger(m_playback_state.i2s_dev, I2S_DIR_RX, I2S_TRIGGER_START);
-            if (ret)
-            {
-                LOG_ERR("Can't start i2s");
-                goto failed_start;
-            }
-
             m_playback_state.drop_frac = 0;
             m_playback_state.drop_rate = 0;
-            m_playback_state.last_read = 0;
+            if (!m_playback_state.resuming)
+            {
+                // keep telemetry running over idle periods
+                AudioClearTelemetry();
+            }
+            m_playback_state.resuming = false;
             m_playback_state.active = true;
-
-            // The Zephyr I2S interface is too "smart" about picking an MCLK to match
-            // the data-rate and source clock to get minimum bit-rate error. Unfortunately
-            // audio codec needs an mclk 256* the sample rate, so this code hand-sets the
-            // i2s register divisors
-            //
-            ret = _SetupAudioClock(m_playback_state.sample_rate);
+            _Notify(&m_playback_state);
 
             while (m_playback_state.active)
             {
@@ -401,10 +783,21 @@ static void _AudioTaskMain(void * parameter)
                         m_playback_state.active = false;
                     }
                 }
+
+                if (_IdleCheck(&m_playback_state))
+                {
+                    break;
+                }
             }
 
 failed_start:
-            i2s_trigger(m_playback_state.i2s_dev, I2S_DIR_RX, I2S_TRIGGER_DROP);
+            if (m_playback_state.capture_source == AUDIO_SOURCE_I2S)
+            {
+                i2s_trigger(m_playback_state.i2s_dev, I2S_DIR_RX, I2S_TRIGGER_DROP);
+            }
+
+            m_playback_state.capturing = false;
+            _Notify(&m_playback_state);
         }
     }
 
@@ -417,47 +810,519 @@ failed_start:
 
 K_THREAD_DEFINE(s_audio_thread_id, AUDIO_STACKSIZE, _AudioTaskMain, NULL, NULL, NULL, AUDIO_PRIORITY, 0, 0);
 
-int AudioGetSamples(void **out_sample_block, size_t *out_sample_bytes)
+DSP_RAMFUNC int AudioGetSamples(void **out_sample_block, size_t *out_sample_bytes)
 {
     int ret = -ENOENT;
+    struct audio_block *block;
 
     *out_sample_block = NULL;
     *out_sample_bytes = 0;
 
     m_playback_state.last_read = k_uptime_get();
 
-    if (m_playback_state.count > 0)
+    _IdleWake(&m_playback_state);
+
+    block = _RingPeek(&m_playback_state.outring);
+
+    // drop blocks captured before (or during) a retune, or by an earlier
+    // run of capture
+    //
+    while (
+            block
+        && (
+                atomic_get(&m_playback_state.muted)
+            ||  block->gen != (uint32_t)atomic_get(&m_playback_state.generation)
+        )
+    )
     {
-        k_mutex_lock(&m_playback_state.block_lock, K_FOREVER);
+        m_playback_state.read_offset = 0;
+        m_playback_state.retune_discards++;
+        _RingRelease(&m_playback_state.outring);
+        block = _RingPeek(&m_playback_state.outring);
+    }
+
+    // after waking up, let the ring fill part way before serving so the
+    // reader doesn't immediately underrun
+    //
+    if (block && m_playback_state.prerolling)
+    {
+        if (_RingCount(&m_playback_state.outring) < AUDIO_PREROLL_BLOCKS)
+        {
+            block = NULL;
+        }
+        else
+        {
+            uint32_t latency = (uint32_t)(m_playback_state.last_read - m_playback_state.wake_start_ms);
 
-        *out_sample_block = m_playback_state.outring[m_playback_state.tail];
-        *out_sample_bytes = AUDIO_SECTOR_SIZE;
+            m_playback_state.prerolling = false;
+            m_playback_state.wake_last_ms = latency;
+            if (latency > m_playback_state.wake_max_ms)
+            {
+                m_playback_state.wake_max_ms = latency;
+            }
+            LOG_INF("capture restarted in %u ms", latency);
+        }
+    }
 
-        m_playback_state.count--;
-        m_playback_state.tail++;
-        if (m_playback_state.tail >= AUDIO_RING_SIZE)
+    if (block)
+    {
+        if (m_playback_state.retune_pending)
         {
-            m_playback_state.tail = 0;
+            uint32_t latency = (uint32_t)(m_playback_state.last_read - m_playback_state.retune_start_ms);
+
+            m_playback_state.retune_pending = false;
+            m_playback_state.retune_last_ms = latency;
+            if (latency > m_playback_state.retune_max_ms)
+            {
+                m_playback_state.retune_max_ms = latency;
+            }
+            LOG_INF("retune to audio %u ms (tune %u ms)", latency, m_playback_state.retune_tune_ms);
         }
 
-        k_mutex_unlock(&m_playback_state.block_lock);
+        *out_sample_block = (uint8_t *)block->samples + m_playback_state.read_offset;
+        *out_sample_bytes = block->bytes - m_playback_state.read_offset;
         ret = 0;
     }
 
     return ret;
 }
 
+DSP_RAMFUNC int AudioReleaseSamples(size_t in_sample_bytes)
+{
+    struct audio_block *block;
+
+    block = _RingPeek(&m_playback_state.outring);
+    if (block)
+    {
+        m_playback_state.read_offset += in_sample_bytes;
+        m_playback_state.tx_bytes += in_sample_bytes;
+
+        if (m_playback_state.read_offset >= block->bytes)
+        {
+            m_playback_state.read_offset = 0;
+            _RingRelease(&m_playback_state.outring);
+        }
+    }
+
+    return 0;
+}
+
+// scale a packed 16 bit stereo frame by gain (AUDIO_UNITY_GAIN is 1.0)
+//
+static inline uint32_t _FrameScale(uint32_t frame, int32_t gain)
+{
+    int32_t left  = ((int32_t)(int16_t)(frame >> 16) * gain) >> 15;
+    int32_t right = ((int32_t)(int16_t)(frame & 0xFFFF) * gain) >> 15;
+
+    return ((uint32_t)left << 16) | ((uint32_t)right & 0xFFFF);
+}
+
+// mix two packed frames, mix is the weight of b (AUDIO_UNITY_GAIN is all b)
+//
+static inline uint32_t _FrameMix(uint32_t a, uint32_t b, int32_t mix)
+{
+    int32_t left  = (int16_t)(a >> 16);
+    int32_t right = (int16_t)(a & 0xFFFF);
+
+    left  += (((int32_t)(int16_t)(b >> 16) - left) * mix) >> 15;
+    right += (((int32_t)(int16_t)(b & 0xFFFF) - right) * mix) >> 15;
+
+    return ((uint32_t)left << 16) | ((uint32_t)right & 0xFFFF);
+}
+
+// next frame of the concealment signal: the history looped, fading out
+//
+static inline uint32_t _ConcealFrame(struct playback_ctx *playback)
+{
+    uint32_t frame;
+
+    frame = playback->conceal_hist[(playback->hist_pos + playback->conceal_pos) % AUDIO_CONCEAL_FRAMES];
+    frame = _FrameScale(frame, playback->conceal_gain);
+
+    playback->conceal_pos++;
+    if (playback->conceal_gain > 0)
+    {
+        playback->conceal_gain -= AUDIO_UNITY_GAIN / AUDIO_CONCEAL_FADE_FRAMES;
+        if (playback->conceal_gain < 0)
+        {
+            playback->conceal_gain = 0;
+        }
+    }
+
+    return frame;
+}
+
+// remember the tail of what was just read for concealing a later underrun.
+// if the previous read was concealed, crossfade from the concealment back
+// into the real audio at the start of it
+//
+static void _ConcealTrack(struct playback_ctx *playback, uint32_t *frames, uint32_t count)
+{
+    uint32_t frame;
+
+    if (playback->concealing && count > 0)
+    {
+        for (frame = 0; frame < count && frame < AUDIO_CONCEAL_XFADE_FRAMES; frame++)
+        {
+            frames[frame] = _FrameMix(_ConcealFrame(playback), frames[frame],
+                    (frame + 1) * AUDIO_UNITY_GAIN / (AUDIO_CONCEAL_XFADE_FRAMES + 1));
+        }
+
+        playback->concealing = false;
+    }
+
+    frame = (count > AUDIO_CONCEAL_FRAMES) ? (count - AUDIO_CONCEAL_FRAMES) : 0;
+    for (; frame < count; frame++)
+    {
+        playback->conceal_hist[playback->hist_pos] = frames[frame];
+        playback->hist_pos = (playback->hist_pos + 1) % AUDIO_CONCEAL_FRAMES;
+    }
+}
+
+// fill the part of a read the ring couldn't supply.  The cost is a couple of
+// multiplies per channel per frame so it's bounded by the read size
+//
+static void _ConcealFill(struct playback_ctx *playback, uint32_t *frames, uint32_t first, uint32_t count)
+{
+    uint32_t start = k_cycle_get_32();
+    uint32_t last;
+    uint32_t cycles;
+    uint32_t frame;
+
+    if (!playback->concealing)
+    {
+        playback->concealing = true;
+        playback->conceal_pos = 0;
+        playback->conceal_gain = AUDIO_UNITY_GAIN;
+    }
+
+    // the frame just before the hole, to crossfade into the loop from
+    //
+    if (first > 0)
+    {
+        last = frames[first - 1];
+    }
+    else
+    {
+        last = playback->conceal_hist[(playback->hist_pos + AUDIO_CONCEAL_FRAMES - 1) % AUDIO_CONCEAL_FRAMES];
+    }
+
+    for (frame = first; frame < count; frame++)
+    {
+        if (playback->conceal_pos < AUDIO_CONCEAL_XFADE_FRAMES)
+        {
+            // take the weight before _ConcealFrame moves conceal_pos on
+            //
+            int32_t mix = playback->conceal_pos * AUDIO_UNITY_GAIN / AUDIO_CONCEAL_XFADE_FRAMES;
+            uint32_t conceal = _ConcealFrame(playback);
+
+            frames[frame] = _FrameMix(last, conceal, mix);
+        }
+        else
+        {
+            frames[frame] = _ConcealFrame(playback);
+        }
+    }
+
+    playback->concealed++;
+    playback->conceal_frames += count - first;
+
+    cycles = k_cycle_get_32() - start;
+    if (cycles > playback->max_conceal_cycles)
+    {
+        playback->max_conceal_cycles = cycles;
+    }
+}
+
+DSP_RAMFUNC int AudioReadSamples(void *out_samples, size_t in_sample_bytes, int32_t in_timeout_ms)
+{
+    uint8_t *dst = (uint8_t *)out_samples;
+    size_t copied = 0;
+    uint64_t deadline;
+    uint32_t wait_start;
+    uint32_t wait_us;
+    bool waited = false;
+    void *samples;
+    size_t sample_bytes;
+    int64_t remain;
+
+    wait_start = k_cycle_get_32();
+    deadline = k_uptime_get() + in_timeout_ms;
+
+    while (copied < in_sample_bytes)
+    {
+        if (AudioGetSamples(&samples, &sample_bytes))
+        {
+            remain = (int64_t)deadline - k_uptime_get();
+            if (remain <= 0)
+            {
+                break;
+            }
+
+            k_sem_take(&m_playback_state.data_sem, K_MSEC(remain));
+            waited = true;
+            continue;
+        }
+
+        if (sample_bytes > (in_sample_bytes - copied))
+        {
+            sample_bytes = in_sample_bytes - copied;
+        }
+
+        memcpy(dst + copied, samples, sample_bytes);
+        copied += sample_bytes;
+
+        // done with (this part of) the block, let the audio thread refill it
+        AudioReleaseSamples(sample_bytes);
+    }
+
+    if (waited)
+    {
+        wait_us = k_cyc_to_us_floor32(k_cycle_get_32() - wait_start);
+        if (wait_us > m_playback_state.max_wait_us)
+        {
+            m_playback_state.max_wait_us = wait_us;
+        }
+    }
+
+    // keep history of what was really read, and conceal what wasn't
+    //
+    _ConcealTrack(&m_playback_state, (uint32_t *)out_samples, copied / AUDIO_OUT_FRAME_SIZE);
+
+    if (copied < in_sample_bytes)
+    {
+        m_playback_state.underruns++;
+        _ConcealFill(&m_playback_state, (uint32_t *)out_samples,
+                copied / AUDIO_OUT_FRAME_SIZE, in_sample_bytes / AUDIO_OUT_FRAME_SIZE);
+    }
+
+    return (int)copied;
+}
+
+int AudioSetNotify(audio_notify_t in_notify, void *in_ctx)
+{
+    m_playback_state.notify_ctx = in_ctx;
+    m_playback_state.notify = in_notify;
+    return 0;
+}
+
+int AudioAddTap(audio_tap_t in_tap, void *in_ctx)
+{
+    int ret = -ENOSPC;
+    int tap;
+
+    require_action(in_tap, exit, ret = -EINVAL);
+
+    tap = atomic_get(&m_playback_state.num_taps);
+    require(tap < AUDIO_MAX_TAPS, exit);
+
+    // fill in the slot before counting it so the audio thread never
+    // sees a half added tap
+    //
+    m_playback_state.taps[tap] = in_tap;
+    m_playback_state.tap_ctx[tap] = in_ctx;
+    atomic_set(&m_playback_state.num_taps, tap + 1);
+    ret = 0;
+exit:
+    return ret;
+}
+
+int AudioHoldCapture(bool in_hold)
+{
+    if (in_hold)
+    {
+        atomic_inc(&m_playback_state.holds);
+    }
+    else
+    {
+        require(atomic_get(&m_playback_state.holds) > 0, exit);
+        atomic_dec(&m_playback_state.holds);
+    }
+exit:
+    return 0;
+}
+
+int AudioRetuneBegin(void)
+{
+    struct playback_ctx *playback = &m_playback_state;
+
+    // called by the reader when it asks for a new station. mute, so the
+    // old station's blocks are discarded, and don't conceal from them either
+    //
+    atomic_set(&playback->muted, 1);
+
+    playback->retune_start_ms = k_uptime_get();
+    playback->retune_pending = true;
+    playback->retunes++;
+
+    memset(playback->conceal_hist, 0, sizeof(playback->conceal_hist));
+    playback->concealing = false;
+    return 0;
+}
+
+int AudioRetuneEnd(void)
+{
+    struct playback_ctx *playback = &m_playback_state;
+
+    // called once the tuner has settled on the new station (STC). only
+    // blocks captured from here on will be read
+    //
+    playback->retune_tune_ms = (uint32_t)(k_uptime_get() - playback->retune_start_ms);
+
+    atomic_inc(&playback->generation);
+    atomic_set(&playback->muted, 0);
+
+    k_sem_give(&playback->data_sem);
+    return 0;
+}
+
+int AudioGetTelemetry(struct audio_telemetry *out_telemetry)
+{
+    struct playback_ctx *playback = &m_playback_state;
+    uint64_t elapsed_ms;
+
+    require(out_telemetry, exit);
+
+    elapsed_ms = k_uptime_get() - playback->stats_start_ms;
+
+    out_telemetry->elapsed_ms   = (uint32_t)elapsed_ms;
+    out_telemetry->rx_blocks    = playback->rx_blocks;
+    out_telemetry->rx_frames    = (uint32_t)playback->rx_frames;
+    out_telemetry->tx_frames    = (uint32_t)(playback->tx_bytes / AUDIO_OUT_FRAME_SIZE);
+    out_telemetry->overruns     = playback->overruns;
+    out_telemetry->underruns    = playback->underruns;
+    out_telemetry->i2s_errors   = playback->i2s_errors;
+    out_telemetry->max_wait_us  = playback->max_wait_us;
+    out_telemetry->in_rate_hz   = elapsed_ms ? (uint32_t)(playback->rx_frames * 1000 / elapsed_ms) : 0;
+    out_telemetry->out_rate_hz  = elapsed_ms ? (uint32_t)(playback->tx_bytes * 1000 / AUDIO_OUT_FRAME_SIZE / elapsed_ms) : 0;
+    out_telemetry->ring_size    = AUDIO_RING_SIZE - 1;
+    out_telemetry->concealed    = playback->concealed;
+    out_telemetry->conceal_frames = (uint32_t)playback->conceal_frames;
+    out_telemetry->retunes      = playback->retunes;
+    out_telemetry->retune_discards = playback->retune_discards;
+    out_telemetry->retune_tune_ms = playback->retune_tune_ms;
+    out_telemetry->retune_last_ms = playback->retune_last_ms;
+    out_telemetry->retune_max_ms = playback->retune_max_ms;
+    out_telemetry->idles        = playback->idles;
+    out_telemetry->idle_ms      = playback->idle_ms;
+    out_telemetry->idle_saved_us = playback->idle_saved_us;
+    out_telemetry->wake_last_ms = playback->wake_last_ms;
+    out_telemetry->wake_max_ms  = playback->wake_max_ms;
+    out_telemetry->peak_hold    = playback->meter.peak_hold;
+    out_telemetry->rms          = playback->meter.rms;
+    out_telemetry->loudness_db10 = playback->meter.loudness_db10;
+    out_telemetry->agc_gain     = playback->agc.enabled ? playback->agc.gain : DSP_GAIN_UNITY;
+    out_telemetry->agc_limited  = playback->agc.limited;
+    out_telemetry->max_dsp_cycles = playback->max_dsp_cycles;
+
+    for (int bin = 0; bin < AUDIO_FILL_BINS; bin++)
+    {
+        out_telemetry->fill_hist[bin] = playback->fill_hist[bin];
+    }
+
+    return 0;
+exit:
+    return -EINVAL;
+}
+
+int AudioTelemetrySnapshot(uint8_t *out_buffer, size_t in_size)
+{
+    struct audio_telemetry telemetry;
+    const uint32_t *field;
+    uint8_t *dst;
+    int ret = -ENOSPC;
+
+    require(out_buffer, exit);
+    require(in_size >= AUDIO_TELEMETRY_SNAPSHOT_SIZE, exit);
+
+    ret = AudioGetTelemetry(&telemetry);
+    require_noerr(ret, exit);
+
+    dst = out_buffer;
+    *dst++ = AUDIO_TELEMETRY_VERSION;
+    *dst++ = AUDIO_TELEMETRY_FIELDS;
+    *dst++ = (uint8_t)(AUDIO_TELEMETRY_SNAPSHOT_SIZE & 0xFF);
+    *dst++ = (uint8_t)(AUDIO_TELEMETRY_SNAPSHOT_SIZE >> 8);
+
+    field = (const uint32_t *)&telemetry;
+    for (int index = 0; index < AUDIO_TELEMETRY_FIELDS; index++)
+    {
+        *dst++ = (uint8_t)(field[index]);
+        *dst++ = (uint8_t)(field[index] >> 8);
+        *dst++ = (uint8_t)(field[index] >> 16);
+        *dst++ = (uint8_t)(field[index] >> 24);
+    }
+
+    ret = AUDIO_TELEMETRY_SNAPSHOT_SIZE;
+exit:
+    return ret;
+}
+
+void AudioClearTelemetry(void)
+{
+    struct playback_ctx *playback = &m_playback_state;
+
+    playback->outring.max_put_cycles = 0;
+    playback->outring.max_get_cycles = 0;
+    playback->outring.max_age_cycles = 0;
+    playback->overruns      = 0;
+    playback->underruns     = 0;
+    playback->i2s_errors    = 0;
+    playback->max_wait_us   = 0;
+    playback->concealed     = 0;
+    playback->conceal_frames = 0;
+    playback->max_conceal_cycles = 0;
+    playback->retunes       = 0;
+    playback->retune_discards = 0;
+    playback->retune_max_ms = 0;
+    playback->idles         = 0;
+    playback->idle_ms       = 0;
+    playback->idle_saved_us = 0;
+    playback->wake_max_ms   = 0;
+    playback->max_dsp_cycles = 0;
+    playback->meter.peak_hold = 0;
+    playback->agc.limited   = 0;
+    playback->rx_blocks     = 0;
+    playback->rx_frames     = 0;
+    playback->tx_bytes      = 0;
+    playback->busy_cycles   = 0;
+    playback->max_block_cycles = 0;
+    memset(playback->fill_hist, 0, sizeof(playback->fill_hist));
+    playback->stats_start_ms = k_uptime_get();
+}
+
+int AudioSetSource(enum audio_source in_source)
+{
+    int ret = -EINVAL;
+
+    require(in_source <= AUDIO_SOURCE_SINE, exit);
+
+    // takes effect the next time capture starts
+    //
+    m_playback_state.source = in_source;
+    ret = 0;
+exit:
+    return ret;
+}
+
 bool AudioActive(void)
 {
     return m_playback_state.active;
 }
 
+uint32_t AudioReadIdleMs(void)
+{
+    uint64_t last = MAX(m_playback_state.last_read, m_playback_state.start_time_ms);
+
+    return (uint32_t)MIN(k_uptime_get() - last, UINT32_MAX);
+}
+
 int AudioStart(void)
 {
     m_playback_state.channels           = 2;
-    m_playback_state.bytes_per_sample   = 24 / 8;
+    m_playback_state.bytes_per_sample   = AUDIO_IN_SAMPLE_BITS / 8;
     m_playback_state.sample_rate        = 44100;
-    m_playback_state.block_size         = AUDIO_IN_BLOCK_SIZE;
+    m_playback_state.block_size         = m_playback_state.dma_frames * AUDIO_IN_FRAME_SIZE;
 
     m_playback_state.rx_blocks          = 0;
     m_playback_state.duration_ms        = 0;
@@ -477,7 +1342,14 @@ int AudioInit(bool supply_clock)
     m_playback_state.supply_clock = supply_clock;
     if (!m_playback_state.initialized)
     {
-        k_mutex_init(&m_playback_state.block_lock);
+        m_playback_state.dma_frames = AUDIO_DMA_FRAMES_DEFAULT;
+
+        AudioDspMeterInit(&m_playback_state.meter, AUDIO_SAMPLES_PER_BLOCK, 44100);
+        AudioDspAgcInit(&m_playback_state.agc, CONFIG_AUDIO_AGC_TARGET_DB * 10);
+        m_playback_state.agc.enabled = IS_ENABLED(CONFIG_AUDIO_AGC);
+#ifdef UNIT_TEST
+        verify_noerr(AudioDspUnitTest());
+#endif
         m_playback_state.initialized = true;
     }
     return 0;
@@ -490,13 +1362,13 @@ int AudioInit(bool supply_clock)
 
 static void _CmdAudioTest(const struct shell *shell, size_t argc, char **argv)
 {
-    int sample_bits = 24;
+    int sample_bits = AUDIO_IN_SAMPLE_BITS;
     int sample_rate = 44100;
 
     m_playback_state.channels           = 2;
     m_playback_state.bytes_per_sample   = sample_bits / 8;
     m_playback_state.sample_rate        = sample_rate;
-    m_playback_state.block_size         = AUDIO_IN_BLOCK_SIZE;
+    m_playback_state.block_size         = m_playback_state.dma_frames * AUDIO_IN_FRAME_SIZE;
 
     m_playback_state.rx_blocks          = 0;
     m_playback_state.duration_ms        = 2000;
@@ -511,6 +1383,296 @@ static void _CmdAudioTest(const struct shell *shell, size_t argc, char **argv)
     while (m_playback_state.active);
 }
 
+static void _CmdAudioStats(const struct shell *shell, size_t argc, char **argv)
+{
+    struct audio_ring *ring = &m_playback_state.outring;
+    uint32_t hz = sys_clock_hw_cycles_per_sec();
+
+    uint64_t elapsed_ms = k_uptime_get() - m_playback_state.stats_start_ms;
+    uint64_t busy_us = k_cyc_to_us_floor64(m_playback_state.busy_cycles);
+
+    shell_print(shell, "rx blocks %u  ring %u/%u  overruns %u",
+            m_playback_state.rx_blocks, _RingCount(ring), AUDIO_RING_SIZE - 1, m_playback_state.overruns);
+    if (elapsed_ms > 0)
+    {
+        shell_print(shell, "dma %u frames (%u us)  %u wakeups/s  cpu %u.%02u%%",
+                m_playback_state.dma_frames,
+                m_playback_state.dma_frames * 1000000 / m_playback_state.sample_rate,
+                (uint32_t)(m_playback_state.rx_blocks * 1000ULL / elapsed_ms),
+                (uint32_t)(busy_us / (elapsed_ms * 10)),
+                (uint32_t)((busy_us * 100 / (elapsed_ms * 10)) % 100));
+    }
+    shell_print(shell, "worst put %u cyc  get %u cyc  block age %u us  conceal %u cyc",
+            ring->max_put_cycles, ring->max_get_cycles,
+            (uint32_t)((uint64_t)ring->max_age_cycles * 1000000 / hz),
+            m_playback_state.max_conceal_cycles);
+    shell_print(shell, "block avg %u cyc  worst %u cyc  (%s)",
+            m_playback_state.rx_blocks ? (uint32_t)(m_playback_state.busy_cycles / m_playback_state.rx_blocks) : 0,
+            m_playback_state.max_block_cycles,
+            IS_ENABLED(CONFIG_AUDIO_RAMFUNC) ? "ram" : "flash");
+
+    if (argc > 1 && !strcmp(argv[1], "clear"))
+    {
+        AudioClearTelemetry();
+    }
+}
+
+static void _CmdAudioTelemetry(const struct shell *shell, size_t argc, char **argv)
+{
+    struct audio_telemetry telemetry;
+    uint8_t snapshot[AUDIO_TELEMETRY_SNAPSHOT_SIZE];
+    int32_t drift_ppm;
+    int ret;
+
+    if (argc > 1 && !strcmp(argv[1], "raw"))
+    {
+        ret = AudioTelemetrySnapshot(snapshot, sizeof(snapshot));
+        if (ret > 0)
+        {
+            shell_hexdump(shell, snapshot, ret);
+        }
+        return;
+    }
+
+    AudioGetTelemetry(&telemetry);
+
+    drift_ppm = 0;
+    if (telemetry.in_rate_hz)
+    {
+        drift_ppm = (int32_t)(((int64_t)telemetry.out_rate_hz - (int64_t)telemetry.in_rate_hz) * 1000000 / telemetry.in_rate_hz);
+    }
+
+    shell_print(shell, "%u ms  rx %u blocks %u frames  tx %u frames",
+            telemetry.elapsed_ms, telemetry.rx_blocks, telemetry.rx_frames, telemetry.tx_frames);
+    shell_print(shell, "in %u Hz  out %u Hz  drift %d ppm",
+            telemetry.in_rate_hz, telemetry.out_rate_hz, drift_ppm);
+    shell_print(shell, "overruns %u  underruns %u  i2s errors %u  max wait %u us",
+            telemetry.overruns, telemetry.underruns, telemetry.i2s_errors, telemetry.max_wait_us);
+    shell_print(shell, "concealed %u reads, %u frames",
+            telemetry.concealed, telemetry.conceal_frames);
+    shell_print(shell, "retunes %u  discarded %u blocks  tune %u ms  open to audio %u ms (max %u)",
+            telemetry.retunes, telemetry.retune_discards, telemetry.retune_tune_ms,
+            telemetry.retune_last_ms, telemetry.retune_max_ms);
+    shell_print(shell, "idle %u times, %u ms, saved %u us cpu  restart %u ms (max %u)%s",
+            telemetry.idles, telemetry.idle_ms, telemetry.idle_saved_us,
+            telemetry.wake_last_ms, telemetry.wake_max_ms,
+            atomic_get(&m_playback_state.idle) ? "  [idle]" : "");
+    shell_print(shell, "peak %d dB  rms %d dB  loudness %d.%d dB  agc gain %d.%d dB  limited %u  dsp %u cyc",
+            AudioDspLevelDb10(telemetry.peak_hold) / 10,
+            AudioDspLevelDb10(telemetry.rms) / 10,
+            telemetry.loudness_db10 / 10, abs(telemetry.loudness_db10 % 10),
+            (AudioDspLevelDb10(telemetry.agc_gain * 8) / 10),
+            abs(AudioDspLevelDb10(telemetry.agc_gain * 8) % 10),
+            telemetry.agc_limited, telemetry.max_dsp_cycles);
+    shell_print(shell, "ring fill (of %u blocks):", telemetry.ring_size);
+    for (int bin = 0; bin < AUDIO_FILL_BINS; bin++)
+    {
+        shell_print(shell, "  %3u%%  %u", bin * 100 / AUDIO_FILL_BINS, telemetry.fill_hist[bin]);
+    }
+}
+
+// stop and restart capture so new settings take effect
+//
+static void _RestartCapture(void)
+{
+    AudioStop();
+    while (m_playback_state.capturing)
+    {
+        k_msleep(10);
+    }
+
+    AudioStart();
+}
+
+static void _CmdAudioDma(const struct shell *shell, size_t argc, char **argv)
+{
+    uint32_t frames;
+
+    if (argc < 2)
+    {
+        shell_print(shell, "dma block %u frames (%u..%u)",
+                m_playback_state.dma_frames, AUDIO_DMA_FRAMES_MIN, AUDIO_DMA_FRAMES_MAX);
+        return;
+    }
+
+    frames = strtoul(argv[1], NULL, 0);
+    if (frames < AUDIO_DMA_FRAMES_MIN || frames > AUDIO_DMA_FRAMES_MAX)
+    {
+        shell_print(shell, "dma block must be %u..%u frames", AUDIO_DMA_FRAMES_MIN, AUDIO_DMA_FRAMES_MAX);
+        return;
+    }
+
+    m_playback_state.dma_frames = frames;
+    _RestartCapture();
+}
+
+static void _CmdAudioAgc(const struct shell *shell, size_t argc, char **argv)
+{
+    if (argc > 1)
+    {
+        m_playback_state.agc.enabled = !strcmp(argv[1], "on");
+    }
+
+    if (argc > 2)
+    {
+        struct dsp_agc agc;
+
+        // re-init for the new target but keep the current gain
+        //
+        AudioDspAgcInit(&agc, strtol(argv[2], NULL, 0) * 10);
+        m_playback_state.agc.target_rms = agc.target_rms;
+    }
+
+    shell_print(shell, "agc %s  target %d dB  gain %d/%d",
+            m_playback_state.agc.enabled ? "on" : "off",
+            AudioDspLevelDb10(m_playback_state.agc.target_rms) / 10,
+            m_playback_state.agc.gain, DSP_GAIN_UNITY);
+}
+
+static void _CmdAudioSource(const struct shell *shell, size_t argc, char **argv)
+{
+    static const char *names[] = { "i2s", "counter", "sine" };
+
+    if (argc < 2)
+    {
+        shell_print(shell, "source %s", names[m_playback_state.source]);
+        return;
+    }
+
+    for (int source = 0; source < ARRAY_SIZE(names); source++)
+    {
+        if (!strcmp(argv[1], names[source]))
+        {
+            AudioSetSource((enum audio_source)source);
+            _RestartCapture();
+            return;
+        }
+    }
+
+    shell_print(shell, "source must be i2s, counter or sine");
+}
+
+// Stress test the ring with a producer and a consumer thread hammering
+// a private ring as fast as they can.  Every word of a block is stamped
+// with the block sequence so the consumer can catch torn or reordered blocks
+//
+#define RING_TEST_STACKSIZE     (1024)
+#define RING_TEST_WORDS         (16)
+
+static struct audio_ring s_test_ring;
+static uint32_t s_test_samples[AUDIO_RING_SIZE][RING_TEST_WORDS];
+static volatile bool s_test_running;
+static uint32_t s_test_produced;
+static uint32_t s_test_consumed;
+static uint32_t s_test_errors;
+
+static K_THREAD_STACK_DEFINE(s_test_prod_stack, RING_TEST_STACKSIZE);
+static K_THREAD_STACK_DEFINE(s_test_cons_stack, RING_TEST_STACKSIZE);
+static struct k_thread s_test_prod_thread;
+static struct k_thread s_test_cons_thread;
+
+static void _RingTestProducer(void *p1, void *p2, void *p3)
+{
+    struct audio_ring *ring = &s_test_ring;
+    uint32_t *dst;
+
+    while (s_test_running)
+    {
+        dst = _RingHeadBlock(ring)->samples;
+
+        for (int word = 0; word < RING_TEST_WORDS; word++)
+        {
+            dst[word] = ring->seq;
+        }
+
+        if (_RingPublish(ring, sizeof(uint32_t) * RING_TEST_WORDS))
+        {
+            k_yield();
+        }
+        else
+        {
+            s_test_produced++;
+        }
+    }
+}
+
+static void _RingTestConsumer(void *p1, void *p2, void *p3)
+{
+    struct audio_ring *ring = &s_test_ring;
+    struct audio_block *block;
+    uint32_t expect = 0;
+
+    while (s_test_running || _RingCount(ring))
+    {
+        block = _RingPeek(ring);
+        if (!block)
+        {
+            k_yield();
+            continue;
+        }
+
+        if (block->seq != expect)
+        {
+            s_test_errors++;
+        }
+
+        for (int word = 0; word < RING_TEST_WORDS; word++)
+        {
+            if (block->samples[word] != block->seq)
+            {
+                s_test_errors++;
+                break;
+            }
+        }
+
+        expect = block->seq + 1;
+        _RingRelease(ring);
+        s_test_consumed++;
+    }
+}
+
+static void _CmdAudioRingTest(const struct shell *shell, size_t argc, char **argv)
+{
+    struct audio_ring *ring = &s_test_ring;
+    uint32_t seconds = 5;
+    uint32_t hz = sys_clock_hw_cycles_per_sec();
+
+    if (argc > 1)
+    {
+        seconds = strtoul(argv[1], NULL, 0);
+    }
+
+    memset(ring, 0, sizeof(*ring));
+    for (int block = 0; block < AUDIO_RING_SIZE; block++)
+    {
+        ring->blocks[block].samples = s_test_samples[block];
+    }
+
+    s_test_produced = 0;
+    s_test_consumed = 0;
+    s_test_errors = 0;
+    s_test_running = true;
+
+    // same priority so they preempt each other only at yields and ticks
+    // which hits the full and empty edges of the ring constantly
+    //
+    k_thread_create(&s_test_prod_thread, s_test_prod_stack, RING_TEST_STACKSIZE,
+            _RingTestProducer, NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+    k_thread_create(&s_test_cons_thread, s_test_cons_stack, RING_TEST_STACKSIZE,
+            _RingTestConsumer, NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+
+    k_msleep(seconds * 1000);
+    s_test_running = false;
+
+    k_thread_join(&s_test_prod_thread, K_FOREVER);
+    k_thread_join(&s_test_cons_thread, K_FOREVER);
+
+    shell_print(shell, "produced %u consumed %u errors %u", s_test_produced, s_test_consumed, s_test_errors);
+    shell_print(shell, "worst put %u cyc  get %u cyc  block age %u us",
+            ring->max_put_cycles, ring->max_get_cycles,
+            (uint32_t)((uint64_t)ring->max_age_cycles * 1000000 / hz));
+}
+
 static void _CmdAudioStart(const struct shell *shell, size_t argc, char **argv)
 {
     AudioStart();
@@ -525,6 +1687,12 @@ SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_audio,
     SHELL_CMD_ARG(test,  NULL, "Test audio", _CmdAudioTest, 1, 3),
     SHELL_CMD(start,     NULL, "Start audio", _CmdAudioStart),
     SHELL_CMD(stop,      NULL, "Stop audio", _CmdAudioStop),
+    SHELL_CMD_ARG(stats, NULL, "Audio ring stats [clear]", _CmdAudioStats, 1, 1),
+    SHELL_CMD_ARG(telemetry, NULL, "Pipeline telemetry [raw]", _CmdAudioTelemetry, 1, 1),
+    SHELL_CMD_ARG(source, NULL, "Capture source [i2s|counter|sine]", _CmdAudioSource, 1, 1),
+    SHELL_CMD_ARG(agc, NULL, "AGC [on|off] [target dB]", _CmdAudioAgc, 1, 2),
+    SHELL_CMD_ARG(dma,   NULL, "DMA block frames [frames]", _CmdAudioDma, 1, 1),
+    SHELL_CMD_ARG(ringtest, NULL, "Stress test ring [seconds (5)]", _CmdAudioRingTest, 1, 1),
     SHELL_SUBCMD_SET_END
 );
 
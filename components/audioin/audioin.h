@@ -14,8 +14,105 @@
 #include <stddef.h>
 #include <stdbool.h>
 
+// where captured samples come from. the pattern sources replace i2s with
+// a generated signal at the same block cadence so drops and repeats can be
+// found end to end (see audiochk/). Each stereo frame, read as a 32 bit
+// little-endian word from the wav data, is:
+//
+//   AUDIO_SOURCE_COUNTER   the 32 bit frame count since capture started
+//   AUDIO_SOURCE_SINE      low 16 bits: frame count, high 16 bits: a sine
+//                          with a period of 64 frames
+//
+enum audio_source
+{
+    AUDIO_SOURCE_I2S,
+    AUDIO_SOURCE_COUNTER,
+    AUDIO_SOURCE_SINE,
+};
+
+// pipeline telemetry, counts are since the last clear
+//
+#define AUDIO_TELEMETRY_VERSION     (5)
+#define AUDIO_FILL_BINS             (8)
+
+struct audio_telemetry
+{
+    uint32_t    elapsed_ms;
+    uint32_t    rx_blocks;          // i2s dma blocks received
+    uint32_t    rx_frames;          // stereo frames captured from i2s
+    uint32_t    tx_frames;          // stereo frames handed to readers
+    uint32_t    overruns;           // ring blocks dropped, ring full
+    uint32_t    underruns;          // reads that timed out short
+    uint32_t    i2s_errors;         // failed i2s reads
+    uint32_t    max_wait_us;        // longest a reader blocked for data
+    uint32_t    in_rate_hz;         // measured capture rate
+    uint32_t    out_rate_hz;        // measured read rate
+    uint32_t    ring_size;          // usable ring blocks
+    uint32_t    fill_hist[AUDIO_FILL_BINS]; // ring fill at each dma block
+    uint32_t    concealed;          // reads partly or wholly concealed
+    uint32_t    conceal_frames;     // frames synthesized by concealment
+    uint32_t    retunes;            // station changes
+    uint32_t    retune_discards;    // stale blocks dropped on station change
+    uint32_t    retune_tune_ms;     // last retune request to tuner settled
+    uint32_t    retune_last_ms;     // last retune request to new audio read
+    uint32_t    retune_max_ms;      // worst retune request to new audio read
+    uint32_t    idles;              // times capture was parked for no reads
+    uint32_t    idle_ms;            // total time parked
+    uint32_t    idle_saved_us;      // estimated audio thread cpu time saved
+    uint32_t    wake_last_ms;       // last wake from idle to pre-roll done
+    uint32_t    wake_max_ms;        // worst wake from idle to pre-roll done
+    uint32_t    peak_hold;          // highest sample seen (input, pre-agc)
+    uint32_t    rms;                // rms level of the last block
+    int32_t     loudness_db10;      // short-term loudness, tenths of a dBFS
+    uint32_t    agc_gain;           // agc gain, 4096 is unity
+    uint32_t    agc_limited;        // blocks turned down by the limiter
+    uint32_t    max_dsp_cycles;     // worst meter + agc cost per block
+};
+
+// binary snapshot is a 4 byte header (version, field count, total length
+// as u16) followed by each field above as a little-endian u32, in order
+//
+#define AUDIO_TELEMETRY_FIELDS          (sizeof(struct audio_telemetry) / sizeof(uint32_t))
+#define AUDIO_TELEMETRY_SNAPSHOT_SIZE   (4 + 4 * AUDIO_TELEMETRY_FIELDS)
+
+// taps see every output block, after metering and agc, on the audio
+// thread just before it's published.  They must be quick and not block,
+// anything slow belongs on another thread
+//
+typedef void (*audio_tap_t)(const uint32_t *in_frames, uint32_t in_count, void *in_ctx);
+
+int AudioAddTap(audio_tap_t in_tap, void *in_ctx);
+// keep capture running while nobody is reading, for taps that record
+//
+int AudioHoldCapture(bool in_hold);
+
+int AudioGetTelemetry(struct audio_telemetry *out_telemetry);
+int AudioTelemetrySnapshot(uint8_t *out_buffer, size_t in_size);
+void AudioClearTelemetry(void);
+
 int AudioGetSamples(void **out_sample_block, size_t *out_sample_bytes);
+int AudioReleaseSamples(size_t in_sample_bytes);
+// read exactly in_sample_bytes, waiting up to in_timeout_ms for them. Any
+// part the ring can't supply in time is concealed from recent audio, so the
+// buffer is always filled. Returns the count of real (not concealed) bytes
+//
+int AudioReadSamples(void *out_samples, size_t in_sample_bytes, int32_t in_timeout_ms);
+// bracket a station change: Begin when the new station is asked for, End
+// once the tuner has settled. Audio from before End is never read
+//
+int AudioRetuneBegin(void);
+int AudioRetuneEnd(void);
+int AudioSetSource(enum audio_source in_source);
 bool AudioActive(void);
+// ms since the reader last asked for samples, or since capture started if
+// it hasn't.  Capture being held running for a tap doesn't count as a read
+//
+uint32_t AudioReadIdleMs(void);
+// called on the audio thread when capture starts or stops
+//
+typedef void (*audio_notify_t)(void *in_ctx);
+
+int AudioSetNotify(audio_notify_t in_notify, void *in_ctx);
 int AudioStart(void);
 int AudioStop(void);
 int AudioInit(bool supply_clock);
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024, Level Home Inc.
+ *
+ * All rights reserved.
+ *
+ * Proprietary and confidential. Unauthorized copying of this file,
+ * via any medium is strictly prohibited.
+ *
+ */
+
+#pragma once
+
+// The output ring between the audio thread and the usb disk reader.  It
+// only needs atomic_get/atomic_set and k_cycle_get_32 so it also builds
+// on a host against the small shim in ringchk/, which runs it between two
+// pthreads.  The includer sets AUDIO_RING_SIZE, a power of 2
+//
+#if defined(__ZEPHYR__)
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#else
+#include "ringshim.h"
+#endif
+
+#include "audiodsp.h"
+
+#include <stdint.h>
+#include <errno.h>
+
+#ifndef AUDIO_RING_SIZE
+#error "AUDIO_RING_SIZE has to be set before including audioring.h"
+#endif
+
+#define AUDIO_RING_MASK         (AUDIO_RING_SIZE - 1)
+
+// one output block descriptor.  The producer (audio thread) fills the
+// samples of the block at head and then publishes it by advancing head.
+// The consumer (usb disk thread) reads the block at tail and advances
+// tail only once it is done with the samples, so the producer never
+// touches a block that is being copied out
+//
+struct audio_block
+{
+    uint32_t            *samples;
+    uint32_t            seq;
+    uint32_t            bytes;
+    uint32_t            stamp;
+    uint32_t            gen;
+};
+
+// single-producer / single-consumer ring of output blocks.  head is only
+// ever written by the producer and tail only by the consumer. atomic_get
+// and atomic_set are sequentially consistent so the sample writes are
+// visible before head moves and the sample reads are done before tail moves
+//
+struct audio_ring
+{
+    struct audio_block  blocks[AUDIO_RING_SIZE];
+    atomic_t            head;
+    atomic_t            tail;
+    uint32_t            seq;
+
+    // worst case cost of ring operations, and time a block sat in the ring
+    //
+    uint32_t            max_put_cycles;
+    uint32_t            max_get_cycles;
+    uint32_t            max_age_cycles;
+};
+
+static inline uint32_t _RingCount(struct audio_ring *ring)
+{
+    return (uint32_t)atomic_get(&ring->head) - (uint32_t)atomic_get(&ring->tail);
+}
+
+// the block the producer is filling.  This slot is never visible to
+// the consumer since at most AUDIO_RING_SIZE - 1 blocks are published
+//
+static inline struct audio_block *_RingHeadBlock(struct audio_ring *ring)
+{
+    return &ring->blocks[(uint32_t)atomic_get(&ring->head) & AUDIO_RING_MASK];
+}
+
+// producer: publish the block at head, returns -ENOSPC if the ring is full
+// in which case the head block stays with the producer to be refilled
+//
+DSP_RAMFUNC static int _RingPublish(struct audio_ring *ring, uint32_t in_bytes)
+{
+    uint32_t start = k_cycle_get_32();
+    uint32_t head = (uint32_t)atomic_get(&ring->head);
+    uint32_t tail = (uint32_t)atomic_get(&ring->tail);
+    struct audio_block *block;
+    uint32_t cycles;
+
+    if ((head - tail) >= (AUDIO_RING_SIZE - 1))
+    {
+        return -ENOSPC;
+    }
+
+    block = &ring->blocks[head & AUDIO_RING_MASK];
+    block->seq = ring->seq++;
+    block->bytes = in_bytes;
+    block->stamp = start;
+
+    atomic_set(&ring->head, (atomic_val_t)(head + 1));
+
+    cycles = k_cycle_get_32() - start;
+    if (cycles > ring->max_put_cycles)
+    {
+        ring->max_put_cycles = cycles;
+    }
+
+    return 0;
+}
+
+// consumer: look at the oldest published block without taking it
+//
+DSP_RAMFUNC static struct audio_block *_RingPeek(struct audio_ring *ring)
+{
+    uint32_t start = k_cycle_get_32();
+    uint32_t tail = (uint32_t)atomic_get(&ring->tail);
+    uint32_t head = (uint32_t)atomic_get(&ring->head);
+    struct audio_block *block;
+    uint32_t cycles;
+
+    if (head == tail)
+    {
+        return NULL;
+    }
+
+    block = &ring->blocks[tail & AUDIO_RING_MASK];
+
+    cycles = k_cycle_get_32() - start;
+    if (cycles > ring->max_get_cycles)
+    {
+        ring->max_get_cycles = cycles;
+    }
+
+    cycles = start - block->stamp;
+    if (cycles > ring->max_age_cycles)
+    {
+        ring->max_age_cycles = cycles;
+    }
+
+    return block;
+}
+
+// consumer: hand the oldest block back to the producer
+//
+DSP_RAMFUNC static void _RingRelease(struct audio_ring *ring)
+{
+    uint32_t tail = (uint32_t)atomic_get(&ring->tail);
+
+    if (tail != (uint32_t)atomic_get(&ring->head))
+    {
+        atomic_set(&ring->tail, (atomic_val_t)(tail + 1));
+    }
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2024, Level Home Inc.
+ *
+ * All rights reserved.
+ *
+ * Proprietary and confidential. Unauthorized copying of this file,
+ * via any medium is strictly prohibited.
+ *
+ */
+
+#include "spectrum.h"
+#include "audioin.h"
+#include "audiodsp.h"
+#include "asserts.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(spectrum, LOG_LEVEL_INF);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include <string.h>
+
+// The analyzer runs a goertzel bank over windows of mono audio, decimated
+// from the output blocks by an audio tap.  It runs at the lowest priority
+// so it can never hold off the audio thread, and it only takes a new window
+// when its measured cost fits the cpu budget, every other window is skipped
+//
+#define SPECTRUM_SAMPLE_RATE    (44100)
+#define SPECTRUM_DECIMATE       (4)
+#define SPECTRUM_WINDOW         (256)
+#define SPECTRUM_FLOOR_DB10     (-600)
+
+#define SPECTRUM_STACKSIZE      (1024)
+#define SPECTRUM_PRIORITY       (K_LOWEST_APPLICATION_THREAD_PRIO)
+
+static const uint16_t s_band_freqs[SPECTRUM_BANDS] =
+{
+    60, 150, 300, 600, 1200, 2400, 4000
+};
+
+static struct spectrum_ctx
+{
+    bool                initialized;
+    struct dsp_goertzel bank;
+
+    // double buffered windows, the tap fills one while the analyzer
+    // thread works on the other
+    //
+    int16_t             window[2][SPECTRUM_WINDOW];
+    int                 fill_buf;
+    int                 ready_buf;
+    uint32_t            fill;
+    int32_t             acc;
+    uint32_t            acc_count;
+    atomic_t            busy;
+
+    // budget scheduling, next_ms is when the next window may be taken
+    //
+    uint32_t            budget_permille;
+    int64_t             next_ms;
+
+    uint32_t            amplitude[SPECTRUM_BANDS];
+    uint8_t             levels[SPECTRUM_BANDS];
+
+    uint32_t            runs;
+    uint32_t            skipped;
+    uint32_t            last_cycles;
+    uint32_t            max_cycles;
+}
+m_spectrum;
+
+K_SEM_DEFINE(s_spectrum_ready, 0, 1);
+
+static void _SpectrumTap(const uint32_t *in_frames, uint32_t in_count, void *in_ctx)
+{
+    struct spectrum_ctx *spectrum = (struct spectrum_ctx *)in_ctx;
+
+    for (uint32_t frame = 0; frame < in_count; frame++)
+    {
+        // mono, and a boxcar average for decimation which is plenty
+        // for a display
+        //
+        spectrum->acc += (int16_t)(in_frames[frame] >> 16);
+        spectrum->acc += (int16_t)(in_frames[frame] & 0xFFFF);
+
+        if (++spectrum->acc_count < SPECTRUM_DECIMATE)
+        {
+            continue;
+        }
+
+        spectrum->window[spectrum->fill_buf][spectrum->fill++] =
+                (int16_t)(spectrum->acc / (2 * SPECTRUM_DECIMATE));
+        spectrum->acc = 0;
+        spectrum->acc_count = 0;
+
+        if (spectrum->fill < SPECTRUM_WINDOW)
+        {
+            continue;
+        }
+
+        spectrum->fill = 0;
+
+        // hand the window over only if the analyzer is idle and within
+        // its budget, otherwise drop it and start another
+        //
+        if (atomic_get(&spectrum->busy) || k_uptime_get() < spectrum->next_ms)
+        {
+            spectrum->skipped++;
+            continue;
+        }
+
+        spectrum->ready_buf = spectrum->fill_buf;
+        spectrum->fill_buf ^= 1;
+        atomic_set(&spectrum->busy, 1);
+        k_sem_give(&s_spectrum_ready);
+    }
+}
+
+static void _SpectrumAnalyze(struct spectrum_ctx *spectrum, const int16_t *in_window)
+{
+    uint32_t amplitude[SPECTRUM_BANDS];
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t cost_us;
+    int32_t db10;
+
+    start = k_cycle_get_32();
+
+    AudioDspGoertzel(&spectrum->bank, in_window, SPECTRUM_WINDOW, amplitude);
+
+    for (int band = 0; band < SPECTRUM_BANDS; band++)
+    {
+        // jump up to peaks, fall off slowly
+        //
+        if (amplitude[band] > spectrum->amplitude[band])
+        {
+            spectrum->amplitude[band] = amplitude[band];
+        }
+        else
+        {
+            spectrum->amplitude[band] -= (spectrum->amplitude[band] - amplitude[band]) / 4;
+        }
+
+        db10 = AudioDspLevelDb10(spectrum->amplitude[band]);
+        if (db10 < SPECTRUM_FLOOR_DB10)
+        {
+            db10 = SPECTRUM_FLOOR_DB10;
+        }
+
+        spectrum->levels[band] = (uint8_t)((db10 - SPECTRUM_FLOOR_DB10) * 100 / -SPECTRUM_FLOOR_DB10);
+    }
+
+    cycles = k_cycle_get_32() - start;
+    spectrum->last_cycles = cycles;
+    if (cycles > spectrum->max_cycles)
+    {
+        spectrum->max_cycles = cycles;
+    }
+    spectrum->runs++;
+
+    // space runs out so that cost / interval stays within the budget
+    //
+    cost_us = k_cyc_to_us_ceil32(cycles);
+    spectrum->next_ms = k_uptime_get() + cost_us / spectrum->budget_permille;
+}
+
+static void _SpectrumTaskMain(void *p1, void *p2, void *p3)
+{
+    while (true)
+    {
+        k_sem_take(&s_spectrum_ready, K_FOREVER);
+
+        _SpectrumAnalyze(&m_spectrum, m_spectrum.window[m_spectrum.ready_buf]);
+
+        atomic_set(&m_spectrum.busy, 0);
+    }
+}
+
+K_THREAD_DEFINE(s_spectrum_thread_id, SPECTRUM_STACKSIZE, _SpectrumTaskMain, NULL, NULL, NULL, SPECTRUM_PRIORITY, 0, 0);
+
+int SpectrumGetLevels(uint8_t *out_levels, uint32_t in_count)
+{
+    int ret = -EINVAL;
+
+    require(out_levels, exit);
+
+    if (in_count > SPECTRUM_BANDS)
+    {
+        in_count = SPECTRUM_BANDS;
+    }
+
+    memcpy(out_levels, m_spectrum.levels, in_count);
+    ret = 0;
+exit:
+    return ret;
+}
+
+int SpectrumInit(void)
+{
+    int ret = 0;
+
+    if (m_spectrum.initialized)
+    {
+        goto exit;
+    }
+
+    m_spectrum.budget_permille = CONFIG_AUDIO_SPECTRUM_BUDGET_PERMILLE;
+
+    ret = AudioDspGoertzelInit(&m_spectrum.bank, s_band_freqs, SPECTRUM_BANDS,
+            SPECTRUM_SAMPLE_RATE / SPECTRUM_DECIMATE);
+    require_noerr(ret, exit);
+
+    ret = AudioAddTap(_SpectrumTap, &m_spectrum);
+    require_noerr(ret, exit);
+
+    m_spectrum.initialized = true;
+exit:
+    return ret;
+}
+
+#if CONFIG_SHELL
+
+#include <zephyr/shell/shell.h>
+#include <stdlib.h>
+
+static void _CmdSpectrumShow(const struct shell *shell, size_t argc, char **argv)
+{
+    uint32_t total = m_spectrum.runs + m_spectrum.skipped;
+
+    for (int band = 0; band < SPECTRUM_BANDS; band++)
+    {
+        shell_print(shell, "%5u Hz  %3u%%  %d dB", s_band_freqs[band], m_spectrum.levels[band],
+                AudioDspLevelDb10(m_spectrum.amplitude[band]) / 10);
+    }
+
+    shell_print(shell, "runs %u  skipped %u (%u%%)  cost %u us (max %u)  budget %u.%u%%",
+            m_spectrum.runs, m_spectrum.skipped,
+            total ? m_spectrum.skipped * 100 / total : 0,
+            k_cyc_to_us_ceil32(m_spectrum.last_cycles), k_cyc_to_us_ceil32(m_spectrum.max_cycles),
+            m_spectrum.budget_permille / 10, m_spectrum.budget_permille % 10);
+}
+
+static void _CmdSpectrumBudget(const struct shell *shell, size_t argc, char **argv)
+{
+    uint32_t permille = strtoul(argv[1], NULL, 0);
+
+    if (permille < 1 || permille > 500)
+    {
+        shell_print(shell, "budget is 1..500 permille");
+        return;
+    }
+
+    m_spectrum.budget_permille = permille;
+}
+
+// time the transform kernel alone on a synthetic window
+//
+static void _CmdSpectrumBench(const struct shell *shell, size_t argc, char **argv)
+{
+    static int16_t window[SPECTRUM_WINDOW];
+    uint32_t amplitude[SPECTRUM_BANDS];
+    uint32_t runs = 100;
+    uint32_t start;
+    uint32_t cycles;
+
+    if (argc > 1)
+    {
+        runs = strtoul(argv[1], NULL, 0);
+    }
+    if (runs < 1)
+    {
+        runs = 1;
+    }
+
+    for (int sample = 0; sample < SPECTRUM_WINDOW; sample++)
+    {
+        window[sample] = (int16_t)((sample * 7919) & 0x7FFF) - 16384;
+    }
+
+    start = k_cycle_get_32();
+    for (uint32_t run = 0; run < runs; run++)
+    {
+        AudioDspGoertzel(&m_spectrum.bank, window, SPECTRUM_WINDOW, amplitude);
+    }
+    cycles = (k_cycle_get_32() - start) / runs;
+
+    shell_print(shell, "%u bands x %u samples: %u cycles (%u us) per window, %u cycles per sample-band",
+            SPECTRUM_BANDS, SPECTRUM_WINDOW, cycles, k_cyc_to_us_ceil32(cycles),
+            cycles / (SPECTRUM_BANDS * SPECTRUM_WINDOW));
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_spectrum,
+    SHELL_CMD_ARG(show,   NULL, "Band levels and scheduler stats", _CmdSpectrumShow, 1, 0),
+    SHELL_CMD_ARG(budget, NULL, "CPU budget <permille>", _CmdSpectrumBudget, 2, 0),
+    SHELL_CMD_ARG(bench,  NULL, "Time the goertzel kernel [runs]", _CmdSpectrumBench, 1, 1),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(spectrum, &m_sub_spectrum, "Spectrum analyzer", NULL);
+
+#endif
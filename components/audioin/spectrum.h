@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2024, Level Home Inc.
+ *
+ * All rights reserved.
+ *
+ * Proprietary and confidential. Unauthorized copying of this file,
+ * via any medium is strictly prohibited.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define SPECTRUM_BANDS      (7)
+
+// levels are 0..100, -60dBFS to full scale, with a slow fall off
+//
+int SpectrumGetLevels(uint8_t *out_levels, uint32_t in_count);
+int SpectrumInit(void);
@@ -0,0 +1,568 @@
+/*
+ * Copyright (c) 2024, Level Home Inc.
+ *
+ * All rights reserved.
+ *
+ * Proprietary and confidential. Unauthorized copying of this file,
+ * via any medium is strictly prohibited.
+ *
+ */
+
+#include "timeshift.h"
+#include "audioin.h"
+#include "audiodsp.h"
+#include "asserts.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(timeshift, LOG_LEVEL_INF);
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/sys/atomic.h>
+
+#include <string.h>
+
+// The time-shift log records the live audio into a flash partition as a
+// circular log of 512 byte records, ima adpcm at 4 bits a sample so 8MB
+// holds about three minutes.  Each record carries a sequence number and the
+// codec state at its start so any record can be decoded on its own, and a
+// record whose number isn't the one expected at its slot is treated as lost
+//
+// The audio tap only encodes and queues records, a writer thread does the
+// flash work so erase stalls are soaked up by the queue and never reach
+// the audio thread.  The partition is picked with the chosen node
+// "tradio,timeshift" so it can be pointed at the flash simulator
+//
+#define TIMESHIFT_NODE          DT_CHOSEN(tradio_timeshift)
+
+#define TIMESHIFT_RECORD_SIZE   (512)
+#define TIMESHIFT_SAMPLE_RATE   (44100)
+#define TIMESHIFT_ERASED_SEQ    (0xFFFFFFFF)
+
+// blocks kept clear between the writer and the oldest audio served, so a
+// reader is never handed a record that is being erased
+//
+#define TIMESHIFT_GUARD_BLOCKS  (2)
+
+#define TIMESHIFT_STACKSIZE     (1024)
+#define TIMESHIFT_PRIORITY      (5)
+
+struct timeshift_record
+{
+    uint32_t            seq;
+    struct dsp_adpcm    state[2];
+    uint32_t            reserved;
+    uint8_t             codes[TIMESHIFT_RECORD_FRAMES];
+};
+
+BUILD_ASSERT(sizeof(struct timeshift_record) == TIMESHIFT_RECORD_SIZE, "record must fill a sector");
+
+// the writer is stuck for up to the worst case erase at each new block, and
+// everything recorded meanwhile has to fit in the queue on top of the
+// record that is waiting to be written after it
+//
+#define TIMESHIFT_RECORD_US     ((uint64_t)TIMESHIFT_RECORD_FRAMES * 1000000 / TIMESHIFT_SAMPLE_RATE)
+
+BUILD_ASSERT((CONFIG_AUDIO_TIMESHIFT_QUEUE_RECORDS - 1) * TIMESHIFT_RECORD_US >= CONFIG_AUDIO_TIMESHIFT_MAX_ERASE_MS * 1000ULL,
+        "timeshift queue doesn't cover the flash's worst case erase");
+
+static struct timeshift_ctx
+{
+    bool                initialized;
+    const struct device *flash;
+    off_t               offset;
+    uint32_t            size;
+    uint32_t            erase_size;
+
+    // layout, in records
+    //
+    uint32_t            records;
+    uint32_t            block_records;
+    uint32_t            usable_records;
+
+    // tap side, the record being filled and its codec state
+    //
+    struct timeshift_record record;
+    struct dsp_adpcm    state[2];
+    uint32_t            fill;
+    uint32_t            seq;
+
+    // writer side.  written is one past the newest record in flash, and
+    // first is where this session's audio starts
+    //
+    atomic_t            written;
+    uint32_t            first_seq;
+    int32_t             erased_block;
+
+    // reader side, the anchor and one decoded record
+    //
+    uint32_t            anchor_seq;
+    uint32_t            cache_seq;
+    bool                cache_valid;
+    uint32_t            cache[TIMESHIFT_RECORD_FRAMES];
+    struct timeshift_record read_record;
+
+    // stats
+    //
+    uint64_t            start_ms;
+    uint32_t            recorded;
+    uint32_t            erases;
+    uint32_t            drops;
+    uint32_t            write_errors;
+    uint32_t            lost_reads;
+    uint32_t            queue_high;
+    uint32_t            max_write_us;
+    uint32_t            max_erase_us;
+}
+m_timeshift;
+
+K_MSGQ_DEFINE(s_timeshift_queue, sizeof(struct timeshift_record), CONFIG_AUDIO_TIMESHIFT_QUEUE_RECORDS, 4);
+K_SEM_DEFINE(s_timeshift_written, 0, 1);
+K_MUTEX_DEFINE(s_timeshift_lock);
+
+static off_t _RecordOffset(struct timeshift_ctx *shift, uint32_t seq)
+{
+    return shift->offset + (off_t)(seq % shift->records) * TIMESHIFT_RECORD_SIZE;
+}
+
+static void _TimeshiftTap(const uint32_t *in_frames, uint32_t in_count, void *in_ctx)
+{
+    struct timeshift_ctx *shift = (struct timeshift_ctx *)in_ctx;
+    uint32_t chunk;
+    uint32_t used;
+
+    while (in_count > 0)
+    {
+        if (shift->fill == 0)
+        {
+            shift->record.seq = shift->seq;
+            memcpy(shift->record.state, shift->state, sizeof(shift->state));
+        }
+
+        chunk = TIMESHIFT_RECORD_FRAMES - shift->fill;
+        if (chunk > in_count)
+        {
+            chunk = in_count;
+        }
+
+        AudioDspAdpcmEncode(shift->state, in_frames, chunk, shift->record.codes + shift->fill);
+
+        shift->fill += chunk;
+        in_frames += chunk;
+        in_count -= chunk;
+
+        if (shift->fill < TIMESHIFT_RECORD_FRAMES)
+        {
+            continue;
+        }
+
+        // a dropped record still uses up its sequence number so the log
+        // stays in step with time, it just reads back as silence
+        //
+        if (k_msgq_put(&s_timeshift_queue, &shift->record, K_NO_WAIT))
+        {
+            shift->drops++;
+        }
+        else
+        {
+            used = k_msgq_num_used_get(&s_timeshift_queue);
+            if (used > shift->queue_high)
+            {
+                shift->queue_high = used;
+            }
+        }
+
+        shift->fill = 0;
+        shift->seq++;
+    }
+}
+
+static int _TimeshiftWrite(struct timeshift_ctx *shift, const struct timeshift_record *in_record)
+{
+    int32_t block = (in_record->seq % shift->records) / shift->block_records;
+    off_t offset = _RecordOffset(shift, in_record->seq);
+    uint32_t start;
+    uint32_t elapsed_us;
+    int ret;
+
+    // erase on the way into a block rather than at its first record, a
+    // dropped record must not leave a block unerased
+    //
+    if (block != shift->erased_block)
+    {
+        start = k_cycle_get_32();
+        ret = flash_erase(shift->flash, shift->offset + (off_t)block * shift->erase_size, shift->erase_size);
+        require_noerr(ret, exit);
+
+        elapsed_us = k_cyc_to_us_ceil32(k_cycle_get_32() - start);
+        if (elapsed_us > shift->max_erase_us)
+        {
+            shift->max_erase_us = elapsed_us;
+        }
+        shift->erased_block = block;
+        shift->erases++;
+    }
+
+    start = k_cycle_get_32();
+    ret = flash_write(shift->flash, offset, in_record, TIMESHIFT_RECORD_SIZE);
+    require_noerr(ret, exit);
+
+    elapsed_us = k_cyc_to_us_ceil32(k_cycle_get_32() - start);
+    if (elapsed_us > shift->max_write_us)
+    {
+        shift->max_write_us = elapsed_us;
+    }
+    shift->recorded++;
+exit:
+    return ret;
+}
+
+static void _TimeshiftTaskMain(void *p1, void *p2, void *p3)
+{
+    static struct timeshift_record record;
+    struct timeshift_ctx *shift = &m_timeshift;
+    int ret;
+
+    while (true)
+    {
+        k_msgq_get(&s_timeshift_queue, &record, K_FOREVER);
+
+        k_mutex_lock(&s_timeshift_lock, K_FOREVER);
+        ret = _TimeshiftWrite(shift, &record);
+        k_mutex_unlock(&s_timeshift_lock);
+
+        if (ret)
+        {
+            shift->write_errors++;
+            LOG_ERR("record %u write %d", record.seq, ret);
+        }
+
+        atomic_set(&shift->written, (atomic_val_t)(record.seq + 1));
+        k_sem_give(&s_timeshift_written);
+    }
+}
+
+K_THREAD_DEFINE(s_timeshift_thread_id, TIMESHIFT_STACKSIZE, _TimeshiftTaskMain, NULL, NULL, NULL, TIMESHIFT_PRIORITY, 0, 0);
+
+// find where the last session left off from the first record of each
+// block, and carry on from the next block so wear keeps moving round
+//
+static int _TimeshiftScan(struct timeshift_ctx *shift, uint32_t *out_next_seq)
+{
+    uint32_t seq;
+    uint32_t last = TIMESHIFT_ERASED_SEQ;
+    uint32_t slot;
+    int ret = 0;
+
+    for (slot = 0; slot < shift->records; slot += shift->block_records)
+    {
+        ret = flash_read(shift->flash, shift->offset + (off_t)slot * TIMESHIFT_RECORD_SIZE, &seq, sizeof(seq));
+        require_noerr(ret, exit);
+
+        if (seq == TIMESHIFT_ERASED_SEQ || (seq % shift->records) != slot)
+        {
+            continue;
+        }
+        if (last == TIMESHIFT_ERASED_SEQ || seq > last)
+        {
+            last = seq;
+        }
+    }
+
+    if (last == TIMESHIFT_ERASED_SEQ)
+    {
+        *out_next_seq = 0;
+    }
+    else
+    {
+        *out_next_seq = (last / shift->block_records + 1) * shift->block_records;
+    }
+exit:
+    return ret;
+}
+
+uint32_t TimeshiftSpanFrames(void)
+{
+    if (!m_timeshift.initialized)
+    {
+        return 0;
+    }
+    return m_timeshift.usable_records * TIMESHIFT_RECORD_FRAMES;
+}
+
+int TimeshiftRewindAnchor(void)
+{
+    struct timeshift_ctx *shift = &m_timeshift;
+    uint32_t written;
+    int ret = -ENODEV;
+
+    require(shift->initialized, exit);
+
+    written = (uint32_t)atomic_get(&shift->written);
+
+    shift->anchor_seq = shift->first_seq;
+    if (written - shift->first_seq > shift->usable_records)
+    {
+        shift->anchor_seq = written - shift->usable_records;
+    }
+    shift->cache_valid = false;
+
+    LOG_INF("rewind anchored %u s back", (written - shift->anchor_seq) * TIMESHIFT_RECORD_FRAMES / TIMESHIFT_SAMPLE_RATE);
+    ret = 0;
+exit:
+    return ret;
+}
+
+// decode one record into the cache, a record that is gone decodes to silence
+//
+static int _TimeshiftLoad(struct timeshift_ctx *shift, uint32_t seq, int64_t in_deadline_ms)
+{
+    int64_t remain_ms;
+    uint32_t written;
+    int ret = 0;
+
+    if (shift->cache_valid && shift->cache_seq == seq)
+    {
+        goto exit;
+    }
+
+    while ((int32_t)(seq - (uint32_t)atomic_get(&shift->written)) >= 0)
+    {
+        remain_ms = in_deadline_ms - k_uptime_get();
+        if (remain_ms <= 0)
+        {
+            ret = -EAGAIN;
+            goto exit;
+        }
+        k_sem_take(&s_timeshift_written, K_MSEC(remain_ms));
+    }
+
+    shift->cache_seq = seq;
+    shift->cache_valid = true;
+
+    written = (uint32_t)atomic_get(&shift->written);
+    if (written - seq > shift->usable_records)
+    {
+        shift->lost_reads++;
+        memset(shift->cache, 0, sizeof(shift->cache));
+        goto exit;
+    }
+
+    ret = flash_read(shift->flash, _RecordOffset(shift, seq), &shift->read_record, TIMESHIFT_RECORD_SIZE);
+    if (ret || shift->read_record.seq != seq)
+    {
+        shift->lost_reads++;
+        memset(shift->cache, 0, sizeof(shift->cache));
+        ret = 0;
+        goto exit;
+    }
+
+    AudioDspAdpcmDecode(shift->read_record.state, shift->read_record.codes, TIMESHIFT_RECORD_FRAMES, shift->cache);
+exit:
+    return ret;
+}
+
+int TimeshiftRead(uint32_t in_frame, uint32_t *out_frames, uint32_t in_count, uint32_t in_timeout_ms)
+{
+    struct timeshift_ctx *shift = &m_timeshift;
+    int64_t deadline_ms = k_uptime_get() + in_timeout_ms;
+    uint32_t offset;
+    uint32_t chunk;
+    int ret = -EINVAL;
+
+    require(out_frames, exit);
+    require_action(shift->initialized, exit, ret = -ENODEV);
+
+    while (in_count > 0)
+    {
+        offset = in_frame % TIMESHIFT_RECORD_FRAMES;
+        chunk = TIMESHIFT_RECORD_FRAMES - offset;
+        if (chunk > in_count)
+        {
+            chunk = in_count;
+        }
+
+        ret = _TimeshiftLoad(shift, shift->anchor_seq + in_frame / TIMESHIFT_RECORD_FRAMES, deadline_ms);
+        if (ret)
+        {
+            // reading ahead of live, conceal with silence
+            //
+            memset(out_frames, 0, in_count * sizeof(uint32_t));
+            break;
+        }
+
+        memcpy(out_frames, shift->cache + offset, chunk * sizeof(uint32_t));
+        out_frames += chunk;
+        in_frame += chunk;
+        in_count -= chunk;
+    }
+
+    ret = 0;
+exit:
+    return ret;
+}
+
+int TimeshiftInit(void)
+{
+    struct timeshift_ctx *shift = &m_timeshift;
+    struct flash_pages_info info;
+    uint32_t next_seq;
+    int ret = 0;
+
+    if (shift->initialized)
+    {
+        goto exit;
+    }
+
+    shift->flash = DEVICE_DT_GET(DT_MTD_FROM_FIXED_PARTITION(TIMESHIFT_NODE));
+    shift->offset = DT_REG_ADDR(TIMESHIFT_NODE);
+    shift->size = DT_REG_SIZE(TIMESHIFT_NODE);
+
+    require_action(device_is_ready(shift->flash), exit, ret = -ENODEV);
+
+    ret = flash_get_page_info_by_offs(shift->flash, shift->offset, &info);
+    require_noerr(ret, exit);
+
+    shift->erase_size = info.size;
+    shift->block_records = shift->erase_size / TIMESHIFT_RECORD_SIZE;
+    shift->records = (shift->size / shift->erase_size) * shift->block_records;
+
+    require_action(shift->block_records > 0, exit, ret = -EINVAL);
+    require_action(shift->records > (TIMESHIFT_GUARD_BLOCKS + 1) * shift->block_records, exit, ret = -ENOSPC);
+
+    shift->usable_records = shift->records - TIMESHIFT_GUARD_BLOCKS * shift->block_records;
+
+    ret = _TimeshiftScan(shift, &next_seq);
+    require_noerr(ret, exit);
+
+    shift->seq = next_seq;
+    shift->first_seq = next_seq;
+    shift->anchor_seq = next_seq;
+    shift->erased_block = -1;
+    atomic_set(&shift->written, (atomic_val_t)next_seq);
+    shift->start_ms = k_uptime_get();
+
+    LOG_INF("%u KB log, %u records, %u s span, starting at %u",
+            shift->size / 1024, shift->records,
+            shift->usable_records * TIMESHIFT_RECORD_FRAMES / TIMESHIFT_SAMPLE_RATE, next_seq);
+
+    // recording goes on whether or not the host reads the live files
+    //
+    ret = AudioAddTap(_TimeshiftTap, shift);
+    require_noerr(ret, exit);
+
+    AudioHoldCapture(true);
+
+    shift->initialized = true;
+exit:
+    return ret;
+}
+
+#if CONFIG_SHELL
+
+#include <zephyr/shell/shell.h>
+
+static void _CmdTimeshiftStats(const struct shell *shell, size_t argc, char **argv)
+{
+    struct timeshift_ctx *shift = &m_timeshift;
+    uint64_t elapsed_ms = k_uptime_get() - shift->start_ms;
+    uint32_t pass_s = shift->records * TIMESHIFT_RECORD_FRAMES / TIMESHIFT_SAMPLE_RATE;
+    uint32_t rate;
+
+    if (!shift->initialized)
+    {
+        shell_print(shell, "not running");
+        return;
+    }
+
+    rate = elapsed_ms ? (uint32_t)((uint64_t)shift->recorded * TIMESHIFT_RECORD_SIZE * 1000 / elapsed_ms) : 0;
+
+    shell_print(shell, "log %u KB at %u, %u records of %u frames, erase block %u",
+            shift->size / 1024, (uint32_t)shift->offset, shift->records, TIMESHIFT_RECORD_FRAMES, shift->erase_size);
+    shell_print(shell, "span %u s  written %u  recorded %u  dropped %u  errors %u  lost reads %u",
+            TimeshiftSpanFrames() / TIMESHIFT_SAMPLE_RATE, (uint32_t)atomic_get(&shift->written),
+            shift->recorded, shift->drops, shift->write_errors, shift->lost_reads);
+    shell_print(shell, "write rate %u B/s  erases %u  max write %u us  max erase %u us  queue %u of %u",
+            rate, shift->erases, shift->max_write_us, shift->max_erase_us,
+            shift->queue_high, CONFIG_AUDIO_TIMESHIFT_QUEUE_RECORDS);
+
+    // every block is erased once a pass round the log
+    //
+    shell_print(shell, "each block erased every %u s, %u cycles lasts %u days of recording",
+            pass_s, CONFIG_AUDIO_TIMESHIFT_FLASH_CYCLES,
+            (uint32_t)((uint64_t)CONFIG_AUDIO_TIMESHIFT_FLASH_CYCLES * pass_s / 86400));
+}
+
+static void _CmdTimeshiftClear(const struct shell *shell, size_t argc, char **argv)
+{
+    struct timeshift_ctx *shift = &m_timeshift;
+    int ret;
+
+    if (!shift->initialized)
+    {
+        shell_print(shell, "not running");
+        return;
+    }
+
+    k_mutex_lock(&s_timeshift_lock, K_FOREVER);
+    ret = flash_erase(shift->flash, shift->offset, shift->records / shift->block_records * shift->erase_size);
+    shift->first_seq = (uint32_t)atomic_get(&shift->written);
+    shift->cache_valid = false;
+    k_mutex_unlock(&s_timeshift_lock);
+
+    shell_print(shell, "cleared %d", ret);
+}
+
+// time the codec and a flash read of one record, writes and erases are
+// timed live by the writer
+//
+static void _CmdTimeshiftBench(const struct shell *shell, size_t argc, char **argv)
+{
+    static uint32_t frames[TIMESHIFT_RECORD_FRAMES];
+    static struct timeshift_record record;
+    struct dsp_adpcm state[2] = { 0 };
+    uint32_t encode_cycles;
+    uint32_t decode_cycles;
+    uint32_t read_cycles;
+    uint32_t start;
+
+    if (!m_timeshift.initialized)
+    {
+        shell_print(shell, "not running");
+        return;
+    }
+
+    for (int frame = 0; frame < TIMESHIFT_RECORD_FRAMES; frame++)
+    {
+        frames[frame] = (uint32_t)(frame * 7919 * 65537);
+    }
+
+    start = k_cycle_get_32();
+    AudioDspAdpcmEncode(state, frames, TIMESHIFT_RECORD_FRAMES, record.codes);
+    encode_cycles = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    AudioDspAdpcmDecode(state, record.codes, TIMESHIFT_RECORD_FRAMES, frames);
+    decode_cycles = k_cycle_get_32() - start;
+
+    start = k_cycle_get_32();
+    flash_read(m_timeshift.flash, m_timeshift.offset, &record, TIMESHIFT_RECORD_SIZE);
+    read_cycles = k_cycle_get_32() - start;
+
+    shell_print(shell, "record of %u frames: encode %u us  decode %u us  flash read %u us",
+            TIMESHIFT_RECORD_FRAMES, k_cyc_to_us_ceil32(encode_cycles),
+            k_cyc_to_us_ceil32(decode_cycles), k_cyc_to_us_ceil32(read_cycles));
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_timeshift,
+    SHELL_CMD_ARG(stats, NULL, "Log layout, write rate and wear", _CmdTimeshiftStats, 1, 0),
+    SHELL_CMD_ARG(clear, NULL, "Erase the log", _CmdTimeshiftClear, 1, 0),
+    SHELL_CMD_ARG(bench, NULL, "Time the codec and a flash read", _CmdTimeshiftBench, 1, 0),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(timeshift, &m_sub_timeshift, "Time-shift log", NULL);
+
+#endif
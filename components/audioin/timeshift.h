@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024, Level Home Inc.
+ *
+ * All rights reserved.
+ *
+ * Proprietary and confidential. Unauthorized copying of this file,
+ * via any medium is strictly prohibited.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// stereo frames of audio in each 512 byte flash record
+//
+#define TIMESHIFT_RECORD_FRAMES     (496)
+
+int TimeshiftInit(void);
+
+// how many frames back the log reaches once it has wrapped
+//
+uint32_t TimeshiftSpanFrames(void);
+
+// start reading from the oldest audio still in the log, frame 0 of
+// TimeshiftRead is then that point
+//
+int TimeshiftRewindAnchor(void);
+
+// read frames counted from the anchor, waiting up to in_timeout_ms for
+// any that haven't been recorded yet.  audio that is lost or has been
+// overwritten reads as silence
+//
+int TimeshiftRead(uint32_t in_frame, uint32_t *out_frames, uint32_t in_count, uint32_t in_timeout_ms);
@@ -13,6 +13,9 @@ LOG_MODULE_REGISTER(ble_adv, LOG_LEVEL_INF);
 // how long to advertise after startup. seconds (0 means forever)
 //
 #define BLE_ADV_PERIOD_SECS  (0) /*(60*60)*/
+// how often to check for the stack being ready to advertise
+//
+#define BLE_READY_POLL_MS    (100)
 #define BT_GAP_ADV_VERY_SLOW_INT_MIN   0x0C80 /* 0.625ms * 0xC80 = 2s */
 #define BT_GAP_ADV_VERY_SLOW_INT_MAX   0x0DC0 /* 0.625ms * 0xDC0 = 2.2s */
 
@@ -128,9 +131,15 @@ exit:
     return ret;
 }
 
-int BLEAdvertisingSlice(void)
+// outDelay is lowered to when this next has something to do, and left
+// alone when nothing is pending
+//
+int BLEAdvertisingSlice(uint32_t *outDelay)
 {
-    if (mBLE.is_advertising && mBLE.adv_stop_time < k_uptime_get())
+    int64_t now = k_uptime_get();
+    uint32_t delay = UINT32_MAX;
+
+    if (mBLE.is_advertising && mBLE.adv_stop_time < now)
     {
         LOG_INF("Adv time over");
         BLEstopAdvertising();
@@ -146,6 +155,20 @@ int BLEAdvertisingSlice(void)
             mBLE.has_advertised = true;
             ret = BLEstartAdvertising();
         }
+        else
+        {
+            delay = BLE_READY_POLL_MS;
+        }
+    }
+
+    if (mBLE.is_advertising && mBLE.adv_stop_time)
+    {
+        delay = mBLE.adv_stop_time > now ? (uint32_t)(mBLE.adv_stop_time - now) : 0;
+    }
+
+    if (outDelay && delay < *outDelay)
+    {
+        *outDelay = delay;
     }
 
     return 0;
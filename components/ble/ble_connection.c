@@ -238,7 +238,7 @@ int BLEslice(uint32_t *outDelay)
 {
     int result = 0;
 
-    result = BLEAdvertisingSlice();
+    result = BLEAdvertisingSlice(outDelay);
     return result;
 }
 
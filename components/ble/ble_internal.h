@@ -44,7 +44,7 @@ ble_conn_context_t *BLEinternalConnectionOf(const void * const in_conn_handle);
 
 // advertising
 //
-int BLEAdvertisingSlice(void);
+int BLEAdvertisingSlice(uint32_t *outDelay);
 
 // service
 //
@@ -35,6 +35,8 @@ typedef const int   (*ble_mtu_update_callback_t)(ble_conn_handle_t in_conn, cons
 //
 int     BLEdisconnect(ble_conn_handle_t in_conn);
 bool    BLEisShellEnabled(void);
+// lowers outDelay to the ms until the next slice is needed
+//
 int     BLEslice(uint32_t *outDelay);
 int     BLEinit(const char *in_device_name);
 
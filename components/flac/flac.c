@@ -0,0 +1,884 @@
+/*
+ * Copyright (c) 2024, Level Home Inc.
+ *
+ * All rights reserved.
+ *
+ * Proprietary and confidential. Unauthorized copying of this file,
+ * via any medium is strictly prohibited.
+ *
+ */
+
+#include "flac.h"
+#include "asserts.h"
+
+#include <errno.h>
+#include <string.h>
+
+// A group is one compressed block followed by one or more verbatim filler
+// frames that carry the next few samples and take up exactly the space the
+// block left, so nothing is wasted on padding.  The stream uses variable
+// block sizes so the fillers can be any size.  Filler sizes are steered to
+// the byte with the optional block size and sample rate header fields.
+//
+// If a block doesn't fit it is re-encoded with low bits dropped, which
+// only happens on noise-like audio and is counted in lossy_blocks
+//
+#define FLAC_MAX_ORDER              (4)
+#define FLAC_MAX_PARTITION_ORDER    (4)
+#define FLAC_PARTITIONS             (1 << FLAC_MAX_PARTITION_ORDER)
+#define FLAC_MIN_BLOCK_FRAMES       (256)
+#define FLAC_MAX_SHIFT              (15)
+#define FLAC_MAX_RICE_PARAM         (14)
+#define FLAC_MAX_RICE2_PARAM        (30)
+
+// a filler frame is sync and codes (4), sample number (1-7), block size
+// and rate fields (1-4), crc8 (1), two subframe headers (2), 4 bytes per
+// frame and crc16 (2)
+//
+#define FLAC_FILL_OVERHEAD          (9)
+#define FLAC_FILL_MIN_FRAMES        (16)
+#define FLAC_FILL_MAX_FRAMES        (256)
+#define FLAC_FILL_MIN_SIZE          (FLAC_FILL_OVERHEAD + 7 + 4 + 4 * FLAC_FILL_MIN_FRAMES)
+
+#define FLAC_SAMPLE_NUMBER_MASK     ((1ULL << 36) - 1)
+
+// frame header channel assignments
+//
+#define FLAC_ASSIGN_INDEPENDENT     (0x1)
+#define FLAC_ASSIGN_LEFT_SIDE       (0x8)
+#define FLAC_ASSIGN_RIGHT_SIDE      (0x9)
+#define FLAC_ASSIGN_MID_SIDE        (0xA)
+
+enum flac_channel
+{
+    FLAC_CH_LEFT,
+    FLAC_CH_RIGHT,
+    FLAC_CH_MID,
+    FLAC_CH_SIDE,
+    FLAC_CH_COUNT
+};
+
+enum flac_subframe_type
+{
+    FLAC_SUBFRAME_CONSTANT  = 0x00,
+    FLAC_SUBFRAME_VERBATIM  = 0x01,
+    FLAC_SUBFRAME_FIXED     = 0x08,
+};
+
+struct flac_subframe
+{
+    uint8_t     channel;
+    uint8_t     type;
+    uint8_t     bps;        // before wasted bits are removed
+    uint8_t     wasted;
+    uint8_t     order;
+    uint8_t     partition_order;
+    bool        rice2;
+    uint8_t     params[FLAC_PARTITIONS];
+    int32_t     constant;
+    uint64_t    bits;       // estimated, never less than what gets written
+};
+
+struct flac_bits
+{
+    uint8_t    *buf;
+    uint32_t    size;
+    uint32_t    pos;
+    uint64_t    acc;
+    uint32_t    count;
+    bool        overflow;
+};
+
+static const uint32_t s_rate_table[12] =
+{
+    0, 88200, 176400, 192000, 8000, 16000, 22050, 24000, 32000, 44100, 48000, 96000
+};
+
+static uint16_t s_crc16_table[256];
+
+static void _Crc16Init(void)
+{
+    for (uint32_t byte = 0; byte < 256; byte++)
+    {
+        uint16_t crc = byte << 8;
+
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x8005 : crc << 1;
+        }
+
+        s_crc16_table[byte] = crc;
+    }
+}
+
+static uint16_t _Crc16(const uint8_t *in_data, uint32_t in_size)
+{
+    uint16_t crc = 0;
+
+    while (in_size--)
+    {
+        crc = (crc << 8) ^ s_crc16_table[(crc >> 8) ^ *in_data++];
+    }
+
+    return crc;
+}
+
+static uint8_t _Crc8(const uint8_t *in_data, uint32_t in_size)
+{
+    uint8_t crc = 0;
+
+    while (in_size--)
+    {
+        crc ^= *in_data++;
+
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+        }
+    }
+
+    return crc;
+}
+
+static void _BitsInit(struct flac_bits *bits, uint8_t *in_buf, uint32_t in_size)
+{
+    bits->buf = in_buf;
+    bits->size = in_size;
+    bits->pos = 0;
+    bits->acc = 0;
+    bits->count = 0;
+    bits->overflow = false;
+}
+
+// msb first, in_count is 0..32
+//
+static void _BitsPut(struct flac_bits *bits, uint32_t in_value, uint32_t in_count)
+{
+    if (in_count < 32)
+    {
+        in_value &= (1U << in_count) - 1;
+    }
+
+    bits->acc = (bits->acc << in_count) | in_value;
+    bits->count += in_count;
+
+    while (bits->count >= 8)
+    {
+        bits->count -= 8;
+
+        if (bits->pos < bits->size)
+        {
+            bits->buf[bits->pos++] = (uint8_t)(bits->acc >> bits->count);
+        }
+        else
+        {
+            bits->overflow = true;
+        }
+    }
+}
+
+static void _BitsUnary(struct flac_bits *bits, uint32_t in_zeros)
+{
+    while (in_zeros >= 32 && !bits->overflow)
+    {
+        _BitsPut(bits, 0, 32);
+        in_zeros -= 32;
+    }
+
+    _BitsPut(bits, 1, (in_zeros & 31) + 1);
+}
+
+static void _BitsAlign(struct flac_bits *bits)
+{
+    if (bits->count)
+    {
+        _BitsPut(bits, 0, 8 - bits->count);
+    }
+}
+
+static uint32_t _Utf8Size(uint64_t in_value)
+{
+    uint32_t size = 2;
+    uint32_t payload = 11;
+
+    if (in_value < 0x80)
+    {
+        return 1;
+    }
+
+    while (in_value >> payload)
+    {
+        size++;
+        payload += 5;
+    }
+
+    return size;
+}
+
+static void _BitsUtf8(struct flac_bits *bits, uint64_t in_value)
+{
+    uint32_t size = _Utf8Size(in_value);
+
+    if (size == 1)
+    {
+        _BitsPut(bits, (uint32_t)in_value, 8);
+        return;
+    }
+
+    _BitsPut(bits, ((0xFF00 >> size) & 0xFF) | (uint32_t)(in_value >> (6 * (size - 1))), 8);
+
+    for (int byte = size - 2; byte >= 0; byte--)
+    {
+        _BitsPut(bits, 0x80 | ((in_value >> (6 * byte)) & 0x3F), 8);
+    }
+}
+
+static uint32_t _BlockSizeCode(uint32_t in_frames, uint32_t *out_extra)
+{
+    *out_extra = 0;
+
+    if (in_frames == 192)
+    {
+        return 0x1;
+    }
+    for (uint32_t code = 0x2; code <= 0x5; code++)
+    {
+        if (in_frames == (576U << (code - 0x2)))
+        {
+            return code;
+        }
+    }
+    for (uint32_t code = 0x8; code <= 0xF; code++)
+    {
+        if (in_frames == (256U << (code - 0x8)))
+        {
+            return code;
+        }
+    }
+
+    *out_extra = (in_frames <= 256) ? 1 : 2;
+    return (in_frames <= 256) ? 0x6 : 0x7;
+}
+
+// in_size_bytes and in_explicit_rate force the optional header fields, used
+// to land filler frames on an exact size.  in_size_bytes of 0 picks the
+// shortest encoding
+//
+static void _WriteHeader(struct flac_bits *bits, const struct flac_encoder *enc, uint32_t in_frames,
+                         uint32_t in_assign, uint32_t in_size_bytes, bool in_explicit_rate)
+{
+    uint32_t start = bits->pos;
+    uint32_t size_code;
+    uint32_t rate_code = 0;
+
+    if (in_size_bytes)
+    {
+        size_code = (in_size_bytes == 1) ? 0x6 : 0x7;
+    }
+    else
+    {
+        size_code = _BlockSizeCode(in_frames, &in_size_bytes);
+    }
+
+    if (in_explicit_rate)
+    {
+        rate_code = (enc->sample_rate <= 0xFFFF) ? 0xD : 0xE;
+    }
+    else
+    {
+        for (uint32_t code = 1; code < sizeof(s_rate_table) / sizeof(s_rate_table[0]); code++)
+        {
+            if (s_rate_table[code] == enc->sample_rate)
+            {
+                rate_code = code;
+                break;
+            }
+        }
+    }
+
+    // sync, reserved bit and the variable block size flag
+    //
+    _BitsPut(bits, 0xFFF9, 16);
+    _BitsPut(bits, size_code, 4);
+    _BitsPut(bits, rate_code, 4);
+    _BitsPut(bits, in_assign, 4);
+    _BitsPut(bits, 0x4, 3);         // 16 bit samples
+    _BitsPut(bits, 0, 1);
+    _BitsUtf8(bits, enc->sample_number & FLAC_SAMPLE_NUMBER_MASK);
+
+    if (in_size_bytes)
+    {
+        _BitsPut(bits, in_frames - 1, 8 * in_size_bytes);
+    }
+    if (rate_code == 0xD)
+    {
+        _BitsPut(bits, enc->sample_rate, 16);
+    }
+    else if (rate_code == 0xE)
+    {
+        _BitsPut(bits, enc->sample_rate / 10, 16);
+    }
+
+    if (!bits->overflow)
+    {
+        _BitsPut(bits, _Crc8(bits->buf + start, bits->pos - start), 8);
+    }
+}
+
+static void _WriteFooter(struct flac_bits *bits, uint32_t in_start)
+{
+    _BitsAlign(bits);
+
+    if (!bits->overflow)
+    {
+        _BitsPut(bits, _Crc16(bits->buf + in_start, bits->pos - in_start), 16);
+    }
+}
+
+static inline int32_t _Sample(const struct flac_encoder *enc, uint32_t in_frame, uint32_t in_channel)
+{
+    int32_t mask = ~(int32_t)((1U << enc->quantize) - 1);
+    int32_t left = (int16_t)(enc->frames[in_frame] & 0xFFFF) & mask;
+    int32_t right = (int16_t)(enc->frames[in_frame] >> 16) & mask;
+
+    switch (in_channel)
+    {
+    case FLAC_CH_LEFT:
+        return left;
+    case FLAC_CH_RIGHT:
+        return right;
+    case FLAC_CH_MID:
+        return (left + right) >> 1;
+    default:
+        return left - right;
+    }
+}
+
+static inline uint32_t _ZigZag(int32_t in_value)
+{
+    return ((uint32_t)in_value << 1) ^ (uint32_t)(in_value >> 31);
+}
+
+// next residual of a fixed predictor, io_last holds the differences of
+// each order at the previous sample
+//
+static inline int32_t _FixedResidual(int32_t in_sample, uint32_t in_order, int32_t *io_last)
+{
+    int32_t residual[FLAC_MAX_ORDER + 1];
+
+    residual[0] = in_sample;
+
+    for (uint32_t order = 1; order <= in_order; order++)
+    {
+        residual[order] = residual[order - 1] - io_last[order - 1];
+    }
+
+    memcpy(io_last, residual, (in_order + 1) * sizeof(residual[0]));
+    return residual[in_order];
+}
+
+// the rice parameter that minimizes n * (k + 1) + sum >> k
+//
+static uint32_t _RiceParam(uint64_t in_sum, uint32_t in_count)
+{
+    uint32_t param = 0;
+
+    while (param < FLAC_MAX_RICE2_PARAM && (in_sum >> (param + 1)) > in_count)
+    {
+        param++;
+    }
+
+    return param;
+}
+
+// pick a partition order and parameters for the residual of one order,
+// given the residual sums over the finest partitions
+//
+static uint64_t _RiceCost(const uint32_t *in_sums, uint32_t in_wasted, uint32_t in_frames, uint32_t in_order,
+                          struct flac_subframe *io_sub)
+{
+    uint64_t best = UINT64_MAX;
+
+    for (uint32_t porder = 0; porder <= FLAC_MAX_PARTITION_ORDER; porder++)
+    {
+        uint32_t parts = 1 << porder;
+        uint32_t merge = FLAC_PARTITIONS >> porder;
+        uint32_t psize = in_frames >> porder;
+        uint8_t params[FLAC_PARTITIONS];
+        uint32_t max_param = 0;
+        uint64_t cost = 2 + 4;
+
+        for (uint32_t part = 0; part < parts; part++)
+        {
+            uint32_t count = psize - (part ? 0 : in_order);
+            uint64_t sum = 0;
+
+            for (uint32_t fine = part * merge; fine < (part + 1) * merge; fine++)
+            {
+                sum += in_sums[fine];
+            }
+            sum >>= in_wasted;
+
+            params[part] = _RiceParam(sum, count);
+            if (params[part] > max_param)
+            {
+                max_param = params[part];
+            }
+
+            cost += (uint64_t)count * (params[part] + 1) + (sum >> params[part]);
+        }
+
+        cost += parts * ((max_param > FLAC_MAX_RICE_PARAM) ? 5 : 4);
+
+        if (cost < best)
+        {
+            best = cost;
+            io_sub->partition_order = porder;
+            io_sub->rice2 = max_param > FLAC_MAX_RICE_PARAM;
+            memcpy(io_sub->params, params, parts);
+        }
+    }
+
+    return best;
+}
+
+// one pass over a channel for wasted bits and the residual sums of every
+// fixed order over the finest partitions, then choose the cheapest coding.
+// A partition is at most 256 frames of 21 bit residuals so the sums fit
+// in 32 bits, which keeps this light on stack in the disk thread
+//
+static void _Analyze(const struct flac_encoder *enc, uint32_t in_frames, uint32_t in_channel,
+                     struct flac_subframe *out_sub)
+{
+    uint32_t sums[FLAC_MAX_ORDER + 1][FLAC_PARTITIONS];
+    int32_t last[FLAC_MAX_ORDER + 1] = { 0 };
+    uint32_t psize = in_frames >> FLAC_MAX_PARTITION_ORDER;
+    uint32_t or_bits = 0;
+    uint32_t frame = 0;
+    uint32_t width;
+    int32_t first;
+    bool constant = true;
+
+    memset(sums, 0, sizeof(sums));
+    memset(out_sub, 0, sizeof(*out_sub));
+
+    out_sub->channel = in_channel;
+    out_sub->bps = (in_channel == FLAC_CH_SIDE) ? 17 : 16;
+
+    first = _Sample(enc, 0, in_channel);
+
+    for (uint32_t part = 0; part < FLAC_PARTITIONS; part++)
+    {
+        for (uint32_t count = 0; count < psize; count++, frame++)
+        {
+            int32_t sample = _Sample(enc, frame, in_channel);
+
+            or_bits |= (uint32_t)sample;
+            constant &= (sample == first);
+
+            _FixedResidual(sample, FLAC_MAX_ORDER, last);
+
+            for (uint32_t order = 0; order <= FLAC_MAX_ORDER && order <= frame; order++)
+            {
+                sums[order][part] += _ZigZag(last[order]);
+            }
+        }
+    }
+
+    if (constant)
+    {
+        out_sub->type = FLAC_SUBFRAME_CONSTANT;
+        out_sub->constant = first;
+        out_sub->bits = 8 + out_sub->bps;
+        return;
+    }
+
+    out_sub->wasted = __builtin_ctz(or_bits);
+    width = out_sub->bps - out_sub->wasted;
+
+    out_sub->type = FLAC_SUBFRAME_VERBATIM;
+    out_sub->bits = 8 + out_sub->wasted + (uint64_t)in_frames * width;
+
+    for (uint32_t order = 0; order <= FLAC_MAX_ORDER; order++)
+    {
+        struct flac_subframe fixed = *out_sub;
+        uint64_t bits;
+
+        bits = 8 + out_sub->wasted + order * width;
+        bits += _RiceCost(sums[order], out_sub->wasted, in_frames, order, &fixed);
+
+        if (bits < out_sub->bits)
+        {
+            *out_sub = fixed;
+            out_sub->type = FLAC_SUBFRAME_FIXED;
+            out_sub->order = order;
+            out_sub->bits = bits;
+        }
+    }
+}
+
+static void _WriteSubframe(struct flac_bits *bits, const struct flac_encoder *enc, uint32_t in_frames,
+                           const struct flac_subframe *sub)
+{
+    uint32_t width = sub->bps - sub->wasted;
+    uint32_t type = sub->type;
+    int32_t last[FLAC_MAX_ORDER + 1] = { 0 };
+    uint32_t psize;
+    uint32_t frame;
+
+    if (type == FLAC_SUBFRAME_FIXED)
+    {
+        type |= sub->order;
+    }
+
+    _BitsPut(bits, (type << 1) | (sub->wasted ? 1 : 0), 8);
+    if (sub->wasted)
+    {
+        _BitsUnary(bits, sub->wasted - 1);
+    }
+
+    if (sub->type == FLAC_SUBFRAME_CONSTANT)
+    {
+        _BitsPut(bits, (uint32_t)sub->constant, sub->bps);
+        return;
+    }
+
+    if (sub->type == FLAC_SUBFRAME_VERBATIM)
+    {
+        for (frame = 0; frame < in_frames && !bits->overflow; frame++)
+        {
+            _BitsPut(bits, (uint32_t)(_Sample(enc, frame, sub->channel) >> sub->wasted), width);
+        }
+        return;
+    }
+
+    // warm-up samples, then the residual
+    //
+    for (frame = 0; frame < sub->order; frame++)
+    {
+        int32_t sample = _Sample(enc, frame, sub->channel) >> sub->wasted;
+
+        _FixedResidual(sample, sub->order, last);
+        _BitsPut(bits, (uint32_t)sample, width);
+    }
+
+    _BitsPut(bits, sub->rice2 ? 1 : 0, 2);
+    _BitsPut(bits, sub->partition_order, 4);
+
+    psize = in_frames >> sub->partition_order;
+
+    for (uint32_t part = 0; part < (1U << sub->partition_order) && !bits->overflow; part++)
+    {
+        uint32_t param = sub->params[part];
+
+        _BitsPut(bits, param, sub->rice2 ? 5 : 4);
+
+        for (; frame < (part + 1) * psize; frame++)
+        {
+            uint32_t value = _ZigZag(_FixedResidual(_Sample(enc, frame, sub->channel) >> sub->wasted,
+                                                    sub->order, last));
+
+            _BitsUnary(bits, value >> param);
+            _BitsPut(bits, value, param);
+        }
+    }
+}
+
+static int _EncodeBlock(struct flac_encoder *enc, uint8_t *out_frame, uint32_t in_size, uint32_t in_frames)
+{
+    struct flac_subframe subs[FLAC_CH_COUNT];
+    struct flac_bits bits;
+    const struct flac_subframe *first;
+    const struct flac_subframe *second;
+    uint32_t assign;
+    uint64_t best;
+
+    for (uint32_t channel = 0; channel < FLAC_CH_COUNT; channel++)
+    {
+        _Analyze(enc, in_frames, channel, &subs[channel]);
+    }
+
+    assign = FLAC_ASSIGN_INDEPENDENT;
+    first = &subs[FLAC_CH_LEFT];
+    second = &subs[FLAC_CH_RIGHT];
+    best = first->bits + second->bits;
+
+    if (subs[FLAC_CH_LEFT].bits + subs[FLAC_CH_SIDE].bits < best)
+    {
+        assign = FLAC_ASSIGN_LEFT_SIDE;
+        first = &subs[FLAC_CH_LEFT];
+        second = &subs[FLAC_CH_SIDE];
+        best = first->bits + second->bits;
+    }
+    if (subs[FLAC_CH_SIDE].bits + subs[FLAC_CH_RIGHT].bits < best)
+    {
+        assign = FLAC_ASSIGN_RIGHT_SIDE;
+        first = &subs[FLAC_CH_SIDE];
+        second = &subs[FLAC_CH_RIGHT];
+        best = first->bits + second->bits;
+    }
+    if (subs[FLAC_CH_MID].bits + subs[FLAC_CH_SIDE].bits < best)
+    {
+        assign = FLAC_ASSIGN_MID_SIDE;
+        first = &subs[FLAC_CH_MID];
+        second = &subs[FLAC_CH_SIDE];
+    }
+
+    _BitsInit(&bits, out_frame, in_size);
+    _WriteHeader(&bits, enc, in_frames, assign, 0, false);
+    _WriteSubframe(&bits, enc, in_frames, first);
+    _WriteSubframe(&bits, enc, in_frames, second);
+    _WriteFooter(&bits, 0);
+
+    return bits.overflow ? -ENOSPC : (int)bits.pos;
+}
+
+static int _EncodeFill(struct flac_encoder *enc, uint8_t *out_frame, uint32_t in_frames,
+                       uint32_t in_size_bytes, bool in_explicit_rate)
+{
+    struct flac_bits bits;
+    int ret;
+
+    ret = enc->read(enc->frames, in_frames, enc->read_ctx);
+    require_noerr(ret, exit);
+
+    enc->quantize = 0;
+
+    _BitsInit(&bits, out_frame, enc->group_size);
+    _WriteHeader(&bits, enc, in_frames, FLAC_ASSIGN_INDEPENDENT, in_size_bytes, in_explicit_rate);
+
+    for (uint32_t channel = FLAC_CH_LEFT; channel <= FLAC_CH_RIGHT; channel++)
+    {
+        _BitsPut(&bits, FLAC_SUBFRAME_VERBATIM << 1, 8);
+
+        for (uint32_t frame = 0; frame < in_frames; frame++)
+        {
+            _BitsPut(&bits, (uint32_t)_Sample(enc, frame, channel), 16);
+        }
+    }
+
+    _WriteFooter(&bits, 0);
+
+    ret = bits.overflow ? -ENOSPC : (int)bits.pos;
+    require(ret > 0, exit);
+
+    enc->sample_number += in_frames;
+    enc->in_frames += in_frames;
+    enc->fill_in_frames += in_frames;
+    enc->fill_frames++;
+exit:
+    return ret;
+}
+
+// fill the rest of a group exactly, with full size filler frames until the
+// remainder fits in one
+//
+static int _EncodeFills(struct flac_encoder *enc, uint8_t *out_group, uint32_t in_remain)
+{
+    int ret = 0;
+
+    while (in_remain > 0)
+    {
+        uint32_t overhead = FLAC_FILL_OVERHEAD + _Utf8Size(enc->sample_number & FLAC_SAMPLE_NUMBER_MASK);
+        uint32_t frames;
+        uint32_t extra;
+
+        require_action(in_remain >= FLAC_FILL_MIN_SIZE, exit, ret = -EINVAL);
+
+        if (in_remain >= overhead + 1 + 4 * FLAC_FILL_MAX_FRAMES + FLAC_FILL_MIN_SIZE)
+        {
+            frames = FLAC_FILL_MAX_FRAMES;
+            extra = 1;
+        }
+        else if (in_remain > overhead + 4 + 4 * FLAC_FILL_MAX_FRAMES)
+        {
+            // too big for one, but a full one would leave too little
+            //
+            frames = FLAC_FILL_MAX_FRAMES / 2;
+            extra = 1;
+        }
+        else
+        {
+            // 1 to 4 bytes of optional fields take up the remainder that
+            // whole frames can't
+            //
+            extra = ((in_remain - overhead - 1) & 3) + 1;
+            frames = (in_remain - overhead - extra) / 4;
+        }
+
+        ret = _EncodeFill(enc, out_group, frames, (extra & 1) ? 1 : 2, extra > 2);
+        require(ret > 0, exit);
+        require_action(ret == overhead + extra + 4 * frames, exit, ret = -EINVAL);
+
+        out_group += ret;
+        in_remain -= ret;
+        ret = 0;
+    }
+exit:
+    return ret;
+}
+
+// aim the next block at most of the budget, leaving a margin for the
+// audio getting busier
+//
+static void _AdaptBlock(struct flac_encoder *enc, uint32_t in_frames, uint32_t in_used, uint32_t in_budget)
+{
+    uint32_t target = in_budget - in_budget / 8;
+    uint32_t limit = in_budget * 2;
+    uint32_t frames;
+
+    if (enc->shift)
+    {
+        frames = in_frames / 2;
+    }
+    else
+    {
+        frames = (uint32_t)((uint64_t)in_frames * target / in_used);
+    }
+
+    frames = (in_frames + frames) / 2;
+    frames &= ~(FLAC_PARTITIONS - 1);
+
+    if (frames > FLAC_MAX_BLOCK_FRAMES)
+    {
+        frames = FLAC_MAX_BLOCK_FRAMES;
+    }
+    if (frames > limit)
+    {
+        frames = limit & ~(FLAC_PARTITIONS - 1);
+    }
+    if (frames < FLAC_MIN_BLOCK_FRAMES)
+    {
+        frames = FLAC_MIN_BLOCK_FRAMES;
+    }
+
+    enc->block_frames = frames;
+}
+
+int FlacEncodeGroup(struct flac_encoder *enc, uint8_t *out_group)
+{
+    int ret = -EINVAL;
+    uint32_t frames;
+    uint32_t budget;
+
+    require(enc && out_group, exit);
+
+    // always leave room for at least one filler
+    //
+    budget = enc->group_size - FLAC_FILL_MIN_SIZE;
+    frames = enc->block_frames;
+
+    ret = enc->read(enc->frames, frames, enc->read_ctx);
+    require_noerr(ret, exit);
+
+    for (enc->quantize = 0; enc->quantize <= FLAC_MAX_SHIFT; enc->quantize++)
+    {
+        ret = _EncodeBlock(enc, out_group, budget, frames);
+        if (ret > 0)
+        {
+            break;
+        }
+    }
+    require(ret > 0, exit);
+
+    enc->shift = enc->quantize;
+    if (enc->shift)
+    {
+        enc->lossy_blocks++;
+    }
+    enc->blocks++;
+    enc->sample_number += frames;
+    enc->in_frames += frames;
+
+    _AdaptBlock(enc, frames, ret, budget);
+
+    ret = _EncodeFills(enc, out_group + ret, enc->group_size - ret);
+    require_noerr(ret, exit);
+
+    enc->groups++;
+    enc->out_bytes += enc->group_size;
+exit:
+    return ret;
+}
+
+int FlacEncodeHeader(struct flac_encoder *enc, uint8_t *out_header)
+{
+    int ret = -EINVAL;
+    struct flac_bits bits;
+
+    require(enc && out_header, exit);
+
+    memset(out_header, 0, FLAC_HEADER_SIZE);
+    _BitsInit(&bits, out_header, FLAC_HEADER_SIZE);
+
+    _BitsPut(&bits, 0x664C6143, 32);            // "fLaC"
+
+    // STREAMINFO, frame sizes, total samples and md5 are unknown
+    //
+    _BitsPut(&bits, 0, 1);
+    _BitsPut(&bits, 0, 7);
+    _BitsPut(&bits, 34, 24);
+    _BitsPut(&bits, FLAC_FILL_MIN_FRAMES, 16);
+    _BitsPut(&bits, FLAC_MAX_BLOCK_FRAMES, 16);
+    _BitsPut(&bits, 0, 24);
+    _BitsPut(&bits, 0, 24);
+    _BitsPut(&bits, enc->sample_rate, 20);
+    _BitsPut(&bits, 2 - 1, 3);
+    _BitsPut(&bits, 16 - 1, 5);
+    _BitsPut(&bits, 0, 4);
+    _BitsPut(&bits, 0, 32);
+    for (int word = 0; word < 4; word++)
+    {
+        _BitsPut(&bits, 0, 32);
+    }
+
+    // last block is PADDING to the end of the sector
+    //
+    _BitsPut(&bits, 1, 1);
+    _BitsPut(&bits, 1, 7);
+    _BitsPut(&bits, FLAC_HEADER_SIZE - bits.pos - 3, 24);
+
+    enc->sample_number = 0;
+    ret = 0;
+exit:
+    return ret;
+}
+
+int FlacEncoderInit(struct flac_encoder *enc, uint32_t in_sample_rate, uint32_t in_group_size,
+                    flac_read_t in_read, void *in_ctx)
+{
+    int ret = -EINVAL;
+
+    require(enc && in_read, exit);
+    require(in_group_size >= FLAC_MIN_GROUP_SIZE, exit);
+    require(in_sample_rate <= 0xFFFF || (in_sample_rate % 10 == 0 && in_sample_rate <= 0xFFFF * 10), exit);
+
+    if (!s_crc16_table[1])
+    {
+        _Crc16Init();
+    }
+
+    memset(enc, 0, sizeof(*enc));
+
+    enc->sample_rate = in_sample_rate;
+    enc->group_size = in_group_size;
+    enc->read = in_read;
+    enc->read_ctx = in_ctx;
+
+    // start off assuming 3 bytes per frame
+    //
+    enc->block_frames = (in_group_size - FLAC_FILL_MIN_SIZE) / 3;
+    enc->block_frames &= ~(FLAC_PARTITIONS - 1);
+    if (enc->block_frames > FLAC_MAX_BLOCK_FRAMES)
+    {
+        enc->block_frames = FLAC_MAX_BLOCK_FRAMES;
+    }
+    if (enc->block_frames < FLAC_MIN_BLOCK_FRAMES)
+    {
+        enc->block_frames = FLAC_MIN_BLOCK_FRAMES;
+    }
+
+    ret = 0;
+exit:
+    return ret;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024, Level Home Inc.
+ *
+ * All rights reserved.
+ *
+ * Proprietary and confidential. Unauthorized copying of this file,
+ * via any medium is strictly prohibited.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// Streaming FLAC encoder for 16 bit stereo, fixed predictors (orders 0-4)
+// and partitioned Rice coding, no LPC analysis.  Output is produced in
+// groups of a fixed number of bytes that always start and end on a frame
+// boundary so a group can be served as whole disk sectors, and re-read or
+// skipped by the host without upsetting a decoder.
+//
+// Input frames are packed as in the wav file, channel 0 (left) in the low
+// half-word.  No OS dependencies so it can be built and tested on a host
+//
+
+// the stream header (fLaC, STREAMINFO and PADDING) fills exactly one sector
+//
+#define FLAC_HEADER_SIZE        (512)
+
+// largest block, in stereo frames, the encoder will put in one frame
+//
+#define FLAC_MAX_BLOCK_FRAMES   (4096)
+
+// smallest group worth encoding, leaves room for a frame and its filler
+//
+#define FLAC_MIN_GROUP_SIZE     (1024)
+
+// supplies in_count packed stereo frames, returns 0 or a negative errno
+//
+typedef int (*flac_read_t)(uint32_t *out_frames, uint32_t in_count, void *in_ctx);
+
+struct flac_encoder
+{
+    uint32_t    sample_rate;
+    uint32_t    group_size;
+
+    flac_read_t read;
+    void       *read_ctx;
+
+    // frames in the next compressed block, adapted so that the block
+    // takes most of a group and the rest is filler
+    //
+    uint32_t    block_frames;
+
+    // position in the stream, in stereo frames
+    //
+    uint64_t    sample_number;
+
+    // low bits dropped from the last block to make it fit, 0 is lossless,
+    // and while encoding
+    //
+    uint32_t    shift;
+    uint32_t    quantize;
+
+    // stats
+    //
+    uint32_t    groups;
+    uint32_t    blocks;
+    uint32_t    lossy_blocks;
+    uint32_t    fill_frames;
+    uint64_t    in_frames;
+    uint64_t    fill_in_frames;
+    uint64_t    out_bytes;
+
+    uint32_t    frames[FLAC_MAX_BLOCK_FRAMES];
+};
+
+int FlacEncoderInit(struct flac_encoder *enc, uint32_t in_sample_rate, uint32_t in_group_size,
+                    flac_read_t in_read, void *in_ctx);
+
+// write the stream header into one sector and restart the stream
+//
+int FlacEncodeHeader(struct flac_encoder *enc, uint8_t *out_header);
+
+// read audio and encode exactly group_size bytes of frames
+//
+int FlacEncodeGroup(struct flac_encoder *enc, uint8_t *out_group);
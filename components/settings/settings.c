@@ -63,7 +63,10 @@ static int _OnSettingLoaded(
 
     require(!in_key, exit);
 
-    in_callback(in_cb_arg, (uint8_t*)setting->data, in_count);
+    // never read more than the caller has room for, count still says
+    // how big the stored value is
+    //
+    in_callback(in_cb_arg, (uint8_t*)setting->data, (in_count < setting->size) ? in_count : setting->size);
     setting->count = in_count;
     setting->found = true;
     LOG_DBG("setting %s loaded", setting->key_path);
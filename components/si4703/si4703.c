@@ -199,13 +199,14 @@ static uint16_t si4703_get_chan(struct si4703_device *chip)
     return val;
 }
 
-static int si4703_decode_rds(struct si4703_device *chip)
+// parse the RDS block already read into the register shadow
+//
+static void si4703_parse_rds(struct si4703_device *chip)
 {
-    uint16_t rds[4];
+    const uint16_t *rds = &chip->regs[REG_RDSA];
     uint8_t txtoff;
     uint16_t group;
     uint16_t version;
-    int ret;
 
     char name[9];
     char text[65];
@@ -214,15 +215,6 @@ static int si4703_decode_rds(struct si4703_device *chip)
     memcpy(text, chip->text, sizeof(text));
     chip->rds_changed = false;
 
-    ret  = si4703_read(chip, REG_RDSA, &rds[0]);
-    ret += si4703_read(chip, REG_RDSB, &rds[1]);
-    ret += si4703_read(chip, REG_RDSC, &rds[2]);
-    ret += si4703_read(chip, REG_RDSD, &rds[3]);
-    if (ret)
-    {
-        return ret;
-    }
-
     group = rds[1] >> 12;
     version = (rds[1] & (1 << 11)) ? 1 : 0;
 
@@ -275,7 +267,23 @@ static int si4703_decode_rds(struct si4703_device *chip)
     {
         chip->rds_changed = true;
     }
+}
+
+static int si4703_decode_rds(struct si4703_device *chip)
+{
+    uint16_t val;
+    int ret;
+
+    // reads always start at REG_RSSI, so one read up to the last RDS
+    // register gets all four blocks
+    //
+    ret = si4703_read(chip, REG_RDSD, &val);
+    if (ret)
+    {
+        return ret;
+    }
 
+    si4703_parse_rds(chip);
     return ret;
 }
 
@@ -612,6 +620,14 @@ static int si4703_reset(struct si4703_device *chip, int longloop)
 {
     int ret;
 
+    // the line can be shared with the other radio, which may be up already,
+    // so init only pulses it the first time.  a reset from the shell always does
+    //
+    if (!longloop && !TunerClaimReset(m_chip.rst_spec->port, m_chip.rst_spec->pin))
+    {
+        return 0;
+    }
+
     ret = gpio_pin_configure_dt(m_chip.rst_spec, GPIO_OUTPUT);
     if (ret)
     {
@@ -684,7 +700,7 @@ static int SI4703GetRSSI(
     require_noerr(ret, exit);
     ret = si4703_get_int_status(&m_chip, &status);
     require_noerr(ret, exit);
-    *out_stereo = (status & 0x100) ? true : false;
+    *out_stereo = (status & STEREO) ? true : false;
 exit:
     return ret;
 }
@@ -711,7 +727,7 @@ static int SI4703GetRDS(
 
     ret = si4703_get_int_status(&m_chip, &status);
     require_noerr(ret, exit);
-    if (status & 0x8000)
+    if (status & RDSR)
     {
         si4703_decode_rds(&m_chip);
 
@@ -737,6 +753,72 @@ exit:
     return ret;
 }
 
+// SKSNR is a 1-15 scale rather than dB, so only the RSSI threshold
+// follows the caller and the SNR one stays as set at init
+//
+static int SI4703SetSeekThreshold(
+                        tuner_t *in_tuner,
+                        uint8_t in_rssi,
+                        uint8_t in_snr
+                        )
+{
+    int ret = -EINVAL;
+    uint16_t val;
+    uint16_t seek_thr = in_rssi ? in_rssi : m_chip.seek_thr;
+
+    require_action(m_chip.state >= TUNER_READY, exit, ret = -EAGAIN);
+
+    ret = si4703_read(&m_chip, REG_SYSCONFIG2, &val);
+    require_noerr(ret, exit);
+
+    ret = si4703_write(&m_chip, REG_SYSCONFIG2, (val & 0x00FF) | (seek_thr << 8));
+    require_noerr(ret, exit);
+
+    LOG_INF("Seek threshold rssi=%u", seek_thr);
+exit:
+    return ret;
+}
+
+// status, channel and the RDS block all sit in the registers a read
+// starts from, so one read gets everything the tuner polls for
+//
+static int SI4703GetStatus(
+                        tuner_t *in_tuner,
+                        struct tuner_status *out_status
+                        )
+{
+    int ret = -EINVAL;
+    uint16_t val;
+    uint16_t status;
+
+    require(out_status, exit);
+    require_action(m_chip.state == TUNER_TUNED, exit, ret = -EAGAIN);
+
+    ret = si4703_read(&m_chip, REG_RDSD, &val);
+    require_noerr(ret, exit);
+
+    status = m_chip.regs[REG_RSSI];
+
+    out_status->freq_kHz = (m_chip.regs[REG_READCHAN] & READCHAN) * CHANNEL_SPACE + FREQ_MIN;
+    out_status->rssi = status & RSSI;
+    out_status->snr = 0;
+    out_status->stereo = (status & STEREO) ? true : false;
+    out_status->afc_railed = (status & AFCRL) ? true : false;
+    out_status->rds_ready = (status & RDSR) ? true : false;
+    out_status->rds_changed = false;
+
+    if (status & RDSR)
+    {
+        si4703_parse_rds(&m_chip);
+        out_status->rds_changed = m_chip.rds_changed;
+    }
+
+    out_status->rds_short = m_chip.name;
+    out_status->rds_long = m_chip.text;
+exit:
+    return ret;
+}
+
 int SI4703TuneTo(
                         tuner_t *in_tuner,
                         uint32_t freq_kHz
@@ -926,8 +1008,10 @@ static tuner_t m_si4703 =
     .get_tune = SI4703GetTunedFreq,
     .get_rssi = SI4703GetRSSI,
     .get_rds  = SI4703GetRDS,
+    .get_status = SI4703GetStatus,
     .tune     = SI4703Tune,
-    .seek     = SI4703Seek
+    .seek     = SI4703Seek,
+    .set_seek_threshold = SI4703SetSeekThreshold
 };
 
 tuner_t *SI4703GetRadio(void)
@@ -55,11 +55,16 @@
 #define DETECTION_THRESHOLD     0x0008
 
 /* REG_RSSI */
+#define RDSR                    0x8000
 #define STC                     0x4000
+#define STEREO                  0x0100
 #define RSSI                    0x00FF
 #define AFCRL                   0x1000
 #define SFBL                    0x2000
 
+/* REG_READCHAN */
+#define READCHAN                0x03FF
+
 /* go from frequency in units of 100kHz to units to MHz */
 #define FREQ_MUL                100
 
@@ -22,6 +22,17 @@ static const struct gpio_dt_spec gpio_rst = GPIO_DT_SPEC_GET(DT_NODELABEL(gpio_s
 #define POST_POWERUP_MS     (110)
 #define POST_CONFIG_MS      (50)
 
+// a command takes a few hundred us to be accepted, after which the status
+// byte is polled for CTS at this interval
+//
+#define CMD_WAIT_US         (300)
+#define CTS_POLL_US         (200)
+
+// digital audio rate, the chip resamples to this from its own clock so it
+// only has to match the rate the I2S controller runs the frame clock at
+//
+#define DIGITAL_SAMPLE_RATE (44100)
+
 static struct si473x_device
 {
     const struct i2c_dt_spec *i2c_spec;
@@ -29,6 +40,21 @@ static struct si473x_device
 
     tuner_state_t   state;
 
+    // the chip signalled CTS after the last command, so the next one can be
+    // sent without polling for it first
+    //
+    bool        cts;
+
+    // channel last tuned to, 0 after a seek until it is read back
+    //
+    uint32_t    freq;
+
+    // a scan seek left running between slices, and the channel the scan
+    // carries on from once it lands
+    //
+    bool        seeking;
+    uint32_t    seek_next;
+
     bool        rds_changed;
     char        name[9];
     char        text[65];
@@ -74,7 +100,7 @@ static int si473x_wait_cts(struct si473x_device *chip, const int32_t in_timeout_
             return -EIO;
         }
 
-        if (!(ret & STATUS_CTS) && (timeout > 0))
+        if (!(status & STATUS_CTS) && (timeout > 0))
         {
             k_msleep(10);
             timeout -= 10;
@@ -124,9 +150,13 @@ static int si473x_send_cmd(struct si473x_device *chip, const uint8_t in_cmd, con
         buf[i + 1] = in_args[i];
     }
 
-    // wait cts
-    ret = si473x_wait_cts(chip, 600);
-    require_noerr(ret, exit);
+    // wait cts, unless the last command already saw it
+    if (!chip->cts)
+    {
+        ret = si473x_wait_cts(chip, 600);
+        require_noerr(ret, exit);
+    }
+    chip->cts = false;
 
     // write cmd and args
     ret = si473x_write(chip, buf, 1 + in_arg_count);
@@ -135,11 +165,82 @@ static int si473x_send_cmd(struct si473x_device *chip, const uint8_t in_cmd, con
     // wait cts
     ret = si473x_wait_cts(chip, 600);
     require_noerr(ret, exit);
+    chip->cts = true;
 
 exit:
     return ret;
 }
 
+// a command with a response.  the first response byte is the status, so
+// the response is read until it shows CTS rather than polling for CTS and
+// then reading again
+//
+static int si473x_query(
+                        struct si473x_device *chip,
+                        const uint8_t in_cmd,
+                        const uint32_t in_arg_count,
+                        uint8_t *in_args,
+                        const size_t in_resp_count,
+                        uint8_t *out_resp
+                        )
+{
+    int ret = -EINVAL;
+    uint8_t buf[32];
+    int32_t timeout = 600 * 1000;
+
+    if (s_ignore_i2c)
+    {
+        memset(out_resp, 0, in_resp_count);
+        return 0;
+    }
+
+    require(in_arg_count < sizeof(buf), exit);
+    require(in_resp_count > 0, exit);
+
+    buf[0] = in_cmd;
+    for (int i = 0; i < in_arg_count; i++)
+    {
+        buf[i + 1] = in_args[i];
+    }
+
+    if (!chip->cts)
+    {
+        ret = si473x_wait_cts(chip, 600);
+        require_noerr(ret, exit);
+    }
+    chip->cts = false;
+
+    ret = si473x_write(chip, buf, 1 + in_arg_count);
+    require_noerr(ret, exit);
+
+    k_usleep(CMD_WAIT_US);
+
+    while (true)
+    {
+        ret = si473x_read(chip, in_resp_count, out_resp);
+        require_noerr(ret, exit);
+
+        if (out_resp[0] & STATUS_CTS)
+        {
+            break;
+        }
+
+        if (timeout <= 0)
+        {
+            LOG_ERR("Timeout waiting for CTS");
+            ret = -ETIMEDOUT;
+            goto exit;
+        }
+
+        k_usleep(CTS_POLL_US);
+        timeout -= CTS_POLL_US;
+    }
+
+    chip->cts = true;
+exit:
+    return ret;
+}
+
 static int si473x_send_prop(struct si473x_device *chip, const uint16_t in_prop, const uint16_t in_value)
 {
     int ret = -EINVAL;
@@ -174,10 +275,7 @@ static int si473x_get_int_status(struct si473x_device *chip, uint8_t *out_status
 {
     int ret;
 
-    ret = si473x_send_cmd(chip, GET_INT_STATUS, 0, NULL);
-    require_noerr(ret, exit);
-
-    ret = si473x_read(chip, 1, out_status);
+    ret = si473x_query(chip, GET_INT_STATUS, 0, NULL, 1, out_status);
     require_noerr(ret, exit);
 exit:
     return ret;
@@ -210,6 +308,59 @@ exit:
      return ret;
 }
 
+// poll for the end of a seek or tune for up to in_timeout_ms, without
+// treating a seek that is still going as an error
+//
+static int si473x_poll_stc(struct si473x_device *chip, int32_t in_timeout_ms, bool *out_done)
+{
+    int ret;
+    uint8_t status;
+
+    while (true)
+    {
+        ret = si473x_get_int_status(chip, &status);
+        require_noerr(ret, exit);
+
+        if ((status & 0x1) || in_timeout_ms <= 0)
+        {
+            break;
+        }
+
+        in_timeout_ms -= 4;
+        k_msleep(4);
+    }
+
+    *out_done = (status & 0x1) ? true : false;
+exit:
+    return ret;
+}
+
+// stop a scan seek left running, and clear the STC it ends with so the
+// next tune doesn't see it
+//
+static int si473x_seek_cancel(struct si473x_device *chip)
+{
+    int ret;
+    uint8_t args[1];
+    uint8_t response[8];
+    bool done;
+
+    chip->seeking = false;
+
+    args[0] = 0x2;
+    ret = si473x_query(chip, FM_TUNE_STATUS, 1, args, 8, response);
+    require_noerr(ret, exit);
+
+    ret = si473x_poll_stc(chip, 250, &done);
+    require_noerr(ret, exit);
+
+    args[0] = 0x1;
+    ret = si473x_query(chip, FM_TUNE_STATUS, 1, args, 8, response);
+    require_noerr(ret, exit);
+exit:
+    return ret;
+}
+
 static void si473x_clear_rds(struct si473x_device *chip)
 {
     memset(chip->name, 0, sizeof(chip->name));
@@ -232,6 +383,14 @@ int si473x_set_freq(struct si473x_device *chip, uint32_t in_freq)
         return -EINVAL;
     }
 
+    // a tune, urgent or not, wins over a scan that is part way through
+    //
+    if (chip->seeking)
+    {
+        ret = si473x_seek_cancel(chip);
+        require_noerr(ret, exit);
+    }
+
     si473x_clear_rds(chip);
 
     freq = in_freq / 10;
@@ -240,10 +399,14 @@ int si473x_set_freq(struct si473x_device *chip, uint32_t in_freq)
     args[2] = freq & 0xFF;
     args[3] = 0;
 
+    chip->freq = 0;
+
     ret = si473x_send_cmd(chip, FM_TUNE_FREQ, 4, args);
     require_noerr(ret, exit);
     ret = si473x_wait_stc(&m_chip, 250);
     require_noerr(ret, exit);
+
+    chip->freq = in_freq;
 exit:
     return ret;
 }
@@ -266,17 +429,14 @@ static int si473x_get_tune_status(
     }
 
     args[0] = in_clr_stc ? 0x3 : 0x0;
-    ret = si473x_send_cmd(chip, FM_TUNE_STATUS, 1, args);
+    ret = si473x_query(chip, FM_TUNE_STATUS, 1, args, 8, response);
     require_noerr(ret, exit);
 
-    ret = si473x_read(chip, 8, response);
-    require_noerr(ret, exit);
+    chip->freq = (((uint32_t)response[2] << 8) | (uint32_t)response[3]) * 10;
 
     if (out_freq)
     {
-        uint32_t freq = ((uint32_t)response[2] << 8) | (uint32_t)response[3];
-
-        *out_freq = freq * 10;
+        *out_freq = chip->freq;
     }
 
     if (out_rssi)
@@ -305,10 +465,7 @@ static int si473x_get_rssi(struct si473x_device *chip, uint8_t *out_rssi, bool *
     }
 
     args[0] = 0;
-    ret = si473x_send_cmd(chip, FM_RSQ_STATUS, 1, args);
-    require_noerr(ret, exit);
-
-    ret = si473x_read(chip, 8, response);
+    ret = si473x_query(chip, FM_RSQ_STATUS, 1, args, 8, response);
     require_noerr(ret, exit);
 
     if (out_rssi)
@@ -318,12 +475,12 @@ static int si473x_get_rssi(struct si473x_device *chip, uint8_t *out_rssi, bool *
 
     if (out_stereo)
     {
-        *out_stereo = (response[3] & 0x8) ? true : false;
+        *out_stereo = (response[3] & RSQ_PILOT) ? true : false;
     }
 
-    if (out_stereo)
+    if (out_afc_railed)
     {
-        *out_stereo = (response[2] & 0x2) ? true : false;
+        *out_afc_railed = (response[2] & RSQ_AFCRL) ? true : false;
     }
 exit:
     return ret;
@@ -395,24 +552,75 @@ exit:
     return ret;
 }
 
-static int si473x_seek(struct si473x_device *chip, bool in_up, bool in_wrap)
+// start a seek without waiting for it to land
+//
+static int si473x_seek_start(struct si473x_device *chip, bool in_up, bool in_wrap)
 {
     int ret = -EINVAL;
     uint8_t args[1];
 
+    if (chip->seeking)
+    {
+        ret = si473x_seek_cancel(chip);
+        require_noerr(ret, exit);
+    }
+
     ret = si473x_get_tune_status(chip, true, NULL, NULL, NULL);
     require_noerr(ret, exit);
 
+    // FM_SEEK_START has one argument byte
+    //
     args[0] = in_up ? 0x8 : 0x0;
     args[0] |= in_wrap ? 0x4 : 0x0;
-    ret = si473x_send_cmd(chip, FM_SEEK_START, 4, args);
+    chip->freq = 0;
+    ret = si473x_send_cmd(chip, FM_SEEK_START, 1, args);
     require_noerr(ret, exit);
-    ret = si473x_wait_stc(&m_chip, 250);
+exit:
+    return ret;
+}
+
+static int si473x_seek(struct si473x_device *chip, bool in_up, bool in_wrap)
+{
+    int ret;
+
+    // a seek can cross most of the band before it finds a station so give
+    // it the full seek time
+    //
+    ret = si473x_seek_start(chip, in_up, in_wrap);
+    require_noerr(ret, exit);
+    ret = si473x_wait_stc(&m_chip, MAX_SEEK_TIME);
     require_noerr(ret, exit);
 exit:
     return ret;
 }
 
+// result of the last seek or tune, acknowledging its STC
+//
+static int si473x_get_seek_status(
+                                struct si473x_device *chip,
+                                uint32_t *out_freq,
+                                uint8_t *out_rssi,
+                                bool *out_valid,
+                                bool *out_band_limit
+                                )
+{
+    int ret = -EINVAL;
+    uint8_t args[1];
+    uint8_t response[8];
+
+    args[0] = 0x1;
+    ret = si473x_query(chip, FM_TUNE_STATUS, 1, args, 8, response);
+    require_noerr(ret, exit);
+
+    chip->freq = (((uint32_t)response[2] << 8) | (uint32_t)response[3]) * 10;
+    *out_freq = chip->freq;
+    *out_rssi = response[4];
+    *out_valid = (response[1] & 0x1) ? true : false;
+    *out_band_limit = (response[1] & 0x80) ? true : false;
+exit:
+    return ret;
+}
+
 static int si473x_show_channel(struct si473x_device *chip)
 {
     int ret = 0;
@@ -534,6 +742,15 @@ static int si473x_config(struct si473x_device *chip)
     require_noerr(ret, exit);
     ret = si473x_send_prop(chip, FM_SEEK_TUNE_SNR_THRESHOLD, chip->sksnr);
     require_noerr(ret, exit);
+#if CONFIG_473X_DIGITAL
+    // 16 bit stereo, left justified to match the I2S controller.  DCLK has
+    // to be running before the rate is set, which enables the output
+    //
+    ret = si473x_send_prop(chip, DIGITAL_OUTPUT_FORMAT, DIGITAL_OSIZE_16 | DIGITAL_OMODE_LEFT_JUST);
+    require_noerr(ret, exit);
+    ret = si473x_send_prop(chip, DIGITAL_OUTPUT_SAMPLE_RATE, DIGITAL_SAMPLE_RATE);
+    require_noerr(ret, exit);
+#endif
 exit:
     return ret;
 }
@@ -544,16 +761,23 @@ static int si473x_power_up(struct si473x_device *chip)
     uint8_t args[2];
     uint8_t response[16];
 
+    // a power up ends any seek that was running
+    //
+    chip->seeking = false;
+
     /* ARG1   CTSIEN GPO2OEN  PATCH  XOSCEN  F3 F2 F1 F0 */
     /*                                      0000 = FM-Rx */
     args[0] = 0xD0;
 
     /* ARG2 0x00 = RDS only
      *      0x05 = Analog LOUT/ROUT
-     *      0x0B = Digital Out
+     *      0x0B = Digital Out on DCLK, LOUT/DFS, ROUT/DIO
      */
-    args[1] = 0x05;
-   // args[1] = 0x0B;
+#if CONFIG_473X_DIGITAL
+    args[1] = SI473X_DIGITAL_AUDIO1;
+#else
+    args[1] = SI473X_ANALOG_AUDIO;
+#endif
 
     ret = si473x_send_cmd(chip, POWER_UP, 2, args);
     require_noerr(ret, exit);
@@ -585,6 +809,17 @@ static int si473x_reset(struct si473x_device *chip, int longloop)
 {
     int ret;
 
+    chip->cts = false;
+    chip->freq = 0;
+
+    // the line can be shared with the other radio, which may be up already,
+    // so init only pulses it the first time.  a reset from the shell always does
+    //
+    if (!longloop && !TunerClaimReset(m_chip.rst_spec->port, m_chip.rst_spec->pin))
+    {
+        return 0;
+    }
+
     ret = gpio_pin_configure_dt(m_chip.rst_spec, GPIO_OUTPUT);
     if (ret)
     {
@@ -685,6 +920,66 @@ static int SI473XGetRDS(
     return ret;
 }
 
+static int SI473XSetSeekThreshold(
+                        tuner_t *in_tuner,
+                        uint8_t in_rssi,
+                        uint8_t in_snr
+                        )
+{
+    int ret = -EINVAL;
+    uint8_t rssi = in_rssi ? in_rssi : m_chip.seek_thr;
+    uint8_t snr = in_snr ? in_snr : m_chip.sksnr;
+
+    require_action(m_chip.state >= TUNER_READY, exit, ret = -EAGAIN);
+
+    ret = si473x_send_prop(&m_chip, FM_SEEK_TUNE_RSSI_THRESHOLD, rssi);
+    require_noerr(ret, exit);
+    ret = si473x_send_prop(&m_chip, FM_SEEK_TUNE_SNR_THRESHOLD, snr);
+    require_noerr(ret, exit);
+
+    LOG_INF("Seek thresholds rssi=%u snr=%u", rssi, snr);
+exit:
+    return ret;
+}
+
+// everything the tuner polls while playing in one RSQ status query.  the
+// channel is only read back when a seek has left it unknown
+//
+static int SI473XGetStatus(
+                        tuner_t *in_tuner,
+                        struct tuner_status *out_status
+                        )
+{
+    int ret = -EINVAL;
+    uint8_t args[1];
+    uint8_t response[8];
+
+    require(out_status, exit);
+    require_action(m_chip.state >= TUNER_READY, exit, ret = -EAGAIN);
+
+    if (!m_chip.freq)
+    {
+        ret = si473x_get_tune_status(&m_chip, false, NULL, NULL, NULL);
+        require_noerr(ret, exit);
+    }
+
+    args[0] = 0;
+    ret = si473x_query(&m_chip, FM_RSQ_STATUS, 1, args, 8, response);
+    require_noerr(ret, exit);
+
+    out_status->freq_kHz = m_chip.freq;
+    out_status->rssi = response[4];
+    out_status->snr = response[5];
+    out_status->stereo = (response[3] & RSQ_PILOT) ? true : false;
+    out_status->afc_railed = (response[2] & RSQ_AFCRL) ? true : false;
+    out_status->rds_ready = (response[0] & STATUS_RDSINT) ? true : false;
+    out_status->rds_changed = false;
+    out_status->rds_short = m_chip.name;
+    out_status->rds_long = m_chip.text;
+exit:
+    return ret;
+}
+
 int SI473XTuneTo(
                         tuner_t *in_tuner,
                         uint32_t freq_kHz
@@ -793,6 +1088,152 @@ exit:
     return ret;
 }
 
+// the band as back to back hardware seeks up, no wrap.  the chip steps and
+// qualifies the channels itself so each station costs one seek and one
+// status read rather than a round trip per channel
+//
+// a seek can take seconds to cross an empty stretch of band, so it is only
+// waited on for what is left of the budget.  One still going is left to
+// run and the next slice picks it up, the cursor handed back is where the
+// scan carries on from so a tune that cancels it loses nothing
+//
+static int SI473XScan(
+                        tuner_t *in_tuner,
+                        uint32_t in_from_kHz,
+                        uint32_t in_budget_ms,
+                        tuner_scan_cb_t in_found,
+                        void *in_ctx,
+                        uint32_t *out_next_kHz
+                )
+{
+    int ret = -EINVAL;
+    int64_t start = k_uptime_get();
+    int32_t wait_ms;
+    uint32_t freq = 0;
+    uint32_t last_freq = 0;
+    uint8_t rssi;
+    bool valid = false;
+    bool band_limit = false;
+    bool seeked;
+    bool done;
+
+    require(in_found, exit);
+    require(out_next_kHz, exit);
+    require_action(m_chip.state >= TUNER_READY, exit, ret = -EAGAIN);
+
+    *out_next_kHz = 0;
+
+    // a seek left from a scan that has since been restarted elsewhere
+    //
+    if (m_chip.seeking && m_chip.seek_next != in_from_kHz)
+    {
+        ret = si473x_seek_cancel(&m_chip);
+        require_noerr(ret, exit);
+    }
+
+    if (in_from_kHz > FREQ_MAX)
+    {
+        ret = 0;
+        goto exit;
+    }
+
+    // every slice gets at least one seek under way, even when the tune to
+    // the start used up the budget, or the scan would never move on
+    //
+    seeked = m_chip.seeking;
+
+    if (!m_chip.seeking)
+    {
+        // a seek up never stops on the channel it starts from, so the
+        // bottom of the band is checked by tuning to it, and a resumed scan
+        // starts from the channel below, which the last one already covered
+        //
+        if (in_from_kHz <= FREQ_MIN)
+        {
+            freq = FREQ_MIN;
+        }
+        else
+        {
+            freq = in_from_kHz - CHANNEL_SPACE;
+        }
+
+        ret = si473x_set_freq(&m_chip, freq);
+        require_noerr(ret, exit);
+
+        ret = si473x_get_seek_status(&m_chip, &freq, &rssi, &valid, &band_limit);
+        require_noerr(ret, exit);
+
+        if (in_from_kHz > FREQ_MIN)
+        {
+            valid = false;
+        }
+    }
+
+    while (true)
+    {
+        if (m_chip.seeking)
+        {
+            wait_ms = MAX_SEEK_TIME;
+            if (in_budget_ms)
+            {
+                wait_ms = (int32_t)in_budget_ms - (int32_t)(k_uptime_get() - start);
+            }
+
+            ret = si473x_poll_stc(&m_chip, wait_ms, &done);
+            require_noerr(ret, exit);
+
+            if (!done)
+            {
+                require_action(in_budget_ms, exit, ret = -ETIMEDOUT);
+
+                *out_next_kHz = m_chip.seek_next;
+                break;
+            }
+
+            m_chip.seeking = false;
+
+            ret = si473x_get_seek_status(&m_chip, &freq, &rssi, &valid, &band_limit);
+            require_noerr(ret, exit);
+        }
+
+        if (valid && freq != last_freq)
+        {
+            last_freq = freq;
+
+            if (in_found(in_ctx, freq, rssi))
+            {
+                *out_next_kHz = freq + CHANNEL_SPACE;
+                break;
+            }
+        }
+
+        if (band_limit || freq >= FREQ_MAX)
+        {
+            break;
+        }
+
+        if (seeked && in_budget_ms && (k_uptime_get() - start) >= in_budget_ms)
+        {
+            *out_next_kHz = freq + CHANNEL_SPACE;
+            break;
+        }
+
+        ret = si473x_seek_start(&m_chip, true, false);
+        require_noerr(ret, exit);
+
+        seeked = true;
+        m_chip.seeking = true;
+        m_chip.seek_next = freq + CHANNEL_SPACE;
+    }
+
+    if (!m_chip.seeking)
+    {
+        si473x_clear_rds(&m_chip);
+    }
+exit:
+    return ret;
+}
+
 int SI473XInit(tuner_t *in_tuner, tuner_seek_threshold_t seek_threshold)
 {
     int ret = -EINVAL;
@@ -857,8 +1298,11 @@ static tuner_t m_si473x =
     .get_tune = SI473XGetTunedFreq,
     .get_rssi = SI473XGetRSSI,
     .get_rds  = SI473XGetRDS,
+    .get_status = SI473XGetStatus,
     .tune     = SI473XTune,
-    .seek     = SI473XSeek
+    .seek     = SI473XSeek,
+    .set_seek_threshold = SI473XSetSeekThreshold,
+    .scan     = SI473XScan
 };
 
 tuner_t *SI473XGetRadio(void)
@@ -3,6 +3,11 @@
 
 // Status
 #define STATUS_CTS  0x80
+#define STATUS_RDSINT 0x04
+
+// FM_RSQ_STATUS response
+#define RSQ_AFCRL   0x02    // byte 2
+#define RSQ_PILOT   0x80    // byte 3
 
 #define POWER_UP_FM 0  // FM
 #define POWER_UP_AM 1  // AM and SSB (if patch applyed)
@@ -168,6 +173,11 @@
 // Digital and Occilator parameters for AM and FM modes See AN332 REV 0.8 UNIVERSAL PROGRAMMING GUIDE - pages 56, 87, 125, 148, 150, 175, 208, 221, 243,
 #define DIGITAL_OUTPUT_FORMAT 0x0102      // Configure digital audio outputs.
 #define DIGITAL_OUTPUT_SAMPLE_RATE 0x0104 // Configure digital audio output sample rate
+#define DIGITAL_OSIZE_16 0x0000           // DIGITAL_OUTPUT_FORMAT: 16 bit samples
+#define DIGITAL_OMONO 0x0004              // DIGITAL_OUTPUT_FORMAT: mono (stereo when clear)
+#define DIGITAL_OMODE_I2S 0x0000          // DIGITAL_OUTPUT_FORMAT: I2S framing
+#define DIGITAL_OMODE_LEFT_JUST 0x0030    // DIGITAL_OUTPUT_FORMAT: left justified framing
+#define DIGITAL_OFALL 0x0080              // DIGITAL_OUTPUT_FORMAT: sample on DCLK falling edge
 #define REFCLK_FREQ 0x0201                // Sets frequency of reference clock in Hz. The range is 31130 to 34406 Hz, or 0 to disable the AFC. Default is 32768 Hz.
 #define REFCLK_PRESCALE 0x0202            // Sets the prescaler value for RCLK input.
 
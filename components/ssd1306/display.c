@@ -12,6 +12,7 @@ LOG_MODULE_REGISTER(display, LOG_LEVEL_INF);
 
 #define DEFAULT_FONT_INDEX  (4)
 #define MAX_FONTS           (5)
+#define MAX_BARS            (16)
 
 static struct display
 {
@@ -23,6 +24,7 @@ static struct display
     uint8_t font;
     uint8_t font_width[MAX_FONTS];
     uint8_t font_height[MAX_FONTS];
+    uint8_t bar_height[MAX_BARS];
 }
 m_chip;
 
@@ -131,6 +133,43 @@ int DisplayText(int x, int y, const char *text)
     return 0;
 }
 
+// bar graph, levels are 0..100 percent of height.  cfb has no way to clear
+// an area so each bar is drawn by inverting only the pixels between its old
+// and new height, which leaves the rest of the screen alone
+//
+int DisplayBars(int x, int y, int bar_width, int height, const uint8_t *levels, int count)
+{
+    int bar_x;
+    int new_height;
+    int old_height;
+
+    if (count > MAX_BARS)
+    {
+        count = MAX_BARS;
+    }
+
+    for (int bar = 0; bar < count; bar++)
+    {
+        bar_x = x + bar * (bar_width + 1);
+        new_height = (levels[bar] > 100 ? 100 : levels[bar]) * height / 100;
+        old_height = m_chip.bar_height[bar];
+
+        if (new_height > old_height)
+        {
+            cfb_invert_area(m_chip.dev, bar_x, y + height - new_height, bar_width, new_height - old_height);
+        }
+        else if (new_height < old_height)
+        {
+            cfb_invert_area(m_chip.dev, bar_x, y + height - old_height, bar_width, old_height - new_height);
+        }
+
+        m_chip.bar_height[bar] = new_height;
+    }
+
+    cfb_framebuffer_finalize(m_chip.dev);
+    return 0;
+}
+
 int DisplayInit(void)
 {
     m_chip.dev = DEVICE_DT_GET(DISPLAY_DRIVER);
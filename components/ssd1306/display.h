@@ -1,8 +1,11 @@
 
 #pragma once
 
+#include <stdint.h>
+
 int DisplaySetFont(int height);
 int DisplayText(int x, int y, const char *text);
+int DisplayBars(int x, int y, int bar_width, int height, const uint8_t *levels, int count);
 int DisplayInit(void);
 
 
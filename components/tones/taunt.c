@@ -1,7607 +1,3871 @@
-unsigned char taunt_wav[] = {
-  0x75, 0x76, 0x76, 0x78, 0x7a, 0x7e, 0x83, 0x87, 0x88, 0x87, 0x84, 0x81,
-  0x80, 0x80, 0x82, 0x82, 0x82, 0x80, 0x7c, 0x79, 0x7a, 0x7e, 0x83, 0x88,
-  0x89, 0x86, 0x82, 0x81, 0x85, 0x8c, 0x90, 0x8e, 0x88, 0x82, 0x7e, 0x7f,
-  0x82, 0x85, 0x85, 0x82, 0x7f, 0x7f, 0x81, 0x83, 0x85, 0x85, 0x84, 0x83,
-  0x82, 0x82, 0x80, 0x7e, 0x7c, 0x7d, 0x7e, 0x7e, 0x7c, 0x7a, 0x77, 0x78,
-  0x7a, 0x7c, 0x7d, 0x7c, 0x7a, 0x78, 0x78, 0x79, 0x7b, 0x7c, 0x7a, 0x78,
-  0x78, 0x78, 0x79, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x84, 0x87, 0x8a, 0x8d,
-  0x8f, 0x8f, 0x8f, 0x8e, 0x8c, 0x8a, 0x88, 0x85, 0x82, 0x80, 0x7e, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e, 0x81, 0x82, 0x85, 0x86, 0x87, 0x86,
-  0x84, 0x81, 0x7d, 0x7a, 0x77, 0x75, 0x73, 0x72, 0x72, 0x71, 0x71, 0x70,
-  0x72, 0x75, 0x7a, 0x7f, 0x83, 0x85, 0x87, 0x88, 0x8a, 0x8b, 0x8c, 0x8d,
-  0x8c, 0x8a, 0x86, 0x83, 0x80, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x79, 0x79, 0x7a, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x80, 0x82, 0x83, 0x85,
-  0x85, 0x84, 0x84, 0x84, 0x86, 0x88, 0x89, 0x8a, 0x8a, 0x89, 0x89, 0x8a,
-  0x88, 0x87, 0x86, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c,
-  0x7d, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x78, 0x79, 0x78, 0x78, 0x78,
-  0x78, 0x79, 0x7a, 0x7c, 0x80, 0x82, 0x85, 0x87, 0x89, 0x8a, 0x8c, 0x8e,
-  0x90, 0x90, 0x91, 0x92, 0x92, 0x92, 0x8f, 0x8b, 0x83, 0x7b, 0x72, 0x6d,
-  0x6b, 0x69, 0x67, 0x66, 0x67, 0x69, 0x6a, 0x6e, 0x72, 0x75, 0x79, 0x7e,
-  0x84, 0x8a, 0x8e, 0x90, 0x90, 0x8f, 0x8c, 0x88, 0x85, 0x83, 0x82, 0x82,
-  0x82, 0x7f, 0x7b, 0x78, 0x75, 0x75, 0x78, 0x7c, 0x80, 0x82, 0x81, 0x7e,
-  0x7a, 0x78, 0x79, 0x7a, 0x7c, 0x7c, 0x7b, 0x78, 0x73, 0x71, 0x72, 0x76,
-  0x7c, 0x82, 0x86, 0x86, 0x85, 0x85, 0x86, 0x8b, 0x91, 0x95, 0x96, 0x92,
-  0x8a, 0x81, 0x7b, 0x79, 0x7b, 0x7f, 0x80, 0x7c, 0x76, 0x73, 0x75, 0x7a,
-  0x82, 0x87, 0x8a, 0x89, 0x86, 0x84, 0x84, 0x86, 0x88, 0x89, 0x88, 0x84,
-  0x80, 0x7c, 0x79, 0x79, 0x7c, 0x7f, 0x7f, 0x7e, 0x7c, 0x7a, 0x78, 0x79,
-  0x7c, 0x7e, 0x7e, 0x7c, 0x78, 0x76, 0x75, 0x76, 0x79, 0x7b, 0x7b, 0x7a,
-  0x7a, 0x7a, 0x7b, 0x7e, 0x81, 0x84, 0x86, 0x86, 0x86, 0x86, 0x84, 0x80,
-  0x7d, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7e, 0x82, 0x86, 0x8a, 0x8b,
-  0x8c, 0x8d, 0x8d, 0x8f, 0x91, 0x91, 0x8e, 0x88, 0x81, 0x7b, 0x76, 0x73,
-  0x72, 0x70, 0x6d, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x72, 0x75, 0x77, 0x7a,
-  0x7b, 0x7c, 0x7c, 0x7b, 0x7c, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x82,
-  0x84, 0x85, 0x86, 0x88, 0x8b, 0x8c, 0x8d, 0x8d, 0x8a, 0x86, 0x83, 0x82,
-  0x80, 0x7d, 0x7a, 0x78, 0x75, 0x74, 0x74, 0x76, 0x78, 0x7b, 0x7e, 0x80,
-  0x82, 0x83, 0x84, 0x85, 0x86, 0x86, 0x86, 0x85, 0x84, 0x82, 0x82, 0x82,
-  0x82, 0x84, 0x85, 0x85, 0x86, 0x87, 0x87, 0x87, 0x88, 0x89, 0x8a, 0x88,
-  0x86, 0x84, 0x82, 0x82, 0x81, 0x81, 0x81, 0x7e, 0x7c, 0x7a, 0x78, 0x78,
-  0x78, 0x78, 0x78, 0x77, 0x75, 0x73, 0x72, 0x72, 0x74, 0x76, 0x79, 0x7a,
-  0x7c, 0x80, 0x85, 0x8b, 0x90, 0x93, 0x92, 0x8f, 0x8c, 0x89, 0x87, 0x86,
-  0x86, 0x85, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 0x87,
-  0x87, 0x86, 0x83, 0x81, 0x7d, 0x78, 0x73, 0x6f, 0x6e, 0x70, 0x74, 0x77,
-  0x78, 0x78, 0x76, 0x76, 0x78, 0x7e, 0x84, 0x88, 0x88, 0x86, 0x80, 0x7a,
-  0x79, 0x7b, 0x7f, 0x83, 0x84, 0x84, 0x82, 0x80, 0x81, 0x84, 0x89, 0x8d,
-  0x90, 0x90, 0x8c, 0x86, 0x82, 0x80, 0x80, 0x81, 0x82, 0x80, 0x7d, 0x78,
-  0x74, 0x71, 0x72, 0x76, 0x7e, 0x85, 0x86, 0x82, 0x7f, 0x7e, 0x82, 0x8a,
-  0x90, 0x93, 0x90, 0x8b, 0x87, 0x87, 0x8a, 0x8d, 0x8e, 0x8e, 0x8c, 0x87,
-  0x82, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7d, 0x79, 0x74, 0x71, 0x72, 0x74,
-  0x78, 0x7a, 0x7a, 0x78, 0x76, 0x76, 0x78, 0x7b, 0x7c, 0x7c, 0x7d, 0x7c,
-  0x7b, 0x7b, 0x7e, 0x83, 0x86, 0x87, 0x83, 0x7a, 0x73, 0x6f, 0x71, 0x78,
-  0x80, 0x86, 0x88, 0x86, 0x84, 0x87, 0x8c, 0x91, 0x96, 0x9a, 0x9c, 0x9a,
-  0x95, 0x91, 0x8c, 0x87, 0x84, 0x82, 0x80, 0x7d, 0x7b, 0x79, 0x79, 0x7a,
-  0x7a, 0x78, 0x75, 0x72, 0x70, 0x70, 0x71, 0x70, 0x6d, 0x67, 0x62, 0x61,
-  0x63, 0x68, 0x70, 0x76, 0x7a, 0x7a, 0x7a, 0x7c, 0x81, 0x88, 0x8e, 0x93,
-  0x94, 0x90, 0x8b, 0x86, 0x86, 0x87, 0x8a, 0x8b, 0x8b, 0x8a, 0x89, 0x89,
-  0x88, 0x87, 0x84, 0x7e, 0x7c, 0x7c, 0x7c, 0x79, 0x74, 0x71, 0x72, 0x76,
-  0x7b, 0x80, 0x82, 0x80, 0x80, 0x82, 0x85, 0x89, 0x8b, 0x8a, 0x88, 0x86,
-  0x84, 0x84, 0x85, 0x85, 0x86, 0x88, 0x88, 0x87, 0x86, 0x84, 0x82, 0x83,
-  0x85, 0x85, 0x84, 0x81, 0x7e, 0x7b, 0x7a, 0x79, 0x78, 0x76, 0x76, 0x76,
-  0x75, 0x74, 0x72, 0x70, 0x71, 0x73, 0x78, 0x7d, 0x7f, 0x7e, 0x7a, 0x76,
-  0x74, 0x73, 0x76, 0x7a, 0x7e, 0x82, 0x87, 0x8b, 0x8d, 0x90, 0x94, 0x97,
-  0x98, 0x98, 0x97, 0x94, 0x90, 0x8e, 0x8c, 0x8a, 0x84, 0x7d, 0x77, 0x73,
-  0x72, 0x74, 0x77, 0x79, 0x79, 0x76, 0x72, 0x6e, 0x6c, 0x6b, 0x6c, 0x6d,
-  0x6e, 0x6d, 0x6a, 0x68, 0x68, 0x6b, 0x70, 0x78, 0x80, 0x84, 0x86, 0x87,
-  0x87, 0x87, 0x88, 0x8a, 0x8c, 0x8e, 0x8e, 0x8c, 0x88, 0x86, 0x85, 0x87,
-  0x8b, 0x8e, 0x90, 0x8c, 0x84, 0x7c, 0x78, 0x7a, 0x7d, 0x80, 0x7d, 0x76,
-  0x70, 0x71, 0x74, 0x79, 0x7f, 0x84, 0x84, 0x83, 0x82, 0x82, 0x83, 0x85,
-  0x86, 0x88, 0x88, 0x86, 0x84, 0x82, 0x82, 0x83, 0x86, 0x87, 0x87, 0x86,
-  0x83, 0x82, 0x82, 0x82, 0x83, 0x83, 0x80, 0x7e, 0x7c, 0x79, 0x78, 0x79,
-  0x7b, 0x7b, 0x7a, 0x79, 0x78, 0x7a, 0x7d, 0x81, 0x82, 0x7c, 0x71, 0x65,
-  0x5f, 0x61, 0x69, 0x75, 0x7e, 0x82, 0x81, 0x80, 0x81, 0x85, 0x8d, 0x96,
-  0x9c, 0x9d, 0x9a, 0x94, 0x8e, 0x89, 0x88, 0x89, 0x8a, 0x8c, 0x8c, 0x8b,
-  0x8a, 0x8a, 0x8b, 0x8b, 0x88, 0x84, 0x7e, 0x7a, 0x78, 0x76, 0x72, 0x6b,
-  0x65, 0x60, 0x60, 0x65, 0x6c, 0x72, 0x73, 0x74, 0x73, 0x72, 0x74, 0x78,
-  0x7d, 0x80, 0x80, 0x7c, 0x78, 0x78, 0x7c, 0x83, 0x89, 0x8d, 0x90, 0x90,
-  0x90, 0x92, 0x93, 0x91, 0x90, 0x8e, 0x8c, 0x8a, 0x88, 0x86, 0x85, 0x85,
-  0x87, 0x8a, 0x8c, 0x8d, 0x8b, 0x88, 0x86, 0x84, 0x82, 0x80, 0x7e, 0x7b,
-  0x78, 0x77, 0x76, 0x76, 0x78, 0x7b, 0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x81, 0x81, 0x81, 0x7f, 0x7e, 0x7f, 0x82, 0x85, 0x87, 0x89, 0x8a,
-  0x8b, 0x8e, 0x90, 0x91, 0x8c, 0x82, 0x73, 0x68, 0x66, 0x6c, 0x76, 0x7e,
-  0x80, 0x7a, 0x73, 0x71, 0x76, 0x81, 0x8c, 0x93, 0x92, 0x8a, 0x7e, 0x77,
-  0x76, 0x7b, 0x82, 0x86, 0x88, 0x86, 0x84, 0x82, 0x84, 0x89, 0x8e, 0x90,
-  0x91, 0x8e, 0x89, 0x82, 0x7b, 0x76, 0x74, 0x75, 0x77, 0x7a, 0x7b, 0x79,
-  0x75, 0x71, 0x72, 0x75, 0x7a, 0x7d, 0x7d, 0x77, 0x6e, 0x68, 0x66, 0x69,
-  0x6e, 0x72, 0x76, 0x76, 0x76, 0x76, 0x79, 0x7e, 0x84, 0x88, 0x8a, 0x89,
-  0x87, 0x86, 0x84, 0x86, 0x89, 0x8c, 0x8d, 0x8c, 0x8a, 0x89, 0x88, 0x89,
-  0x89, 0x88, 0x87, 0x86, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x82, 0x80,
-  0x81, 0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x81, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x84, 0x83, 0x81, 0x7f, 0x7d,
-  0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7e, 0x7d,
-  0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7c, 0x7b,
-  0x7c, 0x7d, 0x7e, 0x80, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x83, 0x82, 0x83,
-  0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7e, 0x7f, 0x7e, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c,
-  0x7d, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83,
-  0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x81, 0x81, 0x82, 0x83, 0x83, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x82, 0x83, 0x85, 0x85, 0x85, 0x83, 0x82, 0x81,
-  0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x82, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e,
-  0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7e, 0x7c, 0x7a, 0x7a, 0x7b, 0x7c, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x7b,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84, 0x84,
-  0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x88, 0x88, 0x88,
-  0x86, 0x86, 0x87, 0x87, 0x88, 0x88, 0x89, 0x87, 0x85, 0x84, 0x84, 0x83,
-  0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7c, 0x7b, 0x79, 0x78, 0x77, 0x78, 0x79, 0x79, 0x77, 0x75, 0x74, 0x74,
-  0x74, 0x75, 0x76, 0x77, 0x77, 0x76, 0x76, 0x77, 0x79, 0x7a, 0x7c, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x80, 0x82, 0x82, 0x82, 0x83, 0x84, 0x85, 0x85, 0x86, 0x87, 0x88,
-  0x8a, 0x8a, 0x89, 0x89, 0x89, 0x88, 0x86, 0x84, 0x85, 0x86, 0x88, 0x89,
-  0x88, 0x87, 0x85, 0x84, 0x84, 0x85, 0x86, 0x86, 0x85, 0x82, 0x82, 0x82,
-  0x83, 0x83, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x82, 0x83, 0x84,
-  0x84, 0x83, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7c, 0x7c, 0x7b, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x77, 0x78,
-  0x79, 0x78, 0x78, 0x78, 0x78, 0x77, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78,
-  0x78, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7c,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x81, 0x81, 0x83, 0x84, 0x84, 0x83, 0x84,
-  0x84, 0x84, 0x85, 0x86, 0x87, 0x88, 0x88, 0x88, 0x88, 0x87, 0x86, 0x84,
-  0x85, 0x87, 0x8a, 0x8b, 0x8a, 0x88, 0x87, 0x87, 0x88, 0x8a, 0x89, 0x88,
-  0x87, 0x86, 0x85, 0x86, 0x87, 0x88, 0x89, 0x89, 0x89, 0x88, 0x86, 0x84,
-  0x83, 0x84, 0x85, 0x86, 0x85, 0x83, 0x81, 0x81, 0x82, 0x83, 0x84, 0x84,
-  0x83, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x78, 0x76,
-  0x74, 0x75, 0x77, 0x77, 0x76, 0x75, 0x73, 0x72, 0x71, 0x72, 0x72, 0x72,
-  0x72, 0x74, 0x73, 0x72, 0x72, 0x73, 0x75, 0x76, 0x77, 0x77, 0x77, 0x77,
-  0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x83,
-  0x84, 0x84, 0x84, 0x85, 0x86, 0x88, 0x8a, 0x8a, 0x89, 0x88, 0x85, 0x84,
-  0x84, 0x86, 0x89, 0x8a, 0x89, 0x88, 0x85, 0x84, 0x85, 0x87, 0x89, 0x89,
-  0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8b, 0x88, 0x85,
-  0x83, 0x85, 0x87, 0x89, 0x8a, 0x88, 0x85, 0x83, 0x84, 0x84, 0x86, 0x86,
-  0x85, 0x83, 0x82, 0x81, 0x7e, 0x7b, 0x7b, 0x7c, 0x7c, 0x7a, 0x77, 0x75,
-  0x74, 0x74, 0x75, 0x76, 0x75, 0x74, 0x72, 0x71, 0x6f, 0x6f, 0x6f, 0x70,
-  0x72, 0x73, 0x72, 0x70, 0x70, 0x71, 0x72, 0x73, 0x74, 0x74, 0x74, 0x73,
-  0x74, 0x74, 0x76, 0x78, 0x7a, 0x7b, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x81,
-  0x84, 0x85, 0x86, 0x85, 0x85, 0x86, 0x87, 0x86, 0x85, 0x84, 0x84, 0x86,
-  0x89, 0x8c, 0x8c, 0x8a, 0x89, 0x89, 0x8b, 0x8c, 0x8c, 0x8b, 0x8b, 0x8c,
-  0x8d, 0x8e, 0x8e, 0x8d, 0x8e, 0x90, 0x92, 0x91, 0x8e, 0x8c, 0x8b, 0x8c,
-  0x8c, 0x8d, 0x8c, 0x8b, 0x89, 0x89, 0x87, 0x86, 0x86, 0x85, 0x84, 0x83,
-  0x83, 0x80, 0x7d, 0x7b, 0x7b, 0x7b, 0x7a, 0x77, 0x74, 0x72, 0x73, 0x74,
-  0x73, 0x73, 0x71, 0x70, 0x6f, 0x6e, 0x6c, 0x6b, 0x6c, 0x6e, 0x70, 0x70,
-  0x6f, 0x6e, 0x6e, 0x6f, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x72, 0x74,
-  0x75, 0x76, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x81, 0x83, 0x85, 0x85,
-  0x85, 0x86, 0x86, 0x85, 0x84, 0x84, 0x86, 0x88, 0x8c, 0x8d, 0x8b, 0x89,
-  0x88, 0x8a, 0x8d, 0x8f, 0x90, 0x8e, 0x8d, 0x8c, 0x8d, 0x8e, 0x8e, 0x8f,
-  0x90, 0x92, 0x92, 0x91, 0x8e, 0x8c, 0x8c, 0x8d, 0x8f, 0x8f, 0x8e, 0x8c,
-  0x8b, 0x8a, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x89, 0x86, 0x83, 0x81, 0x80,
-  0x81, 0x80, 0x7e, 0x7a, 0x77, 0x75, 0x74, 0x74, 0x74, 0x72, 0x70, 0x70,
-  0x70, 0x6e, 0x6d, 0x6c, 0x6d, 0x6e, 0x6f, 0x6f, 0x6e, 0x6d, 0x6d, 0x6e,
-  0x6f, 0x70, 0x6e, 0x6e, 0x6e, 0x70, 0x72, 0x72, 0x73, 0x76, 0x77, 0x78,
-  0x79, 0x79, 0x7b, 0x7d, 0x80, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81,
-  0x82, 0x85, 0x88, 0x8a, 0x89, 0x87, 0x86, 0x87, 0x8a, 0x8c, 0x8c, 0x8c,
-  0x8b, 0x8b, 0x8a, 0x8c, 0x8f, 0x91, 0x93, 0x95, 0x94, 0x93, 0x91, 0x8f,
-  0x90, 0x92, 0x93, 0x94, 0x92, 0x90, 0x8e, 0x8e, 0x90, 0x91, 0x91, 0x8f,
-  0x8e, 0x8d, 0x8b, 0x8a, 0x88, 0x88, 0x87, 0x84, 0x82, 0x7e, 0x7b, 0x79,
-  0x79, 0x7a, 0x79, 0x77, 0x74, 0x72, 0x70, 0x6e, 0x6b, 0x6b, 0x6b, 0x6b,
-  0x6c, 0x6c, 0x6a, 0x69, 0x6b, 0x6c, 0x6c, 0x6b, 0x6a, 0x6a, 0x6b, 0x6d,
-  0x6e, 0x6e, 0x70, 0x72, 0x72, 0x73, 0x75, 0x76, 0x77, 0x79, 0x7c, 0x7e,
-  0x7e, 0x7e, 0x7c, 0x7b, 0x7d, 0x80, 0x83, 0x87, 0x89, 0x89, 0x88, 0x87,
-  0x87, 0x89, 0x8b, 0x8c, 0x8d, 0x8d, 0x8c, 0x8c, 0x8d, 0x8f, 0x93, 0x96,
-  0x98, 0x98, 0x96, 0x94, 0x95, 0x96, 0x97, 0x99, 0x98, 0x97, 0x95, 0x94,
-  0x95, 0x95, 0x95, 0x95, 0x94, 0x92, 0x8e, 0x8a, 0x89, 0x88, 0x87, 0x86,
-  0x85, 0x82, 0x7f, 0x7c, 0x7b, 0x7b, 0x7b, 0x7a, 0x77, 0x73, 0x70, 0x6d,
-  0x6a, 0x6a, 0x6a, 0x6b, 0x6c, 0x6b, 0x69, 0x68, 0x69, 0x6a, 0x69, 0x68,
-  0x66, 0x66, 0x68, 0x69, 0x6a, 0x6c, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x71,
-  0x74, 0x76, 0x79, 0x7a, 0x79, 0x77, 0x74, 0x74, 0x77, 0x7c, 0x82, 0x84,
-  0x84, 0x83, 0x82, 0x82, 0x84, 0x87, 0x89, 0x8a, 0x8a, 0x89, 0x88, 0x89,
-  0x8c, 0x90, 0x95, 0x98, 0x98, 0x96, 0x93, 0x92, 0x93, 0x94, 0x96, 0x97,
-  0x97, 0x96, 0x94, 0x94, 0x94, 0x95, 0x96, 0x96, 0x96, 0x92, 0x8d, 0x8a,
-  0x88, 0x89, 0x89, 0x87, 0x85, 0x81, 0x7e, 0x7c, 0x7c, 0x7c, 0x7a, 0x79,
-  0x75, 0x72, 0x71, 0x6f, 0x6e, 0x6f, 0x6f, 0x6d, 0x6a, 0x69, 0x69, 0x69,
-  0x69, 0x69, 0x67, 0x66, 0x64, 0x64, 0x64, 0x65, 0x67, 0x68, 0x68, 0x69,
-  0x6c, 0x6e, 0x6f, 0x70, 0x71, 0x71, 0x70, 0x6f, 0x70, 0x73, 0x77, 0x7a,
-  0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7e, 0x80, 0x82, 0x85, 0x88, 0x89, 0x89,
-  0x8a, 0x8d, 0x90, 0x94, 0x97, 0x98, 0x97, 0x96, 0x96, 0x95, 0x97, 0x99,
-  0x9a, 0x99, 0x99, 0x99, 0x9a, 0x9a, 0x9a, 0x9c, 0x9c, 0x9b, 0x98, 0x95,
-  0x91, 0x8f, 0x8e, 0x8e, 0x8c, 0x8b, 0x88, 0x85, 0x82, 0x80, 0x7e, 0x7c,
-  0x7a, 0x77, 0x74, 0x72, 0x70, 0x70, 0x6f, 0x6f, 0x6f, 0x6e, 0x6c, 0x6b,
-  0x6b, 0x6a, 0x69, 0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x69, 0x6b, 0x6d,
-  0x6e, 0x6d, 0x6d, 0x6e, 0x6f, 0x6f, 0x6e, 0x6f, 0x71, 0x74, 0x77, 0x79,
-  0x79, 0x7a, 0x7b, 0x7d, 0x7f, 0x80, 0x81, 0x82, 0x84, 0x85, 0x87, 0x8a,
-  0x8c, 0x8e, 0x91, 0x93, 0x94, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96,
-  0x96, 0x96, 0x97, 0x98, 0x98, 0x98, 0x99, 0x9a, 0x9a, 0x99, 0x99, 0x97,
-  0x93, 0x91, 0x8f, 0x8f, 0x8e, 0x8b, 0x88, 0x86, 0x83, 0x82, 0x81, 0x7e,
-  0x7c, 0x7a, 0x77, 0x75, 0x74, 0x73, 0x73, 0x73, 0x72, 0x70, 0x6f, 0x6e,
-  0x6d, 0x6c, 0x6a, 0x68, 0x68, 0x68, 0x68, 0x69, 0x6a, 0x6b, 0x6d, 0x6c,
-  0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x6b, 0x6b, 0x6e, 0x72, 0x75, 0x76, 0x76,
-  0x76, 0x78, 0x7b, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x84, 0x86, 0x88, 0x8b,
-  0x8e, 0x91, 0x92, 0x92, 0x93, 0x93, 0x94, 0x95, 0x96, 0x96, 0x98, 0x99,
-  0x98, 0x99, 0x9b, 0x9c, 0x9c, 0x9b, 0x9b, 0x9b, 0x99, 0x96, 0x94, 0x94,
-  0x92, 0x91, 0x8f, 0x8c, 0x8a, 0x88, 0x86, 0x86, 0x84, 0x82, 0x7f, 0x7c,
-  0x79, 0x78, 0x77, 0x76, 0x75, 0x74, 0x73, 0x72, 0x6f, 0x6d, 0x6c, 0x6b,
-  0x68, 0x67, 0x66, 0x66, 0x65, 0x67, 0x6a, 0x6c, 0x6c, 0x6a, 0x66, 0x64,
-  0x65, 0x68, 0x6b, 0x6b, 0x6d, 0x70, 0x72, 0x73, 0x74, 0x74, 0x75, 0x77,
-  0x7a, 0x7b, 0x7c, 0x7c, 0x7e, 0x82, 0x85, 0x86, 0x89, 0x8d, 0x91, 0x94,
-  0x95, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x99, 0x9a, 0x9b, 0x9e, 0xa0,
-  0xa1, 0xa2, 0xa2, 0xa1, 0x9f, 0x9d, 0x9b, 0x99, 0x97, 0x96, 0x96, 0x95,
-  0x92, 0x8d, 0x8a, 0x87, 0x86, 0x83, 0x82, 0x82, 0x81, 0x7e, 0x7a, 0x78,
-  0x77, 0x77, 0x76, 0x74, 0x73, 0x70, 0x6c, 0x69, 0x66, 0x65, 0x65, 0x66,
-  0x68, 0x6a, 0x6f, 0x72, 0x70, 0x65, 0x57, 0x50, 0x54, 0x60, 0x6a, 0x6a,
-  0x64, 0x5e, 0x5f, 0x66, 0x71, 0x78, 0x78, 0x73, 0x6c, 0x67, 0x6b, 0x74,
-  0x7c, 0x83, 0x88, 0x8b, 0x8c, 0x8c, 0x8d, 0x8f, 0x93, 0x99, 0x9b, 0x99,
-  0x92, 0x8c, 0x8a, 0x90, 0x9d, 0xab, 0xb0, 0xad, 0xa6, 0xa0, 0x9e, 0xa0,
-  0xa3, 0xa4, 0xa2, 0x9d, 0x98, 0x97, 0x9c, 0xa1, 0xa1, 0x99, 0x89, 0x7a,
-  0x76, 0x77, 0x7b, 0x7c, 0x79, 0x75, 0x72, 0x71, 0x72, 0x72, 0x71, 0x6e,
-  0x68, 0x61, 0x5c, 0x5c, 0x5f, 0x64, 0x6c, 0x75, 0x7c, 0x80, 0x79, 0x61,
-  0x43, 0x2f, 0x2d, 0x43, 0x66, 0x77, 0x6a, 0x4e, 0x43, 0x56, 0x7b, 0x99,
-  0x9a, 0x81, 0x63, 0x54, 0x5e, 0x7e, 0x9e, 0xad, 0xb8, 0xbf, 0xbe, 0xb8,
-  0xb4, 0xb3, 0xb8, 0xbc, 0xb7, 0xa7, 0x93, 0x86, 0x8a, 0x9e, 0xb3, 0xba,
-  0xaf, 0x94, 0x7b, 0x6f, 0x6b, 0x6b, 0x6b, 0x6a, 0x64, 0x5c, 0x58, 0x5d,
-  0x6c, 0x7c, 0x80, 0x73, 0x5f, 0x54, 0x59, 0x6b, 0x7f, 0x8c, 0x8f, 0x8b,
-  0x88, 0x8c, 0x95, 0x9b, 0x9a, 0x92, 0x84, 0x77, 0x72, 0x78, 0x83, 0x8e,
-  0x96, 0x98, 0x9a, 0x97, 0x83, 0x5b, 0x2f, 0x12, 0x0f, 0x2e, 0x58, 0x71,
-  0x6b, 0x53, 0x4a, 0x5e, 0x84, 0xa1, 0x9f, 0x7f, 0x5c, 0x55, 0x73, 0x98,
-  0xa9, 0xc0, 0xe1, 0xec, 0xda, 0xc9, 0xbd, 0xb0, 0xab, 0xa7, 0x9c, 0x86,
-  0x70, 0x6b, 0x7e, 0x9c, 0xb0, 0xa8, 0x83, 0x54, 0x32, 0x29, 0x31, 0x3f,
-  0x4a, 0x50, 0x55, 0x5a, 0x66, 0x76, 0x86, 0x8c, 0x7e, 0x63, 0x4d, 0x4f,
-  0x6d, 0x97, 0xb9, 0xc4, 0xbc, 0xaa, 0x9c, 0x9a, 0x9b, 0x97, 0x8b, 0x7a,
-  0x6c, 0x69, 0x75, 0x8c, 0xa6, 0xb8, 0xac, 0x79, 0x39, 0x09, 0x00, 0x01,
-  0x38, 0x76, 0x88, 0x6d, 0x46, 0x43, 0x6f, 0xac, 0xcc, 0xbf, 0x8f, 0x5c,
-  0x51, 0x76, 0xa6, 0xc4, 0xeb, 0xff, 0xf9, 0xd5, 0xba, 0xa6, 0x9e, 0x9b,
-  0x91, 0x7a, 0x5c, 0x45, 0x4a, 0x6a, 0x92, 0xa6, 0x96, 0x67, 0x38, 0x20,
-  0x26, 0x3b, 0x50, 0x5f, 0x6a, 0x73, 0x80, 0x92, 0xa4, 0xae, 0xa4, 0x82,
-  0x58, 0x47, 0x5b, 0x85, 0xaa, 0xbb, 0xb2, 0x9c, 0x8c, 0x88, 0x8c, 0x8d,
-  0x84, 0x79, 0x73, 0x74, 0x7c, 0x8c, 0xa2, 0xac, 0x95, 0x59, 0x1a, 0x00,
-  0x00, 0x31, 0x6d, 0x8b, 0x71, 0x43, 0x3e, 0x6e, 0xaf, 0xd8, 0xd2, 0xa2,
-  0x6e, 0x5d, 0x78, 0xad, 0xde, 0xf6, 0xf9, 0xeb, 0xd4, 0xc1, 0xb4, 0xa7,
-  0x98, 0x88, 0x76, 0x62, 0x4c, 0x40, 0x4b, 0x69, 0x8a, 0x94, 0x7c, 0x4d,
-  0x2a, 0x2d, 0x48, 0x61, 0x6d, 0x6e, 0x6f, 0x7b, 0x8e, 0xa1, 0xaf, 0xb0,
-  0xa0, 0x88, 0x72, 0x6e, 0x7d, 0x97, 0xac, 0xae, 0x9b, 0x84, 0x7a, 0x7e,
-  0x86, 0x86, 0x7a, 0x65, 0x53, 0x50, 0x64, 0x87, 0xa9, 0xaf, 0x83, 0x39,
-  0x00, 0x00, 0x00, 0x2d, 0x71, 0x9d, 0xa0, 0x76, 0x59, 0x70, 0xa2, 0xce,
-  0xde, 0xc0, 0x86, 0x5d, 0x66, 0x99, 0xd5, 0xff, 0xff, 0xf3, 0xca, 0x9e,
-  0x7f, 0x6b, 0x60, 0x5c, 0x59, 0x52, 0x49, 0x46, 0x53, 0x71, 0x8e, 0x98,
-  0x82, 0x5b, 0x42, 0x48, 0x64, 0x82, 0x96, 0xa2, 0xa6, 0xa6, 0xa6, 0xa5,
-  0xa1, 0x97, 0x81, 0x64, 0x4f, 0x55, 0x70, 0x90, 0xa6, 0xa4, 0x8c, 0x75,
-  0x6d, 0x6f, 0x73, 0x77, 0x7e, 0x83, 0x87, 0x8e, 0x9e, 0xb4, 0xbb, 0x9b,
-  0x57, 0x15, 0x00, 0x00, 0x15, 0x58, 0x8d, 0x96, 0x70, 0x4e, 0x62, 0x99,
-  0xc9, 0xd8, 0xb7, 0x79, 0x51, 0x5e, 0x94, 0xd1, 0xfc, 0xff, 0xf6, 0xd0,
-  0xa9, 0x8b, 0x74, 0x64, 0x58, 0x4f, 0x44, 0x3a, 0x3c, 0x4e, 0x71, 0x95,
-  0xa2, 0x8c, 0x61, 0x41, 0x40, 0x57, 0x75, 0x93, 0xa7, 0xaf, 0xb2, 0xb0,
-  0xab, 0xa5, 0x98, 0x82, 0x66, 0x54, 0x58, 0x71, 0x8e, 0xa4, 0xa4, 0x8f,
-  0x76, 0x6b, 0x72, 0x80, 0x88, 0x87, 0x86, 0x8f, 0x9c, 0x98, 0x6f, 0x2f,
-  0x00, 0x00, 0x00, 0x3b, 0x86, 0xa7, 0x8b, 0x52, 0x47, 0x7e, 0xc7, 0xf2,
-  0xe6, 0xab, 0x6c, 0x5f, 0x8c, 0xc8, 0xf1, 0xfe, 0xee, 0xca, 0xa2, 0x82,
-  0x6a, 0x5d, 0x56, 0x53, 0x4e, 0x44, 0x3b, 0x3f, 0x58, 0x7b, 0x95, 0x96,
-  0x7e, 0x63, 0x5c, 0x69, 0x7f, 0x98, 0xae, 0xb9, 0xb7, 0xa9, 0x98, 0x8e,
-  0x87, 0x7c, 0x6a, 0x55, 0x4f, 0x5f, 0x7a, 0x94, 0x9e, 0x95, 0x80, 0x6e,
-  0x68, 0x6c, 0x70, 0x6e, 0x69, 0x68, 0x70, 0x88, 0xa7, 0xc4, 0xcd, 0xab,
-  0x67, 0x25, 0x00, 0x00, 0x16, 0x52, 0x8e, 0xb9, 0xcb, 0xb9, 0x9d, 0x93,
-  0x9d, 0xac, 0xb1, 0xa8, 0x93, 0x80, 0x7b, 0x8a, 0xa5, 0xc1, 0xd5, 0xd6,
-  0xbe, 0x90, 0x5d, 0x32, 0x1c, 0x1e, 0x37, 0x59, 0x7a, 0x90, 0x98, 0x94,
-  0x8f, 0x90, 0x95, 0x96, 0x88, 0x74, 0x6a, 0x75, 0x8e, 0xa8, 0xb8, 0xb4,
-  0x9e, 0x81, 0x66, 0x54, 0x51, 0x5a, 0x63, 0x6b, 0x72, 0x7a, 0x83, 0x8f,
-  0x99, 0x9a, 0x94, 0x8b, 0x84, 0x7e, 0x7e, 0x83, 0x8e, 0x9e, 0xaf, 0xb8,
-  0xa6, 0x72, 0x32, 0x04, 0x00, 0x0a, 0x3c, 0x7d, 0xaf, 0xbe, 0xa7, 0x87,
-  0x84, 0xa1, 0xc6, 0xdc, 0xd6, 0xb3, 0x86, 0x70, 0x7e, 0xa3, 0xc9, 0xde,
-  0xd7, 0xb0, 0x7c, 0x4f, 0x31, 0x28, 0x36, 0x50, 0x68, 0x76, 0x78, 0x7a,
-  0x86, 0xa0, 0xba, 0xc6, 0xb3, 0x8c, 0x6a, 0x63, 0x7b, 0x99, 0xac, 0xab,
-  0x96, 0x78, 0x65, 0x62, 0x68, 0x6f, 0x76, 0x7c, 0x82, 0x87, 0x8c, 0x8e,
-  0x8e, 0x8e, 0x91, 0x92, 0x8f, 0x89, 0x84, 0x83, 0x86, 0x8a, 0x93, 0x97,
-  0x84, 0x53, 0x17, 0x00, 0x00, 0x02, 0x3c, 0x76, 0xa9, 0xbd, 0x94, 0x6e,
-  0x83, 0xba, 0xe9, 0xf6, 0xd7, 0x9d, 0x6c, 0x62, 0x81, 0xad, 0xca, 0xce,
-  0xb3, 0x88, 0x5f, 0x40, 0x2d, 0x2a, 0x34, 0x46, 0x5a, 0x68, 0x70, 0x7a,
-  0x8e, 0xaa, 0xc4, 0xcd, 0xbc, 0x9a, 0x78, 0x67, 0x6f, 0x84, 0x97, 0x9b,
-  0x8e, 0x77, 0x61, 0x56, 0x54, 0x55, 0x56, 0x57, 0x5e, 0x71, 0x8a, 0xa0,
-  0xaa, 0xa4, 0x9b, 0x93, 0x8c, 0x83, 0x7a, 0x7b, 0x8c, 0xa3, 0xb0, 0x9a,
-  0x5e, 0x1a, 0x00, 0x00, 0x00, 0x2e, 0x6b, 0xa3, 0xc8, 0xa9, 0x6c, 0x6a,
-  0xa1, 0xdc, 0xf3, 0xd8, 0x96, 0x55, 0x3d, 0x59, 0x94, 0xc7, 0xd4, 0xb0,
-  0x72, 0x3e, 0x21, 0x1a, 0x26, 0x3b, 0x4f, 0x64, 0x7e, 0x9f, 0xc3, 0xdf,
-  0xe7, 0xd6, 0xae, 0x84, 0x6e, 0x70, 0x80, 0x8d, 0x92, 0x8d, 0x7f, 0x70,
-  0x64, 0x5d, 0x56, 0x4e, 0x46, 0x46, 0x51, 0x68, 0x88, 0xa9, 0xc1, 0xc9,
-  0xc1, 0xad, 0x93, 0x80, 0x76, 0x78, 0x82, 0x8d, 0x8f, 0x7e, 0x55, 0x21,
-  0x00, 0x05, 0x34, 0x7a, 0xb8, 0xce, 0xae, 0x70, 0x42, 0x46, 0x77, 0xb5,
-  0xe6, 0xfa, 0xe5, 0xb0, 0x78, 0x61, 0x70, 0x96, 0xb2, 0xb2, 0x92, 0x5c,
-  0x31, 0x27, 0x3b, 0x5c, 0x7d, 0x94, 0x9a, 0x94, 0x8c, 0x87, 0x81, 0x75,
-  0x6e, 0x73, 0x81, 0x91, 0x9e, 0xa4, 0xa4, 0xa0, 0x96, 0x86, 0x73, 0x63,
-  0x5b, 0x5c, 0x66, 0x71, 0x7c, 0x85, 0x8e, 0x97, 0x9b, 0x98, 0x8c, 0x7a,
-  0x68, 0x5e, 0x5c, 0x64, 0x6e, 0x78, 0x85, 0x94, 0xa2, 0xa2, 0x84, 0x52,
-  0x23, 0x0c, 0x13, 0x37, 0x6a, 0x99, 0xc8, 0xee, 0xf6, 0xe7, 0xcd, 0xb1,
-  0x9d, 0x93, 0x8e, 0x8a, 0x82, 0x78, 0x6d, 0x64, 0x64, 0x71, 0x85, 0x97,
-  0x9f, 0x95, 0x77, 0x56, 0x45, 0x51, 0x6f, 0x93, 0xb4, 0xc6, 0xc4, 0xba,
-  0xb0, 0xa5, 0x95, 0x81, 0x6c, 0x5d, 0x5a, 0x60, 0x6d, 0x7a, 0x85, 0x89,
-  0x86, 0x81, 0x7c, 0x78, 0x74, 0x73, 0x76, 0x7d, 0x8a, 0x96, 0x9e, 0x9f,
-  0x97, 0x87, 0x74, 0x66, 0x62, 0x68, 0x78, 0x92, 0xae, 0xc0, 0xad, 0x6f,
-  0x29, 0x00, 0x00, 0x1e, 0x5a, 0x92, 0xc0, 0xce, 0xae, 0x90, 0x98, 0xbb,
-  0xde, 0xea, 0xd3, 0x9f, 0x66, 0x41, 0x3a, 0x52, 0x78, 0x9b, 0xb0, 0xad,
-  0x91, 0x68, 0x46, 0x39, 0x46, 0x63, 0x84, 0x9d, 0xab, 0xac, 0xa6, 0xa6,
-  0xaa, 0xa6, 0x98, 0x82, 0x69, 0x59, 0x56, 0x5f, 0x6e, 0x7c, 0x87, 0x8c,
-  0x8c, 0x8d, 0x90, 0x92, 0x93, 0x92, 0x8e, 0x88, 0x80, 0x7c, 0x7d, 0x81,
-  0x86, 0x87, 0x86, 0x86, 0x8a, 0x90, 0x92, 0x84, 0x5e, 0x29, 0x00, 0x00,
-  0x00, 0x22, 0x55, 0x81, 0xb2, 0xc7, 0xa5, 0x99, 0xc2, 0xf0, 0xfe, 0xde,
-  0x9d, 0x5d, 0x3a, 0x3a, 0x57, 0x77, 0x88, 0x8a, 0x81, 0x74, 0x64, 0x54,
-  0x4c, 0x56, 0x6e, 0x84, 0x8e, 0x8f, 0x98, 0xb4, 0xd8, 0xec, 0xe1, 0xb9,
-  0x85, 0x5b, 0x42, 0x3e, 0x4b, 0x5b, 0x66, 0x6a, 0x69, 0x6d, 0x77, 0x82,
-  0x89, 0x8e, 0x92, 0x96, 0x98, 0x94, 0x8a, 0x7a, 0x68, 0x5d, 0x5e, 0x65,
-  0x6a, 0x66, 0x5d, 0x5b, 0x6d, 0x8d, 0xa7, 0xa2, 0x73, 0x33, 0x05, 0x00,
-  0x0e, 0x3d, 0x70, 0x9e, 0xcb, 0xe6, 0xe7, 0xd9, 0xc0, 0xa5, 0x8a, 0x74,
-  0x65, 0x5b, 0x52, 0x4b, 0x48, 0x4d, 0x5c, 0x76, 0x95, 0xb0, 0xb8, 0xa4,
-  0x7e, 0x59, 0x4c, 0x5e, 0x81, 0xa2, 0xb5, 0xb7, 0xac, 0x9f, 0x97, 0x8f,
-  0x84, 0x73, 0x62, 0x58, 0x56, 0x5c, 0x68, 0x78, 0x8a, 0x99, 0xa0, 0xa0,
-  0x99, 0x8d, 0x7e, 0x6e, 0x62, 0x5e, 0x60, 0x67, 0x75, 0x83, 0x89, 0x8a,
-  0x84, 0x7a, 0x72, 0x6d, 0x6c, 0x74, 0x84, 0x94, 0x93, 0x76, 0x45, 0x1b,
-  0x0d, 0x1d, 0x43, 0x75, 0xa2, 0xc6, 0xde, 0xe5, 0xdd, 0xc8, 0xaa, 0x91,
-  0x81, 0x7a, 0x78, 0x75, 0x6b, 0x5e, 0x54, 0x55, 0x66, 0x81, 0x9a, 0xa9,
-  0xa6, 0x8f, 0x6c, 0x53, 0x4f, 0x62, 0x84, 0xa5, 0xb9, 0xb8, 0xa7, 0x92,
-  0x84, 0x7c, 0x74, 0x67, 0x5a, 0x52, 0x53, 0x60, 0x73, 0x88, 0x98, 0xa1,
-  0xa2, 0xa0, 0x9d, 0x98, 0x8e, 0x7e, 0x6c, 0x61, 0x62, 0x6c, 0x79, 0x85,
-  0x8b, 0x88, 0x7c, 0x6c, 0x62, 0x60, 0x6c, 0x83, 0x98, 0x9a, 0x7a, 0x44,
-  0x15, 0x06, 0x1a, 0x46, 0x76, 0xa2, 0xcb, 0xdf, 0xde, 0xd5, 0xc8, 0xbb,
-  0xaf, 0xa2, 0x90, 0x7a, 0x65, 0x51, 0x44, 0x43, 0x51, 0x6b, 0x8a, 0xa5,
-  0xb3, 0xac, 0x92, 0x78, 0x69, 0x6d, 0x80, 0x99, 0xac, 0xae, 0xa1, 0x8f,
-  0x85, 0x84, 0x85, 0x7f, 0x6f, 0x5d, 0x51, 0x53, 0x61, 0x76, 0x8c, 0x9c,
-  0xa4, 0xa5, 0xa3, 0x9f, 0x9b, 0x96, 0x8d, 0x81, 0x74, 0x6b, 0x69, 0x6c,
-  0x74, 0x77, 0x75, 0x70, 0x6b, 0x6e, 0x7e, 0x99, 0xb5, 0xc2, 0xab, 0x6f,
-  0x30, 0x07, 0x00, 0x1c, 0x51, 0x84, 0xb6, 0xe6, 0xe7, 0xc0, 0xa0, 0x99,
-  0xab, 0xc0, 0xc0, 0xa0, 0x6c, 0x3d, 0x20, 0x1e, 0x37, 0x62, 0x96, 0xc2,
-  0xd5, 0xc6, 0x9d, 0x71, 0x5a, 0x63, 0x7e, 0x92, 0x95, 0x8c, 0x86, 0x8d,
-  0xa4, 0xb8, 0xbc, 0xa7, 0x82, 0x5f, 0x50, 0x57, 0x6b, 0x80, 0x8f, 0x96,
-  0x99, 0x9b, 0x9b, 0x98, 0x92, 0x88, 0x7d, 0x76, 0x73, 0x72, 0x76, 0x7d,
-  0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x82, 0x8d, 0x97, 0x95, 0x7d, 0x54, 0x2a,
-  0x14, 0x1c, 0x42, 0x78, 0xad, 0xce, 0xd6, 0xc5, 0xae, 0xa4, 0xac, 0xba,
-  0xbe, 0xae, 0x90, 0x6b, 0x50, 0x45, 0x48, 0x57, 0x6e, 0x89, 0xa1, 0xaf,
-  0xae, 0x9e, 0x88, 0x78, 0x73, 0x7b, 0x8a, 0x96, 0x9b, 0x99, 0x8e, 0x7d,
-  0x72, 0x6c, 0x6e, 0x72, 0x74, 0x73, 0x74, 0x78, 0x81, 0x8c, 0x96, 0x9c,
-  0x9e, 0x9b, 0x96, 0x92, 0x8c, 0x84, 0x7a, 0x70, 0x68, 0x66, 0x6e, 0x78,
-  0x7f, 0x7f, 0x76, 0x68, 0x5f, 0x60, 0x68, 0x77, 0x8c, 0xa1, 0xae, 0xab,
-  0x94, 0x70, 0x4b, 0x30, 0x2a, 0x3b, 0x60, 0x8f, 0xba, 0xd8, 0xe4, 0xda,
-  0xbe, 0x9c, 0x82, 0x78, 0x79, 0x7d, 0x7e, 0x78, 0x6c, 0x5e, 0x57, 0x5a,
-  0x69, 0x83, 0x9f, 0xb5, 0xbb, 0xac, 0x8c, 0x69, 0x57, 0x59, 0x6b, 0x80,
-  0x8e, 0x8e, 0x86, 0x80, 0x80, 0x88, 0x90, 0x90, 0x87, 0x7a, 0x71, 0x6e,
-  0x74, 0x80, 0x8a, 0x90, 0x90, 0x8b, 0x81, 0x76, 0x6d, 0x6a, 0x6d, 0x75,
-  0x7c, 0x81, 0x82, 0x7e, 0x79, 0x76, 0x76, 0x79, 0x7f, 0x88, 0x93, 0x98,
-  0x8e, 0x70, 0x47, 0x24, 0x15, 0x22, 0x42, 0x6d, 0x94, 0xad, 0xb1, 0xac,
-  0xae, 0xb8, 0xc5, 0xcd, 0xc5, 0xab, 0x86, 0x63, 0x4a, 0x3d, 0x3e, 0x4a,
-  0x5d, 0x76, 0x8e, 0x9d, 0x9d, 0x93, 0x87, 0x7e, 0x80, 0x86, 0x8b, 0x8a,
-  0x86, 0x80, 0x7c, 0x7a, 0x77, 0x74, 0x6e, 0x67, 0x61, 0x5f, 0x62, 0x69,
-  0x74, 0x83, 0x8f, 0x98, 0x9c, 0x9c, 0x99, 0x94, 0x8d, 0x80, 0x71, 0x61,
-  0x56, 0x56, 0x60, 0x6e, 0x7a, 0x83, 0x86, 0x8b, 0x95, 0xa4, 0xad, 0x9f,
-  0x73, 0x39, 0x0e, 0x00, 0x03, 0x25, 0x54, 0x7c, 0xa8, 0xc3, 0xb2, 0xa4,
-  0xbc, 0xdf, 0xf1, 0xe2, 0xb0, 0x76, 0x48, 0x28, 0x1b, 0x20, 0x31, 0x4a,
-  0x68, 0x85, 0x9a, 0xa5, 0xa6, 0xa7, 0xae, 0xb4, 0xb0, 0x98, 0x72, 0x57,
-  0x56, 0x6c, 0x86, 0x94, 0x8f, 0x79, 0x61, 0x58, 0x60, 0x70, 0x7c, 0x80,
-  0x7e, 0x7e, 0x84, 0x8d, 0x96, 0x9a, 0x97, 0x8c, 0x7d, 0x6c, 0x60, 0x5b,
-  0x5f, 0x6b, 0x76, 0x7c, 0x7e, 0x78, 0x71, 0x6d, 0x6d, 0x74, 0x80, 0x8c,
-  0x93, 0x8e, 0x80, 0x6e, 0x5e, 0x56, 0x56, 0x5c, 0x6a, 0x7e, 0x93, 0xa6,
-  0xb5, 0xbb, 0xb2, 0xa1, 0x8e, 0x80, 0x79, 0x76, 0x75, 0x73, 0x6f, 0x6a,
-  0x65, 0x65, 0x6c, 0x79, 0x89, 0x96, 0x9b, 0x95, 0x86, 0x75, 0x69, 0x66,
-  0x6a, 0x74, 0x7e, 0x84, 0x87, 0x87, 0x88, 0x8a, 0x8c, 0x8c, 0x8a, 0x85,
-  0x7d, 0x77, 0x74, 0x77, 0x7d, 0x83, 0x87, 0x84, 0x7a, 0x6e, 0x66, 0x67,
-  0x70, 0x7b, 0x83, 0x84, 0x80, 0x7b, 0x7c, 0x87, 0x94, 0x9c, 0x99, 0x91,
-  0x88, 0x80, 0x73, 0x61, 0x4a, 0x32, 0x26, 0x2a, 0x3c, 0x58, 0x77, 0x96,
-  0xad, 0xbe, 0xce, 0xd8, 0xda, 0xd3, 0xc1, 0xa8, 0x8e, 0x74, 0x5c, 0x49,
-  0x3e, 0x3c, 0x46, 0x58, 0x70, 0x88, 0x9e, 0xaa, 0xae, 0xa9, 0xa2, 0x9b,
-  0x94, 0x8e, 0x89, 0x85, 0x80, 0x77, 0x6b, 0x62, 0x60, 0x61, 0x62, 0x65,
-  0x68, 0x6d, 0x76, 0x83, 0x90, 0x9c, 0xa2, 0xa4, 0xa2, 0x9b, 0x90, 0x83,
-  0x76, 0x6a, 0x65, 0x66, 0x6a, 0x70, 0x76, 0x7c, 0x80, 0x84, 0x86, 0x8c,
-  0x95, 0x9f, 0x9f, 0x86, 0x56, 0x27, 0x0a, 0x08, 0x22, 0x50, 0x7c, 0xa4,
-  0xc1, 0xbe, 0xb0, 0xb5, 0xcd, 0xe5, 0xe8, 0xca, 0x96, 0x62, 0x3d, 0x28,
-  0x23, 0x30, 0x4a, 0x68, 0x86, 0x9c, 0xa7, 0xab, 0xad, 0xaf, 0xb0, 0xa9,
-  0x9b, 0x8c, 0x7e, 0x79, 0x7c, 0x80, 0x80, 0x77, 0x6c, 0x66, 0x67, 0x6d,
-  0x75, 0x7d, 0x84, 0x8a, 0x91, 0x97, 0x9b, 0x9b, 0x96, 0x8d, 0x84, 0x7e,
-  0x7b, 0x7b, 0x7d, 0x7f, 0x81, 0x84, 0x86, 0x86, 0x85, 0x85, 0x89, 0x92,
-  0x98, 0x8f, 0x6e, 0x40, 0x21, 0x22, 0x48, 0x86, 0xbf, 0xd8, 0xc5, 0x8f,
-  0x61, 0x66, 0x99, 0xd1, 0xee, 0xde, 0xa5, 0x65, 0x40, 0x3b, 0x50, 0x73,
-  0x90, 0x9f, 0x9e, 0x90, 0x80, 0x78, 0x81, 0x93, 0xa7, 0xb5, 0xb6, 0xa4,
-  0x82, 0x60, 0x4c, 0x4e, 0x63, 0x7b, 0x8a, 0x89, 0x80, 0x7c, 0x84, 0x95,
-  0xa6, 0xaf, 0xa9, 0x93, 0x7b, 0x6d, 0x6e, 0x75, 0x7b, 0x7c, 0x7a, 0x79,
-  0x7e, 0x83, 0x86, 0x86, 0x84, 0x81, 0x78, 0x6e, 0x65, 0x62, 0x68, 0x75,
-  0x87, 0x98, 0x9e, 0x96, 0x80, 0x67, 0x55, 0x4e, 0x51, 0x5d, 0x70, 0x88,
-  0xa3, 0xba, 0xc8, 0xca, 0xc0, 0xb0, 0xa3, 0x9b, 0x94, 0x8c, 0x80, 0x71,
-  0x63, 0x59, 0x57, 0x5c, 0x66, 0x75, 0x88, 0x9a, 0xa8, 0xac, 0xa4, 0x94,
-  0x85, 0x7e, 0x80, 0x84, 0x85, 0x7f, 0x73, 0x6a, 0x68, 0x6e, 0x78, 0x82,
-  0x88, 0x8a, 0x88, 0x88, 0x8a, 0x8d, 0x90, 0x8f, 0x8a, 0x82, 0x77, 0x6f,
-  0x6a, 0x6a, 0x70, 0x76, 0x7a, 0x79, 0x74, 0x72, 0x79, 0x84, 0x8f, 0x96,
-  0x96, 0x94, 0x95, 0x9f, 0xa8, 0x9e, 0x7c, 0x50, 0x29, 0x12, 0x12, 0x26,
-  0x4b, 0x79, 0x9e, 0xb3, 0xba, 0xba, 0xbc, 0xc3, 0xce, 0xd4, 0xca, 0xad,
-  0x86, 0x5e, 0x3c, 0x26, 0x22, 0x31, 0x4f, 0x71, 0x91, 0xa3, 0xa4, 0x9a,
-  0x94, 0x9c, 0xac, 0xba, 0xba, 0xa5, 0x81, 0x5d, 0x48, 0x46, 0x56, 0x67,
-  0x6f, 0x6c, 0x67, 0x6b, 0x7a, 0x90, 0xa2, 0xab, 0xa8, 0x9e, 0x96, 0x94,
-  0x96, 0x96, 0x8d, 0x7c, 0x69, 0x5d, 0x5b, 0x61, 0x6a, 0x74, 0x7d, 0x87,
-  0x94, 0xa2, 0xae, 0xb0, 0x9b, 0x70, 0x41, 0x20, 0x18, 0x2c, 0x53, 0x7a,
-  0x8c, 0x7c, 0x64, 0x68, 0x92, 0xce, 0xfc, 0xff, 0xf6, 0xc4, 0x8e, 0x6a,
-  0x62, 0x68, 0x67, 0x5a, 0x48, 0x41, 0x4a, 0x5f, 0x78, 0x93, 0xad, 0xc4,
-  0xd0, 0xca, 0xb3, 0x96, 0x81, 0x7b, 0x7b, 0x78, 0x6c, 0x5a, 0x4c, 0x4b,
-  0x59, 0x6e, 0x7d, 0x83, 0x80, 0x7c, 0x80, 0x8b, 0x94, 0x9a, 0x9a, 0x94,
-  0x8a, 0x7f, 0x76, 0x70, 0x6c, 0x68, 0x66, 0x6c, 0x7a, 0x87, 0x8f, 0x90,
-  0x8f, 0x90, 0x89, 0x6d, 0x3e, 0x13, 0x06, 0x21, 0x58, 0x95, 0xb2, 0x99,
-  0x5e, 0x49, 0x7e, 0xcd, 0xff, 0xff, 0xda, 0x93, 0x5a, 0x49, 0x5b, 0x76,
-  0x78, 0x5d, 0x3c, 0x34, 0x4b, 0x6a, 0x87, 0x9f, 0xb0, 0xbe, 0xc5, 0xc1,
-  0xb2, 0x99, 0x7a, 0x66, 0x60, 0x60, 0x5e, 0x54, 0x49, 0x4a, 0x5a, 0x73,
-  0x8a, 0x95, 0x95, 0x8e, 0x87, 0x86, 0x8c, 0x94, 0x93, 0x84, 0x69, 0x4f,
-  0x44, 0x46, 0x4e, 0x59, 0x65, 0x72, 0x7f, 0x88, 0x8c, 0x8c, 0x87, 0x80,
-  0x76, 0x70, 0x70, 0x77, 0x7d, 0x7d, 0x74, 0x65, 0x52, 0x46, 0x43, 0x4b,
-  0x5b, 0x70, 0x86, 0x9a, 0xaa, 0xb4, 0xb7, 0xb2, 0xa6, 0x98, 0x8c, 0x84,
-  0x7e, 0x7b, 0x74, 0x69, 0x5a, 0x4e, 0x4c, 0x54, 0x67, 0x7e, 0x91, 0x99,
-  0x97, 0x8e, 0x86, 0x87, 0x8f, 0x97, 0x9a, 0x92, 0x80, 0x6d, 0x62, 0x61,
-  0x67, 0x6e, 0x71, 0x70, 0x6e, 0x6f, 0x75, 0x80, 0x89, 0x8d, 0x8e, 0x8a,
-  0x7f, 0x75, 0x70, 0x71, 0x73, 0x76, 0x78, 0x78, 0x79, 0x79, 0x7b, 0x7d,
-  0x7d, 0x7a, 0x76, 0x75, 0x7b, 0x8a, 0x98, 0xa0, 0x98, 0x80, 0x5e, 0x42,
-  0x36, 0x3b, 0x4c, 0x61, 0x75, 0x87, 0x96, 0xa2, 0xac, 0xb4, 0xbb, 0xbf,
-  0xc3, 0xc1, 0xb6, 0xa1, 0x83, 0x64, 0x4a, 0x3e, 0x44, 0x56, 0x6c, 0x7e,
-  0x88, 0x8a, 0x88, 0x8b, 0x93, 0xa0, 0xac, 0xaf, 0xa8, 0x95, 0x7d, 0x67,
-  0x59, 0x56, 0x5f, 0x6b, 0x70, 0x70, 0x6f, 0x72, 0x7c, 0x8d, 0x9c, 0xa5,
-  0xa6, 0xa1, 0x9b, 0x97, 0x96, 0x93, 0x8a, 0x7a, 0x69, 0x5d, 0x5d, 0x65,
-  0x70, 0x7a, 0x82, 0x88, 0x8f, 0x98, 0xa3, 0xad, 0xab, 0x92, 0x67, 0x3b,
-  0x1f, 0x1e, 0x36, 0x5c, 0x7d, 0x88, 0x78, 0x6c, 0x7e, 0xb0, 0xe6, 0xff,
-  0xff, 0xe7, 0xb6, 0x8d, 0x77, 0x72, 0x6f, 0x62, 0x4d, 0x3f, 0x40, 0x4d,
-  0x61, 0x78, 0x91, 0xac, 0xc7, 0xd4, 0xcd, 0xba, 0xa5, 0x96, 0x90, 0x89,
-  0x79, 0x63, 0x4d, 0x43, 0x4b, 0x5d, 0x6e, 0x78, 0x7b, 0x7b, 0x80, 0x8c,
-  0x9b, 0xa7, 0xab, 0xa6, 0x9d, 0x94, 0x8a, 0x80, 0x76, 0x6e, 0x6a, 0x6b,
-  0x70, 0x78, 0x82, 0x8d, 0x95, 0x9b, 0xa3, 0x9e, 0x7e, 0x4c, 0x23, 0x15,
-  0x2b, 0x59, 0x84, 0x8f, 0x6e, 0x46, 0x56, 0x9b, 0xe1, 0xff, 0xff, 0xdf,
-  0xa6, 0x82, 0x81, 0x8e, 0x8f, 0x77, 0x4f, 0x31, 0x2d, 0x40, 0x58, 0x6c,
-  0x82, 0x9b, 0xb6, 0xca, 0xd2, 0xc9, 0xb6, 0xa2, 0x96, 0x8d, 0x80, 0x6a,
-  0x50, 0x3e, 0x3f, 0x51, 0x66, 0x74, 0x78, 0x76, 0x7b, 0x87, 0x96, 0xa2,
-  0xa9, 0xa6, 0x99, 0x89, 0x7d, 0x74, 0x6d, 0x68, 0x61, 0x5c, 0x5b, 0x5e,
-  0x64, 0x6c, 0x74, 0x7d, 0x87, 0x90, 0x96, 0x97, 0x94, 0x91, 0x92, 0x8c,
-  0x7d, 0x68, 0x52, 0x42, 0x40, 0x4a, 0x5e, 0x74, 0x87, 0x98, 0xa6, 0xb2,
-  0xbb, 0xc0, 0xbf, 0xb5, 0xa8, 0x9a, 0x8e, 0x84, 0x74, 0x61, 0x4f, 0x47,
-  0x4d, 0x5f, 0x77, 0x8c, 0x98, 0x98, 0x90, 0x8a, 0x8b, 0x92, 0x9c, 0xa1,
-  0x9d, 0x8e, 0x7b, 0x6f, 0x6c, 0x70, 0x75, 0x76, 0x74, 0x71, 0x70, 0x74,
-  0x7d, 0x86, 0x8c, 0x8e, 0x8d, 0x8c, 0x8c, 0x8e, 0x8c, 0x86, 0x7c, 0x74,
-  0x71, 0x74, 0x79, 0x7e, 0x80, 0x7e, 0x7a, 0x78, 0x7b, 0x80, 0x86, 0x88,
-  0x8b, 0x90, 0x98, 0x9e, 0x99, 0x85, 0x66, 0x47, 0x32, 0x2f, 0x41, 0x5e,
-  0x80, 0x9e, 0xb3, 0xba, 0xb7, 0xb3, 0xb5, 0xbf, 0xcb, 0xcf, 0xc3, 0xa7,
-  0x83, 0x61, 0x46, 0x35, 0x35, 0x44, 0x59, 0x6f, 0x83, 0x8b, 0x8a, 0x86,
-  0x8b, 0x99, 0xad, 0xbd, 0xbe, 0xaa, 0x88, 0x68, 0x58, 0x5b, 0x67, 0x6c,
-  0x66, 0x5a, 0x52, 0x5a, 0x6e, 0x85, 0x98, 0xa1, 0x9e, 0x97, 0x94, 0x97,
-  0x9c, 0x9c, 0x95, 0x87, 0x76, 0x69, 0x63, 0x62, 0x64, 0x67, 0x6a, 0x6e,
-  0x77, 0x87, 0x9b, 0xae, 0xb6, 0xab, 0x8c, 0x64, 0x42, 0x2e, 0x2f, 0x41,
-  0x57, 0x66, 0x6b, 0x6c, 0x74, 0x8d, 0xb5, 0xde, 0xf6, 0xf8, 0xe6, 0xc4,
-  0xa2, 0x8a, 0x7a, 0x6c, 0x5d, 0x4c, 0x3f, 0x3a, 0x3f, 0x4b, 0x5e, 0x78,
-  0x96, 0xb0, 0xc1, 0xc1, 0xb6, 0xa9, 0xa2, 0x9e, 0x94, 0x7e, 0x62, 0x4b,
-  0x41, 0x45, 0x51, 0x5d, 0x63, 0x67, 0x6d, 0x78, 0x88, 0x9a, 0xa8, 0xae,
-  0xad, 0xa7, 0x9e, 0x95, 0x8b, 0x7e, 0x70, 0x67, 0x62, 0x5f, 0x62, 0x69,
-  0x73, 0x81, 0x92, 0xa2, 0xa8, 0x95, 0x69, 0x36, 0x18, 0x1b, 0x3c, 0x6a,
-  0x86, 0x77, 0x4b, 0x39, 0x63, 0xa9, 0xde, 0xff, 0xfe, 0xdb, 0xae, 0x94,
-  0x98, 0xa3, 0x9a, 0x77, 0x4c, 0x31, 0x2c, 0x36, 0x43, 0x50, 0x63, 0x7d,
-  0x9d, 0xb8, 0xc6, 0xc4, 0xb7, 0xad, 0xaa, 0xa9, 0x9f, 0x87, 0x66, 0x4b,
-  0x40, 0x46, 0x54, 0x5c, 0x5d, 0x5a, 0x5b, 0x68, 0x7c, 0x92, 0xa1, 0xa6,
-  0xa2, 0x9b, 0x94, 0x92, 0x91, 0x8b, 0x7e, 0x6f, 0x63, 0x5c, 0x5c, 0x5e,
-  0x5f, 0x5f, 0x64, 0x71, 0x84, 0x97, 0xa6, 0xac, 0xa0, 0x80, 0x59, 0x3b,
-  0x32, 0x3d, 0x54, 0x6c, 0x7b, 0x7e, 0x7d, 0x84, 0x99, 0xb6, 0xd2, 0xe2,
-  0xe0, 0xcb, 0xab, 0x8e, 0x79, 0x69, 0x5b, 0x50, 0x49, 0x47, 0x4d, 0x56,
-  0x60, 0x6c, 0x7a, 0x8c, 0xa0, 0xb0, 0xb6, 0xb2, 0xa5, 0x94, 0x88, 0x81,
-  0x7e, 0x79, 0x6d, 0x5e, 0x54, 0x54, 0x5e, 0x6b, 0x75, 0x7a, 0x7e, 0x81,
-  0x86, 0x8f, 0x9a, 0xa2, 0xa4, 0x9f, 0x94, 0x85, 0x7a, 0x72, 0x6c, 0x69,
-  0x65, 0x61, 0x5f, 0x5f, 0x62, 0x6b, 0x77, 0x84, 0x91, 0x9b, 0xa6, 0xaf,
-  0xae, 0x9f, 0x82, 0x60, 0x44, 0x34, 0x33, 0x40, 0x56, 0x6d, 0x84, 0x93,
-  0x9e, 0xa6, 0xae, 0xb7, 0xc2, 0xcc, 0xd0, 0xc8, 0xb2, 0x93, 0x72, 0x54,
-  0x40, 0x37, 0x3a, 0x47, 0x57, 0x65, 0x6e, 0x71, 0x72, 0x7a, 0x8c, 0xa1,
-  0xb3, 0xbe, 0xba, 0xa5, 0x8c, 0x7b, 0x75, 0x76, 0x73, 0x6a, 0x5a, 0x4b,
-  0x48, 0x52, 0x66, 0x7a, 0x88, 0x8f, 0x93, 0x97, 0x9f, 0xa6, 0xa9, 0xa3,
-  0x94, 0x80, 0x70, 0x66, 0x61, 0x5f, 0x5f, 0x62, 0x66, 0x6c, 0x74, 0x7d,
-  0x87, 0x94, 0xa4, 0xae, 0xa7, 0x8b, 0x62, 0x3e, 0x2f, 0x37, 0x4e, 0x67,
-  0x74, 0x72, 0x6a, 0x6f, 0x89, 0xaf, 0xd3, 0xe8, 0xed, 0xe1, 0xc8, 0xac,
-  0x94, 0x82, 0x70, 0x60, 0x53, 0x47, 0x3d, 0x37, 0x37, 0x41, 0x55, 0x72,
-  0x93, 0xae, 0xbd, 0xbd, 0xb5, 0xae, 0xad, 0xae, 0xa8, 0x92, 0x73, 0x57,
-  0x47, 0x46, 0x4e, 0x56, 0x5a, 0x5d, 0x63, 0x6f, 0x81, 0x94, 0xa5, 0xae,
-  0xb1, 0xb0, 0xab, 0xa4, 0x9b, 0x90, 0x80, 0x6f, 0x5f, 0x53, 0x4e, 0x50,
-  0x58, 0x68, 0x7e, 0x95, 0xa9, 0xb4, 0xab, 0x89, 0x5a, 0x36, 0x26, 0x32,
-  0x53, 0x70, 0x77, 0x63, 0x4a, 0x53, 0x85, 0xc1, 0xeb, 0xfd, 0xf7, 0xde,
-  0xbd, 0xa8, 0xa4, 0xa1, 0x8f, 0x6e, 0x49, 0x2e, 0x22, 0x26, 0x31, 0x43,
-  0x5c, 0x7a, 0x98, 0xaa, 0xb0, 0xb0, 0xb4, 0xc2, 0xd0, 0xd4, 0xc4, 0xa1,
-  0x7b, 0x60, 0x54, 0x54, 0x54, 0x4b, 0x3d, 0x35, 0x3a, 0x50, 0x6c, 0x87,
-  0x9b, 0xa6, 0xac, 0xb0, 0xb6, 0xb8, 0xb2, 0xa3, 0x90, 0x7e, 0x6e, 0x62,
-  0x58, 0x4e, 0x49, 0x4d, 0x5a, 0x6b, 0x7e, 0x90, 0x99, 0x95, 0x84, 0x6d,
-  0x5a, 0x59, 0x70, 0x90, 0xa5, 0xa4, 0x88, 0x61, 0x51, 0x66, 0x93, 0xc1,
-  0xda, 0xd3, 0xb0, 0x89, 0x76, 0x7e, 0x95, 0xa2, 0x99, 0x7a, 0x58, 0x44,
-  0x42, 0x4d, 0x5e, 0x71, 0x82, 0x8d, 0x91, 0x92, 0x94, 0x9a, 0xa4, 0xac,
-  0xaa, 0x9a, 0x82, 0x6b, 0x60, 0x63, 0x6d, 0x73, 0x70, 0x67, 0x62, 0x67,
-  0x77, 0x89, 0x95, 0x99, 0x97, 0x91, 0x8c, 0x8b, 0x89, 0x83, 0x7b, 0x76,
-  0x74, 0x73, 0x71, 0x6e, 0x6a, 0x66, 0x67, 0x6c, 0x72, 0x78, 0x80, 0x8a,
-  0x94, 0x97, 0x93, 0x87, 0x74, 0x64, 0x58, 0x56, 0x5b, 0x65, 0x73, 0x81,
-  0x91, 0xa0, 0xae, 0xb7, 0xba, 0xb9, 0xb5, 0xb1, 0xad, 0xa8, 0x9d, 0x8b,
-  0x75, 0x5e, 0x4b, 0x3f, 0x3e, 0x46, 0x54, 0x65, 0x74, 0x81, 0x87, 0x89,
-  0x8c, 0x92, 0x9c, 0xa6, 0xaa, 0xa4, 0x92, 0x7e, 0x72, 0x6f, 0x72, 0x76,
-  0x74, 0x6c, 0x63, 0x5e, 0x61, 0x6a, 0x74, 0x7b, 0x80, 0x84, 0x8b, 0x94,
-  0x9b, 0xa0, 0x9e, 0x96, 0x8e, 0x88, 0x83, 0x7c, 0x72, 0x66, 0x5c, 0x57,
-  0x58, 0x5d, 0x66, 0x6f, 0x7a, 0x88, 0x98, 0xa8, 0xb1, 0xa9, 0x91, 0x70,
-  0x58, 0x51, 0x59, 0x66, 0x6f, 0x6e, 0x68, 0x65, 0x6c, 0x80, 0x9a, 0xb2,
-  0xc4, 0xcf, 0xd0, 0xc9, 0xbd, 0xaa, 0x94, 0x7d, 0x6a, 0x5e, 0x57, 0x52,
-  0x4d, 0x4a, 0x4a, 0x50, 0x5f, 0x76, 0x8e, 0xa3, 0xaf, 0xb2, 0xad, 0xa9,
-  0xa8, 0xa7, 0xa0, 0x90, 0x7a, 0x65, 0x5a, 0x56, 0x59, 0x5e, 0x61, 0x65,
-  0x6c, 0x74, 0x81, 0x90, 0x9b, 0xa4, 0xaa, 0xa9, 0xa6, 0x9f, 0x95, 0x89,
-  0x7f, 0x77, 0x70, 0x68, 0x62, 0x60, 0x64, 0x6e, 0x7c, 0x90, 0xa2, 0xac,
-  0xa5, 0x89, 0x62, 0x43, 0x36, 0x3f, 0x56, 0x6a, 0x70, 0x66, 0x57, 0x5b,
-  0x7b, 0xab, 0xd3, 0xec, 0xf2, 0xe6, 0xd0, 0xbb, 0xad, 0xa3, 0x96, 0x80,
-  0x63, 0x48, 0x34, 0x2a, 0x2a, 0x34, 0x46, 0x61, 0x7e, 0x98, 0xa7, 0xa9,
-  0xa6, 0xac, 0xbe, 0xd1, 0xd6, 0xc4, 0xa2, 0x7e, 0x64, 0x5a, 0x5a, 0x58,
-  0x4e, 0x3c, 0x30, 0x33, 0x45, 0x60, 0x7b, 0x90, 0x9f, 0xa8, 0xaf, 0xb6,
-  0xbb, 0xba, 0xb1, 0xa0, 0x8c, 0x7a, 0x6a, 0x5c, 0x51, 0x4d, 0x53, 0x61,
-  0x73, 0x83, 0x86, 0x72, 0x4c, 0x2e, 0x35, 0x5e, 0x95, 0xbc, 0xb8, 0x81,
-  0x3f, 0x30, 0x62, 0xac, 0xe1, 0xf5, 0xde, 0xa4, 0x71, 0x73, 0xa1, 0xd0,
-  0xd9, 0xb4, 0x78, 0x4c, 0x3c, 0x3e, 0x46, 0x4a, 0x4a, 0x50, 0x5f, 0x71,
-  0x7d, 0x82, 0x86, 0x95, 0xac, 0xc3, 0xce, 0xc3, 0xa5, 0x86, 0x77, 0x7a,
-  0x80, 0x7a, 0x64, 0x45, 0x30, 0x31, 0x44, 0x5c, 0x71, 0x7f, 0x86, 0x8d,
-  0x96, 0xa3, 0xae, 0xad, 0xa1, 0x92, 0x84, 0x77, 0x6c, 0x60, 0x55, 0x4f,
-  0x52, 0x5b, 0x65, 0x6e, 0x76, 0x81, 0x90, 0x9b, 0x9c, 0x8e, 0x75, 0x5e,
-  0x54, 0x5a, 0x66, 0x70, 0x73, 0x73, 0x79, 0x87, 0x99, 0xac, 0xb8, 0xbe,
-  0xbf, 0xbf, 0xbe, 0xb9, 0xaa, 0x91, 0x74, 0x5b, 0x4b, 0x44, 0x46, 0x49,
-  0x4d, 0x50, 0x56, 0x62, 0x72, 0x86, 0x99, 0xaa, 0xb6, 0xbb, 0xb9, 0xb3,
-  0xaa, 0xa0, 0x96, 0x8a, 0x7c, 0x6b, 0x5a, 0x4e, 0x4a, 0x4c, 0x55, 0x5f,
-  0x6b, 0x76, 0x81, 0x8f, 0x9c, 0xa6, 0xa8, 0xa6, 0xa2, 0x9b, 0x93, 0x8a,
-  0x7f, 0x73, 0x68, 0x5f, 0x5a, 0x5a, 0x5b, 0x5e, 0x62, 0x6b, 0x79, 0x8a,
-  0x9e, 0xad, 0xaf, 0xa4, 0x8e, 0x78, 0x67, 0x5d, 0x59, 0x5c, 0x62, 0x6b,
-  0x77, 0x84, 0x91, 0x9c, 0xa5, 0xae, 0xb7, 0xc0, 0xc7, 0xc8, 0xc0, 0xab,
-  0x90, 0x73, 0x5b, 0x4b, 0x42, 0x42, 0x47, 0x4d, 0x53, 0x5a, 0x62, 0x6e,
-  0x7e, 0x92, 0xa7, 0xb6, 0xbe, 0xbb, 0xb0, 0xa3, 0x98, 0x8e, 0x86, 0x7d,
-  0x70, 0x60, 0x53, 0x4c, 0x4e, 0x56, 0x60, 0x6c, 0x78, 0x83, 0x8e, 0x99,
-  0xa2, 0xa7, 0xaa, 0xa6, 0x9e, 0x91, 0x83, 0x77, 0x6d, 0x65, 0x60, 0x5e,
-  0x5d, 0x60, 0x65, 0x6d, 0x7b, 0x8c, 0x9f, 0xaa, 0xa1, 0x82, 0x5a, 0x3e,
-  0x3b, 0x4c, 0x66, 0x79, 0x7a, 0x69, 0x57, 0x59, 0x78, 0xa6, 0xd0, 0xe9,
-  0xec, 0xe0, 0xca, 0xb6, 0xab, 0xa7, 0x9f, 0x8c, 0x6f, 0x50, 0x36, 0x27,
-  0x23, 0x2a, 0x3a, 0x52, 0x6b, 0x81, 0x92, 0x9a, 0x9e, 0xa5, 0xb2, 0xc2,
-  0xcd, 0xca, 0xb3, 0x91, 0x74, 0x65, 0x64, 0x67, 0x62, 0x55, 0x43, 0x37,
-  0x39, 0x4a, 0x61, 0x77, 0x87, 0x92, 0x99, 0xa0, 0xa6, 0xae, 0xb2, 0xaf,
-  0xa6, 0x98, 0x88, 0x77, 0x68, 0x5f, 0x5b, 0x5c, 0x64, 0x6e, 0x78, 0x77,
-  0x64, 0x44, 0x2d, 0x30, 0x4f, 0x79, 0x99, 0x9a, 0x75, 0x4a, 0x46, 0x71,
-  0xb0, 0xe0, 0xf2, 0xe5, 0xc0, 0x9f, 0x9d, 0xb7, 0xd1, 0xd0, 0xac, 0x7a,
-  0x53, 0x3f, 0x3a, 0x3a, 0x38, 0x36, 0x3c, 0x4d, 0x62, 0x70, 0x77, 0x7c,
-  0x88, 0xa2, 0xc1, 0xd6, 0xd6, 0xc0, 0xa2, 0x8f, 0x8d, 0x94, 0x95, 0x83,
-  0x5f, 0x3b, 0x28, 0x2a, 0x3b, 0x4e, 0x58, 0x5f, 0x67, 0x76, 0x8a, 0x9e,
-  0xaf, 0xb7, 0xba, 0xb9, 0xb4, 0xa7, 0x93, 0x7b, 0x66, 0x58, 0x50, 0x4a,
-  0x47, 0x48, 0x4b, 0x56, 0x67, 0x76, 0x7b, 0x78, 0x73, 0x72, 0x79, 0x88,
-  0x94, 0x9a, 0x96, 0x8d, 0x87, 0x8b, 0x94, 0x9e, 0xa6, 0xac, 0xb1, 0xb5,
-  0xb7, 0xb2, 0xa4, 0x91, 0x7e, 0x71, 0x69, 0x65, 0x5f, 0x55, 0x49, 0x43,
-  0x46, 0x51, 0x62, 0x73, 0x83, 0x90, 0x9a, 0xa1, 0xa8, 0xae, 0xb2, 0xb4,
-  0xb2, 0xa8, 0x99, 0x86, 0x74, 0x65, 0x5d, 0x58, 0x55, 0x54, 0x54, 0x56,
-  0x5e, 0x6c, 0x7f, 0x92, 0x9f, 0xa6, 0xaa, 0xaa, 0xa7, 0xa3, 0x9c, 0x92,
-  0x86, 0x7a, 0x71, 0x68, 0x60, 0x57, 0x51, 0x51, 0x56, 0x5f, 0x6a, 0x76,
-  0x85, 0x93, 0xa0, 0xaa, 0xac, 0xa3, 0x92, 0x7e, 0x70, 0x6a, 0x6c, 0x73,
-  0x79, 0x80, 0x86, 0x8c, 0x95, 0x9f, 0xa6, 0xab, 0xb0, 0xb4, 0xb4, 0xb1,
-  0xa9, 0x98, 0x81, 0x69, 0x56, 0x48, 0x43, 0x46, 0x4e, 0x59, 0x63, 0x6d,
-  0x76, 0x80, 0x8a, 0x97, 0xa6, 0xb2, 0xb9, 0xb5, 0xa7, 0x94, 0x85, 0x7e,
-  0x7f, 0x7f, 0x79, 0x6c, 0x5d, 0x54, 0x56, 0x61, 0x6e, 0x78, 0x7c, 0x7e,
-  0x82, 0x87, 0x90, 0x99, 0x9e, 0xa0, 0x9a, 0x92, 0x8a, 0x83, 0x7c, 0x76,
-  0x71, 0x6d, 0x68, 0x64, 0x64, 0x66, 0x6e, 0x7b, 0x8a, 0x98, 0x9f, 0x99,
-  0x83, 0x66, 0x51, 0x4b, 0x53, 0x62, 0x6f, 0x73, 0x6f, 0x68, 0x69, 0x7a,
-  0x96, 0xb5, 0xd0, 0xdf, 0xe1, 0xd8, 0xc7, 0xb5, 0xa6, 0x9b, 0x91, 0x84,
-  0x70, 0x57, 0x3d, 0x2a, 0x24, 0x2c, 0x3d, 0x54, 0x6a, 0x7b, 0x86, 0x8c,
-  0x92, 0x9d, 0xad, 0xbc, 0xc6, 0xc5, 0xb6, 0x9e, 0x88, 0x7a, 0x74, 0x70,
-  0x6a, 0x5c, 0x4b, 0x3e, 0x3b, 0x43, 0x53, 0x64, 0x74, 0x81, 0x8a, 0x93,
-  0x9d, 0xa6, 0xae, 0xb1, 0xae, 0xa7, 0x9c, 0x90, 0x82, 0x74, 0x67, 0x61,
-  0x63, 0x6a, 0x73, 0x77, 0x6f, 0x57, 0x3b, 0x2a, 0x2f, 0x47, 0x69, 0x86,
-  0x8b, 0x74, 0x59, 0x56, 0x78, 0xb0, 0xdb, 0xf0, 0xf0, 0xda, 0xbe, 0xb0,
-  0xba, 0xce, 0xd4, 0xbe, 0x94, 0x67, 0x48, 0x38, 0x34, 0x36, 0x38, 0x39,
-  0x3c, 0x46, 0x55, 0x65, 0x72, 0x80, 0x92, 0xaa, 0xc4, 0xd5, 0xd4, 0xc5,
-  0xb2, 0xa6, 0xa2, 0xa1, 0x97, 0x7c, 0x58, 0x37, 0x25, 0x24, 0x30, 0x3c,
-  0x42, 0x47, 0x51, 0x61, 0x76, 0x8f, 0xa3, 0xaf, 0xb6, 0xbb, 0xbe, 0xba,
-  0xad, 0x9a, 0x87, 0x76, 0x6a, 0x64, 0x5e, 0x58, 0x54, 0x52, 0x51, 0x4b,
-  0x41, 0x39, 0x40, 0x5b, 0x80, 0xa1, 0xaa, 0x91, 0x69, 0x58, 0x74, 0xaa,
-  0xda, 0xee, 0xdd, 0xaf, 0x84, 0x7f, 0xa4, 0xcc, 0xd9, 0xc1, 0x8d, 0x5d,
-  0x4a, 0x4e, 0x5b, 0x61, 0x58, 0x4a, 0x44, 0x4c, 0x5b, 0x68, 0x70, 0x77,
-  0x84, 0x99, 0xb0, 0xbe, 0xbb, 0xa9, 0x96, 0x95, 0xa1, 0xac, 0xa7, 0x8f,
-  0x6b, 0x50, 0x4a, 0x54, 0x63, 0x68, 0x60, 0x53, 0x50, 0x5b, 0x6f, 0x83,
-  0x91, 0x98, 0x9c, 0x9b, 0x99, 0x95, 0x8c, 0x83, 0x7e, 0x7e, 0x7b, 0x73,
-  0x65, 0x55, 0x50, 0x59, 0x6c, 0x83, 0x94, 0x98, 0x91, 0x84, 0x7a, 0x77,
-  0x79, 0x7a, 0x7a, 0x77, 0x75, 0x75, 0x79, 0x81, 0x8a, 0x93, 0x9c, 0xa4,
-  0xaa, 0xad, 0xb0, 0xb3, 0xb5, 0xb5, 0xaf, 0xa0, 0x8a, 0x72, 0x60, 0x58,
-  0x58, 0x5b, 0x5c, 0x59, 0x54, 0x54, 0x5b, 0x6b, 0x7c, 0x8d, 0x9a, 0xa1,
-  0xa4, 0xa4, 0xa3, 0xa2, 0xa1, 0x9f, 0x9a, 0x93, 0x89, 0x7c, 0x72, 0x6a,
-  0x68, 0x6a, 0x6c, 0x6c, 0x6a, 0x67, 0x68, 0x6d, 0x76, 0x82, 0x8c, 0x91,
-  0x93, 0x92, 0x90, 0x90, 0x92, 0x92, 0x8f, 0x8b, 0x84, 0x79, 0x70, 0x6b,
-  0x69, 0x6b, 0x70, 0x79, 0x85, 0x92, 0x9c, 0x9e, 0x93, 0x7d, 0x66, 0x58,
-  0x55, 0x5c, 0x69, 0x72, 0x75, 0x73, 0x6e, 0x6e, 0x79, 0x90, 0xab, 0xc4,
-  0xd7, 0xe0, 0xdb, 0xcc, 0xb8, 0xa7, 0x9d, 0x97, 0x92, 0x85, 0x6f, 0x53,
-  0x3a, 0x2a, 0x27, 0x32, 0x46, 0x5c, 0x6f, 0x7a, 0x7e, 0x80, 0x87, 0x97,
-  0xab, 0xbd, 0xc6, 0xc3, 0xb5, 0xa2, 0x94, 0x8b, 0x87, 0x83, 0x7a, 0x6c,
-  0x5c, 0x4e, 0x49, 0x4c, 0x55, 0x5f, 0x68, 0x6f, 0x76, 0x7c, 0x84, 0x8d,
-  0x97, 0x9f, 0xa5, 0xa8, 0xa8, 0xa2, 0x98, 0x8d, 0x86, 0x85, 0x87, 0x87,
-  0x84, 0x7c, 0x6e, 0x5e, 0x4b, 0x3b, 0x33, 0x38, 0x46, 0x56, 0x5f, 0x5e,
-  0x52, 0x4c, 0x5a, 0x80, 0xad, 0xce, 0xdf, 0xde, 0xd1, 0xc7, 0xca, 0xda,
-  0xe7, 0xe2, 0xc6, 0x9e, 0x78, 0x5c, 0x4d, 0x46, 0x3e, 0x34, 0x2b, 0x27,
-  0x2b, 0x36, 0x43, 0x53, 0x67, 0x7e, 0x95, 0xa9, 0xb5, 0xb8, 0xb4, 0xb2,
-  0xb8, 0xc0, 0xc0, 0xb2, 0x98, 0x7a, 0x62, 0x55, 0x52, 0x4e, 0x44, 0x34,
-  0x28, 0x28, 0x35, 0x47, 0x5d, 0x72, 0x84, 0x94, 0xa1, 0xab, 0xb4, 0xba,
-  0xbc, 0xbb, 0xb6, 0xac, 0x9d, 0x8d, 0x7e, 0x73, 0x67, 0x56, 0x3f, 0x27,
-  0x19, 0x1c, 0x2e, 0x46, 0x56, 0x55, 0x49, 0x46, 0x5f, 0x8d, 0xb7, 0xd6,
-  0xe0, 0xd6, 0xca, 0xcc, 0xdb, 0xeb, 0xeb, 0xd3, 0xaf, 0x90, 0x7d, 0x71,
-  0x62, 0x4a, 0x32, 0x26, 0x2a, 0x39, 0x48, 0x4b, 0x47, 0x49, 0x5b, 0x7a,
-  0x9b, 0xb2, 0xb5, 0xa8, 0x9d, 0xa3, 0xb8, 0xc9, 0xca, 0xb8, 0x9d, 0x86,
-  0x7c, 0x7c, 0x78, 0x6c, 0x58, 0x46, 0x3d, 0x40, 0x47, 0x4c, 0x4e, 0x54,
-  0x62, 0x78, 0x90, 0x9f, 0xa4, 0x9f, 0x9a, 0x9e, 0xa6, 0xaa, 0xa3, 0x91,
-  0x78, 0x67, 0x62, 0x64, 0x68, 0x66, 0x61, 0x61, 0x66, 0x6d, 0x73, 0x71,
-  0x6a, 0x66, 0x6c, 0x78, 0x85, 0x8b, 0x8b, 0x88, 0x88, 0x90, 0x9a, 0xa3,
-  0xa9, 0xab, 0xae, 0xb5, 0xba, 0xbc, 0xb5, 0xa5, 0x93, 0x86, 0x81, 0x7d,
-  0x77, 0x6b, 0x5a, 0x4a, 0x41, 0x41, 0x47, 0x50, 0x5b, 0x64, 0x6d, 0x75,
-  0x7a, 0x81, 0x8b, 0x98, 0xa7, 0xb4, 0xb9, 0xb6, 0xac, 0xa0, 0x98, 0x96,
-  0x94, 0x8d, 0x80, 0x6e, 0x5e, 0x55, 0x54, 0x57, 0x5c, 0x5f, 0x62, 0x66,
-  0x6c, 0x76, 0x80, 0x89, 0x90, 0x96, 0x9c, 0xa0, 0xa0, 0x9c, 0x96, 0x8f,
-  0x89, 0x84, 0x80, 0x7a, 0x71, 0x6a, 0x67, 0x6b, 0x73, 0x7b, 0x80, 0x7e,
-  0x78, 0x72, 0x6e, 0x71, 0x78, 0x80, 0x86, 0x8c, 0x90, 0x94, 0x97, 0x9a,
-  0x9b, 0xa0, 0xa6, 0xaf, 0xb7, 0xbd, 0xbc, 0xb3, 0xa7, 0x98, 0x8a, 0x7e,
-  0x75, 0x6e, 0x66, 0x5c, 0x52, 0x49, 0x41, 0x3e, 0x44, 0x51, 0x62, 0x72,
-  0x7e, 0x82, 0x84, 0x87, 0x91, 0xa0, 0xae, 0xb5, 0xb2, 0xa8, 0x9b, 0x90,
-  0x8d, 0x8b, 0x88, 0x80, 0x73, 0x66, 0x5c, 0x58, 0x59, 0x5c, 0x60, 0x67,
-  0x6d, 0x73, 0x7a, 0x80, 0x87, 0x8f, 0x97, 0x9d, 0xa0, 0xa0, 0x9b, 0x95,
-  0x8f, 0x8b, 0x89, 0x85, 0x80, 0x7a, 0x76, 0x75, 0x76, 0x74, 0x69, 0x56,
-  0x43, 0x38, 0x3c, 0x4c, 0x5d, 0x69, 0x68, 0x5d, 0x58, 0x63, 0x82, 0xa7,
-  0xc7, 0xd9, 0xdb, 0xd2, 0xc8, 0xc8, 0xd2, 0xdb, 0xdb, 0xcc, 0xaf, 0x8e,
-  0x70, 0x5c, 0x4f, 0x47, 0x40, 0x37, 0x2e, 0x27, 0x27, 0x2f, 0x3e, 0x51,
-  0x65, 0x7a, 0x8c, 0x9a, 0xa4, 0xa8, 0xab, 0xb0, 0xb6, 0xb8, 0xb4, 0xa7,
-  0x94, 0x80, 0x73, 0x6e, 0x6c, 0x66, 0x5d, 0x50, 0x46, 0x45, 0x4c, 0x57,
-  0x63, 0x6e, 0x77, 0x80, 0x89, 0x92, 0x9b, 0xa2, 0xa7, 0xab, 0xac, 0xab,
-  0xa4, 0x99, 0x8c, 0x81, 0x7c, 0x7c, 0x7a, 0x6e, 0x57, 0x3c, 0x28, 0x24,
-  0x30, 0x45, 0x57, 0x5f, 0x56, 0x4a, 0x4d, 0x6b, 0x98, 0xbe, 0xd8, 0xe1,
-  0xd7, 0xcc, 0xcd, 0xd8, 0xe5, 0xe9, 0xdc, 0xbe, 0x9e, 0x83, 0x70, 0x62,
-  0x56, 0x49, 0x3e, 0x38, 0x37, 0x3a, 0x3c, 0x3f, 0x46, 0x56, 0x6d, 0x85,
-  0x93, 0x94, 0x8c, 0x88, 0x92, 0xa8, 0xbb, 0xc1, 0xb8, 0xa5, 0x94, 0x90,
-  0x98, 0xa0, 0x9d, 0x8b, 0x72, 0x5f, 0x56, 0x54, 0x57, 0x57, 0x55, 0x53,
-  0x56, 0x5d, 0x65, 0x6d, 0x74, 0x7d, 0x89, 0x95, 0x9e, 0xa1, 0x9c, 0x94,
-  0x8c, 0x8b, 0x8e, 0x8f, 0x89, 0x7e, 0x72, 0x68, 0x5f, 0x59, 0x56, 0x57,
-  0x5a, 0x62, 0x69, 0x6e, 0x6e, 0x6c, 0x71, 0x7e, 0x92, 0xa7, 0xb5, 0xb7,
-  0xb1, 0xa9, 0xa8, 0xb0, 0xb8, 0xbb, 0xb4, 0xa6, 0x94, 0x86, 0x7d, 0x78,
-  0x74, 0x6f, 0x68, 0x61, 0x5b, 0x57, 0x57, 0x58, 0x5d, 0x64, 0x6b, 0x71,
-  0x73, 0x73, 0x76, 0x7c, 0x83, 0x8b, 0x90, 0x92, 0x91, 0x8f, 0x90, 0x92,
-  0x96, 0x98, 0x97, 0x92, 0x8b, 0x85, 0x81, 0x7e, 0x7b, 0x79, 0x75, 0x70,
-  0x6b, 0x67, 0x66, 0x69, 0x6e, 0x73, 0x77, 0x7a, 0x7c, 0x7f, 0x84, 0x8b,
-  0x93, 0x96, 0x95, 0x92, 0x8e, 0x89, 0x87, 0x87, 0x87, 0x87, 0x82, 0x7a,
-  0x6f, 0x64, 0x5b, 0x57, 0x59, 0x5f, 0x68, 0x71, 0x77, 0x7a, 0x7c, 0x84,
-  0x8f, 0x9d, 0xab, 0xb7, 0xbe, 0xc1, 0xc0, 0xbd, 0xb6, 0xae, 0xa5, 0x9b,
-  0x91, 0x86, 0x7a, 0x6e, 0x61, 0x55, 0x4b, 0x48, 0x4c, 0x53, 0x5a, 0x5f,
-  0x62, 0x62, 0x65, 0x6c, 0x77, 0x84, 0x8e, 0x92, 0x90, 0x8b, 0x88, 0x8a,
-  0x91, 0x98, 0x9b, 0x98, 0x91, 0x8a, 0x86, 0x89, 0x8d, 0x8e, 0x8a, 0x82,
-  0x77, 0x6e, 0x6c, 0x6e, 0x6f, 0x6d, 0x6b, 0x6a, 0x6a, 0x6d, 0x73, 0x78,
-  0x7c, 0x81, 0x83, 0x85, 0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8a,
-  0x88, 0x85, 0x80, 0x77, 0x6a, 0x61, 0x60, 0x68, 0x72, 0x79, 0x78, 0x6d,
-  0x61, 0x5f, 0x6e, 0x88, 0xa1, 0xb0, 0xae, 0xa1, 0x95, 0x98, 0xaa, 0xc0,
-  0xcd, 0xc7, 0xb1, 0x96, 0x84, 0x82, 0x88, 0x8c, 0x89, 0x7a, 0x63, 0x53,
-  0x4e, 0x52, 0x58, 0x5c, 0x5c, 0x5c, 0x5e, 0x65, 0x6d, 0x73, 0x78, 0x7c,
-  0x80, 0x86, 0x8d, 0x90, 0x8d, 0x87, 0x82, 0x81, 0x85, 0x8b, 0x8d, 0x89,
-  0x82, 0x7c, 0x7c, 0x81, 0x89, 0x8d, 0x8a, 0x82, 0x79, 0x75, 0x76, 0x7a,
-  0x7c, 0x7b, 0x76, 0x71, 0x6f, 0x70, 0x74, 0x78, 0x7a, 0x7a, 0x7b, 0x7e,
-  0x82, 0x85, 0x88, 0x8b, 0x8e, 0x90, 0x8e, 0x85, 0x76, 0x68, 0x63, 0x66,
-  0x6e, 0x74, 0x73, 0x68, 0x5d, 0x5b, 0x68, 0x7e, 0x92, 0x9c, 0x9e, 0x99,
-  0x98, 0x9f, 0xad, 0xb8, 0xbb, 0xb5, 0xaa, 0x9f, 0x99, 0x94, 0x8e, 0x85,
-  0x7a, 0x70, 0x6a, 0x65, 0x60, 0x59, 0x55, 0x56, 0x5b, 0x62, 0x69, 0x6c,
-  0x6c, 0x6c, 0x70, 0x78, 0x83, 0x8a, 0x8a, 0x86, 0x82, 0x80, 0x83, 0x89,
-  0x8d, 0x8b, 0x85, 0x7e, 0x7b, 0x7d, 0x7f, 0x7e, 0x7a, 0x75, 0x72, 0x71,
-  0x74, 0x76, 0x77, 0x77, 0x79, 0x7c, 0x80, 0x82, 0x83, 0x82, 0x82, 0x83,
-  0x86, 0x89, 0x8a, 0x87, 0x84, 0x83, 0x84, 0x86, 0x89, 0x8a, 0x8a, 0x86,
-  0x81, 0x79, 0x73, 0x72, 0x76, 0x7b, 0x7d, 0x78, 0x70, 0x68, 0x69, 0x72,
-  0x80, 0x8a, 0x8b, 0x85, 0x82, 0x87, 0x91, 0x9c, 0xa3, 0xa3, 0x9e, 0x99,
-  0x99, 0x9a, 0x9b, 0x97, 0x8e, 0x85, 0x7f, 0x7c, 0x7d, 0x7a, 0x74, 0x6d,
-  0x68, 0x6a, 0x6e, 0x73, 0x77, 0x77, 0x76, 0x75, 0x78, 0x7e, 0x83, 0x85,
-  0x84, 0x80, 0x7d, 0x7c, 0x7d, 0x7e, 0x7d, 0x79, 0x74, 0x72, 0x73, 0x75,
-  0x76, 0x77, 0x77, 0x77, 0x7a, 0x7f, 0x84, 0x86, 0x87, 0x87, 0x86, 0x88,
-  0x8b, 0x8d, 0x8d, 0x8a, 0x86, 0x84, 0x85, 0x87, 0x88, 0x86, 0x84, 0x81,
-  0x81, 0x84, 0x89, 0x8d, 0x8b, 0x84, 0x7a, 0x76, 0x7a, 0x82, 0x88, 0x86,
-  0x7a, 0x6b, 0x63, 0x69, 0x76, 0x81, 0x84, 0x7e, 0x78, 0x79, 0x84, 0x92,
-  0x9e, 0xa2, 0x9d, 0x98, 0x99, 0x9e, 0xa2, 0xa1, 0x99, 0x8e, 0x83, 0x80,
-  0x82, 0x83, 0x7e, 0x74, 0x6b, 0x67, 0x6a, 0x71, 0x76, 0x78, 0x77, 0x74,
-  0x75, 0x7b, 0x81, 0x87, 0x89, 0x87, 0x83, 0x80, 0x7e, 0x7f, 0x7f, 0x7c,
-  0x75, 0x6e, 0x6b, 0x6b, 0x6c, 0x6f, 0x72, 0x71, 0x70, 0x72, 0x75, 0x79,
-  0x7d, 0x81, 0x84, 0x85, 0x86, 0x88, 0x89, 0x8b, 0x8e, 0x8d, 0x89, 0x87,
-  0x86, 0x86, 0x86, 0x84, 0x82, 0x80, 0x7e, 0x80, 0x82, 0x84, 0x84, 0x7e,
-  0x79, 0x78, 0x7e, 0x85, 0x8a, 0x87, 0x7d, 0x73, 0x70, 0x76, 0x7f, 0x85,
-  0x84, 0x7e, 0x79, 0x7a, 0x82, 0x8a, 0x91, 0x91, 0x8d, 0x8b, 0x8d, 0x90,
-  0x91, 0x8f, 0x8a, 0x84, 0x81, 0x80, 0x80, 0x7e, 0x79, 0x74, 0x70, 0x71,
-  0x75, 0x79, 0x7b, 0x7a, 0x79, 0x7a, 0x7b, 0x7e, 0x82, 0x83, 0x82, 0x7e,
-  0x7b, 0x78, 0x79, 0x79, 0x78, 0x74, 0x70, 0x6b, 0x69, 0x6a, 0x6c, 0x6e,
-  0x6f, 0x6f, 0x70, 0x72, 0x76, 0x7b, 0x7d, 0x7d, 0x7e, 0x7e, 0x80, 0x83,
-  0x85, 0x86, 0x84, 0x82, 0x81, 0x81, 0x82, 0x83, 0x83, 0x81, 0x7e, 0x7e,
-  0x80, 0x84, 0x87, 0x85, 0x80, 0x7c, 0x7a, 0x7c, 0x80, 0x83, 0x82, 0x7b,
-  0x72, 0x6d, 0x6f, 0x74, 0x79, 0x7b, 0x7a, 0x7a, 0x7c, 0x83, 0x8b, 0x91,
-  0x94, 0x94, 0x94, 0x97, 0x99, 0x9a, 0x99, 0x94, 0x8e, 0x89, 0x86, 0x84,
-  0x81, 0x7d, 0x77, 0x72, 0x71, 0x74, 0x77, 0x7a, 0x7a, 0x77, 0x75, 0x76,
-  0x7b, 0x80, 0x83, 0x83, 0x80, 0x7d, 0x7d, 0x80, 0x83, 0x84, 0x80, 0x7a,
-  0x74, 0x70, 0x70, 0x71, 0x70, 0x6f, 0x6d, 0x6a, 0x6b, 0x70, 0x76, 0x7b,
-  0x7d, 0x7e, 0x80, 0x82, 0x85, 0x8a, 0x8e, 0x90, 0x8e, 0x8b, 0x87, 0x86,
-  0x86, 0x85, 0x82, 0x7e, 0x7a, 0x79, 0x7b, 0x7e, 0x81, 0x83, 0x83, 0x80,
-  0x80, 0x82, 0x86, 0x8a, 0x8e, 0x8d, 0x87, 0x81, 0x7d, 0x7d, 0x80, 0x82,
-  0x82, 0x80, 0x7f, 0x80, 0x84, 0x8a, 0x8d, 0x8e, 0x8f, 0x91, 0x94, 0x95,
-  0x94, 0x93, 0x90, 0x8b, 0x87, 0x84, 0x82, 0x7e, 0x7a, 0x78, 0x78, 0x79,
-  0x7c, 0x7f, 0x82, 0x81, 0x80, 0x81, 0x82, 0x85, 0x87, 0x87, 0x86, 0x83,
-  0x80, 0x7d, 0x7d, 0x7e, 0x7d, 0x7a, 0x76, 0x73, 0x73, 0x74, 0x75, 0x76,
-  0x76, 0x74, 0x74, 0x76, 0x78, 0x7b, 0x7d, 0x7e, 0x7f, 0x82, 0x84, 0x85,
-  0x86, 0x85, 0x83, 0x82, 0x84, 0x85, 0x83, 0x80, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x81, 0x85, 0x87, 0x87, 0x87, 0x86, 0x87,
-  0x89, 0x8c, 0x8c, 0x87, 0x81, 0x7c, 0x7c, 0x7c, 0x7c, 0x7a, 0x78, 0x77,
-  0x79, 0x7e, 0x85, 0x8b, 0x90, 0x91, 0x91, 0x93, 0x94, 0x95, 0x96, 0x94,
-  0x90, 0x8a, 0x86, 0x82, 0x7e, 0x7b, 0x78, 0x74, 0x72, 0x72, 0x73, 0x75,
-  0x79, 0x7d, 0x81, 0x84, 0x87, 0x89, 0x8b, 0x8c, 0x8d, 0x8c, 0x89, 0x85,
-  0x7f, 0x7a, 0x76, 0x73, 0x6e, 0x6a, 0x67, 0x65, 0x64, 0x66, 0x69, 0x6d,
-  0x72, 0x75, 0x79, 0x7e, 0x82, 0x86, 0x88, 0x8a, 0x8c, 0x8b, 0x89, 0x87,
-  0x84, 0x80, 0x7b, 0x77, 0x74, 0x72, 0x6f, 0x6d, 0x6d, 0x6e, 0x6f, 0x73,
-  0x77, 0x7c, 0x80, 0x84, 0x88, 0x8c, 0x8f, 0x90, 0x91, 0x92, 0x92, 0x90,
-  0x8d, 0x8a, 0x87, 0x84, 0x82, 0x80, 0x7d, 0x7b, 0x7a, 0x7b, 0x7e, 0x7f,
-  0x80, 0x81, 0x83, 0x87, 0x8b, 0x8e, 0x90, 0x8e, 0x8b, 0x89, 0x8a, 0x8b,
-  0x8c, 0x89, 0x85, 0x7e, 0x7a, 0x79, 0x7a, 0x7b, 0x7b, 0x7a, 0x79, 0x79,
-  0x7a, 0x7e, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x7f, 0x7c,
-  0x79, 0x76, 0x76, 0x77, 0x76, 0x74, 0x72, 0x72, 0x74, 0x77, 0x79, 0x7b,
-  0x7c, 0x7c, 0x7d, 0x7e, 0x80, 0x84, 0x86, 0x83, 0x7e, 0x7a, 0x79, 0x77,
-  0x76, 0x75, 0x74, 0x73, 0x72, 0x73, 0x77, 0x7a, 0x7d, 0x7f, 0x82, 0x85,
-  0x88, 0x8b, 0x8f, 0x92, 0x93, 0x92, 0x91, 0x90, 0x8e, 0x8c, 0x89, 0x85,
-  0x7f, 0x79, 0x76, 0x76, 0x76, 0x76, 0x77, 0x78, 0x7b, 0x7f, 0x84, 0x8a,
-  0x8f, 0x93, 0x95, 0x97, 0x99, 0x9a, 0x9a, 0x97, 0x92, 0x8d, 0x88, 0x84,
-  0x80, 0x7c, 0x77, 0x73, 0x6f, 0x6e, 0x70, 0x72, 0x74, 0x77, 0x7a, 0x7e,
-  0x82, 0x86, 0x88, 0x89, 0x89, 0x88, 0x87, 0x86, 0x83, 0x80, 0x7b, 0x77,
-  0x73, 0x71, 0x71, 0x72, 0x72, 0x71, 0x72, 0x74, 0x76, 0x7a, 0x7d, 0x7e,
-  0x80, 0x7f, 0x7f, 0x80, 0x7e, 0x7c, 0x7a, 0x78, 0x77, 0x76, 0x75, 0x75,
-  0x74, 0x74, 0x74, 0x76, 0x78, 0x7b, 0x7f, 0x82, 0x83, 0x84, 0x86, 0x86,
-  0x88, 0x89, 0x89, 0x88, 0x86, 0x84, 0x82, 0x82, 0x82, 0x82, 0x80, 0x80,
-  0x80, 0x81, 0x82, 0x84, 0x86, 0x88, 0x88, 0x8a, 0x8c, 0x8e, 0x90, 0x91,
-  0x92, 0x91, 0x8f, 0x8c, 0x89, 0x85, 0x82, 0x7f, 0x7c, 0x7a, 0x78, 0x77,
-  0x76, 0x74, 0x74, 0x75, 0x78, 0x7c, 0x80, 0x82, 0x84, 0x86, 0x88, 0x8a,
-  0x8a, 0x8b, 0x8a, 0x88, 0x85, 0x82, 0x80, 0x7e, 0x7a, 0x77, 0x74, 0x72,
-  0x71, 0x70, 0x70, 0x70, 0x71, 0x73, 0x76, 0x78, 0x7b, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x80, 0x80, 0x81, 0x7f, 0x7d, 0x7b, 0x79, 0x77, 0x76, 0x77, 0x78,
-  0x78, 0x77, 0x76, 0x77, 0x79, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x85, 0x87, 0x88,
-  0x89, 0x8a, 0x8a, 0x8a, 0x8b, 0x8c, 0x8d, 0x8d, 0x8c, 0x8a, 0x89, 0x88,
-  0x87, 0x86, 0x85, 0x84, 0x84, 0x84, 0x83, 0x83, 0x84, 0x85, 0x85, 0x86,
-  0x87, 0x88, 0x89, 0x88, 0x88, 0x89, 0x89, 0x87, 0x87, 0x86, 0x84, 0x81,
-  0x7e, 0x7c, 0x7a, 0x78, 0x77, 0x76, 0x75, 0x75, 0x76, 0x77, 0x79, 0x7a,
-  0x7b, 0x7e, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7f,
-  0x7e, 0x7b, 0x79, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x76, 0x76, 0x77,
-  0x78, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x80, 0x81, 0x81, 0x82, 0x83, 0x84, 0x86, 0x86, 0x86, 0x86, 0x85,
-  0x85, 0x85, 0x86, 0x86, 0x85, 0x86, 0x87, 0x87, 0x88, 0x8a, 0x8a, 0x8b,
-  0x8c, 0x8b, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8a, 0x88, 0x87, 0x86,
-  0x86, 0x85, 0x83, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7b,
-  0x7a, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x79, 0x78, 0x79, 0x7a, 0x79,
-  0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79,
-  0x7a, 0x7a, 0x7b, 0x7a, 0x79, 0x79, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x7d,
-  0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x85,
-  0x86, 0x86, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x86, 0x86, 0x86, 0x86, 0x85, 0x84, 0x84, 0x84,
-  0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-  0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x77, 0x77, 0x77, 0x78, 0x78,
-  0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7c, 0x7b, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7d, 0x7e,
-  0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x84, 0x84, 0x84, 0x84, 0x85, 0x87, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-  0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x87, 0x86, 0x84, 0x84, 0x84, 0x85, 0x85,
-  0x86, 0x86, 0x86, 0x85, 0x86, 0x86, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x79,
-  0x7a, 0x7a, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7a, 0x79,
-  0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x79,
-  0x78, 0x77, 0x76, 0x77, 0x77, 0x78, 0x79, 0x7a, 0x7a, 0x7b, 0x7d, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x86, 0x86,
-  0x87, 0x89, 0x89, 0x8a, 0x89, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x88,
-  0x87, 0x88, 0x88, 0x88, 0x88, 0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85,
-  0x85, 0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a,
-  0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x83, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x87,
-  0x86, 0x86, 0x88, 0x89, 0x89, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b,
-  0x89, 0x88, 0x88, 0x87, 0x86, 0x86, 0x85, 0x84, 0x85, 0x86, 0x86, 0x87,
-  0x87, 0x87, 0x87, 0x87, 0x86, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7c,
-  0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x79, 0x79,
-  0x79, 0x7a, 0x7b, 0x7c, 0x7b, 0x7b, 0x7a, 0x78, 0x78, 0x78, 0x78, 0x79,
-  0x78, 0x76, 0x75, 0x77, 0x78, 0x79, 0x78, 0x79, 0x7a, 0x7a, 0x7a, 0x7b,
-  0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x83, 0x84, 0x85, 0x85, 0x86, 0x86, 0x88,
-  0x88, 0x88, 0x87, 0x86, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x86, 0x86, 0x87, 0x88, 0x88, 0x87, 0x86, 0x85, 0x84, 0x85, 0x84, 0x83,
-  0x82, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x7a, 0x79, 0x78, 0x78, 0x77, 0x77, 0x77,
-  0x78, 0x78, 0x78, 0x78, 0x78, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b,
-  0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x83, 0x82, 0x83, 0x85, 0x86, 0x86,
-  0x86, 0x87, 0x87, 0x86, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x85, 0x85,
-  0x85, 0x85, 0x86, 0x85, 0x84, 0x84, 0x84, 0x84, 0x83, 0x82, 0x81, 0x80,
-  0x80, 0x81, 0x80, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7a, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82,
-  0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x84, 0x85, 0x86, 0x86, 0x87,
-  0x87, 0x88, 0x89, 0x88, 0x88, 0x88, 0x87, 0x86, 0x86, 0x85, 0x84, 0x83,
-  0x82, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x78,
-  0x78, 0x79, 0x7a, 0x7a, 0x79, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7b, 0x7c,
-  0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c,
-  0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x84, 0x84, 0x84, 0x85, 0x85,
-  0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x84, 0x84, 0x83, 0x82, 0x81, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c,
-  0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x7e, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83,
-  0x84, 0x85, 0x86, 0x86, 0x86, 0x87, 0x87, 0x86, 0x86, 0x85, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-  0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x83, 0x84,
-  0x84, 0x84, 0x84, 0x85, 0x85, 0x84, 0x85, 0x85, 0x85, 0x85, 0x84, 0x85,
-  0x85, 0x84, 0x84, 0x84, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83,
-  0x83, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7b, 0x7b, 0x7a,
-  0x7a, 0x79, 0x78, 0x78, 0x79, 0x7a, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x82, 0x82, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82,
-  0x82, 0x83, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x86, 0x85, 0x84, 0x83,
-  0x82, 0x83, 0x83, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7c, 0x7b, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x79, 0x7a, 0x7a, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7a, 0x7a, 0x7b, 0x7b, 0x7a, 0x7b, 0x7c,
-  0x7d, 0x7d, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83,
-  0x83, 0x84, 0x84, 0x84, 0x85, 0x84, 0x84, 0x85, 0x84, 0x83, 0x82, 0x82,
-  0x81, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82,
-  0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7b,
-  0x7b, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83,
-  0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7a, 0x79, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x81, 0x82, 0x84, 0x86, 0x87, 0x87, 0x87, 0x85, 0x82, 0x7f,
-  0x7c, 0x7a, 0x79, 0x7a, 0x7b, 0x7e, 0x82, 0x84, 0x85, 0x85, 0x85, 0x85,
-  0x84, 0x84, 0x82, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d,
-  0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x84, 0x85, 0x84,
-  0x84, 0x84, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x80,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7d,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7f, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x83, 0x82, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x84, 0x81, 0x7f, 0x7e, 0x7e,
-  0x82, 0x84, 0x84, 0x84, 0x81, 0x7d, 0x7e, 0x82, 0x80, 0x7d, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x7d, 0x7b, 0x7b, 0x7b, 0x7f, 0x86, 0x89, 0x86, 0x83,
-  0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7c, 0x7b, 0x7e, 0x80, 0x7e,
-  0x7f, 0x82, 0x82, 0x7d, 0x7c, 0x7f, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x7e, 0x7e, 0x7d, 0x7c, 0x7a, 0x7b, 0x7e, 0x82, 0x84, 0x84,
-  0x82, 0x80, 0x80, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-  0x83, 0x83, 0x82, 0x81, 0x81, 0x7f, 0x7d, 0x7c, 0x7d, 0x7c, 0x7c, 0x7e,
-  0x80, 0x82, 0x82, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x81,
-  0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82,
-  0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7e,
-  0x7e, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x82, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81,
-  0x82, 0x82, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x80, 0x7f, 0x7e,
-  0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80,
-  0x7e, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x7f,
-  0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x80, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e,
-  0x7f, 0x80, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x83, 0x83, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81,
-  0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7d,
-  0x7d, 0x7e, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x83, 0x83, 0x83, 0x84, 0x83, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x82, 0x82, 0x83, 0x83, 0x82, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7e,
-  0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e,
-  0x7f, 0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82,
-  0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e,
-  0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-  0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e,
-  0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x82,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7c, 0x7d, 0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x81, 0x82, 0x81,
-  0x81, 0x82, 0x81, 0x81, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f,
-  0x80, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x81,
-  0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
-  0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82,
-  0x81, 0x81, 0x81, 0x82, 0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x7f,
-  0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x82, 0x82, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82,
-  0x82, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7e,
-  0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7f,
-  0x80, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x82, 0x82, 0x80, 0x7c,
-  0x72, 0x66, 0x65, 0x79, 0x97, 0xa9, 0xb3, 0xac, 0x86, 0x6c, 0x72, 0x7f,
-  0x7d, 0x67, 0x4c, 0x51, 0x78, 0xa0, 0xb6, 0xad, 0x84, 0x63, 0x64, 0x80,
-  0x8f, 0x75, 0x4b, 0x3c, 0x58, 0x8e, 0xb5, 0xc8, 0xbb, 0x9c, 0x82, 0x5f,
-  0x3f, 0x3a, 0x54, 0x84, 0xad, 0xc3, 0xc2, 0xab, 0x84, 0x57, 0x43, 0x56,
-  0x6c, 0x70, 0x70, 0x7a, 0x97, 0xbd, 0xce, 0xbc, 0x96, 0x68, 0x3e, 0x2c,
-  0x3d, 0x68, 0x99, 0xc1, 0xcf, 0xa0, 0x60, 0x50, 0x62, 0x6b, 0x67, 0x6c,
-  0x84, 0xb0, 0xd6, 0xd9, 0xb4, 0x81, 0x57, 0x3f, 0x42, 0x66, 0x8e, 0x92,
-  0x78, 0x69, 0x88, 0xc0, 0xdc, 0xbe, 0x7c, 0x4b, 0x49, 0x66, 0x82, 0x92,
-  0x98, 0x94, 0x8a, 0x78, 0x65, 0x55, 0x46, 0x46, 0x61, 0x87, 0xa2, 0xae,
-  0xa7, 0x91, 0x7d, 0x73, 0x6c, 0x69, 0x65, 0x63, 0x6b, 0x7e, 0x94, 0x9e,
-  0x9e, 0x9e, 0x97, 0x82, 0x6e, 0x63, 0x60, 0x6b, 0x7f, 0x89, 0x8e, 0x9e,
-  0xae, 0xaf, 0x99, 0x7a, 0x72, 0x83, 0x98, 0x96, 0x7c, 0x5c, 0x49, 0x4c,
-  0x60, 0x72, 0x79, 0x7b, 0x78, 0x7c, 0x8e, 0xa0, 0x99, 0x74, 0x58, 0x64,
-  0x85, 0x9c, 0x98, 0x77, 0x5e, 0x69, 0x7b, 0x7d, 0x77, 0x74, 0x7d, 0x8f,
-  0x98, 0x8a, 0x70, 0x5d, 0x5c, 0x6a, 0x75, 0x76, 0x78, 0x89, 0x9e, 0xad,
-  0xaa, 0x90, 0x68, 0x50, 0x5a, 0x72, 0x7f, 0x7a, 0x74, 0x80, 0x9c, 0xab,
-  0x96, 0x69, 0x50, 0x60, 0x86, 0x9e, 0x9c, 0x8a, 0x7e, 0x83, 0x8d, 0x8e,
-  0x85, 0x73, 0x69, 0x6b, 0x6f, 0x73, 0x77, 0x7a, 0x7a, 0x7a, 0x72, 0x5f,
-  0x54, 0x62, 0x81, 0x9d, 0xa4, 0x8f, 0x70, 0x65, 0x71, 0x7e, 0x7c, 0x6e,
-  0x60, 0x64, 0x80, 0x9b, 0xa2, 0x9b, 0x8e, 0x7d, 0x6e, 0x67, 0x65, 0x6c,
-  0x80, 0x97, 0xa5, 0xa7, 0x9e, 0x92, 0x8d, 0x90, 0x8c, 0x7d, 0x72, 0x77,
-  0x89, 0xa1, 0xb4, 0xb2, 0x9c, 0x88, 0x7e, 0x78, 0x73, 0x70, 0x6d, 0x70,
-  0x7d, 0x90, 0x9e, 0xa3, 0x9b, 0x81, 0x58, 0x34, 0x2a, 0x40, 0x67, 0x89,
-  0x99, 0x9a, 0x8e, 0x7d, 0x6c, 0x5b, 0x4e, 0x52, 0x67, 0x85, 0x9c, 0xaa,
-  0xab, 0xa0, 0x90, 0x7a, 0x61, 0x53, 0x58, 0x6c, 0x86, 0x9e, 0xac, 0xaa,
-  0x9b, 0x86, 0x74, 0x68, 0x5d, 0x58, 0x63, 0x7e, 0x9b, 0xb1, 0xb8, 0xb1,
-  0x9f, 0x87, 0x6e, 0x5a, 0x5b, 0x6f, 0x89, 0x9f, 0xaf, 0xb6, 0xb5, 0xab,
-  0x98, 0x82, 0x75, 0x7a, 0x86, 0x92, 0x9e, 0xac, 0xbb, 0xc2, 0xb3, 0x90,
-  0x6a, 0x52, 0x52, 0x64, 0x76, 0x7e, 0x80, 0x82, 0x83, 0x7e, 0x70, 0x5b,
-  0x4a, 0x43, 0x4a, 0x58, 0x65, 0x6c, 0x72, 0x77, 0x7c, 0x7a, 0x72, 0x6a,
-  0x6d, 0x78, 0x80, 0x7c, 0x74, 0x73, 0x7c, 0x83, 0x80, 0x75, 0x6d, 0x75,
-  0x86, 0x91, 0x92, 0x8c, 0x89, 0x88, 0x87, 0x84, 0x7f, 0x7a, 0x7e, 0x8b,
-  0x9a, 0xa2, 0x9e, 0x8f, 0x82, 0x80, 0x86, 0x8a, 0x8a, 0x8e, 0x97, 0x9f,
-  0xa1, 0x9b, 0x93, 0x8f, 0x8c, 0x8a, 0x8a, 0x92, 0xa0, 0xab, 0xa5, 0x94,
-  0x85, 0x7f, 0x7d, 0x77, 0x6e, 0x68, 0x69, 0x6d, 0x6d, 0x68, 0x62, 0x5f,
-  0x60, 0x5f, 0x5a, 0x4f, 0x3f, 0x37, 0x42, 0x58, 0x70, 0x7c, 0x7d, 0x78,
-  0x74, 0x73, 0x70, 0x69, 0x64, 0x65, 0x67, 0x6c, 0x77, 0x89, 0x9e, 0xac,
-  0xa9, 0x96, 0x89, 0x8b, 0x94, 0x98, 0x94, 0x8e, 0x8d, 0x99, 0xac, 0xb9,
-  0xb8, 0xa7, 0x95, 0x91, 0x9c, 0xa6, 0xac, 0xab, 0xa6, 0x9e, 0x99, 0x96,
-  0x96, 0x97, 0x98, 0x96, 0x92, 0x94, 0x9a, 0x9e, 0x99, 0x89, 0x77, 0x6c,
-  0x69, 0x6c, 0x6c, 0x67, 0x5f, 0x5f, 0x68, 0x6e, 0x67, 0x57, 0x47, 0x3e,
-  0x38, 0x2f, 0x24, 0x25, 0x37, 0x57, 0x74, 0x81, 0x7e, 0x75, 0x6d, 0x66,
-  0x65, 0x6b, 0x76, 0x7a, 0x77, 0x7c, 0x8e, 0xa3, 0xb6, 0xbe, 0xb4, 0xa0,
-  0x98, 0xa2, 0xb5, 0xc2, 0xbe, 0xb0, 0xac, 0xb8, 0xc9, 0xcd, 0xbf, 0xaa,
-  0xa5, 0xae, 0xbc, 0xc6, 0xc6, 0xb8, 0x9f, 0x8c, 0x89, 0x8f, 0x93, 0x8d,
-  0x81, 0x73, 0x6c, 0x6c, 0x70, 0x70, 0x68, 0x5c, 0x55, 0x57, 0x5f, 0x63,
-  0x5f, 0x5a, 0x5a, 0x5d, 0x5b, 0x53, 0x48, 0x3b, 0x28, 0x13, 0x0a, 0x17,
-  0x39, 0x5d, 0x78, 0x85, 0x81, 0x73, 0x67, 0x68, 0x6f, 0x71, 0x6c, 0x6b,
-  0x73, 0x86, 0x9e, 0xb3, 0xbb, 0xb6, 0xaa, 0xa2, 0xa7, 0xbb, 0xd0, 0xd3,
-  0xc3, 0xb6, 0xbc, 0xc9, 0xcc, 0xbc, 0xa4, 0x95, 0x9c, 0xb3, 0xcc, 0xd6,
-  0xc8, 0xa7, 0x87, 0x76, 0x72, 0x6e, 0x63, 0x58, 0x55, 0x5c, 0x67, 0x6e,
-  0x6a, 0x5a, 0x4b, 0x4d, 0x5d, 0x6a, 0x6a, 0x63, 0x65, 0x6f, 0x73, 0x66,
-  0x4d, 0x31, 0x16, 0x06, 0x0a, 0x23, 0x47, 0x66, 0x76, 0x7c, 0x79, 0x71,
-  0x6a, 0x66, 0x64, 0x63, 0x66, 0x71, 0x85, 0x9b, 0xa7, 0xa4, 0x9e, 0x9e,
-  0xa4, 0xac, 0xbc, 0xd1, 0xde, 0xdc, 0xd5, 0xcf, 0xc9, 0xbc, 0xab, 0x9c,
-  0x97, 0x9d, 0xab, 0xba, 0xc4, 0xbb, 0xa3, 0x86, 0x70, 0x64, 0x5b, 0x54,
-  0x4d, 0x46, 0x42, 0x42, 0x44, 0x47, 0x48, 0x4a, 0x54, 0x64, 0x75, 0x7c,
-  0x7e, 0x82, 0x8a, 0x87, 0x70, 0x49, 0x25, 0x0d, 0x03, 0x0d, 0x2b, 0x4d,
-  0x64, 0x70, 0x75, 0x7c, 0x87, 0x8c, 0x87, 0x7c, 0x74, 0x75, 0x83, 0x96,
-  0x9e, 0x97, 0x88, 0x86, 0x96, 0xae, 0xc3, 0xd2, 0xdc, 0xe4, 0xe7, 0xe7,
-  0xe1, 0xcc, 0xa6, 0x82, 0x74, 0x7e, 0x8d, 0x97, 0x9b, 0x98, 0x8f, 0x83,
-  0x77, 0x6f, 0x68, 0x61, 0x5d, 0x5a, 0x56, 0x50, 0x47, 0x40, 0x3f, 0x45,
-  0x55, 0x69, 0x7a, 0x86, 0x8f, 0x9a, 0xa8, 0xb0, 0xa0, 0x76, 0x44, 0x1d,
-  0x0a, 0x0e, 0x26, 0x41, 0x50, 0x50, 0x50, 0x5e, 0x7c, 0x98, 0xa4, 0x9c,
-  0x8c, 0x88, 0x95, 0xa5, 0xa8, 0x98, 0x7d, 0x6f, 0x7c, 0x99, 0xb6, 0xc8,
-  0xd0, 0xd6, 0xe2, 0xef, 0xf4, 0xe7, 0xc5, 0x9c, 0x80, 0x7b, 0x83, 0x88,
-  0x84, 0x75, 0x64, 0x5a, 0x59, 0x5e, 0x64, 0x66, 0x66, 0x68, 0x6a, 0x69,
-  0x64, 0x5a, 0x50, 0x4c, 0x51, 0x62, 0x77, 0x89, 0x94, 0x9e, 0xaa, 0xb6,
-  0xae, 0x85, 0x50, 0x29, 0x18, 0x21, 0x3f, 0x59, 0x59, 0x45, 0x33, 0x3e,
-  0x6a, 0x9c, 0xb6, 0xae, 0x9a, 0x99, 0xb2, 0xd0, 0xd7, 0xb8, 0x8a, 0x73,
-  0x82, 0x9f, 0xb3, 0xb8, 0xb6, 0xbb, 0xc9, 0xdc, 0xe9, 0xe4, 0xc7, 0xa2,
-  0x8e, 0x90, 0x98, 0x96, 0x80, 0x5e, 0x3f, 0x32, 0x3a, 0x4a, 0x59, 0x60,
-  0x64, 0x6c, 0x79, 0x84, 0x86, 0x7d, 0x70, 0x6a, 0x74, 0x8b, 0x98, 0x92,
-  0x8b, 0x92, 0xa2, 0xa4, 0x86, 0x53, 0x29, 0x18, 0x27, 0x51, 0x76, 0x76,
-  0x50, 0x2b, 0x31, 0x5e, 0x92, 0xb0, 0xa9, 0x8c, 0x83, 0xa2, 0xd1, 0xe7,
-  0xd3, 0xa5, 0x88, 0x94, 0xb0, 0xc1, 0xbf, 0xb4, 0xb0, 0xbc, 0xd4, 0xe2,
-  0xd4, 0xb0, 0x90, 0x88, 0x94, 0xa1, 0x9b, 0x7c, 0x4e, 0x2a, 0x23, 0x35,
-  0x4b, 0x55, 0x54, 0x53, 0x5e, 0x72, 0x8b, 0x9a, 0x94, 0x88, 0x88, 0x98,
-  0xa8, 0xab, 0xa1, 0x9f, 0xa5, 0xa2, 0x8a, 0x5b, 0x2c, 0x12, 0x18, 0x3f,
-  0x67, 0x6a, 0x48, 0x25, 0x27, 0x53, 0x8c, 0xb3, 0xb3, 0x94, 0x7b, 0x8b,
-  0xb6, 0xd3, 0xcf, 0xb0, 0x91, 0x8b, 0x9b, 0xaf, 0xb8, 0xb4, 0xaf, 0xb4,
-  0xc7, 0xd9, 0xd8, 0xbe, 0x9c, 0x88, 0x8a, 0x94, 0x96, 0x7e, 0x50, 0x25,
-  0x19, 0x2d, 0x46, 0x51, 0x4d, 0x46, 0x4c, 0x62, 0x7d, 0x91, 0x95, 0x8c,
-  0x89, 0x92, 0xa2, 0xa8, 0x9f, 0x8f, 0x89, 0x92, 0x95, 0x7a, 0x42, 0x0e,
-  0x00, 0x0f, 0x42, 0x6b, 0x6b, 0x3d, 0x0c, 0x12, 0x52, 0xa2, 0xce, 0xc5,
-  0x8b, 0x5c, 0x6e, 0xab, 0xda, 0xdf, 0xb4, 0x7d, 0x6e, 0x8c, 0xae, 0xb6,
-  0xa6, 0x94, 0x95, 0xae, 0xcd, 0xd7, 0xc0, 0x94, 0x71, 0x72, 0x88, 0x91,
-  0x77, 0x40, 0x10, 0x06, 0x23, 0x48, 0x5b, 0x53, 0x3f, 0x40, 0x5d, 0x86,
-  0xa2, 0xa8, 0x99, 0x8e, 0x96, 0xa3, 0xa1, 0x8d, 0x75, 0x6f, 0x81, 0x97,
-  0x8c, 0x54, 0x11, 0x00, 0x00, 0x37, 0x6e, 0x7c, 0x4f, 0x0e, 0x02, 0x3a,
-  0x8d, 0xc7, 0xc2, 0x83, 0x49, 0x56, 0x98, 0xd4, 0xe4, 0xc1, 0x8b, 0x79,
-  0x96, 0xb6, 0xb8, 0xa2, 0x8e, 0x98, 0xbe, 0xdf, 0xdc, 0xab, 0x6e, 0x55,
-  0x69, 0x8c, 0x94, 0x6c, 0x2b, 0x02, 0x08, 0x30, 0x56, 0x61, 0x4f, 0x3a,
-  0x45, 0x6f, 0x9d, 0xb7, 0xb8, 0xab, 0xa3, 0xa9, 0xb3, 0xaf, 0x99, 0x7c,
-  0x76, 0x8a, 0x9a, 0x8b, 0x58, 0x1e, 0x00, 0x02, 0x2e, 0x5c, 0x69, 0x45,
-  0x14, 0x0b, 0x37, 0x77, 0xab, 0xb4, 0x8d, 0x62, 0x66, 0x97, 0xc9, 0xe1,
-  0xd4, 0xb2, 0x9d, 0xa7, 0xbe, 0xc6, 0xbe, 0xb4, 0xb9, 0xcd, 0xde, 0xd8,
-  0xb7, 0x8e, 0x78, 0x7e, 0x89, 0x80, 0x5c, 0x2d, 0x0c, 0x0a, 0x20, 0x33,
-  0x37, 0x30, 0x2e, 0x41, 0x67, 0x8f, 0xae, 0xbe, 0xc5, 0xc8, 0xcf, 0xd4,
-  0xcf, 0xc0, 0xae, 0xa6, 0xaa, 0xab, 0x94, 0x65, 0x32, 0x0e, 0x08, 0x24,
-  0x47, 0x54, 0x3f, 0x1a, 0x10, 0x34, 0x70, 0xa9, 0xbc, 0x9f, 0x73, 0x6d,
-  0x97, 0xcc, 0xe5, 0xd7, 0xb1, 0x96, 0x9c, 0xb6, 0xc6, 0xc4, 0xbe, 0xc2,
-  0xd2, 0xdf, 0xd8, 0xbc, 0x9f, 0x95, 0x9c, 0x9c, 0x87, 0x5f, 0x34, 0x1b,
-  0x1c, 0x2a, 0x32, 0x2d, 0x26, 0x2c, 0x46, 0x6c, 0x92, 0xad, 0xb9, 0xbe,
-  0xc3, 0xcb, 0xce, 0xca, 0xc4, 0xbe, 0xba, 0xb6, 0xa9, 0x86, 0x56, 0x2e,
-  0x17, 0x1a, 0x36, 0x4f, 0x4d, 0x30, 0x18, 0x20, 0x4e, 0x8a, 0xb5, 0xb9,
-  0x9a, 0x83, 0x95, 0xc4, 0xea, 0xee, 0xce, 0xa3, 0x92, 0xa0, 0xb3, 0xb6,
-  0xab, 0xa2, 0xa5, 0xb0, 0xb4, 0xa9, 0x99, 0x90, 0x91, 0x94, 0x8b, 0x72,
-  0x4f, 0x35, 0x2e, 0x35, 0x38, 0x31, 0x26, 0x27, 0x3b, 0x5a, 0x7b, 0x93,
-  0x9e, 0xa8, 0xb7, 0xc4, 0xcc, 0xcd, 0xca, 0xc6, 0xc3, 0xc1, 0xba, 0xa3,
-  0x78, 0x46, 0x1e, 0x11, 0x24, 0x3e, 0x46, 0x32, 0x10, 0x06, 0x2a, 0x64,
-  0x95, 0xa9, 0x9c, 0x88, 0x98, 0xc8, 0xf2, 0xfa, 0xde, 0xb6, 0xa8, 0xb6,
-  0xc2, 0xb6, 0x9d, 0x8a, 0x8c, 0x9c, 0xa2, 0x94, 0x7c, 0x70, 0x77, 0x83,
-  0x82, 0x6b, 0x4d, 0x37, 0x32, 0x35, 0x32, 0x24, 0x16, 0x1c, 0x36, 0x56,
-  0x73, 0x8c, 0x9f, 0xb4, 0xd0, 0xe5, 0xed, 0xeb, 0xe6, 0xe0, 0xdb, 0xd1,
-  0xbe, 0xa7, 0x8a, 0x6b, 0x4a, 0x2a, 0x12, 0x0c, 0x17, 0x26, 0x2e, 0x27,
-  0x1c, 0x26, 0x49, 0x79, 0xa1, 0xb0, 0xa9, 0xa3, 0xb4, 0xd1, 0xe4, 0xdc,
-  0xc0, 0xa9, 0xaa, 0xb9, 0xbe, 0xb5, 0xa5, 0x9a, 0x9d, 0xaa, 0xb0, 0xaa,
-  0x9c, 0x8e, 0x84, 0x78, 0x62, 0x46, 0x2d, 0x1d, 0x15, 0x13, 0x11, 0x0f,
-  0x16, 0x29, 0x4a, 0x70, 0x91, 0xac, 0xc3, 0xd4, 0xe0, 0xe7, 0xea, 0xea,
-  0xe2, 0xd6, 0xc6, 0xb1, 0x9c, 0x85, 0x65, 0x3b, 0x19, 0x09, 0x12, 0x29,
-  0x3f, 0x41, 0x2a, 0x18, 0x2d, 0x61, 0x9a, 0xbf, 0xc2, 0xa5, 0x95, 0xa9,
-  0xcc, 0xe0, 0xd3, 0xad, 0x95, 0x9f, 0xb0, 0xb5, 0xac, 0x9c, 0x92, 0x9d,
-  0xac, 0xb1, 0xaa, 0x9b, 0x8b, 0x7e, 0x72, 0x5f, 0x49, 0x34, 0x26, 0x1f,
-  0x1a, 0x18, 0x1c, 0x25, 0x37, 0x4f, 0x6a, 0x86, 0xa1, 0xb7, 0xca, 0xd6,
-  0xda, 0xda, 0xdb, 0xd8, 0xcf, 0xc1, 0xab, 0x97, 0x87, 0x73, 0x56, 0x31,
-  0x14, 0x0c, 0x1e, 0x40, 0x58, 0x51, 0x34, 0x25, 0x3b, 0x70, 0xa9, 0xc5,
-  0xba, 0x98, 0x8b, 0xa3, 0xc8, 0xdc, 0xcf, 0xae, 0x9c, 0xa5, 0xb5, 0xbc,
-  0xb3, 0x9f, 0x94, 0x9c, 0xab, 0xae, 0x9e, 0x80, 0x64, 0x54, 0x4a, 0x41,
-  0x34, 0x24, 0x17, 0x14, 0x19, 0x24, 0x36, 0x50, 0x70, 0x90, 0xab, 0xc1,
-  0xd0, 0xdb, 0xe1, 0xe2, 0xe0, 0xda, 0xce, 0xbd, 0xa9, 0x91, 0x7a, 0x66,
-  0x50, 0x34, 0x18, 0x06, 0x08, 0x1d, 0x36, 0x48, 0x44, 0x33, 0x32, 0x52,
-  0x89, 0xb8, 0xce, 0xc2, 0xa0, 0x94, 0xaf, 0xd6, 0xe5, 0xd7, 0xba, 0xa8,
-  0xab, 0xb9, 0xc0, 0xb7, 0xa2, 0x93, 0x91, 0x96, 0x97, 0x86, 0x64, 0x46,
-  0x37, 0x33, 0x32, 0x2c, 0x1e, 0x0f, 0x0a, 0x12, 0x23, 0x3d, 0x5e, 0x7d,
-  0x96, 0xb0, 0xc8, 0xdc, 0xe8, 0xf0, 0xf0, 0xed, 0xe5, 0xd7, 0xc4, 0xac,
-  0x90, 0x77, 0x69, 0x5c, 0x49, 0x2e, 0x10, 0x00, 0x00, 0x18, 0x3d, 0x5a,
-  0x5e, 0x45, 0x2f, 0x3e, 0x6d, 0xa6, 0xc9, 0xc4, 0xa2, 0x87, 0x92, 0xb4,
-  0xd3, 0xde, 0xd4, 0xc3, 0xbc, 0xc2, 0xca, 0xc7, 0xb8, 0xa7, 0x9c, 0x94,
-  0x8b, 0x7a, 0x5e, 0x3d, 0x24, 0x1a, 0x1b, 0x1a, 0x11, 0x06, 0x02, 0x09,
-  0x1d, 0x3f, 0x63, 0x7d, 0x99, 0xb5, 0xcc, 0xdc, 0xe9, 0xf1, 0xf2, 0xee,
-  0xe5, 0xd3, 0xba, 0x9b, 0x7a, 0x61, 0x56, 0x52, 0x4e, 0x44, 0x2f, 0x11,
-  0x00, 0x0a, 0x2d, 0x59, 0x83, 0x8c, 0x67, 0x39, 0x30, 0x50, 0x84, 0xb6,
-  0xc8, 0xab, 0x7c, 0x6e, 0x8f, 0xc5, 0xee, 0xfa, 0xee, 0xd7, 0xc5, 0xc4,
-  0xcf, 0xd3, 0xc6, 0xa9, 0x86, 0x68, 0x51, 0x3a, 0x22, 0x0d, 0x00, 0x00,
-  0x04, 0x0e, 0x17, 0x1f, 0x2c, 0x46, 0x6f, 0x97, 0xb6, 0xca, 0xcf, 0xcd,
-  0xce, 0xd4, 0xd6, 0xd0, 0xbd, 0x9e, 0x80, 0x6a, 0x5b, 0x58, 0x5c, 0x5a,
-  0x50, 0x3a, 0x1e, 0x10, 0x1d, 0x3f, 0x66, 0x85, 0x87, 0x60, 0x34, 0x2e,
-  0x50, 0x86, 0xb5, 0xbb, 0x92, 0x64, 0x63, 0x95, 0xd3, 0xf6, 0xfa, 0xe8,
-  0xd1, 0xc5, 0xcc, 0xda, 0xdb, 0xc5, 0x9f, 0x7b, 0x5f, 0x4a, 0x35, 0x23,
-  0x15, 0x0d, 0x10, 0x1b, 0x27, 0x30, 0x3c, 0x51, 0x73, 0x9b, 0xbb, 0xce,
-  0xd5, 0xd3, 0xce, 0xcb, 0xcd, 0xc8, 0xb8, 0xa2, 0x8c, 0x7c, 0x73, 0x67,
-  0x4f, 0x33, 0x1e, 0x15, 0x21, 0x3e, 0x5a, 0x69, 0x60, 0x47, 0x3b, 0x52,
-  0x81, 0xb3, 0xd2, 0xc9, 0x9e, 0x74, 0x75, 0xa1, 0xd2, 0xec, 0xe4, 0xc2,
-  0x9e, 0x90, 0x9d, 0xb4, 0xbe, 0xb3, 0x96, 0x77, 0x60, 0x52, 0x4a, 0x43,
-  0x3d, 0x39, 0x39, 0x39, 0x37, 0x3b, 0x48, 0x5b, 0x74, 0x92, 0xab, 0xb7,
-  0xba, 0xbc, 0xc4, 0xcd, 0xd2, 0xd0, 0xc5, 0xb3, 0xa3, 0x9b, 0x99, 0x96,
-  0x8a, 0x71, 0x4e, 0x2d, 0x1d, 0x22, 0x38, 0x53, 0x5d, 0x4d, 0x32, 0x26,
-  0x3c, 0x6d, 0xa3, 0xcb, 0xd5, 0xb4, 0x8d, 0x90, 0xc1, 0xf6, 0xff, 0xff,
-  0xda, 0xa8, 0x8d, 0x93, 0xab, 0xb7, 0xa6, 0x7c, 0x55, 0x40, 0x3b, 0x3e,
-  0x3e, 0x3b, 0x3c, 0x41, 0x45, 0x47, 0x4a, 0x54, 0x69, 0x89, 0xaa, 0xbf,
-  0xc7, 0xc3, 0xbe, 0xc4, 0xd2, 0xdd, 0xdc, 0xcb, 0xae, 0x96, 0x8a, 0x8a,
-  0x8d, 0x8a, 0x7d, 0x64, 0x46, 0x2a, 0x1b, 0x22, 0x35, 0x4a, 0x5a, 0x53,
-  0x38, 0x2a, 0x3c, 0x6a, 0x9b, 0xbf, 0xcd, 0xbe, 0xa8, 0xac, 0xd1, 0xfb,
-  0xff, 0xff, 0xe9, 0xc3, 0xa8, 0xa2, 0xa8, 0xa8, 0x94, 0x69, 0x43, 0x30,
-  0x28, 0x27, 0x2d, 0x32, 0x36, 0x3b, 0x3f, 0x49, 0x5b, 0x74, 0x90, 0xae,
-  0xc8, 0xd6, 0xd3, 0xca, 0xc9, 0xcd, 0xd0, 0xce, 0xc2, 0xa5, 0x84, 0x6c,
-  0x5d, 0x59, 0x5e, 0x65, 0x6b, 0x70, 0x6d, 0x5b, 0x42, 0x34, 0x3b, 0x54,
-  0x76, 0x8c, 0x85, 0x62, 0x3e, 0x37, 0x57, 0x8a, 0xb6, 0xcf, 0xc7, 0xa7,
-  0x97, 0xad, 0xd4, 0xf4, 0xff, 0xf5, 0xd1, 0xa9, 0x8d, 0x88, 0x93, 0x94,
-  0x7a, 0x51, 0x2b, 0x12, 0x0e, 0x1c, 0x2c, 0x37, 0x3d, 0x3c, 0x43, 0x5a,
-  0x7c, 0xa1, 0xc0, 0xd3, 0xdb, 0xda, 0xd4, 0xcc, 0xca, 0xc8, 0xc1, 0xb0,
-  0x94, 0x73, 0x58, 0x4a, 0x4e, 0x5c, 0x65, 0x5a, 0x3a, 0x19, 0x0e, 0x23,
-  0x4a, 0x73, 0x86, 0x72, 0x44, 0x2a, 0x39, 0x6c, 0xa8, 0xcd, 0xcd, 0xa7,
-  0x80, 0x89, 0xbe, 0xf4, 0xff, 0xff, 0xe2, 0xbc, 0xa9, 0xb0, 0xbe, 0xbb,
-  0x9b, 0x6b, 0x42, 0x2a, 0x20, 0x1e, 0x1e, 0x1a, 0x17, 0x1a, 0x24, 0x33,
-  0x49, 0x68, 0x8e, 0xb0, 0xc9, 0xd2, 0xd2, 0xd0, 0xd0, 0xd4, 0xd7, 0xce,
-  0xb2, 0x8d, 0x69, 0x4e, 0x44, 0x48, 0x4c, 0x49, 0x42, 0x3a, 0x32, 0x2e,
-  0x37, 0x4c, 0x65, 0x7e, 0x8e, 0x8e, 0x81, 0x73, 0x70, 0x7c, 0x91, 0xa3,
-  0xaa, 0xa5, 0x9b, 0x97, 0x9e, 0xaf, 0xc3, 0xd1, 0xd3, 0xc8, 0xb1, 0x9b,
-  0x8f, 0x8a, 0x82, 0x74, 0x5c, 0x3a, 0x1e, 0x10, 0x10, 0x19, 0x22, 0x26,
-  0x2a, 0x30, 0x41, 0x5d, 0x81, 0xa2, 0xbc, 0xcb, 0xd0, 0xd0, 0xd0, 0xd2,
-  0xd1, 0xca, 0xbb, 0xa4, 0x87, 0x6e, 0x60, 0x5f, 0x65, 0x5f, 0x4a, 0x2a,
-  0x0e, 0x0b, 0x23, 0x49, 0x6b, 0x77, 0x5d, 0x35, 0x27, 0x45, 0x80, 0xb8,
-  0xd3, 0xc4, 0x91, 0x6d, 0x84, 0xc0, 0xf4, 0xff, 0xf8, 0xce, 0xa0, 0x8e,
-  0xa0, 0xc0, 0xc9, 0xaa, 0x73, 0x45, 0x2a, 0x21, 0x25, 0x2c, 0x2c, 0x22,
-  0x15, 0x0f, 0x19, 0x33, 0x5a, 0x84, 0xa2, 0xb4, 0xb9, 0xb9, 0xbe, 0xce,
-  0xde, 0xe2, 0xd8, 0xbe, 0x9b, 0x7d, 0x70, 0x70, 0x70, 0x60, 0x42, 0x24,
-  0x11, 0x0a, 0x11, 0x26, 0x3e, 0x50, 0x51, 0x40, 0x37, 0x45, 0x6c, 0xa1,
-  0xc8, 0xd6, 0xc2, 0x9e, 0x92, 0xaf, 0xdb, 0xf7, 0xf8, 0xde, 0xb5, 0x96,
-  0x92, 0x9f, 0xab, 0xa3, 0x80, 0x56, 0x37, 0x29, 0x25, 0x27, 0x2b, 0x2b,
-  0x27, 0x20, 0x1f, 0x2a, 0x42, 0x64, 0x89, 0xa6, 0xb3, 0xb4, 0xb6, 0xc1,
-  0xd4, 0xe4, 0xe7, 0xd9, 0xbe, 0xa3, 0x90, 0x85, 0x7a, 0x6a, 0x56, 0x42,
-  0x36, 0x3a, 0x47, 0x4c, 0x43, 0x37, 0x36, 0x3d, 0x51, 0x6c, 0x7e, 0x85,
-  0x7c, 0x6e, 0x6c, 0x7c, 0x96, 0xb2, 0xc6, 0xc5, 0xb6, 0xaa, 0xab, 0xbd,
-  0xd4, 0xe1, 0xda, 0xbc, 0x93, 0x77, 0x77, 0x84, 0x84, 0x68, 0x3e, 0x1c,
-  0x0d, 0x14, 0x26, 0x35, 0x38, 0x32, 0x30, 0x3f, 0x61, 0x8c, 0xaf, 0xc3,
-  0xcd, 0xd0, 0xd0, 0xd1, 0xd8, 0xdc, 0xd8, 0xc7, 0xaa, 0x88, 0x6a, 0x57,
-  0x52, 0x54, 0x54, 0x4c, 0x3c, 0x2f, 0x29, 0x2b, 0x38, 0x4d, 0x66, 0x78,
-  0x7b, 0x70, 0x65, 0x68, 0x7d, 0x9d, 0xbc, 0xcd, 0xc6, 0xb0, 0xa3, 0xaf,
-  0xcd, 0xe9, 0xf4, 0xea, 0xcd, 0xac, 0x98, 0x98, 0xa0, 0x9c, 0x85, 0x61,
-  0x3c, 0x22, 0x18, 0x1e, 0x2b, 0x32, 0x2e, 0x26, 0x27, 0x39, 0x5e, 0x88,
-  0xa9, 0xc0, 0xcc, 0xce, 0xd0, 0xd7, 0xe3, 0xe9, 0xe4, 0xd1, 0xb2, 0x91,
-  0x74, 0x61, 0x54, 0x48, 0x3b, 0x2e, 0x26, 0x2a, 0x3d, 0x55, 0x67, 0x6e,
-  0x6c, 0x6c, 0x77, 0x8d, 0xa3, 0xaf, 0xad, 0x9e, 0x89, 0x7a, 0x7c, 0x8b,
-  0xa2, 0xb6, 0xbd, 0xb4, 0xa9, 0xa7, 0xb0, 0xc0, 0xd0, 0xd6, 0xc7, 0xa4,
-  0x82, 0x6d, 0x66, 0x62, 0x5b, 0x46, 0x2a, 0x14, 0x0c, 0x14, 0x27, 0x3d,
-  0x4d, 0x56, 0x5f, 0x75, 0x9b, 0xc0, 0xd9, 0xe5, 0xe6, 0xe0, 0xda, 0xd9,
-  0xda, 0xd0, 0xba, 0x9e, 0x7c, 0x5e, 0x49, 0x3d, 0x3b, 0x40, 0x49, 0x4d,
-  0x45, 0x37, 0x32, 0x41, 0x65, 0x8f, 0xaa, 0xa6, 0x85, 0x64, 0x5f, 0x78,
-  0x9d, 0xba, 0xc0, 0xad, 0x94, 0x8d, 0x9f, 0xc0, 0xde, 0xec, 0xe8, 0xd4,
-  0xb8, 0xa6, 0xa4, 0xaa, 0xa8, 0x93, 0x6e, 0x46, 0x2a, 0x20, 0x23, 0x29,
-  0x29, 0x24, 0x1f, 0x23, 0x38, 0x5f, 0x86, 0xa7, 0xc1, 0xcc, 0xce, 0xd3,
-  0xdc, 0xe3, 0xe6, 0xe0, 0xc9, 0xa5, 0x80, 0x68, 0x5b, 0x50, 0x44, 0x35,
-  0x26, 0x21, 0x2e, 0x49, 0x68, 0x7d, 0x80, 0x7b, 0x81, 0x96, 0xb2, 0xc6,
-  0xc6, 0xb3, 0x94, 0x77, 0x6b, 0x73, 0x83, 0x90, 0x9a, 0x9c, 0x96, 0x92,
-  0x9d, 0xb2, 0xc8, 0xd6, 0xd3, 0xbf, 0xa2, 0x8c, 0x7e, 0x76, 0x6b, 0x59,
-  0x3f, 0x27, 0x19, 0x14, 0x19, 0x28, 0x3d, 0x4c, 0x55, 0x63, 0x82, 0xa8,
-  0xc8, 0xde, 0xe6, 0xe0, 0xd9, 0xd7, 0xd8, 0xd5, 0xc8, 0xad, 0x87, 0x65,
-  0x4e, 0x40, 0x3a, 0x3a, 0x3d, 0x3e, 0x3e, 0x3d, 0x3c, 0x45, 0x5c, 0x7e,
-  0x9e, 0xac, 0x9f, 0x83, 0x73, 0x7b, 0x91, 0xa3, 0xaa, 0xa3, 0x91, 0x86,
-  0x8e, 0xa5, 0xbd, 0xcd, 0xd3, 0xd1, 0xc4, 0xb0, 0xa4, 0xa2, 0xa2, 0x97,
-  0x7d, 0x5b, 0x3d, 0x28, 0x20, 0x22, 0x26, 0x24, 0x1d, 0x1a, 0x23, 0x3f,
-  0x66, 0x87, 0xa2, 0xb6, 0xc2, 0xc9, 0xd2, 0xdb, 0xe1, 0xdf, 0xd3, 0xbe,
-  0xa4, 0x89, 0x70, 0x5c, 0x4d, 0x3f, 0x30, 0x24, 0x21, 0x2b, 0x40, 0x5a,
-  0x70, 0x78, 0x74, 0x75, 0x86, 0xa2, 0xbc, 0xc4, 0xb3, 0x95, 0x7d, 0x75,
-  0x7b, 0x86, 0x8e, 0x8e, 0x8c, 0x8e, 0x95, 0x9e, 0xa8, 0xb3, 0xbe, 0xc3,
-  0xbe, 0xae, 0x9a, 0x88, 0x78, 0x6b, 0x5e, 0x4d, 0x3a, 0x28, 0x1c, 0x16,
-  0x1a, 0x29, 0x3c, 0x4c, 0x58, 0x68, 0x81, 0xa3, 0xc4, 0xd6, 0xda, 0xd8,
-  0xd6, 0xd4, 0xd4, 0xd2, 0xc3, 0xa6, 0x85, 0x69, 0x54, 0x43, 0x37, 0x30,
-  0x30, 0x35, 0x3c, 0x3e, 0x3e, 0x42, 0x4f, 0x69, 0x89, 0xa2, 0xa8, 0x9c,
-  0x8a, 0x84, 0x8d, 0x9c, 0xa5, 0xa6, 0x9e, 0x94, 0x8e, 0x90, 0x9c, 0xaa,
-  0xb8, 0xc0, 0xba, 0xaa, 0x97, 0x89, 0x82, 0x81, 0x7c, 0x69, 0x4d, 0x33,
-  0x23, 0x1e, 0x23, 0x28, 0x29, 0x2a, 0x2e, 0x3a, 0x50, 0x70, 0x91, 0xaa,
-  0xba, 0xc2, 0xc5, 0xc9, 0xd0, 0xd6, 0xd5, 0xc8, 0xb1, 0x94, 0x7a, 0x65,
-  0x56, 0x47, 0x38, 0x2a, 0x24, 0x26, 0x31, 0x44, 0x57, 0x61, 0x62, 0x64,
-  0x70, 0x85, 0x9d, 0xb0, 0xb3, 0xa5, 0x91, 0x80, 0x7d, 0x89, 0x96, 0x9b,
-  0x98, 0x91, 0x8c, 0x8c, 0x94, 0xa1, 0xac, 0xaf, 0xa8, 0x98, 0x87, 0x7b,
-  0x73, 0x67, 0x59, 0x49, 0x39, 0x2e, 0x27, 0x24, 0x25, 0x2c, 0x39, 0x4a,
-  0x5b, 0x6b, 0x80, 0x99, 0xb1, 0xc4, 0xcd, 0xcf, 0xce, 0xcd, 0xcc, 0xc6,
-  0xb8, 0xa0, 0x84, 0x69, 0x56, 0x4a, 0x40, 0x38, 0x33, 0x36, 0x42, 0x4c,
-  0x50, 0x4d, 0x4f, 0x5f, 0x7a, 0x96, 0xa7, 0xa1, 0x86, 0x70, 0x6f, 0x82,
-  0x9a, 0xa8, 0xa2, 0x8c, 0x79, 0x78, 0x8d, 0xaa, 0xc2, 0xcc, 0xc3, 0xaa,
-  0x91, 0x8c, 0x97, 0xa4, 0xa0, 0x83, 0x58, 0x38, 0x2b, 0x2e, 0x37, 0x3d,
-  0x36, 0x28, 0x22, 0x2f, 0x4f, 0x77, 0x96, 0xaa, 0xb3, 0xb6, 0xbd, 0xca,
-  0xd6, 0xde, 0xdb, 0xcb, 0xb1, 0x96, 0x81, 0x74, 0x6a, 0x5b, 0x45, 0x2e,
-  0x21, 0x23, 0x33, 0x4a, 0x5e, 0x65, 0x5c, 0x56, 0x63, 0x81, 0xa4, 0xbe,
-  0xc0, 0xaa, 0x90, 0x86, 0x8e, 0x9e, 0xaa, 0xab, 0x9f, 0x8f, 0x86, 0x8b,
-  0x9a, 0xa9, 0xb4, 0xb3, 0xa6, 0x93, 0x86, 0x82, 0x84, 0x80, 0x71, 0x5b,
-  0x46, 0x3a, 0x37, 0x39, 0x3b, 0x3e, 0x44, 0x4e, 0x5a, 0x6a, 0x80, 0x9a,
-  0xb4, 0xc5, 0xc9, 0xc8, 0xca, 0xd0, 0xd4, 0xd0, 0xc1, 0xa8, 0x8e, 0x78,
-  0x6a, 0x60, 0x54, 0x45, 0x3a, 0x38, 0x43, 0x50, 0x57, 0x57, 0x56, 0x5d,
-  0x6e, 0x84, 0x96, 0x9c, 0x96, 0x8c, 0x86, 0x89, 0x93, 0x9f, 0xa6, 0xa6,
-  0xa0, 0x98, 0x97, 0x9f, 0xad, 0xbb, 0xc0, 0xb6, 0xa2, 0x8e, 0x87, 0x8b,
-  0x8e, 0x86, 0x6f, 0x54, 0x40, 0x39, 0x3b, 0x3f, 0x43, 0x43, 0x42, 0x47,
-  0x56, 0x6e, 0x8c, 0xa8, 0xb9, 0xc0, 0xc2, 0xc6, 0xce, 0xd4, 0xd4, 0xca,
-  0xb6, 0x9e, 0x88, 0x79, 0x6d, 0x5f, 0x4f, 0x3f, 0x34, 0x35, 0x41, 0x51,
-  0x5f, 0x63, 0x5f, 0x5e, 0x69, 0x81, 0x9a, 0xac, 0xad, 0x9f, 0x92, 0x8c,
-  0x92, 0x9c, 0xa4, 0xa4, 0x9f, 0x97, 0x90, 0x91, 0x96, 0x9e, 0xa7, 0xaa,
-  0xa2, 0x95, 0x88, 0x82, 0x82, 0x80, 0x79, 0x6b, 0x5b, 0x4f, 0x49, 0x46,
-  0x45, 0x46, 0x4d, 0x55, 0x5d, 0x65, 0x71, 0x83, 0x9a, 0xad, 0xba, 0xc1,
-  0xc3, 0xc4, 0xc8, 0xca, 0xc7, 0xbb, 0xa7, 0x92, 0x82, 0x75, 0x68, 0x5b,
-  0x4e, 0x44, 0x42, 0x48, 0x54, 0x5e, 0x63, 0x61, 0x5e, 0x66, 0x77, 0x89,
-  0x98, 0x9d, 0x96, 0x8b, 0x85, 0x89, 0x92, 0x9c, 0xa2, 0xa1, 0x9b, 0x93,
-  0x90, 0x96, 0xa2, 0xb0, 0xb7, 0xb2, 0xa2, 0x91, 0x8a, 0x8d, 0x91, 0x8e,
-  0x80, 0x69, 0x54, 0x48, 0x46, 0x4a, 0x4e, 0x4d, 0x4a, 0x48, 0x50, 0x61,
-  0x78, 0x90, 0xa3, 0xae, 0xb3, 0xb7, 0xbf, 0xc9, 0xce, 0xcc, 0xc1, 0xaf,
-  0x9c, 0x8d, 0x81, 0x76, 0x6a, 0x5a, 0x48, 0x3e, 0x3e, 0x47, 0x53, 0x5a,
-  0x58, 0x50, 0x50, 0x5e, 0x76, 0x8e, 0x9c, 0x9a, 0x8b, 0x83, 0x87, 0x94,
-  0xa3, 0xaa, 0xa8, 0xa1, 0x98, 0x94, 0x98, 0xa2, 0xab, 0xb0, 0xa8, 0x9b,
-  0x8f, 0x87, 0x87, 0x87, 0x81, 0x73, 0x62, 0x53, 0x4b, 0x48, 0x48, 0x49,
-  0x4a, 0x4b, 0x4e, 0x55, 0x61, 0x74, 0x88, 0x9a, 0xa6, 0xae, 0xb3, 0xb9,
-  0xc0, 0xc6, 0xc6, 0xbb, 0xab, 0x9a, 0x8e, 0x84, 0x79, 0x6b, 0x5c, 0x4f,
-  0x46, 0x46, 0x52, 0x5f, 0x63, 0x5b, 0x4f, 0x4e, 0x5e, 0x76, 0x89, 0x8f,
-  0x83, 0x71, 0x6a, 0x73, 0x88, 0x9c, 0xa6, 0xa0, 0x91, 0x86, 0x8a, 0x9c,
-  0xb2, 0xc1, 0xc0, 0xae, 0x97, 0x8a, 0x8e, 0x9c, 0xa3, 0x97, 0x79, 0x5a,
-  0x46, 0x43, 0x4b, 0x52, 0x4d, 0x3f, 0x31, 0x30, 0x3f, 0x58, 0x72, 0x86,
-  0x91, 0x96, 0x9a, 0xa6, 0xb8, 0xc9, 0xce, 0xc7, 0xb8, 0xa6, 0x9a, 0x94,
-  0x90, 0x85, 0x71, 0x57, 0x40, 0x36, 0x3b, 0x4a, 0x54, 0x52, 0x45, 0x38,
-  0x3b, 0x51, 0x6d, 0x84, 0x8c, 0x85, 0x78, 0x77, 0x87, 0x9d, 0xad, 0xb2,
-  0xac, 0xa0, 0x99, 0x9b, 0xa3, 0xad, 0xb1, 0xac, 0x9e, 0x90, 0x88, 0x86,
-  0x88, 0x85, 0x78, 0x66, 0x56, 0x4d, 0x4c, 0x4e, 0x4e, 0x4a, 0x47, 0x47,
-  0x4c, 0x57, 0x66, 0x76, 0x84, 0x8e, 0x97, 0x9f, 0xa8, 0xb3, 0xbc, 0xbf,
-  0xbb, 0xb2, 0xa6, 0x9c, 0x94, 0x8e, 0x84, 0x76, 0x65, 0x58, 0x51, 0x50,
-  0x54, 0x5b, 0x5f, 0x5f, 0x5b, 0x56, 0x57, 0x62, 0x71, 0x7e, 0x84, 0x81,
-  0x79, 0x76, 0x7a, 0x86, 0x93, 0x9a, 0x9b, 0x96, 0x92, 0x93, 0x9b, 0xa6,
-  0xb0, 0xb4, 0xb0, 0xa5, 0x98, 0x91, 0x91, 0x93, 0x92, 0x86, 0x72, 0x5e,
-  0x51, 0x4f, 0x54, 0x58, 0x54, 0x4a, 0x44, 0x49, 0x5a, 0x6f, 0x82, 0x8e,
-  0x94, 0x98, 0x9f, 0xac, 0xba, 0xc3, 0xc2, 0xb8, 0xab, 0xa0, 0x99, 0x93,
-  0x8d, 0x82, 0x70, 0x5c, 0x4f, 0x4c, 0x52, 0x5d, 0x63, 0x5e, 0x50, 0x47,
-  0x50, 0x64, 0x7a, 0x88, 0x86, 0x79, 0x73, 0x7a, 0x8b, 0x9d, 0xa7, 0xa7,
-  0xa1, 0x9e, 0x9e, 0xa4, 0xad, 0xb4, 0xb5, 0xaf, 0xa5, 0x9a, 0x92, 0x91,
-  0x90, 0x8c, 0x80, 0x70, 0x60, 0x56, 0x54, 0x56, 0x57, 0x52, 0x4b, 0x49,
-  0x4e, 0x58, 0x67, 0x75, 0x80, 0x87, 0x8c, 0x95, 0xa1, 0xae, 0xb8, 0xbc,
-  0xb8, 0xaf, 0xa6, 0x9f, 0x9a, 0x96, 0x8e, 0x80, 0x6f, 0x60, 0x57, 0x55,
-  0x59, 0x61, 0x65, 0x61, 0x58, 0x50, 0x4f, 0x5a, 0x6a, 0x79, 0x7f, 0x79,
-  0x6d, 0x69, 0x71, 0x81, 0x92, 0x9d, 0x9e, 0x96, 0x8f, 0x90, 0x9a, 0xa9,
-  0xb8, 0xbb, 0xb0, 0x9e, 0x8e, 0x8b, 0x94, 0x9d, 0x9f, 0x91, 0x75, 0x5c,
-  0x52, 0x56, 0x61, 0x64, 0x58, 0x45, 0x37, 0x39, 0x4b, 0x62, 0x71, 0x78,
-  0x77, 0x77, 0x82, 0x96, 0xab, 0xb9, 0xb9, 0xb0, 0xa6, 0xa0, 0xa0, 0xa2,
-  0xa2, 0x9a, 0x86, 0x6f, 0x5f, 0x58, 0x5c, 0x64, 0x68, 0x62, 0x50, 0x3e,
-  0x3b, 0x4a, 0x60, 0x71, 0x75, 0x6a, 0x5f, 0x62, 0x72, 0x88, 0x99, 0xa0,
-  0x9c, 0x96, 0x97, 0xa0, 0xac, 0xb5, 0xb9, 0xb7, 0xae, 0xa6, 0xa1, 0xa0,
-  0xa0, 0x9e, 0x95, 0x86, 0x77, 0x6d, 0x68, 0x66, 0x63, 0x5d, 0x53, 0x4a,
-  0x46, 0x4b, 0x55, 0x60, 0x66, 0x69, 0x6c, 0x73, 0x7e, 0x8d, 0x9d, 0xa8,
-  0xac, 0xaa, 0xa6, 0xa5, 0xa8, 0xaa, 0xa9, 0xa1, 0x93, 0x83, 0x78, 0x75,
-  0x74, 0x71, 0x6b, 0x65, 0x62, 0x62, 0x61, 0x5e, 0x59, 0x5a, 0x60, 0x67,
-  0x6e, 0x72, 0x72, 0x70, 0x71, 0x76, 0x7f, 0x89, 0x91, 0x96, 0x98, 0x96,
-  0x96, 0x9a, 0xa5, 0xb1, 0xb7, 0xb2, 0xa7, 0x9b, 0x96, 0x99, 0xa0, 0xa1,
-  0x96, 0x80, 0x6a, 0x5f, 0x5e, 0x62, 0x61, 0x57, 0x48, 0x40, 0x42, 0x4f,
-  0x5e, 0x6a, 0x6e, 0x6e, 0x70, 0x7d, 0x91, 0xa2, 0xac, 0xae, 0xaa, 0xa5,
-  0xa5, 0xa8, 0xac, 0xa9, 0xa0, 0x91, 0x82, 0x78, 0x74, 0x75, 0x76, 0x74,
-  0x69, 0x57, 0x47, 0x45, 0x51, 0x61, 0x6a, 0x66, 0x5b, 0x53, 0x56, 0x66,
-  0x7c, 0x8c, 0x92, 0x90, 0x8a, 0x8a, 0x97, 0xaa, 0xb9, 0xc1, 0xbe, 0xb3,
-  0xa7, 0xa3, 0xa6, 0xaf, 0xb1, 0xa7, 0x92, 0x79, 0x6a, 0x68, 0x6e, 0x70,
-  0x66, 0x51, 0x3c, 0x36, 0x42, 0x54, 0x60, 0x61, 0x5a, 0x55, 0x5c, 0x71,
-  0x8a, 0x9d, 0xa6, 0xa2, 0x9c, 0x9c, 0xa6, 0xb3, 0xbb, 0xb9, 0xad, 0x9a,
-  0x8c, 0x86, 0x86, 0x87, 0x82, 0x74, 0x64, 0x5b, 0x5a, 0x5e, 0x5f, 0x5c,
-  0x55, 0x50, 0x53, 0x5c, 0x65, 0x6c, 0x70, 0x72, 0x72, 0x76, 0x81, 0x8e,
-  0x9a, 0xa4, 0xa6, 0xa4, 0xa0, 0xa4, 0xae, 0xb7, 0xbc, 0xb7, 0xaa, 0x9c,
-  0x94, 0x94, 0x97, 0x98, 0x90, 0x7e, 0x69, 0x5b, 0x57, 0x5b, 0x5d, 0x5b,
-  0x52, 0x48, 0x45, 0x4c, 0x5a, 0x68, 0x73, 0x77, 0x7a, 0x80, 0x8c, 0x9a,
-  0xa9, 0xb3, 0xb6, 0xb1, 0xab, 0xa8, 0xaa, 0xae, 0xab, 0xa0, 0x90, 0x7e,
-  0x73, 0x70, 0x73, 0x76, 0x71, 0x63, 0x53, 0x47, 0x47, 0x53, 0x62, 0x6a,
-  0x69, 0x62, 0x5d, 0x61, 0x6e, 0x7e, 0x8d, 0x94, 0x94, 0x93, 0x94, 0x9b,
-  0xa7, 0xb2, 0xba, 0xbc, 0xb7, 0xb0, 0xa9, 0xa5, 0xa5, 0xa5, 0xa3, 0x9b,
-  0x8c, 0x7c, 0x72, 0x6e, 0x6c, 0x6a, 0x65, 0x59, 0x4e, 0x49, 0x4e, 0x5a,
-  0x63, 0x66, 0x64, 0x62, 0x6a, 0x79, 0x8a, 0x96, 0x9d, 0x9e, 0x9e, 0xa0,
-  0xa6, 0xac, 0xae, 0xab, 0xa2, 0x97, 0x8e, 0x89, 0x85, 0x82, 0x7d, 0x75,
-  0x6d, 0x68, 0x64, 0x62, 0x5e, 0x5c, 0x5a, 0x59, 0x5c, 0x62, 0x67, 0x6b,
-  0x6e, 0x70, 0x74, 0x7a, 0x83, 0x8c, 0x94, 0x98, 0x9a, 0x9a, 0x9c, 0xa2,
-  0xa8, 0xad, 0xac, 0xa7, 0xa1, 0x9a, 0x97, 0x98, 0x99, 0x96, 0x8c, 0x7e,
-  0x72, 0x6c, 0x6c, 0x6d, 0x6b, 0x63, 0x58, 0x51, 0x51, 0x57, 0x5f, 0x64,
-  0x66, 0x64, 0x66, 0x6b, 0x76, 0x83, 0x8e, 0x93, 0x94, 0x93, 0x95, 0x9b,
-  0xa1, 0xa5, 0xa4, 0x9e, 0x95, 0x8e, 0x8b, 0x8c, 0x8d, 0x8a, 0x84, 0x7a,
-  0x6d, 0x62, 0x5b, 0x5c, 0x60, 0x63, 0x61, 0x5a, 0x53, 0x53, 0x58, 0x63,
-  0x6f, 0x75, 0x77, 0x77, 0x79, 0x80, 0x8c, 0x98, 0xa3, 0xa9, 0xa9, 0xa6,
-  0xa4, 0xa4, 0xaa, 0xb1, 0xb3, 0xae, 0xa1, 0x92, 0x88, 0x87, 0x8b, 0x89,
-  0x7c, 0x67, 0x54, 0x4d, 0x50, 0x58, 0x5a, 0x55, 0x4b, 0x45, 0x4a, 0x57,
-  0x68, 0x73, 0x77, 0x77, 0x79, 0x82, 0x8f, 0x9c, 0xa7, 0xaa, 0xa7, 0xa2,
-  0x9d, 0x9d, 0xa1, 0xa4, 0xa2, 0x9a, 0x91, 0x85, 0x7b, 0x74, 0x6e, 0x68,
-  0x63, 0x5c, 0x55, 0x50, 0x4d, 0x4e, 0x52, 0x55, 0x58, 0x5c, 0x60, 0x67,
-  0x70, 0x7a, 0x84, 0x8c, 0x94, 0x9c, 0xa7, 0xb0, 0xb5, 0xb7, 0xb6, 0xb6,
-  0xb6, 0xb5, 0xb4, 0xae, 0xa3, 0x98, 0x8e, 0x86, 0x7e, 0x75, 0x6a, 0x60,
-  0x57, 0x50, 0x4d, 0x4d, 0x4d, 0x4c, 0x4e, 0x50, 0x54, 0x5c, 0x65, 0x6d,
-  0x77, 0x80, 0x88, 0x90, 0x96, 0x9e, 0xa6, 0xac, 0xad, 0xac, 0xa9, 0xa7,
-  0xa6, 0xa4, 0xa2, 0x9d, 0x95, 0x8a, 0x80, 0x76, 0x6c, 0x64, 0x5e, 0x5a,
-  0x58, 0x55, 0x52, 0x4f, 0x4f, 0x52, 0x5a, 0x61, 0x68, 0x6e, 0x74, 0x7b,
-  0x84, 0x8e, 0x98, 0xa3, 0xab, 0xb0, 0xb2, 0xb2, 0xb1, 0xb2, 0xb4, 0xb4,
-  0xb0, 0xa6, 0x99, 0x90, 0x8a, 0x87, 0x82, 0x77, 0x6a, 0x5d, 0x57, 0x57,
-  0x5a, 0x5a, 0x57, 0x53, 0x51, 0x56, 0x5f, 0x69, 0x70, 0x75, 0x77, 0x7b,
-  0x84, 0x8e, 0x98, 0x9f, 0xa2, 0xa2, 0xa0, 0x9f, 0xa1, 0xa3, 0xa3, 0xa1,
-  0x9c, 0x94, 0x8a, 0x81, 0x79, 0x73, 0x70, 0x6d, 0x69, 0x63, 0x5a, 0x54,
-  0x53, 0x57, 0x5d, 0x62, 0x64, 0x64, 0x65, 0x6a, 0x73, 0x7e, 0x89, 0x91,
-  0x96, 0x98, 0x9c, 0xa1, 0xa8, 0xb0, 0xb4, 0xb2, 0xab, 0xa3, 0xa0, 0x9f,
-  0x9f, 0x9c, 0x92, 0x83, 0x75, 0x6e, 0x6d, 0x6d, 0x68, 0x60, 0x56, 0x4e,
-  0x4d, 0x53, 0x5c, 0x62, 0x62, 0x5f, 0x5e, 0x64, 0x6e, 0x79, 0x82, 0x85,
-  0x85, 0x84, 0x87, 0x8e, 0x94, 0x9a, 0x9c, 0x9b, 0x99, 0x98, 0x99, 0x9a,
-  0x98, 0x90, 0x86, 0x7d, 0x7a, 0x78, 0x78, 0x73, 0x69, 0x60, 0x5a, 0x5a,
-  0x5e, 0x62, 0x64, 0x63, 0x60, 0x61, 0x67, 0x71, 0x7c, 0x86, 0x8c, 0x8d,
-  0x8e, 0x92, 0x9a, 0xa5, 0xad, 0xae, 0xa9, 0xa1, 0x9c, 0x9c, 0x9e, 0x9f,
-  0x9b, 0x8f, 0x81, 0x77, 0x73, 0x74, 0x74, 0x6f, 0x66, 0x5c, 0x56, 0x58,
-  0x5d, 0x62, 0x63, 0x61, 0x5d, 0x5e, 0x64, 0x6d, 0x76, 0x7c, 0x7f, 0x80,
-  0x81, 0x86, 0x8e, 0x96, 0x9c, 0x9f, 0xa0, 0x9d, 0x99, 0x96, 0x94, 0x92,
-  0x8f, 0x8b, 0x84, 0x7a, 0x70, 0x69, 0x66, 0x66, 0x67, 0x66, 0x64, 0x60,
-  0x5e, 0x62, 0x6a, 0x72, 0x7a, 0x80, 0x84, 0x86, 0x8a, 0x91, 0x9a, 0xa4,
-  0xab, 0xac, 0xa8, 0xa4, 0xa3, 0xa5, 0xa8, 0xa7, 0x9e, 0x91, 0x86, 0x80,
-  0x80, 0x80, 0x7b, 0x70, 0x63, 0x5c, 0x5d, 0x62, 0x65, 0x64, 0x62, 0x5f,
-  0x60, 0x66, 0x6e, 0x77, 0x7c, 0x7d, 0x7e, 0x80, 0x84, 0x8c, 0x93, 0x96,
-  0x96, 0x94, 0x93, 0x93, 0x96, 0x99, 0x98, 0x92, 0x88, 0x82, 0x7f, 0x81,
-  0x82, 0x7e, 0x76, 0x6e, 0x68, 0x67, 0x69, 0x6c, 0x6e, 0x6d, 0x6c, 0x6c,
-  0x6f, 0x76, 0x7e, 0x86, 0x8c, 0x8e, 0x8f, 0x92, 0x95, 0x9c, 0xa3, 0xa7,
-  0xa7, 0xa2, 0x9b, 0x97, 0x98, 0x99, 0x97, 0x91, 0x87, 0x7c, 0x75, 0x73,
-  0x73, 0x73, 0x70, 0x68, 0x61, 0x5f, 0x64, 0x6b, 0x6f, 0x6f, 0x6c, 0x6c,
-  0x6e, 0x74, 0x7c, 0x82, 0x84, 0x82, 0x81, 0x82, 0x87, 0x8c, 0x90, 0x92,
-  0x90, 0x8f, 0x90, 0x92, 0x91, 0x8e, 0x8a, 0x85, 0x82, 0x82, 0x81, 0x7e,
-  0x78, 0x6f, 0x6a, 0x69, 0x6b, 0x6e, 0x6e, 0x6c, 0x68, 0x67, 0x6a, 0x73,
-  0x7c, 0x83, 0x84, 0x82, 0x82, 0x87, 0x91, 0x9d, 0xa6, 0xa7, 0xa0, 0x99,
-  0x97, 0x9d, 0xa5, 0xa8, 0xa3, 0x96, 0x8a, 0x83, 0x86, 0x8c, 0x8c, 0x84,
-  0x74, 0x66, 0x63, 0x68, 0x6e, 0x70, 0x6b, 0x61, 0x5a, 0x5b, 0x61, 0x69,
-  0x6d, 0x6e, 0x6d, 0x6b, 0x6e, 0x75, 0x7e, 0x88, 0x8d, 0x8e, 0x8c, 0x8b,
-  0x90, 0x9a, 0xa2, 0xa2, 0x9c, 0x92, 0x8b, 0x8a, 0x8e, 0x92, 0x8f, 0x85,
-  0x76, 0x6a, 0x67, 0x6a, 0x6e, 0x6f, 0x6a, 0x62, 0x5d, 0x5d, 0x64, 0x6c,
-  0x74, 0x78, 0x79, 0x79, 0x7c, 0x83, 0x8e, 0x9a, 0xa1, 0xa3, 0xa1, 0x9d,
-  0x9d, 0xa1, 0xa8, 0xab, 0xa6, 0x9a, 0x8d, 0x86, 0x86, 0x88, 0x86, 0x7e,
-  0x6f, 0x61, 0x5c, 0x61, 0x68, 0x6a, 0x64, 0x5b, 0x54, 0x57, 0x61, 0x6b,
-  0x72, 0x72, 0x6f, 0x6e, 0x73, 0x7f, 0x8c, 0x93, 0x94, 0x92, 0x91, 0x94,
-  0x9b, 0xa3, 0xa6, 0xa1, 0x96, 0x8b, 0x88, 0x8a, 0x8d, 0x8d, 0x84, 0x74,
-  0x64, 0x5e, 0x64, 0x6c, 0x70, 0x6b, 0x62, 0x5a, 0x5b, 0x65, 0x75, 0x81,
-  0x84, 0x81, 0x7c, 0x7e, 0x8a, 0x9b, 0xaa, 0xae, 0xa8, 0x9e, 0x99, 0x9d,
-  0xa7, 0xaf, 0xae, 0xa2, 0x90, 0x82, 0x80, 0x87, 0x8c, 0x88, 0x7a, 0x67,
-  0x5b, 0x5b, 0x63, 0x6c, 0x6e, 0x66, 0x5b, 0x54, 0x58, 0x63, 0x6f, 0x76,
-  0x76, 0x70, 0x6b, 0x6f, 0x79, 0x86, 0x8f, 0x90, 0x8a, 0x82, 0x82, 0x8a,
-  0x96, 0x9d, 0x9b, 0x90, 0x83, 0x7b, 0x7e, 0x86, 0x8d, 0x8c, 0x80, 0x70,
-  0x67, 0x68, 0x71, 0x7a, 0x7a, 0x72, 0x67, 0x61, 0x66, 0x71, 0x7b, 0x82,
-  0x82, 0x7d, 0x79, 0x7c, 0x86, 0x92, 0x9b, 0x9e, 0x98, 0x92, 0x91, 0x95,
-  0x9c, 0xa1, 0x9f, 0x97, 0x8c, 0x84, 0x80, 0x83, 0x86, 0x85, 0x7d, 0x70,
-  0x66, 0x65, 0x6b, 0x74, 0x77, 0x72, 0x69, 0x63, 0x64, 0x6c, 0x77, 0x7c,
-  0x7a, 0x72, 0x6c, 0x6f, 0x79, 0x83, 0x88, 0x86, 0x82, 0x7d, 0x7e, 0x87,
-  0x92, 0x99, 0x97, 0x8e, 0x85, 0x81, 0x85, 0x8d, 0x93, 0x91, 0x85, 0x76,
-  0x6c, 0x6d, 0x76, 0x7d, 0x7d, 0x73, 0x65, 0x5d, 0x61, 0x6e, 0x7c, 0x82,
-  0x7e, 0x73, 0x6d, 0x73, 0x83, 0x94, 0x9e, 0x9d, 0x92, 0x88, 0x8a, 0x96,
-  0xa4, 0xad, 0xa8, 0x99, 0x8a, 0x85, 0x8b, 0x94, 0x99, 0x92, 0x81, 0x6f,
-  0x68, 0x6e, 0x78, 0x7d, 0x79, 0x6a, 0x5c, 0x58, 0x5f, 0x6c, 0x75, 0x73,
-  0x69, 0x61, 0x60, 0x68, 0x76, 0x83, 0x84, 0x7e, 0x78, 0x75, 0x7a, 0x88,
-  0x96, 0x9b, 0x96, 0x8b, 0x83, 0x82, 0x89, 0x95, 0x99, 0x94, 0x86, 0x76,
-  0x70, 0x76, 0x82, 0x88, 0x85, 0x76, 0x68, 0x64, 0x6c, 0x79, 0x84, 0x86,
-  0x7d, 0x73, 0x70, 0x77, 0x86, 0x94, 0x99, 0x94, 0x8c, 0x85, 0x87, 0x94,
-  0xa1, 0xa6, 0xa2, 0x96, 0x89, 0x85, 0x8a, 0x93, 0x98, 0x92, 0x82, 0x71,
-  0x6c, 0x71, 0x7b, 0x82, 0x80, 0x73, 0x64, 0x5f, 0x65, 0x72, 0x7d, 0x7d,
-  0x75, 0x69, 0x65, 0x6c, 0x79, 0x85, 0x88, 0x81, 0x78, 0x76, 0x7b, 0x86,
-  0x90, 0x96, 0x94, 0x8c, 0x83, 0x80, 0x86, 0x90, 0x94, 0x92, 0x8a, 0x7d,
-  0x75, 0x74, 0x7a, 0x81, 0x82, 0x7c, 0x71, 0x69, 0x69, 0x70, 0x78, 0x7f,
-  0x80, 0x7a, 0x74, 0x74, 0x7b, 0x87, 0x90, 0x96, 0x93, 0x8d, 0x8a, 0x8e,
-  0x98, 0xa3, 0xa7, 0xa3, 0x99, 0x8f, 0x8d, 0x93, 0x9a, 0x9a, 0x91, 0x82,
-  0x76, 0x72, 0x76, 0x7c, 0x7e, 0x79, 0x6d, 0x62, 0x5f, 0x65, 0x6d, 0x71,
-  0x6f, 0x69, 0x62, 0x61, 0x67, 0x71, 0x7a, 0x7c, 0x79, 0x75, 0x75, 0x7a,
-  0x83, 0x8c, 0x92, 0x91, 0x8c, 0x86, 0x85, 0x87, 0x8d, 0x92, 0x92, 0x8b,
-  0x82, 0x7a, 0x76, 0x78, 0x7d, 0x80, 0x7e, 0x76, 0x6c, 0x68, 0x6a, 0x70,
-  0x78, 0x7c, 0x7b, 0x75, 0x72, 0x77, 0x80, 0x8a, 0x91, 0x92, 0x90, 0x8c,
-  0x8d, 0x91, 0x98, 0x9f, 0xa0, 0x9a, 0x91, 0x8b, 0x8a, 0x8e, 0x92, 0x91,
-  0x88, 0x7c, 0x71, 0x6e, 0x72, 0x78, 0x7a, 0x75, 0x6b, 0x63, 0x63, 0x68,
-  0x6f, 0x74, 0x72, 0x6c, 0x66, 0x64, 0x6b, 0x74, 0x7b, 0x7c, 0x79, 0x74,
-  0x73, 0x78, 0x80, 0x87, 0x8b, 0x8b, 0x89, 0x85, 0x83, 0x84, 0x86, 0x8b,
-  0x8e, 0x8b, 0x84, 0x7c, 0x77, 0x79, 0x7e, 0x83, 0x83, 0x7c, 0x72, 0x6c,
-  0x6e, 0x77, 0x81, 0x85, 0x82, 0x7a, 0x74, 0x77, 0x83, 0x90, 0x96, 0x94,
-  0x8b, 0x84, 0x84, 0x8e, 0x9c, 0xa2, 0x9e, 0x92, 0x87, 0x85, 0x8c, 0x97,
-  0x9b, 0x94, 0x85, 0x77, 0x73, 0x79, 0x82, 0x86, 0x81, 0x74, 0x69, 0x65,
-  0x6b, 0x73, 0x77, 0x75, 0x6e, 0x66, 0x64, 0x69, 0x70, 0x77, 0x7b, 0x79,
-  0x73, 0x71, 0x74, 0x7b, 0x82, 0x87, 0x89, 0x87, 0x82, 0x80, 0x82, 0x87,
-  0x8c, 0x8e, 0x8c, 0x86, 0x80, 0x7c, 0x7d, 0x81, 0x85, 0x83, 0x7c, 0x76,
-  0x72, 0x74, 0x79, 0x7e, 0x7f, 0x7d, 0x7a, 0x7a, 0x7f, 0x85, 0x8b, 0x8f,
-  0x90, 0x8e, 0x8d, 0x8e, 0x92, 0x96, 0x9b, 0x9c, 0x98, 0x92, 0x8d, 0x8d,
-  0x8f, 0x90, 0x8d, 0x87, 0x7e, 0x76, 0x73, 0x75, 0x77, 0x76, 0x71, 0x69,
-  0x64, 0x63, 0x68, 0x6e, 0x71, 0x6e, 0x68, 0x65, 0x68, 0x6f, 0x76, 0x79,
-  0x7a, 0x78, 0x76, 0x7a, 0x80, 0x85, 0x8a, 0x8c, 0x8d, 0x8d, 0x8c, 0x8c,
-  0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8a, 0x84, 0x7d, 0x7b, 0x7c, 0x7e, 0x7e,
-  0x7a, 0x75, 0x6f, 0x6e, 0x72, 0x79, 0x7e, 0x7f, 0x7c, 0x78, 0x77, 0x7d,
-  0x87, 0x90, 0x94, 0x91, 0x8c, 0x8a, 0x8e, 0x98, 0xa0, 0xa1, 0x9a, 0x91,
-  0x8b, 0x8d, 0x92, 0x97, 0x95, 0x8b, 0x7d, 0x75, 0x75, 0x7c, 0x82, 0x7e,
-  0x75, 0x6b, 0x66, 0x68, 0x6e, 0x74, 0x76, 0x72, 0x6b, 0x67, 0x68, 0x6f,
-  0x76, 0x79, 0x79, 0x76, 0x73, 0x73, 0x76, 0x7c, 0x82, 0x86, 0x86, 0x84,
-  0x82, 0x82, 0x84, 0x87, 0x8c, 0x8d, 0x8b, 0x87, 0x84, 0x81, 0x81, 0x84,
-  0x88, 0x89, 0x84, 0x7c, 0x77, 0x78, 0x7d, 0x84, 0x88, 0x86, 0x7e, 0x78,
-  0x79, 0x80, 0x88, 0x8e, 0x8f, 0x8a, 0x85, 0x83, 0x8a, 0x94, 0x9a, 0x99,
-  0x91, 0x89, 0x85, 0x8a, 0x91, 0x96, 0x93, 0x88, 0x7d, 0x79, 0x7b, 0x81,
-  0x86, 0x84, 0x7b, 0x71, 0x6d, 0x71, 0x77, 0x7a, 0x78, 0x72, 0x6c, 0x69,
-  0x6c, 0x72, 0x77, 0x79, 0x75, 0x73, 0x74, 0x76, 0x7a, 0x80, 0x83, 0x82,
-  0x83, 0x85, 0x87, 0x88, 0x89, 0x88, 0x88, 0x89, 0x8b, 0x8c, 0x8b, 0x86,
-  0x81, 0x7e, 0x7e, 0x82, 0x83, 0x81, 0x7b, 0x74, 0x72, 0x76, 0x7d, 0x81,
-  0x81, 0x7d, 0x7a, 0x79, 0x7e, 0x87, 0x8f, 0x90, 0x8b, 0x87, 0x88, 0x8f,
-  0x98, 0x9d, 0x9c, 0x96, 0x90, 0x8e, 0x92, 0x98, 0x9a, 0x94, 0x88, 0x7e,
-  0x7a, 0x7c, 0x80, 0x7f, 0x78, 0x70, 0x6a, 0x68, 0x6a, 0x6d, 0x6e, 0x6e,
-  0x6c, 0x6a, 0x6b, 0x6e, 0x73, 0x77, 0x7b, 0x7c, 0x7b, 0x7a, 0x7b, 0x7d,
-  0x81, 0x84, 0x87, 0x87, 0x86, 0x83, 0x81, 0x81, 0x82, 0x83, 0x84, 0x82,
-  0x7d, 0x79, 0x76, 0x76, 0x79, 0x7c, 0x7c, 0x7a, 0x75, 0x72, 0x74, 0x79,
-  0x7e, 0x80, 0x80, 0x7f, 0x80, 0x82, 0x86, 0x8c, 0x91, 0x91, 0x91, 0x91,
-  0x92, 0x95, 0x97, 0x99, 0x98, 0x95, 0x90, 0x8c, 0x8a, 0x8a, 0x8a, 0x86,
-  0x80, 0x79, 0x73, 0x71, 0x73, 0x75, 0x74, 0x70, 0x6a, 0x67, 0x69, 0x6d,
-  0x70, 0x72, 0x70, 0x6e, 0x6e, 0x71, 0x74, 0x77, 0x78, 0x79, 0x79, 0x79,
-  0x7a, 0x7b, 0x7e, 0x81, 0x85, 0x87, 0x87, 0x86, 0x84, 0x82, 0x82, 0x85,
-  0x88, 0x88, 0x85, 0x7f, 0x79, 0x77, 0x78, 0x7c, 0x7f, 0x7d, 0x78, 0x73,
-  0x72, 0x76, 0x7c, 0x82, 0x85, 0x82, 0x7d, 0x7c, 0x80, 0x87, 0x8d, 0x8f,
-  0x8d, 0x88, 0x85, 0x87, 0x8d, 0x94, 0x96, 0x92, 0x8c, 0x88, 0x89, 0x8e,
-  0x93, 0x93, 0x8d, 0x84, 0x7e, 0x7d, 0x80, 0x84, 0x83, 0x7d, 0x76, 0x71,
-  0x6f, 0x71, 0x74, 0x75, 0x72, 0x6c, 0x67, 0x67, 0x6b, 0x6f, 0x72, 0x74,
-  0x72, 0x6f, 0x6e, 0x71, 0x76, 0x7b, 0x80, 0x83, 0x83, 0x82, 0x81, 0x83,
-  0x86, 0x89, 0x8a, 0x8b, 0x89, 0x85, 0x81, 0x80, 0x81, 0x83, 0x85, 0x84,
-  0x80, 0x78, 0x75, 0x76, 0x7b, 0x80, 0x82, 0x7e, 0x7a, 0x76, 0x78, 0x81,
-  0x89, 0x8d, 0x8c, 0x87, 0x85, 0x86, 0x8c, 0x93, 0x98, 0x96, 0x90, 0x8b,
-  0x8a, 0x8d, 0x92, 0x93, 0x90, 0x88, 0x80, 0x7b, 0x7b, 0x7e, 0x80, 0x7e,
-  0x79, 0x72, 0x6e, 0x6e, 0x72, 0x76, 0x77, 0x73, 0x6e, 0x6a, 0x6a, 0x6e,
-  0x74, 0x78, 0x79, 0x78, 0x75, 0x74, 0x78, 0x7e, 0x83, 0x86, 0x86, 0x85,
-  0x84, 0x84, 0x86, 0x88, 0x87, 0x85, 0x84, 0x82, 0x7f, 0x7c, 0x7a, 0x79,
-  0x79, 0x7a, 0x7a, 0x7a, 0x78, 0x76, 0x77, 0x7b, 0x81, 0x86, 0x86, 0x85,
-  0x84, 0x85, 0x89, 0x8e, 0x91, 0x93, 0x92, 0x8f, 0x8e, 0x90, 0x95, 0x97,
-  0x97, 0x93, 0x8d, 0x88, 0x88, 0x8b, 0x8e, 0x8c, 0x86, 0x7d, 0x77, 0x75,
-  0x78, 0x7a, 0x78, 0x73, 0x6c, 0x69, 0x6a, 0x6f, 0x73, 0x75, 0x74, 0x71,
-  0x70, 0x72, 0x75, 0x79, 0x7d, 0x7e, 0x7e, 0x7c, 0x7b, 0x7c, 0x80, 0x83,
-  0x84, 0x83, 0x80, 0x7e, 0x7c, 0x7c, 0x7e, 0x7f, 0x7f, 0x7e, 0x7c, 0x7a,
-  0x78, 0x79, 0x7a, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7a, 0x7c, 0x7e, 0x81,
-  0x83, 0x84, 0x86, 0x87, 0x87, 0x89, 0x8c, 0x90, 0x92, 0x93, 0x92, 0x91,
-  0x90, 0x91, 0x93, 0x95, 0x94, 0x90, 0x8a, 0x86, 0x86, 0x89, 0x88, 0x84,
-  0x7c, 0x74, 0x71, 0x72, 0x75, 0x76, 0x72, 0x6d, 0x69, 0x69, 0x6d, 0x73,
-  0x75, 0x74, 0x71, 0x70, 0x72, 0x77, 0x7c, 0x80, 0x80, 0x7e, 0x7e, 0x80,
-  0x83, 0x86, 0x8a, 0x8c, 0x8d, 0x89, 0x84, 0x81, 0x80, 0x81, 0x84, 0x86,
-  0x84, 0x7b, 0x73, 0x71, 0x74, 0x7a, 0x7d, 0x7c, 0x76, 0x71, 0x6f, 0x74,
-  0x7c, 0x83, 0x86, 0x84, 0x80, 0x7e, 0x81, 0x8a, 0x94, 0x98, 0x97, 0x92,
-  0x8e, 0x90, 0x95, 0x9c, 0xa1, 0x9f, 0x97, 0x8d, 0x88, 0x8a, 0x8f, 0x92,
-  0x8f, 0x84, 0x76, 0x6e, 0x70, 0x76, 0x7c, 0x7a, 0x70, 0x65, 0x60, 0x64,
-  0x6c, 0x74, 0x76, 0x72, 0x6a, 0x67, 0x6c, 0x76, 0x7e, 0x82, 0x80, 0x7a,
-  0x76, 0x79, 0x80, 0x89, 0x8e, 0x90, 0x8c, 0x85, 0x7f, 0x80, 0x84, 0x89,
-  0x8c, 0x8a, 0x82, 0x78, 0x72, 0x73, 0x7a, 0x81, 0x82, 0x7c, 0x73, 0x6d,
-  0x6f, 0x78, 0x81, 0x87, 0x86, 0x7f, 0x7a, 0x7c, 0x84, 0x8d, 0x94, 0x95,
-  0x90, 0x8b, 0x8a, 0x8f, 0x96, 0x9b, 0x9c, 0x97, 0x8f, 0x8a, 0x88, 0x8c,
-  0x8e, 0x8c, 0x86, 0x7e, 0x76, 0x71, 0x72, 0x76, 0x79, 0x76, 0x6f, 0x68,
-  0x66, 0x67, 0x6d, 0x73, 0x76, 0x74, 0x6e, 0x6b, 0x6f, 0x76, 0x7c, 0x81,
-  0x7f, 0x7a, 0x77, 0x79, 0x80, 0x8a, 0x90, 0x92, 0x8e, 0x87, 0x81, 0x80,
-  0x83, 0x86, 0x88, 0x86, 0x7d, 0x72, 0x6b, 0x6b, 0x71, 0x78, 0x79, 0x75,
-  0x6d, 0x67, 0x6a, 0x74, 0x7f, 0x87, 0x88, 0x83, 0x7f, 0x82, 0x8a, 0x95,
-  0x9e, 0xa0, 0x9c, 0x96, 0x92, 0x93, 0x97, 0x9c, 0x9c, 0x96, 0x8d, 0x84,
-  0x7f, 0x80, 0x82, 0x82, 0x7d, 0x74, 0x6a, 0x66, 0x69, 0x6f, 0x75, 0x75,
-  0x70, 0x69, 0x66, 0x6b, 0x75, 0x7e, 0x82, 0x7e, 0x77, 0x74, 0x79, 0x82,
-  0x89, 0x8c, 0x88, 0x80, 0x7a, 0x7d, 0x84, 0x8c, 0x90, 0x8e, 0x84, 0x79,
-  0x72, 0x73, 0x7a, 0x80, 0x7f, 0x77, 0x6c, 0x65, 0x65, 0x6c, 0x75, 0x7a,
-  0x78, 0x73, 0x70, 0x75, 0x80, 0x8e, 0x95, 0x96, 0x94, 0x94, 0x97, 0x9d,
-  0xa2, 0xa5, 0xa3, 0x9f, 0x9c, 0x99, 0x98, 0x96, 0x91, 0x8b, 0x84, 0x7f,
-  0x7b, 0x76, 0x73, 0x6f, 0x6b, 0x6a, 0x6a, 0x69, 0x67, 0x66, 0x68, 0x6d,
-  0x72, 0x75, 0x76, 0x74, 0x74, 0x79, 0x81, 0x86, 0x88, 0x85, 0x82, 0x82,
-  0x86, 0x8b, 0x8e, 0x8e, 0x89, 0x83, 0x82, 0x86, 0x8c, 0x91, 0x8e, 0x86,
-  0x7b, 0x72, 0x6f, 0x70, 0x74, 0x76, 0x71, 0x68, 0x60, 0x5e, 0x63, 0x6c,
-  0x74, 0x7a, 0x7b, 0x7b, 0x7d, 0x83, 0x8d, 0x98, 0xa2, 0xa6, 0xa7, 0xa7,
-  0xa8, 0xa8, 0xa9, 0xa9, 0xa7, 0xa4, 0x9f, 0x9a, 0x93, 0x8a, 0x82, 0x7c,
-  0x78, 0x76, 0x73, 0x6e, 0x67, 0x61, 0x60, 0x65, 0x69, 0x6a, 0x69, 0x66,
-  0x65, 0x6a, 0x72, 0x79, 0x7c, 0x7c, 0x7a, 0x7c, 0x82, 0x8a, 0x8e, 0x8f,
-  0x8c, 0x8a, 0x89, 0x8b, 0x8c, 0x8c, 0x8a, 0x8a, 0x8d, 0x8f, 0x8d, 0x85,
-  0x75, 0x67, 0x62, 0x65, 0x6c, 0x6e, 0x67, 0x5b, 0x50, 0x4f, 0x59, 0x68,
-  0x75, 0x7c, 0x7d, 0x7c, 0x80, 0x8a, 0x9b, 0xad, 0xb9, 0xbd, 0xba, 0xb3,
-  0xab, 0xa7, 0xa9, 0xad, 0xb0, 0xaa, 0x9a, 0x85, 0x74, 0x70, 0x74, 0x7b,
-  0x7a, 0x6c, 0x57, 0x4a, 0x4c, 0x5b, 0x6a, 0x70, 0x69, 0x5b, 0x52, 0x58,
-  0x6a, 0x7d, 0x88, 0x87, 0x7c, 0x77, 0x7b, 0x87, 0x96, 0x9d, 0x99, 0x90,
-  0x88, 0x85, 0x88, 0x8d, 0x8f, 0x8d, 0x8a, 0x8a, 0x89, 0x84, 0x7d, 0x74,
-  0x69, 0x5e, 0x59, 0x5b, 0x5e, 0x5e, 0x5c, 0x58, 0x56, 0x58, 0x5d, 0x65,
-  0x70, 0x7e, 0x8b, 0x94, 0x98, 0x9d, 0xa5, 0xaf, 0xba, 0xc2, 0xc4, 0xbe,
-  0xb1, 0xa7, 0xa0, 0x9f, 0xa3, 0xa1, 0x95, 0x82, 0x70, 0x64, 0x62, 0x66,
-  0x68, 0x64, 0x5b, 0x51, 0x4a, 0x4c, 0x56, 0x62, 0x6a, 0x68, 0x64, 0x63,
-  0x69, 0x76, 0x86, 0x91, 0x94, 0x91, 0x8d, 0x8d, 0x95, 0xa1, 0xa8, 0xa5,
-  0x9c, 0x93, 0x8c, 0x8b, 0x90, 0x96, 0x99, 0x97, 0x8a, 0x71, 0x54, 0x41,
-  0x41, 0x4e, 0x5c, 0x62, 0x56, 0x3e, 0x2c, 0x30, 0x4b, 0x72, 0x89, 0x90,
-  0x89, 0x7e, 0x84, 0xa2, 0xc2, 0xd8, 0xe4, 0xdf, 0xce, 0xbc, 0xaf, 0xab,
-  0xae, 0xb2, 0xb1, 0xa5, 0x8f, 0x72, 0x5b, 0x52, 0x5b, 0x69, 0x6e, 0x64,
-  0x4d, 0x37, 0x31, 0x40, 0x59, 0x6e, 0x74, 0x68, 0x57, 0x55, 0x64, 0x81,
-  0x9e, 0xab, 0xa8, 0x9b, 0x90, 0x93, 0xa2, 0xb1, 0xb5, 0xad, 0x9b, 0x8a,
-  0x7f, 0x7c, 0x7d, 0x81, 0x85, 0x84, 0x7d, 0x72, 0x61, 0x4f, 0x47, 0x4a,
-  0x52, 0x58, 0x58, 0x53, 0x4e, 0x4f, 0x5b, 0x6c, 0x7a, 0x82, 0x89, 0x96,
-  0xaa, 0xc0, 0xd0, 0xd3, 0xcb, 0xc3, 0xc2, 0xc9, 0xd0, 0xcd, 0xbb, 0x9e,
-  0x85, 0x78, 0x77, 0x7a, 0x76, 0x69, 0x54, 0x3f, 0x34, 0x38, 0x45, 0x52,
-  0x58, 0x55, 0x4c, 0x49, 0x53, 0x68, 0x84, 0x9d, 0xa5, 0xa2, 0xa0, 0xa6,
-  0xb2, 0xc1, 0xc9, 0xc4, 0xb5, 0xa4, 0x99, 0x94, 0x90, 0x8c, 0x82, 0x70,
-  0x61, 0x5a, 0x5c, 0x66, 0x71, 0x73, 0x66, 0x4b, 0x33, 0x2e, 0x37, 0x4b,
-  0x5e, 0x65, 0x5a, 0x4a, 0x4a, 0x66, 0x88, 0x97, 0xa6, 0xc2, 0xd2, 0xcc,
-  0xce, 0xda, 0xe4, 0xea, 0xe8, 0xde, 0xcb, 0xb4, 0x9b, 0x84, 0x72, 0x66,
-  0x5c, 0x54, 0x4a, 0x3c, 0x2f, 0x28, 0x2c, 0x3a, 0x49, 0x54, 0x57, 0x53,
-  0x4f, 0x56, 0x6a, 0x86, 0x9e, 0xaa, 0xaa, 0xa9, 0xaf, 0xba, 0xc5, 0xcc,
-  0xc9, 0xbd, 0xae, 0x9e, 0x90, 0x86, 0x7b, 0x6f, 0x62, 0x54, 0x47, 0x42,
-  0x49, 0x59, 0x6a, 0x70, 0x65, 0x4a, 0x30, 0x28, 0x30, 0x42, 0x53, 0x5a,
-  0x54, 0x4d, 0x53, 0x6f, 0x8f, 0x9d, 0xb1, 0xd0, 0xe2, 0xe2, 0xe5, 0xee,
-  0xf0, 0xec, 0xe1, 0xcf, 0xb9, 0xa2, 0x8b, 0x72, 0x59, 0x43, 0x37, 0x34,
-  0x37, 0x37, 0x33, 0x2e, 0x32, 0x41, 0x56, 0x6a, 0x78, 0x7d, 0x80, 0x88,
-  0x96, 0xa8, 0xb8, 0xbe, 0xbd, 0xb8, 0xb5, 0xb3, 0xb2, 0xae, 0xa6, 0x98,
-  0x88, 0x78, 0x6a, 0x5c, 0x52, 0x4e, 0x4f, 0x56, 0x62, 0x72, 0x87, 0x99,
-  0x95, 0x73, 0x43, 0x1f, 0x15, 0x26, 0x49, 0x66, 0x68, 0x4e, 0x34, 0x43,
-  0x76, 0x96, 0xac, 0xd7, 0xfc, 0xe3, 0xb6, 0xba, 0xd9, 0xf5, 0xfe, 0xe4,
-  0xae, 0x75, 0x4c, 0x38, 0x3c, 0x4f, 0x5e, 0x5c, 0x4f, 0x3f, 0x39, 0x43,
-  0x5c, 0x78, 0x8a, 0x8b, 0x78, 0x5e, 0x56, 0x68, 0x8d, 0xb5, 0xcf, 0xd2,
-  0xc4, 0xb8, 0xb9, 0xc5, 0xd2, 0xd3, 0xbf, 0x9c, 0x79, 0x60, 0x52, 0x50,
-  0x4e, 0x47, 0x3a, 0x2c, 0x2a, 0x37, 0x54, 0x77, 0x93, 0x96, 0x7a, 0x51,
-  0x33, 0x2b, 0x34, 0x48, 0x5b, 0x69, 0x72, 0x7d, 0x90, 0xae, 0xce, 0xe6,
-  0xf4, 0xf9, 0xf5, 0xe9, 0xdc, 0xca, 0xb1, 0x92, 0x71, 0x52, 0x3e, 0x36,
-  0x38, 0x3d, 0x40, 0x41, 0x47, 0x57, 0x6e, 0x84, 0x8c, 0x82, 0x6d, 0x5e,
-  0x5e, 0x6f, 0x87, 0x9a, 0xa8, 0xb2, 0xba, 0xc4, 0xd0, 0xd7, 0xd7, 0xcd,
-  0xb7, 0x9a, 0x7e, 0x66, 0x52, 0x42, 0x38, 0x32, 0x34, 0x3a, 0x47, 0x58,
-  0x6a, 0x80, 0x96, 0xab, 0xb7, 0xab, 0x81, 0x4f, 0x29, 0x17, 0x1d, 0x32,
-  0x4d, 0x67, 0x7c, 0x8c, 0x9f, 0xb8, 0xd2, 0xea, 0xfc, 0xff, 0xfa, 0xde,
-  0xb7, 0x8f, 0x6d, 0x56, 0x4b, 0x4a, 0x4d, 0x51, 0x55, 0x5c, 0x68, 0x76,
-  0x85, 0x94, 0x9d, 0x98, 0x7c, 0x54, 0x37, 0x37, 0x4c, 0x69, 0x85, 0x98,
-  0xa7, 0xb4, 0xc5, 0xd6, 0xe0, 0xdf, 0xd0, 0xb5, 0x95, 0x77, 0x5f, 0x50,
-  0x48, 0x47, 0x49, 0x4c, 0x55, 0x62, 0x72, 0x7f, 0x81, 0x79, 0x72, 0x78,
-  0x89, 0x99, 0x91, 0x65, 0x2f, 0x10, 0x0f, 0x27, 0x51, 0x7f, 0xa0, 0xb6,
-  0xc6, 0xce, 0xd4, 0xd7, 0xd5, 0xce, 0xc2, 0xad, 0x8f, 0x6f, 0x57, 0x4c,
-  0x51, 0x5e, 0x6a, 0x77, 0x86, 0x91, 0x90, 0x84, 0x6e, 0x59, 0x51, 0x58,
-  0x64, 0x65, 0x53, 0x40, 0x44, 0x62, 0x8f, 0xbb, 0xd4, 0xd8, 0xcc, 0xba,
-  0xb0, 0xad, 0xa9, 0xa0, 0x90, 0x7c, 0x68, 0x5a, 0x57, 0x61, 0x73, 0x84,
-  0x8e, 0x8d, 0x80, 0x6c, 0x62, 0x63, 0x6c, 0x77, 0x83, 0x8f, 0x94, 0x86,
-  0x63, 0x38, 0x1c, 0x1a, 0x2f, 0x52, 0x7a, 0x9b, 0xae, 0xb7, 0xbc, 0xbe,
-  0xbd, 0xbb, 0xba, 0xbc, 0xbb, 0xb1, 0x9e, 0x88, 0x79, 0x77, 0x7e, 0x87,
-  0x8c, 0x8a, 0x84, 0x7b, 0x6f, 0x60, 0x4e, 0x44, 0x47, 0x51, 0x58, 0x56,
-  0x52, 0x5a, 0x72, 0x92, 0xb1, 0xc4, 0xc7, 0xbc, 0xaf, 0xa4, 0x9c, 0x96,
-  0x90, 0x89, 0x82, 0x7a, 0x74, 0x6f, 0x6f, 0x75, 0x7d, 0x80, 0x7b, 0x70,
-  0x64, 0x5e, 0x60, 0x6e, 0x88, 0xaa, 0xc2, 0xb5, 0x7a, 0x35, 0x06, 0x00,
-  0x17, 0x54, 0x8f, 0xc1, 0xce, 0x9c, 0x67, 0x66, 0x90, 0xc1, 0xe1, 0xe6,
-  0xcd, 0x9b, 0x65, 0x42, 0x44, 0x6b, 0xa5, 0xd1, 0xd9, 0xb6, 0x7a, 0x49,
-  0x30, 0x32, 0x49, 0x64, 0x70, 0x68, 0x4d, 0x30, 0x29, 0x44, 0x7b, 0xb6,
-  0xdc, 0xdf, 0xbb, 0x8e, 0x7e, 0x95, 0xb7, 0xcb, 0xc7, 0xac, 0x8a, 0x73,
-  0x6c, 0x70, 0x78, 0x7e, 0x80, 0x77, 0x61, 0x46, 0x33, 0x32, 0x3f, 0x5a,
-  0x7d, 0x9d, 0xae, 0x9e, 0x6d, 0x34, 0x14, 0x14, 0x33, 0x65, 0x97, 0xbc,
-  0xd3, 0xd7, 0xce, 0xc4, 0xba, 0xae, 0xa5, 0xa1, 0x9c, 0x90, 0x7e, 0x6d,
-  0x64, 0x66, 0x70, 0x7c, 0x80, 0x78, 0x66, 0x55, 0x48, 0x40, 0x3d, 0x40,
-  0x4e, 0x64, 0x7b, 0x8a, 0x90, 0x92, 0x98, 0xa7, 0xbb, 0xc8, 0xc4, 0xb1,
-  0x99, 0x89, 0x88, 0x8e, 0x91, 0x8c, 0x80, 0x75, 0x6d, 0x66, 0x60, 0x5d,
-  0x61, 0x6a, 0x73, 0x74, 0x6c, 0x5e, 0x5a, 0x6e, 0x9a, 0xc2, 0xc8, 0x98,
-  0x4c, 0x12, 0x00, 0x14, 0x48, 0x84, 0xb6, 0xd9, 0xde, 0xc6, 0xa4, 0x89,
-  0x7d, 0x82, 0x8f, 0x9c, 0xa2, 0x9c, 0x8d, 0x83, 0x86, 0x92, 0xa0, 0xa7,
-  0x9f, 0x88, 0x67, 0x43, 0x29, 0x23, 0x36, 0x5b, 0x85, 0xa2, 0xa2, 0x82,
-  0x58, 0x4b, 0x66, 0x93, 0xb5, 0xbc, 0xa9, 0x96, 0x96, 0xa4, 0xb6, 0xc1,
-  0xc2, 0xb4, 0x9e, 0x87, 0x72, 0x61, 0x59, 0x5a, 0x65, 0x71, 0x72, 0x63,
-  0x4f, 0x45, 0x51, 0x6e, 0x92, 0xae, 0xb0, 0x87, 0x47, 0x1a, 0x12, 0x2e,
-  0x62, 0x94, 0xc4, 0xf2, 0xfe, 0xed, 0xcc, 0xa1, 0x7c, 0x66, 0x67, 0x7c,
-  0x96, 0xa7, 0xb0, 0xad, 0x9f, 0x8f, 0x83, 0x7a, 0x70, 0x62, 0x4e, 0x3b,
-  0x2e, 0x30, 0x42, 0x62, 0x89, 0xad, 0xbd, 0xae, 0x88, 0x6a, 0x6d, 0x89,
-  0xa6, 0xb4, 0xb4, 0xad, 0xab, 0xae, 0xb0, 0xaa, 0x9e, 0x8d, 0x7a, 0x68,
-  0x56, 0x48, 0x44, 0x51, 0x67, 0x79, 0x7c, 0x6e, 0x5c, 0x5b, 0x76, 0x9e,
-  0xb4, 0x9d, 0x58, 0x16, 0x00, 0x11, 0x46, 0x7e, 0xb2, 0xe5, 0xf6, 0xdc,
-  0xaf, 0x7e, 0x5b, 0x54, 0x67, 0x86, 0xa3, 0xb7, 0xbe, 0xba, 0xb1, 0xa3,
-  0x90, 0x7b, 0x67, 0x56, 0x47, 0x3c, 0x34, 0x36, 0x47, 0x68, 0x91, 0xb4,
-  0xbd, 0x9f, 0x65, 0x34, 0x2a, 0x4d, 0x82, 0xac, 0xc0, 0xc1, 0xba, 0xb7,
-  0xb6, 0xae, 0x9c, 0x83, 0x6c, 0x5b, 0x50, 0x51, 0x5e, 0x72, 0x85, 0x92,
-  0x91, 0x7c, 0x5a, 0x3d, 0x35, 0x49, 0x70, 0x92, 0x99, 0x74, 0x38, 0x10,
-  0x11, 0x32, 0x65, 0x9a, 0xc4, 0xe2, 0xe7, 0xcf, 0xa6, 0x7c, 0x66, 0x6a,
-  0x83, 0xa1, 0xba, 0xc7, 0xc7, 0xb9, 0x9f, 0x83, 0x68, 0x52, 0x46, 0x43,
-  0x44, 0x46, 0x4a, 0x53, 0x64, 0x7b, 0x90, 0x96, 0x86, 0x62, 0x46, 0x49,
-  0x6b, 0x95, 0xb8, 0xcd, 0xce, 0xc5, 0xb9, 0xaa, 0x98, 0x86, 0x77, 0x70,
-  0x6c, 0x67, 0x62, 0x60, 0x67, 0x79, 0x8a, 0x8c, 0x7c, 0x62, 0x4e, 0x54,
-  0x71, 0x89, 0x82, 0x56, 0x20, 0x05, 0x16, 0x49, 0x83, 0xb4, 0xde, 0xe7,
-  0xc9, 0x9b, 0x73, 0x63, 0x6f, 0x8e, 0xb1, 0xcc, 0xdb, 0xd9, 0xca, 0xb2,
-  0x98, 0x7d, 0x66, 0x54, 0x49, 0x46, 0x49, 0x4c, 0x53, 0x62, 0x7a, 0x93,
-  0x9f, 0x8f, 0x63, 0x35, 0x26, 0x42, 0x7a, 0xb2, 0xd4, 0xe0, 0xdd, 0xd0,
-  0xc0, 0xae, 0x9b, 0x8b, 0x82, 0x80, 0x81, 0x81, 0x7e, 0x78, 0x73, 0x72,
-  0x6c, 0x5b, 0x44, 0x31, 0x2e, 0x40, 0x63, 0x8c, 0xab, 0xa4, 0x71, 0x33,
-  0x14, 0x20, 0x4c, 0x83, 0xb2, 0xe2, 0xfa, 0xeb, 0xc7, 0x9c, 0x78, 0x6a,
-  0x76, 0x91, 0xad, 0xc2, 0xca, 0xc2, 0xac, 0x8e, 0x70, 0x56, 0x45, 0x3d,
-  0x3e, 0x46, 0x4e, 0x56, 0x63, 0x77, 0x8b, 0x96, 0x8d, 0x71, 0x56, 0x55,
-  0x72, 0x9c, 0xc1, 0xd6, 0xd8, 0xce, 0xbe, 0xac, 0x99, 0x8a, 0x80, 0x7a,
-  0x79, 0x78, 0x75, 0x72, 0x70, 0x6f, 0x6b, 0x61, 0x54, 0x44, 0x3c, 0x4a,
-  0x69, 0x90, 0xa9, 0x97, 0x59, 0x1b, 0x09, 0x25, 0x5b, 0x93, 0xc6, 0xee,
-  0xef, 0xcc, 0x9b, 0x72, 0x63, 0x71, 0x91, 0xb5, 0xcf, 0xd9, 0xd3, 0xbd,
-  0x9e, 0x82, 0x6a, 0x57, 0x4c, 0x4a, 0x4e, 0x52, 0x56, 0x5a, 0x65, 0x78,
-  0x8a, 0x8b, 0x72, 0x4c, 0x35, 0x43, 0x70, 0xa8, 0xd0, 0xdc, 0xd4, 0xc3,
-  0xaf, 0x9f, 0x92, 0x89, 0x89, 0x8e, 0x91, 0x8e, 0x8a, 0x86, 0x80, 0x79,
-  0x6e, 0x5f, 0x4e, 0x3e, 0x32, 0x38, 0x54, 0x7a, 0x97, 0x8d, 0x56, 0x1b,
-  0x09, 0x20, 0x4f, 0x82, 0xb2, 0xdf, 0xf0, 0xda, 0xae, 0x82, 0x6b, 0x72,
-  0x90, 0xb2, 0xcf, 0xdf, 0xdd, 0xcd, 0xaf, 0x8b, 0x6b, 0x52, 0x42, 0x40,
-  0x49, 0x53, 0x59, 0x5b, 0x5d, 0x63, 0x6a, 0x69, 0x5e, 0x4c, 0x41, 0x4e,
-  0x75, 0xa7, 0xcd, 0xdd, 0xd9, 0xc9, 0xb3, 0x9e, 0x90, 0x8b, 0x8e, 0x92,
-  0x91, 0x89, 0x7c, 0x72, 0x6e, 0x71, 0x73, 0x6d, 0x60, 0x53, 0x50, 0x63,
-  0x7e, 0x80, 0x59, 0x1c, 0x00, 0x0b, 0x43, 0x80, 0xb8, 0xe9, 0xe3, 0xa4,
-  0x63, 0x46, 0x59, 0x84, 0xae, 0xcf, 0xe0, 0xe4, 0xe0, 0xd2, 0xbc, 0x9f,
-  0x80, 0x64, 0x4f, 0x4a, 0x53, 0x62, 0x6b, 0x6c, 0x6a, 0x69, 0x67, 0x5c,
-  0x46, 0x2d, 0x27, 0x3f, 0x70, 0xa6, 0xcd, 0xe2, 0xdc, 0xc6, 0xb0, 0x9f,
-  0x9a, 0xa0, 0xac, 0xb5, 0xb3, 0xa9, 0x97, 0x80, 0x6f, 0x65, 0x5c, 0x4d,
-  0x3e, 0x36, 0x3b, 0x4c, 0x65, 0x81, 0x8f, 0x7c, 0x46, 0x13, 0x09, 0x29,
-  0x5d, 0x8d, 0xbe, 0xf0, 0xf5, 0xd0, 0x9f, 0x72, 0x62, 0x77, 0x9c, 0xbc,
-  0xd3, 0xda, 0xd3, 0xbd, 0x9c, 0x78, 0x5a, 0x42, 0x36, 0x38, 0x44, 0x53,
-  0x5f, 0x68, 0x70, 0x72, 0x6c, 0x5a, 0x40, 0x31, 0x41, 0x6e, 0xa7, 0xd0,
-  0xe5, 0xe7, 0xd6, 0xbf, 0xa7, 0x95, 0x91, 0x9a, 0xa6, 0xae, 0xaa, 0x9b,
-  0x85, 0x70, 0x5f, 0x53, 0x4a, 0x40, 0x39, 0x3c, 0x52, 0x75, 0x92, 0x8e,
-  0x60, 0x22, 0x02, 0x13, 0x44, 0x7a, 0xac, 0xdd, 0xed, 0xcc, 0x99, 0x74,
-  0x70, 0x88, 0xaa, 0xc5, 0xd7, 0xdd, 0xd7, 0xc7, 0xae, 0x8e, 0x6e, 0x52,
-  0x41, 0x3f, 0x49, 0x55, 0x5f, 0x65, 0x67, 0x69, 0x66, 0x5c, 0x49, 0x35,
-  0x32, 0x4c, 0x81, 0xb7, 0xdd, 0xe9, 0xd9, 0xbd, 0xa4, 0x96, 0x94, 0x9c,
-  0xaa, 0xb3, 0xb2, 0xa6, 0x8e, 0x76, 0x67, 0x60, 0x60, 0x61, 0x62, 0x63,
-  0x69, 0x74, 0x7b, 0x67, 0x35, 0x01, 0x00, 0x16, 0x55, 0x93, 0xd0, 0xec,
-  0xb2, 0x56, 0x29, 0x3d, 0x78, 0xb5, 0xda, 0xea, 0xea, 0xe3, 0xdb, 0xd2,
-  0xc1, 0xa2, 0x7d, 0x5d, 0x4a, 0x4d, 0x5e, 0x72, 0x7d, 0x7c, 0x71, 0x61,
-  0x4d, 0x35, 0x1e, 0x17, 0x2a, 0x56, 0x89, 0xb6, 0xd6, 0xd6, 0xbd, 0xa4,
-  0x99, 0x9e, 0xab, 0xb9, 0xc5, 0xc9, 0xc6, 0xb7, 0xa0, 0x87, 0x6f, 0x5b,
-  0x4c, 0x41, 0x3a, 0x3b, 0x48, 0x5e, 0x76, 0x84, 0x77, 0x4a, 0x17, 0x02,
-  0x14, 0x42, 0x77, 0xa9, 0xdc, 0xed, 0xca, 0x94, 0x69, 0x63, 0x80, 0xa7,
-  0xc8, 0xde, 0xe5, 0xe0, 0xcf, 0xb2, 0x90, 0x6f, 0x52, 0x40, 0x3c, 0x42,
-  0x50, 0x5e, 0x68, 0x6e, 0x6c, 0x5b, 0x40, 0x2a, 0x25, 0x3e, 0x6e, 0xa0,
-  0xc7, 0xdf, 0xdc, 0xc9, 0xb2, 0xa1, 0x9f, 0xaa, 0xb8, 0xc2, 0xc2, 0xb5,
-  0x9e, 0x86, 0x73, 0x68, 0x61, 0x5a, 0x51, 0x4b, 0x4f, 0x60, 0x74, 0x77,
-  0x56, 0x1e, 0x00, 0x07, 0x39, 0x74, 0xac, 0xdf, 0xe0, 0xa0, 0x5c, 0x44,
-  0x5f, 0x93, 0xc3, 0xe2, 0xec, 0xe9, 0xe1, 0xd6, 0xc4, 0xaa, 0x8b, 0x6d,
-  0x55, 0x4c, 0x52, 0x5e, 0x6a, 0x6e, 0x68, 0x5e, 0x4f, 0x3d, 0x2b, 0x20,
-  0x22, 0x36, 0x60, 0x91, 0xb9, 0xd2, 0xce, 0xb7, 0xa2, 0x9b, 0xa1, 0xaf,
-  0xc1, 0xce, 0xcf, 0xc4, 0xb1, 0x98, 0x82, 0x71, 0x65, 0x5f, 0x5f, 0x60,
-  0x60, 0x5d, 0x58, 0x54, 0x41, 0x18, 0x00, 0x00, 0x13, 0x50, 0x8e, 0xc4,
-  0xd0, 0x92, 0x45, 0x2d, 0x50, 0x8b, 0xbe, 0xdb, 0xe8, 0xe8, 0xe2, 0xdb,
-  0xcc, 0xb2, 0x90, 0x71, 0x5d, 0x58, 0x5e, 0x6a, 0x71, 0x6e, 0x5f, 0x4a,
-  0x33, 0x20, 0x12, 0x0c, 0x17, 0x37, 0x67, 0x94, 0xb6, 0xc2, 0xb4, 0xa0,
-  0x99, 0xa2, 0xb2, 0xc3, 0xd0, 0xd5, 0xd0, 0xc2, 0xab, 0x93, 0x7c, 0x69,
-  0x5a, 0x4e, 0x4b, 0x4f, 0x59, 0x65, 0x67, 0x54, 0x29, 0x00, 0x00, 0x06,
-  0x34, 0x6c, 0xa2, 0xd0, 0xcc, 0x91, 0x56, 0x45, 0x64, 0x97, 0xc5, 0xe4,
-  0xf2, 0xf2, 0xeb, 0xd8, 0xb9, 0x98, 0x7a, 0x65, 0x5c, 0x60, 0x68, 0x6d,
-  0x6c, 0x64, 0x55, 0x42, 0x30, 0x21, 0x19, 0x1b, 0x2c, 0x4e, 0x7c, 0xa6,
-  0xc0, 0xc5, 0xb6, 0xa2, 0x96, 0x9d, 0xb1, 0xc9, 0xd9, 0xdc, 0xd1, 0xbb,
-  0xa0, 0x88, 0x76, 0x6c, 0x6a, 0x70, 0x78, 0x7e, 0x7d, 0x6c, 0x48, 0x18,
-  0x00, 0x00, 0x0c, 0x4c, 0x96, 0xce, 0xc9, 0x7b, 0x29, 0x15, 0x3f, 0x7b,
-  0xa6, 0xca, 0xe3, 0xe6, 0xe8, 0xea, 0xe0, 0xc3, 0x9b, 0x76, 0x64, 0x6c,
-  0x82, 0x94, 0x97, 0x8d, 0x76, 0x5b, 0x3d, 0x23, 0x14, 0x10, 0x18, 0x30,
-  0x59, 0x88, 0xab, 0xb6, 0xa7, 0x90, 0x87, 0x91, 0xa9, 0xc2, 0xd6, 0xe2,
-  0xe1, 0xd3, 0xbc, 0xa5, 0x93, 0x84, 0x76, 0x6c, 0x65, 0x60, 0x62, 0x66,
-  0x66, 0x56, 0x32, 0x0b, 0x00, 0x07, 0x24, 0x53, 0x8a, 0xaf, 0xb3, 0x94,
-  0x68, 0x55, 0x68, 0x8c, 0xb3, 0xd4, 0xe6, 0xee, 0xed, 0xe6, 0xd5, 0xba,
-  0x9c, 0x82, 0x73, 0x71, 0x74, 0x75, 0x70, 0x65, 0x58, 0x49, 0x39, 0x2a,
-  0x1d, 0x1a, 0x23, 0x39, 0x59, 0x7e, 0x9d, 0xa7, 0x9f, 0x92, 0x8f, 0x99,
-  0xad, 0xc4, 0xd5, 0xdb, 0xd8, 0xca, 0xb7, 0xa2, 0x91, 0x89, 0x89, 0x8c,
-  0x8d, 0x8c, 0x86, 0x72, 0x4b, 0x1c, 0x00, 0x00, 0x0c, 0x47, 0x91, 0xc4,
-  0xb4, 0x65, 0x1e, 0x14, 0x3e, 0x74, 0x9b, 0xc0, 0xdc, 0xe2, 0xe4, 0xe4,
-  0xdb, 0xc4, 0xa5, 0x8c, 0x87, 0x92, 0xa3, 0xae, 0xa8, 0x94, 0x7b, 0x5d,
-  0x3f, 0x27, 0x18, 0x16, 0x22, 0x38, 0x54, 0x70, 0x84, 0x88, 0x7e, 0x76,
-  0x7e, 0x92, 0xaa, 0xc1, 0xd3, 0xdd, 0xde, 0xd6, 0xc7, 0xb4, 0xa2, 0x96,
-  0x94, 0x95, 0x94, 0x8d, 0x80, 0x6e, 0x55, 0x36, 0x19, 0x0a, 0x0d, 0x24,
-  0x4a, 0x73, 0x90, 0x8e, 0x6d, 0x44, 0x37, 0x4d, 0x77, 0xa3, 0xc7, 0xe1,
-  0xee, 0xef, 0xe7, 0xd7, 0xc3, 0xae, 0x9f, 0x9a, 0xa0, 0xa7, 0xa9, 0xa3,
-  0x91, 0x73, 0x54, 0x38, 0x24, 0x1a, 0x1c, 0x2c, 0x43, 0x5d, 0x70, 0x75,
-  0x6e, 0x63, 0x63, 0x74, 0x8c, 0xa7, 0xbe, 0xcd, 0xd3, 0xd2, 0xcb, 0xc0,
-  0xb5, 0xac, 0xa7, 0xa6, 0xa9, 0xa9, 0xa4, 0x94, 0x76, 0x4b, 0x1d, 0x00,
-  0x05, 0x2e, 0x6d, 0xa6, 0xb2, 0x82, 0x3a, 0x12, 0x19, 0x41, 0x71, 0x9a,
-  0xbe, 0xd6, 0xdb, 0xd7, 0xcf, 0xc1, 0xad, 0x99, 0x93, 0x9a, 0xaa, 0xb8,
-  0xbb, 0xaf, 0x98, 0x7b, 0x5d, 0x41, 0x2a, 0x1f, 0x24, 0x36, 0x50, 0x66,
-  0x6e, 0x65, 0x56, 0x50, 0x58, 0x6f, 0x8b, 0xa6, 0xbe, 0xcb, 0xcc, 0xc6,
-  0xbc, 0xb2, 0xaa, 0xa4, 0xa2, 0xa6, 0xa9, 0xa2, 0x94, 0x7b, 0x55, 0x2a,
-  0x08, 0x04, 0x22, 0x56, 0x8a, 0xa1, 0x8a, 0x51, 0x21, 0x16, 0x2c, 0x53,
-  0x80, 0xa8, 0xc4, 0xd1, 0xd0, 0xca, 0xc0, 0xb5, 0xa9, 0x9e, 0x98, 0x9c,
-  0xa8, 0xb3, 0xb4, 0xaa, 0x92, 0x71, 0x4d, 0x2e, 0x1d, 0x1d, 0x30, 0x4c,
-  0x67, 0x71, 0x64, 0x49, 0x37, 0x3b, 0x4d, 0x66, 0x83, 0x9f, 0xb2, 0xb8,
-  0xb4, 0xac, 0xa4, 0xa0, 0xa1, 0xa8, 0xb3, 0xbe, 0xc1, 0xb8, 0x9e, 0x74,
-  0x41, 0x16, 0x06, 0x22, 0x5f, 0x9e, 0xba, 0x9f, 0x5c, 0x21, 0x0c, 0x1a,
-  0x3c, 0x65, 0x8e, 0xac, 0xba, 0xbb, 0xb6, 0xab, 0x9c, 0x90, 0x8b, 0x92,
-  0xa3, 0xb5, 0xbf, 0xbf, 0xb2, 0x96, 0x75, 0x55, 0x3e, 0x38, 0x42, 0x54,
-  0x64, 0x6b, 0x65, 0x55, 0x44, 0x3e, 0x47, 0x5a, 0x72, 0x88, 0x9d, 0xa8,
-  0xa7, 0xa0, 0x9c, 0x9d, 0x9f, 0xa0, 0xa4, 0xb4, 0xc4, 0xc1, 0x9f, 0x66,
-  0x2b, 0x0a, 0x1a, 0x54, 0x9e, 0xcf, 0xc0, 0x7b, 0x34, 0x11, 0x15, 0x33,
-  0x60, 0x8d, 0xae, 0xba, 0xb5, 0xab, 0xa2, 0x9b, 0x92, 0x8b, 0x87, 0x8c,
-  0x9d, 0xb1, 0xc1, 0xc7, 0xbb, 0x9c, 0x72, 0x4b, 0x32, 0x32, 0x4b, 0x6b,
-  0x81, 0x84, 0x74, 0x58, 0x3f, 0x36, 0x3d, 0x50, 0x69, 0x83, 0x99, 0xa4,
-  0xa4, 0xa0, 0x9a, 0x92, 0x8f, 0x96, 0xa5, 0xb9, 0xca, 0xca, 0xb1, 0x80,
-  0x44, 0x14, 0x0d, 0x3a, 0x88, 0xcd, 0xda, 0xa3, 0x50, 0x17, 0x0a, 0x22,
-  0x51, 0x85, 0xae, 0xbe, 0xb6, 0xa5, 0x96, 0x8f, 0x89, 0x81, 0x7c, 0x84,
-  0x97, 0xb0, 0xc3, 0xc8, 0xbb, 0x9a, 0x6f, 0x46, 0x2d, 0x32, 0x52, 0x79,
-  0x93, 0x93, 0x79, 0x53, 0x38, 0x34, 0x44, 0x60, 0x7f, 0x9e, 0xb2, 0xb0,
-  0x96, 0x79, 0x70, 0x78, 0x88, 0x99, 0xa8, 0xb6, 0xbe, 0xba, 0xa6, 0x8e,
-  0x74, 0x4c, 0x28, 0x1e, 0x36, 0x67, 0x9d, 0xc0, 0xbc, 0x90, 0x53, 0x28,
-  0x21, 0x38, 0x5c, 0x86, 0xae, 0xc7, 0xd0, 0xc7, 0xb0, 0x92, 0x77, 0x67,
-  0x6a, 0x81, 0xa0, 0xb9, 0xc5, 0xbf, 0xa6, 0x7f, 0x58, 0x39, 0x2f, 0x41,
-  0x61, 0x80, 0x93, 0x92, 0x7c, 0x60, 0x4a, 0x45, 0x4f, 0x62, 0x78, 0x8f,
-  0xa1, 0xa8, 0xa4, 0x98, 0x8b, 0x86, 0x89, 0x91, 0xa0, 0xb3, 0xbf, 0xba,
-  0x9d, 0x66, 0x28, 0x07, 0x19, 0x59, 0xa8, 0xdb, 0xcc, 0x85, 0x37, 0x0e,
-  0x10, 0x33, 0x65, 0x93, 0xad, 0xb0, 0xa7, 0xa0, 0x99, 0x8f, 0x83, 0x77,
-  0x76, 0x82, 0x98, 0xaf, 0xbd, 0xbd, 0xaf, 0x94, 0x73, 0x54, 0x3e, 0x3c,
-  0x4f, 0x6d, 0x87, 0x8f, 0x80, 0x63, 0x49, 0x41, 0x4e, 0x66, 0x7e, 0x95,
-  0xa4, 0xa6, 0x9f, 0x96, 0x90, 0x91, 0x96, 0x99, 0xa1, 0xad, 0xb3, 0xae,
-  0x99, 0x6e, 0x38, 0x12, 0x19, 0x50, 0x9b, 0xd2, 0xcc, 0x8b, 0x41, 0x1c,
-  0x22, 0x47, 0x76, 0xa3, 0xbd, 0xc1, 0xb8, 0xaf, 0xa7, 0x9d, 0x92, 0x8b,
-  0x8b, 0x95, 0xa7, 0xb9, 0xc2, 0xbb, 0xa8, 0x8c, 0x6c, 0x4f, 0x3e, 0x41,
-  0x56, 0x71, 0x87, 0x8f, 0x84, 0x69, 0x4e, 0x40, 0x47, 0x5f, 0x7c, 0x96,
-  0xa7, 0xab, 0xa2, 0x94, 0x87, 0x82, 0x89, 0x98, 0xab, 0xbc, 0xc5, 0xc0,
-  0xa7, 0x7c, 0x4a, 0x22, 0x1e, 0x45, 0x83, 0xbd, 0xd5, 0xb5, 0x70, 0x34,
-  0x1a, 0x29, 0x4e, 0x7a, 0xa2, 0xba, 0xbd, 0xb0, 0x9e, 0x91, 0x89, 0x85,
-  0x85, 0x87, 0x8e, 0x9b, 0xaa, 0xb2, 0xb2, 0xa2, 0x84, 0x65, 0x4e, 0x49,
-  0x56, 0x6a, 0x7b, 0x86, 0x85, 0x78, 0x66, 0x58, 0x59, 0x65, 0x77, 0x8c,
-  0x9e, 0xa7, 0xa2, 0x91, 0x7e, 0x76, 0x7d, 0x88, 0x93, 0xa0, 0xad, 0xb2,
-  0xaa, 0x96, 0x76, 0x4d, 0x2c, 0x23, 0x39, 0x67, 0x9e, 0xc8, 0xcf, 0xaa,
-  0x6c, 0x39, 0x2a, 0x3f, 0x67, 0x92, 0xb7, 0xcd, 0xcf, 0xc0, 0xa8, 0x8f,
-  0x7c, 0x73, 0x75, 0x80, 0x90, 0xa2, 0xad, 0xaa, 0x96, 0x77, 0x5a, 0x47,
-  0x42, 0x4c, 0x60, 0x76, 0x84, 0x86, 0x7d, 0x6c, 0x5c, 0x59, 0x63, 0x75,
-  0x8c, 0x9f, 0xa7, 0xa4, 0x9c, 0x94, 0x90, 0x94, 0x9e, 0xa8, 0xb2, 0xb8,
-  0xac, 0x82, 0x43, 0x0e, 0x02, 0x2c, 0x7b, 0xc9, 0xe6, 0xba, 0x61, 0x1a,
-  0x05, 0x1b, 0x4f, 0x8b, 0xba, 0xd0, 0xc9, 0xb1, 0x9a, 0x8c, 0x85, 0x83,
-  0x84, 0x8d, 0x9d, 0xb0, 0xbe, 0xbe, 0xb0, 0x98, 0x7a, 0x5a, 0x3d, 0x2f,
-  0x3a, 0x5e, 0x84, 0x98, 0x8e, 0x6b, 0x45, 0x33, 0x3a, 0x52, 0x71, 0x91,
-  0xa8, 0xb1, 0xaa, 0x9c, 0x92, 0x90, 0x97, 0xa1, 0xab, 0xb0, 0xb2, 0xb1,
-  0xa1, 0x76, 0x3a, 0x09, 0x06, 0x3a, 0x88, 0xcd, 0xda, 0x9d, 0x47, 0x11,
-  0x0b, 0x2c, 0x62, 0x99, 0xc0, 0xd0, 0xc6, 0xae, 0x99, 0x8f, 0x8d, 0x8f,
-  0x93, 0x9d, 0xac, 0xbc, 0xc7, 0xc2, 0xac, 0x8c, 0x66, 0x45, 0x32, 0x39,
-  0x52, 0x6d, 0x7d, 0x7d, 0x6c, 0x55, 0x43, 0x3e, 0x48, 0x5b, 0x72, 0x88,
-  0x97, 0x9d, 0x98, 0x8f, 0x89, 0x88, 0x8e, 0x9e, 0xb1, 0xc2, 0xcb, 0xc7,
-  0xb0, 0x88, 0x57, 0x2c, 0x1c, 0x3b, 0x77, 0xb2, 0xce, 0xb5, 0x72, 0x35,
-  0x1a, 0x21, 0x43, 0x6e, 0x95, 0xb0, 0xb7, 0xae, 0x9e, 0x8e, 0x7f, 0x76,
-  0x76, 0x81, 0x96, 0xb0, 0xc2, 0xc6, 0xb6, 0x9b, 0x7c, 0x61, 0x50, 0x4e,
-  0x5b, 0x72, 0x87, 0x90, 0x85, 0x69, 0x4c, 0x3d, 0x45, 0x5d, 0x78, 0x90,
-  0x9f, 0xa2, 0x97, 0x8a, 0x83, 0x87, 0x90, 0x9b, 0xa3, 0xa6, 0xa9, 0xac,
-  0x9f, 0x74, 0x3b, 0x12, 0x13, 0x42, 0x88, 0xc7, 0xd8, 0xa9, 0x5a, 0x20,
-  0x13, 0x2d, 0x5e, 0x92, 0xba, 0xca, 0xc0, 0xa9, 0x92, 0x84, 0x80, 0x7e,
-  0x80, 0x8b, 0x9c, 0xaf, 0xbe, 0xbe, 0xae, 0x91, 0x6c, 0x4a, 0x34, 0x35,
-  0x50, 0x76, 0x93, 0x9a, 0x86, 0x62, 0x44, 0x38, 0x3f, 0x54, 0x6f, 0x8b,
-  0xa0, 0xa8, 0xa0, 0x8d, 0x7d, 0x77, 0x7b, 0x88, 0x99, 0xaa, 0xba, 0xc1,
-  0xb3, 0x8c, 0x58, 0x26, 0x11, 0x2c, 0x6b, 0xb3, 0xdd, 0xc9, 0x82, 0x3b,
-  0x16, 0x1b, 0x3f, 0x6f, 0x9c, 0xba, 0xc2, 0xb7, 0xa2, 0x8c, 0x7c, 0x72,
-  0x70, 0x7a, 0x8c, 0xa3, 0xb7, 0xc0, 0xb7, 0x9c, 0x77, 0x54, 0x3e, 0x41,
-  0x5b, 0x7d, 0x96, 0x9a, 0x86, 0x68, 0x4f, 0x45, 0x4e, 0x63, 0x7e, 0x96,
-  0xa3, 0xa1, 0x95, 0x8b, 0x86, 0x88, 0x91, 0x9c, 0xa3, 0xa3, 0xa0, 0x9a,
-  0x86, 0x57, 0x22, 0x0b, 0x27, 0x6b, 0xb7, 0xe0, 0xc4, 0x77, 0x2f, 0x13,
-  0x26, 0x56, 0x8f, 0xbc, 0xd0, 0xca, 0xb1, 0x97, 0x86, 0x82, 0x85, 0x8a,
-  0x94, 0xa2, 0xb0, 0xbb, 0xb7, 0xa5, 0x8a, 0x6a, 0x4b, 0x38, 0x3d, 0x56,
-  0x73, 0x88, 0x8a, 0x7a, 0x62, 0x4f, 0x47, 0x50, 0x64, 0x7c, 0x94, 0xa6,
-  0xa8, 0x9e, 0x8f, 0x85, 0x86, 0x91, 0x9e, 0xab, 0xb8, 0xc1, 0xbb, 0x9d,
-  0x6c, 0x37, 0x12, 0x17, 0x48, 0x8e, 0xca, 0xd4, 0x9d, 0x4d, 0x19, 0x12,
-  0x2d, 0x5b, 0x8f, 0xb7, 0xc8, 0xc3, 0xb0, 0x98, 0x82, 0x73, 0x70, 0x7a,
-  0x8f, 0xa7, 0xba, 0xc4, 0xbe, 0xa5, 0x84, 0x62, 0x45, 0x36, 0x3c, 0x58,
-  0x7e, 0x98, 0x99, 0x7a, 0x52, 0x37, 0x36, 0x4b, 0x6b, 0x8e, 0xac, 0xb8,
-  0xb2, 0xa1, 0x93, 0x8c, 0x8a, 0x89, 0x90, 0x9f, 0xb0, 0xbb, 0xb6, 0x97,
-  0x61, 0x28, 0x08, 0x12, 0x45, 0x8d, 0xc9, 0xd2, 0xa0, 0x54, 0x1d, 0x12,
-  0x2e, 0x5e, 0x93, 0xbb, 0xd2, 0xd1, 0xbd, 0xa1, 0x89, 0x7a, 0x79, 0x82,
-  0x91, 0xa6, 0xbb, 0xc6, 0xbe, 0xa4, 0x7e, 0x55, 0x34, 0x29, 0x39, 0x5d,
-  0x81, 0x97, 0x94, 0x77, 0x54, 0x3d, 0x3d, 0x4f, 0x68, 0x83, 0x9a, 0xa8,
-  0xa7, 0x9b, 0x89, 0x81, 0x85, 0x8f, 0x9e, 0xac, 0xba, 0xc3, 0xbe, 0xa2,
-  0x73, 0x3e, 0x19, 0x1d, 0x4a, 0x8c, 0xc4, 0xd2, 0xa5, 0x5a, 0x21, 0x10,
-  0x25, 0x50, 0x81, 0xac, 0xc4, 0xc4, 0xb4, 0x9c, 0x85, 0x74, 0x6e, 0x75,
-  0x85, 0x9d, 0xb3, 0xc1, 0xc1, 0xb2, 0x99, 0x7c, 0x60, 0x4c, 0x45, 0x50,
-  0x66, 0x7d, 0x8b, 0x87, 0x70, 0x51, 0x3f, 0x43, 0x58, 0x74, 0x90, 0xa5,
-  0xad, 0xa6, 0x99, 0x8d, 0x8b, 0x91, 0x99, 0xa0, 0xa7, 0xac, 0xae, 0xa5,
-  0x89, 0x59, 0x22, 0x08, 0x1d, 0x5d, 0xaa, 0xd7, 0xbf, 0x71, 0x28, 0x0d,
-  0x1e, 0x4b, 0x85, 0xb4, 0xcc, 0xca, 0xb5, 0x9b, 0x87, 0x7f, 0x82, 0x8c,
-  0x9c, 0xb0, 0xc0, 0xc7, 0xbe, 0xa3, 0x84, 0x6a, 0x54, 0x47, 0x4a, 0x5b,
-  0x6e, 0x78, 0x76, 0x6a, 0x59, 0x4a, 0x44, 0x4d, 0x61, 0x7b, 0x92, 0xa0,
-  0xa2, 0x9a, 0x90, 0x8a, 0x8d, 0x99, 0xa9, 0xb9, 0xc4, 0xc7, 0xbe, 0xa6,
-  0x81, 0x51, 0x26, 0x1e, 0x45, 0x86, 0xc1, 0xd4, 0xaa, 0x5e, 0x26, 0x13,
-  0x24, 0x4b, 0x7c, 0xa8, 0xbf, 0xbe, 0xab, 0x92, 0x7d, 0x73, 0x76, 0x83,
-  0x96, 0xab, 0xbe, 0xc8, 0xc4, 0xb0, 0x91, 0x71, 0x54, 0x42, 0x47, 0x60,
-  0x7f, 0x94, 0x91, 0x78, 0x56, 0x3d, 0x38, 0x46, 0x61, 0x81, 0x9b, 0xa7,
-  0xa5, 0x9b, 0x90, 0x85, 0x7f, 0x80, 0x89, 0x97, 0xa6, 0xb4, 0xbd, 0xb1,
-  0x88, 0x4c, 0x1b, 0x0e, 0x30, 0x70, 0xb8, 0xe0, 0xcd, 0x89, 0x3f, 0x16,
-  0x1a, 0x40, 0x74, 0xa8, 0xcd, 0xd6, 0xc4, 0xa3, 0x83, 0x70, 0x6b, 0x72,
-  0x84, 0x9a, 0xb1, 0xc2, 0xc3, 0xb3, 0x95, 0x6f, 0x4e, 0x39, 0x3b, 0x56,
-  0x79, 0x97, 0xa2, 0x8e, 0x66, 0x45, 0x3e, 0x4b, 0x62, 0x7d, 0x94, 0xa5,
-  0xab, 0xa1, 0x8c, 0x7e, 0x7c, 0x84, 0x93, 0xa4, 0xb6, 0xc2, 0xbe, 0xa5,
-  0x77, 0x42, 0x1e, 0x24, 0x54, 0x96, 0xcc, 0xd6, 0xac, 0x68, 0x32, 0x1d,
-  0x2b, 0x50, 0x7b, 0xa4, 0xc2, 0xc8, 0xb6, 0x97, 0x76, 0x61, 0x60, 0x71,
-  0x8a, 0xa6, 0xbd, 0xc6, 0xbb, 0xa1, 0x82, 0x68, 0x57, 0x52, 0x59, 0x68,
-  0x76, 0x81, 0x85, 0x7d, 0x6d, 0x5a, 0x4e, 0x52, 0x63, 0x7b, 0x92, 0xa2,
-  0xaa, 0xa9, 0xa0, 0x95, 0x8f, 0x90, 0x94, 0x9c, 0xa2, 0xa8, 0xab, 0xa3,
-  0x8a, 0x5e, 0x2c, 0x0c, 0x17, 0x4c, 0x95, 0xcc, 0xc7, 0x85, 0x39, 0x12,
-  0x17, 0x3c, 0x73, 0xa8, 0xc9, 0xd3, 0xc4, 0xa8, 0x8d, 0x7b, 0x79, 0x85,
-  0x98, 0xae, 0xc2, 0xcb, 0xc2, 0xa7, 0x88, 0x72, 0x60, 0x52, 0x4c, 0x51,
-  0x5f, 0x6c, 0x6e, 0x69, 0x63, 0x5b, 0x52, 0x4e, 0x57, 0x6a, 0x80, 0x93,
-  0x9e, 0xa1, 0x9d, 0x95, 0x8d, 0x8e, 0x9a, 0xa8, 0xb3, 0xbb, 0xbc, 0xb1,
-  0x9e, 0x82, 0x5d, 0x37, 0x25, 0x38, 0x6b, 0xa5, 0xc4, 0xb1, 0x72, 0x35,
-  0x1a, 0x22, 0x43, 0x6e, 0x9b, 0xb8, 0xbe, 0xb1, 0x9c, 0x86, 0x7a, 0x7b,
-  0x87, 0x97, 0xa8, 0xb3, 0xb8, 0xb8, 0xae, 0x9a, 0x82, 0x6d, 0x5e, 0x5a,
-  0x5e, 0x66, 0x6c, 0x70, 0x70, 0x69, 0x5b, 0x50, 0x4c, 0x55, 0x6a, 0x80,
-  0x92, 0x9f, 0xa6, 0xa4, 0x9b, 0x8e, 0x81, 0x80, 0x8e, 0xa1, 0xb1, 0xba,
-  0xb7, 0xa0, 0x73, 0x40, 0x1c, 0x1d, 0x45, 0x7e, 0xb5, 0xcd, 0xb4, 0x76,
-  0x39, 0x1a, 0x22, 0x47, 0x74, 0xa1, 0xc3, 0xce, 0xc2, 0xa4, 0x83, 0x6b,
-  0x64, 0x70, 0x84, 0x9d, 0xb6, 0xc4, 0xbe, 0xa7, 0x85, 0x63, 0x48, 0x38,
-  0x3c, 0x54, 0x73, 0x8f, 0x9a, 0x8d, 0x6d, 0x4f, 0x44, 0x4a, 0x5b, 0x71,
-  0x89, 0x9c, 0xa6, 0xa0, 0x90, 0x84, 0x7e, 0x7e, 0x87, 0x97, 0xaa, 0xb9,
-  0xbc, 0xa8, 0x7c, 0x48, 0x21, 0x1d, 0x45, 0x84, 0xbc, 0xd1, 0xb2, 0x70,
-  0x35, 0x1e, 0x27, 0x48, 0x72, 0x9b, 0xb8, 0xc4, 0xbf, 0xa6, 0x85, 0x69,
-  0x5d, 0x68, 0x82, 0x9e, 0xb4, 0xbc, 0xb3, 0x9a, 0x7e, 0x6a, 0x5b, 0x55,
-  0x58, 0x5f, 0x67, 0x6e, 0x74, 0x75, 0x71, 0x66, 0x59, 0x54, 0x5e, 0x72,
-  0x89, 0x9d, 0xab, 0xb1, 0xab, 0x9c, 0x90, 0x8c, 0x8f, 0x95, 0x9a, 0x9d,
-  0x9f, 0x9e, 0x92, 0x70, 0x3e, 0x12, 0x07, 0x25, 0x62, 0xa7, 0xcc, 0xb2,
-  0x6a, 0x28, 0x11, 0x24, 0x51, 0x88, 0xb5, 0xd0, 0xd9, 0xca, 0xae, 0x91,
-  0x7e, 0x7a, 0x84, 0x98, 0xaf, 0xc0, 0xc2, 0xb1, 0x94, 0x76, 0x5e, 0x4f,
-  0x48, 0x46, 0x4a, 0x54, 0x60, 0x6a, 0x6d, 0x6a, 0x63, 0x5d, 0x59, 0x5f,
-  0x70, 0x86, 0x9b, 0xa8, 0xaa, 0xa5, 0x9d, 0x96, 0x94, 0x97, 0x9e, 0xa6,
-  0xab, 0xaa, 0xa3, 0x9a, 0x8b, 0x70, 0x4a, 0x28, 0x1d, 0x33, 0x64, 0x9a,
-  0xba, 0xb1, 0x81, 0x47, 0x25, 0x25, 0x3e, 0x66, 0x96, 0xc0, 0xd7, 0xd6,
-  0xbe, 0x96, 0x71, 0x61, 0x6c, 0x87, 0xa5, 0xbc, 0xc6, 0xbc, 0xa4, 0x85,
-  0x69, 0x56, 0x4d, 0x4a, 0x4c, 0x54, 0x5e, 0x67, 0x6d, 0x6e, 0x6a, 0x63,
-  0x5e, 0x60, 0x71, 0x8a, 0xa3, 0xb5, 0xbd, 0xba, 0xae, 0x9f, 0x91, 0x8a,
-  0x8d, 0x96, 0x9f, 0xa0, 0x9b, 0x92, 0x83, 0x6d, 0x4e, 0x2a, 0x15, 0x1c,
-  0x3e, 0x72, 0xa8, 0xc1, 0xa8, 0x6a, 0x34, 0x24, 0x3a, 0x68, 0x9e, 0xc9,
-  0xe4, 0xe7, 0xd5, 0xb4, 0x94, 0x80, 0x7c, 0x86, 0x99, 0xac, 0xba, 0xbb,
-  0xa8, 0x89, 0x6a, 0x50, 0x40, 0x3c, 0x42, 0x4d, 0x5a, 0x69, 0x74, 0x79,
-  0x78, 0x71, 0x6a, 0x68, 0x70, 0x80, 0x96, 0xab, 0xb8, 0xba, 0xb2, 0xa7,
-  0x9e, 0x96, 0x93, 0x94, 0x97, 0x9a, 0x9a, 0x98, 0x8c, 0x71, 0x4c, 0x2a,
-  0x19, 0x25, 0x4d, 0x80, 0xa8, 0xb2, 0x95, 0x5c, 0x2f, 0x26, 0x3f, 0x6b,
-  0x9d, 0xc6, 0xde, 0xdb, 0xc3, 0xa0, 0x82, 0x74, 0x7a, 0x8e, 0xa2, 0xb0,
-  0xb4, 0xa8, 0x90, 0x77, 0x64, 0x57, 0x4f, 0x48, 0x43, 0x41, 0x44, 0x4d,
-  0x5d, 0x6d, 0x78, 0x7d, 0x7a, 0x76, 0x7a, 0x89, 0x9f, 0xb4, 0xc4, 0xca,
-  0xc2, 0xaf, 0x9d, 0x91, 0x8d, 0x8e, 0x8c, 0x88, 0x85, 0x85, 0x82, 0x73,
-  0x58, 0x33, 0x10, 0x04, 0x16, 0x44, 0x82, 0xb8, 0xc6, 0xa0, 0x5d, 0x2c,
-  0x29, 0x4d, 0x84, 0xb6, 0xd7, 0xea, 0xe9, 0xd5, 0xb4, 0x94, 0x7c, 0x75,
-  0x7d, 0x8f, 0xa1, 0xaa, 0xa4, 0x8d, 0x6f, 0x53, 0x3b, 0x2f, 0x2c, 0x34,
-  0x43, 0x57, 0x6c, 0x7f, 0x8c, 0x8e, 0x86, 0x7e, 0x79, 0x7d, 0x8d, 0xa0,
-  0xb3, 0xc2, 0xc6, 0xc0, 0xb2, 0xa0, 0x8d, 0x81, 0x80, 0x83, 0x86, 0x87,
-  0x87, 0x7e, 0x67, 0x44, 0x22, 0x0f, 0x17, 0x3c, 0x6e, 0x9e, 0xb7, 0xa9,
-  0x79, 0x49, 0x38, 0x49, 0x70, 0x9e, 0xc8, 0xde, 0xe0, 0xd3, 0xb7, 0x99,
-  0x86, 0x80, 0x83, 0x8b, 0x92, 0x95, 0x8f, 0x81, 0x6d, 0x5c, 0x53, 0x4f,
-  0x4f, 0x4d, 0x48, 0x43, 0x43, 0x50, 0x6a, 0x89, 0xa2, 0xaf, 0xae, 0xa5,
-  0x9f, 0xa4, 0xac, 0xb4, 0xb4, 0xaf, 0xa6, 0x9c, 0x93, 0x8e, 0x8c, 0x85,
-  0x78, 0x68, 0x5c, 0x58, 0x5b, 0x5e, 0x52, 0x33, 0x15, 0x0d, 0x24, 0x56,
-  0x98, 0xcb, 0xd7, 0xb2, 0x6d, 0x3b, 0x3e, 0x6b, 0xa3, 0xd1, 0xec, 0xf2,
-  0xe6, 0xcb, 0xa6, 0x85, 0x72, 0x6d, 0x71, 0x79, 0x83, 0x8b, 0x89, 0x7a,
-  0x61, 0x4a, 0x3a, 0x36, 0x3b, 0x42, 0x4a, 0x54, 0x68, 0x85, 0xa2, 0xba,
-  0xc3, 0xb8, 0xa2, 0x8e, 0x8c, 0x99, 0xa8, 0xb7, 0xbe, 0xb9, 0xa8, 0x91,
-  0x7c, 0x6e, 0x67, 0x65, 0x63, 0x61, 0x63, 0x68, 0x68, 0x57, 0x38, 0x1b,
-  0x11, 0x24, 0x54, 0x92, 0xc4, 0xdb, 0xc8, 0x92, 0x5a, 0x46, 0x5f, 0x8d,
-  0xba, 0xda, 0xe6, 0xe2, 0xce, 0xb1, 0x92, 0x73, 0x5a, 0x4b, 0x4a, 0x56,
-  0x67, 0x77, 0x7b, 0x6e, 0x5a, 0x4b, 0x49, 0x4f, 0x52, 0x50, 0x51, 0x5f,
-  0x80, 0xa9, 0xcb, 0xdc, 0xdb, 0xc9, 0xae, 0x9b, 0x95, 0x9a, 0xa2, 0xa4,
-  0x9e, 0x92, 0x83, 0x76, 0x6f, 0x6a, 0x67, 0x60, 0x54, 0x4c, 0x4e, 0x54,
-  0x51, 0x3f, 0x27, 0x1c, 0x2d, 0x5d, 0x96, 0xcb, 0xed, 0xe0, 0xa9, 0x68,
-  0x49, 0x5c, 0x89, 0xb6, 0xd7, 0xe6, 0xe4, 0xd1, 0xaf, 0x89, 0x68, 0x52,
-  0x4a, 0x4d, 0x56, 0x5f, 0x67, 0x6a, 0x68, 0x62, 0x5d, 0x5c, 0x5c, 0x60,
-  0x63, 0x68, 0x76, 0x90, 0xaf, 0xcc, 0xdd, 0xdc, 0xc7, 0xa8, 0x8c, 0x80,
-  0x81, 0x86, 0x8b, 0x8a, 0x80, 0x73, 0x68, 0x61, 0x5e, 0x60, 0x62, 0x62,
-  0x61, 0x62, 0x63, 0x5c, 0x4d, 0x3d, 0x37, 0x46, 0x6d, 0xa2, 0xd0, 0xea,
-  0xe3, 0xbb, 0x85, 0x60, 0x5e, 0x76, 0x97, 0xb4, 0xc5, 0xc7, 0xba, 0xa0,
-  0x81, 0x65, 0x50, 0x44, 0x43, 0x46, 0x4c, 0x53, 0x5c, 0x67, 0x76, 0x87,
-  0x96, 0x9c, 0x99, 0x8e, 0x84, 0x85, 0x92, 0xa5, 0xb6, 0xc2, 0xc2, 0xb6,
-  0x9f, 0x88, 0x77, 0x6b, 0x67, 0x68, 0x6d, 0x71, 0x70, 0x6c, 0x69, 0x6e,
-  0x77, 0x78, 0x66, 0x46, 0x29, 0x22, 0x3b, 0x70, 0xa8, 0xd3, 0xe7, 0xda,
-  0xab, 0x76, 0x62, 0x72, 0x93, 0xae, 0xbc, 0xbc, 0xb1, 0xa4, 0x9a, 0x95,
-  0x8a, 0x74, 0x59, 0x41, 0x33, 0x33, 0x40, 0x52, 0x66, 0x7a, 0x85, 0x88,
-  0x82, 0x79, 0x76, 0x7e, 0x8e, 0xa1, 0xb3, 0xbd, 0xbe, 0xb9, 0xaf, 0xa0,
-  0x91, 0x83, 0x75, 0x6a, 0x62, 0x5a, 0x57, 0x5b, 0x61, 0x6b, 0x76, 0x7c,
-  0x7c, 0x7a, 0x73, 0x61, 0x4c, 0x3e, 0x3f, 0x53, 0x79, 0xa9, 0xd0, 0xe3,
-  0xe0, 0xc6, 0x9e, 0x79, 0x65, 0x63, 0x70, 0x82, 0x94, 0xa1, 0xa6, 0xa0,
-  0x93, 0x80, 0x6b, 0x57, 0x49, 0x41, 0x42, 0x4a, 0x57, 0x67, 0x7a, 0x8d,
-  0x9c, 0xa7, 0xab, 0xa7, 0x9d, 0x92, 0x8c, 0x8e, 0x96, 0x9e, 0xa4, 0xa2,
-  0x96, 0x85, 0x75, 0x67, 0x5c, 0x55, 0x51, 0x51, 0x56, 0x5e, 0x6c, 0x7a,
-  0x85, 0x8e, 0x95, 0x8f, 0x74, 0x54, 0x3e, 0x3f, 0x59, 0x87, 0xb7, 0xd7,
-  0xdd, 0xca, 0xa4, 0x7c, 0x66, 0x66, 0x75, 0x85, 0x8e, 0x8e, 0x82, 0x72,
-  0x67, 0x68, 0x74, 0x81, 0x87, 0x7f, 0x6a, 0x54, 0x4a, 0x4f, 0x62, 0x7b,
-  0x94, 0xa9, 0xb4, 0xb1, 0xa3, 0x92, 0x86, 0x88, 0x94, 0x9e, 0x9f, 0x95,
-  0x84, 0x70, 0x64, 0x66, 0x6f, 0x72, 0x69, 0x5d, 0x50, 0x48, 0x47, 0x52,
-  0x64, 0x77, 0x88, 0x9d, 0xb0, 0xbb, 0xbd, 0xb4, 0x9e, 0x7e, 0x60, 0x4c,
-  0x4d, 0x64, 0x84, 0xa4, 0xba, 0xc0, 0xb1, 0x90, 0x6a, 0x4f, 0x40, 0x3f,
-  0x4e, 0x64, 0x7c, 0x91, 0x9e, 0xa2, 0xa0, 0x9a, 0x92, 0x8b, 0x80, 0x73,
-  0x69, 0x66, 0x68, 0x70, 0x7e, 0x90, 0x9e, 0xa5, 0xa2, 0x94, 0x7e, 0x69,
-  0x5d, 0x5a, 0x61, 0x6c, 0x75, 0x7b, 0x80, 0x82, 0x85, 0x8a, 0x8e, 0x8f,
-  0x8c, 0x84, 0x7a, 0x70, 0x6e, 0x74, 0x81, 0x91, 0xa2, 0xaf, 0xad, 0x94,
-  0x6e, 0x4b, 0x34, 0x34, 0x4e, 0x73, 0x96, 0xae, 0xb3, 0xa1, 0x84, 0x6e,
-  0x68, 0x74, 0x87, 0x9a, 0xa6, 0xa6, 0x97, 0x82, 0x74, 0x74, 0x7f, 0x8e,
-  0x96, 0x90, 0x7d, 0x66, 0x55, 0x51, 0x5a, 0x6a, 0x7c, 0x8b, 0x94, 0x93,
-  0x8b, 0x82, 0x7f, 0x86, 0x94, 0x9e, 0xa1, 0x98, 0x87, 0x77, 0x6e, 0x6f,
-  0x75, 0x78, 0x75, 0x6c, 0x63, 0x5f, 0x64, 0x6e, 0x7b, 0x89, 0x96, 0xa0,
-  0xa6, 0xa7, 0xa6, 0x9c, 0x89, 0x73, 0x5f, 0x4f, 0x4d, 0x5b, 0x74, 0x8d,
-  0xa3, 0xb2, 0xaf, 0x9c, 0x84, 0x6c, 0x5c, 0x57, 0x60, 0x70, 0x82, 0x92,
-  0x9a, 0x9d, 0x9a, 0x94, 0x8e, 0x87, 0x80, 0x76, 0x6c, 0x66, 0x63, 0x63,
-  0x66, 0x6d, 0x78, 0x85, 0x8f, 0x93, 0x90, 0x89, 0x80, 0x7b, 0x7d, 0x81,
-  0x84, 0x83, 0x80, 0x7d, 0x7b, 0x7b, 0x7d, 0x80, 0x82, 0x82, 0x80, 0x7b,
-  0x75, 0x6f, 0x6e, 0x72, 0x7b, 0x86, 0x92, 0x9e, 0xa0, 0x95, 0x7c, 0x60,
-  0x4b, 0x49, 0x5b, 0x76, 0x90, 0xa4, 0xab, 0xa4, 0x94, 0x82, 0x78, 0x79,
-  0x82, 0x8e, 0x97, 0x96, 0x89, 0x75, 0x66, 0x65, 0x70, 0x7f, 0x8a, 0x8c,
-  0x85, 0x78, 0x6b, 0x65, 0x69, 0x71, 0x79, 0x82, 0x88, 0x8a, 0x88, 0x88,
-  0x8b, 0x90, 0x99, 0xa0, 0xa1, 0x98, 0x88, 0x74, 0x67, 0x62, 0x62, 0x68,
-  0x6d, 0x6e, 0x6c, 0x6d, 0x71, 0x77, 0x80, 0x89, 0x90, 0x96, 0x9a, 0x9e,
-  0xa1, 0xa3, 0xa3, 0x9d, 0x8c, 0x76, 0x5f, 0x4e, 0x4a, 0x56, 0x6a, 0x80,
-  0x94, 0xa0, 0xa1, 0x97, 0x89, 0x7c, 0x74, 0x74, 0x7b, 0x85, 0x8d, 0x90,
-  0x8f, 0x8c, 0x8b, 0x8d, 0x90, 0x90, 0x8a, 0x7e, 0x6f, 0x62, 0x5b, 0x5c,
-  0x63, 0x6e, 0x78, 0x82, 0x89, 0x8d, 0x8e, 0x90, 0x92, 0x96, 0x9a, 0x9a,
-  0x94, 0x8b, 0x7f, 0x75, 0x71, 0x73, 0x76, 0x79, 0x7a, 0x79, 0x75, 0x73,
-  0x76, 0x7b, 0x84, 0x90, 0x9a, 0x9b, 0x8d, 0x72, 0x56, 0x45, 0x47, 0x60,
-  0x81, 0x9f, 0xb2, 0xb7, 0xad, 0x9a, 0x89, 0x81, 0x83, 0x8c, 0x94, 0x95,
-  0x8b, 0x76, 0x60, 0x54, 0x59, 0x6a, 0x80, 0x90, 0x92, 0x86, 0x74, 0x65,
-  0x65, 0x70, 0x7f, 0x8c, 0x91, 0x8f, 0x8a, 0x86, 0x89, 0x92, 0x9c, 0xa5,
-  0xa7, 0x9d, 0x8a, 0x76, 0x66, 0x5c, 0x59, 0x5a, 0x5d, 0x5f, 0x61, 0x63,
-  0x69, 0x73, 0x81, 0x8c, 0x94, 0x99, 0x9a, 0x9a, 0x9e, 0xa5, 0xaa, 0xac,
-  0xa4, 0x90, 0x73, 0x58, 0x46, 0x3f, 0x46, 0x58, 0x6c, 0x7e, 0x8c, 0x91,
-  0x8d, 0x89, 0x87, 0x86, 0x86, 0x88, 0x89, 0x89, 0x88, 0x87, 0x85, 0x83,
-  0x85, 0x88, 0x88, 0x84, 0x7f, 0x76, 0x6c, 0x67, 0x68, 0x6b, 0x6e, 0x71,
-  0x72, 0x74, 0x78, 0x80, 0x8a, 0x94, 0x9c, 0xa0, 0x9f, 0x9a, 0x91, 0x88,
-  0x80, 0x7a, 0x76, 0x72, 0x6d, 0x6a, 0x68, 0x69, 0x6c, 0x72, 0x79, 0x80,
-  0x87, 0x8f, 0x97, 0x9e, 0x9e, 0x92, 0x7c, 0x64, 0x52, 0x50, 0x5e, 0x75,
-  0x8c, 0x9e, 0xa5, 0xa0, 0x96, 0x8d, 0x88, 0x87, 0x88, 0x89, 0x88, 0x84,
-  0x7a, 0x70, 0x66, 0x61, 0x62, 0x6a, 0x77, 0x85, 0x8e, 0x90, 0x8e, 0x8b,
-  0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x7e, 0x7d, 0x7e, 0x83, 0x8a, 0x90,
-  0x92, 0x90, 0x88, 0x7d, 0x70, 0x66, 0x62, 0x62, 0x65, 0x6a, 0x6d, 0x70,
-  0x75, 0x7d, 0x89, 0x96, 0x9f, 0xa1, 0x9f, 0x9d, 0x9e, 0x9e, 0x9e, 0x9a,
-  0x8b, 0x75, 0x5f, 0x4f, 0x47, 0x49, 0x54, 0x61, 0x6f, 0x7d, 0x89, 0x92,
-  0x98, 0x9e, 0xa1, 0xa0, 0x9d, 0x97, 0x8f, 0x87, 0x80, 0x7b, 0x77, 0x76,
-  0x75, 0x77, 0x79, 0x7a, 0x7a, 0x78, 0x76, 0x77, 0x7b, 0x80, 0x83, 0x83,
-  0x80, 0x7d, 0x7d, 0x80, 0x85, 0x8c, 0x92, 0x96, 0x96, 0x95, 0x91, 0x8a,
-  0x86, 0x82, 0x7d, 0x79, 0x75, 0x71, 0x6e, 0x6e, 0x70, 0x74, 0x78, 0x7c,
-  0x81, 0x85, 0x8a, 0x91, 0x9a, 0x9e, 0x99, 0x8c, 0x78, 0x63, 0x57, 0x58,
-  0x64, 0x72, 0x81, 0x8a, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x8b,
-  0x87, 0x85, 0x81, 0x78, 0x70, 0x69, 0x66, 0x69, 0x71, 0x7a, 0x81, 0x85,
-  0x87, 0x87, 0x89, 0x8c, 0x8c, 0x8a, 0x84, 0x7d, 0x78, 0x77, 0x7a, 0x7f,
-  0x85, 0x88, 0x88, 0x85, 0x7d, 0x76, 0x74, 0x74, 0x76, 0x79, 0x7a, 0x77,
-  0x73, 0x70, 0x72, 0x78, 0x82, 0x8a, 0x8f, 0x92, 0x92, 0x92, 0x93, 0x95,
-  0x97, 0x95, 0x8c, 0x7d, 0x6c, 0x5d, 0x55, 0x56, 0x5e, 0x67, 0x6f, 0x75,
-  0x7b, 0x81, 0x8a, 0x94, 0x9b, 0x9f, 0x9f, 0x9c, 0x95, 0x8e, 0x85, 0x7c,
-  0x76, 0x70, 0x6e, 0x6e, 0x6f, 0x6f, 0x70, 0x71, 0x74, 0x79, 0x80, 0x86,
-  0x8a, 0x8b, 0x88, 0x84, 0x7f, 0x7e, 0x7e, 0x81, 0x83, 0x84, 0x83, 0x83,
-  0x82, 0x84, 0x86, 0x87, 0x88, 0x87, 0x84, 0x80, 0x7d, 0x7a, 0x78, 0x77,
-  0x76, 0x75, 0x74, 0x73, 0x72, 0x74, 0x78, 0x7c, 0x83, 0x8a, 0x8e, 0x8f,
-  0x8b, 0x84, 0x7a, 0x71, 0x6e, 0x70, 0x75, 0x7a, 0x80, 0x83, 0x84, 0x86,
-  0x88, 0x8b, 0x8e, 0x8f, 0x8e, 0x8d, 0x8a, 0x86, 0x83, 0x80, 0x7b, 0x75,
-  0x6e, 0x6c, 0x6c, 0x70, 0x75, 0x7a, 0x7f, 0x84, 0x87, 0x89, 0x8b, 0x8b,
-  0x89, 0x87, 0x86, 0x84, 0x84, 0x84, 0x85, 0x84, 0x81, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x76, 0x76, 0x78, 0x7a, 0x7b, 0x7a, 0x79,
-  0x7b, 0x80, 0x87, 0x90, 0x97, 0x9d, 0x9e, 0x9b, 0x94, 0x8a, 0x7e, 0x75,
-  0x6f, 0x6d, 0x6e, 0x70, 0x72, 0x75, 0x78, 0x7c, 0x82, 0x87, 0x8d, 0x91,
-  0x93, 0x92, 0x92, 0x90, 0x8d, 0x89, 0x85, 0x80, 0x7b, 0x76, 0x72, 0x72,
-  0x74, 0x75, 0x78, 0x7b, 0x7f, 0x83, 0x86, 0x8a, 0x8c, 0x8c, 0x8a, 0x87,
-  0x85, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7e, 0x7f, 0x81, 0x83, 0x83,
-  0x84, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7b, 0x7a, 0x7b, 0x7d, 0x80,
-  0x85, 0x89, 0x8b, 0x8a, 0x85, 0x7d, 0x73, 0x6c, 0x6b, 0x6f, 0x76, 0x7e,
-  0x84, 0x85, 0x84, 0x83, 0x82, 0x83, 0x87, 0x8a, 0x8b, 0x8c, 0x8b, 0x88,
-  0x84, 0x80, 0x7d, 0x79, 0x76, 0x72, 0x70, 0x71, 0x74, 0x77, 0x7c, 0x80,
-  0x83, 0x86, 0x86, 0x88, 0x88, 0x87, 0x86, 0x86, 0x86, 0x85, 0x83, 0x80,
-  0x7d, 0x7a, 0x78, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78, 0x79, 0x78, 0x79,
-  0x7b, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x82, 0x86, 0x8c, 0x90, 0x91,
-  0x8f, 0x8b, 0x84, 0x7e, 0x78, 0x73, 0x70, 0x70, 0x70, 0x71, 0x73, 0x76,
-  0x78, 0x7d, 0x82, 0x85, 0x88, 0x8a, 0x8c, 0x8d, 0x8c, 0x8a, 0x87, 0x83,
-  0x7e, 0x7a, 0x76, 0x73, 0x72, 0x70, 0x70, 0x71, 0x72, 0x73, 0x76, 0x7b,
-  0x80, 0x84, 0x86, 0x88, 0x88, 0x87, 0x85, 0x84, 0x84, 0x83, 0x82, 0x80,
-  0x7d, 0x7a, 0x78, 0x78, 0x79, 0x7a, 0x7c, 0x7e, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x7f, 0x7d, 0x7b, 0x79, 0x77, 0x76, 0x76, 0x77, 0x7b, 0x82, 0x88,
-  0x8d, 0x90, 0x90, 0x8c, 0x85, 0x7e, 0x7a, 0x79, 0x7b, 0x7f, 0x83, 0x85,
-  0x84, 0x80, 0x7d, 0x7c, 0x7c, 0x7e, 0x81, 0x84, 0x87, 0x88, 0x88, 0x87,
-  0x86, 0x84, 0x82, 0x80, 0x7d, 0x7a, 0x79, 0x79, 0x7b, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7e, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x84, 0x8a, 0x8e, 0x8f, 0x89, 0x7d, 0x70,
-  0x66, 0x62, 0x66, 0x70, 0x7b, 0x84, 0x89, 0x88, 0x86, 0x84, 0x84, 0x88,
-  0x8f, 0x96, 0x9a, 0x9b, 0x97, 0x90, 0x86, 0x7d, 0x75, 0x6f, 0x6b, 0x69,
-  0x6a, 0x6c, 0x70, 0x74, 0x78, 0x7c, 0x7f, 0x83, 0x87, 0x8b, 0x8f, 0x90,
-  0x8f, 0x8d, 0x8a, 0x89, 0x88, 0x87, 0x84, 0x7e, 0x76, 0x6e, 0x69, 0x69,
-  0x6d, 0x72, 0x77, 0x7a, 0x7c, 0x7c, 0x7e, 0x82, 0x86, 0x8a, 0x8e, 0x8f,
-  0x8e, 0x8d, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x88, 0x85, 0x81, 0x7b, 0x74,
-  0x6c, 0x66, 0x64, 0x66, 0x6b, 0x74, 0x7c, 0x83, 0x87, 0x88, 0x89, 0x8a,
-  0x8d, 0x90, 0x93, 0x96, 0x96, 0x91, 0x8a, 0x82, 0x7a, 0x74, 0x72, 0x72,
-  0x70, 0x70, 0x70, 0x70, 0x70, 0x72, 0x76, 0x7c, 0x82, 0x88, 0x8c, 0x8d,
-  0x8e, 0x8e, 0x8c, 0x89, 0x87, 0x85, 0x83, 0x82, 0x80, 0x7d, 0x7b, 0x7a,
-  0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84,
-  0x82, 0x82, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x84, 0x86, 0x8a, 0x8c,
-  0x8c, 0x8a, 0x84, 0x7c, 0x74, 0x6d, 0x6c, 0x6f, 0x74, 0x7a, 0x80, 0x84,
-  0x84, 0x84, 0x84, 0x85, 0x87, 0x8b, 0x8f, 0x91, 0x92, 0x90, 0x8e, 0x89,
-  0x83, 0x7c, 0x75, 0x70, 0x6d, 0x6d, 0x6f, 0x72, 0x76, 0x78, 0x7a, 0x7a,
-  0x7b, 0x7e, 0x83, 0x89, 0x8f, 0x95, 0x98, 0x98, 0x95, 0x91, 0x8c, 0x86,
-  0x80, 0x7b, 0x77, 0x73, 0x6f, 0x6b, 0x69, 0x6a, 0x6e, 0x72, 0x76, 0x7a,
-  0x80, 0x85, 0x8a, 0x8d, 0x92, 0x96, 0x98, 0x9a, 0x9b, 0x9c, 0x9a, 0x96,
-  0x90, 0x87, 0x7b, 0x71, 0x68, 0x60, 0x5d, 0x5c, 0x5d, 0x63, 0x6c, 0x74,
-  0x7c, 0x85, 0x8d, 0x93, 0x97, 0x9c, 0x9f, 0xa0, 0xa0, 0x9e, 0x97, 0x8e,
-  0x86, 0x7d, 0x75, 0x6e, 0x69, 0x66, 0x65, 0x66, 0x67, 0x6b, 0x6f, 0x75,
-  0x79, 0x7d, 0x82, 0x87, 0x8b, 0x8f, 0x92, 0x92, 0x91, 0x8e, 0x8a, 0x87,
-  0x85, 0x83, 0x81, 0x7f, 0x7d, 0x7a, 0x79, 0x78, 0x78, 0x77, 0x77, 0x77,
-  0x77, 0x77, 0x77, 0x77, 0x79, 0x7b, 0x7e, 0x80, 0x82, 0x83, 0x85, 0x88,
-  0x8d, 0x91, 0x94, 0x94, 0x92, 0x8a, 0x7e, 0x72, 0x68, 0x64, 0x66, 0x6c,
-  0x74, 0x7a, 0x7d, 0x7d, 0x7b, 0x79, 0x7a, 0x7f, 0x86, 0x90, 0x97, 0x9a,
-  0x9a, 0x94, 0x8b, 0x82, 0x79, 0x72, 0x70, 0x70, 0x71, 0x73, 0x75, 0x75,
-  0x74, 0x72, 0x6f, 0x70, 0x75, 0x7d, 0x88, 0x92, 0x97, 0x97, 0x94, 0x8f,
-  0x8a, 0x87, 0x86, 0x84, 0x81, 0x7e, 0x78, 0x71, 0x6a, 0x65, 0x63, 0x65,
-  0x69, 0x6f, 0x75, 0x7b, 0x80, 0x82, 0x85, 0x89, 0x8e, 0x95, 0x9c, 0xa1,
-  0xa2, 0xa0, 0x99, 0x90, 0x85, 0x7a, 0x6e, 0x63, 0x5a, 0x54, 0x52, 0x54,
-  0x5a, 0x65, 0x70, 0x7c, 0x87, 0x8f, 0x95, 0x9b, 0xa0, 0xa3, 0xa4, 0xa4,
-  0xa1, 0x99, 0x8f, 0x84, 0x79, 0x70, 0x69, 0x64, 0x61, 0x60, 0x60, 0x62,
-  0x66, 0x6b, 0x72, 0x79, 0x80, 0x87, 0x8d, 0x90, 0x91, 0x90, 0x91, 0x8f,
-  0x8e, 0x8d, 0x8c, 0x88, 0x84, 0x80, 0x7b, 0x79, 0x77, 0x76, 0x76, 0x75,
-  0x75, 0x75, 0x76, 0x76, 0x78, 0x79, 0x7a, 0x7c, 0x7e, 0x7f, 0x82, 0x83,
-  0x84, 0x84, 0x85, 0x86, 0x8a, 0x8e, 0x90, 0x91, 0x8e, 0x86, 0x7a, 0x6e,
-  0x64, 0x61, 0x64, 0x6b, 0x76, 0x80, 0x88, 0x8b, 0x8b, 0x88, 0x87, 0x88,
-  0x8d, 0x95, 0x9c, 0xa0, 0x9f, 0x99, 0x8e, 0x80, 0x75, 0x6d, 0x69, 0x68,
-  0x6b, 0x6e, 0x72, 0x75, 0x76, 0x77, 0x77, 0x78, 0x7b, 0x81, 0x88, 0x90,
-  0x96, 0x97, 0x95, 0x90, 0x8d, 0x8a, 0x88, 0x88, 0x87, 0x84, 0x7f, 0x78,
-  0x71, 0x6d, 0x6a, 0x68, 0x68, 0x68, 0x6b, 0x6f, 0x74, 0x7a, 0x7f, 0x85,
-  0x8a, 0x8f, 0x95, 0x9a, 0x9f, 0xa2, 0xa2, 0x9e, 0x97, 0x8e, 0x82, 0x76,
-  0x6b, 0x5f, 0x56, 0x53, 0x54, 0x5c, 0x68, 0x77, 0x84, 0x8e, 0x95, 0x99,
-  0x9c, 0x9f, 0xa2, 0xa3, 0xa4, 0xa2, 0x9c, 0x94, 0x89, 0x7e, 0x72, 0x67,
-  0x61, 0x5e, 0x5f, 0x63, 0x68, 0x6d, 0x72, 0x77, 0x7c, 0x82, 0x88, 0x8e,
-  0x92, 0x92, 0x90, 0x8b, 0x85, 0x81, 0x7f, 0x80, 0x82, 0x84, 0x86, 0x86,
-  0x86, 0x84, 0x82, 0x81, 0x7f, 0x7d, 0x7d, 0x7d, 0x7c, 0x78, 0x76, 0x72,
-  0x70, 0x6f, 0x70, 0x73, 0x78, 0x7d, 0x81, 0x86, 0x89, 0x8c, 0x8d, 0x8f,
-  0x92, 0x96, 0x99, 0x9a, 0x98, 0x8f, 0x7f, 0x6b, 0x58, 0x4b, 0x47, 0x4b,
-  0x58, 0x68, 0x78, 0x85, 0x8b, 0x8d, 0x8b, 0x8c, 0x90, 0x97, 0xa3, 0xae,
-  0xb2, 0xaf, 0xa4, 0x91, 0x7e, 0x6e, 0x61, 0x5a, 0x59, 0x5c, 0x64, 0x6b,
-  0x71, 0x74, 0x73, 0x70, 0x6f, 0x73, 0x7c, 0x8a, 0x97, 0x9f, 0xa0, 0x9a,
-  0x92, 0x8a, 0x86, 0x87, 0x89, 0x88, 0x85, 0x7e, 0x77, 0x71, 0x6d, 0x6c,
-  0x6d, 0x6e, 0x70, 0x72, 0x72, 0x72, 0x72, 0x72, 0x75, 0x78, 0x7f, 0x86,
-  0x8d, 0x94, 0x97, 0x98, 0x96, 0x93, 0x92, 0x94, 0x97, 0x9a, 0x98, 0x8f,
-  0x7c, 0x65, 0x52, 0x44, 0x40, 0x46, 0x53, 0x63, 0x75, 0x83, 0x8c, 0x91,
-  0x95, 0x99, 0xa0, 0xaa, 0xb3, 0xb9, 0xba, 0xb4, 0xa8, 0x98, 0x85, 0x73,
-  0x64, 0x59, 0x52, 0x4f, 0x52, 0x56, 0x5b, 0x61, 0x68, 0x6f, 0x78, 0x80,
-  0x87, 0x8d, 0x91, 0x95, 0x97, 0x95, 0x92, 0x8f, 0x8e, 0x8e, 0x8d, 0x8c,
-  0x8a, 0x85, 0x7e, 0x79, 0x76, 0x75, 0x75, 0x78, 0x79, 0x77, 0x73, 0x6d,
-  0x66, 0x60, 0x5f, 0x64, 0x6e, 0x79, 0x84, 0x8c, 0x90, 0x91, 0x90, 0x91,
-  0x93, 0x97, 0x9c, 0xa0, 0xa3, 0xa4, 0xa1, 0x98, 0x8b, 0x7a, 0x67, 0x56,
-  0x49, 0x43, 0x45, 0x4e, 0x5c, 0x6a, 0x77, 0x82, 0x87, 0x8b, 0x90, 0x97,
-  0xa1, 0xac, 0xb6, 0xbc, 0xbc, 0xb2, 0xa0, 0x8a, 0x75, 0x64, 0x5a, 0x58,
-  0x5a, 0x5d, 0x60, 0x63, 0x62, 0x61, 0x62, 0x65, 0x6b, 0x77, 0x85, 0x90,
-  0x98, 0x9a, 0x98, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x8f, 0x89, 0x81,
-  0x79, 0x72, 0x6d, 0x6b, 0x6b, 0x6a, 0x6a, 0x6b, 0x6b, 0x6b, 0x6d, 0x70,
-  0x76, 0x7d, 0x85, 0x8c, 0x91, 0x92, 0x92, 0x91, 0x92, 0x94, 0x94, 0x95,
-  0x97, 0x98, 0x9a, 0x96, 0x88, 0x71, 0x56, 0x3f, 0x31, 0x2f, 0x3b, 0x50,
-  0x69, 0x80, 0x8b, 0x8b, 0x87, 0x8d, 0x9f, 0xb9, 0xd1, 0xdf, 0xe2, 0xda,
-  0xcb, 0xb6, 0xa0, 0x8c, 0x78, 0x66, 0x55, 0x48, 0x42, 0x42, 0x47, 0x4d,
-  0x50, 0x52, 0x52, 0x58, 0x67, 0x7d, 0x93, 0xa2, 0xa8, 0xa6, 0xa0, 0x9a,
-  0x9a, 0x9d, 0xa2, 0xa4, 0xa2, 0x9a, 0x8c, 0x80, 0x77, 0x71, 0x6b, 0x67,
-  0x63, 0x61, 0x62, 0x66, 0x69, 0x6a, 0x6a, 0x6c, 0x72, 0x7b, 0x84, 0x8c,
-  0x91, 0x91, 0x8a, 0x83, 0x7d, 0x7b, 0x7f, 0x86, 0x8b, 0x8c, 0x8c, 0x8c,
-  0x90, 0x95, 0x99, 0x98, 0x90, 0x82, 0x71, 0x61, 0x59, 0x59, 0x60, 0x6b,
-  0x74, 0x7b, 0x81, 0x85, 0x89, 0x8d, 0x91, 0x98, 0xa3, 0xb0, 0xb9, 0xbe,
-  0xbb, 0xb1, 0xa0, 0x8c, 0x78, 0x6a, 0x62, 0x60, 0x62, 0x62, 0x60, 0x5c,
-  0x5b, 0x5d, 0x62, 0x68, 0x70, 0x78, 0x82, 0x8b, 0x90, 0x93, 0x96, 0x97,
-  0x97, 0x96, 0x95, 0x96, 0x99, 0x9a, 0x97, 0x8f, 0x85, 0x7a, 0x74, 0x70,
-  0x6c, 0x6a, 0x69, 0x68, 0x66, 0x64, 0x66, 0x6c, 0x74, 0x7b, 0x81, 0x85,
-  0x87, 0x89, 0x8b, 0x8b, 0x8c, 0x8e, 0x91, 0x95, 0x98, 0x9b, 0x9c, 0x96,
-  0x87, 0x6e, 0x52, 0x3c, 0x30, 0x32, 0x3f, 0x53, 0x68, 0x77, 0x7a, 0x76,
-  0x75, 0x82, 0x9c, 0xbb, 0xd2, 0xdc, 0xde, 0xd6, 0xc8, 0xb9, 0xaa, 0x98,
-  0x84, 0x6d, 0x57, 0x47, 0x40, 0x43, 0x4a, 0x4d, 0x4a, 0x45, 0x43, 0x4a,
-  0x5c, 0x76, 0x90, 0xa2, 0xa9, 0xa6, 0x9f, 0x9e, 0xa5, 0xad, 0xb3, 0xb1,
-  0xa9, 0x9b, 0x8d, 0x82, 0x79, 0x71, 0x67, 0x5d, 0x55, 0x51, 0x54, 0x5a,
-  0x62, 0x68, 0x6a, 0x6d, 0x73, 0x7e, 0x8b, 0x98, 0xa1, 0xa2, 0x9d, 0x94,
-  0x8e, 0x8b, 0x8c, 0x8d, 0x8a, 0x85, 0x80, 0x7c, 0x7c, 0x7c, 0x77, 0x6d,
-  0x5e, 0x4e, 0x44, 0x47, 0x55, 0x68, 0x7b, 0x8a, 0x94, 0x98, 0x9a, 0x9e,
-  0xa5, 0xae, 0xb9, 0xc0, 0xc3, 0xc2, 0xbe, 0xb4, 0xa3, 0x8d, 0x77, 0x66,
-  0x5a, 0x54, 0x53, 0x56, 0x57, 0x57, 0x55, 0x54, 0x58, 0x61, 0x6c, 0x76,
-  0x81, 0x8a, 0x92, 0x98, 0x9c, 0x9e, 0x9d, 0x9b, 0x97, 0x92, 0x8f, 0x8e,
-  0x8e, 0x8c, 0x85, 0x7c, 0x73, 0x6b, 0x66, 0x65, 0x66, 0x68, 0x6a, 0x6b,
-  0x6d, 0x70, 0x76, 0x7b, 0x80, 0x84, 0x87, 0x89, 0x89, 0x88, 0x87, 0x86,
-  0x85, 0x82, 0x82, 0x84, 0x88, 0x8d, 0x92, 0x94, 0x90, 0x82, 0x6d, 0x59,
-  0x4b, 0x49, 0x53, 0x64, 0x76, 0x82, 0x86, 0x84, 0x80, 0x82, 0x8e, 0xa0,
-  0xb3, 0xc2, 0xc8, 0xc6, 0xbc, 0xaf, 0xa1, 0x93, 0x84, 0x74, 0x64, 0x57,
-  0x51, 0x51, 0x54, 0x59, 0x5a, 0x57, 0x54, 0x56, 0x60, 0x71, 0x85, 0x96,
-  0xa3, 0xa6, 0xa1, 0x9b, 0x9a, 0x9c, 0xa0, 0xa2, 0xa0, 0x99, 0x8f, 0x84,
-  0x78, 0x70, 0x67, 0x5d, 0x55, 0x53, 0x57, 0x5d, 0x64, 0x6a, 0x6e, 0x70,
-  0x72, 0x78, 0x82, 0x8e, 0x96, 0x99, 0x9a, 0x98, 0x98, 0x9a, 0x9d, 0x9f,
-  0x9f, 0x99, 0x8e, 0x7f, 0x6a, 0x53, 0x40, 0x33, 0x2f, 0x35, 0x44, 0x57,
-  0x67, 0x6e, 0x6e, 0x6e, 0x7a, 0x93, 0xb2, 0xcd, 0xe0, 0xe7, 0xe3, 0xdb,
-  0xd3, 0xc9, 0xbc, 0xa8, 0x8d, 0x6f, 0x58, 0x4e, 0x4f, 0x52, 0x50, 0x47,
-  0x39, 0x30, 0x34, 0x46, 0x62, 0x7c, 0x8d, 0x92, 0x8f, 0x8c, 0x90, 0x9d,
-  0xac, 0xb6, 0xb8, 0xb2, 0xaa, 0xa2, 0x9c, 0x97, 0x8f, 0x81, 0x6d, 0x5b,
-  0x51, 0x4f, 0x54, 0x5a, 0x5e, 0x5c, 0x57, 0x59, 0x64, 0x74, 0x84, 0x90,
-  0x96, 0x94, 0x91, 0x8e, 0x91, 0x96, 0x9a, 0x97, 0x90, 0x8b, 0x89, 0x88,
-  0x89, 0x86, 0x79, 0x63, 0x4e, 0x41, 0x3e, 0x48, 0x5b, 0x70, 0x83, 0x8c,
-  0x8c, 0x8b, 0x8f, 0x98, 0xa5, 0xb5, 0xc2, 0xca, 0xcc, 0xc9, 0xc2, 0xb4,
-  0xa0, 0x8a, 0x75, 0x64, 0x5a, 0x58, 0x59, 0x5a, 0x5a, 0x57, 0x54, 0x53,
-  0x56, 0x5e, 0x6a, 0x74, 0x7f, 0x8a, 0x92, 0x97, 0x99, 0x97, 0x94, 0x90,
-  0x8f, 0x92, 0x95, 0x97, 0x98, 0x94, 0x8b, 0x7f, 0x74, 0x6b, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x67, 0x6a, 0x6f, 0x75, 0x7a, 0x7e, 0x82, 0x85, 0x86,
-  0x88, 0x89, 0x89, 0x89, 0x88, 0x86, 0x83, 0x82, 0x84, 0x89, 0x92, 0x99,
-  0x98, 0x89, 0x6f, 0x53, 0x3d, 0x33, 0x37, 0x48, 0x60, 0x74, 0x7f, 0x80,
-  0x7b, 0x7d, 0x8d, 0xa8, 0xc6, 0xdc, 0xe6, 0xe6, 0xdf, 0xd4, 0xc7, 0xba,
-  0xa9, 0x90, 0x73, 0x58, 0x42, 0x39, 0x3a, 0x41, 0x45, 0x42, 0x3b, 0x35,
-  0x38, 0x4a, 0x65, 0x83, 0x9a, 0xa7, 0xaa, 0xaa, 0xaa, 0xab, 0xb0, 0xb4,
-  0xb2, 0xaa, 0xa0, 0x97, 0x8e, 0x83, 0x76, 0x65, 0x53, 0x44, 0x3c, 0x3e,
-  0x48, 0x55, 0x60, 0x66, 0x67, 0x6a, 0x70, 0x7a, 0x88, 0x97, 0xa1, 0xa5,
-  0xa2, 0xa1, 0xa0, 0xa2, 0xa5, 0xa6, 0xa2, 0x96, 0x82, 0x68, 0x50, 0x3b,
-  0x2e, 0x2d, 0x36, 0x46, 0x57, 0x62, 0x66, 0x66, 0x69, 0x77, 0x92, 0xb0,
-  0xca, 0xdb, 0xe2, 0xe2, 0xde, 0xda, 0xd6, 0xc9, 0xb1, 0x91, 0x74, 0x61,
-  0x5b, 0x5e, 0x62, 0x5e, 0x50, 0x3c, 0x30, 0x32, 0x43, 0x5b, 0x73, 0x85,
-  0x8c, 0x8b, 0x88, 0x8a, 0x90, 0x97, 0x9c, 0x9e, 0x9e, 0xa2, 0xa7, 0xae,
-  0xb1, 0xad, 0x9e, 0x8a, 0x77, 0x69, 0x62, 0x63, 0x65, 0x64, 0x60, 0x5b,
-  0x58, 0x5b, 0x63, 0x6e, 0x78, 0x7e, 0x82, 0x85, 0x8b, 0x92, 0x98, 0x99,
-  0x95, 0x8d, 0x87, 0x87, 0x8e, 0x95, 0x96, 0x8a, 0x71, 0x55, 0x3e, 0x32,
-  0x33, 0x3f, 0x51, 0x64, 0x76, 0x82, 0x89, 0x91, 0x9c, 0xaa, 0xba, 0xc9,
-  0xd6, 0xde, 0xde, 0xd9, 0xce, 0xba, 0xa1, 0x87, 0x70, 0x5c, 0x50, 0x4b,
-  0x4a, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x50, 0x59, 0x67, 0x77, 0x87, 0x95,
-  0x9e, 0xa3, 0xa2, 0x9d, 0x99, 0x98, 0x9a, 0x9e, 0xa1, 0xa1, 0x9b, 0x91,
-  0x84, 0x76, 0x69, 0x5e, 0x57, 0x55, 0x56, 0x58, 0x5c, 0x61, 0x66, 0x6b,
-  0x71, 0x77, 0x7e, 0x86, 0x8c, 0x93, 0x97, 0x98, 0x9a, 0x99, 0x95, 0x91,
-  0x8b, 0x86, 0x85, 0x83, 0x81, 0x7d, 0x71, 0x5f, 0x4c, 0x3c, 0x36, 0x3a,
-  0x48, 0x5b, 0x6e, 0x7e, 0x86, 0x89, 0x8e, 0x9b, 0xad, 0xc3, 0xd4, 0xde,
-  0xe0, 0xdb, 0xd1, 0xc5, 0xb6, 0xa7, 0x93, 0x7b, 0x62, 0x50, 0x45, 0x44,
-  0x48, 0x4b, 0x49, 0x44, 0x41, 0x42, 0x4d, 0x5f, 0x75, 0x89, 0x98, 0x9d,
-  0x9c, 0x9b, 0x9c, 0xa1, 0xa6, 0xa9, 0xaa, 0xa8, 0xa4, 0xa0, 0x9b, 0x93,
-  0x85, 0x73, 0x62, 0x56, 0x4f, 0x51, 0x58, 0x60, 0x65, 0x68, 0x6a, 0x6d,
-  0x72, 0x7a, 0x83, 0x8c, 0x92, 0x96, 0x9a, 0x9d, 0xa0, 0xa2, 0xa0, 0x9e,
-  0x98, 0x92, 0x8a, 0x7d, 0x6c, 0x5a, 0x4b, 0x40, 0x3d, 0x43, 0x4e, 0x5a,
-  0x65, 0x6d, 0x75, 0x7e, 0x8d, 0xa0, 0xb5, 0xc7, 0xd4, 0xda, 0xda, 0xd5,
-  0xd0, 0xc8, 0xba, 0xa7, 0x90, 0x79, 0x65, 0x58, 0x54, 0x54, 0x52, 0x4c,
-  0x46, 0x42, 0x43, 0x4b, 0x59, 0x69, 0x77, 0x83, 0x88, 0x8b, 0x8d, 0x90,
-  0x94, 0x98, 0x9a, 0x9b, 0x9c, 0x9e, 0xa2, 0xa4, 0xa1, 0x98, 0x8c, 0x7c,
-  0x6e, 0x64, 0x5f, 0x5e, 0x5e, 0x60, 0x62, 0x63, 0x67, 0x6e, 0x74, 0x7a,
-  0x7f, 0x82, 0x87, 0x8c, 0x90, 0x96, 0x9a, 0x9c, 0x9a, 0x96, 0x90, 0x8c,
-  0x89, 0x84, 0x7c, 0x70, 0x5e, 0x4c, 0x3f, 0x3a, 0x3d, 0x47, 0x55, 0x63,
-  0x70, 0x7c, 0x87, 0x94, 0xa4, 0xb6, 0xc6, 0xd2, 0xd8, 0xda, 0xd6, 0xce,
-  0xc2, 0xb4, 0xa1, 0x8b, 0x73, 0x5d, 0x4d, 0x46, 0x44, 0x45, 0x46, 0x45,
-  0x44, 0x46, 0x4c, 0x58, 0x66, 0x73, 0x80, 0x89, 0x8e, 0x92, 0x97, 0x9d,
-  0xa2, 0xa5, 0xa7, 0xa7, 0xa4, 0xa0, 0x9a, 0x92, 0x86, 0x78, 0x6a, 0x5c,
-  0x52, 0x4d, 0x4f, 0x54, 0x59, 0x5e, 0x62, 0x63, 0x66, 0x6b, 0x73, 0x7e,
-  0x8a, 0x92, 0x9a, 0x9e, 0x9f, 0x9e, 0x9a, 0x93, 0x8d, 0x8a, 0x88, 0x85,
-  0x7e, 0x72, 0x60, 0x4c, 0x3d, 0x36, 0x3a, 0x48, 0x5b, 0x6e, 0x7f, 0x88,
-  0x8c, 0x90, 0x98, 0xa5, 0xb5, 0xc6, 0xd0, 0xd3, 0xcf, 0xc7, 0xbc, 0xb0,
-  0xa1, 0x8e, 0x7a, 0x67, 0x57, 0x50, 0x50, 0x56, 0x5c, 0x5e, 0x5b, 0x54,
-  0x4d, 0x4e, 0x59, 0x68, 0x79, 0x86, 0x8e, 0x8e, 0x8c, 0x88, 0x86, 0x89,
-  0x8d, 0x92, 0x96, 0x9a, 0x9d, 0x9f, 0xa0, 0x9d, 0x94, 0x86, 0x77, 0x6b,
-  0x62, 0x61, 0x64, 0x69, 0x6d, 0x6e, 0x6d, 0x6d, 0x6e, 0x71, 0x77, 0x7c,
-  0x81, 0x85, 0x8a, 0x8d, 0x91, 0x95, 0x97, 0x97, 0x96, 0x95, 0x93, 0x8f,
-  0x86, 0x77, 0x64, 0x51, 0x42, 0x3a, 0x3e, 0x48, 0x58, 0x68, 0x76, 0x82,
-  0x8d, 0x99, 0xa9, 0xba, 0xca, 0xd4, 0xda, 0xdb, 0xd8, 0xd0, 0xc4, 0xb3,
-  0x9f, 0x88, 0x70, 0x5c, 0x4e, 0x49, 0x4a, 0x4f, 0x53, 0x54, 0x55, 0x56,
-  0x59, 0x60, 0x6a, 0x76, 0x81, 0x8a, 0x90, 0x95, 0x98, 0x9b, 0x9e, 0x9f,
-  0xa0, 0xa0, 0x9f, 0x9e, 0x9d, 0x99, 0x91, 0x86, 0x79, 0x6c, 0x60, 0x58,
-  0x57, 0x5a, 0x5e, 0x64, 0x6a, 0x6f, 0x72, 0x74, 0x77, 0x7b, 0x7f, 0x85,
-  0x8b, 0x91, 0x97, 0x9c, 0x9f, 0x9e, 0x99, 0x92, 0x8b, 0x85, 0x7d, 0x76,
-  0x6c, 0x5e, 0x51, 0x47, 0x43, 0x47, 0x52, 0x60, 0x6d, 0x77, 0x7f, 0x88,
-  0x92, 0xa1, 0xb1, 0xc0, 0xca, 0xcf, 0xce, 0xc9, 0xc0, 0xb6, 0xab, 0x9e,
-  0x8e, 0x7b, 0x6b, 0x5f, 0x59, 0x59, 0x5a, 0x5b, 0x59, 0x55, 0x52, 0x54,
-  0x5c, 0x66, 0x70, 0x77, 0x7a, 0x78, 0x77, 0x79, 0x7e, 0x86, 0x8f, 0x96,
-  0x9c, 0xa2, 0xa5, 0xa6, 0xa6, 0xa2, 0x97, 0x88, 0x7a, 0x6d, 0x64, 0x61,
-  0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x6b, 0x71, 0x77, 0x7d, 0x82, 0x87,
-  0x8c, 0x91, 0x96, 0x9c, 0xa0, 0xa1, 0xa0, 0x9a, 0x8d, 0x79, 0x61, 0x4c,
-  0x3d, 0x35, 0x36, 0x3f, 0x4c, 0x5a, 0x69, 0x76, 0x84, 0x94, 0xa4, 0xb4,
-  0xc3, 0xce, 0xd6, 0xda, 0xda, 0xd5, 0xca, 0xb7, 0x9f, 0x86, 0x6f, 0x5b,
-  0x4f, 0x4c, 0x4e, 0x52, 0x58, 0x5b, 0x5c, 0x5c, 0x5f, 0x64, 0x6a, 0x72,
-  0x78, 0x7c, 0x7d, 0x80, 0x82, 0x86, 0x8a, 0x8d, 0x91, 0x96, 0x9c, 0xa3,
-  0xa7, 0xa7, 0xa4, 0x9b, 0x8e, 0x80, 0x73, 0x6a, 0x64, 0x62, 0x60, 0x60,
-  0x63, 0x67, 0x6b, 0x6e, 0x71, 0x75, 0x79, 0x7f, 0x88, 0x8f, 0x96, 0x9b,
-  0x9e, 0x9e, 0x9c, 0x97, 0x90, 0x8a, 0x85, 0x7d, 0x70, 0x60, 0x51, 0x44,
-  0x3d, 0x3c, 0x44, 0x52, 0x60, 0x6f, 0x7c, 0x89, 0x98, 0xa9, 0xb8, 0xc4,
-  0xcc, 0xd0, 0xd1, 0xce, 0xc7, 0xbd, 0xb1, 0xa2, 0x90, 0x7d, 0x6c, 0x5e,
-  0x56, 0x54, 0x57, 0x5d, 0x60, 0x62, 0x61, 0x60, 0x5f, 0x61, 0x66, 0x6b,
-  0x6d, 0x6e, 0x71, 0x77, 0x80, 0x8b, 0x96, 0xa0, 0xa8, 0xac, 0xaf, 0xaf,
-  0xad, 0xa7, 0x9d, 0x90, 0x81, 0x72, 0x67, 0x60, 0x5c, 0x5c, 0x5d, 0x5f,
-  0x62, 0x65, 0x67, 0x6b, 0x71, 0x78, 0x7f, 0x85, 0x8a, 0x91, 0x99, 0x9f,
-  0xa5, 0xa9, 0xa7, 0x9e, 0x8b, 0x71, 0x58, 0x46, 0x3c, 0x3a, 0x42, 0x50,
-  0x5f, 0x6d, 0x79, 0x82, 0x8b, 0x95, 0xa2, 0xb0, 0xba, 0xc1, 0xc6, 0xc6,
-  0xc2, 0xba, 0xac, 0x99, 0x84, 0x70, 0x63, 0x5d, 0x5e, 0x64, 0x6c, 0x74,
-  0x76, 0x74, 0x6e, 0x66, 0x62, 0x61, 0x64, 0x69, 0x6e, 0x70, 0x72, 0x73,
-  0x75, 0x7a, 0x80, 0x86, 0x8c, 0x92, 0x98, 0x9e, 0xa2, 0xa2, 0x9e, 0x95,
-  0x87, 0x79, 0x6e, 0x69, 0x68, 0x6a, 0x6a, 0x69, 0x69, 0x6a, 0x6c, 0x70,
-  0x74, 0x79, 0x7e, 0x82, 0x86, 0x8a, 0x8e, 0x8f, 0x90, 0x8e, 0x89, 0x84,
-  0x83, 0x84, 0x85, 0x84, 0x7c, 0x6d, 0x5a, 0x47, 0x3b, 0x37, 0x3d, 0x4b,
-  0x5f, 0x77, 0x8c, 0x9c, 0xa6, 0xaf, 0xb7, 0xbf, 0xc5, 0xc8, 0xc8, 0xc4,
-  0xbe, 0xb4, 0xa8, 0x99, 0x86, 0x71, 0x5e, 0x50, 0x4a, 0x4d, 0x59, 0x64,
-  0x6e, 0x71, 0x6e, 0x67, 0x60, 0x5d, 0x5d, 0x60, 0x64, 0x68, 0x6f, 0x79,
-  0x85, 0x90, 0x9d, 0xa8, 0xad, 0xaf, 0xad, 0xaa, 0xa6, 0xa0, 0x97, 0x8c,
-  0x7f, 0x71, 0x65, 0x5d, 0x5a, 0x5d, 0x61, 0x66, 0x68, 0x68, 0x69, 0x6b,
-  0x70, 0x76, 0x7d, 0x84, 0x8a, 0x8e, 0x92, 0x95, 0x96, 0x96, 0x96, 0x96,
-  0x90, 0x86, 0x77, 0x65, 0x52, 0x44, 0x3b, 0x3d, 0x49, 0x5d, 0x74, 0x8a,
-  0x97, 0x9e, 0xa1, 0xa2, 0xa6, 0xb0, 0xba, 0xc2, 0xc5, 0xc1, 0xb7, 0xa8,
-  0x97, 0x88, 0x7b, 0x70, 0x68, 0x65, 0x66, 0x6b, 0x73, 0x79, 0x7b, 0x77,
-  0x6c, 0x5f, 0x56, 0x55, 0x5a, 0x65, 0x70, 0x78, 0x7c, 0x7d, 0x7e, 0x81,
-  0x87, 0x8f, 0x96, 0x9c, 0x9e, 0x9e, 0x9e, 0x9b, 0x96, 0x8e, 0x82, 0x75,
-  0x6c, 0x67, 0x67, 0x6b, 0x71, 0x76, 0x79, 0x77, 0x75, 0x76, 0x78, 0x7c,
-  0x80, 0x85, 0x86, 0x84, 0x81, 0x7e, 0x7b, 0x7a, 0x7d, 0x83, 0x8a, 0x8f,
-  0x8d, 0x82, 0x6d, 0x53, 0x3e, 0x31, 0x32, 0x3e, 0x59, 0x7c, 0x99, 0xae,
-  0xba, 0xbc, 0xba, 0xba, 0xbe, 0xc4, 0xca, 0xca, 0xc4, 0xb5, 0xa4, 0x93,
-  0x81, 0x70, 0x62, 0x55, 0x4e, 0x4f, 0x58, 0x66, 0x76, 0x7e, 0x7e, 0x73,
-  0x63, 0x56, 0x51, 0x54, 0x5d, 0x68, 0x74, 0x7f, 0x88, 0x91, 0x9a, 0xa3,
-  0xaa, 0xad, 0xab, 0xa4, 0x9c, 0x94, 0x8d, 0x86, 0x80, 0x77, 0x6e, 0x66,
-  0x60, 0x5f, 0x63, 0x68, 0x6d, 0x6f, 0x6f, 0x6e, 0x70, 0x75, 0x7c, 0x84,
-  0x8b, 0x8f, 0x90, 0x8e, 0x8b, 0x89, 0x89, 0x88, 0x89, 0x87, 0x81, 0x75,
-  0x67, 0x58, 0x49, 0x42, 0x44, 0x4e, 0x62, 0x7c, 0x97, 0xaa, 0xb5, 0xb6,
-  0xb1, 0xae, 0xb0, 0xb6, 0xbd, 0xc2, 0xc1, 0xb8, 0xa7, 0x94, 0x83, 0x76,
-  0x6c, 0x66, 0x64, 0x64, 0x67, 0x6d, 0x74, 0x79, 0x7a, 0x74, 0x69, 0x5e,
-  0x59, 0x5c, 0x66, 0x72, 0x7e, 0x87, 0x8b, 0x8b, 0x88, 0x88, 0x8b, 0x90,
-  0x96, 0x9a, 0x9c, 0x9b, 0x98, 0x94, 0x8d, 0x85, 0x7e, 0x78, 0x74, 0x70,
-  0x70, 0x74, 0x79, 0x7d, 0x7e, 0x7b, 0x77, 0x76, 0x77, 0x7c, 0x80, 0x84,
-  0x84, 0x81, 0x7b, 0x77, 0x76, 0x78, 0x80, 0x89, 0x92, 0x94, 0x89, 0x73,
-  0x58, 0x42, 0x35, 0x34, 0x40, 0x5b, 0x81, 0xa2, 0xba, 0xc9, 0xcb, 0xc1,
-  0xb6, 0xb1, 0xb5, 0xbf, 0xc7, 0xc7, 0xbc, 0xa6, 0x8d, 0x76, 0x64, 0x59,
-  0x54, 0x54, 0x58, 0x60, 0x6d, 0x7a, 0x81, 0x81, 0x77, 0x66, 0x54, 0x4a,
-  0x4c, 0x57, 0x67, 0x79, 0x87, 0x91, 0x97, 0x9b, 0x9f, 0xa3, 0xa6, 0xa6,
-  0xa1, 0x98, 0x8e, 0x85, 0x7e, 0x79, 0x74, 0x6f, 0x6c, 0x69, 0x67, 0x69,
-  0x6d, 0x71, 0x73, 0x72, 0x6f, 0x70, 0x75, 0x7e, 0x87, 0x8f, 0x94, 0x95,
-  0x93, 0x8e, 0x8b, 0x8b, 0x8a, 0x87, 0x80, 0x70, 0x5c, 0x4a, 0x3a, 0x32,
-  0x33, 0x40, 0x56, 0x73, 0x91, 0xa8, 0xb5, 0xb8, 0xb6, 0xb2, 0xb2, 0xb8,
-  0xbe, 0xc2, 0xc0, 0xb6, 0xa4, 0x8e, 0x7b, 0x6f, 0x69, 0x66, 0x67, 0x69,
-  0x6c, 0x70, 0x72, 0x70, 0x6c, 0x64, 0x5a, 0x52, 0x4e, 0x52, 0x5f, 0x6f,
-  0x7d, 0x87, 0x8c, 0x8d, 0x8c, 0x8c, 0x90, 0x98, 0x9f, 0xa2, 0x9e, 0x96,
-  0x8e, 0x87, 0x80, 0x79, 0x73, 0x70, 0x6e, 0x6b, 0x6a, 0x6c, 0x71, 0x74,
-  0x76, 0x75, 0x76, 0x7a, 0x80, 0x88, 0x8e, 0x91, 0x8e, 0x85, 0x7a, 0x70,
-  0x6b, 0x6e, 0x79, 0x84, 0x88, 0x83, 0x72, 0x5a, 0x43, 0x32, 0x2b, 0x32,
-  0x47, 0x68, 0x8f, 0xb0, 0xc7, 0xd2, 0xce, 0xbe, 0xac, 0xa4, 0xab, 0xb7,
-  0xc0, 0xc0, 0xb4, 0x9c, 0x80, 0x65, 0x53, 0x4f, 0x55, 0x5f, 0x6a, 0x72,
-  0x77, 0x77, 0x70, 0x65, 0x59, 0x53, 0x52, 0x54, 0x5c, 0x6a, 0x7a, 0x89,
-  0x94, 0x9a, 0x9c, 0x9c, 0x9e, 0x9f, 0x9c, 0x99, 0x95, 0x8b, 0x7e, 0x72,
-  0x6c, 0x6b, 0x6b, 0x6a, 0x6b, 0x6e, 0x6f, 0x6e, 0x6c, 0x6c, 0x6d, 0x6f,
-  0x6f, 0x72, 0x79, 0x81, 0x85, 0x88, 0x8d, 0x8f, 0x91, 0x93, 0x94, 0x97,
-  0x9b, 0x97, 0x83, 0x66, 0x4a, 0x32, 0x24, 0x22, 0x2f, 0x47, 0x65, 0x82,
-  0x96, 0xa1, 0xa7, 0xac, 0xb3, 0xbd, 0xc5, 0xc8, 0xc5, 0xba, 0xad, 0x9d,
-  0x8e, 0x81, 0x79, 0x72, 0x6b, 0x67, 0x6a, 0x71, 0x77, 0x7a, 0x78, 0x6d,
-  0x5b, 0x4a, 0x41, 0x44, 0x53, 0x68, 0x7d, 0x8b, 0x90, 0x8e, 0x8c, 0x8e,
-  0x97, 0xa0, 0xa5, 0xa5, 0xa1, 0x9c, 0x98, 0x96, 0x8f, 0x86, 0x7b, 0x70,
-  0x69, 0x67, 0x69, 0x6d, 0x6f, 0x6e, 0x6c, 0x6c, 0x70, 0x7a, 0x86, 0x90,
-  0x97, 0x98, 0x94, 0x8c, 0x88, 0x89, 0x8e, 0x94, 0x96, 0x89, 0x70, 0x52,
-  0x36, 0x25, 0x20, 0x26, 0x35, 0x4a, 0x64, 0x82, 0x9a, 0xaa, 0xb7, 0xc0,
-  0xc4, 0xc5, 0xc4, 0xc4, 0xc5, 0xc0, 0xb6, 0xa6, 0x92, 0x7d, 0x6f, 0x69,
-  0x67, 0x67, 0x66, 0x67, 0x69, 0x68, 0x66, 0x61, 0x58, 0x50, 0x4d, 0x52,
-  0x60, 0x72, 0x81, 0x8c, 0x95, 0x9d, 0xa6, 0xad, 0xb1, 0xb2, 0xad, 0xa2,
-  0x96, 0x89, 0x81, 0x7c, 0x78, 0x74, 0x6f, 0x68, 0x66, 0x67, 0x68, 0x68,
-  0x6a, 0x6e, 0x74, 0x7c, 0x87, 0x91, 0x99, 0x9e, 0x9c, 0x93, 0x84, 0x77,
-  0x6e, 0x6c, 0x70, 0x76, 0x7c, 0x87, 0x91, 0x96, 0x8e, 0x77, 0x5b, 0x40,
-  0x2c, 0x25, 0x2e, 0x46, 0x6e, 0x99, 0xb7, 0xc8, 0xc7, 0xb8, 0xa9, 0xa4,
-  0xae, 0xbe, 0xcc, 0xd1, 0xc6, 0xaa, 0x86, 0x67, 0x55, 0x4d, 0x52, 0x60,
-  0x70, 0x7c, 0x7f, 0x78, 0x6c, 0x5e, 0x57, 0x56, 0x5c, 0x68, 0x77, 0x85,
-  0x90, 0x97, 0x9b, 0x9e, 0xa3, 0xa9, 0xb0, 0xb3, 0xae, 0xa0, 0x8f, 0x7d,
-  0x6f, 0x66, 0x63, 0x65, 0x6a, 0x6d, 0x70, 0x72, 0x74, 0x74, 0x74, 0x73,
-  0x74, 0x78, 0x81, 0x8e, 0x9b, 0xa3, 0xa4, 0x9f, 0x97, 0x8d, 0x83, 0x7e,
-  0x7f, 0x85, 0x8e, 0x99, 0x9f, 0x98, 0x80, 0x5c, 0x3a, 0x24, 0x1b, 0x22,
-  0x3b, 0x64, 0x91, 0xb1, 0xbf, 0xb7, 0xa4, 0x9c, 0xa7, 0xbe, 0xd7, 0xe4,
-  0xdd, 0xc2, 0x9b, 0x77, 0x62, 0x5d, 0x63, 0x6b, 0x6d, 0x66, 0x5e, 0x5a,
-  0x5b, 0x61, 0x65, 0x62, 0x5a, 0x55, 0x59, 0x6a, 0x80, 0x96, 0xa6, 0xae,
-  0xb0, 0xb0, 0xb0, 0xaf, 0xac, 0xa6, 0x97, 0x82, 0x6b, 0x5c, 0x58, 0x5d,
-  0x66, 0x6b, 0x6b, 0x65, 0x60, 0x60, 0x68, 0x75, 0x83, 0x8e, 0x94, 0x97,
-  0x99, 0x9d, 0xa2, 0xa4, 0xa0, 0x96, 0x88, 0x7c, 0x77, 0x78, 0x80, 0x86,
-  0x7e, 0x67, 0x48, 0x2c, 0x1a, 0x17, 0x21, 0x34, 0x53, 0x79, 0x97, 0xab,
-  0xb4, 0xb7, 0xbc, 0xc2, 0xcb, 0xd2, 0xd5, 0xcf, 0xbe, 0xa5, 0x8a, 0x75,
-  0x66, 0x5c, 0x57, 0x52, 0x4e, 0x4d, 0x50, 0x55, 0x5b, 0x60, 0x61, 0x5e,
-  0x5e, 0x62, 0x6e, 0x81, 0x96, 0xa7, 0xb2, 0xb6, 0xb4, 0xb3, 0xb0, 0xa9,
-  0xa0, 0x93, 0x82, 0x6d, 0x5c, 0x54, 0x54, 0x5a, 0x60, 0x62, 0x63, 0x64,
-  0x6a, 0x73, 0x7f, 0x8b, 0x94, 0x9a, 0x9c, 0x9d, 0x9e, 0xa0, 0x9f, 0x9a,
-  0x8c, 0x76, 0x64, 0x5b, 0x57, 0x57, 0x5a, 0x61, 0x6a, 0x75, 0x82, 0x8f,
-  0x91, 0x82, 0x64, 0x46, 0x32, 0x2f, 0x41, 0x65, 0x92, 0xb8, 0xd2, 0xdc,
-  0xd5, 0xc2, 0xae, 0xa1, 0xa3, 0xad, 0xb3, 0xb0, 0xa0, 0x84, 0x64, 0x49,
-  0x38, 0x35, 0x40, 0x55, 0x6f, 0x88, 0x96, 0x96, 0x87, 0x72, 0x66, 0x67,
-  0x73, 0x87, 0x9d, 0xac, 0xb2, 0xaf, 0xa6, 0x9c, 0x96, 0x92, 0x8b, 0x81,
-  0x75, 0x67, 0x5c, 0x54, 0x52, 0x57, 0x5e, 0x68, 0x73, 0x7e, 0x88, 0x90,
-  0x95, 0x96, 0x93, 0x90, 0x8e, 0x8e, 0x92, 0x96, 0x97, 0x92, 0x86, 0x75,
-  0x67, 0x5f, 0x5f, 0x63, 0x6c, 0x7a, 0x8c, 0x9c, 0xa5, 0x9c, 0x7d, 0x52,
-  0x2e, 0x1b, 0x1c, 0x34, 0x5e, 0x8a, 0xb0, 0xd0, 0xd1, 0xb8, 0xa1, 0x9e,
-  0xb0, 0xcd, 0xe2, 0xdf, 0xc2, 0x93, 0x64, 0x44, 0x3b, 0x46, 0x59, 0x69,
-  0x6d, 0x64, 0x5d, 0x5e, 0x6c, 0x7f, 0x8b, 0x8b, 0x82, 0x77, 0x75, 0x82,
-  0x99, 0xae, 0xbb, 0xbe, 0xb8, 0xaf, 0xa0, 0x8e, 0x7b, 0x68, 0x56, 0x47,
-  0x42, 0x49, 0x59, 0x6c, 0x7b, 0x83, 0x84, 0x82, 0x81, 0x87, 0x93, 0x9c,
-  0x9f, 0x9b, 0x94, 0x8c, 0x87, 0x87, 0x88, 0x82, 0x76, 0x69, 0x5f, 0x63,
-  0x73, 0x86, 0x93, 0x8d, 0x6e, 0x44, 0x23, 0x15, 0x18, 0x2d, 0x51, 0x7b,
-  0x9f, 0xbb, 0xc6, 0xc1, 0xba, 0xb9, 0xc1, 0xce, 0xd6, 0xd4, 0xc0, 0x9f,
-  0x78, 0x58, 0x45, 0x3f, 0x45, 0x50, 0x57, 0x5a, 0x59, 0x5a, 0x5f, 0x69,
-  0x75, 0x7f, 0x86, 0x89, 0x8c, 0x91, 0x9c, 0xa9, 0xb2, 0xb7, 0xb7, 0xaf,
-  0xa1, 0x8e, 0x79, 0x64, 0x52, 0x44, 0x3b, 0x3a, 0x40, 0x4e, 0x5e, 0x6c,
-  0x77, 0x80, 0x87, 0x8e, 0x98, 0xa0, 0xa5, 0xa7, 0xa4, 0x9c, 0x91, 0x84,
-  0x76, 0x6a, 0x5e, 0x55, 0x50, 0x51, 0x56, 0x5c, 0x62, 0x67, 0x6c, 0x76,
-  0x88, 0xa0, 0xb6, 0xc3, 0xba, 0x99, 0x6c, 0x46, 0x30, 0x32, 0x4c, 0x71,
-  0x9b, 0xbd, 0xcb, 0xc2, 0xa8, 0x8c, 0x7b, 0x7f, 0x90, 0xa0, 0xa7, 0x9e,
-  0x82, 0x60, 0x44, 0x37, 0x40, 0x5a, 0x79, 0x97, 0xab, 0xae, 0x9e, 0x86,
-  0x72, 0x69, 0x6e, 0x79, 0x83, 0x8a, 0x8b, 0x85, 0x7e, 0x7c, 0x7e, 0x84,
-  0x8c, 0x8f, 0x8d, 0x84, 0x77, 0x6c, 0x65, 0x63, 0x66, 0x6e, 0x7b, 0x88,
-  0x91, 0x95, 0x95, 0x91, 0x8a, 0x82, 0x7c, 0x7b, 0x7e, 0x81, 0x83, 0x84,
-  0x82, 0x7e, 0x7a, 0x76, 0x74, 0x75, 0x79, 0x80, 0x87, 0x8f, 0x94, 0x93,
-  0x94, 0x97, 0x9b, 0x9a, 0x88, 0x64, 0x3a, 0x1c, 0x11, 0x1b, 0x3c, 0x6a,
-  0x94, 0xbd, 0xd4, 0xc8, 0xac, 0x9e, 0xa9, 0xc7, 0xe2, 0xe4, 0xc6, 0x92,
-  0x5f, 0x3c, 0x32, 0x42, 0x5d, 0x6e, 0x70, 0x64, 0x59, 0x5a, 0x6a, 0x7f,
-  0x8f, 0x93, 0x8d, 0x85, 0x82, 0x8b, 0x9c, 0xad, 0xb6, 0xb7, 0xaf, 0xa3,
-  0x97, 0x86, 0x72, 0x5d, 0x4b, 0x40, 0x41, 0x4c, 0x5c, 0x6d, 0x7b, 0x81,
-  0x83, 0x88, 0x93, 0x9f, 0xaa, 0xac, 0xa4, 0x96, 0x8c, 0x88, 0x89, 0x8c,
-  0x8a, 0x81, 0x71, 0x5f, 0x54, 0x50, 0x52, 0x58, 0x62, 0x6c, 0x7b, 0x8f,
-  0xa2, 0xa9, 0x9a, 0x74, 0x4d, 0x35, 0x30, 0x3f, 0x60, 0x89, 0xb1, 0xcd,
-  0xd8, 0xd0, 0xbe, 0xac, 0xa3, 0xa6, 0xac, 0xad, 0xa5, 0x94, 0x7b, 0x5e,
-  0x48, 0x3c, 0x3a, 0x45, 0x59, 0x72, 0x89, 0x9a, 0xa0, 0x9a, 0x8e, 0x86,
-  0x86, 0x8d, 0x96, 0x9c, 0x9c, 0x94, 0x85, 0x7b, 0x77, 0x79, 0x7d, 0x7e,
-  0x78, 0x6c, 0x62, 0x5b, 0x5b, 0x62, 0x6e, 0x7c, 0x88, 0x91, 0x96, 0x99,
-  0x98, 0x94, 0x8e, 0x89, 0x85, 0x83, 0x80, 0x7b, 0x77, 0x73, 0x6e, 0x6c,
-  0x6c, 0x6d, 0x71, 0x76, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x83, 0x8d, 0x9c,
-  0xac, 0xb7, 0xb3, 0x9c, 0x77, 0x55, 0x3c, 0x36, 0x42, 0x5c, 0x7d, 0x9c,
-  0xb0, 0xb1, 0xa2, 0x8f, 0x85, 0x8a, 0x98, 0xa8, 0xb2, 0xae, 0x9b, 0x7c,
-  0x5e, 0x4c, 0x4b, 0x5a, 0x70, 0x87, 0x94, 0x94, 0x86, 0x74, 0x69, 0x6a,
-  0x75, 0x83, 0x8e, 0x92, 0x8e, 0x85, 0x7e, 0x7f, 0x85, 0x8e, 0x93, 0x94,
-  0x8e, 0x82, 0x75, 0x6c, 0x68, 0x6a, 0x70, 0x76, 0x7c, 0x82, 0x86, 0x89,
-  0x89, 0x87, 0x87, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x87,
-  0x87, 0x87, 0x82, 0x7d, 0x77, 0x74, 0x76, 0x7a, 0x7f, 0x86, 0x8c, 0x94,
-  0x9e, 0xa3, 0x98, 0x78, 0x4f, 0x2e, 0x1f, 0x28, 0x46, 0x76, 0xa7, 0xc5,
-  0xc6, 0xad, 0x93, 0x95, 0xb3, 0xd8, 0xe9, 0xd9, 0xac, 0x77, 0x50, 0x40,
-  0x46, 0x58, 0x64, 0x61, 0x56, 0x51, 0x5b, 0x6f, 0x83, 0x92, 0x96, 0x90,
-  0x8b, 0x8e, 0x96, 0x9c, 0x9e, 0x9c, 0x98, 0x96, 0x98, 0x96, 0x8a, 0x74,
-  0x5c, 0x4a, 0x45, 0x4c, 0x58, 0x64, 0x6c, 0x70, 0x75, 0x7e, 0x8b, 0x9a,
-  0xa6, 0xaa, 0xa8, 0x9f, 0x97, 0x90, 0x8c, 0x8a, 0x84, 0x7e, 0x76, 0x6e,
-  0x66, 0x60, 0x5d, 0x61, 0x69, 0x72, 0x78, 0x7b, 0x7e, 0x83, 0x8f, 0xa0,
-  0xae, 0xac, 0x8f, 0x60, 0x36, 0x1f, 0x1e, 0x32, 0x5c, 0x8c, 0xb0, 0xc7,
-  0xcd, 0xc1, 0xb3, 0xae, 0xb0, 0xb5, 0xb9, 0xb2, 0x9c, 0x7d, 0x5c, 0x3f,
-  0x30, 0x32, 0x42, 0x5d, 0x78, 0x8c, 0x92, 0x8d, 0x82, 0x7d, 0x82, 0x8d,
-  0x97, 0x9b, 0x99, 0x92, 0x8b, 0x88, 0x88, 0x88, 0x87, 0x83, 0x78, 0x6a,
-  0x5b, 0x50, 0x4c, 0x50, 0x58, 0x65, 0x75, 0x83, 0x90, 0x98, 0x9c, 0x9f,
-  0xa0, 0x9f, 0x9c, 0x96, 0x8f, 0x88, 0x7e, 0x74, 0x6b, 0x62, 0x5a, 0x56,
-  0x59, 0x60, 0x69, 0x70, 0x76, 0x7c, 0x82, 0x87, 0x8c, 0x91, 0x96, 0x9d,
-  0xa6, 0xae, 0xb2, 0xaa, 0x92, 0x6f, 0x4d, 0x30, 0x22, 0x28, 0x3f, 0x60,
-  0x84, 0xa3, 0xb4, 0xb4, 0xa6, 0x95, 0x8a, 0x8c, 0x97, 0xa3, 0xa9, 0xa3,
-  0x8e, 0x71, 0x57, 0x49, 0x4b, 0x5a, 0x70, 0x83, 0x8d, 0x8a, 0x7c, 0x6b,
-  0x60, 0x62, 0x70, 0x81, 0x92, 0x9d, 0x9f, 0x9a, 0x90, 0x88, 0x86, 0x8a,
-  0x8e, 0x8c, 0x84, 0x75, 0x67, 0x60, 0x5f, 0x65, 0x6e, 0x79, 0x81, 0x85,
-  0x87, 0x88, 0x86, 0x84, 0x83, 0x84, 0x89, 0x8e, 0x91, 0x92, 0x90, 0x8b,
-  0x84, 0x7f, 0x7a, 0x76, 0x72, 0x6f, 0x6e, 0x6f, 0x73, 0x7a, 0x82, 0x8b,
-  0x92, 0x98, 0xa1, 0xac, 0xaf, 0x9a, 0x6d, 0x3d, 0x1a, 0x0e, 0x1f, 0x4a,
-  0x7d, 0xa9, 0xd0, 0xce, 0xa2, 0x80, 0x8b, 0xba, 0xe4, 0xec, 0xcc, 0x92,
-  0x5a, 0x37, 0x2f, 0x3e, 0x5a, 0x6c, 0x70, 0x69, 0x63, 0x64, 0x70, 0x80,
-  0x8e, 0x93, 0x91, 0x8d, 0x8c, 0x91, 0x99, 0xa2, 0xaa, 0xab, 0xa6, 0x9c,
-  0x8e, 0x79, 0x63, 0x51, 0x47, 0x48, 0x52, 0x5e, 0x68, 0x71, 0x78, 0x7f,
-  0x87, 0x92, 0x9d, 0xa6, 0xa8, 0xa4, 0x9a, 0x8f, 0x88, 0x85, 0x86, 0x88,
-  0x87, 0x7f, 0x71, 0x63, 0x57, 0x52, 0x58, 0x64, 0x72, 0x7e, 0x87, 0x8e,
-  0x96, 0x9e, 0xaa, 0xb3, 0xae, 0x8e, 0x5c, 0x2e, 0x11, 0x0a, 0x1c, 0x49,
-  0x7d, 0xa9, 0xcc, 0xcf, 0xb1, 0x94, 0x91, 0xa8, 0xc5, 0xd3, 0xc6, 0xa2,
-  0x77, 0x52, 0x37, 0x30, 0x3d, 0x57, 0x74, 0x8a, 0x90, 0x84, 0x70, 0x62,
-  0x62, 0x71, 0x84, 0x92, 0x97, 0x94, 0x90, 0x92, 0x9a, 0xa6, 0xad, 0xa8,
-  0x98, 0x80, 0x66, 0x52, 0x46, 0x41, 0x47, 0x54, 0x63, 0x75, 0x85, 0x92,
-  0x98, 0x9b, 0x9f, 0xa3, 0xa3, 0x9f, 0x97, 0x8e, 0x87, 0x83, 0x7e, 0x75,
-  0x6b, 0x61, 0x57, 0x53, 0x56, 0x5d, 0x66, 0x70, 0x78, 0x80, 0x88, 0x8b,
-  0x8c, 0x8f, 0x96, 0xa2, 0xb1, 0xbb, 0xb9, 0xa6, 0x85, 0x5f, 0x3f, 0x2b,
-  0x29, 0x37, 0x51, 0x71, 0x92, 0xab, 0xb8, 0xb6, 0xa9, 0x98, 0x8b, 0x89,
-  0x90, 0x99, 0x9f, 0x9d, 0x93, 0x81, 0x6d, 0x60, 0x5b, 0x61, 0x6d, 0x78,
-  0x7f, 0x7f, 0x75, 0x67, 0x5c, 0x5a, 0x63, 0x73, 0x87, 0x9a, 0xa8, 0xaf,
-  0xab, 0xa1, 0x93, 0x87, 0x82, 0x80, 0x7e, 0x7a, 0x76, 0x71, 0x71, 0x73,
-  0x77, 0x7c, 0x80, 0x81, 0x80, 0x7e, 0x7b, 0x7a, 0x7b, 0x81, 0x88, 0x8f,
-  0x95, 0x98, 0x98, 0x90, 0x86, 0x7d, 0x78, 0x74, 0x71, 0x6f, 0x6d, 0x6c,
-  0x6f, 0x74, 0x7b, 0x82, 0x8a, 0x93, 0x9d, 0xa9, 0xb1, 0xa5, 0x7e, 0x4b,
-  0x20, 0x0c, 0x13, 0x37, 0x6a, 0x97, 0xc7, 0xe6, 0xd1, 0xa0, 0x7c, 0x84,
-  0xae, 0xd2, 0xd1, 0xab, 0x74, 0x48, 0x35, 0x3e, 0x55, 0x6a, 0x75, 0x76,
-  0x72, 0x71, 0x74, 0x76, 0x76, 0x70, 0x6a, 0x6e, 0x7d, 0x95, 0xaf, 0xc6,
-  0xd0, 0xcd, 0xbe, 0xa8, 0x93, 0x7d, 0x69, 0x5a, 0x51, 0x4f, 0x52, 0x5c,
-  0x67, 0x71, 0x78, 0x7c, 0x80, 0x87, 0x8e, 0x95, 0x98, 0x9a, 0x9b, 0x9b,
-  0x9e, 0xa2, 0xa5, 0xa2, 0x96, 0x85, 0x6f, 0x5a, 0x4c, 0x46, 0x4b, 0x58,
-  0x67, 0x76, 0x84, 0x91, 0x9e, 0xac, 0xba, 0xbe, 0xa4, 0x73, 0x40, 0x19,
-  0x0b, 0x1a, 0x46, 0x7c, 0xac, 0xda, 0xe2, 0xba, 0x8d, 0x82, 0xa0, 0xc6,
-  0xd3, 0xbc, 0x8a, 0x5d, 0x48, 0x4e, 0x63, 0x74, 0x78, 0x73, 0x6e, 0x72,
-  0x7d, 0x84, 0x7e, 0x6d, 0x5b, 0x56, 0x65, 0x81, 0xa0, 0xb9, 0xc7, 0xc7,
-  0xc0, 0xb6, 0xaa, 0x98, 0x82, 0x6a, 0x57, 0x4b, 0x4a, 0x56, 0x65, 0x72,
-  0x7b, 0x81, 0x86, 0x8a, 0x91, 0x98, 0x9c, 0x9f, 0xa0, 0xa1, 0xa1, 0xa0,
-  0x9b, 0x92, 0x85, 0x76, 0x65, 0x58, 0x50, 0x4e, 0x53, 0x5c, 0x64, 0x6b,
-  0x6e, 0x6e, 0x6f, 0x75, 0x80, 0x8f, 0xa0, 0xb2, 0xbc, 0xbb, 0xa7, 0x86,
-  0x64, 0x4e, 0x45, 0x4f, 0x65, 0x7d, 0x94, 0xa4, 0xab, 0xa8, 0xa1, 0x97,
-  0x8c, 0x81, 0x79, 0x73, 0x72, 0x74, 0x7a, 0x82, 0x89, 0x8d, 0x8d, 0x8a,
-  0x84, 0x7f, 0x7d, 0x7a, 0x76, 0x6f, 0x69, 0x65, 0x64, 0x67, 0x70, 0x7e,
-  0x8d, 0x98, 0x9e, 0x9c, 0x92, 0x84, 0x77, 0x6f, 0x6f, 0x75, 0x7d, 0x85,
-  0x89, 0x8c, 0x8c, 0x8b, 0x8a, 0x88, 0x86, 0x80, 0x79, 0x73, 0x6f, 0x6e,
-  0x71, 0x75, 0x7b, 0x82, 0x87, 0x89, 0x8a, 0x88, 0x84, 0x80, 0x7e, 0x7e,
-  0x7c, 0x7b, 0x7a, 0x7a, 0x7b, 0x7d, 0x80, 0x83, 0x88, 0x90, 0x9a, 0xa2,
-  0x9c, 0x83, 0x59, 0x31, 0x19, 0x17, 0x32, 0x64, 0x9c, 0xca, 0xe8, 0xe4,
-  0xc0, 0x8c, 0x64, 0x5e, 0x74, 0x90, 0xa2, 0xa7, 0x9c, 0x86, 0x73, 0x6a,
-  0x69, 0x6d, 0x71, 0x70, 0x6c, 0x64, 0x5a, 0x53, 0x52, 0x57, 0x64, 0x78,
-  0x90, 0xa7, 0xb9, 0xc0, 0xba, 0xa7, 0x8b, 0x6f, 0x5f, 0x5e, 0x68, 0x75,
-  0x7e, 0x82, 0x7e, 0x78, 0x72, 0x6b, 0x67, 0x64, 0x64, 0x69, 0x71, 0x7c,
-  0x89, 0x94, 0x9b, 0xa0, 0xa1, 0x9d, 0x96, 0x8d, 0x82, 0x75, 0x67, 0x5c,
-  0x59, 0x5c, 0x62, 0x6c, 0x78, 0x82, 0x89, 0x93, 0xa4, 0xb1, 0xae, 0x92,
-  0x60, 0x2e, 0x10, 0x0c, 0x27, 0x5f, 0x96, 0xc9, 0xf0, 0xe3, 0xa7, 0x65,
-  0x4b, 0x66, 0x93, 0xa6, 0x9b, 0x84, 0x7c, 0x8d, 0xa8, 0xb8, 0xae, 0x88,
-  0x5f, 0x4c, 0x4c, 0x59, 0x62, 0x5b, 0x48, 0x3c, 0x44, 0x63, 0x8e, 0xb6,
-  0xcf, 0xd0, 0xba, 0x9c, 0x85, 0x7c, 0x82, 0x89, 0x8d, 0x8f, 0x91, 0x91,
-  0x90, 0x88, 0x77, 0x63, 0x53, 0x4a, 0x4f, 0x5f, 0x73, 0x86, 0x94, 0x99,
-  0x99, 0x96, 0x97, 0x9a, 0x9a, 0x93, 0x89, 0x7a, 0x6d, 0x6a, 0x6e, 0x76,
-  0x80, 0x87, 0x8c, 0x8b, 0x79, 0x55, 0x2d, 0x13, 0x0e, 0x22, 0x50, 0x86,
-  0xb7, 0xd6, 0xd1, 0xac, 0x87, 0x7b, 0x88, 0x9b, 0xa6, 0xa5, 0xa0, 0xa1,
-  0xa7, 0xaf, 0xae, 0x9d, 0x81, 0x66, 0x52, 0x4a, 0x4b, 0x4f, 0x50, 0x4e,
-  0x4e, 0x52, 0x60, 0x73, 0x89, 0x9f, 0xaf, 0xb5, 0xad, 0x9c, 0x8a, 0x81,
-  0x81, 0x8a, 0x98, 0xa2, 0xa6, 0x9f, 0x8b, 0x72, 0x5e, 0x51, 0x4a, 0x4f,
-  0x5c, 0x6d, 0x7e, 0x8a, 0x8e, 0x92, 0x95, 0x97, 0x97, 0x95, 0x90, 0x86,
-  0x7c, 0x73, 0x6e, 0x73, 0x7c, 0x7e, 0x7e, 0x7c, 0x75, 0x6e, 0x6e, 0x79,
-  0x8a, 0x9c, 0xa4, 0x99, 0x78, 0x50, 0x32, 0x2a, 0x36, 0x56, 0x87, 0xb8,
-  0xdb, 0xe8, 0xd9, 0xb1, 0x84, 0x67, 0x5e, 0x6b, 0x86, 0x9e, 0xaf, 0xb7,
-  0xb4, 0xa6, 0x96, 0x86, 0x76, 0x68, 0x61, 0x5c, 0x59, 0x5a, 0x5f, 0x65,
-  0x6a, 0x70, 0x78, 0x81, 0x8e, 0x9a, 0xa0, 0x9e, 0x92, 0x82, 0x76, 0x77,
-  0x81, 0x8f, 0x9e, 0xa6, 0xa2, 0x93, 0x80, 0x6d, 0x60, 0x5d, 0x61, 0x6a,
-  0x75, 0x7e, 0x83, 0x85, 0x84, 0x84, 0x83, 0x81, 0x7c, 0x7b, 0x7c, 0x7e,
-  0x80, 0x82, 0x86, 0x8a, 0x8d, 0x8c, 0x89, 0x84, 0x80, 0x7c, 0x78, 0x7a,
-  0x82, 0x8c, 0x97, 0xa2, 0xa9, 0xa1, 0x84, 0x5b, 0x33, 0x1a, 0x17, 0x33,
-  0x66, 0xa0, 0xd3, 0xf2, 0xe8, 0xb4, 0x70, 0x45, 0x3e, 0x55, 0x7b, 0xa0,
-  0xbb, 0xca, 0xcc, 0xc6, 0xb7, 0xa1, 0x87, 0x6f, 0x5c, 0x52, 0x50, 0x55,
-  0x5b, 0x62, 0x68, 0x6f, 0x76, 0x7f, 0x86, 0x88, 0x84, 0x7a, 0x70, 0x6d,
-  0x72, 0x7e, 0x8d, 0x9c, 0xa8, 0xad, 0xa7, 0x98, 0x84, 0x71, 0x66, 0x63,
-  0x69, 0x73, 0x7a, 0x80, 0x82, 0x80, 0x7b, 0x76, 0x72, 0x70, 0x73, 0x77,
-  0x7e, 0x84, 0x8a, 0x8d, 0x8c, 0x89, 0x86, 0x84, 0x82, 0x7e, 0x7e, 0x82,
-  0x89, 0x91, 0x97, 0x94, 0x81, 0x5f, 0x3a, 0x21, 0x1f, 0x37, 0x63, 0x9a,
-  0xc6, 0xd0, 0xb4, 0x84, 0x5f, 0x5a, 0x69, 0x7e, 0x92, 0xa4, 0xb7, 0xc9,
-  0xd4, 0xd1, 0xbe, 0x9f, 0x80, 0x6f, 0x6a, 0x6b, 0x6d, 0x6b, 0x67, 0x67,
-  0x6d, 0x72, 0x75, 0x72, 0x6c, 0x67, 0x64, 0x5e, 0x57, 0x50, 0x52, 0x63,
-  0x80, 0x9f, 0xb6, 0xbe, 0xb0, 0x92, 0x74, 0x66, 0x6b, 0x7c, 0x8e, 0x9b,
-  0xa2, 0xa0, 0x93, 0x82, 0x72, 0x66, 0x60, 0x60, 0x66, 0x6e, 0x78, 0x82,
-  0x88, 0x88, 0x84, 0x80, 0x7b, 0x78, 0x78, 0x7b, 0x81, 0x89, 0x90, 0x94,
-  0x91, 0x80, 0x60, 0x3e, 0x2c, 0x2f, 0x48, 0x6e, 0x94, 0xab, 0xa9, 0x91,
-  0x74, 0x67, 0x68, 0x6d, 0x76, 0x83, 0x96, 0xac, 0xc2, 0xcd, 0xc9, 0xb6,
-  0x9d, 0x89, 0x80, 0x7d, 0x7a, 0x78, 0x7a, 0x7e, 0x82, 0x82, 0x7e, 0x79,
-  0x73, 0x6d, 0x65, 0x59, 0x4c, 0x45, 0x4b, 0x5e, 0x76, 0x8a, 0x95, 0x93,
-  0x87, 0x79, 0x72, 0x76, 0x7e, 0x89, 0x92, 0x98, 0x9b, 0x99, 0x94, 0x8d,
-  0x84, 0x79, 0x70, 0x6c, 0x6f, 0x76, 0x7e, 0x86, 0x8a, 0x88, 0x84, 0x80,
-  0x7a, 0x73, 0x6c, 0x65, 0x64, 0x6a, 0x74, 0x83, 0x90, 0x96, 0x91, 0x83,
-  0x77, 0x74, 0x78, 0x81, 0x86, 0x84, 0x79, 0x6d, 0x68, 0x70, 0x7f, 0x8b,
-  0x8f, 0x8c, 0x86, 0x85, 0x8e, 0x99, 0x9c, 0x96, 0x8a, 0x7d, 0x79, 0x84,
-  0x97, 0xa8, 0xb0, 0xac, 0x9c, 0x8a, 0x7d, 0x77, 0x78, 0x7b, 0x7e, 0x80,
-  0x82, 0x82, 0x82, 0x7d, 0x76, 0x6f, 0x68, 0x61, 0x60, 0x64, 0x6a, 0x70,
-  0x76, 0x7a, 0x7e, 0x80, 0x82, 0x83, 0x84, 0x82, 0x81, 0x82, 0x86, 0x8c,
-  0x93, 0x99, 0x9a, 0x96, 0x8f, 0x86, 0x82, 0x80, 0x7e, 0x7e, 0x7c, 0x79,
-  0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7c, 0x79, 0x77, 0x75, 0x76, 0x7b,
-  0x80, 0x84, 0x84, 0x82, 0x7d, 0x7b, 0x7c, 0x7f, 0x86, 0x8f, 0x96, 0x98,
-  0x94, 0x86, 0x74, 0x66, 0x63, 0x6b, 0x7b, 0x8d, 0x9a, 0x9f, 0x9c, 0x93,
-  0x88, 0x81, 0x7e, 0x7d, 0x80, 0x85, 0x8c, 0x97, 0xa1, 0xa7, 0xa5, 0x9c,
-  0x8e, 0x80, 0x76, 0x72, 0x74, 0x79, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7b,
-  0x77, 0x70, 0x69, 0x66, 0x66, 0x6a, 0x70, 0x73, 0x76, 0x79, 0x7c, 0x7e,
-  0x81, 0x81, 0x7f, 0x7c, 0x7b, 0x7e, 0x85, 0x8c, 0x92, 0x93, 0x90, 0x88,
-  0x81, 0x7b, 0x79, 0x7a, 0x7c, 0x7d, 0x7c, 0x7b, 0x79, 0x77, 0x75, 0x73,
-  0x71, 0x6e, 0x6e, 0x72, 0x77, 0x7e, 0x83, 0x86, 0x85, 0x82, 0x7e, 0x7e,
-  0x7e, 0x81, 0x85, 0x88, 0x8a, 0x8d, 0x92, 0x91, 0x87, 0x76, 0x68, 0x60,
-  0x5e, 0x67, 0x7a, 0x8b, 0x94, 0x92, 0x88, 0x7e, 0x76, 0x73, 0x73, 0x77,
-  0x7e, 0x87, 0x92, 0x9a, 0xa0, 0xa2, 0x9e, 0x94, 0x89, 0x81, 0x7c, 0x7c,
-  0x82, 0x8b, 0x93, 0x99, 0x9a, 0x91, 0x80, 0x6f, 0x62, 0x5d, 0x60, 0x67,
-  0x6d, 0x70, 0x70, 0x6f, 0x6e, 0x6e, 0x6c, 0x6c, 0x6e, 0x72, 0x75, 0x79,
-  0x80, 0x86, 0x87, 0x85, 0x82, 0x7e, 0x7b, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-  0x81, 0x82, 0x81, 0x7e, 0x7c, 0x7c, 0x7a, 0x79, 0x7a, 0x7c, 0x7e, 0x80,
-  0x83, 0x85, 0x87, 0x89, 0x8a, 0x8a, 0x8b, 0x8c, 0x8d, 0x8d, 0x8f, 0x8f,
-  0x8c, 0x84, 0x77, 0x69, 0x5e, 0x5c, 0x65, 0x75, 0x85, 0x8e, 0x90, 0x88,
-  0x7d, 0x76, 0x74, 0x74, 0x76, 0x7c, 0x84, 0x8d, 0x96, 0x9d, 0xa0, 0x9e,
-  0x98, 0x90, 0x89, 0x86, 0x88, 0x8d, 0x94, 0x99, 0x9a, 0x94, 0x8a, 0x7c,
-  0x72, 0x6f, 0x70, 0x74, 0x79, 0x80, 0x84, 0x81, 0x79, 0x72, 0x6e, 0x6d,
-  0x6d, 0x70, 0x73, 0x74, 0x74, 0x72, 0x71, 0x72, 0x73, 0x74, 0x75, 0x77,
-  0x7a, 0x7a, 0x79, 0x7b, 0x7d, 0x7d, 0x7c, 0x7e, 0x7e, 0x7d, 0x7e, 0x81,
-  0x82, 0x82, 0x83, 0x83, 0x85, 0x88, 0x8a, 0x8c, 0x8e, 0x8d, 0x8c, 0x88,
-  0x83, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x83, 0x82, 0x7f, 0x7b,
-  0x78, 0x7a, 0x82, 0x8a, 0x8d, 0x89, 0x81, 0x7d, 0x80, 0x86, 0x8c, 0x8f,
-  0x8e, 0x8a, 0x8a, 0x8c, 0x8b, 0x86, 0x80, 0x7d, 0x7b, 0x7c, 0x7e, 0x7f,
-  0x7d, 0x7c, 0x7d, 0x80, 0x83, 0x85, 0x87, 0x88, 0x87, 0x80, 0x7a, 0x77,
-  0x7a, 0x7e, 0x7e, 0x7b, 0x76, 0x76, 0x79, 0x7e, 0x80, 0x7e, 0x78, 0x74,
-  0x74, 0x78, 0x7d, 0x80, 0x80, 0x7d, 0x7d, 0x7f, 0x82, 0x81, 0x7f, 0x7d,
-  0x7d, 0x80, 0x84, 0x86, 0x86, 0x85, 0x84, 0x82, 0x82, 0x81, 0x80, 0x7e,
-  0x7d, 0x7e, 0x80, 0x83, 0x83, 0x7f, 0x7a, 0x7a, 0x7d, 0x80, 0x83, 0x86,
-  0x87, 0x82, 0x7b, 0x7b, 0x81, 0x86, 0x87, 0x84, 0x7c, 0x75, 0x77, 0x82,
-  0x8d, 0x8c, 0x82, 0x79, 0x77, 0x7a, 0x80, 0x83, 0x82, 0x7d, 0x7c, 0x7f,
-  0x82, 0x80, 0x80, 0x84, 0x84, 0x7e, 0x7c, 0x82, 0x87, 0x86, 0x84, 0x81,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x83, 0x81, 0x7e, 0x7d, 0x7e, 0x80, 0x7f,
-  0x7c, 0x7a, 0x7d, 0x82, 0x84, 0x82, 0x7e, 0x7c, 0x7e, 0x81, 0x81, 0x7d,
-  0x7b, 0x7c, 0x7e, 0x80, 0x80, 0x7e, 0x7c, 0x7d, 0x7d, 0x7e, 0x80, 0x80,
-  0x7e, 0x7d, 0x7e, 0x81, 0x81, 0x7e, 0x7b, 0x78, 0x7a, 0x7e, 0x81, 0x80,
-  0x7d, 0x7b, 0x7b, 0x7d, 0x7e, 0x7e, 0x7b, 0x7b, 0x7e, 0x7e, 0x7e, 0x83,
-  0x89, 0x84, 0x7b, 0x76, 0x7a, 0x7e, 0x80, 0x82, 0x82, 0x7e, 0x79, 0x78,
-  0x7c, 0x82, 0x84, 0x80, 0x7a, 0x78, 0x7e, 0x87, 0x8b, 0x89, 0x83, 0x7f,
-  0x80, 0x84, 0x83, 0x80, 0x7e, 0x7e, 0x7d, 0x7d, 0x82, 0x87, 0x86, 0x7e,
-  0x7a, 0x7e, 0x82, 0x80, 0x80, 0x85, 0x86, 0x83, 0x82, 0x85, 0x88, 0x89,
-  0x86, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x80, 0x81, 0x81, 0x83, 0x85,
-  0x83, 0x80, 0x7e, 0x80, 0x81, 0x82, 0x81, 0x7e, 0x7d, 0x81, 0x83, 0x80,
-  0x80, 0x84, 0x86, 0x84, 0x81, 0x81, 0x82, 0x80, 0x7d, 0x80, 0x82, 0x7e,
-  0x7c, 0x7e, 0x7d, 0x7b, 0x7c, 0x7e, 0x7c, 0x79, 0x77, 0x77, 0x7a, 0x7f,
-  0x82, 0x81, 0x82, 0x82, 0x82, 0x84, 0x85, 0x83, 0x81, 0x81, 0x81, 0x7f,
-  0x7d, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7c, 0x7a, 0x7a,
-  0x7d, 0x80, 0x81, 0x7f, 0x7b, 0x7b, 0x80, 0x85, 0x88, 0x87, 0x85, 0x84,
-  0x84, 0x82, 0x82, 0x84, 0x86, 0x84, 0x82, 0x80, 0x7f, 0x80, 0x84, 0x87,
-  0x83, 0x7f, 0x7e, 0x81, 0x84, 0x84, 0x82, 0x7f, 0x7e, 0x7e, 0x7f, 0x82,
-  0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x83, 0x82, 0x80, 0x80, 0x83,
-  0x82, 0x7d, 0x7c, 0x7e, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x82, 0x80, 0x81, 0x82, 0x81, 0x7f,
-  0x7e, 0x7e, 0x7c, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7f, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x83, 0x83,
-  0x82, 0x82, 0x83, 0x83, 0x83, 0x84, 0x84, 0x81, 0x7e, 0x7d, 0x7e, 0x80,
-  0x82, 0x80, 0x7d, 0x7a, 0x7a, 0x7a, 0x7b, 0x7e, 0x80, 0x7f, 0x7c, 0x7b,
-  0x7e, 0x82, 0x82, 0x7f, 0x7e, 0x7f, 0x81, 0x81, 0x82, 0x82, 0x80, 0x7d,
-  0x7b, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x80,
-  0x80, 0x7e, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x82, 0x83, 0x83, 0x82, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x7f, 0x7c,
-  0x7a, 0x7a, 0x7c, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x84,
-  0x83, 0x84, 0x83, 0x83, 0x83, 0x84, 0x82, 0x7e, 0x7d, 0x7e, 0x80, 0x80,
-  0x7d, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x7c, 0x7e, 0x80, 0x81, 0x82,
-  0x84, 0x84, 0x82, 0x81, 0x82, 0x84, 0x83, 0x82, 0x83, 0x84, 0x84, 0x83,
-  0x7f, 0x7c, 0x7a, 0x79, 0x7a, 0x7a, 0x7d, 0x7f, 0x7f, 0x7d, 0x7b, 0x7c,
-  0x7f, 0x81, 0x80, 0x7e, 0x80, 0x83, 0x85, 0x85, 0x83, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7c, 0x7a, 0x7a,
-  0x7e, 0x80, 0x7f, 0x7d, 0x7d, 0x7e, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7b, 0x7a, 0x7c, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x82, 0x84, 0x83, 0x83,
-  0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x81, 0x7d, 0x7d, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x80,
-  0x81, 0x82, 0x81, 0x80, 0x80, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x7e, 0x7b, 0x7a, 0x7d, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x80,
-  0x81, 0x81, 0x80, 0x7e, 0x7c, 0x7b, 0x7e, 0x82, 0x84, 0x83, 0x80, 0x80,
-  0x83, 0x86, 0x86, 0x84, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7b, 0x7a, 0x7a,
-  0x7c, 0x7f, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x82, 0x81, 0x80, 0x81, 0x82,
-  0x82, 0x83, 0x84, 0x85, 0x86, 0x86, 0x85, 0x82, 0x80, 0x80, 0x82, 0x82,
-  0x81, 0x80, 0x80, 0x82, 0x83, 0x82, 0x7e, 0x7c, 0x7d, 0x7f, 0x80, 0x7f,
-  0x7e, 0x81, 0x83, 0x83, 0x81, 0x80, 0x82, 0x83, 0x85, 0x85, 0x84, 0x84,
-  0x85, 0x84, 0x81, 0x7c, 0x7b, 0x7c, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x86,
-  0x86, 0x84, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7f, 0x81, 0x81, 0x82,
-  0x85, 0x86, 0x85, 0x83, 0x83, 0x82, 0x7f, 0x7d, 0x7c, 0x7e, 0x80, 0x80,
-  0x81, 0x84, 0x86, 0x84, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x82,
-  0x83, 0x82, 0x82, 0x81, 0x81, 0x82, 0x80, 0x80, 0x81, 0x82, 0x83, 0x84,
-  0x84, 0x83, 0x81, 0x81, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x81, 0x82, 0x82,
-  0x81, 0x80, 0x81, 0x81, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7d,
-  0x7b, 0x7c, 0x7f, 0x81, 0x83, 0x83, 0x80, 0x7f, 0x7f, 0x7f, 0x7d, 0x7d,
-  0x7e, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x81,
-  0x81, 0x7e, 0x7a, 0x7a, 0x7d, 0x80, 0x82, 0x81, 0x7e, 0x7c, 0x7b, 0x7b,
-  0x7c, 0x80, 0x82, 0x80, 0x7d, 0x7a, 0x7b, 0x7f, 0x82, 0x83, 0x82, 0x80,
-  0x7e, 0x7d, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7e, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7b, 0x79, 0x7a, 0x7c, 0x7d, 0x7c, 0x7c, 0x7d,
-  0x7d, 0x7d, 0x7f, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7c, 0x7e, 0x7e, 0x7c,
-  0x7a, 0x7a, 0x7d, 0x81, 0x81, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x79, 0x7b,
-  0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x81, 0x80, 0x81, 0x81, 0x7f, 0x7d, 0x7e, 0x81, 0x82, 0x80, 0x7c, 0x7c,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7b, 0x7b, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x82,
-  0x82, 0x83, 0x83, 0x82, 0x80, 0x7f, 0x80, 0x82, 0x83, 0x82, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7c, 0x78, 0x78, 0x7d, 0x81, 0x82, 0x82,
-  0x81, 0x80, 0x81, 0x82, 0x83, 0x84, 0x82, 0x7f, 0x7e, 0x81, 0x84, 0x85,
-  0x83, 0x80, 0x82, 0x84, 0x83, 0x81, 0x81, 0x81, 0x82, 0x81, 0x7e, 0x7c,
-  0x7e, 0x83, 0x85, 0x82, 0x7d, 0x79, 0x7b, 0x82, 0x88, 0x89, 0x84, 0x7e,
-  0x7d, 0x80, 0x83, 0x84, 0x82, 0x81, 0x7f, 0x7c, 0x7d, 0x81, 0x84, 0x83,
-  0x80, 0x7c, 0x7d, 0x80, 0x82, 0x82, 0x81, 0x82, 0x83, 0x84, 0x82, 0x82,
-  0x83, 0x82, 0x82, 0x81, 0x7e, 0x7c, 0x7c, 0x7e, 0x80, 0x80, 0x7e, 0x7e,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7e, 0x7d, 0x7d, 0x7e,
-  0x80, 0x80, 0x81, 0x80, 0x7e, 0x7a, 0x7a, 0x80, 0x84, 0x82, 0x7e, 0x7c,
-  0x7c, 0x7d, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82, 0x82, 0x80, 0x80, 0x81,
-  0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x83, 0x84, 0x83, 0x83, 0x84, 0x84,
-  0x83, 0x7f, 0x7c, 0x7f, 0x85, 0x88, 0x85, 0x80, 0x7d, 0x7e, 0x81, 0x82,
-  0x82, 0x7e, 0x7c, 0x7c, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x81,
-  0x83, 0x84, 0x82, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d, 0x7a, 0x7a, 0x7d, 0x80,
-  0x80, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7d, 0x7e, 0x81, 0x81, 0x80,
-  0x81, 0x82, 0x81, 0x80, 0x80, 0x7e, 0x7d, 0x7c, 0x7c, 0x7f, 0x82, 0x81,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x81, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x82, 0x82, 0x82, 0x83, 0x83, 0x81, 0x81, 0x82, 0x83, 0x83, 0x82,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x82,
-  0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x81, 0x82, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x83, 0x83, 0x84, 0x84, 0x84, 0x85, 0x83, 0x81, 0x82, 0x83, 0x82,
-  0x7f, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7d,
-  0x7c, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x7f, 0x7e, 0x7f, 0x81, 0x81, 0x7f,
-  0x7d, 0x7f, 0x82, 0x82, 0x80, 0x7f, 0x80, 0x82, 0x83, 0x82, 0x7f, 0x7d,
-  0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x80, 0x7d, 0x7b, 0x7d, 0x81, 0x82, 0x81,
-  0x80, 0x7d, 0x7c, 0x80, 0x83, 0x82, 0x7d, 0x7b, 0x7d, 0x81, 0x82, 0x7e,
-  0x7a, 0x7a, 0x7d, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-  0x7a, 0x7c, 0x81, 0x84, 0x82, 0x7f, 0x7e, 0x7f, 0x82, 0x82, 0x81, 0x81,
-  0x82, 0x82, 0x7f, 0x7d, 0x80, 0x82, 0x80, 0x7f, 0x82, 0x80, 0x79, 0x74,
-  0x78, 0x81, 0x8a, 0x8b, 0x84, 0x7a, 0x77, 0x7b, 0x7f, 0x82, 0x80, 0x7c,
-  0x7c, 0x7e, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c,
-  0x7b, 0x7c, 0x80, 0x83, 0x82, 0x80, 0x7d, 0x7e, 0x80, 0x82, 0x7e, 0x7a,
-  0x7b, 0x81, 0x83, 0x81, 0x7e, 0x7e, 0x80, 0x80, 0x7e, 0x7c, 0x7c, 0x7d,
-  0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7e, 0x80, 0x81, 0x80, 0x7d,
-  0x7d, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x82, 0x80,
-  0x80, 0x82, 0x81, 0x80, 0x82, 0x81, 0x7c, 0x79, 0x7c, 0x7e, 0x7e, 0x80,
-  0x80, 0x7f, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x83, 0x82, 0x7d, 0x7b, 0x7d,
-  0x80, 0x81, 0x81, 0x80, 0x7e, 0x7c, 0x7b, 0x7e, 0x83, 0x84, 0x82, 0x80,
-  0x80, 0x82, 0x86, 0x85, 0x80, 0x7d, 0x80, 0x86, 0x85, 0x7d, 0x7a, 0x7d,
-  0x81, 0x82, 0x82, 0x7e, 0x7b, 0x7b, 0x7e, 0x81, 0x81, 0x81, 0x83, 0x81,
-  0x7b, 0x7b, 0x80, 0x83, 0x84, 0x83, 0x81, 0x7d, 0x7f, 0x84, 0x86, 0x82,
-  0x7b, 0x7b, 0x80, 0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x83,
-  0x86, 0x84, 0x80, 0x7d, 0x80, 0x85, 0x84, 0x7f, 0x7c, 0x7c, 0x81, 0x84,
-  0x82, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x81, 0x7e, 0x7e, 0x81, 0x82, 0x80,
-  0x7c, 0x7a, 0x7d, 0x83, 0x84, 0x81, 0x80, 0x82, 0x84, 0x84, 0x80, 0x7d,
-  0x7f, 0x82, 0x82, 0x82, 0x81, 0x7f, 0x80, 0x81, 0x7e, 0x7e, 0x82, 0x81,
-  0x7e, 0x7f, 0x81, 0x82, 0x83, 0x83, 0x82, 0x7e, 0x7e, 0x84, 0x88, 0x83,
-  0x7e, 0x7e, 0x83, 0x88, 0x86, 0x7e, 0x78, 0x7a, 0x80, 0x85, 0x84, 0x7f,
-  0x7a, 0x79, 0x7c, 0x80, 0x82, 0x84, 0x84, 0x7f, 0x7b, 0x7b, 0x81, 0x88,
-  0x87, 0x81, 0x7e, 0x7e, 0x7e, 0x81, 0x7f, 0x7c, 0x7f, 0x83, 0x80, 0x7a,
-  0x7a, 0x7c, 0x80, 0x83, 0x83, 0x80, 0x7c, 0x7b, 0x7f, 0x83, 0x82, 0x7e,
-  0x78, 0x77, 0x7c, 0x85, 0x8b, 0x84, 0x78, 0x76, 0x82, 0x8b, 0x89, 0x80,
-  0x76, 0x76, 0x80, 0x86, 0x82, 0x7d, 0x79, 0x77, 0x7a, 0x81, 0x82, 0x7e,
-  0x7d, 0x7f, 0x7e, 0x7c, 0x7a, 0x7b, 0x7e, 0x83, 0x84, 0x81, 0x7b, 0x7b,
-  0x84, 0x89, 0x84, 0x7b, 0x78, 0x79, 0x81, 0x85, 0x7f, 0x78, 0x7c, 0x82,
-  0x83, 0x82, 0x7f, 0x7c, 0x7d, 0x7e, 0x7b, 0x79, 0x7d, 0x82, 0x84, 0x83,
-  0x7e, 0x7b, 0x7d, 0x82, 0x86, 0x85, 0x81, 0x7f, 0x80, 0x7e, 0x7b, 0x7c,
-  0x80, 0x82, 0x81, 0x7e, 0x7c, 0x81, 0x85, 0x82, 0x7c, 0x7b, 0x80, 0x83,
-  0x84, 0x83, 0x80, 0x7e, 0x82, 0x85, 0x82, 0x80, 0x81, 0x82, 0x83, 0x82,
-  0x80, 0x7e, 0x81, 0x87, 0x86, 0x7e, 0x7a, 0x7e, 0x84, 0x87, 0x83, 0x7b,
-  0x79, 0x81, 0x85, 0x83, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e,
-  0x7e, 0x7c, 0x7d, 0x7e, 0x7e, 0x80, 0x81, 0x7d, 0x78, 0x76, 0x7c, 0x84,
-  0x82, 0x7c, 0x7e, 0x86, 0x87, 0x80, 0x79, 0x7a, 0x7d, 0x82, 0x87, 0x86,
-  0x7e, 0x7d, 0x81, 0x82, 0x82, 0x82, 0x7f, 0x7b, 0x7b, 0x7d, 0x80, 0x83,
-  0x81, 0x7c, 0x7a, 0x7a, 0x80, 0x8b, 0x8e, 0x81, 0x75, 0x77, 0x81, 0x87,
-  0x84, 0x7d, 0x78, 0x78, 0x7b, 0x81, 0x86, 0x8a, 0x88, 0x80, 0x76, 0x72,
-  0x77, 0x81, 0x8a, 0x8c, 0x86, 0x7d, 0x75, 0x75, 0x7f, 0x87, 0x85, 0x7d,
-  0x78, 0x79, 0x7d, 0x83, 0x86, 0x82, 0x7d, 0x7e, 0x85, 0x87, 0x81, 0x7a,
-  0x76, 0x79, 0x80, 0x85, 0x85, 0x81, 0x7c, 0x7b, 0x7e, 0x82, 0x85, 0x83,
-  0x7e, 0x77, 0x76, 0x80, 0x87, 0x83, 0x7b, 0x7a, 0x82, 0x8a, 0x89, 0x81,
-  0x78, 0x74, 0x7b, 0x88, 0x8e, 0x88, 0x7a, 0x73, 0x77, 0x7e, 0x82, 0x85,
-  0x83, 0x79, 0x77, 0x83, 0x8b, 0x85, 0x79, 0x75, 0x7f, 0x8b, 0x8b, 0x82,
-  0x7b, 0x79, 0x80, 0x8c, 0x8c, 0x7d, 0x76, 0x7d, 0x86, 0x86, 0x81, 0x7e,
-  0x7f, 0x80, 0x81, 0x82, 0x80, 0x7d, 0x7f, 0x84, 0x86, 0x84, 0x82, 0x82,
-  0x85, 0x85, 0x81, 0x7a, 0x77, 0x81, 0x8e, 0x8c, 0x7e, 0x74, 0x73, 0x77,
-  0x80, 0x86, 0x84, 0x81, 0x85, 0x8b, 0x87, 0x7e, 0x7a, 0x7b, 0x7c, 0x84,
-  0x91, 0x8e, 0x79, 0x69, 0x6d, 0x7f, 0x90, 0x96, 0x8d, 0x7b, 0x74, 0x7a,
-  0x82, 0x83, 0x7e, 0x7c, 0x80, 0x84, 0x83, 0x7c, 0x79, 0x7c, 0x80, 0x7e,
-  0x7c, 0x7e, 0x81, 0x81, 0x7c, 0x7a, 0x7c, 0x82, 0x87, 0x88, 0x84, 0x7d,
-  0x7c, 0x7f, 0x81, 0x82, 0x7e, 0x7a, 0x7a, 0x7c, 0x7a, 0x7c, 0x86, 0x90,
-  0x90, 0x83, 0x75, 0x74, 0x7a, 0x85, 0x8f, 0x8e, 0x84, 0x7e, 0x81, 0x84,
-  0x88, 0x8b, 0x8a, 0x80, 0x79, 0x7c, 0x85, 0x88, 0x88, 0x86, 0x86, 0x8a,
-  0x8b, 0x82, 0x77, 0x76, 0x7e, 0x85, 0x87, 0x85, 0x80, 0x7c, 0x7c, 0x7e,
-  0x82, 0x83, 0x7b, 0x78, 0x81, 0x89, 0x88, 0x7a, 0x6d, 0x6f, 0x82, 0x94,
-  0x94, 0x81, 0x6d, 0x6c, 0x7d, 0x8a, 0x84, 0x73, 0x6c, 0x74, 0x83, 0x8e,
-  0x8f, 0x82, 0x6e, 0x6b, 0x7e, 0x93, 0x93, 0x80, 0x71, 0x75, 0x86, 0x91,
-  0x89, 0x7a, 0x78, 0x82, 0x87, 0x83, 0x7d, 0x7d, 0x7d, 0x7f, 0x80, 0x80,
-  0x7e, 0x7c, 0x7d, 0x7f, 0x81, 0x81, 0x7d, 0x78, 0x76, 0x78, 0x7e, 0x82,
-  0x82, 0x80, 0x7c, 0x7a, 0x7c, 0x83, 0x84, 0x80, 0x7b, 0x7d, 0x7f, 0x80,
-  0x82, 0x87, 0x84, 0x79, 0x77, 0x81, 0x88, 0x83, 0x7f, 0x81, 0x84, 0x86,
-  0x85, 0x80, 0x7c, 0x80, 0x85, 0x81, 0x7e, 0x82, 0x82, 0x7e, 0x7a, 0x76,
-  0x77, 0x7e, 0x84, 0x84, 0x7e, 0x75, 0x70, 0x76, 0x82, 0x89, 0x89, 0x82,
-  0x7a, 0x7a, 0x7f, 0x84, 0x86, 0x85, 0x7d, 0x76, 0x78, 0x83, 0x8c, 0x8e,
-  0x89, 0x7d, 0x75, 0x79, 0x83, 0x8a, 0x88, 0x7e, 0x72, 0x70, 0x7c, 0x88,
-  0x8a, 0x84, 0x7b, 0x77, 0x7a, 0x7d, 0x7e, 0x7c, 0x78, 0x7a, 0x80, 0x86,
-  0x88, 0x84, 0x7c, 0x78, 0x7c, 0x84, 0x87, 0x84, 0x7c, 0x79, 0x7f, 0x86,
-  0x86, 0x80, 0x7d, 0x7f, 0x82, 0x82, 0x7f, 0x7d, 0x7c, 0x7c, 0x7e, 0x7d,
-  0x79, 0x75, 0x78, 0x82, 0x88, 0x86, 0x7e, 0x76, 0x77, 0x82, 0x8c, 0x8c,
-  0x82, 0x72, 0x6e, 0x79, 0x86, 0x8a, 0x85, 0x80, 0x7e, 0x80, 0x83, 0x80,
-  0x78, 0x76, 0x7c, 0x84, 0x86, 0x80, 0x78, 0x79, 0x7f, 0x82, 0x82, 0x82,
-  0x82, 0x7e, 0x7b, 0x7e, 0x84, 0x82, 0x7e, 0x81, 0x87, 0x8a, 0x84, 0x7d,
-  0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x81, 0x7e, 0x7c,
-  0x7b, 0x7b, 0x7d, 0x81, 0x82, 0x7e, 0x7a, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x80, 0x82, 0x82, 0x7f, 0x7c, 0x7a, 0x7c, 0x82, 0x86, 0x85, 0x7e, 0x78,
-  0x7c, 0x83, 0x88, 0x88, 0x84, 0x7f, 0x7c, 0x7e, 0x84, 0x88, 0x87, 0x82,
-  0x81, 0x84, 0x85, 0x84, 0x82, 0x82, 0x83, 0x81, 0x7e, 0x80, 0x81, 0x80,
-  0x80, 0x80, 0x82, 0x85, 0x84, 0x7e, 0x7a, 0x79, 0x7a, 0x7e, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7d, 0x7f, 0x7e, 0x78,
-  0x73, 0x72, 0x78, 0x83, 0x8a, 0x87, 0x7c, 0x74, 0x75, 0x7d, 0x83, 0x80,
-  0x77, 0x76, 0x81, 0x8d, 0x92, 0x8f, 0x85, 0x7b, 0x7b, 0x85, 0x8d, 0x8f,
-  0x8a, 0x81, 0x7c, 0x7e, 0x84, 0x86, 0x81, 0x7c, 0x7a, 0x7d, 0x80, 0x81,
-  0x7e, 0x7d, 0x7e, 0x81, 0x83, 0x81, 0x7e, 0x7c, 0x7d, 0x83, 0x89, 0x8a,
-  0x86, 0x81, 0x83, 0x89, 0x8a, 0x8a, 0x89, 0x87, 0x84, 0x83, 0x82, 0x82,
-  0x80, 0x80, 0x82, 0x86, 0x8a, 0x8b, 0x89, 0x85, 0x83, 0x83, 0x81, 0x7d,
-  0x7b, 0x7a, 0x79, 0x79, 0x78, 0x75, 0x74, 0x75, 0x74, 0x71, 0x6e, 0x6c,
-  0x6a, 0x6b, 0x6e, 0x71, 0x71, 0x72, 0x75, 0x7b, 0x80, 0x80, 0x7d, 0x7b,
-  0x7e, 0x83, 0x86, 0x84, 0x82, 0x82, 0x84, 0x86, 0x85, 0x84, 0x83, 0x84,
-  0x86, 0x89, 0x8d, 0x8d, 0x8b, 0x88, 0x84, 0x80, 0x79, 0x70, 0x6b, 0x70,
-  0x7a, 0x82, 0x83, 0x80, 0x7e, 0x7f, 0x82, 0x84, 0x84, 0x85, 0x89, 0x8d,
-  0x90, 0x92, 0x92, 0x92, 0x96, 0x9b, 0xa0, 0xa2, 0x9e, 0x98, 0x94, 0x92,
-  0x90, 0x8c, 0x88, 0x85, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7a, 0x78, 0x75,
-  0x72, 0x70, 0x6e, 0x6b, 0x6b, 0x6c, 0x6c, 0x6d, 0x6e, 0x70, 0x71, 0x70,
-  0x70, 0x71, 0x72, 0x72, 0x71, 0x70, 0x70, 0x73, 0x77, 0x7c, 0x7f, 0x81,
-  0x82, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7d, 0x7f, 0x83, 0x85, 0x86, 0x87,
-  0x86, 0x88, 0x90, 0x99, 0x9a, 0x93, 0x86, 0x79, 0x70, 0x6c, 0x68, 0x64,
-  0x64, 0x67, 0x6d, 0x74, 0x79, 0x7b, 0x80, 0x86, 0x8e, 0x96, 0x98, 0x95,
-  0x90, 0x90, 0x93, 0x99, 0x9e, 0xa2, 0xa6, 0xaa, 0xac, 0xab, 0xa8, 0xa5,
-  0xa0, 0x98, 0x8d, 0x83, 0x7c, 0x76, 0x6f, 0x6c, 0x6d, 0x6f, 0x70, 0x6f,
-  0x6c, 0x69, 0x66, 0x63, 0x61, 0x62, 0x65, 0x68, 0x6a, 0x69, 0x69, 0x6c,
-  0x70, 0x76, 0x79, 0x7a, 0x7b, 0x7a, 0x77, 0x74, 0x73, 0x73, 0x75, 0x78,
-  0x7c, 0x80, 0x80, 0x80, 0x82, 0x84, 0x86, 0x87, 0x88, 0x88, 0x87, 0x87,
-  0x87, 0x88, 0x8a, 0x8a, 0x8d, 0x90, 0x92, 0x8e, 0x83, 0x74, 0x68, 0x61,
-  0x5e, 0x5d, 0x5e, 0x60, 0x64, 0x6c, 0x75, 0x7e, 0x87, 0x8e, 0x95, 0x9a,
-  0x9d, 0x9f, 0xa0, 0xa1, 0xa2, 0xa5, 0xaa, 0xad, 0xb0, 0xb2, 0xb0, 0xad,
-  0xa9, 0xa1, 0x9a, 0x91, 0x85, 0x7a, 0x6f, 0x67, 0x62, 0x60, 0x60, 0x61,
-  0x63, 0x65, 0x67, 0x67, 0x67, 0x67, 0x6a, 0x6c, 0x6f, 0x71, 0x72, 0x73,
-  0x74, 0x76, 0x7a, 0x7e, 0x80, 0x80, 0x7e, 0x7b, 0x77, 0x75, 0x75, 0x76,
-  0x78, 0x79, 0x7c, 0x80, 0x84, 0x87, 0x8a, 0x8d, 0x8e, 0x8e, 0x8c, 0x8b,
-  0x89, 0x86, 0x84, 0x84, 0x85, 0x87, 0x89, 0x8b, 0x88, 0x7c, 0x6a, 0x59,
-  0x52, 0x51, 0x54, 0x57, 0x5b, 0x61, 0x69, 0x73, 0x80, 0x8d, 0x97, 0x9e,
-  0xa4, 0xa9, 0xae, 0xb0, 0xad, 0xa9, 0xa8, 0xa9, 0xaa, 0xac, 0xac, 0xab,
-  0xa6, 0xa1, 0x9a, 0x92, 0x87, 0x7c, 0x74, 0x6d, 0x67, 0x63, 0x60, 0x5e,
-  0x5d, 0x5c, 0x5d, 0x5f, 0x62, 0x65, 0x67, 0x6a, 0x6d, 0x70, 0x74, 0x78,
-  0x7d, 0x82, 0x86, 0x88, 0x8a, 0x8d, 0x8f, 0x8c, 0x85, 0x7e, 0x7a, 0x76,
-  0x74, 0x74, 0x75, 0x77, 0x79, 0x7d, 0x82, 0x84, 0x86, 0x87, 0x88, 0x89,
-  0x8a, 0x8b, 0x8a, 0x87, 0x83, 0x80, 0x7e, 0x7e, 0x80, 0x86, 0x8c, 0x8b,
-  0x7c, 0x63, 0x4e, 0x44, 0x46, 0x51, 0x5b, 0x63, 0x66, 0x6b, 0x74, 0x84,
-  0x93, 0x9f, 0xaa, 0xb2, 0xb9, 0xbd, 0xbd, 0xb9, 0xb3, 0xb0, 0xb0, 0xb0,
-  0xae, 0xa8, 0xa0, 0x98, 0x90, 0x8a, 0x83, 0x7b, 0x72, 0x68, 0x61, 0x5c,
-  0x58, 0x57, 0x57, 0x58, 0x58, 0x59, 0x5b, 0x60, 0x65, 0x69, 0x6b, 0x6e,
-  0x71, 0x75, 0x7a, 0x7e, 0x83, 0x87, 0x89, 0x8b, 0x8d, 0x90, 0x90, 0x8a,
-  0x83, 0x7d, 0x78, 0x75, 0x74, 0x74, 0x75, 0x77, 0x78, 0x7b, 0x7e, 0x80,
-  0x82, 0x84, 0x86, 0x87, 0x88, 0x87, 0x87, 0x87, 0x86, 0x85, 0x82, 0x81,
-  0x82, 0x85, 0x86, 0x80, 0x6b, 0x50, 0x41, 0x43, 0x51, 0x60, 0x66, 0x67,
-  0x68, 0x70, 0x84, 0x9a, 0xa8, 0xb3, 0xba, 0xbd, 0xc0, 0xc2, 0xc1, 0xbd,
-  0xba, 0xb6, 0xb1, 0xaa, 0xa3, 0x9c, 0x94, 0x8d, 0x87, 0x80, 0x76, 0x6d,
-  0x64, 0x5c, 0x57, 0x55, 0x56, 0x57, 0x59, 0x5b, 0x5b, 0x5b, 0x5c, 0x5f,
-  0x65, 0x6b, 0x70, 0x76, 0x7c, 0x82, 0x88, 0x8d, 0x90, 0x94, 0x97, 0x98,
-  0x96, 0x91, 0x89, 0x81, 0x7b, 0x77, 0x75, 0x72, 0x70, 0x71, 0x73, 0x77,
-  0x7d, 0x81, 0x84, 0x86, 0x88, 0x87, 0x88, 0x87, 0x86, 0x86, 0x85, 0x83,
-  0x81, 0x82, 0x84, 0x86, 0x7f, 0x6a, 0x4d, 0x3b, 0x3c, 0x4b, 0x5a, 0x5f,
-  0x5a, 0x56, 0x5f, 0x7a, 0x98, 0xaa, 0xb4, 0xb9, 0xbd, 0xc5, 0xcd, 0xd0,
-  0xcd, 0xc8, 0xc2, 0xb9, 0xaf, 0xa5, 0x9c, 0x92, 0x88, 0x81, 0x7d, 0x76,
-  0x6c, 0x62, 0x5b, 0x5a, 0x5c, 0x5e, 0x5e, 0x5d, 0x59, 0x56, 0x55, 0x57,
-  0x5c, 0x61, 0x66, 0x6b, 0x72, 0x7c, 0x86, 0x92, 0x9a, 0x9e, 0xa0, 0xa1,
-  0xa0, 0x9e, 0x98, 0x8f, 0x84, 0x7b, 0x75, 0x71, 0x6e, 0x6d, 0x6e, 0x72,
-  0x77, 0x7e, 0x86, 0x89, 0x89, 0x8a, 0x8c, 0x8b, 0x89, 0x87, 0x87, 0x85,
-  0x84, 0x85, 0x89, 0x89, 0x7b, 0x5c, 0x3b, 0x2f, 0x3b, 0x52, 0x60, 0x5b,
-  0x4c, 0x49, 0x5f, 0x86, 0xa2, 0xb0, 0xb4, 0xb3, 0xbb, 0xcc, 0xd8, 0xd7,
-  0xd0, 0xc9, 0xc0, 0xb4, 0xa9, 0xa0, 0x97, 0x8d, 0x83, 0x7d, 0x7a, 0x74,
-  0x68, 0x5d, 0x59, 0x5c, 0x5f, 0x62, 0x60, 0x5b, 0x56, 0x52, 0x50, 0x53,
-  0x58, 0x5e, 0x63, 0x6c, 0x78, 0x86, 0x94, 0x9e, 0xa3, 0xa3, 0xa2, 0xa2,
-  0xa2, 0x9d, 0x94, 0x87, 0x7b, 0x73, 0x6f, 0x6e, 0x6b, 0x69, 0x6c, 0x72,
-  0x7b, 0x82, 0x86, 0x89, 0x8c, 0x8e, 0x8c, 0x8a, 0x86, 0x81, 0x7f, 0x7e,
-  0x7f, 0x80, 0x7a, 0x65, 0x46, 0x32, 0x36, 0x4b, 0x59, 0x58, 0x4b, 0x44,
-  0x53, 0x71, 0x90, 0xa0, 0xa3, 0xa3, 0xae, 0xc1, 0xce, 0xd1, 0xcc, 0xc6,
-  0xc0, 0xb8, 0xae, 0xa1, 0x96, 0x8d, 0x84, 0x7d, 0x77, 0x72, 0x68, 0x5e,
-  0x58, 0x57, 0x57, 0x57, 0x56, 0x55, 0x55, 0x56, 0x58, 0x5a, 0x5e, 0x63,
-  0x69, 0x71, 0x7b, 0x86, 0x90, 0x99, 0x9e, 0x9f, 0x9d, 0x9b, 0x9a, 0x96,
-  0x8e, 0x84, 0x79, 0x72, 0x6d, 0x69, 0x67, 0x68, 0x6c, 0x72, 0x79, 0x7f,
-  0x84, 0x88, 0x8c, 0x8e, 0x90, 0x8f, 0x8d, 0x87, 0x82, 0x80, 0x81, 0x7e,
-  0x6d, 0x4b, 0x2c, 0x2a, 0x46, 0x67, 0x70, 0x5c, 0x3f, 0x40, 0x68, 0x9f,
-  0xbb, 0xb6, 0xa4, 0xa2, 0xb9, 0xd6, 0xe1, 0xd5, 0xc2, 0xb9, 0xb7, 0xb2,
-  0xa7, 0x99, 0x8d, 0x86, 0x82, 0x7e, 0x7a, 0x73, 0x66, 0x5b, 0x59, 0x5b,
-  0x5c, 0x5c, 0x59, 0x56, 0x57, 0x5a, 0x5d, 0x60, 0x62, 0x67, 0x70, 0x7c,
-  0x89, 0x95, 0x9e, 0xa4, 0xa6, 0xa5, 0xa4, 0xa4, 0xa1, 0x99, 0x8d, 0x7e,
-  0x73, 0x6e, 0x6b, 0x69, 0x66, 0x65, 0x69, 0x71, 0x7a, 0x83, 0x88, 0x8b,
-  0x90, 0x97, 0x9b, 0x99, 0x92, 0x8b, 0x8a, 0x8d, 0x87, 0x6d, 0x43, 0x23,
-  0x24, 0x42, 0x5e, 0x5e, 0x45, 0x31, 0x44, 0x78, 0xa6, 0xbb, 0xb8, 0xab,
-  0xaf, 0xc9, 0xe4, 0xe9, 0xd6, 0xbf, 0xb6, 0xb3, 0xab, 0x99, 0x86, 0x7a,
-  0x76, 0x76, 0x77, 0x74, 0x70, 0x6a, 0x68, 0x6a, 0x6a, 0x66, 0x5f, 0x5b,
-  0x5c, 0x5c, 0x5a, 0x57, 0x57, 0x58, 0x5c, 0x68, 0x78, 0x88, 0x98, 0xa5,
-  0xad, 0xb1, 0xb1, 0xb1, 0xb2, 0xb1, 0xa8, 0x97, 0x85, 0x77, 0x6e, 0x6a,
-  0x68, 0x63, 0x5f, 0x5e, 0x65, 0x70, 0x7b, 0x83, 0x8a, 0x90, 0x96, 0x9a,
-  0x9c, 0x98, 0x92, 0x8f, 0x8c, 0x80, 0x62, 0x39, 0x1e, 0x26, 0x46, 0x5c,
-  0x52, 0x34, 0x28, 0x47, 0x7f, 0xa9, 0xb8, 0xb2, 0xa8, 0xb5, 0xd4, 0xea,
-  0xe6, 0xcf, 0xbb, 0xb6, 0xb4, 0xa8, 0x90, 0x7a, 0x72, 0x74, 0x75, 0x72,
-  0x6d, 0x68, 0x67, 0x6b, 0x71, 0x6e, 0x60, 0x52, 0x4c, 0x4e, 0x53, 0x52,
-  0x4e, 0x53, 0x61, 0x72, 0x84, 0x93, 0x9f, 0xaa, 0xb3, 0xb8, 0xb7, 0xb2,
-  0xa9, 0x9e, 0x94, 0x87, 0x78, 0x68, 0x5d, 0x5b, 0x5f, 0x62, 0x64, 0x67,
-  0x6f, 0x7a, 0x86, 0x90, 0x99, 0xa0, 0xa4, 0xa4, 0xa2, 0x9c, 0x91, 0x80,
-  0x62, 0x3f, 0x28, 0x2b, 0x42, 0x51, 0x48, 0x34, 0x34, 0x52, 0x82, 0xa9,
-  0xb6, 0xaf, 0xae, 0xbe, 0xd4, 0xdd, 0xd0, 0xbb, 0xaf, 0xac, 0xa5, 0x92,
-  0x7c, 0x70, 0x70, 0x74, 0x74, 0x73, 0x71, 0x70, 0x75, 0x7c, 0x7e, 0x76,
-  0x68, 0x5e, 0x5a, 0x5a, 0x57, 0x52, 0x50, 0x55, 0x62, 0x74, 0x87, 0x95,
-  0x9e, 0xa9, 0xb4, 0xba, 0xb9, 0xb4, 0xad, 0xa4, 0x9b, 0x8f, 0x7e, 0x6c,
-  0x60, 0x5b, 0x5c, 0x5f, 0x5f, 0x60, 0x64, 0x6f, 0x7d, 0x8a, 0x93, 0x99,
-  0x9f, 0xa3, 0xa2, 0x9f, 0x99, 0x89, 0x67, 0x3e, 0x28, 0x33, 0x50, 0x5c,
-  0x49, 0x2c, 0x2a, 0x4f, 0x88, 0xae, 0xb6, 0xae, 0xac, 0xc5, 0xe1, 0xe8,
-  0xd6, 0xbe, 0xb5, 0xb7, 0xac, 0x8d, 0x6c, 0x62, 0x6d, 0x76, 0x71, 0x66,
-  0x60, 0x65, 0x75, 0x85, 0x88, 0x7e, 0x70, 0x65, 0x5f, 0x5e, 0x5a, 0x54,
-  0x4e, 0x4e, 0x58, 0x6a, 0x7a, 0x88, 0x97, 0xa8, 0xb8, 0xbe, 0xba, 0xb4,
-  0xb2, 0xb1, 0xa9, 0x98, 0x82, 0x6e, 0x63, 0x60, 0x60, 0x5e, 0x58, 0x54,
-  0x59, 0x65, 0x73, 0x7e, 0x88, 0x92, 0x9a, 0x9f, 0xa1, 0x9f, 0x95, 0x7e,
-  0x5a, 0x35, 0x2a, 0x3c, 0x54, 0x52, 0x3a, 0x28, 0x38, 0x67, 0x98, 0xb0,
-  0xb2, 0xac, 0xb7, 0xd3, 0xe6, 0xe0, 0xc9, 0xb9, 0xb8, 0xb4, 0x9c, 0x75,
-  0x5e, 0x63, 0x72, 0x73, 0x66, 0x59, 0x5b, 0x6d, 0x82, 0x8b, 0x84, 0x76,
-  0x6a, 0x65, 0x60, 0x59, 0x52, 0x4c, 0x4b, 0x51, 0x5d, 0x6c, 0x7b, 0x8b,
-  0x9b, 0xad, 0xb9, 0xba, 0xb4, 0xb1, 0xb2, 0xaf, 0xa3, 0x8f, 0x7b, 0x6d,
-  0x66, 0x64, 0x62, 0x5d, 0x57, 0x57, 0x5e, 0x68, 0x72, 0x7c, 0x86, 0x90,
-  0x98, 0x9a, 0x97, 0x92, 0x87, 0x71, 0x4d, 0x2e, 0x2c, 0x44, 0x59, 0x52,
-  0x3a, 0x30, 0x48, 0x7a, 0xa6, 0xb6, 0xb2, 0xb0, 0xc1, 0xd9, 0xe4, 0xd9,
-  0xc5, 0xb9, 0xb9, 0xb1, 0x93, 0x6f, 0x61, 0x6d, 0x7b, 0x77, 0x64, 0x57,
-  0x5f, 0x74, 0x86, 0x8a, 0x81, 0x73, 0x6a, 0x66, 0x62, 0x59, 0x50, 0x4d,
-  0x51, 0x56, 0x5f, 0x6b, 0x79, 0x89, 0x9b, 0xac, 0xb7, 0xb6, 0xb0, 0xae,
-  0xb1, 0xb1, 0xa6, 0x93, 0x80, 0x73, 0x6e, 0x6d, 0x6a, 0x65, 0x60, 0x5e,
-  0x62, 0x69, 0x71, 0x78, 0x81, 0x8a, 0x93, 0x96, 0x93, 0x8f, 0x8a, 0x7d,
-  0x60, 0x3c, 0x2f, 0x40, 0x59, 0x5b, 0x44, 0x32, 0x40, 0x6c, 0x9a, 0xb2,
-  0xb1, 0xaa, 0xb8, 0xd4, 0xe5, 0xde, 0xca, 0xc0, 0xc4, 0xc0, 0xa6, 0x80,
-  0x6e, 0x79, 0x8a, 0x87, 0x72, 0x5f, 0x62, 0x77, 0x88, 0x88, 0x7d, 0x70,
-  0x69, 0x66, 0x61, 0x58, 0x50, 0x50, 0x53, 0x57, 0x5f, 0x69, 0x77, 0x88,
-  0x9a, 0xaa, 0xb6, 0xb8, 0xb4, 0xb2, 0xb7, 0xba, 0xb4, 0xa3, 0x90, 0x85,
-  0x81, 0x7e, 0x78, 0x71, 0x68, 0x61, 0x60, 0x67, 0x6e, 0x72, 0x78, 0x82,
-  0x8a, 0x8f, 0x90, 0x90, 0x8e, 0x86, 0x6e, 0x49, 0x33, 0x3f, 0x5b, 0x64,
-  0x50, 0x36, 0x39, 0x5e, 0x89, 0xa4, 0xa6, 0xa2, 0xae, 0xc5, 0xd3, 0xd0,
-  0xc5, 0xc1, 0xc6, 0xc3, 0xac, 0x8a, 0x7b, 0x87, 0x98, 0x94, 0x80, 0x6a,
-  0x66, 0x74, 0x84, 0x86, 0x7d, 0x74, 0x6e, 0x66, 0x5b, 0x50, 0x4a, 0x48,
-  0x48, 0x47, 0x49, 0x52, 0x60, 0x70, 0x80, 0x91, 0x9e, 0xa5, 0xa8, 0xab,
-  0xb1, 0xb6, 0xb4, 0xac, 0x9f, 0x94, 0x90, 0x8e, 0x89, 0x7e, 0x72, 0x68,
-  0x66, 0x66, 0x65, 0x65, 0x6a, 0x72, 0x78, 0x7b, 0x7d, 0x81, 0x86, 0x86,
-  0x77, 0x56, 0x3a, 0x40, 0x5c, 0x6b, 0x5d, 0x40, 0x36, 0x52, 0x7a, 0x93,
-  0x96, 0x91, 0x9c, 0xb3, 0xc1, 0xbf, 0xb8, 0xb8, 0xc0, 0xc3, 0xb3, 0x94,
-  0x80, 0x87, 0x96, 0x9b, 0x8e, 0x79, 0x70, 0x76, 0x82, 0x86, 0x80, 0x78,
-  0x75, 0x72, 0x6a, 0x61, 0x5a, 0x56, 0x53, 0x50, 0x4c, 0x4a, 0x4c, 0x54,
-  0x5f, 0x69, 0x73, 0x7c, 0x82, 0x86, 0x8b, 0x95, 0xa2, 0xaa, 0xa9, 0xa1,
-  0x9c, 0x9c, 0x9d, 0x99, 0x91, 0x86, 0x7e, 0x7b, 0x78, 0x76, 0x72, 0x70,
-  0x72, 0x73, 0x72, 0x71, 0x71, 0x74, 0x79, 0x7e, 0x82, 0x7e, 0x6e, 0x57,
-  0x4e, 0x5b, 0x6f, 0x74, 0x63, 0x4f, 0x52, 0x6c, 0x87, 0x90, 0x89, 0x84,
-  0x8e, 0x9c, 0xa1, 0x9b, 0x97, 0x9d, 0xa6, 0xa6, 0x99, 0x89, 0x81, 0x87,
-  0x94, 0x96, 0x8b, 0x80, 0x80, 0x89, 0x92, 0x92, 0x89, 0x82, 0x82, 0x82,
-  0x7c, 0x73, 0x6f, 0x70, 0x72, 0x6e, 0x66, 0x61, 0x63, 0x6a, 0x6f, 0x71,
-  0x71, 0x73, 0x74, 0x74, 0x75, 0x77, 0x7a, 0x7c, 0x79, 0x77, 0x7a, 0x7e,
-  0x82, 0x83, 0x84, 0x85, 0x86, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x82,
-  0x80, 0x80, 0x82, 0x83, 0x83, 0x81, 0x81, 0x82, 0x81, 0x7e, 0x7b, 0x7a,
-  0x7c, 0x80, 0x80, 0x7e, 0x7c, 0x7c, 0x7e, 0x80, 0x80, 0x7e, 0x7e, 0x80,
-  0x82, 0x81, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x82, 0x82, 0x84, 0x88, 0x8a,
-  0x8a, 0x88, 0x89, 0x8c, 0x8e, 0x8e, 0x8c, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-  0x87, 0x86, 0x86, 0x86, 0x84, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x7f,
-  0x7d, 0x7c, 0x7a, 0x7a, 0x7a, 0x79, 0x76, 0x73, 0x74, 0x76, 0x7a, 0x7e,
-  0x80, 0x80, 0x82, 0x85, 0x87, 0x86, 0x84, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x81, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x82, 0x81, 0x80, 0x80, 0x81,
-  0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x81, 0x82, 0x83, 0x84, 0x84, 0x87, 0x88, 0x89, 0x88, 0x86,
-  0x85, 0x86, 0x85, 0x84, 0x83, 0x81, 0x81, 0x83, 0x86, 0x87, 0x87, 0x87,
-  0x87, 0x88, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x82, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x84, 0x85, 0x85, 0x86, 0x86, 0x87, 0x86, 0x86, 0x86,
-  0x85, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7b, 0x7b,
-  0x7a, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b,
-  0x7a, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7d, 0x81, 0x83,
-  0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x7f, 0x80, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x83, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82,
-  0x83, 0x84, 0x84, 0x85, 0x86, 0x86, 0x87, 0x86, 0x86, 0x86, 0x84, 0x83,
-  0x84, 0x84, 0x85, 0x85, 0x85, 0x84, 0x84, 0x85, 0x85, 0x84, 0x82, 0x81,
-  0x81, 0x81, 0x81, 0x7f, 0x7d, 0x7c, 0x7d, 0x7c, 0x7c, 0x7a, 0x79, 0x79,
-  0x79, 0x78, 0x78, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x7a, 0x7a, 0x7a,
-  0x78, 0x78, 0x78, 0x7a, 0x7a, 0x7a, 0x78, 0x78, 0x7a, 0x7b, 0x7c, 0x7b,
-  0x7a, 0x7b, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7e, 0x7e, 0x7d, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x80, 0x80, 0x81, 0x83,
-  0x84, 0x83, 0x82, 0x82, 0x82, 0x84, 0x85, 0x84, 0x83, 0x83, 0x84, 0x84,
-  0x84, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x82, 0x83, 0x84,
-  0x84, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d, 0x7c, 0x7a, 0x78, 0x78, 0x78, 0x78,
-  0x77, 0x78, 0x78, 0x77, 0x77, 0x76, 0x75, 0x76, 0x78, 0x79, 0x78, 0x76,
-  0x77, 0x7a, 0x7b, 0x7b, 0x7a, 0x78, 0x78, 0x7a, 0x7c, 0x7b, 0x7a, 0x7b,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81,
-  0x83, 0x83, 0x83, 0x82, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80,
-  0x81, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85,
-  0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x84,
-  0x83, 0x82, 0x82, 0x83, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7b,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x7b, 0x7b, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b,
-  0x7c, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7b, 0x7a, 0x7a, 0x7c,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x85, 0x86,
-  0x86, 0x84, 0x84, 0x84, 0x84, 0x83, 0x82, 0x80, 0x80, 0x80, 0x82, 0x83,
-  0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x85, 0x86, 0x86, 0x86, 0x86, 0x87,
-  0x88, 0x88, 0x87, 0x86, 0x84, 0x84, 0x84, 0x85, 0x84, 0x83, 0x82, 0x82,
-  0x82, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-  0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b,
-  0x7a, 0x79, 0x77, 0x77, 0x78, 0x77, 0x77, 0x78, 0x78, 0x78, 0x79, 0x79,
-  0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7f, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84,
-  0x84, 0x84, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x82,
-  0x83, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87,
-  0x88, 0x89, 0x89, 0x88, 0x86, 0x86, 0x85, 0x85, 0x83, 0x82, 0x82, 0x82,
-  0x81, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x80, 0x82,
-  0x83, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x7d, 0x7c, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7d, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x79,
-  0x7b, 0x7d, 0x7d, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7e,
-  0x80, 0x82, 0x82, 0x83, 0x82, 0x83, 0x85, 0x87, 0x87, 0x87, 0x87, 0x86,
-  0x85, 0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83,
-  0x83, 0x83, 0x82, 0x81, 0x82, 0x82, 0x83, 0x84, 0x83, 0x83, 0x83, 0x85,
-  0x86, 0x86, 0x85, 0x83, 0x82, 0x83, 0x84, 0x84, 0x83, 0x82, 0x82, 0x81,
-  0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x7b, 0x7b, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c,
-  0x7c, 0x7e, 0x7e, 0x7c, 0x7b, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x81, 0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7d, 0x7b, 0x7c, 0x7d, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b,
-  0x7c, 0x7e, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x82, 0x82,
-  0x84, 0x86, 0x86, 0x85, 0x84, 0x83, 0x83, 0x84, 0x84, 0x82, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x81,
-  0x81, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x83, 0x83, 0x82,
-  0x81, 0x80, 0x81, 0x81, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x84, 0x84, 0x85, 0x85, 0x84, 0x85, 0x84,
-  0x82, 0x82, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x80, 0x7f, 0x80, 0x81,
-  0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81,
-  0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x81,
-  0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7d,
-  0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7d, 0x7d, 0x7c, 0x7a, 0x7a, 0x7a, 0x7b,
-  0x7b, 0x7a, 0x7a, 0x7b, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x7f, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x82,
-  0x82, 0x83, 0x82, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82,
-  0x82, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7c, 0x7c, 0x7d, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x84, 0x83, 0x82, 0x82, 0x83,
-  0x83, 0x84, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x82, 0x82, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x84, 0x85, 0x85, 0x84, 0x83, 0x84, 0x84, 0x84, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7e,
-  0x7e, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80,
-  0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81,
-  0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81,
-  0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x83, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x81, 0x81, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x82, 0x84, 0x84, 0x84, 0x83, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7e, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7c, 0x7b, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d,
-  0x7c, 0x7c, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7f, 0x7f, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x82, 0x82,
-  0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x82, 0x82, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80,
-  0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80,
-  0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x82, 0x83,
-  0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x81, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f,
-  0x7e, 0x7e, 0x80, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x81, 0x82, 0x82, 0x83,
-  0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80,
-  0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7e,
-  0x7f, 0x81, 0x81, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7e,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82,
-  0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x83, 0x82, 0x82,
-  0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x82,
-  0x83, 0x83, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81,
-  0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82,
-  0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b,
-  0x7a, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x7e, 0x7f,
-  0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x83, 0x84, 0x83, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7e, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e,
-  0x7e, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x81,
-  0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x80, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e,
-  0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83,
-  0x83, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82,
-  0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7c,
-  0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80,
-  0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x83, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83,
-  0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-  0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83,
-  0x84, 0x84, 0x84, 0x84, 0x83, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7e,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x81,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80,
-  0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x80, 0x80, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d,
-  0x7f, 0x82, 0x80, 0x7c, 0x7a, 0x7c, 0x81, 0x83, 0x80, 0x7c, 0x7c, 0x80,
-  0x83, 0x83, 0x80, 0x7e, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x82, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x81,
-  0x80, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x82,
-  0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7c, 0x7c, 0x7b, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x82,
-  0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x81,
-  0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81,
-  0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d,
-  0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x83, 0x86, 0x84, 0x80, 0x7e, 0x81,
-  0x84, 0x86, 0x84, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x82,
-  0x83, 0x84, 0x85, 0x84, 0x82, 0x81, 0x80, 0x80, 0x82, 0x84, 0x86, 0x86,
-  0x84, 0x81, 0x81, 0x83, 0x84, 0x82, 0x80, 0x80, 0x80, 0x7e, 0x7b, 0x79,
-  0x7d, 0x82, 0x84, 0x81, 0x7e, 0x7a, 0x78, 0x7a, 0x80, 0x84, 0x82, 0x7e,
-  0x7d, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x80, 0x83, 0x82, 0x80, 0x81, 0x82,
-  0x7f, 0x7e, 0x7f, 0x81, 0x82, 0x7f, 0x7c, 0x7c, 0x7f, 0x81, 0x80, 0x7f,
-  0x80, 0x82, 0x85, 0x85, 0x81, 0x7e, 0x7d, 0x7f, 0x82, 0x84, 0x84, 0x81,
-  0x7c, 0x7c, 0x7f, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x7e,
-  0x78, 0x78, 0x80, 0x89, 0x88, 0x80, 0x7c, 0x81, 0x87, 0x89, 0x83, 0x7d,
-  0x7c, 0x80, 0x81, 0x81, 0x81, 0x83, 0x86, 0x88, 0x86, 0x83, 0x80, 0x7a,
-  0x72, 0x6e, 0x7a, 0x93, 0x9e, 0x90, 0x74, 0x6b, 0x77, 0x83, 0x89, 0x8a,
-  0x87, 0x7e, 0x76, 0x7a, 0x86, 0x90, 0x8d, 0x7f, 0x6f, 0x6a, 0x76, 0x8c,
-  0x90, 0x7e, 0x6d, 0x6d, 0x7a, 0x8a, 0x90, 0x87, 0x7a, 0x71, 0x72, 0x81,
-  0x89, 0x80, 0x79, 0x80, 0x89, 0x88, 0x82, 0x7d, 0x7e, 0x84, 0x85, 0x7b,
-  0x6b, 0x62, 0x6b, 0x81, 0x90, 0x90, 0x88, 0x81, 0x81, 0x84, 0x7e, 0x74,
-  0x73, 0x7e, 0x83, 0x7d, 0x7a, 0x81, 0x89, 0x87, 0x7b, 0x70, 0x74, 0x7b,
-  0x7a, 0x76, 0x7a, 0x80, 0x82, 0x80, 0x83, 0x8a, 0x8b, 0x84, 0x7b, 0x7a,
-  0x81, 0x82, 0x7e, 0x84, 0x90, 0x90, 0x80, 0x76, 0x7e, 0x88, 0x8b, 0x89,
-  0x85, 0x85, 0x8c, 0x88, 0x78, 0x72, 0x80, 0x8f, 0x8d, 0x7f, 0x78, 0x77,
-  0x74, 0x72, 0x7a, 0x85, 0x8d, 0x8a, 0x77, 0x68, 0x69, 0x74, 0x7b, 0x7d,
-  0x82, 0x83, 0x80, 0x7d, 0x7a, 0x74, 0x6c, 0x6d, 0x7c, 0x8c, 0x86, 0x71,
-  0x6d, 0x7c, 0x87, 0x80, 0x70, 0x6c, 0x78, 0x87, 0x86, 0x72, 0x62, 0x62,
-  0x74, 0x90, 0x9b, 0x8a, 0x6d, 0x5d, 0x65, 0x83, 0x9c, 0x96, 0x7e, 0x7a,
-  0x86, 0x8c, 0x88, 0x83, 0x88, 0x8d, 0x8b, 0x83, 0x80, 0x84, 0x84, 0x7e,
-  0x86, 0x96, 0x9a, 0x82, 0x60, 0x62, 0x8b, 0xaa, 0x9c, 0x7d, 0x74, 0x82,
-  0x90, 0x8f, 0x7e, 0x70, 0x76, 0x8a, 0x95, 0x87, 0x72, 0x6c, 0x76, 0x7e,
-  0x76, 0x6b, 0x6f, 0x7d, 0x7e, 0x78, 0x7c, 0x83, 0x7a, 0x69, 0x6b, 0x84,
-  0x8f, 0x7c, 0x64, 0x5f, 0x6d, 0x82, 0x91, 0x94, 0x8a, 0x7b, 0x73, 0x78,
-  0x86, 0x8b, 0x77, 0x62, 0x6c, 0x8b, 0x9a, 0x97, 0x96, 0x92, 0x7b, 0x6b,
-  0x7a, 0x92, 0x99, 0x8e, 0x82, 0x7f, 0x83, 0x7c, 0x6d, 0x69, 0x72, 0x82,
-  0x94, 0x9f, 0xa0, 0x8d, 0x66, 0x50, 0x67, 0x94, 0xa3, 0x8d, 0x7e, 0x84,
-  0x8c, 0x8e, 0x90, 0x8f, 0x83, 0x74, 0x78, 0x90, 0x94, 0x7d, 0x72, 0x7f,
-  0x8a, 0x89, 0x84, 0x7c, 0x70, 0x64, 0x61, 0x76, 0x99, 0xa7, 0x94, 0x7e,
-  0x7c, 0x80, 0x7e, 0x82, 0x86, 0x79, 0x60, 0x57, 0x6e, 0x99, 0xb0, 0x9f,
-  0x81, 0x71, 0x71, 0x75, 0x7b, 0x7e, 0x75, 0x61, 0x56, 0x71, 0xa1, 0xb2,
-  0x98, 0x7a, 0x71, 0x7a, 0x84, 0x84, 0x82, 0x81, 0x7c, 0x79, 0x88, 0xa2,
-  0xa6, 0x85, 0x60, 0x61, 0x82, 0x9a, 0x97, 0x87, 0x7c, 0x79, 0x7c, 0x80,
-  0x83, 0x84, 0x79, 0x68, 0x6e, 0x89, 0x98, 0x88, 0x73, 0x72, 0x7e, 0x88,
-  0x8d, 0x85, 0x6f, 0x66, 0x76, 0x8e, 0x96, 0x89, 0x77, 0x72, 0x7a, 0x82,
-  0x80, 0x7d, 0x82, 0x8a, 0x8b, 0x87, 0x86, 0x85, 0x7f, 0x77, 0x73, 0x76,
-  0x81, 0x8f, 0x94, 0x8c, 0x82, 0x7c, 0x7c, 0x80, 0x87, 0x8a, 0x85, 0x80,
-  0x79, 0x73, 0x73, 0x7a, 0x80, 0x80, 0x81, 0x84, 0x80, 0x74, 0x6a, 0x6a,
-  0x75, 0x84, 0x89, 0x85, 0x81, 0x7f, 0x82, 0x84, 0x85, 0x82, 0x80, 0x7f,
-  0x7e, 0x7c, 0x7c, 0x7e, 0x7b, 0x78, 0x7e, 0x87, 0x8c, 0x89, 0x81, 0x7b,
-  0x7c, 0x83, 0x87, 0x83, 0x7b, 0x79, 0x80, 0x88, 0x8b, 0x85, 0x79, 0x70,
-  0x72, 0x7b, 0x83, 0x83, 0x7e, 0x7a, 0x7d, 0x82, 0x86, 0x86, 0x80, 0x78,
-  0x76, 0x79, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x80, 0x7e,
-  0x7d, 0x7a, 0x76, 0x76, 0x7b, 0x84, 0x8a, 0x88, 0x84, 0x80, 0x7f, 0x82,
-  0x83, 0x82, 0x7f, 0x7d, 0x7c, 0x7c, 0x7d, 0x7f, 0x7d, 0x7c, 0x7f, 0x83,
-  0x81, 0x7d, 0x7c, 0x7f, 0x81, 0x7e, 0x7a, 0x76, 0x75, 0x79, 0x7e, 0x85,
-  0x89, 0x88, 0x83, 0x81, 0x83, 0x86, 0x85, 0x82, 0x81, 0x80, 0x82, 0x85,
-  0x86, 0x85, 0x80, 0x7e, 0x7e, 0x80, 0x82, 0x81, 0x7c, 0x76, 0x75, 0x7b,
-  0x82, 0x84, 0x82, 0x80, 0x7e, 0x7e, 0x80, 0x7e, 0x7c, 0x7b, 0x78, 0x76,
-  0x78, 0x7d, 0x80, 0x81, 0x80, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x80,
-  0x82, 0x83, 0x83, 0x81, 0x80, 0x81, 0x82, 0x80, 0x82, 0x84, 0x86, 0x85,
-  0x81, 0x7c, 0x7a, 0x7b, 0x7c, 0x7f, 0x82, 0x85, 0x86, 0x83, 0x82, 0x82,
-  0x82, 0x81, 0x7f, 0x7e, 0x7f, 0x7c, 0x7b, 0x7a, 0x7c, 0x81, 0x84, 0x84,
-  0x84, 0x82, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x81, 0x83, 0x86, 0x88, 0x89,
-  0x87, 0x85, 0x84, 0x83, 0x81, 0x7f, 0x7e, 0x7e, 0x7c, 0x7b, 0x7e, 0x83,
-  0x86, 0x88, 0x87, 0x86, 0x85, 0x83, 0x81, 0x81, 0x84, 0x83, 0x7d, 0x78,
-  0x76, 0x7b, 0x81, 0x84, 0x85, 0x83, 0x80, 0x7c, 0x7a, 0x7c, 0x80, 0x7e,
-  0x7b, 0x79, 0x79, 0x7c, 0x80, 0x85, 0x87, 0x86, 0x84, 0x84, 0x86, 0x88,
-  0x85, 0x7d, 0x76, 0x71, 0x70, 0x75, 0x7c, 0x81, 0x82, 0x81, 0x7f, 0x7e,
-  0x80, 0x80, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x83, 0x89, 0x8b, 0x8a, 0x88,
-  0x83, 0x7e, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x76, 0x78, 0x7a, 0x7d, 0x81,
-  0x84, 0x84, 0x83, 0x82, 0x83, 0x87, 0x88, 0x87, 0x85, 0x82, 0x80, 0x82,
-  0x83, 0x82, 0x80, 0x7c, 0x7b, 0x7d, 0x7f, 0x80, 0x80, 0x7e, 0x7d, 0x7e,
-  0x84, 0x8a, 0x8d, 0x8b, 0x89, 0x88, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x87,
-  0x83, 0x7e, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d, 0x80, 0x84, 0x86, 0x87, 0x89,
-  0x89, 0x87, 0x87, 0x89, 0x89, 0x87, 0x85, 0x83, 0x82, 0x83, 0x83, 0x83,
-  0x82, 0x82, 0x81, 0x7f, 0x7b, 0x79, 0x7a, 0x7d, 0x80, 0x82, 0x83, 0x82,
-  0x81, 0x82, 0x84, 0x86, 0x86, 0x84, 0x82, 0x82, 0x83, 0x86, 0x88, 0x88,
-  0x86, 0x84, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x80, 0x82, 0x83, 0x82, 0x80,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x85, 0x85,
-  0x84, 0x84, 0x83, 0x81, 0x80, 0x81, 0x82, 0x82, 0x80, 0x7c, 0x7a, 0x7c,
-  0x7e, 0x80, 0x81, 0x7f, 0x7f, 0x7f, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x83,
-  0x82, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7d, 0x7b, 0x7a, 0x7a, 0x7a,
-  0x79, 0x79, 0x7b, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x82, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x7f, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x80, 0x82, 0x82, 0x80, 0x7d, 0x7c, 0x7e, 0x81, 0x82, 0x80,
-  0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x85, 0x83, 0x7f, 0x7c, 0x7a, 0x7a, 0x7a,
-  0x7b, 0x7c, 0x7d, 0x80, 0x80, 0x81, 0x82, 0x83, 0x83, 0x82, 0x80, 0x7d,
-  0x7b, 0x7b, 0x7a, 0x79, 0x78, 0x79, 0x7a, 0x7d, 0x80, 0x82, 0x81, 0x80,
-  0x7f, 0x7f, 0x80, 0x82, 0x83, 0x81, 0x7f, 0x7e, 0x7e, 0x7f, 0x81, 0x80,
-  0x7e, 0x7c, 0x7b, 0x79, 0x79, 0x79, 0x7b, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x80, 0x7d, 0x7b, 0x7c, 0x7e, 0x7e,
-  0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x7b, 0x7d, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x80, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x83, 0x85, 0x83, 0x81, 0x7f, 0x7e,
-  0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7b,
-  0x7b, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x84, 0x82,
-  0x7f, 0x7c, 0x7a, 0x7a, 0x7c, 0x80, 0x80, 0x7e, 0x7b, 0x7a, 0x7a, 0x7c,
-  0x80, 0x83, 0x84, 0x83, 0x81, 0x80, 0x80, 0x82, 0x83, 0x83, 0x82, 0x80,
-  0x80, 0x81, 0x82, 0x82, 0x84, 0x85, 0x84, 0x82, 0x81, 0x82, 0x81, 0x80,
-  0x7e, 0x7e, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x82, 0x84, 0x85, 0x85,
-  0x84, 0x81, 0x81, 0x84, 0x88, 0x8a, 0x88, 0x84, 0x81, 0x7e, 0x7f, 0x81,
-  0x81, 0x81, 0x80, 0x7e, 0x7e, 0x80, 0x83, 0x86, 0x87, 0x85, 0x82, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x7e, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x82,
-  0x7f, 0x7e, 0x80, 0x82, 0x84, 0x84, 0x84, 0x83, 0x82, 0x83, 0x84, 0x86,
-  0x87, 0x85, 0x81, 0x80, 0x7e, 0x7f, 0x81, 0x81, 0x81, 0x80, 0x7d, 0x7d,
-  0x7e, 0x81, 0x83, 0x84, 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x7e,
-  0x7a, 0x7a, 0x7c, 0x7e, 0x81, 0x82, 0x82, 0x82, 0x80, 0x7e, 0x7d, 0x7f,
-  0x82, 0x84, 0x84, 0x83, 0x82, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-  0x7a, 0x7d, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x83,
-  0x82, 0x7f, 0x7c, 0x7c, 0x7c, 0x7e, 0x81, 0x82, 0x80, 0x7c, 0x7b, 0x7c,
-  0x7e, 0x80, 0x80, 0x7e, 0x7c, 0x79, 0x7a, 0x7c, 0x7e, 0x81, 0x82, 0x81,
-  0x81, 0x82, 0x83, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x84, 0x85, 0x84,
-  0x83, 0x82, 0x81, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x7b, 0x7a, 0x7b, 0x7c, 0x7d,
-  0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x82, 0x80, 0x7b, 0x77, 0x75, 0x74,
-  0x76, 0x78, 0x79, 0x7a, 0x7a, 0x7c, 0x80, 0x83, 0x87, 0x8c, 0x8f, 0x90,
-  0x91, 0x90, 0x8f, 0x8d, 0x8a, 0x85, 0x80, 0x7c, 0x78, 0x75, 0x72, 0x72,
-  0x72, 0x74, 0x75, 0x76, 0x78, 0x7c, 0x7e, 0x81, 0x82, 0x82, 0x81, 0x7e,
-  0x7b, 0x7a, 0x79, 0x77, 0x73, 0x6e, 0x6b, 0x69, 0x6a, 0x6d, 0x72, 0x75,
-  0x78, 0x7b, 0x7d, 0x81, 0x85, 0x88, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x8c,
-  0x81, 0x76, 0x70, 0x6d, 0x6b, 0x6c, 0x6e, 0x70, 0x6e, 0x6c, 0x73, 0x81,
-  0x8e, 0x97, 0x9e, 0xa1, 0xa2, 0xa3, 0xa6, 0xa6, 0xa5, 0xa2, 0x9d, 0x94,
-  0x8a, 0x7f, 0x77, 0x73, 0x72, 0x6f, 0x6c, 0x6a, 0x6a, 0x6c, 0x6e, 0x72,
-  0x77, 0x79, 0x78, 0x75, 0x71, 0x6b, 0x66, 0x66, 0x6a, 0x72, 0x79, 0x7e,
-  0x82, 0x87, 0x8e, 0x95, 0x9b, 0x9f, 0x9e, 0x96, 0x8c, 0x83, 0x7d, 0x7c,
-  0x7a, 0x72, 0x69, 0x62, 0x5d, 0x5c, 0x5f, 0x64, 0x68, 0x6e, 0x74, 0x7d,
-  0x8c, 0x9b, 0xa1, 0x97, 0x81, 0x70, 0x6b, 0x68, 0x67, 0x66, 0x5e, 0x53,
-  0x4e, 0x56, 0x6f, 0x85, 0x8a, 0x90, 0x9b, 0xa7, 0xb7, 0xc7, 0xd4, 0xd9,
-  0xd7, 0xd1, 0xc3, 0xb0, 0xa0, 0x95, 0x8a, 0x7b, 0x6b, 0x5f, 0x57, 0x55,
-  0x58, 0x5e, 0x66, 0x70, 0x79, 0x81, 0x87, 0x8d, 0x8c, 0x86, 0x7f, 0x7c,
-  0x7c, 0x7d, 0x7b, 0x78, 0x74, 0x72, 0x74, 0x7a, 0x82, 0x88, 0x8a, 0x8a,
-  0x87, 0x83, 0x83, 0x86, 0x87, 0x83, 0x7e, 0x79, 0x75, 0x72, 0x72, 0x74,
-  0x7a, 0x83, 0x8a, 0x87, 0x77, 0x63, 0x57, 0x55, 0x57, 0x5a, 0x5b, 0x56,
-  0x4d, 0x48, 0x51, 0x6b, 0x84, 0x8e, 0x97, 0xa5, 0xb0, 0xba, 0xca, 0xd7,
-  0xdc, 0xdd, 0xd8, 0xc8, 0xb5, 0xa5, 0x9a, 0x8e, 0x7d, 0x6d, 0x5f, 0x56,
-  0x52, 0x54, 0x5a, 0x61, 0x69, 0x71, 0x78, 0x80, 0x85, 0x86, 0x84, 0x82,
-  0x84, 0x89, 0x8c, 0x8c, 0x8a, 0x88, 0x88, 0x8a, 0x8b, 0x8c, 0x8a, 0x84,
-  0x7e, 0x79, 0x77, 0x78, 0x7b, 0x7e, 0x7e, 0x7c, 0x7b, 0x7f, 0x8a, 0x97,
-  0x9e, 0x93, 0x73, 0x52, 0x46, 0x48, 0x4f, 0x53, 0x50, 0x43, 0x35, 0x37,
-  0x54, 0x75, 0x81, 0x8a, 0x9a, 0xac, 0xb6, 0xc4, 0xdb, 0xe9, 0xe9, 0xe2,
-  0xd2, 0xba, 0xa5, 0x98, 0x8d, 0x7d, 0x69, 0x52, 0x41, 0x3c, 0x43, 0x50,
-  0x5b, 0x65, 0x6e, 0x77, 0x7e, 0x85, 0x8a, 0x8c, 0x8b, 0x8b, 0x90, 0x95,
-  0x97, 0x94, 0x8d, 0x88, 0x86, 0x86, 0x89, 0x86, 0x7e, 0x74, 0x6c, 0x6a,
-  0x6b, 0x70, 0x76, 0x7a, 0x7e, 0x87, 0x95, 0xa7, 0xb1, 0xa3, 0x7b, 0x53,
-  0x41, 0x43, 0x4d, 0x54, 0x4f, 0x3a, 0x26, 0x2c, 0x51, 0x74, 0x7f, 0x8a,
-  0xa0, 0xb8, 0xc4, 0xce, 0xe6, 0xf7, 0xf2, 0xe2, 0xc9, 0xae, 0x99, 0x8c,
-  0x7e, 0x66, 0x49, 0x30, 0x26, 0x2c, 0x3e, 0x50, 0x5a, 0x61, 0x6b, 0x79,
-  0x8c, 0xa5, 0xb7, 0xbc, 0xb7, 0xb0, 0xaa, 0xa3, 0x9a, 0x8e, 0x7c, 0x69,
-  0x5c, 0x59, 0x5a, 0x5c, 0x5c, 0x5a, 0x5a, 0x5c, 0x66, 0x78, 0x8e, 0xa4,
-  0xb7, 0xc6, 0xc6, 0xaf, 0x85, 0x62, 0x53, 0x51, 0x53, 0x4f, 0x3e, 0x26,
-  0x17, 0x1f, 0x41, 0x65, 0x75, 0x85, 0x9f, 0xb5, 0xbf, 0xd3, 0xec, 0xf8,
-  0xf4, 0xe3, 0xca, 0xad, 0x96, 0x83, 0x6d, 0x53, 0x39, 0x23, 0x1a, 0x23,
-  0x36, 0x48, 0x57, 0x66, 0x77, 0x89, 0x9a, 0xac, 0xbc, 0xc5, 0xc2, 0xb8,
-  0xad, 0x9f, 0x8f, 0x7e, 0x6c, 0x5e, 0x54, 0x4e, 0x4c, 0x4a, 0x4a, 0x4d,
-  0x55, 0x60, 0x6e, 0x7f, 0x92, 0xa8, 0xbf, 0xce, 0xc8, 0xa2, 0x6c, 0x4a,
-  0x42, 0x46, 0x4d, 0x4c, 0x38, 0x1e, 0x15, 0x2c, 0x59, 0x77, 0x8a, 0xa9,
-  0xc0, 0xbf, 0xc6, 0xe0, 0xf4, 0xf9, 0xec, 0xce, 0xab, 0x8f, 0x7a, 0x69,
-  0x57, 0x3c, 0x22, 0x13, 0x16, 0x2b, 0x47, 0x5f, 0x70, 0x7f, 0x8e, 0xa0,
-  0xb5, 0xc8, 0xd1, 0xcd, 0xc1, 0xb2, 0x9e, 0x8e, 0x81, 0x71, 0x5e, 0x4e,
-  0x47, 0x47, 0x4a, 0x4f, 0x55, 0x5b, 0x64, 0x74, 0x89, 0xa3, 0xc0, 0xd6,
-  0xd8, 0xb6, 0x7d, 0x51, 0x42, 0x48, 0x56, 0x5b, 0x4a, 0x29, 0x16, 0x25,
-  0x51, 0x7a, 0x95, 0xb7, 0xca, 0xc1, 0xc5, 0xdb, 0xf0, 0xf8, 0xed, 0xd0,
-  0xac, 0x8c, 0x77, 0x67, 0x53, 0x3b, 0x26, 0x1b, 0x1d, 0x2d, 0x49, 0x66,
-  0x7c, 0x8b, 0x9c, 0xae, 0xbd, 0xc9, 0xce, 0xcc, 0xc1, 0xaf, 0x9b, 0x86,
-  0x72, 0x61, 0x53, 0x4a, 0x48, 0x4c, 0x52, 0x55, 0x59, 0x5f, 0x6b, 0x81,
-  0xa0, 0xc3, 0xdd, 0xdb, 0xb2, 0x76, 0x4a, 0x3c, 0x4a, 0x62, 0x6a, 0x50,
-  0x26, 0x13, 0x2a, 0x5e, 0x89, 0xaa, 0xc6, 0xc7, 0xbe, 0xc8, 0xe0, 0xf4,
-  0xf8, 0xe7, 0xc5, 0xa0, 0x84, 0x70, 0x5f, 0x4d, 0x36, 0x1f, 0x12, 0x13,
-  0x22, 0x3a, 0x57, 0x75, 0x8e, 0xa1, 0xb0, 0xbf, 0xcd, 0xd4, 0xd6, 0xcf,
-  0xbf, 0xa7, 0x8e, 0x77, 0x62, 0x51, 0x45, 0x40, 0x3f, 0x40, 0x42, 0x48,
-  0x52, 0x62, 0x7c, 0x9d, 0xc0, 0xdd, 0xe4, 0xc9, 0x92, 0x5c, 0x44, 0x4a,
-  0x62, 0x74, 0x67, 0x3d, 0x15, 0x17, 0x44, 0x7d, 0xa5, 0xc1, 0xc5, 0xb5,
-  0xb4, 0xce, 0xeb, 0xf8, 0xe9, 0xc2, 0x99, 0x7c, 0x6c, 0x5f, 0x4d, 0x35,
-  0x1d, 0x12, 0x16, 0x28, 0x42, 0x5d, 0x77, 0x90, 0xa4, 0xb2, 0xbe, 0xc9,
-  0xd2, 0xd4, 0xce, 0xbf, 0xa7, 0x8b, 0x71, 0x5b, 0x4a, 0x41, 0x3c, 0x38,
-  0x33, 0x33, 0x3c, 0x49, 0x5d, 0x77, 0x92, 0xab, 0xc4, 0xdc, 0xec, 0xe2,
-  0xbc, 0x89, 0x5d, 0x45, 0x4a, 0x62, 0x6e, 0x5d, 0x36, 0x14, 0x19, 0x45,
-  0x7c, 0xa8, 0xc9, 0xce, 0xb9, 0xae, 0xbe, 0xdb, 0xf1, 0xea, 0xc0, 0x8c,
-  0x66, 0x55, 0x4f, 0x4d, 0x40, 0x2a, 0x17, 0x1b, 0x37, 0x5c, 0x83, 0x9f,
-  0xa8, 0xa7, 0xab, 0xb6, 0xc8, 0xd6, 0xd6, 0xc1, 0xa2, 0x83, 0x6e, 0x63,
-  0x5b, 0x51, 0x46, 0x3a, 0x34, 0x38, 0x45, 0x53, 0x62, 0x75, 0x8d, 0xaa,
-  0xc9, 0xe2, 0xe5, 0xc9, 0x95, 0x62, 0x45, 0x47, 0x5f, 0x71, 0x69, 0x48,
-  0x22, 0x19, 0x37, 0x6d, 0xa1, 0xc6, 0xd6, 0xc8, 0xb7, 0xbc, 0xd3, 0xea,
-  0xed, 0xd3, 0xa7, 0x7d, 0x62, 0x54, 0x4e, 0x43, 0x31, 0x1e, 0x1a, 0x2a,
-  0x45, 0x64, 0x81, 0x98, 0xa3, 0xac, 0xb6, 0xc4, 0xd2, 0xd8, 0xd4, 0xc3,
-  0xaa, 0x90, 0x7b, 0x68, 0x5a, 0x4e, 0x44, 0x3a, 0x33, 0x33, 0x39, 0x44,
-  0x54, 0x6a, 0x85, 0xa2, 0xbf, 0xd8, 0xe6, 0xdc, 0xb9, 0x8d, 0x67, 0x54,
-  0x57, 0x68, 0x6e, 0x5e, 0x41, 0x29, 0x2b, 0x4c, 0x80, 0xb0, 0xcc, 0xd3,
-  0xc8, 0xbe, 0xc4, 0xd5, 0xe1, 0xdb, 0xbb, 0x90, 0x69, 0x4f, 0x44, 0x41,
-  0x3c, 0x33, 0x2a, 0x2d, 0x42, 0x62, 0x83, 0xa0, 0xb0, 0xb2, 0xb0, 0xb5,
-  0xc1, 0xce, 0xd1, 0xc2, 0xa4, 0x85, 0x6f, 0x62, 0x5d, 0x5c, 0x54, 0x43,
-  0x33, 0x2f, 0x37, 0x48, 0x60, 0x79, 0x94, 0xb0, 0xcb, 0xda, 0xd3, 0xb0,
-  0x80, 0x57, 0x46, 0x52, 0x6d, 0x7c, 0x6e, 0x47, 0x25, 0x24, 0x48, 0x81,
-  0xb3, 0xd0, 0xd4, 0xc1, 0xb4, 0xbb, 0xd2, 0xe4, 0xe2, 0xc5, 0x9a, 0x76,
-  0x5f, 0x53, 0x4b, 0x40, 0x30, 0x24, 0x28, 0x3c, 0x59, 0x77, 0x8f, 0x9f,
-  0xa8, 0xaf, 0xb9, 0xc6, 0xd2, 0xd2, 0xc5, 0xad, 0x92, 0x7d, 0x6d, 0x62,
-  0x5a, 0x51, 0x46, 0x3c, 0x38, 0x3d, 0x48, 0x58, 0x6c, 0x86, 0xa4, 0xc2,
-  0xd7, 0xd8, 0xbc, 0x8b, 0x5e, 0x48, 0x50, 0x6c, 0x81, 0x7b, 0x5b, 0x36,
-  0x2e, 0x4a, 0x7c, 0xae, 0xd2, 0xde, 0xd2, 0xbd, 0xb6, 0xc1, 0xd1, 0xd6,
-  0xc6, 0xa1, 0x7a, 0x5f, 0x50, 0x48, 0x43, 0x3d, 0x36, 0x35, 0x41, 0x58,
-  0x73, 0x8c, 0xa2, 0xaf, 0xb2, 0xb2, 0xb8, 0xc1, 0xc7, 0xc2, 0xaf, 0x96,
-  0x7c, 0x69, 0x5f, 0x5e, 0x5d, 0x55, 0x48, 0x3f, 0x40, 0x49, 0x5a, 0x72,
-  0x8c, 0xa4, 0xbb, 0xcd, 0xd1, 0xbe, 0x97, 0x6a, 0x4b, 0x48, 0x5c, 0x73,
-  0x77, 0x62, 0x3e, 0x28, 0x35, 0x61, 0x99, 0xc3, 0xd4, 0xc9, 0xb3, 0xaa,
-  0xb6, 0xca, 0xd6, 0xca, 0xa7, 0x7e, 0x61, 0x50, 0x49, 0x45, 0x3a, 0x2e,
-  0x2b, 0x36, 0x4d, 0x69, 0x82, 0x95, 0xa0, 0xa5, 0xab, 0xb4, 0xc0, 0xc9,
-  0xc6, 0xb5, 0x9c, 0x84, 0x72, 0x66, 0x5e, 0x57, 0x4c, 0x3e, 0x30, 0x2e,
-  0x38, 0x46, 0x57, 0x6b, 0x7e, 0x90, 0xa3, 0xb8, 0xcd, 0xd5, 0xca, 0xab,
-  0x82, 0x61, 0x52, 0x55, 0x60, 0x63, 0x58, 0x44, 0x36, 0x3b, 0x56, 0x7a,
-  0x9e, 0xba, 0xc3, 0xbf, 0xb6, 0xb2, 0xb4, 0xb6, 0xaf, 0x9d, 0x81, 0x65,
-  0x50, 0x43, 0x3c, 0x39, 0x39, 0x3d, 0x46, 0x56, 0x6c, 0x85, 0x99, 0xa3,
-  0xa5, 0xa6, 0xa9, 0xab, 0xad, 0xac, 0xa3, 0x92, 0x7d, 0x6c, 0x61, 0x5d,
-  0x5d, 0x5f, 0x5e, 0x59, 0x54, 0x55, 0x5e, 0x6c, 0x80, 0x97, 0xae, 0xc0,
-  0xc6, 0xb6, 0x8f, 0x62, 0x43, 0x3b, 0x4c, 0x66, 0x73, 0x68, 0x49, 0x2c,
-  0x30, 0x56, 0x8d, 0xbb, 0xd2, 0xd0, 0xba, 0xab, 0xb3, 0xc9, 0xd9, 0xd2,
-  0xb1, 0x88, 0x68, 0x57, 0x52, 0x4d, 0x40, 0x31, 0x29, 0x30, 0x44, 0x60,
-  0x79, 0x8a, 0x90, 0x95, 0xa0, 0xad, 0xb9, 0xc2, 0xc2, 0xb7, 0xa5, 0x92,
-  0x83, 0x7a, 0x73, 0x6a, 0x60, 0x55, 0x4a, 0x41, 0x40, 0x48, 0x55, 0x64,
-  0x76, 0x8a, 0x9d, 0xad, 0xb5, 0xac, 0x93, 0x74, 0x59, 0x4b, 0x50, 0x61,
-  0x70, 0x75, 0x6f, 0x63, 0x5e, 0x6c, 0x8a, 0xac, 0xc8, 0xd6, 0xd4, 0xc8,
-  0xba, 0xb0, 0xab, 0xa6, 0x9c, 0x8c, 0x75, 0x5e, 0x4a, 0x3d, 0x3a, 0x3e,
-  0x47, 0x54, 0x61, 0x6c, 0x78, 0x86, 0x96, 0xa3, 0xac, 0xb2, 0xb3, 0xb0,
-  0xac, 0xa6, 0x9f, 0x93, 0x83, 0x73, 0x67, 0x5f, 0x60, 0x64, 0x64, 0x62,
-  0x5e, 0x5c, 0x62, 0x6e, 0x80, 0x92, 0xa2, 0xb0, 0xb8, 0xb2, 0x9b, 0x7b,
-  0x5c, 0x49, 0x47, 0x55, 0x64, 0x69, 0x62, 0x54, 0x4e, 0x5c, 0x7a, 0x9e,
-  0xbd, 0xcd, 0xce, 0xc6, 0xbd, 0xb7, 0xb3, 0xae, 0xa3, 0x90, 0x7a, 0x64,
-  0x50, 0x43, 0x3c, 0x3b, 0x3f, 0x4a, 0x57, 0x65, 0x73, 0x82, 0x90, 0x9e,
-  0xaa, 0xb1, 0xb4, 0xb5, 0xb2, 0xae, 0xaa, 0xa2, 0x94, 0x81, 0x71, 0x67,
-  0x5f, 0x5a, 0x57, 0x50, 0x47, 0x44, 0x49, 0x53, 0x62, 0x73, 0x83, 0x92,
-  0x9f, 0xad, 0xbc, 0xc6, 0xc5, 0xb2, 0x90, 0x6c, 0x53, 0x4d, 0x55, 0x60,
-  0x64, 0x5d, 0x50, 0x49, 0x52, 0x6c, 0x8e, 0xac, 0xc1, 0xc6, 0xbf, 0xb7,
-  0xb1, 0xad, 0xaa, 0xa2, 0x8f, 0x76, 0x5f, 0x4f, 0x46, 0x42, 0x40, 0x40,
-  0x44, 0x4e, 0x5f, 0x74, 0x89, 0x9a, 0xa3, 0xa4, 0xa4, 0xa6, 0xaa, 0xb1,
-  0xb3, 0xac, 0x9d, 0x89, 0x76, 0x6b, 0x69, 0x6a, 0x6b, 0x68, 0x61, 0x5a,
-  0x58, 0x5e, 0x6a, 0x78, 0x86, 0x93, 0x9e, 0xa7, 0xab, 0xa2, 0x86, 0x62,
-  0x46, 0x3e, 0x47, 0x5a, 0x6c, 0x70, 0x63, 0x54, 0x57, 0x72, 0x9c, 0xc6,
-  0xdd, 0xde, 0xd0, 0xbf, 0xb7, 0xba, 0xbe, 0xb7, 0x9d, 0x79, 0x5b, 0x48,
-  0x43, 0x43, 0x42, 0x3f, 0x3d, 0x45, 0x58, 0x74, 0x8f, 0xa3, 0xac, 0xaa,
-  0xa5, 0xa6, 0xae, 0xb8, 0xbb, 0xb2, 0x9f, 0x87, 0x74, 0x6a, 0x69, 0x6d,
-  0x6e, 0x66, 0x59, 0x4f, 0x4e, 0x56, 0x64, 0x75, 0x82, 0x88, 0x8a, 0x8e,
-  0x9d, 0xb1, 0xbf, 0xbc, 0xa0, 0x76, 0x4f, 0x3c, 0x40, 0x57, 0x6d, 0x75,
-  0x69, 0x54, 0x4b, 0x5d, 0x84, 0xae, 0xcc, 0xd4, 0xce, 0xc0, 0xb8, 0xb8,
-  0xbb, 0xb8, 0xa4, 0x86, 0x69, 0x56, 0x50, 0x4f, 0x4b, 0x43, 0x3d, 0x40,
-  0x4f, 0x69, 0x85, 0x9a, 0xa5, 0xa6, 0xa4, 0xa6, 0xad, 0xb4, 0xb6, 0xaf,
-  0xa2, 0x90, 0x7f, 0x72, 0x69, 0x64, 0x62, 0x61, 0x5f, 0x5e, 0x5e, 0x62,
-  0x6a, 0x74, 0x80, 0x8d, 0x9a, 0xa6, 0xb4, 0xbf, 0xbd, 0xa6, 0x7e, 0x56,
-  0x3b, 0x37, 0x49, 0x61, 0x6b, 0x5f, 0x44, 0x34, 0x45, 0x74, 0xa9, 0xce,
-  0xdb, 0xd0, 0xb7, 0xab, 0xb6, 0xcc, 0xd7, 0xc5, 0x97, 0x66, 0x49, 0x44,
-  0x4e, 0x56, 0x50, 0x3f, 0x31, 0x38, 0x56, 0x7b, 0x9c, 0xb0, 0xb0, 0xa2,
-  0x97, 0x9c, 0xad, 0xbe, 0xc3, 0xb4, 0x94, 0x75, 0x64, 0x61, 0x6a, 0x74,
-  0x73, 0x67, 0x56, 0x4d, 0x53, 0x62, 0x73, 0x82, 0x88, 0x86, 0x83, 0x86,
-  0x92, 0xa0, 0xa7, 0x9d, 0x80, 0x5b, 0x3f, 0x35, 0x3f, 0x55, 0x6a, 0x74,
-  0x72, 0x67, 0x67, 0x7a, 0x9b, 0xbd, 0xd6, 0xde, 0xd4, 0xc2, 0xb1, 0xa9,
-  0xa7, 0xa2, 0x8f, 0x72, 0x55, 0x44, 0x41, 0x48, 0x4f, 0x52, 0x50, 0x52,
-  0x5f, 0x78, 0x94, 0xaa, 0xb2, 0xac, 0xa1, 0x99, 0x99, 0x9f, 0xa2, 0x9b,
-  0x8a, 0x77, 0x68, 0x5f, 0x5f, 0x62, 0x66, 0x6a, 0x6d, 0x70, 0x73, 0x79,
-  0x7e, 0x84, 0x88, 0x8c, 0x8f, 0x95, 0x9b, 0xa2, 0xa6, 0x9f, 0x86, 0x64,
-  0x46, 0x33, 0x32, 0x44, 0x5c, 0x6d, 0x6f, 0x65, 0x5b, 0x64, 0x83, 0xa9,
-  0xca, 0xdb, 0xd7, 0xc6, 0xb2, 0xa6, 0xa6, 0xa6, 0x9c, 0x83, 0x64, 0x4c,
-  0x44, 0x45, 0x4c, 0x54, 0x58, 0x58, 0x5c, 0x6b, 0x81, 0x96, 0xa6, 0xae,
-  0xa9, 0x9b, 0x90, 0x8e, 0x93, 0x9a, 0x9c, 0x95, 0x88, 0x79, 0x6d, 0x69,
-  0x6e, 0x78, 0x7f, 0x7e, 0x74, 0x69, 0x64, 0x69, 0x72, 0x7c, 0x81, 0x7d,
-  0x78, 0x7c, 0x8c, 0xa0, 0xb0, 0xae, 0x90, 0x64, 0x43, 0x38, 0x45, 0x60,
-  0x75, 0x7c, 0x71, 0x5e, 0x57, 0x6a, 0x8f, 0xb3, 0xca, 0xce, 0xbf, 0xac,
-  0x9f, 0x9d, 0x9f, 0x9c, 0x8c, 0x72, 0x5a, 0x4c, 0x49, 0x50, 0x5a, 0x5e,
-  0x5e, 0x5f, 0x66, 0x73, 0x83, 0x92, 0x9c, 0x9f, 0x9a, 0x8f, 0x84, 0x7e,
-  0x83, 0x8a, 0x8e, 0x8e, 0x89, 0x7e, 0x72, 0x6c, 0x6c, 0x71, 0x78, 0x7a,
-  0x74, 0x6a, 0x65, 0x65, 0x6a, 0x73, 0x7b, 0x84, 0x8e, 0x9a, 0xa4, 0xa5,
-  0x93, 0x6d, 0x47, 0x32, 0x33, 0x47, 0x64, 0x78, 0x77, 0x62, 0x4d, 0x55,
-  0x7c, 0xb0, 0xd8, 0xe5, 0xda, 0xbc, 0x9f, 0x97, 0xa6, 0xb6, 0xb3, 0x93,
-  0x62, 0x3c, 0x2f, 0x3b, 0x57, 0x6f, 0x76, 0x6a, 0x5b, 0x5b, 0x72, 0x94,
-  0xb2, 0xbe, 0xae, 0x8a, 0x65, 0x58, 0x69, 0x8a, 0xa1, 0xa2, 0x8e, 0x72,
-  0x61, 0x67, 0x7d, 0x91, 0x9a, 0x94, 0x7e, 0x66, 0x5d, 0x66, 0x76, 0x81,
-  0x80, 0x74, 0x68, 0x6d, 0x81, 0x96, 0xa0, 0x92, 0x68, 0x3e, 0x28, 0x2c,
-  0x48, 0x6d, 0x8a, 0x8c, 0x73, 0x57, 0x59, 0x7e, 0xb0, 0xd6, 0xe7, 0xde,
-  0xc2, 0xa4, 0x97, 0x9d, 0xa8, 0xa8, 0x94, 0x6d, 0x48, 0x37, 0x3e, 0x52,
-  0x6a, 0x7a, 0x7c, 0x75, 0x70, 0x77, 0x89, 0x9e, 0xae, 0xb0, 0xa2, 0x8b,
-  0x74, 0x69, 0x70, 0x7e, 0x8a, 0x8e, 0x8b, 0x7f, 0x73, 0x6e, 0x71, 0x7a,
-  0x83, 0x88, 0x84, 0x7c, 0x76, 0x73, 0x78, 0x84, 0x90, 0x9c, 0xaa, 0xb3,
-  0xb0, 0x9a, 0x73, 0x4b, 0x30, 0x29, 0x36, 0x50, 0x64, 0x68, 0x56, 0x40,
-  0x43, 0x68, 0xa0, 0xd1, 0xea, 0xe6, 0xc7, 0xa1, 0x94, 0xa9, 0xc9, 0xd1,
-  0xb4, 0x7a, 0x43, 0x25, 0x2a, 0x4e, 0x7c, 0x99, 0x96, 0x72, 0x4e, 0x4c,
-  0x70, 0xa1, 0xc6, 0xd0, 0xb1, 0x74, 0x41, 0x38, 0x5f, 0x95, 0xb9, 0xb8,
-  0x97, 0x6b, 0x55, 0x62, 0x85, 0xa5, 0xb1, 0xa3, 0x81, 0x61, 0x58, 0x69,
-  0x82, 0x94, 0x96, 0x86, 0x74, 0x72, 0x82, 0x93, 0x94, 0x7b, 0x52, 0x31,
-  0x25, 0x2d, 0x47, 0x64, 0x7b, 0x82, 0x78, 0x71, 0x7d, 0x9c, 0xc2, 0xe0,
-  0xee, 0xe4, 0xcc, 0xad, 0x97, 0x8f, 0x8e, 0x8a, 0x7e, 0x67, 0x4b, 0x3b,
-  0x40, 0x53, 0x6c, 0x83, 0x92, 0x94, 0x8c, 0x86, 0x88, 0x90, 0x9a, 0x9e,
-  0x98, 0x82, 0x68, 0x5a, 0x5f, 0x6f, 0x82, 0x92, 0x9a, 0x96, 0x8b, 0x82,
-  0x7c, 0x7e, 0x87, 0x8e, 0x90, 0x8c, 0x82, 0x76, 0x70, 0x70, 0x77, 0x82,
-  0x91, 0xa1, 0xa9, 0xa1, 0x85, 0x5f, 0x40, 0x2f, 0x2f, 0x42, 0x5c, 0x71,
-  0x79, 0x72, 0x66, 0x6b, 0x86, 0xad, 0xd2, 0xea, 0xea, 0xd3, 0xad, 0x8c,
-  0x81, 0x89, 0x95, 0x95, 0x82, 0x5d, 0x3a, 0x2d, 0x3d, 0x62, 0x89, 0xa6,
-  0xad, 0x98, 0x76, 0x61, 0x66, 0x81, 0x9f, 0xad, 0xa1, 0x7c, 0x54, 0x47,
-  0x5a, 0x7d, 0x9d, 0xb1, 0xb0, 0x9c, 0x83, 0x73, 0x76, 0x83, 0x90, 0x94,
-  0x89, 0x74, 0x5f, 0x55, 0x5a, 0x67, 0x74, 0x7d, 0x86, 0x91, 0x9c, 0xa2,
-  0x9b, 0x84, 0x64, 0x46, 0x36, 0x36, 0x47, 0x61, 0x77, 0x84, 0x84, 0x7e,
-  0x83, 0x98, 0xb6, 0xd1, 0xde, 0xda, 0xc6, 0xa8, 0x8d, 0x7a, 0x73, 0x72,
-  0x70, 0x68, 0x5e, 0x54, 0x51, 0x5a, 0x6c, 0x85, 0x9c, 0xa9, 0xa7, 0x96,
-  0x7e, 0x6a, 0x65, 0x6e, 0x78, 0x7a, 0x74, 0x68, 0x62, 0x68, 0x7c, 0x95,
-  0xab, 0xb8, 0xb4, 0xa0, 0x88, 0x78, 0x75, 0x7e, 0x89, 0x8b, 0x86, 0x78,
-  0x68, 0x61, 0x67, 0x7a, 0x95, 0xac, 0xb4, 0xa0, 0x71, 0x40, 0x23, 0x1d,
-  0x30, 0x54, 0x76, 0x89, 0x7b, 0x59, 0x4e, 0x6c, 0xa6, 0xdc, 0xfb, 0xf8,
-  0xd2, 0x98, 0x6c, 0x64, 0x7d, 0x9f, 0xac, 0x96, 0x66, 0x37, 0x28, 0x40,
-  0x70, 0xa2, 0xc7, 0xca, 0xa8, 0x77, 0x54, 0x4e, 0x62, 0x7c, 0x8a, 0x80,
-  0x63, 0x49, 0x48, 0x60, 0x80, 0x9e, 0xb4, 0xbd, 0xb6, 0xa2, 0x8c, 0x7c,
-  0x76, 0x77, 0x7a, 0x7e, 0x7c, 0x74, 0x66, 0x59, 0x54, 0x5f, 0x77, 0x95,
-  0xae, 0xb8, 0xa5, 0x77, 0x47, 0x28, 0x1e, 0x2c, 0x4c, 0x6e, 0x83, 0x82,
-  0x6f, 0x60, 0x6e, 0x94, 0xc2, 0xe6, 0xf2, 0xdf, 0xb2, 0x81, 0x62, 0x5e,
-  0x71, 0x87, 0x8f, 0x82, 0x67, 0x4f, 0x4b, 0x5f, 0x81, 0xa2, 0xb9, 0xba,
-  0xa2, 0x7d, 0x5d, 0x4e, 0x53, 0x64, 0x74, 0x79, 0x73, 0x69, 0x64, 0x6c,
-  0x80, 0x98, 0xad, 0xb8, 0xb3, 0x9d, 0x7e, 0x66, 0x5b, 0x62, 0x73, 0x83,
-  0x8c, 0x88, 0x7b, 0x6d, 0x6c, 0x7d, 0x9a, 0xb6, 0xc2, 0xae, 0x79, 0x41,
-  0x1c, 0x0f, 0x21, 0x4c, 0x7b, 0x96, 0x8a, 0x60, 0x44, 0x59, 0x91, 0xcc,
-  0xf3, 0xf8, 0xd5, 0x96, 0x60, 0x4d, 0x60, 0x84, 0xa1, 0xa7, 0x90, 0x6b,
-  0x54, 0x5c, 0x7c, 0xa3, 0xc1, 0xc8, 0xae, 0x83, 0x5e, 0x4e, 0x4f, 0x57,
-  0x5d, 0x60, 0x61, 0x67, 0x75, 0x83, 0x8c, 0x90, 0x94, 0x9e, 0xaf, 0xb6,
-  0xa7, 0x8f, 0x73, 0x60, 0x5f, 0x70, 0x87, 0x96, 0x96, 0x85, 0x6b, 0x5f,
-  0x6c, 0x89, 0xa6, 0xb7, 0xab, 0x7f, 0x4b, 0x24, 0x15, 0x1f, 0x3f, 0x68,
-  0x8d, 0x9e, 0x92, 0x77, 0x6e, 0x84, 0xaa, 0xcf, 0xe0, 0xd5, 0xae, 0x7d,
-  0x5a, 0x4e, 0x5e, 0x7b, 0x94, 0xa0, 0x9b, 0x8a, 0x79, 0x76, 0x83, 0x97,
-  0xa6, 0xa8, 0x95, 0x76, 0x59, 0x48, 0x47, 0x52, 0x61, 0x72, 0x81, 0x8c,
-  0x91, 0x8f, 0x8c, 0x8c, 0x8f, 0x96, 0x9c, 0x9d, 0x94, 0x84, 0x71, 0x67,
-  0x6c, 0x7b, 0x8e, 0x9b, 0x9c, 0x92, 0x84, 0x7e, 0x84, 0x96, 0xa9, 0xaa,
-  0x90, 0x60, 0x32, 0x18, 0x1a, 0x38, 0x66, 0x91, 0xa6, 0x96, 0x71, 0x5f,
-  0x72, 0x9d, 0xc6, 0xda, 0xce, 0xa3, 0x70, 0x50, 0x4e, 0x65, 0x85, 0xa0,
-  0xa9, 0x9f, 0x8a, 0x79, 0x7b, 0x8e, 0xa2, 0xac, 0xa3, 0x86, 0x67, 0x57,
-  0x56, 0x5b, 0x5d, 0x5b, 0x59, 0x60, 0x74, 0x89, 0x97, 0x97, 0x8f, 0x85,
-  0x80, 0x85, 0x8f, 0x94, 0x91, 0x84, 0x72, 0x69, 0x6f, 0x81, 0x92, 0x96,
-  0x8e, 0x7e, 0x72, 0x75, 0x84, 0x96, 0x9e, 0x8f, 0x66, 0x38, 0x1a, 0x16,
-  0x30, 0x5a, 0x84, 0x99, 0x8d, 0x6c, 0x5a, 0x69, 0x91, 0xba, 0xd1, 0xca,
-  0xa5, 0x75, 0x57, 0x58, 0x71, 0x90, 0xa5, 0xab, 0x9f, 0x8b, 0x7d, 0x81,
-  0x92, 0xa3, 0xaa, 0x9f, 0x86, 0x6b, 0x5e, 0x61, 0x6a, 0x6e, 0x68, 0x5d,
-  0x58, 0x61, 0x75, 0x87, 0x90, 0x8c, 0x82, 0x7b, 0x7e, 0x88, 0x92, 0x92,
-  0x88, 0x79, 0x6f, 0x74, 0x84, 0x95, 0x9c, 0x94, 0x80, 0x70, 0x70, 0x7e,
-  0x92, 0xa2, 0xa5, 0x92, 0x6c, 0x45, 0x2c, 0x2f, 0x4e, 0x77, 0x96, 0x9e,
-  0x86, 0x65, 0x5c, 0x74, 0x98, 0xb4, 0xbb, 0xa7, 0x86, 0x69, 0x5f, 0x6a,
-  0x7f, 0x94, 0xa2, 0xa1, 0x96, 0x8a, 0x84, 0x8a, 0x95, 0x9e, 0xa0, 0x98,
-  0x88, 0x78, 0x71, 0x74, 0x78, 0x75, 0x70, 0x6c, 0x6e, 0x78, 0x83, 0x88,
-  0x87, 0x83, 0x80, 0x7e, 0x80, 0x81, 0x82, 0x7e, 0x78, 0x73, 0x74, 0x7d,
-  0x88, 0x8e, 0x8c, 0x81, 0x73, 0x6f, 0x76, 0x83, 0x8e, 0x95, 0x93, 0x88,
-  0x76, 0x65, 0x5d, 0x66, 0x79, 0x8e, 0x96, 0x90, 0x7d, 0x6b, 0x6a, 0x79,
-  0x8b, 0x94, 0x93, 0x88, 0x7a, 0x71, 0x71, 0x75, 0x7c, 0x83, 0x89, 0x8b,
-  0x88, 0x82, 0x7f, 0x83, 0x8b, 0x92, 0x96, 0x94, 0x8e, 0x88, 0x86, 0x86,
-  0x86, 0x86, 0x85, 0x83, 0x81, 0x82, 0x86, 0x8a, 0x8c, 0x8e, 0x8c, 0x88,
-  0x82, 0x7f, 0x81, 0x7f, 0x7b, 0x78, 0x78, 0x7b, 0x7e, 0x83, 0x84, 0x80,
-  0x79, 0x76, 0x77, 0x7a, 0x7e, 0x84, 0x86, 0x84, 0x7f, 0x77, 0x6e, 0x6a,
-  0x6b, 0x70, 0x77, 0x7a, 0x76, 0x71, 0x70, 0x76, 0x7e, 0x85, 0x86, 0x81,
-  0x7b, 0x78, 0x78, 0x79, 0x7c, 0x82, 0x86, 0x89, 0x88, 0x85, 0x84, 0x87,
-  0x8d, 0x92, 0x95, 0x92, 0x8f, 0x8d, 0x8c, 0x8d, 0x8d, 0x8e, 0x8b, 0x86,
-  0x84, 0x85, 0x88, 0x8d, 0x92, 0x94, 0x91, 0x8a, 0x84, 0x82, 0x86, 0x8a,
-  0x88, 0x82, 0x7c, 0x7b, 0x80, 0x86, 0x87, 0x86, 0x81, 0x7b, 0x77, 0x77,
-  0x7b, 0x81, 0x85, 0x85, 0x83, 0x7d, 0x75, 0x6f, 0x6b, 0x6a, 0x6c, 0x70,
-  0x72, 0x70, 0x6e, 0x6e, 0x73, 0x7c, 0x82, 0x83, 0x7f, 0x79, 0x76, 0x75,
-  0x76, 0x78, 0x7c, 0x82, 0x86, 0x86, 0x83, 0x83, 0x85, 0x8a, 0x90, 0x92,
-  0x8f, 0x8c, 0x8c, 0x8d, 0x8d, 0x8b, 0x88, 0x85, 0x84, 0x86, 0x87, 0x87,
-  0x88, 0x8c, 0x90, 0x92, 0x90, 0x8c, 0x88, 0x87, 0x88, 0x87, 0x82, 0x7d,
-  0x7d, 0x83, 0x88, 0x89, 0x86, 0x81, 0x7f, 0x80, 0x80, 0x7e, 0x7b, 0x7a,
-  0x7c, 0x7c, 0x7b, 0x78, 0x74, 0x6f, 0x6a, 0x65, 0x63, 0x66, 0x6c, 0x72,
-  0x72, 0x72, 0x73, 0x76, 0x7a, 0x7a, 0x78, 0x77, 0x78, 0x7a, 0x78, 0x76,
-  0x75, 0x7a, 0x82, 0x88, 0x88, 0x86, 0x85, 0x87, 0x8c, 0x8f, 0x8f, 0x8e,
-  0x8e, 0x8f, 0x8d, 0x8a, 0x87, 0x87, 0x8b, 0x8e, 0x8b, 0x87, 0x87, 0x8c,
-  0x95, 0x9a, 0x95, 0x8c, 0x86, 0x84, 0x84, 0x83, 0x80, 0x7e, 0x80, 0x83,
-  0x83, 0x80, 0x7b, 0x7a, 0x7e, 0x82, 0x7d, 0x75, 0x70, 0x71, 0x75, 0x79,
-  0x79, 0x77, 0x75, 0x71, 0x6a, 0x63, 0x60, 0x64, 0x6d, 0x72, 0x72, 0x6e,
-  0x6c, 0x70, 0x75, 0x77, 0x76, 0x75, 0x76, 0x77, 0x76, 0x72, 0x73, 0x7a,
-  0x83, 0x88, 0x88, 0x84, 0x82, 0x85, 0x89, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d,
-  0x8c, 0x87, 0x84, 0x86, 0x8a, 0x8e, 0x8e, 0x8b, 0x89, 0x8c, 0x90, 0x91,
-  0x8e, 0x8a, 0x88, 0x88, 0x87, 0x84, 0x7f, 0x7b, 0x7b, 0x7e, 0x81, 0x81,
-  0x80, 0x7d, 0x7d, 0x7c, 0x78, 0x74, 0x71, 0x72, 0x76, 0x79, 0x78, 0x75,
-  0x72, 0x73, 0x73, 0x70, 0x6a, 0x64, 0x63, 0x68, 0x6e, 0x71, 0x70, 0x70,
-  0x74, 0x78, 0x78, 0x75, 0x72, 0x74, 0x78, 0x7a, 0x77, 0x73, 0x75, 0x7d,
-  0x85, 0x87, 0x85, 0x82, 0x84, 0x89, 0x8c, 0x8d, 0x8c, 0x8e, 0x90, 0x91,
-  0x8d, 0x8a, 0x8a, 0x8f, 0x92, 0x91, 0x8e, 0x8c, 0x8e, 0x92, 0x94, 0x92,
-  0x8e, 0x89, 0x85, 0x83, 0x80, 0x7e, 0x7d, 0x80, 0x82, 0x83, 0x82, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7c, 0x78, 0x76, 0x76, 0x76, 0x76, 0x75, 0x74, 0x76,
-  0x78, 0x77, 0x71, 0x6a, 0x66, 0x69, 0x6e, 0x72, 0x74, 0x73, 0x72, 0x73,
-  0x74, 0x72, 0x71, 0x74, 0x77, 0x79, 0x76, 0x72, 0x73, 0x7a, 0x83, 0x89,
-  0x88, 0x85, 0x84, 0x87, 0x8a, 0x8c, 0x8b, 0x8b, 0x8d, 0x8f, 0x8f, 0x8d,
-  0x8c, 0x8e, 0x92, 0x93, 0x91, 0x8e, 0x8e, 0x91, 0x94, 0x93, 0x8e, 0x88,
-  0x84, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x83, 0x82, 0x81, 0x81, 0x83,
-  0x84, 0x82, 0x7d, 0x77, 0x75, 0x76, 0x79, 0x7a, 0x78, 0x76, 0x76, 0x77,
-  0x76, 0x72, 0x6d, 0x6a, 0x69, 0x6b, 0x6e, 0x70, 0x70, 0x71, 0x72, 0x72,
-  0x73, 0x74, 0x77, 0x7b, 0x7d, 0x7d, 0x7c, 0x7a, 0x7d, 0x84, 0x8a, 0x8b,
-  0x8a, 0x88, 0x89, 0x8b, 0x8c, 0x8f, 0x92, 0x95, 0x97, 0x96, 0x93, 0x91,
-  0x92, 0x95, 0x97, 0x96, 0x92, 0x8e, 0x8d, 0x8e, 0x90, 0x90, 0x8e, 0x8c,
-  0x8b, 0x8a, 0x87, 0x85, 0x84, 0x86, 0x89, 0x8b, 0x8a, 0x87, 0x84, 0x82,
-  0x80, 0x7d, 0x79, 0x77, 0x77, 0x77, 0x77, 0x75, 0x74, 0x76, 0x78, 0x7a,
-  0x78, 0x73, 0x6e, 0x6a, 0x68, 0x69, 0x6b, 0x6e, 0x70, 0x71, 0x72, 0x72,
-  0x71, 0x72, 0x74, 0x77, 0x79, 0x7a, 0x79, 0x78, 0x79, 0x7d, 0x83, 0x86,
-  0x88, 0x8a, 0x8b, 0x8e, 0x90, 0x90, 0x90, 0x91, 0x92, 0x92, 0x92, 0x90,
-  0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8e, 0x90, 0x93, 0x94, 0x92, 0x8e, 0x8a,
-  0x88, 0x8a, 0x8b, 0x8a, 0x87, 0x84, 0x82, 0x81, 0x80, 0x80, 0x82, 0x82,
-  0x82, 0x7c, 0x77, 0x74, 0x76, 0x78, 0x79, 0x77, 0x75, 0x74, 0x74, 0x74,
-  0x73, 0x72, 0x70, 0x6f, 0x6c, 0x68, 0x68, 0x6b, 0x6e, 0x71, 0x71, 0x6f,
-  0x6f, 0x70, 0x71, 0x72, 0x73, 0x75, 0x76, 0x76, 0x76, 0x7a, 0x80, 0x87,
-  0x8b, 0x8c, 0x8b, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8e, 0x8e, 0x8c, 0x8b,
-  0x8a, 0x8c, 0x90, 0x95, 0x95, 0x92, 0x8f, 0x8e, 0x8e, 0x90, 0x90, 0x8e,
-  0x8b, 0x88, 0x84, 0x81, 0x80, 0x80, 0x82, 0x84, 0x85, 0x84, 0x81, 0x7e,
-  0x7d, 0x7c, 0x7a, 0x78, 0x78, 0x76, 0x74, 0x71, 0x6e, 0x6e, 0x6f, 0x71,
-  0x72, 0x72, 0x71, 0x6f, 0x6c, 0x68, 0x66, 0x67, 0x6a, 0x6e, 0x70, 0x6d,
-  0x6a, 0x69, 0x6b, 0x6e, 0x72, 0x77, 0x7a, 0x7b, 0x7a, 0x78, 0x7a, 0x80,
-  0x88, 0x8c, 0x8c, 0x8a, 0x89, 0x87, 0x88, 0x8a, 0x8d, 0x91, 0x94, 0x95,
-  0x92, 0x8f, 0x8f, 0x92, 0x95, 0x97, 0x96, 0x93, 0x90, 0x8e, 0x8b, 0x8a,
-  0x8a, 0x8b, 0x8c, 0x8a, 0x87, 0x85, 0x86, 0x87, 0x88, 0x86, 0x84, 0x82,
-  0x80, 0x7e, 0x7b, 0x78, 0x76, 0x74, 0x74, 0x74, 0x73, 0x72, 0x71, 0x70,
-  0x6e, 0x6d, 0x6c, 0x6d, 0x70, 0x71, 0x6e, 0x69, 0x66, 0x67, 0x6a, 0x6d,
-  0x70, 0x73, 0x74, 0x75, 0x74, 0x73, 0x72, 0x75, 0x79, 0x7d, 0x7e, 0x7d,
-  0x7c, 0x7d, 0x82, 0x87, 0x8a, 0x8c, 0x8e, 0x8e, 0x8c, 0x8a, 0x8a, 0x8c,
-  0x90, 0x93, 0x93, 0x92, 0x93, 0x94, 0x95, 0x96, 0x95, 0x95, 0x95, 0x93,
-  0x91, 0x90, 0x8e, 0x8c, 0x8b, 0x8b, 0x8a, 0x89, 0x89, 0x8a, 0x8a, 0x88,
-  0x85, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7c, 0x79, 0x77, 0x75, 0x74, 0x72,
-  0x72, 0x70, 0x6e, 0x6c, 0x6a, 0x6a, 0x6c, 0x6e, 0x70, 0x72, 0x72, 0x6f,
-  0x6c, 0x6c, 0x6e, 0x71, 0x73, 0x76, 0x76, 0x75, 0x74, 0x73, 0x75, 0x7a,
-  0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x82, 0x87, 0x8b, 0x8d, 0x8d, 0x8c, 0x8c,
-  0x8b, 0x8c, 0x8d, 0x90, 0x94, 0x93, 0x93, 0x93, 0x95, 0x96, 0x97, 0x95,
-  0x92, 0x90, 0x91, 0x91, 0x90, 0x8f, 0x8f, 0x8e, 0x8d, 0x8d, 0x8b, 0x88,
-  0x87, 0x86, 0x84, 0x81, 0x7e, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x74, 0x72,
-  0x71, 0x70, 0x70, 0x71, 0x70, 0x6e, 0x6b, 0x68, 0x68, 0x69, 0x6b, 0x6e,
-  0x70, 0x6f, 0x6d, 0x6b, 0x69, 0x69, 0x6b, 0x70, 0x72, 0x74, 0x74, 0x73,
-  0x73, 0x74, 0x78, 0x7c, 0x7f, 0x82, 0x83, 0x83, 0x83, 0x84, 0x85, 0x88,
-  0x8a, 0x8a, 0x8a, 0x8b, 0x8c, 0x8d, 0x8c, 0x8e, 0x90, 0x92, 0x93, 0x94,
-  0x93, 0x94, 0x97, 0x98, 0x97, 0x94, 0x92, 0x90, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8e, 0x8d, 0x8b, 0x89, 0x87, 0x86, 0x86, 0x84, 0x82, 0x81, 0x81, 0x81,
-  0x80, 0x7f, 0x7b, 0x78, 0x76, 0x74, 0x72, 0x72, 0x71, 0x71, 0x6d, 0x68,
-  0x66, 0x64, 0x65, 0x68, 0x6a, 0x6a, 0x69, 0x6a, 0x6a, 0x6a, 0x6d, 0x70,
-  0x73, 0x75, 0x76, 0x77, 0x77, 0x77, 0x78, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-  0x81, 0x83, 0x85, 0x86, 0x88, 0x8b, 0x8d, 0x8c, 0x8c, 0x8d, 0x8d, 0x8c,
-  0x8b, 0x8c, 0x8c, 0x8d, 0x8f, 0x91, 0x91, 0x91, 0x92, 0x94, 0x95, 0x94,
-  0x92, 0x92, 0x90, 0x90, 0x8f, 0x8e, 0x8d, 0x8d, 0x8c, 0x8b, 0x89, 0x88,
-  0x86, 0x84, 0x82, 0x81, 0x80, 0x80, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-  0x75, 0x72, 0x70, 0x70, 0x6f, 0x6d, 0x6b, 0x69, 0x69, 0x6a, 0x6a, 0x6a,
-  0x69, 0x69, 0x6a, 0x6a, 0x6a, 0x6b, 0x6d, 0x6f, 0x71, 0x73, 0x74, 0x75,
-  0x76, 0x79, 0x7b, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x82, 0x85,
-  0x87, 0x89, 0x8a, 0x8a, 0x8a, 0x8c, 0x8e, 0x8e, 0x8d, 0x8d, 0x8c, 0x8c,
-  0x8b, 0x8d, 0x8f, 0x90, 0x8f, 0x8f, 0x8f, 0x8e, 0x8d, 0x8c, 0x8c, 0x8b,
-  0x89, 0x88, 0x87, 0x87, 0x86, 0x87, 0x86, 0x86, 0x86, 0x86, 0x84, 0x83,
-  0x82, 0x81, 0x82, 0x83, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7a, 0x77,
-  0x75, 0x74, 0x74, 0x74, 0x73, 0x72, 0x70, 0x6f, 0x6e, 0x6c, 0x6b, 0x6b,
-  0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x71, 0x74, 0x75, 0x76, 0x78, 0x7a, 0x7a,
-  0x7a, 0x7a, 0x7b, 0x7c, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x83, 0x84, 0x86,
-  0x88, 0x88, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a,
-  0x89, 0x88, 0x88, 0x89, 0x8a, 0x8b, 0x8b, 0x89, 0x88, 0x89, 0x89, 0x88,
-  0x87, 0x88, 0x88, 0x87, 0x86, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86,
-  0x86, 0x84, 0x83, 0x84, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x7f, 0x7e, 0x7d, 0x7c, 0x7a, 0x78, 0x76, 0x75, 0x74, 0x73, 0x72, 0x70,
-  0x70, 0x6e, 0x6f, 0x70, 0x70, 0x70, 0x70, 0x72, 0x74, 0x76, 0x76, 0x76,
-  0x76, 0x76, 0x76, 0x79, 0x7b, 0x7d, 0x7e, 0x7d, 0x7e, 0x7e, 0x80, 0x81,
-  0x84, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x86, 0x85, 0x85,
-  0x85, 0x86, 0x86, 0x87, 0x88, 0x88, 0x88, 0x89, 0x89, 0x88, 0x88, 0x88,
-  0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x87, 0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x82, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7a,
-  0x79, 0x78, 0x77, 0x76, 0x75, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76,
-  0x75, 0x74, 0x74, 0x73, 0x72, 0x73, 0x73, 0x73, 0x74, 0x76, 0x76, 0x76,
-  0x77, 0x79, 0x7a, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x82, 0x82, 0x84, 0x84,
-  0x85, 0x86, 0x86, 0x84, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x88,
-  0x88, 0x88, 0x87, 0x86, 0x86, 0x87, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89,
-  0x89, 0x88, 0x88, 0x89, 0x87, 0x86, 0x85, 0x84, 0x85, 0x84, 0x83, 0x82,
-  0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7b, 0x7b,
-  0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x79, 0x78, 0x78, 0x78, 0x78, 0x79,
-  0x79, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x7a, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x82, 0x82, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x83, 0x83,
-  0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x84, 0x85, 0x85,
-  0x86, 0x86, 0x86, 0x85, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x83, 0x83,
-  0x83, 0x83, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7e, 0x7d,
-  0x7c, 0x7b, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7c,
-  0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84,
-  0x85, 0x86, 0x86, 0x87, 0x87, 0x88, 0x88, 0x88, 0x89, 0x88, 0x89, 0x8a,
-  0x8a, 0x8a, 0x8b, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x82, 0x81,
-  0x7e, 0x7d, 0x7c, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x78, 0x79, 0x79, 0x7a,
-  0x7a, 0x79, 0x78, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x7a, 0x7b, 0x7b,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82, 0x83,
-  0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80,
-  0x80, 0x80, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80,
-  0x7f, 0x7e, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80,
-  0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x82, 0x82, 0x82,
-  0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e,
-  0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x83, 0x84,
-  0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83,
-  0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x84, 0x84, 0x83, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82,
-  0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x83, 0x83, 0x82, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x82,
-  0x82, 0x82, 0x82, 0x80, 0x81, 0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7f,
-  0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83,
-  0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x81, 0x83,
-  0x83, 0x82, 0x80, 0x80, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x82, 0x81, 0x7e, 0x7e, 0x82, 0x85, 0x86, 0x84, 0x83, 0x82, 0x82,
-  0x81, 0x80, 0x7f, 0x81, 0x82, 0x82, 0x7e, 0x7c, 0x80, 0x83, 0x83, 0x7f,
-  0x7c, 0x7b, 0x7b, 0x7e, 0x83, 0x85, 0x82, 0x80, 0x80, 0x83, 0x84, 0x7f,
-  0x7a, 0x7c, 0x82, 0x86, 0x85, 0x82, 0x80, 0x80, 0x81, 0x80, 0x7c, 0x7c,
-  0x7e, 0x80, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7c, 0x7a, 0x7b, 0x7c,
-  0x7e, 0x82, 0x84, 0x81, 0x7d, 0x7e, 0x80, 0x82, 0x84, 0x82, 0x7e, 0x7c,
-  0x7d, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7c, 0x79, 0x7a, 0x7e, 0x82,
-  0x82, 0x7f, 0x7b, 0x7a, 0x7b, 0x7c, 0x7e, 0x80, 0x81, 0x82, 0x80, 0x7c,
-  0x7b, 0x7d, 0x82, 0x83, 0x7e, 0x7a, 0x7b, 0x7f, 0x7f, 0x7c, 0x7a, 0x7b,
-  0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x7d, 0x79, 0x79, 0x7c, 0x80, 0x81, 0x80,
-  0x7f, 0x7c, 0x7c, 0x80, 0x82, 0x82, 0x80, 0x7e, 0x7c, 0x7d, 0x7e, 0x7f,
-  0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x82,
-  0x81, 0x80, 0x81, 0x7f, 0x7c, 0x7d, 0x81, 0x83, 0x82, 0x7e, 0x7b, 0x7c,
-  0x80, 0x82, 0x81, 0x7e, 0x7e, 0x81, 0x81, 0x7e, 0x7e, 0x80, 0x82, 0x82,
-  0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7c, 0x7b, 0x7c,
-  0x7f, 0x80, 0x81, 0x80, 0x7c, 0x7a, 0x7b, 0x7e, 0x81, 0x80, 0x7d, 0x7c,
-  0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x81, 0x82, 0x83, 0x84, 0x82, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x81,
-  0x80, 0x82, 0x83, 0x82, 0x80, 0x7f, 0x81, 0x82, 0x80, 0x80, 0x81, 0x82,
-  0x82, 0x81, 0x80, 0x83, 0x84, 0x80, 0x7d, 0x7c, 0x7e, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x82, 0x83,
-  0x82, 0x7f, 0x7d, 0x7e, 0x80, 0x80, 0x7e, 0x7e, 0x81, 0x84, 0x84, 0x82,
-  0x80, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x84, 0x84, 0x80, 0x7b, 0x7a, 0x7d,
-  0x82, 0x82, 0x7d, 0x7a, 0x7b, 0x81, 0x84, 0x83, 0x82, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x82, 0x80, 0x7e, 0x81, 0x83, 0x82, 0x7e, 0x7c, 0x7e,
-  0x83, 0x85, 0x82, 0x7e, 0x7d, 0x7e, 0x80, 0x83, 0x85, 0x85, 0x83, 0x80,
-  0x7e, 0x80, 0x81, 0x82, 0x83, 0x82, 0x81, 0x82, 0x82, 0x83, 0x82, 0x82,
-  0x81, 0x81, 0x7e, 0x7d, 0x7e, 0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7e, 0x80, 0x82, 0x82, 0x80, 0x80, 0x82, 0x83, 0x83, 0x82, 0x80, 0x7e,
-  0x7f, 0x82, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x80,
-  0x83, 0x84, 0x82, 0x7f, 0x7e, 0x7e, 0x81, 0x84, 0x86, 0x84, 0x7f, 0x7c,
-  0x7e, 0x82, 0x83, 0x83, 0x84, 0x83, 0x7f, 0x7b, 0x7c, 0x7e, 0x80, 0x81,
-  0x7e, 0x7d, 0x7f, 0x80, 0x80, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d,
-  0x7b, 0x7b, 0x7d, 0x7e, 0x80, 0x82, 0x81, 0x7e, 0x7b, 0x7a, 0x7c, 0x82,
-  0x86, 0x85, 0x80, 0x7d, 0x80, 0x84, 0x84, 0x7e, 0x7b, 0x7d, 0x82, 0x85,
-  0x83, 0x80, 0x7e, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x82, 0x7d, 0x7a, 0x7b,
-  0x80, 0x86, 0x86, 0x82, 0x7e, 0x7c, 0x7e, 0x83, 0x84, 0x84, 0x84, 0x84,
-  0x80, 0x7b, 0x7b, 0x7e, 0x81, 0x81, 0x7e, 0x7e, 0x80, 0x81, 0x7f, 0x7d,
-  0x7e, 0x82, 0x81, 0x7e, 0x7c, 0x7e, 0x82, 0x84, 0x82, 0x7f, 0x7f, 0x81,
-  0x81, 0x7f, 0x7c, 0x7c, 0x7f, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x7e, 0x7f, 0x81, 0x81, 0x7e, 0x7c, 0x81, 0x86, 0x85, 0x7e, 0x79, 0x79,
-  0x7e, 0x80, 0x7e, 0x7e, 0x82, 0x82, 0x80, 0x7d, 0x7e, 0x80, 0x81, 0x80,
-  0x81, 0x83, 0x80, 0x7b, 0x7a, 0x81, 0x86, 0x83, 0x7e, 0x7c, 0x80, 0x84,
-  0x83, 0x7f, 0x7e, 0x82, 0x85, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-  0x7e, 0x80, 0x81, 0x7f, 0x7c, 0x79, 0x7a, 0x7f, 0x82, 0x81, 0x7d, 0x7b,
-  0x7c, 0x7f, 0x81, 0x81, 0x81, 0x82, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x81,
-  0x7e, 0x7a, 0x7a, 0x7e, 0x83, 0x84, 0x80, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x7e, 0x7c, 0x7d, 0x7f, 0x80, 0x7e, 0x7d, 0x7b,
-  0x78, 0x7a, 0x7f, 0x81, 0x80, 0x7d, 0x7a, 0x7b, 0x7d, 0x7f, 0x83, 0x84,
-  0x82, 0x7e, 0x7c, 0x7d, 0x81, 0x83, 0x80, 0x7e, 0x7f, 0x81, 0x7f, 0x7b,
-  0x79, 0x7d, 0x82, 0x85, 0x85, 0x7f, 0x7a, 0x7c, 0x84, 0x88, 0x86, 0x82,
-  0x80, 0x7e, 0x7c, 0x7d, 0x80, 0x80, 0x7e, 0x7c, 0x7d, 0x80, 0x80, 0x7f,
-  0x7f, 0x81, 0x81, 0x80, 0x7d, 0x7c, 0x7e, 0x81, 0x81, 0x7e, 0x7b, 0x7c,
-  0x80, 0x81, 0x7e, 0x7c, 0x7f, 0x80, 0x7f, 0x7f, 0x81, 0x85, 0x86, 0x82,
-  0x7b, 0x7a, 0x7c, 0x81, 0x85, 0x84, 0x82, 0x7e, 0x7d, 0x7c, 0x7d, 0x81,
-  0x85, 0x83, 0x7d, 0x7a, 0x7e, 0x84, 0x86, 0x83, 0x80, 0x81, 0x87, 0x88,
-  0x83, 0x7f, 0x80, 0x83, 0x85, 0x85, 0x83, 0x83, 0x82, 0x80, 0x80, 0x82,
-  0x84, 0x83, 0x80, 0x7e, 0x80, 0x84, 0x85, 0x83, 0x7e, 0x7e, 0x81, 0x82,
-  0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x80, 0x7e, 0x7e, 0x80, 0x81,
-  0x7f, 0x7c, 0x7a, 0x7a, 0x7d, 0x83, 0x87, 0x84, 0x7c, 0x7a, 0x7b, 0x7e,
-  0x80, 0x7e, 0x7d, 0x80, 0x82, 0x83, 0x83, 0x81, 0x7d, 0x7d, 0x80, 0x83,
-  0x86, 0x86, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x86, 0x88, 0x87,
-  0x84, 0x82, 0x80, 0x82, 0x84, 0x86, 0x85, 0x84, 0x83, 0x81, 0x82, 0x86,
-  0x8a, 0x8a, 0x86, 0x84, 0x85, 0x86, 0x84, 0x82, 0x82, 0x82, 0x82, 0x80,
-  0x81, 0x81, 0x80, 0x7d, 0x7c, 0x7e, 0x7c, 0x79, 0x79, 0x7c, 0x80, 0x82,
-  0x7e, 0x79, 0x78, 0x79, 0x76, 0x72, 0x72, 0x77, 0x7f, 0x83, 0x82, 0x81,
-  0x7d, 0x76, 0x72, 0x72, 0x78, 0x80, 0x84, 0x84, 0x80, 0x7b, 0x78, 0x7a,
-  0x7c, 0x7f, 0x81, 0x81, 0x82, 0x85, 0x85, 0x82, 0x81, 0x81, 0x81, 0x80,
-  0x82, 0x85, 0x86, 0x85, 0x84, 0x85, 0x88, 0x8a, 0x89, 0x85, 0x84, 0x85,
-  0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x86, 0x85, 0x89, 0x8c, 0x8d,
-  0x8b, 0x86, 0x82, 0x82, 0x82, 0x81, 0x7f, 0x80, 0x80, 0x7b, 0x77, 0x78,
-  0x7c, 0x7e, 0x7c, 0x79, 0x74, 0x72, 0x76, 0x7c, 0x82, 0x80, 0x76, 0x68,
-  0x63, 0x6c, 0x7e, 0x8c, 0x8b, 0x7e, 0x6f, 0x6a, 0x6e, 0x76, 0x7e, 0x81,
-  0x80, 0x82, 0x87, 0x86, 0x7b, 0x6f, 0x6c, 0x76, 0x87, 0x90, 0x8c, 0x7e,
-  0x76, 0x79, 0x82, 0x86, 0x82, 0x7c, 0x7e, 0x87, 0x90, 0x8d, 0x84, 0x7e,
-  0x82, 0x8e, 0x97, 0x96, 0x8c, 0x83, 0x82, 0x88, 0x90, 0x94, 0x91, 0x8c,
-  0x8a, 0x8a, 0x88, 0x85, 0x83, 0x85, 0x8c, 0x8f, 0x8a, 0x81, 0x7c, 0x7b,
-  0x7f, 0x84, 0x84, 0x7d, 0x72, 0x6d, 0x74, 0x79, 0x77, 0x70, 0x6c, 0x6e,
-  0x77, 0x80, 0x81, 0x76, 0x60, 0x51, 0x59, 0x77, 0x93, 0x98, 0x89, 0x70,
-  0x5f, 0x60, 0x70, 0x82, 0x88, 0x84, 0x7d, 0x7a, 0x7e, 0x7e, 0x76, 0x6e,
-  0x72, 0x81, 0x8e, 0x8d, 0x80, 0x74, 0x74, 0x82, 0x8e, 0x8a, 0x7c, 0x74,
-  0x7a, 0x89, 0x91, 0x8c, 0x81, 0x7c, 0x82, 0x8a, 0x8c, 0x87, 0x82, 0x86,
-  0x90, 0x92, 0x8c, 0x85, 0x83, 0x86, 0x8b, 0x8d, 0x8a, 0x88, 0x86, 0x87,
-  0x89, 0x8a, 0x88, 0x86, 0x82, 0x80, 0x80, 0x82, 0x82, 0x7e, 0x78, 0x74,
-  0x72, 0x70, 0x71, 0x72, 0x74, 0x77, 0x7a, 0x77, 0x6a, 0x56, 0x4b, 0x55,
-  0x76, 0x98, 0xa2, 0x8c, 0x64, 0x4b, 0x55, 0x70, 0x84, 0x86, 0x80, 0x7d,
-  0x84, 0x8a, 0x80, 0x6a, 0x60, 0x70, 0x8b, 0x9d, 0x97, 0x7e, 0x6a, 0x70,
-  0x87, 0x95, 0x90, 0x7f, 0x75, 0x7b, 0x8b, 0x94, 0x91, 0x8a, 0x88, 0x8c,
-  0x8f, 0x8c, 0x86, 0x87, 0x8e, 0x96, 0x98, 0x94, 0x8a, 0x82, 0x83, 0x8b,
-  0x94, 0x9a, 0x97, 0x92, 0x8c, 0x8a, 0x88, 0x86, 0x83, 0x83, 0x86, 0x8b,
-  0x89, 0x7d, 0x72, 0x6d, 0x6e, 0x71, 0x74, 0x76, 0x77, 0x75, 0x74, 0x6b,
-  0x55, 0x44, 0x50, 0x74, 0x97, 0x9d, 0x80, 0x56, 0x44, 0x56, 0x75, 0x8a,
-  0x88, 0x7a, 0x76, 0x82, 0x8c, 0x85, 0x6f, 0x62, 0x6b, 0x85, 0x9b, 0x9a,
-  0x85, 0x71, 0x71, 0x82, 0x8f, 0x8e, 0x84, 0x7e, 0x82, 0x8c, 0x95, 0x94,
-  0x8d, 0x8a, 0x8a, 0x8c, 0x8d, 0x89, 0x88, 0x8c, 0x92, 0x96, 0x96, 0x91,
-  0x87, 0x80, 0x84, 0x91, 0x9b, 0x9c, 0x95, 0x8c, 0x89, 0x8b, 0x8c, 0x89,
-  0x83, 0x82, 0x87, 0x8c, 0x88, 0x7b, 0x6e, 0x6a, 0x6e, 0x72, 0x73, 0x70,
-  0x6f, 0x6d, 0x60, 0x4c, 0x45, 0x5a, 0x7f, 0x99, 0x92, 0x69, 0x40, 0x3c,
-  0x5c, 0x82, 0x91, 0x86, 0x74, 0x72, 0x7e, 0x80, 0x70, 0x62, 0x66, 0x7e,
-  0x9b, 0xa2, 0x90, 0x75, 0x6c, 0x7b, 0x91, 0x9a, 0x94, 0x89, 0x87, 0x90,
-  0x98, 0x98, 0x90, 0x88, 0x86, 0x8c, 0x93, 0x97, 0x95, 0x90, 0x91, 0x95,
-  0x95, 0x8e, 0x84, 0x80, 0x8a, 0x9b, 0xa4, 0x9c, 0x8b, 0x7e, 0x82, 0x8b,
-  0x8d, 0x88, 0x83, 0x81, 0x82, 0x82, 0x7a, 0x71, 0x6e, 0x72, 0x78, 0x7b,
-  0x77, 0x6e, 0x5d, 0x47, 0x3c, 0x4e, 0x77, 0x9d, 0xa4, 0x81, 0x4b, 0x30,
-  0x40, 0x68, 0x86, 0x8c, 0x83, 0x7b, 0x7d, 0x80, 0x77, 0x64, 0x59, 0x67,
-  0x89, 0xa6, 0xaa, 0x92, 0x76, 0x70, 0x7d, 0x8c, 0x93, 0x90, 0x8c, 0x8e,
-  0x96, 0x9b, 0x9a, 0x92, 0x8b, 0x8a, 0x8f, 0x96, 0x9a, 0x99, 0x95, 0x92,
-  0x94, 0x97, 0x91, 0x85, 0x80, 0x88, 0x98, 0xa1, 0x9d, 0x8c, 0x7d, 0x7c,
-  0x83, 0x85, 0x80, 0x7b, 0x7d, 0x81, 0x7f, 0x76, 0x6c, 0x69, 0x6f, 0x79,
-  0x79, 0x6a, 0x4e, 0x31, 0x2f, 0x52, 0x84, 0xa4, 0x9e, 0x6e, 0x39, 0x2a,
-  0x45, 0x6c, 0x82, 0x86, 0x80, 0x84, 0x8e, 0x8a, 0x6c, 0x4b, 0x49, 0x68,
-  0x96, 0xb5, 0xb0, 0x91, 0x76, 0x73, 0x82, 0x8e, 0x92, 0x92, 0x96, 0x9e,
-  0xa5, 0xa2, 0x98, 0x8e, 0x8d, 0x94, 0x9c, 0x9f, 0x9d, 0x98, 0x94, 0x96,
-  0x9b, 0x9f, 0x9a, 0x8e, 0x85, 0x86, 0x8f, 0x97, 0x97, 0x91, 0x88, 0x84,
-  0x83, 0x7e, 0x76, 0x72, 0x78, 0x80, 0x82, 0x7c, 0x72, 0x6c, 0x6e, 0x74,
-  0x75, 0x66, 0x46, 0x27, 0x26, 0x4e, 0x87, 0xab, 0x9f, 0x6a, 0x32, 0x22,
-  0x3f, 0x67, 0x7c, 0x7e, 0x7c, 0x87, 0x99, 0x97, 0x74, 0x4a, 0x3d, 0x5c,
-  0x95, 0xc0, 0xc0, 0x9d, 0x7a, 0x74, 0x84, 0x91, 0x92, 0x90, 0x92, 0x9d,
-  0xa9, 0xa8, 0x9d, 0x90, 0x8c, 0x96, 0xa2, 0xa6, 0x9e, 0x92, 0x91, 0x9e,
-  0xad, 0xac, 0x9a, 0x87, 0x81, 0x89, 0x93, 0x97, 0x94, 0x8f, 0x8c, 0x87,
-  0x7c, 0x6e, 0x68, 0x6d, 0x76, 0x7e, 0x81, 0x7b, 0x75, 0x71, 0x68, 0x53,
-  0x2e, 0x12, 0x1d, 0x57, 0x9d, 0xbf, 0xa6, 0x62, 0x25, 0x1a, 0x3e, 0x67,
-  0x7c, 0x7c, 0x7c, 0x8e, 0xa4, 0x9d, 0x6f, 0x3e, 0x37, 0x60, 0x9e, 0xc4,
-  0xbc, 0x97, 0x7c, 0x81, 0x94, 0xa0, 0x9c, 0x8e, 0x88, 0x92, 0xa3, 0xae,
-  0xae, 0xa5, 0xa0, 0xa0, 0xa4, 0xa0, 0x92, 0x82, 0x81, 0x96, 0xb0, 0xbb,
-  0xab, 0x8c, 0x75, 0x72, 0x7d, 0x87, 0x8a, 0x8a, 0x8a, 0x85, 0x77, 0x66,
-  0x5b, 0x5e, 0x69, 0x76, 0x81, 0x83, 0x80, 0x78, 0x67, 0x47, 0x25, 0x16,
-  0x32, 0x6e, 0xa8, 0xb8, 0x92, 0x4f, 0x21, 0x2b, 0x51, 0x6d, 0x76, 0x73,
-  0x79, 0x92, 0xa5, 0x98, 0x6d, 0x4b, 0x50, 0x77, 0xa0, 0xb1, 0xa5, 0x8c,
-  0x84, 0x94, 0xa7, 0xab, 0x9d, 0x86, 0x7c, 0x8b, 0xa0, 0xb1, 0xb6, 0xb0,
-  0xa7, 0xa4, 0xa0, 0x94, 0x81, 0x7a, 0x8c, 0xa7, 0xb9, 0xb4, 0x9c, 0x84,
-  0x7a, 0x7b, 0x7d, 0x80, 0x82, 0x85, 0x85, 0x7e, 0x75, 0x6e, 0x6d, 0x6f,
-  0x74, 0x79, 0x7c, 0x7a, 0x6e, 0x56, 0x30, 0x10, 0x16, 0x47, 0x88, 0xb0,
-  0xa7, 0x6c, 0x2a, 0x14, 0x30, 0x57, 0x6e, 0x76, 0x78, 0x87, 0x9c, 0x9e,
-  0x7f, 0x53, 0x3f, 0x56, 0x87, 0xaf, 0xb8, 0x9f, 0x80, 0x79, 0x8b, 0xa3,
-  0xb0, 0xa5, 0x8b, 0x7e, 0x89, 0x9e, 0xad, 0xb1, 0xaa, 0xa5, 0xa9, 0xa8,
-  0x97, 0x7b, 0x6f, 0x82, 0xa2, 0xb6, 0xb1, 0x97, 0x7a, 0x6c, 0x6e, 0x74,
-  0x7b, 0x80, 0x83, 0x83, 0x7c, 0x74, 0x6c, 0x66, 0x67, 0x71, 0x7f, 0x84,
-  0x75, 0x4c, 0x1a, 0x05, 0x27, 0x6d, 0xac, 0xbe, 0x94, 0x4e, 0x21, 0x25,
-  0x42, 0x5d, 0x6e, 0x7b, 0x8f, 0xa6, 0xaa, 0x8f, 0x63, 0x4a, 0x57, 0x7e,
-  0xa2, 0xb1, 0xa8, 0x92, 0x88, 0x92, 0xa7, 0xb5, 0xb2, 0x9e, 0x88, 0x82,
-  0x8e, 0xa2, 0xaf, 0xb5, 0xb6, 0xb6, 0xaf, 0x9a, 0x7a, 0x67, 0x72, 0x90,
-  0xa9, 0xb1, 0xa5, 0x8a, 0x73, 0x68, 0x69, 0x6f, 0x74, 0x78, 0x7b, 0x7b,
-  0x79, 0x76, 0x73, 0x75, 0x7a, 0x7c, 0x6e, 0x4c, 0x1e, 0x09, 0x28, 0x6d,
-  0xad, 0xc3, 0xa1, 0x5e, 0x2e, 0x2c, 0x40, 0x50, 0x5b, 0x6d, 0x8a, 0xae,
-  0xc3, 0xb0, 0x7e, 0x56, 0x54, 0x71, 0x94, 0xa9, 0xa9, 0x9b, 0x93, 0x9e,
-  0xb2, 0xc1, 0xc2, 0xad, 0x90, 0x7e, 0x7e, 0x8d, 0xa0, 0xb0, 0xbd, 0xc7,
-  0xc8, 0xb6, 0x91, 0x6b, 0x5d, 0x6d, 0x89, 0xa0, 0xa9, 0xa0, 0x8c, 0x78,
-  0x6d, 0x69, 0x6c, 0x6e, 0x6e, 0x6f, 0x72, 0x77, 0x7e, 0x82, 0x84, 0x7e,
-  0x68, 0x40, 0x15, 0x08, 0x2d, 0x6e, 0xa6, 0xb8, 0x9b, 0x66, 0x44, 0x40,
-  0x47, 0x4a, 0x50, 0x64, 0x86, 0xab, 0xbf, 0xb2, 0x8e, 0x70, 0x6e, 0x80,
-  0x91, 0x92, 0x8b, 0x88, 0x91, 0xa8, 0xc3, 0xd2, 0xca, 0xb0, 0x94, 0x80,
-  0x7c, 0x83, 0x90, 0xa3, 0xbc, 0xce, 0xc9, 0xac, 0x87, 0x6e, 0x6a, 0x74,
-  0x80, 0x88, 0x89, 0x84, 0x7e, 0x7a, 0x78, 0x77, 0x74, 0x70, 0x6c, 0x6c,
-  0x6f, 0x74, 0x7b, 0x80, 0x75, 0x57, 0x2d, 0x14, 0x2b, 0x63, 0x92, 0x9f,
-  0x80, 0x4c, 0x37, 0x4a, 0x5f, 0x60, 0x5a, 0x5a, 0x6a, 0x8a, 0xa2, 0xa0,
-  0x88, 0x75, 0x79, 0x8f, 0xa0, 0x9c, 0x88, 0x77, 0x7d, 0x98, 0xb9, 0xcd,
-  0xc7, 0xae, 0x96, 0x8b, 0x8c, 0x8a, 0x87, 0x8d, 0x9e, 0xb2, 0xb7, 0xa6,
-  0x88, 0x72, 0x71, 0x7c, 0x82, 0x7e, 0x73, 0x66, 0x61, 0x65, 0x71, 0x7c,
-  0x7e, 0x7b, 0x73, 0x6e, 0x6e, 0x71, 0x73, 0x6c, 0x56, 0x35, 0x1b, 0x24,
-  0x53, 0x8b, 0xa6, 0x96, 0x64, 0x39, 0x36, 0x4d, 0x5c, 0x5b, 0x5a, 0x66,
-  0x83, 0xa1, 0xa8, 0x96, 0x7e, 0x76, 0x83, 0x97, 0xa0, 0x93, 0x7d, 0x76,
-  0x89, 0xab, 0xce, 0xda, 0xc7, 0xa5, 0x8d, 0x89, 0x8c, 0x8b, 0x87, 0x8d,
-  0xa1, 0xb6, 0xb9, 0xa4, 0x85, 0x71, 0x6f, 0x78, 0x7d, 0x7a, 0x6c, 0x5e,
-  0x5c, 0x67, 0x79, 0x88, 0x8d, 0x88, 0x7f, 0x7a, 0x7b, 0x7b, 0x72, 0x5b,
-  0x3b, 0x20, 0x21, 0x4a, 0x86, 0xaf, 0xac, 0x7f, 0x47, 0x30, 0x42, 0x58,
-  0x5c, 0x5a, 0x5f, 0x76, 0x98, 0xb0, 0xac, 0x95, 0x81, 0x83, 0x93, 0x9e,
-  0x97, 0x81, 0x70, 0x79, 0x9c, 0xc7, 0xe4, 0xdf, 0xba, 0x91, 0x80, 0x83,
-  0x87, 0x84, 0x82, 0x8d, 0xa1, 0xaf, 0xaa, 0x93, 0x79, 0x6c, 0x6f, 0x76,
-  0x76, 0x6b, 0x59, 0x4d, 0x53, 0x6a, 0x85, 0x99, 0x9f, 0x98, 0x8c, 0x82,
-  0x78, 0x68, 0x4d, 0x2b, 0x14, 0x22, 0x58, 0x98, 0xc1, 0xb7, 0x81, 0x4a,
-  0x3a, 0x4f, 0x65, 0x64, 0x58, 0x55, 0x6b, 0x90, 0xae, 0xb6, 0xac, 0x9c,
-  0x96, 0x9d, 0xa1, 0x92, 0x76, 0x64, 0x6c, 0x94, 0xcc, 0xf1, 0xed, 0xc8,
-  0x9c, 0x84, 0x88, 0x90, 0x88, 0x7c, 0x7e, 0x8f, 0x9f, 0xa3, 0x9a, 0x8b,
-  0x7e, 0x7a, 0x79, 0x70, 0x5c, 0x46, 0x3d, 0x4c, 0x6e, 0x93, 0xab, 0xaf,
-  0xa3, 0x94, 0x86, 0x70, 0x4e, 0x25, 0x0b, 0x1a, 0x51, 0x96, 0xc4, 0xbe,
-  0x8b, 0x58, 0x4d, 0x61, 0x6e, 0x65, 0x50, 0x47, 0x57, 0x7a, 0x9c, 0xb3,
-  0xb9, 0xb6, 0xb4, 0xb2, 0xa6, 0x8a, 0x68, 0x54, 0x60, 0x8e, 0xc6, 0xe9,
-  0xe7, 0xc9, 0xa6, 0x97, 0x9a, 0x9a, 0x8a, 0x74, 0x6c, 0x72, 0x7f, 0x8c,
-  0x91, 0x91, 0x8f, 0x8e, 0x89, 0x78, 0x5c, 0x3f, 0x34, 0x45, 0x68, 0x8e,
-  0xa9, 0xb2, 0xab, 0x9a, 0x84, 0x63, 0x3c, 0x1c, 0x1a, 0x3c, 0x6e, 0x96,
-  0xa3, 0x8c, 0x6a, 0x5e, 0x6e, 0x82, 0x83, 0x6f, 0x54, 0x46, 0x54, 0x70,
-  0x8c, 0xa3, 0xb6, 0xc2, 0xc6, 0xbe, 0xa9, 0x89, 0x6c, 0x62, 0x6f, 0x8f,
-  0xb0, 0xc0, 0xbb, 0xaa, 0x9e, 0xa1, 0xaa, 0xaa, 0x9c, 0x84, 0x6d, 0x5f,
-  0x5e, 0x66, 0x74, 0x81, 0x8c, 0x90, 0x8e, 0x83, 0x6f, 0x5a, 0x4f, 0x57,
-  0x6d, 0x87, 0x9b, 0xa4, 0x9f, 0x8e, 0x74, 0x56, 0x3c, 0x37, 0x4e, 0x70,
-  0x89, 0x8c, 0x79, 0x5f, 0x58, 0x69, 0x81, 0x90, 0x8e, 0x7e, 0x6c, 0x64,
-  0x6b, 0x7b, 0x8f, 0xa1, 0xb1, 0xbc, 0xbc, 0xaf, 0x9a, 0x85, 0x7b, 0x80,
-  0x93, 0xa8, 0xb0, 0xa8, 0x98, 0x8d, 0x8e, 0x97, 0xa0, 0xa1, 0x96, 0x81,
-  0x6a, 0x5c, 0x5c, 0x64, 0x6c, 0x73, 0x79, 0x7b, 0x77, 0x6e, 0x62, 0x5f,
-  0x6a, 0x7d, 0x90, 0x9b, 0x9c, 0x92, 0x80, 0x66, 0x48, 0x35, 0x3c, 0x5f,
-  0x87, 0xa0, 0x9a, 0x78, 0x59, 0x57, 0x6d, 0x83, 0x8c, 0x83, 0x70, 0x64,
-  0x66, 0x74, 0x87, 0x9a, 0xac, 0xb9, 0xbd, 0xb4, 0x9e, 0x83, 0x72, 0x75,
-  0x8a, 0xa3, 0xb2, 0xae, 0x9c, 0x8c, 0x89, 0x91, 0x9b, 0xa0, 0x99, 0x86,
-  0x6f, 0x5c, 0x54, 0x5a, 0x66, 0x6e, 0x73, 0x75, 0x75, 0x6f, 0x65, 0x60,
-  0x66, 0x76, 0x8b, 0x99, 0x9c, 0x90, 0x78, 0x58, 0x3b, 0x32, 0x42, 0x66,
-  0x8a, 0x9c, 0x92, 0x72, 0x57, 0x57, 0x6c, 0x82, 0x8c, 0x86, 0x73, 0x67,
-  0x66, 0x70, 0x82, 0x95, 0xa9, 0xba, 0xbf, 0xb2, 0x9a, 0x83, 0x76, 0x79,
-  0x8b, 0xa0, 0xab, 0xa5, 0x95, 0x86, 0x83, 0x8d, 0x9b, 0xa3, 0x9d, 0x89,
-  0x70, 0x5b, 0x53, 0x5a, 0x65, 0x6e, 0x73, 0x74, 0x70, 0x6a, 0x66, 0x66,
-  0x6e, 0x7b, 0x8a, 0x97, 0x99, 0x8d, 0x75, 0x57, 0x3e, 0x33, 0x40, 0x60,
-  0x83, 0x95, 0x8d, 0x73, 0x5b, 0x5b, 0x6e, 0x82, 0x8a, 0x83, 0x72, 0x64,
-  0x61, 0x6b, 0x7e, 0x94, 0xa9, 0xb7, 0xbc, 0xb6, 0xa4, 0x8f, 0x7f, 0x7c,
-  0x86, 0x97, 0xa4, 0xa3, 0x95, 0x86, 0x80, 0x89, 0x98, 0xa2, 0xa1, 0x91,
-  0x7b, 0x66, 0x59, 0x59, 0x61, 0x6a, 0x6f, 0x70, 0x6f, 0x6c, 0x6b, 0x6d,
-  0x75, 0x82, 0x8f, 0x9a, 0x9c, 0x90, 0x7a, 0x5c, 0x3e, 0x2d, 0x36, 0x57,
-  0x7d, 0x96, 0x97, 0x7d, 0x61, 0x5c, 0x6d, 0x83, 0x8f, 0x8a, 0x76, 0x64,
-  0x5c, 0x64, 0x77, 0x8d, 0xa2, 0xb4, 0xbf, 0xbf, 0xb1, 0x9b, 0x86, 0x7e,
-  0x86, 0x95, 0xa1, 0xa0, 0x92, 0x83, 0x7c, 0x85, 0x97, 0xa8, 0xab, 0x9c,
-  0x82, 0x68, 0x59, 0x58, 0x60, 0x68, 0x6c, 0x6b, 0x6b, 0x6b, 0x6e, 0x75,
-  0x7e, 0x8c, 0x9b, 0xa4, 0xa2, 0x94, 0x76, 0x51, 0x33, 0x2a, 0x3e, 0x66,
-  0x8a, 0x98, 0x8a, 0x6e, 0x5e, 0x68, 0x82, 0x95, 0x98, 0x87, 0x6b, 0x58,
-  0x57, 0x65, 0x7b, 0x93, 0xa7, 0xb8, 0xc0, 0xbc, 0xad, 0x9b, 0x8d, 0x8a,
-  0x91, 0x9b, 0x9e, 0x94, 0x82, 0x74, 0x77, 0x8a, 0xa2, 0xb0, 0xad, 0x9a,
-  0x7f, 0x68, 0x5f, 0x62, 0x67, 0x69, 0x66, 0x63, 0x61, 0x65, 0x6e, 0x79,
-  0x87, 0x96, 0xa4, 0xac, 0xab, 0x9c, 0x7d, 0x55, 0x34, 0x2c, 0x41, 0x64,
-  0x82, 0x8d, 0x80, 0x69, 0x61, 0x73, 0x90, 0xa5, 0xa4, 0x8e, 0x6f, 0x59,
-  0x57, 0x64, 0x78, 0x8f, 0xa3, 0xb3, 0xbc, 0xba, 0xac, 0x9e, 0x95, 0x92,
-  0x98, 0x9f, 0x9b, 0x8a, 0x73, 0x64, 0x69, 0x7d, 0x97, 0xa8, 0xaa, 0x9a,
-  0x82, 0x6d, 0x65, 0x66, 0x68, 0x67, 0x62, 0x5a, 0x57, 0x5d, 0x69, 0x78,
-  0x89, 0x9b, 0xaa, 0xb2, 0xad, 0x98, 0x74, 0x4c, 0x31, 0x32, 0x4e, 0x70,
-  0x84, 0x7f, 0x66, 0x56, 0x64, 0x88, 0xa8, 0xb3, 0xa2, 0x7e, 0x5e, 0x53,
-  0x5c, 0x70, 0x83, 0x92, 0x9e, 0xa8, 0xae, 0xaf, 0xaa, 0xa3, 0xa2, 0xa6,
-  0xad, 0xa9, 0x94, 0x77, 0x62, 0x60, 0x73, 0x8c, 0x9e, 0xa4, 0x9a, 0x87,
-  0x79, 0x74, 0x76, 0x78, 0x74, 0x68, 0x5a, 0x52, 0x54, 0x5f, 0x6f, 0x80,
-  0x91, 0xa2, 0xb0, 0xb4, 0xaa, 0x8f, 0x68, 0x47, 0x3c, 0x4c, 0x67, 0x79,
-  0x77, 0x63, 0x52, 0x59, 0x77, 0x9c, 0xb5, 0xb6, 0x9e, 0x7b, 0x66, 0x64,
-  0x70, 0x7f, 0x8a, 0x90, 0x96, 0x9a, 0x9e, 0xa2, 0xa5, 0xa7, 0xaa, 0xaf,
-  0xb0, 0xa6, 0x90, 0x75, 0x64, 0x65, 0x74, 0x87, 0x93, 0x91, 0x85, 0x76,
-  0x71, 0x77, 0x81, 0x84, 0x7c, 0x6a, 0x59, 0x52, 0x57, 0x64, 0x73, 0x80,
-  0x8d, 0x9b, 0xa6, 0xa8, 0x9a, 0x7c, 0x59, 0x45, 0x4a, 0x60, 0x72, 0x72,
-  0x60, 0x4b, 0x48, 0x60, 0x86, 0xa6, 0xb3, 0xa5, 0x87, 0x6e, 0x6a, 0x77,
-  0x85, 0x8c, 0x8e, 0x8e, 0x90, 0x93, 0x96, 0x9a, 0x9e, 0xa3, 0xac, 0xb3,
-  0xb1, 0xa2, 0x8c, 0x76, 0x6b, 0x6f, 0x7c, 0x88, 0x8a, 0x82, 0x74, 0x6a,
-  0x6d, 0x7a, 0x85, 0x84, 0x77, 0x65, 0x5a, 0x5a, 0x64, 0x70, 0x7b, 0x87,
-  0x93, 0x9e, 0xa3, 0x9a, 0x81, 0x5f, 0x48, 0x4a, 0x60, 0x76, 0x7c, 0x6a,
-  0x4f, 0x43, 0x55, 0x78, 0x9a, 0xa9, 0xa1, 0x86, 0x6f, 0x6a, 0x77, 0x89,
-  0x94, 0x96, 0x90, 0x8a, 0x8a, 0x92, 0x99, 0x9e, 0xa3, 0xa8, 0xaa, 0xa8,
-  0x9d, 0x8c, 0x7a, 0x70, 0x74, 0x81, 0x8a, 0x89, 0x7e, 0x6d, 0x64, 0x68,
-  0x75, 0x80, 0x82, 0x78, 0x69, 0x5e, 0x5f, 0x6a, 0x76, 0x80, 0x88, 0x90,
-  0x98, 0x9d, 0x99, 0x87, 0x6a, 0x4f, 0x48, 0x58, 0x6e, 0x78, 0x6f, 0x56,
-  0x44, 0x4e, 0x6e, 0x92, 0xaa, 0xa9, 0x90, 0x71, 0x66, 0x74, 0x8b, 0x98,
-  0x98, 0x91, 0x88, 0x86, 0x8e, 0x99, 0x9f, 0xa1, 0xa3, 0xa4, 0xa3, 0x9e,
-  0x92, 0x82, 0x77, 0x77, 0x7e, 0x86, 0x86, 0x7c, 0x6c, 0x62, 0x66, 0x72,
-  0x7e, 0x82, 0x79, 0x69, 0x5e, 0x5e, 0x69, 0x76, 0x81, 0x87, 0x8d, 0x93,
-  0x98, 0x97, 0x8a, 0x6f, 0x54, 0x4b, 0x57, 0x6c, 0x79, 0x74, 0x5d, 0x4a,
-  0x4e, 0x6a, 0x8c, 0xa6, 0xa9, 0x94, 0x78, 0x6d, 0x76, 0x89, 0x97, 0x9b,
-  0x94, 0x8a, 0x86, 0x8b, 0x95, 0x9e, 0xa2, 0xa4, 0xa5, 0xa5, 0xa0, 0x97,
-  0x8a, 0x7e, 0x7b, 0x7e, 0x83, 0x85, 0x7e, 0x72, 0x68, 0x66, 0x6d, 0x79,
-  0x82, 0x80, 0x76, 0x6b, 0x67, 0x6d, 0x79, 0x84, 0x8a, 0x8f, 0x94, 0x9a,
-  0x9c, 0x94, 0x7e, 0x64, 0x54, 0x58, 0x6a, 0x79, 0x7a, 0x69, 0x54, 0x50,
-  0x61, 0x7e, 0x9a, 0xa5, 0x9a, 0x81, 0x6f, 0x71, 0x82, 0x95, 0x9e, 0x98,
-  0x8c, 0x82, 0x83, 0x8e, 0x99, 0xa0, 0xa2, 0xa2, 0xa0, 0x9e, 0x9a, 0x91,
-  0x87, 0x7f, 0x7e, 0x81, 0x84, 0x82, 0x78, 0x6d, 0x68, 0x6b, 0x76, 0x7f,
-  0x7f, 0x76, 0x6b, 0x66, 0x6c, 0x78, 0x85, 0x8d, 0x90, 0x93, 0x97, 0x9a,
-  0x95, 0x85, 0x6b, 0x56, 0x54, 0x62, 0x71, 0x74, 0x6a, 0x57, 0x4d, 0x58,
-  0x75, 0x92, 0xa0, 0x9b, 0x86, 0x72, 0x70, 0x7f, 0x92, 0x9c, 0x9a, 0x8f,
-  0x84, 0x82, 0x8a, 0x96, 0x9e, 0xa2, 0xa0, 0x9e, 0x9c, 0x97, 0x91, 0x89,
-  0x82, 0x7e, 0x7e, 0x81, 0x80, 0x77, 0x6c, 0x65, 0x68, 0x73, 0x7d, 0x81,
-  0x7a, 0x70, 0x6a, 0x6c, 0x75, 0x81, 0x8b, 0x92, 0x95, 0x97, 0x99, 0x98,
-  0x8e, 0x78, 0x63, 0x5a, 0x60, 0x6e, 0x75, 0x6e, 0x5e, 0x51, 0x56, 0x6f,
-  0x8b, 0x9e, 0x9d, 0x8a, 0x76, 0x72, 0x7c, 0x8e, 0x9a, 0x99, 0x8d, 0x81,
-  0x7c, 0x83, 0x90, 0x9a, 0x9e, 0x9c, 0x98, 0x94, 0x91, 0x8c, 0x88, 0x83,
-  0x7e, 0x7e, 0x7d, 0x7b, 0x75, 0x6a, 0x63, 0x64, 0x6b, 0x74, 0x79, 0x77,
-  0x70, 0x6c, 0x6d, 0x75, 0x81, 0x8c, 0x91, 0x93, 0x96, 0x98, 0x97, 0x8e,
-  0x7c, 0x66, 0x59, 0x5c, 0x68, 0x71, 0x71, 0x66, 0x57, 0x54, 0x63, 0x7e,
-  0x97, 0xa3, 0x9c, 0x87, 0x77, 0x78, 0x87, 0x97, 0x9e, 0x98, 0x8b, 0x7f,
-  0x7d, 0x87, 0x96, 0x9f, 0xa1, 0x9c, 0x98, 0x94, 0x92, 0x8e, 0x8a, 0x83,
-  0x7e, 0x7c, 0x7b, 0x77, 0x71, 0x6a, 0x66, 0x68, 0x6e, 0x74, 0x75, 0x71,
-  0x6b, 0x69, 0x6f, 0x7a, 0x87, 0x8e, 0x91, 0x93, 0x96, 0x98, 0x97, 0x8c,
-  0x78, 0x63, 0x5a, 0x5f, 0x6c, 0x73, 0x71, 0x66, 0x5a, 0x5c, 0x6e, 0x87,
-  0x9a, 0x9e, 0x93, 0x83, 0x7b, 0x82, 0x90, 0x9b, 0x9b, 0x91, 0x84, 0x7c,
-  0x80, 0x8a, 0x94, 0x9a, 0x9a, 0x95, 0x94, 0x94, 0x93, 0x90, 0x8a, 0x84,
-  0x80, 0x7b, 0x76, 0x71, 0x6c, 0x68, 0x68, 0x6b, 0x71, 0x74, 0x70, 0x6d,
-  0x6d, 0x72, 0x7b, 0x85, 0x8b, 0x91, 0x94, 0x94, 0x96, 0x95, 0x8c, 0x7c,
-  0x68, 0x5a, 0x5c, 0x67, 0x6d, 0x6b, 0x63, 0x5b, 0x5b, 0x69, 0x7f, 0x93,
-  0x9c, 0x97, 0x87, 0x7c, 0x7e, 0x8a, 0x97, 0x9a, 0x92, 0x86, 0x7d, 0x7f,
-  0x89, 0x93, 0x9a, 0x9a, 0x95, 0x90, 0x90, 0x91, 0x90, 0x8d, 0x88, 0x81,
-  0x7c, 0x78, 0x73, 0x6d, 0x67, 0x66, 0x68, 0x6d, 0x71, 0x72, 0x6f, 0x6d,
-  0x6e, 0x74, 0x7e, 0x89, 0x8e, 0x90, 0x91, 0x94, 0x96, 0x96, 0x8e, 0x7e,
-  0x6c, 0x5f, 0x5e, 0x66, 0x6d, 0x6c, 0x61, 0x57, 0x5a, 0x69, 0x7f, 0x93,
-  0x9c, 0x94, 0x86, 0x7e, 0x85, 0x92, 0x9c, 0x9a, 0x8e, 0x82, 0x7c, 0x81,
-  0x8c, 0x96, 0x9a, 0x96, 0x91, 0x8f, 0x8f, 0x90, 0x90, 0x8c, 0x87, 0x81,
-  0x7b, 0x76, 0x72, 0x6e, 0x68, 0x67, 0x6b, 0x70, 0x70, 0x6d, 0x6b, 0x6c,
-  0x71, 0x7a, 0x84, 0x8c, 0x92, 0x93, 0x94, 0x95, 0x96, 0x92, 0x85, 0x71,
-  0x61, 0x5c, 0x63, 0x6b, 0x6e, 0x68, 0x5e, 0x5c, 0x65, 0x77, 0x8c, 0x9a,
-  0x9c, 0x92, 0x86, 0x83, 0x8c, 0x99, 0xa0, 0x9b, 0x8c, 0x80, 0x7c, 0x81,
-  0x8c, 0x96, 0x9b, 0x99, 0x94, 0x90, 0x91, 0x94, 0x96, 0x92, 0x8b, 0x86,
-  0x80, 0x7a, 0x74, 0x6f, 0x6c, 0x6a, 0x6c, 0x70, 0x73, 0x73, 0x72, 0x72,
-  0x74, 0x7a, 0x83, 0x8c, 0x91, 0x92, 0x92, 0x97, 0x9a, 0x98, 0x8e, 0x7c,
-  0x6a, 0x61, 0x62, 0x67, 0x6c, 0x6b, 0x63, 0x5a, 0x5d, 0x6e, 0x83, 0x93,
-  0x98, 0x93, 0x89, 0x84, 0x8a, 0x93, 0x9c, 0x9c, 0x92, 0x84, 0x7d, 0x80,
-  0x88, 0x90, 0x94, 0x92, 0x8f, 0x8f, 0x90, 0x91, 0x91, 0x90, 0x8d, 0x87,
-  0x80, 0x77, 0x72, 0x6e, 0x6b, 0x69, 0x6a, 0x6c, 0x6e, 0x6e, 0x6c, 0x6d,
-  0x73, 0x7b, 0x83, 0x89, 0x8c, 0x91, 0x95, 0x97, 0x96, 0x94, 0x8a, 0x79,
-  0x68, 0x5f, 0x60, 0x66, 0x68, 0x65, 0x60, 0x5d, 0x63, 0x72, 0x84, 0x92,
-  0x96, 0x94, 0x8d, 0x87, 0x8b, 0x95, 0x9c, 0x98, 0x8c, 0x80, 0x7c, 0x80,
-  0x88, 0x8d, 0x92, 0x94, 0x93, 0x8f, 0x8e, 0x91, 0x94, 0x92, 0x8c, 0x85,
-  0x7f, 0x79, 0x72, 0x6e, 0x6b, 0x6a, 0x6b, 0x6b, 0x6b, 0x6d, 0x6f, 0x70,
-  0x73, 0x78, 0x7d, 0x85, 0x8b, 0x8e, 0x8e, 0x90, 0x93, 0x90, 0x87, 0x78,
-  0x6b, 0x62, 0x60, 0x63, 0x66, 0x67, 0x65, 0x61, 0x60, 0x6a, 0x7b, 0x8a,
-  0x92, 0x91, 0x8b, 0x88, 0x89, 0x8e, 0x94, 0x95, 0x8e, 0x84, 0x7c, 0x7b,
-  0x80, 0x87, 0x8c, 0x8e, 0x8c, 0x8a, 0x8b, 0x8c, 0x90, 0x90, 0x8e, 0x89,
-  0x82, 0x7b, 0x76, 0x73, 0x72, 0x6e, 0x6d, 0x6e, 0x6e, 0x6f, 0x6f, 0x71,
-  0x75, 0x7c, 0x81, 0x86, 0x89, 0x8d, 0x91, 0x94, 0x96, 0x94, 0x8d, 0x81,
-  0x72, 0x66, 0x60, 0x61, 0x65, 0x67, 0x65, 0x61, 0x60, 0x66, 0x73, 0x83,
-  0x8f, 0x94, 0x92, 0x8c, 0x8a, 0x8b, 0x90, 0x94, 0x91, 0x87, 0x7f, 0x7b,
-  0x7c, 0x83, 0x8a, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x90, 0x92, 0x92, 0x8e,
-  0x86, 0x7f, 0x7a, 0x75, 0x72, 0x6f, 0x6d, 0x6c, 0x6c, 0x6c, 0x6e, 0x70,
-  0x73, 0x77, 0x7b, 0x7f, 0x84, 0x89, 0x8e, 0x94, 0x97, 0x98, 0x94, 0x8a,
-  0x7d, 0x6f, 0x65, 0x64, 0x67, 0x68, 0x67, 0x63, 0x5e, 0x5e, 0x67, 0x77,
-  0x86, 0x91, 0x93, 0x8e, 0x89, 0x89, 0x8e, 0x94, 0x97, 0x92, 0x88, 0x7f,
-  0x7b, 0x7e, 0x84, 0x8a, 0x8e, 0x8e, 0x8d, 0x8e, 0x90, 0x92, 0x93, 0x92,
-  0x8d, 0x87, 0x81, 0x7b, 0x76, 0x73, 0x71, 0x6f, 0x6e, 0x6e, 0x6e, 0x6f,
-  0x71, 0x73, 0x78, 0x7c, 0x81, 0x85, 0x8a, 0x90, 0x95, 0x97, 0x97, 0x90,
-  0x84, 0x77, 0x6c, 0x64, 0x64, 0x66, 0x66, 0x63, 0x5f, 0x5e, 0x64, 0x71,
-  0x82, 0x8e, 0x94, 0x91, 0x8c, 0x8a, 0x8b, 0x91, 0x95, 0x92, 0x89, 0x7f,
-  0x78, 0x78, 0x7e, 0x86, 0x8b, 0x8e, 0x8e, 0x8d, 0x8d, 0x8e, 0x8f, 0x8e,
-  0x8c, 0x88, 0x83, 0x7d, 0x77, 0x72, 0x6f, 0x6f, 0x6f, 0x70, 0x70, 0x71,
-  0x72, 0x75, 0x78, 0x7a, 0x7e, 0x82, 0x88, 0x8e, 0x94, 0x99, 0x99, 0x94,
-  0x8b, 0x80, 0x74, 0x6b, 0x66, 0x66, 0x67, 0x65, 0x62, 0x5f, 0x60, 0x67,
-  0x74, 0x84, 0x90, 0x92, 0x8e, 0x88, 0x87, 0x8b, 0x91, 0x94, 0x90, 0x86,
-  0x7c, 0x79, 0x7b, 0x82, 0x8a, 0x8e, 0x8f, 0x8f, 0x8e, 0x8e, 0x90, 0x91,
-  0x90, 0x8d, 0x86, 0x80, 0x79, 0x74, 0x71, 0x70, 0x70, 0x70, 0x71, 0x72,
-  0x73, 0x76, 0x78, 0x7a, 0x7d, 0x81, 0x86, 0x8c, 0x94, 0x99, 0x9b, 0x98,
-  0x8f, 0x84, 0x79, 0x71, 0x6c, 0x6b, 0x6b, 0x6a, 0x66, 0x64, 0x63, 0x69,
-  0x75, 0x84, 0x8e, 0x91, 0x8f, 0x8a, 0x88, 0x8b, 0x8f, 0x92, 0x90, 0x88,
-  0x7e, 0x78, 0x79, 0x81, 0x89, 0x90, 0x91, 0x8f, 0x8d, 0x8c, 0x8d, 0x90,
-  0x91, 0x8e, 0x88, 0x81, 0x7c, 0x77, 0x74, 0x73, 0x72, 0x72, 0x72, 0x72,
-  0x73, 0x75, 0x76, 0x78, 0x7c, 0x7f, 0x84, 0x8a, 0x91, 0x98, 0x9c, 0x9c,
-  0x94, 0x8b, 0x81, 0x77, 0x70, 0x6e, 0x6e, 0x6e, 0x6b, 0x68, 0x67, 0x6c,
-  0x76, 0x82, 0x8e, 0x93, 0x91, 0x8d, 0x8a, 0x8c, 0x92, 0x96, 0x96, 0x8f,
-  0x86, 0x7e, 0x7e, 0x84, 0x8c, 0x91, 0x93, 0x92, 0x8e, 0x8d, 0x8d, 0x8f,
-  0x8e, 0x8c, 0x86, 0x80, 0x7a, 0x75, 0x72, 0x70, 0x70, 0x71, 0x71, 0x72,
-  0x72, 0x75, 0x78, 0x7a, 0x7d, 0x80, 0x85, 0x8b, 0x92, 0x99, 0x9d, 0x9c,
-  0x95, 0x8b, 0x80, 0x76, 0x6d, 0x68, 0x68, 0x69, 0x68, 0x66, 0x64, 0x66,
-  0x6e, 0x7a, 0x88, 0x90, 0x92, 0x8d, 0x88, 0x87, 0x8b, 0x90, 0x92, 0x8e,
-  0x86, 0x7e, 0x7c, 0x81, 0x8a, 0x91, 0x95, 0x95, 0x92, 0x91, 0x90, 0x91,
-  0x8f, 0x8c, 0x87, 0x82, 0x7b, 0x77, 0x75, 0x72, 0x6f, 0x6e, 0x6e, 0x70,
-  0x72, 0x72, 0x73, 0x74, 0x75, 0x78, 0x7c, 0x83, 0x8a, 0x91, 0x97, 0x9b,
-  0x9a, 0x94, 0x89, 0x7d, 0x73, 0x6b, 0x68, 0x6a, 0x6a, 0x68, 0x65, 0x63,
-  0x67, 0x72, 0x7f, 0x89, 0x8d, 0x8c, 0x87, 0x82, 0x84, 0x89, 0x8d, 0x8e,
-  0x8a, 0x84, 0x7f, 0x7f, 0x86, 0x8e, 0x93, 0x94, 0x93, 0x91, 0x8f, 0x8e,
-  0x8b, 0x86, 0x81, 0x7c, 0x78, 0x74, 0x72, 0x70, 0x6d, 0x6a, 0x6a, 0x6e,
-  0x71, 0x73, 0x74, 0x74, 0x75, 0x74, 0x75, 0x7a, 0x82, 0x8b, 0x92, 0x99,
-  0x9c, 0x98, 0x8e, 0x82, 0x76, 0x6c, 0x66, 0x64, 0x65, 0x65, 0x62, 0x5f,
-  0x60, 0x66, 0x71, 0x7f, 0x89, 0x8c, 0x8a, 0x82, 0x7d, 0x82, 0x89, 0x8d,
-  0x8b, 0x86, 0x80, 0x7e, 0x80, 0x87, 0x8e, 0x93, 0x93, 0x91, 0x91, 0x8f,
-  0x8c, 0x85, 0x80, 0x7c, 0x78, 0x75, 0x74, 0x72, 0x6f, 0x6c, 0x6a, 0x6e,
-  0x73, 0x76, 0x75, 0x74, 0x73, 0x70, 0x70, 0x75, 0x7e, 0x88, 0x91, 0x98,
-  0x9f, 0xa2, 0x9b, 0x8e, 0x83, 0x78, 0x6d, 0x66, 0x65, 0x64, 0x63, 0x61,
-  0x60, 0x64, 0x6d, 0x79, 0x85, 0x8e, 0x8f, 0x88, 0x81, 0x80, 0x83, 0x87,
-  0x88, 0x87, 0x84, 0x81, 0x80, 0x84, 0x8c, 0x94, 0x97, 0x96, 0x94, 0x92,
-  0x8e, 0x89, 0x82, 0x7a, 0x76, 0x74, 0x73, 0x74, 0x75, 0x72, 0x6d, 0x6c,
-  0x6e, 0x73, 0x76, 0x76, 0x73, 0x6e, 0x6c, 0x6c, 0x72, 0x7b, 0x87, 0x94,
-  0x9f, 0xa7, 0xa7, 0xa0, 0x95, 0x8a, 0x7e, 0x6f, 0x62, 0x5e, 0x5f, 0x5e,
-  0x5e, 0x60, 0x65, 0x6c, 0x76, 0x82, 0x8d, 0x92, 0x8c, 0x84, 0x7d, 0x7c,
-  0x7e, 0x82, 0x83, 0x83, 0x82, 0x82, 0x86, 0x8e, 0x95, 0x9a, 0x9b, 0x99,
-  0x96, 0x91, 0x8a, 0x84, 0x7b, 0x73, 0x6f, 0x70, 0x74, 0x78, 0x78, 0x77,
-  0x75, 0x74, 0x74, 0x72, 0x72, 0x71, 0x6e, 0x69, 0x67, 0x6a, 0x70, 0x7b,
-  0x89, 0x98, 0xa7, 0xb0, 0xb3, 0xac, 0xa0, 0x92, 0x81, 0x70, 0x62, 0x5a,
-  0x58, 0x5a, 0x5f, 0x65, 0x6a, 0x70, 0x78, 0x84, 0x8d, 0x92, 0x8e, 0x84,
-  0x79, 0x73, 0x73, 0x78, 0x80, 0x85, 0x87, 0x8b, 0x92, 0x9a, 0xa0, 0xa2,
-  0xa3, 0xa0, 0x9a, 0x8f, 0x86, 0x7f, 0x7a, 0x73, 0x70, 0x72, 0x78, 0x7e,
-  0x82, 0x82, 0x80, 0x7b, 0x76, 0x6f, 0x69, 0x64, 0x61, 0x60, 0x62, 0x68,
-  0x71, 0x7c, 0x8c, 0x9e, 0xaf, 0xbb, 0xc0, 0xbb, 0xac, 0x97, 0x84, 0x75,
-  0x65, 0x56, 0x52, 0x59, 0x66, 0x71, 0x7a, 0x7d, 0x7e, 0x7e, 0x80, 0x81,
-  0x7f, 0x77, 0x6a, 0x62, 0x64, 0x70, 0x7f, 0x8e, 0x98, 0x9f, 0xa6, 0xab,
-  0xae, 0xac, 0xa6, 0x9c, 0x91, 0x87, 0x80, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e,
-  0x81, 0x84, 0x89, 0x88, 0x80, 0x74, 0x6a, 0x61, 0x59, 0x53, 0x54, 0x5a,
-  0x63, 0x70, 0x7c, 0x8b, 0x97, 0xa1, 0xa9, 0xb3, 0xbe, 0xc0, 0xb4, 0x9e,
-  0x8c, 0x80, 0x79, 0x74, 0x6c, 0x65, 0x64, 0x6c, 0x77, 0x80, 0x81, 0x78,
-  0x6b, 0x62, 0x5f, 0x61, 0x65, 0x68, 0x67, 0x69, 0x71, 0x83, 0x98, 0xa8,
-  0xaf, 0xae, 0xaa, 0xa6, 0xa1, 0x9c, 0x95, 0x90, 0x8d, 0x8d, 0x8f, 0x93,
-  0x96, 0x96, 0x93, 0x8d, 0x84, 0x7b, 0x73, 0x6c, 0x63, 0x5a, 0x56, 0x56,
-  0x56, 0x56, 0x57, 0x5e, 0x6b, 0x78, 0x81, 0x87, 0x8c, 0x90, 0x94, 0x9a,
-  0xa7, 0xb4, 0xb7, 0xad, 0x9e, 0x96, 0x93, 0x8f, 0x88, 0x7a, 0x66, 0x59,
-  0x5a, 0x63, 0x68, 0x65, 0x5c, 0x55, 0x53, 0x59, 0x66, 0x72, 0x77, 0x76,
-  0x75, 0x7b, 0x8a, 0x98, 0xa1, 0xa2, 0xa0, 0xa0, 0xa2, 0xa6, 0xa7, 0xa6,
-  0xa4, 0x9f, 0x9c, 0x99, 0x96, 0x93, 0x8c, 0x81, 0x77, 0x6e, 0x69, 0x64,
-  0x5e, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x5d, 0x58, 0x57, 0x60, 0x6e, 0x7c,
-  0x87, 0x8e, 0x95, 0x9a, 0xa0, 0xaa, 0xb7, 0xbf, 0xbb, 0xad, 0xa0, 0x9a,
-  0x96, 0x8e, 0x82, 0x6e, 0x57, 0x48, 0x49, 0x58, 0x63, 0x63, 0x5b, 0x52,
-  0x50, 0x56, 0x61, 0x6b, 0x70, 0x70, 0x71, 0x7b, 0x8e, 0xa2, 0xae, 0xb0,
-  0xae, 0xad, 0xb2, 0xb6, 0xb5, 0xae, 0xa2, 0x98, 0x93, 0x91, 0x8e, 0x87,
-  0x7c, 0x70, 0x66, 0x5f, 0x57, 0x4e, 0x4a, 0x4c, 0x52, 0x59, 0x5e, 0x5d,
-  0x5a, 0x56, 0x5b, 0x6c, 0x86, 0x9b, 0xa4, 0xa5, 0xa8, 0xae, 0xb3, 0xb7,
-  0xbb, 0xbb, 0xb5, 0xaa, 0xa2, 0x9c, 0x98, 0x91, 0x84, 0x73, 0x5a, 0x3f,
-  0x30, 0x34, 0x44, 0x4f, 0x52, 0x4f, 0x4e, 0x52, 0x5c, 0x69, 0x74, 0x79,
-  0x79, 0x7c, 0x89, 0xa0, 0xb7, 0xc3, 0xc5, 0xc0, 0xbd, 0xbe, 0xc0, 0xbd,
-  0xae, 0x99, 0x87, 0x7c, 0x77, 0x75, 0x70, 0x68, 0x5e, 0x55, 0x4d, 0x48,
-  0x44, 0x3f, 0x41, 0x4b, 0x57, 0x5f, 0x62, 0x62, 0x64, 0x6e, 0x84, 0xa2,
-  0xb8, 0xc0, 0xbb, 0xb5, 0xb5, 0xb5, 0xb1, 0xa9, 0xa1, 0x9b, 0x97, 0x96,
-  0x98, 0x9a, 0x93, 0x83, 0x6d, 0x51, 0x2f, 0x16, 0x16, 0x2c, 0x48, 0x5b,
-  0x63, 0x65, 0x67, 0x6f, 0x7b, 0x82, 0x80, 0x7c, 0x82, 0x97, 0xb6, 0xd2,
-  0xde, 0xda, 0xcd, 0xc1, 0xbd, 0xbc, 0xb1, 0x99, 0x77, 0x5e, 0x57, 0x5d,
-  0x64, 0x63, 0x5c, 0x55, 0x4f, 0x4a, 0x44, 0x3e, 0x3a, 0x3f, 0x4c, 0x5f,
-  0x73, 0x82, 0x8c, 0x96, 0xa1, 0xac, 0xb8, 0xc1, 0xc0, 0xb6, 0xaa, 0xa8,
-  0xa9, 0xa3, 0x96, 0x86, 0x7e, 0x7e, 0x84, 0x8b, 0x8f, 0x8b, 0x7e, 0x68,
-  0x4a, 0x26, 0x09, 0x02, 0x1d, 0x50, 0x7b, 0x8d, 0x92, 0x90, 0x8c, 0x8c,
-  0x8a, 0x86, 0x82, 0x87, 0x9c, 0xbe, 0xdb, 0xe6, 0xde, 0xca, 0xb5, 0xa6,
-  0x9f, 0x96, 0x7e, 0x5e, 0x42, 0x3a, 0x46, 0x57, 0x61, 0x60, 0x5b, 0x54,
-  0x4f, 0x48, 0x40, 0x3c, 0x45, 0x5c, 0x7d, 0x9a, 0xab, 0xb3, 0xb8, 0xb9,
-  0xb5, 0xaf, 0xad, 0xaa, 0xa4, 0x9e, 0x9f, 0xa1, 0x9c, 0x8e, 0x7d, 0x6c,
-  0x5e, 0x57, 0x5c, 0x68, 0x75, 0x7a, 0x74, 0x5e, 0x3a, 0x15, 0x0b, 0x2b,
-  0x64, 0x8e, 0xa7, 0xb2, 0xac, 0xa0, 0x99, 0x96, 0x93, 0x8f, 0x94, 0xa9,
-  0xc6, 0xda, 0xd5, 0xba, 0x9e, 0x8b, 0x82, 0x7b, 0x71, 0x5e, 0x47, 0x3a,
-  0x3e, 0x4c, 0x5c, 0x67, 0x6a, 0x68, 0x65, 0x61, 0x5c, 0x5c, 0x60, 0x6f,
-  0x89, 0xa5, 0xba, 0xc6, 0xc5, 0xbc, 0xb0, 0xa5, 0x9a, 0x90, 0x8a, 0x8b,
-  0x8f, 0x91, 0x90, 0x8a, 0x80, 0x71, 0x5f, 0x52, 0x4a, 0x47, 0x47, 0x4f,
-  0x64, 0x7e, 0x94, 0x9c, 0x8e, 0x65, 0x39, 0x33, 0x5c, 0x94, 0xbc, 0xc8,
-  0xbc, 0xaa, 0xa3, 0xa7, 0xa9, 0x9d, 0x87, 0x79, 0x81, 0x98, 0xa6, 0x9a,
-  0x7a, 0x61, 0x5c, 0x65, 0x6d, 0x68, 0x55, 0x44, 0x45, 0x57, 0x6f, 0x7e,
-  0x83, 0x83, 0x86, 0x8d, 0x8f, 0x8a, 0x84, 0x87, 0x94, 0xa4, 0xae, 0xad,
-  0xa6, 0x9d, 0x93, 0x88, 0x7d, 0x71, 0x67, 0x60, 0x64, 0x6f, 0x77, 0x79,
-  0x76, 0x72, 0x6e, 0x67, 0x5e, 0x5b, 0x5e, 0x64, 0x6e, 0x7d, 0x8f, 0xa0,
-  0xac, 0xb6, 0xb9, 0xaa, 0x83, 0x58, 0x43, 0x51, 0x76, 0x9d, 0xbb, 0xc3,
-  0xac, 0x81, 0x60, 0x52, 0x4d, 0x4e, 0x53, 0x5a, 0x66, 0x74, 0x82, 0x89,
-  0x88, 0x7d, 0x71, 0x6c, 0x70, 0x77, 0x7b, 0x7e, 0x84, 0x8e, 0x9a, 0xa5,
-  0xa9, 0xa3, 0x93, 0x7f, 0x70, 0x67, 0x68, 0x6e, 0x76, 0x7d, 0x7e, 0x79,
-  0x70, 0x6b, 0x6c, 0x6d, 0x6b, 0x67, 0x64, 0x65, 0x6d, 0x7c, 0x8f, 0x9e,
-  0xa4, 0x9e, 0x92, 0x86, 0x7b, 0x74, 0x73, 0x78, 0x83, 0x8f, 0x97, 0x9b,
-  0x9c, 0x98, 0x93, 0x89, 0x6f, 0x44, 0x23, 0x28, 0x55, 0x8c, 0xb2, 0xb9,
-  0x9c, 0x70, 0x5a, 0x62, 0x6f, 0x70, 0x6b, 0x72, 0x8c, 0xb3, 0xcc, 0xc7,
-  0xad, 0x92, 0x81, 0x7d, 0x80, 0x7e, 0x76, 0x73, 0x7c, 0x8a, 0x90, 0x8b,
-  0x7e, 0x6e, 0x66, 0x61, 0x5c, 0x59, 0x61, 0x73, 0x89, 0x9a, 0x9f, 0x95,
-  0x84, 0x7c, 0x83, 0x8d, 0x8f, 0x89, 0x82, 0x82, 0x89, 0x90, 0x98, 0x9e,
-  0x9a, 0x8a, 0x76, 0x67, 0x62, 0x62, 0x67, 0x72, 0x7d, 0x80, 0x7c, 0x7b,
-  0x7e, 0x85, 0x8a, 0x8e, 0x89, 0x72, 0x56, 0x4a, 0x5c, 0x83, 0xb0, 0xd2,
-  0xd6, 0xb5, 0x7f, 0x55, 0x4a, 0x5d, 0x7c, 0x94, 0xa1, 0xa1, 0x9a, 0x90,
-  0x89, 0x81, 0x76, 0x6c, 0x66, 0x6a, 0x75, 0x82, 0x8c, 0x92, 0x92, 0x8f,
-  0x8b, 0x89, 0x84, 0x7e, 0x79, 0x76, 0x78, 0x82, 0x8f, 0x99, 0x9d, 0x95,
-  0x85, 0x72, 0x65, 0x64, 0x6e, 0x80, 0x8c, 0x8f, 0x8a, 0x84, 0x80, 0x7d,
-  0x7c, 0x7e, 0x7e, 0x7b, 0x7a, 0x7f, 0x88, 0x8f, 0x93, 0x95, 0x92, 0x8c,
-  0x87, 0x87, 0x8b, 0x8e, 0x8a, 0x7b, 0x69, 0x5e, 0x65, 0x77, 0x8c, 0x9b,
-  0x9c, 0x8d, 0x77, 0x69, 0x6a, 0x75, 0x81, 0x8b, 0x92, 0x98, 0x9a, 0x9a,
-  0x97, 0x92, 0x8a, 0x80, 0x7b, 0x7d, 0x84, 0x89, 0x89, 0x87, 0x82, 0x7e,
-  0x79, 0x75, 0x73, 0x71, 0x6e, 0x6f, 0x74, 0x7c, 0x82, 0x88, 0x8a, 0x88,
-  0x83, 0x7b, 0x79, 0x7e, 0x88, 0x90, 0x90, 0x8d, 0x8a, 0x87, 0x85, 0x84,
-  0x84, 0x82, 0x7c, 0x79, 0x7a, 0x7d, 0x7f, 0x7d, 0x7b, 0x79, 0x78, 0x77,
-  0x77, 0x7a, 0x7f, 0x85, 0x8b, 0x8e, 0x8a, 0x7f, 0x72, 0x6b, 0x71, 0x82,
-  0x95, 0xa4, 0xa7, 0x9a, 0x81, 0x6c, 0x62, 0x65, 0x72, 0x82, 0x8e, 0x92,
-  0x8d, 0x82, 0x74, 0x6b, 0x69, 0x6c, 0x74, 0x7b, 0x82, 0x84, 0x86, 0x86,
-  0x86, 0x86, 0x88, 0x88, 0x84, 0x81, 0x7e, 0x7d, 0x80, 0x84, 0x88, 0x88,
-  0x86, 0x81, 0x79, 0x72, 0x6f, 0x6f, 0x72, 0x78, 0x7e, 0x82, 0x82, 0x7e,
-  0x7a, 0x78, 0x78, 0x7a, 0x7f, 0x84, 0x87, 0x88, 0x88, 0x89, 0x8a, 0x89,
-  0x86, 0x85, 0x82, 0x80, 0x80, 0x81, 0x80, 0x7c, 0x74, 0x6a, 0x65, 0x67,
-  0x70, 0x7e, 0x8a, 0x8d, 0x88, 0x7b, 0x70, 0x6b, 0x6d, 0x76, 0x84, 0x90,
-  0x97, 0x98, 0x92, 0x88, 0x7f, 0x79, 0x77, 0x79, 0x7e, 0x81, 0x84, 0x84,
-  0x80, 0x7c, 0x7a, 0x77, 0x74, 0x73, 0x74, 0x77, 0x7a, 0x7c, 0x80, 0x83,
-  0x84, 0x83, 0x82, 0x81, 0x7f, 0x7d, 0x7f, 0x83, 0x87, 0x8a, 0x89, 0x87,
-  0x83, 0x7f, 0x7c, 0x7b, 0x7a, 0x7b, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-  0x77, 0x77, 0x77, 0x76, 0x76, 0x7a, 0x7f, 0x83, 0x87, 0x8c, 0x8e, 0x8a,
-  0x7f, 0x73, 0x6c, 0x6e, 0x77, 0x87, 0x94, 0x99, 0x94, 0x86, 0x74, 0x69,
-  0x67, 0x6e, 0x7a, 0x88, 0x91, 0x93, 0x8f, 0x87, 0x7e, 0x76, 0x71, 0x70,
-  0x76, 0x7e, 0x86, 0x8a, 0x8a, 0x86, 0x81, 0x7d, 0x7b, 0x7a, 0x79, 0x79,
-  0x79, 0x7c, 0x81, 0x85, 0x87, 0x86, 0x81, 0x7c, 0x79, 0x77, 0x79, 0x7d,
-  0x81, 0x83, 0x84, 0x80, 0x7d, 0x7a, 0x78, 0x78, 0x7a, 0x7d, 0x7f, 0x81,
-  0x82, 0x82, 0x81, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x80, 0x80,
-  0x82, 0x85, 0x89, 0x8b, 0x89, 0x85, 0x7f, 0x79, 0x73, 0x72, 0x76, 0x7e,
-  0x87, 0x8c, 0x8b, 0x85, 0x7c, 0x74, 0x71, 0x76, 0x7e, 0x86, 0x8c, 0x8f,
-  0x8c, 0x87, 0x82, 0x7c, 0x7a, 0x7b, 0x7d, 0x80, 0x84, 0x86, 0x87, 0x85,
-  0x82, 0x7e, 0x7b, 0x7a, 0x79, 0x7b, 0x7e, 0x81, 0x84, 0x85, 0x85, 0x84,
-  0x81, 0x7e, 0x7d, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-  0x7e, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x80,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7c, 0x7c, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x83, 0x7d, 0x79, 0x78,
-  0x7a, 0x81, 0x88, 0x8a, 0x88, 0x83, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x82,
-  0x85, 0x88, 0x88, 0x82, 0x7a, 0x73, 0x72, 0x77, 0x7d, 0x81, 0x82, 0x80,
-  0x7d, 0x7c, 0x7d, 0x7f, 0x80, 0x80, 0x83, 0x86, 0x89, 0x8b, 0x8a, 0x87,
-  0x85, 0x83, 0x81, 0x7f, 0x7d, 0x7b, 0x7c, 0x7e, 0x80, 0x80, 0x7e, 0x7d,
-  0x7c, 0x7d, 0x7f, 0x80, 0x7e, 0x7b, 0x76, 0x73, 0x74, 0x79, 0x82, 0x8c,
-  0x91, 0x90, 0x8a, 0x85, 0x82, 0x80, 0x81, 0x84, 0x88, 0x8a, 0x8a, 0x87,
-  0x82, 0x7b, 0x77, 0x74, 0x75, 0x78, 0x7b, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c,
-  0x7a, 0x7b, 0x7d, 0x7f, 0x82, 0x87, 0x8a, 0x8b, 0x8c, 0x8a, 0x87, 0x87,
-  0x88, 0x89, 0x87, 0x83, 0x7e, 0x79, 0x77, 0x78, 0x7d, 0x83, 0x86, 0x86,
-  0x82, 0x7b, 0x75, 0x72, 0x74, 0x78, 0x7e, 0x83, 0x87, 0x88, 0x87, 0x84,
-  0x81, 0x7e, 0x7d, 0x7e, 0x80, 0x83, 0x86, 0x87, 0x87, 0x87, 0x85, 0x81,
-  0x7d, 0x7b, 0x7b, 0x7d, 0x7e, 0x80, 0x80, 0x7f, 0x7d, 0x7b, 0x7a, 0x7a,
-  0x7a, 0x7b, 0x7c, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81,
-  0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x83, 0x84, 0x85, 0x86,
-  0x86, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x83, 0x82, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x7a, 0x7a, 0x7c,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x84,
-  0x83, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7c,
-  0x79, 0x79, 0x78, 0x77, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7e, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x84, 0x86, 0x86, 0x87, 0x85, 0x82,
-  0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7b, 0x78, 0x77, 0x78, 0x78, 0x79, 0x7b,
-  0x7d, 0x7c, 0x7a, 0x79, 0x7a, 0x7a, 0x7c, 0x80, 0x82, 0x82, 0x83, 0x85,
-  0x86, 0x87, 0x86, 0x86, 0x85, 0x83, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7e,
-  0x7d, 0x7c, 0x7d, 0x7d, 0x7c, 0x7a, 0x77, 0x77, 0x77, 0x79, 0x7c, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x84, 0x86, 0x88, 0x88, 0x87, 0x84, 0x80,
-  0x7d, 0x7c, 0x7e, 0x80, 0x82, 0x81, 0x80, 0x7f, 0x7c, 0x7a, 0x78, 0x79,
-  0x7e, 0x86, 0x89, 0x86, 0x7c, 0x72, 0x6c, 0x70, 0x7d, 0x8c, 0x94, 0x91,
-  0x84, 0x76, 0x6d, 0x6d, 0x72, 0x7e, 0x8a, 0x8f, 0x8e, 0x89, 0x82, 0x7a,
-  0x75, 0x76, 0x7b, 0x81, 0x86, 0x8a, 0x8a, 0x89, 0x86, 0x80, 0x7b, 0x78,
-  0x78, 0x7c, 0x80, 0x83, 0x83, 0x82, 0x80, 0x7e, 0x7d, 0x7c, 0x7d, 0x7f,
-  0x82, 0x84, 0x86, 0x87, 0x85, 0x82, 0x82, 0x82, 0x82, 0x84, 0x85, 0x86,
-  0x85, 0x84, 0x81, 0x7e, 0x7b, 0x79, 0x7a, 0x7c, 0x80, 0x81, 0x81, 0x7e,
-  0x7c, 0x7a, 0x79, 0x79, 0x7c, 0x80, 0x83, 0x84, 0x84, 0x82, 0x81, 0x82,
-  0x83, 0x84, 0x85, 0x86, 0x85, 0x84, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7c, 0x7b, 0x7c, 0x7e, 0x81, 0x83, 0x83, 0x80, 0x7b,
-  0x7a, 0x7c, 0x82, 0x86, 0x87, 0x86, 0x84, 0x84, 0x83, 0x83, 0x84, 0x84,
-  0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a,
-  0x7b, 0x7c, 0x7d, 0x7e, 0x7d, 0x7d, 0x80, 0x84, 0x84, 0x81, 0x80, 0x83,
-  0x86, 0x87, 0x86, 0x83, 0x7f, 0x7d, 0x7e, 0x83, 0x86, 0x86, 0x82, 0x7e,
-  0x7a, 0x79, 0x7a, 0x7b, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x81, 0x7e, 0x7b,
-  0x7b, 0x7e, 0x81, 0x82, 0x84, 0x85, 0x87, 0x89, 0x89, 0x85, 0x7e, 0x79,
-  0x78, 0x7a, 0x7f, 0x85, 0x87, 0x86, 0x83, 0x7e, 0x7b, 0x7a, 0x7a, 0x7d,
-  0x80, 0x83, 0x86, 0x88, 0x88, 0x84, 0x80, 0x7e, 0x7c, 0x7d, 0x80, 0x84,
-  0x86, 0x87, 0x85, 0x81, 0x7d, 0x7b, 0x7a, 0x7d, 0x80, 0x82, 0x84, 0x83,
-  0x81, 0x7e, 0x7d, 0x7c, 0x7c, 0x7f, 0x83, 0x87, 0x88, 0x86, 0x83, 0x81,
-  0x7e, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x82,
-  0x83, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x82, 0x84, 0x85, 0x85, 0x83, 0x80, 0x7e, 0x7e, 0x81, 0x83, 0x83, 0x83,
-  0x82, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x84, 0x84, 0x84, 0x83, 0x82,
-  0x7f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7c,
-  0x7c, 0x7e, 0x81, 0x83, 0x83, 0x84, 0x83, 0x82, 0x7f, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7f, 0x80, 0x7f, 0x7c, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7e, 0x81,
-  0x83, 0x84, 0x84, 0x81, 0x7d, 0x7a, 0x79, 0x7c, 0x80, 0x84, 0x86, 0x86,
-  0x84, 0x80, 0x7b, 0x78, 0x78, 0x7a, 0x7e, 0x82, 0x83, 0x83, 0x80, 0x7c,
-  0x79, 0x77, 0x78, 0x7a, 0x7d, 0x80, 0x82, 0x82, 0x80, 0x80, 0x7e, 0x7d,
-  0x7b, 0x7c, 0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x82,
-  0x84, 0x84, 0x80, 0x7a, 0x75, 0x73, 0x74, 0x78, 0x80, 0x86, 0x87, 0x83,
-  0x7c, 0x76, 0x74, 0x76, 0x7b, 0x81, 0x84, 0x86, 0x86, 0x82, 0x7e, 0x7b,
-  0x79, 0x78, 0x7a, 0x7c, 0x7f, 0x80, 0x80, 0x7e, 0x7c, 0x7b, 0x79, 0x7a,
-  0x7c, 0x7d, 0x80, 0x81, 0x81, 0x7f, 0x7d, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7b, 0x79, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7d,
-  0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7e, 0x80, 0x82, 0x84, 0x84, 0x83, 0x82,
-  0x80, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x83, 0x82, 0x82, 0x7f, 0x7d, 0x7c,
-  0x7b, 0x7c, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x82, 0x83, 0x83,
-  0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x80,
-  0x7e, 0x7b, 0x7a, 0x7b, 0x81, 0x86, 0x84, 0x80, 0x7c, 0x7b, 0x7c, 0x81,
-  0x85, 0x84, 0x81, 0x7e, 0x7e, 0x83, 0x86, 0x86, 0x81, 0x7c, 0x7c, 0x7e,
-  0x83, 0x86, 0x86, 0x82, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x81,
-  0x82, 0x82, 0x7f, 0x7d, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x83, 0x84, 0x82,
-  0x80, 0x7f, 0x81, 0x84, 0x85, 0x85, 0x82, 0x7c, 0x77, 0x75, 0x75, 0x78,
-  0x7c, 0x84, 0x8a, 0x8e, 0x8c, 0x86, 0x7c, 0x77, 0x77, 0x7b, 0x84, 0x8c,
-  0x92, 0x92, 0x8f, 0x88, 0x81, 0x7b, 0x78, 0x78, 0x7b, 0x80, 0x83, 0x84,
-  0x83, 0x7e, 0x78, 0x74, 0x73, 0x75, 0x78, 0x7f, 0x84, 0x86, 0x84, 0x82,
-  0x80, 0x7f, 0x80, 0x84, 0x88, 0x8c, 0x8c, 0x8a, 0x85, 0x80, 0x7e, 0x7d,
-  0x7e, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7c, 0x7a, 0x7a, 0x7b, 0x7d,
-  0x80, 0x84, 0x88, 0x8b, 0x8a, 0x84, 0x78, 0x6e, 0x6a, 0x6f, 0x7d, 0x8d,
-  0x99, 0x9e, 0x99, 0x87, 0x74, 0x6b, 0x6a, 0x73, 0x82, 0x90, 0x98, 0x9a,
-  0x92, 0x83, 0x76, 0x6d, 0x6c, 0x74, 0x7e, 0x88, 0x8d, 0x8c, 0x86, 0x7c,
-  0x74, 0x70, 0x72, 0x78, 0x81, 0x87, 0x8b, 0x8c, 0x88, 0x82, 0x7b, 0x78,
-  0x79, 0x7d, 0x82, 0x87, 0x8b, 0x8a, 0x86, 0x80, 0x7b, 0x7a, 0x7b, 0x7e,
-  0x83, 0x85, 0x86, 0x83, 0x7e, 0x7a, 0x79, 0x7a, 0x7d, 0x82, 0x86, 0x88,
-  0x8a, 0x8c, 0x8c, 0x8d, 0x8c, 0x84, 0x76, 0x6a, 0x66, 0x6b, 0x7a, 0x8c,
-  0x9a, 0x9c, 0x94, 0x80, 0x6d, 0x62, 0x61, 0x69, 0x79, 0x8d, 0x9b, 0xa0,
-  0x9a, 0x8a, 0x74, 0x67, 0x64, 0x6d, 0x7b, 0x8a, 0x93, 0x96, 0x90, 0x84,
-  0x77, 0x70, 0x70, 0x75, 0x7f, 0x89, 0x90, 0x92, 0x8c, 0x84, 0x7c, 0x76,
-  0x76, 0x7b, 0x81, 0x87, 0x8a, 0x89, 0x84, 0x7d, 0x78, 0x76, 0x79, 0x7e,
-  0x84, 0x88, 0x8c, 0x8b, 0x87, 0x82, 0x80, 0x80, 0x83, 0x87, 0x8c, 0x8f,
-  0x92, 0x94, 0x92, 0x8b, 0x7e, 0x6e, 0x63, 0x63, 0x6e, 0x7f, 0x91, 0x9b,
-  0x9b, 0x90, 0x7c, 0x6a, 0x62, 0x66, 0x73, 0x85, 0x97, 0xa2, 0xa3, 0x98,
-  0x87, 0x75, 0x6a, 0x6a, 0x74, 0x81, 0x8d, 0x94, 0x94, 0x8b, 0x7d, 0x6f,
-  0x68, 0x6a, 0x71, 0x7a, 0x83, 0x89, 0x89, 0x84, 0x7c, 0x76, 0x72, 0x74,
-  0x7a, 0x82, 0x89, 0x8b, 0x87, 0x82, 0x7d, 0x7a, 0x7a, 0x7c, 0x81, 0x84,
-  0x84, 0x84, 0x82, 0x7e, 0x78, 0x75, 0x75, 0x79, 0x7e, 0x82, 0x84, 0x87,
-  0x88, 0x88, 0x89, 0x89, 0x82, 0x76, 0x69, 0x61, 0x61, 0x6c, 0x80, 0x92,
-  0x9b, 0x99, 0x8b, 0x78, 0x67, 0x5e, 0x61, 0x70, 0x86, 0x9a, 0xa4, 0xa6,
-  0x9b, 0x86, 0x71, 0x65, 0x64, 0x6e, 0x7e, 0x8d, 0x96, 0x95, 0x8b, 0x7b,
-  0x6b, 0x63, 0x63, 0x6b, 0x77, 0x82, 0x89, 0x88, 0x81, 0x79, 0x74, 0x73,
-  0x78, 0x82, 0x8a, 0x8e, 0x8e, 0x88, 0x7f, 0x77, 0x74, 0x74, 0x7a, 0x82,
-  0x85, 0x85, 0x81, 0x7a, 0x74, 0x71, 0x70, 0x71, 0x76, 0x7c, 0x80, 0x82,
-  0x81, 0x7f, 0x7d, 0x7e, 0x81, 0x86, 0x88, 0x81, 0x73, 0x66, 0x60, 0x64,
-  0x73, 0x88, 0x9a, 0xa0, 0x99, 0x88, 0x71, 0x5e, 0x59, 0x61, 0x74, 0x8b,
-  0x9f, 0xa9, 0xa3, 0x90, 0x77, 0x63, 0x5c, 0x61, 0x72, 0x86, 0x93, 0x97,
-  0x90, 0x81, 0x6f, 0x63, 0x62, 0x6a, 0x77, 0x83, 0x8b, 0x8d, 0x88, 0x7e,
-  0x76, 0x72, 0x74, 0x7d, 0x89, 0x91, 0x91, 0x8c, 0x84, 0x7f, 0x7d, 0x7d,
-  0x7d, 0x7b, 0x79, 0x7a, 0x7e, 0x81, 0x81, 0x7c, 0x74, 0x70, 0x73, 0x79,
-  0x80, 0x85, 0x86, 0x87, 0x87, 0x87, 0x87, 0x89, 0x8d, 0x94, 0x95, 0x8a,
-  0x77, 0x66, 0x5e, 0x64, 0x77, 0x8e, 0x9e, 0xa2, 0x99, 0x83, 0x6a, 0x59,
-  0x57, 0x63, 0x7a, 0x95, 0xa8, 0xb0, 0xa9, 0x93, 0x77, 0x64, 0x5e, 0x66,
-  0x77, 0x8c, 0x9b, 0xa2, 0x9c, 0x8a, 0x75, 0x69, 0x66, 0x6b, 0x75, 0x81,
-  0x8a, 0x8d, 0x88, 0x7e, 0x73, 0x6e, 0x70, 0x79, 0x87, 0x91, 0x94, 0x91,
-  0x87, 0x7e, 0x7a, 0x7d, 0x85, 0x8e, 0x95, 0x99, 0x92, 0x82, 0x72, 0x6a,
-  0x6c, 0x75, 0x80, 0x87, 0x85, 0x7d, 0x76, 0x72, 0x73, 0x79, 0x82, 0x8a,
-  0x92, 0x9c, 0xa0, 0x93, 0x76, 0x59, 0x4b, 0x52, 0x70, 0x99, 0xba, 0xc3,
-  0xb3, 0x8c, 0x62, 0x48, 0x45, 0x54, 0x73, 0x98, 0xb4, 0xbe, 0xb5, 0x98,
-  0x72, 0x54, 0x48, 0x52, 0x6c, 0x8c, 0xa2, 0xaa, 0xa5, 0x93, 0x79, 0x61,
-  0x57, 0x5b, 0x68, 0x7c, 0x93, 0xa0, 0x9e, 0x8e, 0x75, 0x5f, 0x5a, 0x66,
-  0x7c, 0x94, 0xa2, 0xa2, 0x91, 0x79, 0x67, 0x66, 0x6f, 0x7b, 0x89, 0x94,
-  0x99, 0x95, 0x89, 0x7a, 0x6c, 0x62, 0x61, 0x6b, 0x79, 0x87, 0x8c, 0x88,
-  0x7c, 0x6f, 0x6a, 0x6e, 0x7a, 0x89, 0x99, 0xa7, 0xac, 0x9f, 0x7d, 0x53,
-  0x37, 0x37, 0x57, 0x8f, 0xbf, 0xd5, 0xc9, 0x9e, 0x64, 0x38, 0x2b, 0x3a,
-  0x63, 0x98, 0xbe, 0xd2, 0xcf, 0xb2, 0x84, 0x58, 0x41, 0x44, 0x5e, 0x84,
-  0xa8, 0xbc, 0xbc, 0xa7, 0x85, 0x62, 0x4c, 0x4c, 0x5c, 0x73, 0x8d, 0x9e,
-  0xa3, 0x97, 0x7d, 0x60, 0x50, 0x52, 0x64, 0x81, 0x9b, 0xa9, 0xa7, 0x94,
-  0x7a, 0x68, 0x66, 0x71, 0x82, 0x90, 0x98, 0x96, 0x8c, 0x7e, 0x70, 0x68,
-  0x66, 0x6c, 0x76, 0x81, 0x89, 0x89, 0x82, 0x77, 0x70, 0x74, 0x81, 0x95,
-  0xa7, 0xac, 0x98, 0x68, 0x36, 0x23, 0x39, 0x70, 0xae, 0xdd, 0xec, 0xc3,
-  0x7b, 0x3e, 0x24, 0x36, 0x67, 0x9c, 0xca, 0xec, 0xea, 0xc2, 0x8b, 0x56,
-  0x39, 0x3e, 0x5c, 0x87, 0xb0, 0xc6, 0xc0, 0xa2, 0x79, 0x55, 0x43, 0x45,
-  0x57, 0x70, 0x8c, 0xa2, 0xa8, 0x9d, 0x83, 0x62, 0x4a, 0x47, 0x57, 0x72,
-  0x92, 0xaa, 0xb1, 0xa5, 0x8e, 0x76, 0x66, 0x65, 0x72, 0x89, 0x9d, 0xa1,
-  0x97, 0x88, 0x78, 0x69, 0x62, 0x65, 0x6b, 0x71, 0x75, 0x76, 0x73, 0x6c,
-  0x67, 0x66, 0x6d, 0x7a, 0x88, 0x93, 0xa2, 0xaf, 0xb4, 0xad, 0x94, 0x66,
-  0x39, 0x29, 0x3c, 0x6b, 0xab, 0xdf, 0xec, 0xca, 0x87, 0x41, 0x17, 0x1c,
-  0x49, 0x86, 0xba, 0xe4, 0xef, 0xd0, 0x99, 0x60, 0x34, 0x2b, 0x44, 0x71,
-  0xa3, 0xca, 0xd6, 0xc4, 0x9b, 0x6a, 0x45, 0x39, 0x45, 0x60, 0x81, 0x9e,
-  0xaf, 0xad, 0x95, 0x6f, 0x48, 0x33, 0x3a, 0x59, 0x81, 0xa7, 0xbb, 0xb3,
-  0x91, 0x68, 0x50, 0x56, 0x6f, 0x8c, 0xa5, 0xb0, 0xaa, 0x99, 0x82, 0x6a,
-  0x60, 0x66, 0x73, 0x7f, 0x8a, 0x90, 0x8d, 0x83, 0x74, 0x6a, 0x72, 0x8b,
-  0xac, 0xc0, 0xb0, 0x6c, 0x1c, 0x00, 0x1b, 0x6a, 0xae, 0xee, 0xff, 0xaa,
-  0x3e, 0x05, 0x0b, 0x4d, 0x8e, 0xc2, 0xfc, 0xfa, 0xb8, 0x7c, 0x57, 0x4d,
-  0x5e, 0x76, 0x88, 0x9b, 0xaa, 0xb3, 0xb1, 0x9d, 0x7c, 0x59, 0x3f, 0x3a,
-  0x4c, 0x6b, 0x8e, 0xa8, 0xac, 0x95, 0x70, 0x4d, 0x3c, 0x48, 0x69, 0x91,
-  0xb2, 0xc3, 0xbc, 0x9f, 0x7c, 0x68, 0x6c, 0x81, 0x9e, 0xbb, 0xcc, 0xc6,
-  0xaa, 0x7e, 0x59, 0x4f, 0x58, 0x69, 0x7b, 0x89, 0x85, 0x74, 0x63, 0x59,
-  0x53, 0x55, 0x5f, 0x6b, 0x7b, 0x91, 0xa5, 0xb4, 0xbc, 0xbc, 0xaa, 0x86,
-  0x5a, 0x38, 0x38, 0x5b, 0x91, 0xca, 0xef, 0xe6, 0xad, 0x60, 0x22, 0x0b,
-  0x24, 0x5a, 0x9a, 0xd2, 0xeb, 0xdb, 0xa8, 0x6a, 0x38, 0x25, 0x35, 0x5d,
-  0x8c, 0xb6, 0xd0, 0xcc, 0xaf, 0x84, 0x5d, 0x48, 0x4b, 0x60, 0x7a, 0x94,
-  0xaa, 0xb5, 0xae, 0x93, 0x6d, 0x4c, 0x3e, 0x49, 0x66, 0x88, 0xa3, 0xae,
-  0xa0, 0x82, 0x66, 0x58, 0x60, 0x74, 0x8b, 0x9e, 0xa9, 0xa7, 0x9a, 0x89,
-  0x79, 0x6e, 0x70, 0x77, 0x82, 0x8b, 0x8e, 0x8a, 0x81, 0x75, 0x6d, 0x6f,
-  0x7b, 0x91, 0xab, 0xbe, 0xb6, 0x80, 0x31, 0x00, 0x00, 0x3c, 0x92, 0xde,
-  0xff, 0xde, 0x77, 0x1f, 0x00, 0x1c, 0x68, 0xaf, 0xe8, 0xff, 0xe6, 0xaa,
-  0x75, 0x54, 0x4e, 0x5c, 0x70, 0x87, 0xa0, 0xb4, 0xbc, 0xb1, 0x92, 0x68,
-  0x42, 0x2f, 0x34, 0x4d, 0x70, 0x93, 0xa8, 0xa4, 0x84, 0x55, 0x33, 0x2f,
-  0x49, 0x72, 0x98, 0xb0, 0xb0, 0x9a, 0x7d, 0x67, 0x62, 0x70, 0x8a, 0xa1,
-  0xb1, 0xb7, 0xb2, 0xa1, 0x87, 0x72, 0x6b, 0x76, 0x89, 0x92, 0x85, 0x6e,
-  0x5d, 0x50, 0x48, 0x4e, 0x5e, 0x67, 0x6d, 0x75, 0x7e, 0x88, 0x94, 0x95,
-  0x73, 0x38, 0x14, 0x1f, 0x4e, 0x94, 0xdc, 0xff, 0xfa, 0xb9, 0x63, 0x25,
-  0x1d, 0x4c, 0x90, 0xce, 0xfa, 0xff, 0xe8, 0xb2, 0x77, 0x46, 0x30, 0x3b,
-  0x5e, 0x87, 0xab, 0xbf, 0xb6, 0x93, 0x67, 0x42, 0x2f, 0x32, 0x46, 0x61,
-  0x80, 0x9b, 0xaa, 0xaa, 0x9b, 0x80, 0x60, 0x4e, 0x52, 0x67, 0x85, 0xa3,
-  0xb4, 0xb2, 0x9f, 0x83, 0x6d, 0x66, 0x6d, 0x7c, 0x8d, 0x9a, 0x9c, 0x94,
-  0x86, 0x74, 0x62, 0x5e, 0x66, 0x70, 0x77, 0x7f, 0x80, 0x77, 0x6b, 0x61,
-  0x60, 0x6b, 0x7d, 0x92, 0xa8, 0xb8, 0xb7, 0x99, 0x5f, 0x27, 0x14, 0x2e,
-  0x6a, 0xb3, 0xf0, 0xff, 0xd0, 0x7b, 0x31, 0x10, 0x23, 0x5d, 0xa3, 0xdd,
-  0xfc, 0xf4, 0xc7, 0x8c, 0x58, 0x3c, 0x41, 0x5d, 0x82, 0xa7, 0xc4, 0xcc,
-  0xbc, 0x9a, 0x73, 0x50, 0x3d, 0x40, 0x54, 0x70, 0x8f, 0xa9, 0xb0, 0x9b,
-  0x73, 0x4b, 0x37, 0x42, 0x60, 0x82, 0x9e, 0xad, 0xa5, 0x8c, 0x72, 0x64,
-  0x68, 0x78, 0x8b, 0x9b, 0xa5, 0xa3, 0x98, 0x88, 0x77, 0x6b, 0x69, 0x71,
-  0x7b, 0x82, 0x84, 0x83, 0x7c, 0x70, 0x68, 0x6d, 0x7d, 0x92, 0xa8, 0xb3,
-  0x9e, 0x61, 0x17, 0x00, 0x0c, 0x5c, 0xb4, 0xf9, 0xff, 0xb3, 0x45, 0x02,
-  0x04, 0x46, 0x95, 0xd2, 0xff, 0xfc, 0xca, 0x95, 0x6e, 0x5c, 0x5f, 0x6c,
-  0x7b, 0x8f, 0xa8, 0xbc, 0xc3, 0xb6, 0x94, 0x69, 0x40, 0x28, 0x2e, 0x4c,
-  0x74, 0x9c, 0xb4, 0xae, 0x89, 0x56, 0x31, 0x2a, 0x42, 0x66, 0x8a, 0xa5,
-  0xac, 0x9d, 0x87, 0x75, 0x6e, 0x75, 0x87, 0x9b, 0xa9, 0xae, 0xb0, 0xab,
-  0x9e, 0x8d, 0x83, 0x81, 0x84, 0x8a, 0x8e, 0x8e, 0x84, 0x73, 0x63, 0x58,
-  0x56, 0x5e, 0x6a, 0x71, 0x77, 0x7d, 0x7c, 0x63, 0x30, 0x04, 0x00, 0x28,
-  0x6e, 0xb6, 0xed, 0xf1, 0xaf, 0x52, 0x1b, 0x28, 0x66, 0xab, 0xde, 0xff,
-  0xff, 0xf5, 0xc4, 0x91, 0x73, 0x6e, 0x79, 0x88, 0x98, 0xa4, 0xac, 0xae,
-  0xa0, 0x81, 0x59, 0x37, 0x26, 0x2b, 0x42, 0x5e, 0x77, 0x87, 0x8a, 0x7f,
-  0x6a, 0x54, 0x45, 0x45, 0x54, 0x6f, 0x8f, 0xae, 0xc0, 0xbe, 0xa9, 0x8c,
-  0x76, 0x76, 0x88, 0x9e, 0xaf, 0xb6, 0xb1, 0x9f, 0x86, 0x72, 0x6b, 0x6c,
-  0x71, 0x73, 0x70, 0x6c, 0x66, 0x60, 0x5a, 0x5a, 0x5a, 0x5c, 0x67, 0x7b,
-  0x91, 0xa2, 0xa1, 0x7b, 0x3c, 0x11, 0x16, 0x42, 0x8a, 0xd6, 0xff, 0xf8,
-  0xb3, 0x5b, 0x20, 0x1e, 0x54, 0x9d, 0xda, 0xfc, 0xfe, 0xdc, 0xa6, 0x75,
-  0x54, 0x4c, 0x5c, 0x75, 0x90, 0xa9, 0xb7, 0xb5, 0xa0, 0x7e, 0x5b, 0x43,
-  0x3d, 0x48, 0x5f, 0x7a, 0x91, 0x9e, 0x9b, 0x8c, 0x76, 0x61, 0x57, 0x5f,
-  0x71, 0x88, 0xa0, 0xb0, 0xb1, 0xa2, 0x8c, 0x79, 0x74, 0x7e, 0x8c, 0x98,
-  0x9f, 0x9e, 0x94, 0x85, 0x79, 0x76, 0x78, 0x78, 0x79, 0x7a, 0x7a, 0x74,
-  0x6b, 0x62, 0x5c, 0x60, 0x74, 0x8c, 0x9c, 0x97, 0x73, 0x36, 0x07, 0x0a,
-  0x3a, 0x85, 0xd0, 0xfc, 0xed, 0xa0, 0x4a, 0x1b, 0x29, 0x63, 0xa8, 0xdd,
-  0xfc, 0xff, 0xe1, 0xaf, 0x80, 0x62, 0x5a, 0x67, 0x7e, 0x96, 0xac, 0xba,
-  0xb8, 0xa1, 0x7c, 0x54, 0x37, 0x2e, 0x38, 0x4f, 0x6b, 0x87, 0x98, 0x98,
-  0x8a, 0x6f, 0x4e, 0x39, 0x3b, 0x50, 0x72, 0x9b, 0xbe, 0xcd, 0xc0, 0x9b,
-  0x74, 0x63, 0x6e, 0x8a, 0xa8, 0xc0, 0xc6, 0xb6, 0x9a, 0x80, 0x71, 0x6a,
-  0x6c, 0x74, 0x77, 0x77, 0x73, 0x6c, 0x63, 0x5d, 0x5d, 0x60, 0x6a, 0x82,
-  0x9d, 0xa2, 0x7d, 0x3b, 0x05, 0x00, 0x2f, 0x7b, 0xc7, 0xff, 0xfd, 0xac,
-  0x48, 0x10, 0x1c, 0x59, 0xa2, 0xda, 0xff, 0xff, 0xe5, 0xaf, 0x7b, 0x5b,
-  0x55, 0x63, 0x7d, 0x97, 0xaf, 0xbd, 0xbb, 0xa7, 0x89, 0x68, 0x4b, 0x38,
-  0x33, 0x41, 0x5e, 0x84, 0xa5, 0xb0, 0x99, 0x6c, 0x44, 0x33, 0x3f, 0x61,
-  0x8c, 0xb4, 0xca, 0xc4, 0xa7, 0x82, 0x67, 0x67, 0x7d, 0x9b, 0xb4, 0xbf,
-  0xb7, 0xa2, 0x8b, 0x79, 0x72, 0x74, 0x7a, 0x7f, 0x80, 0x7b, 0x75, 0x72,
-  0x72, 0x6e, 0x66, 0x64, 0x6e, 0x79, 0x81, 0x7b, 0x54, 0x17, 0x00, 0x0b,
-  0x4c, 0x9c, 0xe1, 0xfa, 0xc4, 0x60, 0x1b, 0x14, 0x46, 0x8c, 0xc4, 0xf4,
-  0xff, 0xf4, 0xc5, 0x91, 0x6b, 0x60, 0x6c, 0x83, 0x99, 0xae, 0xbd, 0xc0,
-  0xb2, 0x91, 0x6a, 0x48, 0x31, 0x2e, 0x3d, 0x53, 0x6d, 0x87, 0x94, 0x8d,
-  0x74, 0x51, 0x32, 0x29, 0x3c, 0x60, 0x8a, 0xb1, 0xc6, 0xbe, 0x9e, 0x76,
-  0x64, 0x72, 0x92, 0xb1, 0xc6, 0xc9, 0xb9, 0x9f, 0x89, 0x7e, 0x7c, 0x7f,
-  0x7b, 0x76, 0x74, 0x74, 0x72, 0x6e, 0x68, 0x5f, 0x59, 0x5d, 0x6f, 0x8c,
-  0xa4, 0x9c, 0x63, 0x19, 0x00, 0x0d, 0x51, 0xa0, 0xe5, 0xff, 0xcc, 0x64,
-  0x19, 0x0e, 0x3a, 0x7d, 0xb7, 0xe5, 0xff, 0xf7, 0xd0, 0x9e, 0x6f, 0x54,
-  0x56, 0x70, 0x91, 0xae, 0xc0, 0xc2, 0xb5, 0x9d, 0x7e, 0x5d, 0x41, 0x30,
-  0x2f, 0x42, 0x62, 0x86, 0xa0, 0xa6, 0x8e, 0x64, 0x3e, 0x2d, 0x31, 0x48,
-  0x6e, 0x99, 0xbc, 0xc7, 0xb0, 0x84, 0x5f, 0x56, 0x6c, 0x8c, 0xaa, 0xbc,
-  0xbe, 0xaf, 0x9c, 0x8b, 0x7c, 0x73, 0x71, 0x75, 0x7c, 0x81, 0x81, 0x7c,
-  0x76, 0x70, 0x6b, 0x64, 0x5f, 0x61, 0x6c, 0x78, 0x7c, 0x6d, 0x45, 0x12,
-  0x00, 0x16, 0x50, 0x9a, 0xd8, 0xe9, 0xb5, 0x5c, 0x1c, 0x18, 0x49, 0x8c,
-  0xc3, 0xf6, 0xff, 0xf1, 0xb9, 0x7d, 0x58, 0x57, 0x71, 0x93, 0xb0, 0xc4,
-  0xcd, 0xc6, 0xaa, 0x83, 0x5c, 0x42, 0x3a, 0x42, 0x54, 0x64, 0x71, 0x7b,
-  0x7e, 0x79, 0x6b, 0x50, 0x32, 0x23, 0x2e, 0x51, 0x7f, 0xa8, 0xc0, 0xbb,
-  0x9b, 0x74, 0x5c, 0x63, 0x82, 0xa6, 0xc2, 0xce, 0xc4, 0xae, 0x96, 0x84,
-  0x7c, 0x7e, 0x80, 0x7c, 0x77, 0x75, 0x76, 0x76, 0x71, 0x68, 0x5e, 0x57,
-  0x5b, 0x6f, 0x90, 0xaa, 0x9e, 0x61, 0x17, 0x00, 0x05, 0x45, 0x94, 0xdc,
-  0xff, 0xd1, 0x6c, 0x20, 0x0d, 0x2d, 0x6a, 0xa5, 0xd8, 0xfe, 0xff, 0xdd,
-  0xa4, 0x6c, 0x4b, 0x4f, 0x72, 0x9b, 0xbb, 0xca, 0xc5, 0xb3, 0x9c, 0x84,
-  0x6d, 0x56, 0x44, 0x40, 0x4c, 0x63, 0x80, 0x97, 0x9c, 0x8a, 0x6a, 0x49,
-  0x34, 0x32, 0x44, 0x68, 0x93, 0xb7, 0xc0, 0xa7, 0x7f, 0x63, 0x65, 0x7e,
-  0x9b, 0xb1, 0xbe, 0xc0, 0xb7, 0xa6, 0x94, 0x84, 0x7c, 0x7d, 0x80, 0x82,
-  0x82, 0x83, 0x84, 0x81, 0x78, 0x71, 0x6f, 0x71, 0x7b, 0x8c, 0x8d, 0x6d,
-  0x35, 0x05, 0x00, 0x28, 0x72, 0xbd, 0xea, 0xda, 0x8b, 0x35, 0x13, 0x26,
-  0x59, 0x93, 0xc7, 0xf7, 0xff, 0xeb, 0xb2, 0x75, 0x52, 0x58, 0x7b, 0xa4,
-  0xc4, 0xd5, 0xd5, 0xc8, 0xb2, 0x95, 0x78, 0x60, 0x4f, 0x49, 0x50, 0x60,
-  0x75, 0x89, 0x96, 0x91, 0x76, 0x50, 0x30, 0x21, 0x2c, 0x4a, 0x73, 0x9c,
-  0xb6, 0xb3, 0x96, 0x73, 0x64, 0x6d, 0x85, 0xa2, 0xb9, 0xc6, 0xc6, 0xba,
-  0xac, 0xa0, 0x96, 0x8c, 0x85, 0x82, 0x83, 0x88, 0x8e, 0x90, 0x89, 0x7e,
-  0x70, 0x61, 0x59, 0x59, 0x68, 0x84, 0x9f, 0x9e, 0x72, 0x30, 0x05, 0x04,
-  0x2a, 0x6d, 0xb8, 0xe8, 0xe0, 0x9b, 0x49, 0x1e, 0x27, 0x54, 0x8d, 0xc1,
-  0xec, 0xff, 0xed, 0xbf, 0x8b, 0x67, 0x66, 0x80, 0x9e, 0xb5, 0xc3, 0xc5,
-  0xb9, 0xa8, 0x96, 0x86, 0x75, 0x62, 0x4e, 0x41, 0x43, 0x55, 0x71, 0x8c,
-  0x96, 0x82, 0x58, 0x32, 0x24, 0x2e, 0x4a, 0x6c, 0x8f, 0xa9, 0xaf, 0x9c,
-  0x80, 0x6e, 0x6f, 0x7f, 0x94, 0xa7, 0xb4, 0xb6, 0xb3, 0xaf, 0xa7, 0x99,
-  0x8b, 0x7e, 0x78, 0x7a, 0x82, 0x85, 0x86, 0x81, 0x78, 0x6c, 0x61, 0x5c,
-  0x5d, 0x68, 0x7f, 0x91, 0x8c, 0x66, 0x2e, 0x04, 0x02, 0x2b, 0x70, 0xba,
-  0xe9, 0xe0, 0x99, 0x44, 0x18, 0x22, 0x50, 0x8c, 0xc3, 0xf0, 0xff, 0xe9,
-  0xb5, 0x7c, 0x5a, 0x56, 0x6f, 0x92, 0xb2, 0xc7, 0xcd, 0xc3, 0xac, 0x90,
-  0x77, 0x63, 0x52, 0x46, 0x43, 0x4f, 0x68, 0x83, 0x93, 0x8b, 0x6a, 0x45,
-  0x30, 0x2d, 0x37, 0x4a, 0x66, 0x87, 0xa3, 0xad, 0x9d, 0x82, 0x70, 0x72,
-  0x82, 0x95, 0xa7, 0xb1, 0xb4, 0xb4, 0xb0, 0xa5, 0x93, 0x82, 0x78, 0x78,
-  0x7c, 0x80, 0x85, 0x86, 0x81, 0x79, 0x71, 0x6b, 0x65, 0x63, 0x6c, 0x7e,
-  0x90, 0x8c, 0x64, 0x26, 0x00, 0x00, 0x2d, 0x77, 0xc2, 0xe7, 0xc8, 0x75,
-  0x2c, 0x13, 0x26, 0x54, 0x8b, 0xbe, 0xe8, 0xf9, 0xdf, 0xa6, 0x6a, 0x4c,
-  0x5d, 0x88, 0xae, 0xc6, 0xcb, 0xc0, 0xb4, 0xaa, 0xa1, 0x91, 0x77, 0x5b,
-  0x48, 0x47, 0x57, 0x6c, 0x7e, 0x86, 0x80, 0x70, 0x57, 0x3c, 0x2b, 0x28,
-  0x38, 0x56, 0x76, 0x8d, 0x95, 0x8c, 0x7a, 0x6c, 0x6c, 0x76, 0x84, 0x92,
-  0x9e, 0xa9, 0xb0, 0xb2, 0xad, 0xa0, 0x92, 0x87, 0x81, 0x80, 0x82, 0x86,
-  0x8c, 0x92, 0x8f, 0x84, 0x77, 0x6b, 0x5e, 0x59, 0x64, 0x7d, 0x9a, 0xa9,
-  0x96, 0x5b, 0x1b, 0x00, 0x0a, 0x3d, 0x86, 0xc7, 0xda, 0xb2, 0x6d, 0x39,
-  0x27, 0x32, 0x4c, 0x6f, 0x99, 0xc6, 0xe0, 0xd7, 0xb0, 0x81, 0x69, 0x77,
-  0x94, 0xa5, 0xa5, 0x9c, 0x9a, 0xa6, 0xb9, 0xc0, 0xae, 0x8c, 0x6a, 0x53,
-  0x4c, 0x50, 0x57, 0x64, 0x7a, 0x92, 0x96, 0x7e, 0x54, 0x2e, 0x1f, 0x2e,
-  0x4b, 0x65, 0x7d, 0x8e, 0x8e, 0x82, 0x77, 0x6d, 0x6b, 0x73, 0x82, 0x91,
-  0x9d, 0xa6, 0xaa, 0xa7, 0xa3, 0x9b, 0x90, 0x82, 0x7b, 0x7d, 0x87, 0x92,
-  0x97, 0x93, 0x89, 0x7e, 0x77, 0x75, 0x79, 0x80, 0x8e, 0xa2, 0xa6, 0x80,
-  0x3c, 0x0a, 0x07, 0x31, 0x76, 0xba, 0xd4, 0xb2, 0x74, 0x44, 0x30, 0x33,
-  0x43, 0x5d, 0x87, 0xbc, 0xe4, 0xe4, 0xb9, 0x7e, 0x60, 0x70, 0x93, 0xa4,
-  0xa3, 0xa0, 0xa9, 0xbc, 0xca, 0xc4, 0xab, 0x8a, 0x70, 0x62, 0x5c, 0x5c,
-  0x66, 0x78, 0x8f, 0x9d, 0x94, 0x73, 0x4c, 0x32, 0x2d, 0x3d, 0x54, 0x66,
-  0x75, 0x80, 0x81, 0x79, 0x6e, 0x63, 0x5f, 0x67, 0x77, 0x86, 0x8f, 0x94,
-  0x99, 0x9d, 0x9e, 0x9a, 0x93, 0x8b, 0x89, 0x8b, 0x8f, 0x93, 0x94, 0x93,
-  0x90, 0x8f, 0x8e, 0x8d, 0x8e, 0x91, 0x9a, 0xa1, 0x94, 0x6d, 0x44, 0x2f,
-  0x35, 0x56, 0x7f, 0x9c, 0xa3, 0x96, 0x79, 0x5c, 0x50, 0x4f, 0x54, 0x65,
-  0x82, 0xa2, 0xbb, 0xc2, 0xb3, 0x9a, 0x8a, 0x8d, 0x97, 0x9b, 0x9b, 0xa0,
-  0xaa, 0xb6, 0xbe, 0xb9, 0xaa, 0x98, 0x88, 0x7c, 0x76, 0x74, 0x78, 0x82,
-  0x8c, 0x90, 0x88, 0x77, 0x63, 0x52, 0x4c, 0x50, 0x57, 0x60, 0x69, 0x72,
-  0x77, 0x76, 0x70, 0x69, 0x66, 0x6a, 0x72, 0x7a, 0x83, 0x8b, 0x90, 0x93,
-  0x94, 0x8f, 0x87, 0x83, 0x84, 0x88, 0x8c, 0x90, 0x91, 0x91, 0x90, 0x90,
-  0x90, 0x94, 0x9b, 0xa3, 0xa5, 0x98, 0x7b, 0x5b, 0x4d, 0x55, 0x6c, 0x84,
-  0x91, 0x93, 0x8e, 0x82, 0x71, 0x63, 0x5b, 0x5c, 0x67, 0x78, 0x8b, 0x97,
-  0x9b, 0x98, 0x94, 0x92, 0x92, 0x8f, 0x87, 0x83, 0x87, 0x90, 0x9d, 0xab,
-  0xb3, 0xb1, 0xa5, 0x94, 0x81, 0x75, 0x73, 0x79, 0x85, 0x8f, 0x93, 0x8d,
-  0x81, 0x72, 0x68, 0x64, 0x62, 0x62, 0x64, 0x66, 0x68, 0x6b, 0x6d, 0x70,
-  0x73, 0x73, 0x6f, 0x6c, 0x6c, 0x6f, 0x75, 0x7c, 0x82, 0x85, 0x85, 0x85,
-  0x80, 0x7c, 0x7b, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x82, 0x84, 0x87, 0x8a,
-  0x90, 0x9a, 0x9f, 0x99, 0x87, 0x74, 0x6a, 0x6d, 0x76, 0x7e, 0x86, 0x8c,
-  0x8f, 0x8a, 0x7e, 0x73, 0x6f, 0x74, 0x7d, 0x85, 0x88, 0x88, 0x87, 0x84,
-  0x84, 0x85, 0x88, 0x8c, 0x8f, 0x90, 0x8f, 0x8c, 0x88, 0x87, 0x8b, 0x90,
-  0x93, 0x92, 0x8f, 0x8b, 0x86, 0x82, 0x7e, 0x7f, 0x82, 0x85, 0x87, 0x87,
-  0x83, 0x7d, 0x78, 0x74, 0x72, 0x72, 0x72, 0x74, 0x76, 0x77, 0x74, 0x72,
-  0x71, 0x70, 0x6e, 0x6d, 0x6e, 0x71, 0x74, 0x74, 0x76, 0x7c, 0x7f, 0x79,
-  0x74, 0x76, 0x7c, 0x7f, 0x7e, 0x7c, 0x7c, 0x81, 0x87, 0x84, 0x81, 0x86,
-  0x8c, 0x8d, 0x8b, 0x8b, 0x8d, 0x90, 0x90, 0x8a, 0x7d, 0x74, 0x74, 0x7a,
-  0x84, 0x8c, 0x8c, 0x86, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7d, 0x80, 0x85,
-  0x89, 0x89, 0x87, 0x84, 0x84, 0x86, 0x88, 0x89, 0x88, 0x88, 0x89, 0x89,
-  0x87, 0x86, 0x87, 0x8b, 0x8d, 0x8c, 0x89, 0x85, 0x82, 0x80, 0x7d, 0x7f,
-  0x82, 0x83, 0x82, 0x81, 0x82, 0x83, 0x7f, 0x7a, 0x76, 0x77, 0x78, 0x77,
-  0x76, 0x78, 0x7b, 0x7b, 0x78, 0x76, 0x74, 0x72, 0x75, 0x77, 0x76, 0x74,
-  0x75, 0x77, 0x7b, 0x7b, 0x77, 0x75, 0x7a, 0x7c, 0x7c, 0x81, 0x84, 0x80,
-  0x7d, 0x7f, 0x81, 0x82, 0x83, 0x82, 0x7c, 0x7c, 0x85, 0x89, 0x86, 0x85,
-  0x81, 0x7c, 0x7e, 0x83, 0x84, 0x83, 0x84, 0x86, 0x87, 0x85, 0x7f, 0x79,
-  0x79, 0x80, 0x86, 0x88, 0x88, 0x84, 0x80, 0x81, 0x82, 0x82, 0x81, 0x82,
-  0x85, 0x87, 0x88, 0x86, 0x83, 0x82, 0x83, 0x85, 0x86, 0x87, 0x86, 0x83,
-  0x81, 0x7e, 0x7c, 0x80, 0x82, 0x7f, 0x7c, 0x7c, 0x7a, 0x79, 0x79, 0x7a,
-  0x7d, 0x7f, 0x7e, 0x7b, 0x79, 0x77, 0x75, 0x74, 0x77, 0x7a, 0x79, 0x78,
-  0x77, 0x79, 0x7b, 0x7c, 0x7c, 0x7e, 0x7d, 0x7a, 0x78, 0x75, 0x73, 0x76,
-  0x7a, 0x7b, 0x7c, 0x7d, 0x7a, 0x75, 0x75, 0x77, 0x78, 0x78, 0x79, 0x79,
-  0x7b, 0x7d, 0x7c, 0x79, 0x77, 0x78, 0x79, 0x77, 0x78, 0x7c, 0x81, 0x80,
-  0x7c, 0x7d, 0x81, 0x84, 0x80, 0x7c, 0x7c, 0x7f, 0x85, 0x88, 0x86, 0x84,
-  0x7e, 0x7b, 0x7f, 0x85, 0x84, 0x81, 0x82, 0x82, 0x82, 0x80, 0x7d, 0x7b,
-  0x7f, 0x82, 0x83, 0x85, 0x86, 0x82, 0x7e, 0x7e, 0x7f, 0x7d, 0x7c, 0x7d,
-  0x80, 0x82, 0x81, 0x7d, 0x7b, 0x7c, 0x7d, 0x80, 0x83, 0x84, 0x82, 0x81,
-  0x81, 0x80, 0x81, 0x82, 0x7e, 0x7d, 0x80, 0x80, 0x7e, 0x80, 0x80, 0x7e,
-  0x7f, 0x81, 0x7e, 0x7a, 0x79, 0x7b, 0x7b, 0x7c, 0x7e, 0x7c, 0x79, 0x79,
-  0x7a, 0x7b, 0x7b, 0x79, 0x77, 0x79, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7a,
-  0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x81, 0x83, 0x80, 0x7e, 0x7f, 0x80,
-  0x7f, 0x7f, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x81, 0x80,
-  0x7f, 0x7b, 0x78, 0x7c, 0x7e, 0x7e, 0x80, 0x84, 0x82, 0x7e, 0x7d, 0x7c,
-  0x7a, 0x79, 0x7d, 0x81, 0x84, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7f, 0x7f,
-  0x81, 0x83, 0x85, 0x86, 0x84, 0x82, 0x83, 0x84, 0x83, 0x83, 0x83, 0x82,
-  0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x80, 0x7f, 0x83, 0x84, 0x80, 0x81,
-  0x82, 0x7f, 0x7f, 0x83, 0x84, 0x80, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7d, 0x7e, 0x80, 0x80, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x82, 0x82, 0x80, 0x7d, 0x7c, 0x7c, 0x7f, 0x81,
-  0x80, 0x7e, 0x7d, 0x7d, 0x7e, 0x81, 0x82, 0x81, 0x80, 0x7d, 0x79, 0x7a,
-  0x7f, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82,
-  0x82, 0x83, 0x84, 0x84, 0x85, 0x86, 0x84, 0x81, 0x7d, 0x7b, 0x7e, 0x83,
-  0x84, 0x83, 0x82, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x85,
-  0x84, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x80, 0x83, 0x83, 0x82, 0x80, 0x7e,
-  0x7f, 0x82, 0x84, 0x84, 0x83, 0x81, 0x82, 0x84, 0x85, 0x84, 0x83, 0x83,
-  0x82, 0x84, 0x84, 0x84, 0x82, 0x80, 0x80, 0x82, 0x82, 0x7e, 0x7a, 0x7b,
-  0x81, 0x85, 0x86, 0x86, 0x83, 0x7e, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83,
-  0x82, 0x83, 0x81, 0x7f, 0x80, 0x82, 0x81, 0x81, 0x82, 0x81, 0x80, 0x82,
-  0x83, 0x85, 0x86, 0x85, 0x83, 0x81, 0x80, 0x81, 0x84, 0x86, 0x86, 0x85,
-  0x84, 0x82, 0x82, 0x82, 0x80, 0x80, 0x82, 0x82, 0x7f, 0x7f, 0x80, 0x7e,
-  0x7e, 0x80, 0x83, 0x83, 0x84, 0x84, 0x82, 0x7e, 0x80, 0x82, 0x82, 0x83,
-  0x86, 0x89, 0x89, 0x89, 0x85, 0x82, 0x81, 0x80, 0x81, 0x84, 0x86, 0x86,
-  0x86, 0x86, 0x85, 0x81, 0x7d, 0x7b, 0x7e, 0x81, 0x84, 0x87, 0x87, 0x86,
-  0x83, 0x80, 0x7d, 0x7c, 0x7c, 0x7f, 0x83, 0x84, 0x84, 0x85, 0x84, 0x80,
-  0x7d, 0x7e, 0x80, 0x83, 0x86, 0x87, 0x86, 0x84, 0x83, 0x80, 0x80, 0x83,
-  0x84, 0x82, 0x81, 0x82, 0x83, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d, 0x80, 0x84,
-  0x84, 0x83, 0x82, 0x80, 0x7c, 0x7c, 0x80, 0x81, 0x84, 0x88, 0x87, 0x84,
-  0x83, 0x83, 0x80, 0x7f, 0x82, 0x83, 0x83, 0x83, 0x84, 0x84, 0x82, 0x82,
-  0x84, 0x82, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x83, 0x83, 0x81, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x7e, 0x7e, 0x80,
-  0x81, 0x81, 0x7f, 0x7d, 0x80, 0x82, 0x82, 0x80, 0x82, 0x83, 0x82, 0x80,
-  0x7f, 0x7c, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x7f, 0x7d, 0x7d, 0x7e, 0x7c,
-  0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x80, 0x81, 0x7e, 0x7d, 0x7e,
-  0x7d, 0x7b, 0x7c, 0x80, 0x82, 0x81, 0x7f, 0x7d, 0x7b, 0x7c, 0x7f, 0x81,
-  0x82, 0x80, 0x7d, 0x7c, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x82, 0x81,
-  0x7e, 0x7a, 0x7a, 0x7c, 0x7d, 0x7f, 0x82, 0x83, 0x82, 0x81, 0x7f, 0x7d,
-  0x7c, 0x7d, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x81, 0x82, 0x83, 0x81, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x81, 0x83, 0x83, 0x81, 0x80, 0x80, 0x7e, 0x7c,
-  0x7e, 0x7f, 0x7e, 0x7e, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7e, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7c, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7c, 0x7a,
-  0x7a, 0x7c, 0x7e, 0x7e, 0x7c, 0x7b, 0x7d, 0x7e, 0x80, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x84, 0x82, 0x80, 0x7c, 0x79,
-  0x7a, 0x7d, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7c, 0x7e,
-  0x80, 0x80, 0x7d, 0x7b, 0x7a, 0x7a, 0x7c, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7e, 0x80, 0x81, 0x81, 0x82, 0x84, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7e,
-  0x81, 0x82, 0x81, 0x80, 0x7f, 0x7c, 0x7b, 0x7c, 0x7e, 0x81, 0x81, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x7e, 0x7c, 0x7c, 0x7e, 0x80, 0x81,
-  0x83, 0x82, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x80, 0x81, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x80,
-  0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7c, 0x7e,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7c, 0x7e, 0x7f, 0x7e, 0x7d,
-  0x7d, 0x7c, 0x7b, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7a, 0x7a, 0x7b, 0x7c,
-  0x7c, 0x7b, 0x79, 0x78, 0x77, 0x78, 0x7d, 0x7f, 0x80, 0x7f, 0x7e, 0x7b,
-  0x7a, 0x7b, 0x7e, 0x7e, 0x7d, 0x7d, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7e, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x80, 0x82, 0x82, 0x83, 0x84, 0x83, 0x83, 0x81, 0x80, 0x81, 0x81, 0x82,
-  0x82, 0x83, 0x83, 0x82, 0x81, 0x7f, 0x7d, 0x7d, 0x80, 0x80, 0x7d, 0x7c,
-  0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x7e, 0x7d, 0x7e, 0x7e, 0x80, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x84, 0x83, 0x82, 0x82, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82,
-  0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x82, 0x81, 0x7e, 0x7e, 0x7e, 0x80,
-  0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x82, 0x83,
-  0x83, 0x82, 0x81, 0x80, 0x80, 0x81, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x82, 0x80, 0x81, 0x82, 0x81, 0x82, 0x83, 0x81, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x83, 0x84, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81,
-  0x82, 0x83, 0x84, 0x84, 0x85, 0x86, 0x86, 0x84, 0x83, 0x82, 0x82, 0x82,
-  0x82, 0x83, 0x84, 0x84, 0x83, 0x82, 0x80, 0x7e, 0x7d, 0x7e, 0x81, 0x82,
-  0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x80, 0x80, 0x7e, 0x7f, 0x82, 0x81,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x82, 0x80, 0x7f,
-  0x7f, 0x80, 0x82, 0x83, 0x81, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x81, 0x81, 0x80, 0x7d, 0x7c, 0x7c, 0x7d, 0x7f, 0x82,
-  0x82, 0x82, 0x83, 0x83, 0x80, 0x80, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82,
-  0x84, 0x86, 0x85, 0x83, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x81, 0x7f,
-  0x7e, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7c, 0x7b, 0x7e,
-  0x81, 0x80, 0x7e, 0x80, 0x80, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x82,
-  0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x84, 0x83, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x82, 0x82, 0x80, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7e, 0x80, 0x81, 0x81, 0x81, 0x83, 0x84, 0x82, 0x80, 0x81, 0x82, 0x82,
-  0x83, 0x84, 0x84, 0x82, 0x83, 0x85, 0x84, 0x80, 0x7f, 0x7f, 0x80, 0x82,
-  0x83, 0x83, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x80, 0x81, 0x80, 0x7f, 0x7f,
-  0x7f, 0x80, 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82,
-  0x83, 0x84, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81,
-  0x81, 0x7f, 0x7e, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x82, 0x81, 0x82,
-  0x82, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82, 0x84,
-  0x84, 0x82, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x7e,
-  0x7f, 0x81, 0x7f, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x7f,
-  0x80, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x81, 0x83, 0x81, 0x7e,
-  0x7f, 0x80, 0x7e, 0x7c, 0x7d, 0x7e, 0x7e, 0x80, 0x81, 0x7f, 0x7d, 0x7e,
-  0x7e, 0x7c, 0x7c, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x7d, 0x7d,
-  0x7e, 0x80, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x80, 0x7f, 0x80, 0x80,
-  0x81, 0x82, 0x7e, 0x7d, 0x7e, 0x7c, 0x7a, 0x7d, 0x80, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x80, 0x82,
-  0x83, 0x82, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x80,
-  0x7e, 0x7f, 0x80, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80,
-  0x7f, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x84,
-  0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x83, 0x82,
-  0x81, 0x81, 0x80, 0x7c, 0x7c, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7d,
-  0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x82,
-  0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x80, 0x82, 0x82, 0x83, 0x83, 0x80, 0x7e,
-  0x80, 0x81, 0x82, 0x84, 0x84, 0x82, 0x81, 0x83, 0x83, 0x82, 0x82, 0x82,
-  0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81,
-  0x80, 0x7e, 0x7f, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x82, 0x83, 0x83, 0x81, 0x80, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7e, 0x80,
-  0x7f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f,
-  0x7f, 0x80, 0x82, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x80, 0x7d, 0x7e,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x7e,
-  0x7f, 0x80, 0x81, 0x80, 0x7d, 0x7c, 0x7e, 0x7f, 0x7e, 0x7f, 0x80, 0x7f,
-  0x80, 0x83, 0x82, 0x7f, 0x7e, 0x7c, 0x7c, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x7e, 0x7b, 0x7b, 0x7c, 0x7d, 0x80, 0x82, 0x81, 0x7f, 0x7d, 0x7b,
-  0x7c, 0x7e, 0x7f, 0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x81, 0x7f,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x80,
-  0x80, 0x7e, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7d,
-  0x7e, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x81,
-  0x81, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7e,
-  0x7e, 0x80, 0x82, 0x82, 0x81, 0x80, 0x81, 0x81, 0x7f, 0x7d, 0x7b, 0x7b,
-  0x7e, 0x81, 0x83, 0x84, 0x83, 0x81, 0x80, 0x82, 0x82, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x82, 0x82,
-  0x81, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x81,
-  0x83, 0x83, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x83, 0x83, 0x83,
-  0x82, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7c, 0x7d, 0x7f,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x82,
-  0x80, 0x7d, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7e, 0x80, 0x82, 0x82,
-  0x82, 0x83, 0x82, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x81, 0x82,
-  0x81, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x82, 0x83, 0x82,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x82, 0x84, 0x85,
-  0x83, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x82, 0x82, 0x82, 0x82,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x82,
-  0x81, 0x7f, 0x7f, 0x7e, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x84,
-  0x82, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x81, 0x83, 0x84, 0x82, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x83, 0x82,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x80, 0x7e, 0x7e, 0x81, 0x83, 0x83, 0x82,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x84, 0x85, 0x86, 0x84, 0x81,
-  0x7e, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x82, 0x83, 0x82, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x81, 0x82, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x80, 0x82, 0x83, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81, 0x82, 0x84,
-  0x83, 0x82, 0x81, 0x7f, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x82, 0x7f, 0x7e,
-  0x7e, 0x80, 0x81, 0x81, 0x7f, 0x7e, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x80, 0x80, 0x80, 0x80, 0x7e,
-  0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7d, 0x7e, 0x7e, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x7f, 0x7d,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7c, 0x7c,
-  0x7e, 0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7e, 0x7e, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7e, 0x7e,
-  0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x80, 0x7e, 0x7e,
-  0x80, 0x80, 0x7f, 0x81, 0x82, 0x7f, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x80,
-  0x7e, 0x7c, 0x7e, 0x80, 0x7e, 0x7e, 0x80, 0x7f, 0x7e, 0x80, 0x80, 0x7e,
-  0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7c, 0x7d, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x81, 0x7f, 0x7f, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x81, 0x80, 0x82, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x7f, 0x81, 0x82, 0x82, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81,
-  0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x80, 0x82,
-  0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80,
-  0x80, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7e,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7c, 0x7c,
-  0x7d, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 0x81,
-  0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x80,
-  0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7c, 0x7e, 0x7f, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x82, 0x81, 0x80,
-  0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x80, 0x81, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80,
-  0x7e, 0x7d, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x7d,
-  0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7e, 0x7f,
-  0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d, 0x7f, 0x7f,
-  0x7d, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x7f, 0x7f,
-  0x81, 0x82, 0x83, 0x83, 0x83, 0x81, 0x80, 0x80, 0x82, 0x82, 0x81, 0x81,
-  0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x7e, 0x7e, 0x81, 0x81, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x7e, 0x7d, 0x7e, 0x7f, 0x7e, 0x7e,
-  0x80, 0x83, 0x82, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7e, 0x80,
-  0x80, 0x81, 0x83, 0x84, 0x82, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x82, 0x82, 0x82, 0x83, 0x82, 0x80, 0x7e, 0x80,
-  0x83, 0x82, 0x81, 0x81, 0x80, 0x7e, 0x7f, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7e, 0x7d, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f,
-  0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x7e,
-  0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x7d, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80,
-  0x80, 0x81, 0x82, 0x81, 0x80, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x80,
-  0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x7f, 0x80, 0x7e, 0x7d, 0x7f, 0x80, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x83, 0x85,
-  0x83, 0x83, 0x81, 0x7e, 0x80, 0x80, 0x7b, 0x7c, 0x80, 0x7e, 0x7e, 0x82,
-  0x82, 0x82, 0x84, 0x81, 0x7c, 0x7f, 0x81, 0x7e, 0x7f, 0x80, 0x7f, 0x80,
-  0x83, 0x82, 0x80, 0x81, 0x81, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x81, 0x80,
-  0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x82, 0x81, 0x7e, 0x7e, 0x80, 0x7f, 0x80,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x81, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x82, 0x82, 0x81, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x80,
-  0x7e, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x7e, 0x7f, 0x81, 0x83,
-  0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-  0x80, 0x81, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x80, 0x7f, 0x7e, 0x7f, 0x81,
-  0x80, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82, 0x81, 0x7f, 0x7f,
-  0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7e,
-  0x7e, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7e,
-  0x7e, 0x80, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x83, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80,
-  0x81, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x83, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f,
-  0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81,
-  0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x81, 0x81, 0x7f, 0x81, 0x82, 0x80, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f, 0x80, 0x7f, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x80,
-  0x80, 0x7e, 0x7d, 0x7c, 0x7d, 0x7f, 0x81, 0x82, 0x82, 0x80, 0x81, 0x81,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x7e, 0x7e, 0x80, 0x81,
-  0x80, 0x80, 0x82, 0x82, 0x80, 0x7c, 0x7a, 0x7c, 0x84, 0x87, 0x83, 0x80,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x7f, 0x7d, 0x7f, 0x81,
-  0x81, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x82, 0x80, 0x7d, 0x7d, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x7d, 0x7e, 0x80, 0x80, 0x81, 0x82, 0x80,
-  0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81, 0x82, 0x80, 0x81, 0x84,
-  0x84, 0x81, 0x81, 0x80, 0x80, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f,
-  0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7d,
-  0x7d, 0x82, 0x84, 0x82, 0x80, 0x7f, 0x7e, 0x7f, 0x83, 0x83, 0x80, 0x80,
-  0x82, 0x81, 0x7e, 0x7e, 0x81, 0x82, 0x82, 0x80, 0x7f, 0x80, 0x7f, 0x7f,
-  0x81, 0x80, 0x7f, 0x80, 0x81, 0x83, 0x82, 0x80, 0x80, 0x81, 0x82, 0x7f,
-  0x7c, 0x7e, 0x83, 0x83, 0x82, 0x81, 0x80, 0x82, 0x83, 0x81, 0x7c, 0x7d,
-  0x81, 0x82, 0x82, 0x80, 0x80, 0x81, 0x82, 0x80, 0x7f, 0x80, 0x7e, 0x7d,
-  0x80, 0x83, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x7d, 0x7e, 0x81, 0x82,
-  0x82, 0x83, 0x84, 0x82, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7d, 0x7e, 0x81,
-  0x82, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x81, 0x7d, 0x7b, 0x7e, 0x84,
-  0x82, 0x7c, 0x7d, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x7d, 0x7e, 0x84, 0x82,
-  0x7d, 0x7d, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x80, 0x7c, 0x80,
-  0x84, 0x81, 0x80, 0x82, 0x81, 0x7f, 0x80, 0x80, 0x7f, 0x7d, 0x7d, 0x80,
-  0x82, 0x83, 0x80, 0x7e, 0x81, 0x82, 0x7e, 0x7d, 0x80, 0x82, 0x82, 0x82,
-  0x7f, 0x7e, 0x80, 0x7f, 0x7f, 0x82, 0x81, 0x7c, 0x7d, 0x81, 0x82, 0x7e,
-  0x7c, 0x7e, 0x81, 0x83, 0x84, 0x81, 0x81, 0x81, 0x7f, 0x7c, 0x7f, 0x85,
-  0x84, 0x7c, 0x7a, 0x80, 0x87, 0x85, 0x7c, 0x79, 0x7c, 0x7e, 0x82, 0x84,
-  0x84, 0x84, 0x82, 0x7f, 0x7f, 0x80, 0x7e, 0x7f, 0x81, 0x7e, 0x79, 0x7b,
-  0x83, 0x88, 0x84, 0x7e, 0x7e, 0x81, 0x82, 0x82, 0x81, 0x7d, 0x7e, 0x82,
-  0x84, 0x82, 0x7d, 0x7b, 0x83, 0x8c, 0x86, 0x75, 0x6f, 0x7d, 0x8e, 0x90,
-  0x89, 0x81, 0x7a, 0x7c, 0x83, 0x83, 0x7d, 0x7c, 0x7f, 0x83, 0x83, 0x7b,
-  0x78, 0x85, 0x8e, 0x87, 0x7d, 0x7a, 0x7b, 0x81, 0x87, 0x83, 0x79, 0x77,
-  0x80, 0x87, 0x86, 0x81, 0x7d, 0x7a, 0x7a, 0x7c, 0x7b, 0x7e, 0x86, 0x88,
-  0x84, 0x7d, 0x75, 0x75, 0x7f, 0x8a, 0x8c, 0x82, 0x77, 0x7d, 0x86, 0x81,
-  0x75, 0x76, 0x82, 0x84, 0x7b, 0x79, 0x7f, 0x82, 0x83, 0x82, 0x7f, 0x7d,
-  0x82, 0x88, 0x85, 0x76, 0x6f, 0x7a, 0x86, 0x84, 0x7c, 0x7a, 0x7b, 0x7d,
-  0x7b, 0x75, 0x73, 0x7a, 0x86, 0x8f, 0x88, 0x79, 0x79, 0x7c, 0x76, 0x79,
-  0x84, 0x85, 0x79, 0x74, 0x7a, 0x7c, 0x7b, 0x7c, 0x7f, 0x88, 0x8a, 0x80,
-  0x7e, 0x81, 0x79, 0x6d, 0x6e, 0x85, 0x97, 0x92, 0x85, 0x72, 0x66, 0x70,
-  0x82, 0x8c, 0x8b, 0x84, 0x7c, 0x7e, 0x89, 0x85, 0x70, 0x6d, 0x7d, 0x84,
-  0x81, 0x7c, 0x74, 0x76, 0x83, 0x86, 0x7c, 0x79, 0x7b, 0x80, 0x85, 0x7c,
-  0x6b, 0x69, 0x7f, 0x95, 0x90, 0x84, 0x82, 0x7b, 0x74, 0x7b, 0x80, 0x7a,
-  0x75, 0x78, 0x7e, 0x83, 0x83, 0x80, 0x81, 0x82, 0x7e, 0x81, 0x8f, 0x92,
-  0x7b, 0x5f, 0x58, 0x6e, 0x90, 0x9d, 0x93, 0x82, 0x72, 0x74, 0x80, 0x7c,
-  0x71, 0x7a, 0x8c, 0x88, 0x7c, 0x75, 0x73, 0x86, 0x9f, 0x9a, 0x72, 0x5a,
-  0x6e, 0x8d, 0x98, 0x96, 0x8f, 0x7c, 0x6c, 0x76, 0x83, 0x82, 0x7c, 0x7b,
-  0x81, 0x85, 0x7a, 0x71, 0x82, 0x94, 0x80, 0x70, 0x90, 0xab, 0x90, 0x74,
-  0x7d, 0x82, 0x7e, 0x88, 0x86, 0x73, 0x72, 0x88, 0x96, 0x8f, 0x76, 0x57,
-  0x59, 0x82, 0x9a, 0x8d, 0x85, 0x8d, 0x80, 0x6e, 0x85, 0x9c, 0x92, 0x7c,
-  0x77, 0x81, 0x88, 0x80, 0x7d, 0x8a, 0x8c, 0x76, 0x6c, 0x78, 0x79, 0x7f,
-  0x9e, 0xb2, 0xa0, 0x75, 0x54, 0x4f, 0x69, 0x8d, 0x96, 0x86, 0x76, 0x74,
-  0x81, 0x98, 0x9d, 0x8a, 0x83, 0x90, 0x8a, 0x72, 0x71, 0x7e, 0x77, 0x6f,
-  0x7a, 0x84, 0x8a, 0x98, 0x98, 0x78, 0x58, 0x65, 0x8c, 0xa0, 0x9f, 0x91,
-  0x74, 0x67, 0x7e, 0x93, 0x8b, 0x7d, 0x83, 0x8e, 0x8e, 0x85, 0x72, 0x65,
-  0x78, 0xa0, 0xa9, 0x85, 0x67, 0x6f, 0x7c, 0x7f, 0x82, 0x80, 0x76, 0x72,
-  0x76, 0x73, 0x6e, 0x7c, 0x8c, 0x90, 0x93, 0x91, 0x81, 0x76, 0x79, 0x7b,
-  0x6f, 0x68, 0x7a, 0x97, 0xa2, 0x97, 0x83, 0x7a, 0x80, 0x88, 0x85, 0x77,
-  0x70, 0x82, 0x97, 0x90, 0x71, 0x65, 0x7a, 0x91, 0x8f, 0x7d, 0x6e, 0x6e,
-  0x79, 0x85, 0x88, 0x81, 0x7f, 0x86, 0x8b, 0x81, 0x6b, 0x62, 0x70, 0x85,
-  0x8a, 0x81, 0x78, 0x76, 0x7e, 0x88, 0x8b, 0x88, 0x83, 0x83, 0x86, 0x83,
-  0x7c, 0x7b, 0x7f, 0x87, 0x8e, 0x8a, 0x7e, 0x77, 0x7c, 0x80, 0x7e, 0x7d,
-  0x7e, 0x80, 0x83, 0x83, 0x80, 0x80, 0x82, 0x83, 0x7e, 0x78, 0x77, 0x78,
-  0x78, 0x79, 0x7d, 0x81, 0x86, 0x86, 0x7c, 0x6f, 0x6b, 0x77, 0x86, 0x8a,
-  0x81, 0x78, 0x79, 0x7e, 0x81, 0x82, 0x7f, 0x7d, 0x85, 0x8b, 0x86, 0x7a,
-  0x76, 0x7a, 0x7d, 0x7b, 0x77, 0x75, 0x77, 0x75, 0x73, 0x75, 0x7b, 0x7e,
-  0x82, 0x87, 0x8b, 0x8a, 0x8a, 0x88, 0x84, 0x81, 0x84, 0x8a, 0x90, 0x92,
-  0x8c, 0x86, 0x83, 0x81, 0x82, 0x86, 0x8a, 0x8e, 0x92, 0x93, 0x91, 0x8c,
-  0x8a, 0x8e, 0x8e, 0x8a, 0x87, 0x82, 0x7c, 0x7a, 0x78, 0x75, 0x70, 0x6c,
-  0x6c, 0x71, 0x71, 0x6a, 0x66, 0x69, 0x6e, 0x74, 0x7b, 0x7c, 0x7d, 0x82,
-  0x84, 0x83, 0x7e, 0x7d, 0x86, 0x90, 0x92, 0x8e, 0x85, 0x7b, 0x7c, 0x83,
-  0x82, 0x81, 0x86, 0x8a, 0x83, 0x7c, 0x77, 0x71, 0x70, 0x78, 0x81, 0x85,
-  0x86, 0x85, 0x82, 0x83, 0x87, 0x86, 0x83, 0x84, 0x85, 0x82, 0x80, 0x82,
-  0x87, 0x90, 0x98, 0x9c, 0x98, 0x92, 0x8e, 0x90, 0x92, 0x94, 0x96, 0x96,
-  0x94, 0x8d, 0x83, 0x7b, 0x79, 0x76, 0x71, 0x6d, 0x67, 0x62, 0x5e, 0x5e,
-  0x5f, 0x62, 0x6a, 0x70, 0x71, 0x6f, 0x6e, 0x6e, 0x72, 0x77, 0x7d, 0x82,
-  0x88, 0x8c, 0x8b, 0x8a, 0x8d, 0x95, 0x99, 0x91, 0x81, 0x72, 0x6a, 0x6e,
-  0x79, 0x86, 0x8e, 0x8f, 0x84, 0x74, 0x6a, 0x66, 0x65, 0x6d, 0x78, 0x81,
-  0x86, 0x8c, 0x8c, 0x87, 0x87, 0x8e, 0x92, 0x93, 0x94, 0x90, 0x8a, 0x86,
-  0x8a, 0x95, 0xa0, 0xa4, 0xa0, 0x90, 0x7e, 0x72, 0x70, 0x73, 0x78, 0x7b,
-  0x7a, 0x76, 0x70, 0x6d, 0x6c, 0x6b, 0x6a, 0x68, 0x66, 0x66, 0x69, 0x6e,
-  0x73, 0x79, 0x7b, 0x78, 0x76, 0x79, 0x7e, 0x7e, 0x81, 0x83, 0x81, 0x82,
-  0x84, 0x85, 0x84, 0x83, 0x87, 0x8e, 0x90, 0x87, 0x7f, 0x7a, 0x76, 0x76,
-  0x78, 0x77, 0x77, 0x7b, 0x7b, 0x71, 0x65, 0x61, 0x62, 0x69, 0x79, 0x86,
-  0x88, 0x89, 0x8e, 0x93, 0x94, 0x90, 0x88, 0x89, 0x96, 0xa3, 0xa4, 0x9e,
-  0x9a, 0x96, 0x95, 0x94, 0x93, 0x94, 0x96, 0x92, 0x83, 0x75, 0x6e, 0x70,
-  0x79, 0x7d, 0x77, 0x6e, 0x6a, 0x66, 0x63, 0x64, 0x68, 0x6a, 0x6b, 0x6e,
-  0x72, 0x78, 0x7e, 0x83, 0x82, 0x80, 0x81, 0x84, 0x88, 0x8c, 0x8e, 0x8b,
-  0x88, 0x86, 0x84, 0x84, 0x88, 0x90, 0x97, 0x98, 0x94, 0x8e, 0x82, 0x6f,
-  0x63, 0x64, 0x6f, 0x7b, 0x80, 0x74, 0x5f, 0x55, 0x5a, 0x68, 0x7a, 0x88,
-  0x91, 0x96, 0x96, 0x8e, 0x89, 0x92, 0xa0, 0xaa, 0xac, 0xab, 0xa4, 0xa2,
-  0xa2, 0xa0, 0x9c, 0x99, 0x92, 0x8a, 0x84, 0x7e, 0x77, 0x70, 0x66, 0x5f,
-  0x5f, 0x67, 0x6e, 0x72, 0x70, 0x68, 0x62, 0x61, 0x68, 0x73, 0x7e, 0x88,
-  0x8f, 0x91, 0x91, 0x90, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8b, 0x85,
-  0x81, 0x7f, 0x7c, 0x7a, 0x7a, 0x7c, 0x7f, 0x86, 0x90, 0x99, 0x9b, 0x92,
-  0x7d, 0x6d, 0x66, 0x5b, 0x4d, 0x41, 0x3c, 0x47, 0x66, 0x7e, 0x89, 0x93,
-  0x98, 0x98, 0x97, 0x92, 0x8d, 0x8e, 0x94, 0x9f, 0xac, 0xb7, 0xc0, 0xc4,
-  0xc0, 0xb4, 0xa0, 0x8c, 0x7c, 0x71, 0x6c, 0x70, 0x76, 0x74, 0x71, 0x6f,
-  0x6d, 0x68, 0x60, 0x55, 0x4b, 0x48, 0x4c, 0x53, 0x5d, 0x6c, 0x7d, 0x8b,
-  0x94, 0x95, 0x92, 0x90, 0x8e, 0x8c, 0x8c, 0x8e, 0x8f, 0x90, 0x90, 0x8f,
-  0x8b, 0x85, 0x7c, 0x73, 0x6d, 0x6b, 0x6d, 0x73, 0x7b, 0x86, 0x94, 0xa9,
-  0xb7, 0xad, 0x86, 0x53, 0x29, 0x12, 0x1c, 0x4b, 0x71, 0x84, 0xa1, 0xa7,
-  0x83, 0x6e, 0x72, 0x76, 0x7a, 0x82, 0x8e, 0x9b, 0xaa, 0xb6, 0xc4, 0xd2,
-  0xd4, 0xc4, 0xa7, 0x88, 0x71, 0x65, 0x62, 0x66, 0x6e, 0x76, 0x7b, 0x79,
-  0x72, 0x69, 0x5e, 0x51, 0x44, 0x3b, 0x40, 0x52, 0x65, 0x75, 0x85, 0x8f,
-  0x91, 0x8a, 0x83, 0x80, 0x83, 0x8b, 0x93, 0x96, 0x95, 0x94, 0x93, 0x8f,
-  0x8d, 0x87, 0x7c, 0x72, 0x6e, 0x6f, 0x72, 0x76, 0x78, 0x7a, 0x87, 0xa0,
-  0xb8, 0xb8, 0x91, 0x50, 0x1c, 0x09, 0x20, 0x55, 0x7a, 0x93, 0xab, 0xa5,
-  0x92, 0x85, 0x77, 0x6d, 0x72, 0x82, 0x8e, 0x95, 0x9e, 0xae, 0xc5, 0xd5,
-  0xd4, 0xbd, 0x9c, 0x7e, 0x6a, 0x5d, 0x59, 0x60, 0x72, 0x81, 0x85, 0x7d,
-  0x71, 0x63, 0x5a, 0x52, 0x4c, 0x44, 0x40, 0x48, 0x60, 0x7d, 0x96, 0xa4,
-  0xa2, 0x8f, 0x79, 0x6d, 0x70, 0x83, 0x96, 0xa0, 0xa3, 0xa0, 0x9a, 0x91,
-  0x88, 0x7d, 0x72, 0x6b, 0x6c, 0x74, 0x79, 0x7c, 0x82, 0x8d, 0x9f, 0xb7,
-  0xbf, 0xa0, 0x5f, 0x21, 0x00, 0x12, 0x50, 0x80, 0xa5, 0xc8, 0xb0, 0x86,
-  0x7a, 0x64, 0x51, 0x59, 0x75, 0x90, 0xa1, 0xa5, 0xad, 0xc5, 0xd9, 0xd7,
-  0xb7, 0x8a, 0x6a, 0x5d, 0x59, 0x5c, 0x69, 0x80, 0x97, 0x9a, 0x87, 0x6c,
-  0x54, 0x49, 0x4a, 0x4c, 0x4c, 0x53, 0x60, 0x71, 0x87, 0x9f, 0xa9, 0x9c,
-  0x85, 0x74, 0x6c, 0x73, 0x86, 0x9b, 0xa9, 0xae, 0xa8, 0x9c, 0x8e, 0x82,
-  0x76, 0x6d, 0x6e, 0x74, 0x7e, 0x87, 0x8c, 0x91, 0xa2, 0xb9, 0xc4, 0xaa,
-  0x66, 0x1f, 0x00, 0x10, 0x51, 0x89, 0xba, 0xdb, 0xb1, 0x7b, 0x6e, 0x60,
-  0x4e, 0x51, 0x67, 0x84, 0xa0, 0xae, 0xb4, 0xc4, 0xd9, 0xdc, 0xc0, 0x8e,
-  0x5f, 0x48, 0x4b, 0x5e, 0x77, 0x93, 0xa7, 0xa6, 0x93, 0x76, 0x57, 0x42,
-  0x3c, 0x41, 0x4b, 0x5a, 0x6f, 0x88, 0xa0, 0xac, 0xa5, 0x8d, 0x71, 0x62,
-  0x66, 0x78, 0x8c, 0x9f, 0xab, 0xaa, 0xa0, 0x95, 0x89, 0x7d, 0x6f, 0x65,
-  0x65, 0x71, 0x81, 0x8b, 0x8e, 0x90, 0x9a, 0xac, 0xbf, 0xb8, 0x82, 0x35,
-  0x00, 0x00, 0x32, 0x78, 0xb2, 0xe9, 0xe2, 0x91, 0x52, 0x3a, 0x33, 0x3d,
-  0x50, 0x6c, 0x98, 0xc4, 0xda, 0xda, 0xca, 0xb9, 0xa6, 0x89, 0x65, 0x46,
-  0x44, 0x63, 0x8d, 0xad, 0xbb, 0xb2, 0x97, 0x74, 0x53, 0x3a, 0x38, 0x4c,
-  0x67, 0x80, 0x93, 0x9c, 0x9c, 0x98, 0x8e, 0x7d, 0x70, 0x6e, 0x74, 0x7f,
-  0x8c, 0x96, 0x9c, 0x9d, 0x98, 0x8d, 0x81, 0x7b, 0x77, 0x72, 0x71, 0x77,
-  0x84, 0x96, 0xaa, 0xc1, 0xce, 0xb4, 0x6d, 0x22, 0x00, 0x00, 0x3c, 0x8b,
-  0xce, 0xf2, 0xc8, 0x71, 0x38, 0x2b, 0x3e, 0x57, 0x66, 0x7a, 0x99, 0xba,
-  0xd2, 0xd4, 0xc3, 0xab, 0x97, 0x81, 0x65, 0x4e, 0x4a, 0x5d, 0x80, 0xa4,
-  0xb8, 0xb5, 0x9a, 0x6c, 0x41, 0x2c, 0x32, 0x4a, 0x6d, 0x91, 0xa5, 0xa6,
-  0x99, 0x87, 0x76, 0x6f, 0x70, 0x74, 0x75, 0x6e, 0x6c, 0x77, 0x86, 0x92,
-  0x9a, 0x98, 0x8c, 0x7d, 0x6f, 0x61, 0x5f, 0x70, 0x86, 0x99, 0xac, 0xc2,
-  0xd2, 0xca, 0x9c, 0x53, 0x0f, 0x00, 0x0f, 0x58, 0xa6, 0xe8, 0xff, 0xc5,
-  0x68, 0x25, 0x0f, 0x25, 0x4d, 0x6d, 0x8c, 0xb0, 0xd3, 0xe6, 0xdb, 0xb1,
-  0x7f, 0x5f, 0x54, 0x53, 0x59, 0x62, 0x76, 0x96, 0xbd, 0xcf, 0xba, 0x86,
-  0x4e, 0x28, 0x25, 0x41, 0x69, 0x8c, 0xa6, 0xaf, 0xa7, 0x95, 0x7e, 0x6b,
-  0x61, 0x60, 0x65, 0x6b, 0x6f, 0x76, 0x82, 0x92, 0x9e, 0xa0, 0x98, 0x8b,
-  0x79, 0x63, 0x59, 0x63, 0x79, 0x99, 0xba, 0xd5, 0xe0, 0xc8, 0x85, 0x35,
-  0x00, 0x00, 0x29, 0x7c, 0xc7, 0xfe, 0xf1, 0x9e, 0x49, 0x16, 0x11, 0x30,
-  0x54, 0x74, 0x9a, 0xc0, 0xdf, 0xe5, 0xc7, 0x96, 0x72, 0x67, 0x68, 0x6b,
-  0x6a, 0x69, 0x75, 0x92, 0xb6, 0xcb, 0xc1, 0x95, 0x59, 0x2b, 0x1b, 0x31,
-  0x5e, 0x8d, 0xb0, 0xbf, 0xb3, 0x93, 0x72, 0x5c, 0x57, 0x5e, 0x6a, 0x7a,
-  0x8d, 0x9e, 0xa4, 0x9a, 0x86, 0x74, 0x6c, 0x6b, 0x71, 0x76, 0x78, 0x7b,
-  0x85, 0x9a, 0xb7, 0xd3, 0xce, 0x8c, 0x32, 0x00, 0x00, 0x32, 0x85, 0xd1,
-  0xff, 0xf6, 0x9a, 0x42, 0x10, 0x0c, 0x2e, 0x5a, 0x8a, 0xbe, 0xee, 0xff,
-  0xf0, 0xb5, 0x74, 0x4b, 0x44, 0x59, 0x71, 0x81, 0x8e, 0xa1, 0xbc, 0xcc,
-  0xc0, 0x95, 0x5e, 0x2d, 0x17, 0x28, 0x52, 0x82, 0xad, 0xc6, 0xbc, 0x96,
-  0x6b, 0x4f, 0x48, 0x55, 0x65, 0x71, 0x7e, 0x8c, 0x96, 0x9a, 0x99, 0x90,
-  0x83, 0x77, 0x6c, 0x66, 0x69, 0x72, 0x82, 0x98, 0xb4, 0xcb, 0xd1, 0xb5,
-  0x72, 0x25, 0x00, 0x00, 0x35, 0x87, 0xd3, 0xfd, 0xe9, 0x9b, 0x46, 0x0e,
-  0x02, 0x1f, 0x4f, 0x86, 0xbc, 0xe5, 0xef, 0xd4, 0x9a, 0x5d, 0x39, 0x3a,
-  0x52, 0x6c, 0x82, 0x96, 0xaf, 0xc9, 0xd0, 0xb8, 0x88, 0x51, 0x28, 0x20,
-  0x3a, 0x64, 0x8f, 0xb4, 0xc1, 0xab, 0x81, 0x5b, 0x42, 0x3e, 0x4e, 0x64,
-  0x7c, 0x90, 0x97, 0x91, 0x83, 0x73, 0x6a, 0x6c, 0x73, 0x7a, 0x80, 0x83,
-  0x86, 0x8e, 0xa2, 0xba, 0xc2, 0xa0, 0x5a, 0x18, 0x00, 0x18, 0x60, 0xb3,
-  0xee, 0xfa, 0xca, 0x7c, 0x39, 0x12, 0x0f, 0x2a, 0x55, 0x8a, 0xc3, 0xeb,
-  0xf0, 0xcb, 0x86, 0x44, 0x24, 0x34, 0x60, 0x8c, 0xab, 0xb7, 0xb4, 0xb1,
-  0xae, 0x9e, 0x7d, 0x57, 0x3b, 0x36, 0x4c, 0x72, 0x98, 0xb3, 0xba, 0xa7,
-  0x82, 0x5a, 0x41, 0x40, 0x54, 0x71, 0x8c, 0x9b, 0x9c, 0x91, 0x7c, 0x67,
-  0x5c, 0x5e, 0x6e, 0x81, 0x90, 0x96, 0x91, 0x87, 0x82, 0x83, 0x8e, 0xa2,
-  0xb5, 0xb8, 0x9a, 0x64, 0x34, 0x20, 0x35, 0x6d, 0xb2, 0xe6, 0xf0, 0xc6,
-  0x7d, 0x3d, 0x1b, 0x1f, 0x43, 0x78, 0xb1, 0xdd, 0xeb, 0xd6, 0x9f, 0x5e,
-  0x32, 0x2d, 0x4e, 0x7d, 0xa9, 0xc4, 0xc5, 0xb4, 0xa1, 0x93, 0x81, 0x69,
-  0x53, 0x4b, 0x58, 0x78, 0x9f, 0xbd, 0xc4, 0xb2, 0x8c, 0x63, 0x4a, 0x47,
-  0x57, 0x70, 0x8e, 0xa5, 0xad, 0xa1, 0x8a, 0x71, 0x5f, 0x5c, 0x66, 0x77,
-  0x88, 0x92, 0x94, 0x91, 0x93, 0x9d, 0xab, 0xaf, 0x98, 0x66, 0x34, 0x21,
-  0x3d, 0x76, 0xb4, 0xde, 0xe2, 0xbd, 0x86, 0x59, 0x3e, 0x37, 0x42, 0x62,
-  0x92, 0xc7, 0xee, 0xea, 0xb5, 0x6e, 0x3e, 0x34, 0x50, 0x7a, 0x9f, 0xb7,
-  0xc0, 0xbb, 0xae, 0x9d, 0x88, 0x70, 0x5e, 0x58, 0x63, 0x79, 0x94, 0xaa,
-  0xb5, 0xad, 0x94, 0x73, 0x5a, 0x4f, 0x56, 0x6a, 0x82, 0x93, 0x9c, 0x9c,
-  0x92, 0x81, 0x70, 0x65, 0x63, 0x6a, 0x77, 0x85, 0x8e, 0x94, 0x95, 0x93,
-  0x94, 0x97, 0x96, 0x85, 0x65, 0x4a, 0x48, 0x60, 0x89, 0xb6, 0xd2, 0xcc,
-  0xa9, 0x7a, 0x56, 0x48, 0x4c, 0x5e, 0x7e, 0xa9, 0xce, 0xd9, 0xc2, 0x8d,
-  0x55, 0x36, 0x3c, 0x5d, 0x84, 0xa7, 0xc0, 0xc2, 0xae, 0x8b, 0x6a, 0x5e,
-  0x63, 0x6f, 0x7c, 0x8b, 0x97, 0x9e, 0xa1, 0x9e, 0x92, 0x80, 0x6d, 0x5e,
-  0x5f, 0x69, 0x75, 0x83, 0x90, 0x96, 0x94, 0x88, 0x77, 0x68, 0x61, 0x66,
-  0x71, 0x80, 0x8c, 0x93, 0x91, 0x89, 0x7e, 0x78, 0x76, 0x7a, 0x80, 0x85,
-  0x88, 0x85, 0x7a, 0x70, 0x6e, 0x78, 0x88, 0x97, 0x9d, 0x97, 0x8a, 0x7b,
-  0x71, 0x6e, 0x72, 0x7a, 0x85, 0x92, 0x9c, 0x9c, 0x92, 0x80, 0x6e, 0x66,
-  0x6b, 0x75, 0x81, 0x8e, 0x95, 0x97, 0x91, 0x82, 0x72, 0x6d, 0x6e, 0x75,
-  0x7e, 0x8a, 0x93, 0x95, 0x8f, 0x86, 0x7e, 0x79, 0x76, 0x77, 0x7a, 0x7d,
-  0x7f, 0x81, 0x84, 0x84, 0x81, 0x7d, 0x77, 0x72, 0x6f, 0x72, 0x78, 0x7e,
-  0x82, 0x84, 0x82, 0x7c, 0x78, 0x77, 0x7b, 0x7d, 0x7a, 0x78, 0x76, 0x7a,
-  0x82, 0x89, 0x8e, 0x8c, 0x7e, 0x6b, 0x62, 0x6a, 0x7a, 0x87, 0x8d, 0x8d,
-  0x88, 0x82, 0x7a, 0x74, 0x70, 0x6f, 0x72, 0x7d, 0x8a, 0x90, 0x8d, 0x82,
-  0x73, 0x6c, 0x6e, 0x73, 0x78, 0x7e, 0x84, 0x88, 0x86, 0x81, 0x7c, 0x78,
-  0x78, 0x7a, 0x7e, 0x82, 0x86, 0x88, 0x88, 0x85, 0x80, 0x7b, 0x76, 0x75,
-  0x78, 0x7f, 0x85, 0x86, 0x84, 0x84, 0x81, 0x78, 0x73, 0x76, 0x7c, 0x80,
-  0x83, 0x83, 0x83, 0x83, 0x82, 0x80, 0x82, 0x82, 0x7c, 0x79, 0x7b, 0x7c,
-  0x73, 0x6c, 0x72, 0x7b, 0x7c, 0x7b, 0x80, 0x86, 0x87, 0x83, 0x7b, 0x75,
-  0x6e, 0x67, 0x6a, 0x7a, 0x8a, 0x8e, 0x88, 0x82, 0x7a, 0x71, 0x69, 0x68,
-  0x72, 0x7d, 0x84, 0x86, 0x84, 0x82, 0x7f, 0x78, 0x71, 0x71, 0x77, 0x7e,
-  0x84, 0x87, 0x89, 0x88, 0x86, 0x82, 0x7e, 0x79, 0x76, 0x77, 0x7b, 0x80,
-  0x85, 0x89, 0x88, 0x84, 0x7e, 0x79, 0x75, 0x74, 0x78, 0x7f, 0x87, 0x8e,
-  0x8f, 0x87, 0x79, 0x6d, 0x6a, 0x71, 0x7c, 0x83, 0x87, 0x85, 0x7c, 0x73,
-  0x73, 0x78, 0x7e, 0x80, 0x7c, 0x76, 0x70, 0x6f, 0x76, 0x80, 0x85, 0x81,
-  0x79, 0x75, 0x78, 0x7e, 0x7d, 0x75, 0x6a, 0x64, 0x6c, 0x7f, 0x90, 0x96,
-  0x8d, 0x7c, 0x6c, 0x67, 0x6e, 0x7a, 0x82, 0x86, 0x84, 0x80, 0x81, 0x82,
-  0x80, 0x7a, 0x76, 0x76, 0x77, 0x7c, 0x84, 0x87, 0x86, 0x82, 0x7e, 0x7b,
-  0x7b, 0x7d, 0x81, 0x83, 0x82, 0x82, 0x82, 0x84, 0x84, 0x82, 0x7f, 0x7c,
-  0x7b, 0x7e, 0x86, 0x8b, 0x89, 0x83, 0x7e, 0x7d, 0x81, 0x84, 0x86, 0x88,
-  0x88, 0x84, 0x7d, 0x7a, 0x82, 0x89, 0x8a, 0x86, 0x7d, 0x73, 0x71, 0x7a,
-  0x89, 0x96, 0x98, 0x8c, 0x78, 0x67, 0x64, 0x6e, 0x7a, 0x85, 0x8d, 0x92,
-  0x92, 0x8e, 0x87, 0x7b, 0x6a, 0x5d, 0x62, 0x77, 0x8e, 0x9f, 0xa3, 0x98,
-  0x84, 0x71, 0x67, 0x69, 0x76, 0x86, 0x93, 0x99, 0x9a, 0x92, 0x82, 0x72,
-  0x6c, 0x74, 0x84, 0x93, 0x9a, 0x97, 0x8e, 0x83, 0x7c, 0x7b, 0x7e, 0x81,
-  0x83, 0x87, 0x8c, 0x8e, 0x8c, 0x86, 0x81, 0x80, 0x82, 0x84, 0x85, 0x87,
-  0x8b, 0x8f, 0x8e, 0x89, 0x82, 0x7c, 0x7b, 0x81, 0x8a, 0x92, 0x95, 0x92,
-  0x88, 0x81, 0x7e, 0x7f, 0x83, 0x88, 0x8c, 0x8e, 0x8e, 0x8d, 0x86, 0x7b,
-  0x74, 0x76, 0x81, 0x8e, 0x94, 0x94, 0x8c, 0x7e, 0x73, 0x72, 0x7a, 0x84,
-  0x8a, 0x8b, 0x8a, 0x8a, 0x88, 0x84, 0x7d, 0x7a, 0x7e, 0x84, 0x8a, 0x8d,
-  0x89, 0x82, 0x7e, 0x81, 0x89, 0x8f, 0x8e, 0x87, 0x80, 0x7e, 0x82, 0x88,
-  0x89, 0x88, 0x87, 0x87, 0x86, 0x86, 0x84, 0x84, 0x84, 0x83, 0x85, 0x89,
-  0x8b, 0x89, 0x84, 0x80, 0x7f, 0x82, 0x86, 0x88, 0x86, 0x84, 0x83, 0x82,
-  0x82, 0x84, 0x86, 0x86, 0x85, 0x83, 0x82, 0x82, 0x84, 0x87, 0x89, 0x88,
-  0x87, 0x86, 0x85, 0x84, 0x84, 0x84, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x82, 0x82, 0x83, 0x82, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x82, 0x82,
-  0x81, 0x81, 0x80, 0x7e, 0x7b, 0x7b, 0x7c, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d,
-  0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7f, 0x7f, 0x7d, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x80, 0x82,
-  0x81, 0x7c, 0x78, 0x77, 0x7a, 0x7e, 0x81, 0x82, 0x82, 0x7e, 0x78, 0x75,
-  0x77, 0x7b, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b,
-  0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7a, 0x79, 0x79, 0x7a, 0x7c, 0x7e,
-  0x7f, 0x7e, 0x7d, 0x7e, 0x7d, 0x7c, 0x7a, 0x7a, 0x7c, 0x7e, 0x7e, 0x7d,
-  0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x7a, 0x7b,
-  0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7a, 0x78, 0x78, 0x7b, 0x7e, 0x7f, 0x7d,
-  0x7a, 0x79, 0x79, 0x7b, 0x7c, 0x7c, 0x7b, 0x79, 0x79, 0x7a, 0x7c, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7a, 0x78, 0x77, 0x78, 0x7a, 0x7c, 0x7c,
-  0x7d, 0x7b, 0x79, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c,
-  0x7b, 0x7a, 0x7b, 0x7c, 0x7d, 0x7d, 0x7b, 0x7a, 0x78, 0x78, 0x78, 0x79,
-  0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7d,
-  0x7c, 0x7a, 0x78, 0x7a, 0x7c, 0x7e, 0x80, 0x7f, 0x7d, 0x7a, 0x78, 0x78,
-  0x7a, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x7a, 0x7c, 0x7d, 0x7e, 0x7e,
-  0x7a, 0x77, 0x77, 0x78, 0x7a, 0x7b, 0x7d, 0x7e, 0x7d, 0x7b, 0x7a, 0x7a,
-  0x7a, 0x7a, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7a, 0x7a, 0x7b,
-  0x7c, 0x7e, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7e, 0x7e,
-  0x80, 0x80, 0x81, 0x82, 0x81, 0x7f, 0x7d, 0x7b, 0x7b, 0x7d, 0x7f, 0x81,
-  0x82, 0x83, 0x83, 0x83, 0x82, 0x80, 0x7e, 0x7c, 0x7a, 0x7c, 0x7f, 0x82,
-  0x84, 0x85, 0x82, 0x7e, 0x7c, 0x7b, 0x7c, 0x7d, 0x80, 0x82, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x83, 0x82, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x84,
-  0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x83, 0x84, 0x85, 0x85, 0x84, 0x82,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x83, 0x83, 0x83, 0x83, 0x84,
-  0x84, 0x84, 0x82, 0x81, 0x80, 0x80, 0x82, 0x84, 0x86, 0x87, 0x85, 0x82,
-  0x81, 0x81, 0x82, 0x84, 0x85, 0x84, 0x84, 0x84, 0x82, 0x82, 0x85, 0x88,
-  0x89, 0x86, 0x84, 0x83, 0x83, 0x83, 0x83, 0x84, 0x83, 0x84, 0x84, 0x82,
-  0x81, 0x80, 0x81, 0x83, 0x84, 0x85, 0x85, 0x83, 0x81, 0x80, 0x81, 0x82,
-  0x83, 0x84, 0x85, 0x85, 0x85, 0x86, 0x85, 0x85, 0x83, 0x82, 0x82, 0x83,
-  0x85, 0x86, 0x86, 0x85, 0x86, 0x87, 0x86, 0x85, 0x84, 0x83, 0x84, 0x86,
-  0x86, 0x87, 0x86, 0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x82, 0x83,
-  0x84, 0x85, 0x84, 0x83, 0x81, 0x80, 0x81, 0x82, 0x83, 0x83, 0x83, 0x84,
-  0x85, 0x85, 0x84, 0x82, 0x81, 0x81, 0x7f, 0x7e, 0x80, 0x82, 0x85, 0x87,
-  0x88, 0x86, 0x83, 0x82, 0x80, 0x80, 0x81, 0x82, 0x83, 0x85, 0x86, 0x86,
-  0x85, 0x84, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x83, 0x84, 0x85, 0x85,
-  0x85, 0x84, 0x82, 0x7f, 0x7e, 0x80, 0x82, 0x83, 0x84, 0x83, 0x82, 0x80,
-  0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x83, 0x83, 0x81, 0x80,
-  0x7f, 0x7f, 0x80, 0x82, 0x82, 0x83, 0x84, 0x84, 0x82, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x80, 0x81, 0x82, 0x83, 0x83, 0x82, 0x82, 0x83, 0x82, 0x80,
-  0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7e,
-  0x80, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
-  0x82, 0x83, 0x84, 0x84, 0x83, 0x81, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x7f, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x81,
-  0x82, 0x83, 0x83, 0x83, 0x82, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81,
-  0x82, 0x80, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x82, 0x83, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x80, 0x82, 0x82, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7d, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7a, 0x7a, 0x7a, 0x7b, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x7d, 0x7c, 0x7c, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x7b,
-  0x7c, 0x7b, 0x7a, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x7b, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7d, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7e, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7a,
-  0x7c, 0x81, 0x87, 0x8a, 0x8a, 0x86, 0x7e, 0x78, 0x74, 0x76, 0x7c, 0x84,
-  0x87, 0x86, 0x83, 0x81, 0x7d, 0x78, 0x76, 0x79, 0x80, 0x83, 0x80, 0x80,
-  0x83, 0x83, 0x7f, 0x7c, 0x7c, 0x80, 0x83, 0x83, 0x80, 0x7c, 0x7a, 0x7b,
-  0x7e, 0x83, 0x86, 0x87, 0x84, 0x7f, 0x7a, 0x78, 0x7a, 0x7e, 0x84, 0x86,
-  0x88, 0x88, 0x86, 0x82, 0x7c, 0x79, 0x77, 0x77, 0x7b, 0x82, 0x87, 0x86,
-  0x83, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7f, 0x80, 0x7e, 0x7e, 0x81, 0x82,
-  0x82, 0x81, 0x7f, 0x7c, 0x7b, 0x7e, 0x82, 0x85, 0x86, 0x84, 0x7e, 0x7a,
-  0x7a, 0x7e, 0x84, 0x8a, 0x8c, 0x8a, 0x85, 0x7e, 0x79, 0x78, 0x7b, 0x7f,
-  0x82, 0x84, 0x8a, 0x8e, 0x8d, 0x83, 0x76, 0x70, 0x72, 0x76, 0x7f, 0x8a,
-  0x90, 0x90, 0x8b, 0x83, 0x7b, 0x75, 0x73, 0x76, 0x7f, 0x8a, 0x93, 0x96,
-  0x92, 0x88, 0x7b, 0x72, 0x71, 0x79, 0x86, 0x8f, 0x93, 0x91, 0x8a, 0x81,
-  0x7a, 0x79, 0x7c, 0x80, 0x84, 0x87, 0x88, 0x87, 0x86, 0x84, 0x80, 0x7d,
-  0x7e, 0x84, 0x86, 0x81, 0x7d, 0x80, 0x7f, 0x78, 0x76, 0x80, 0x8e, 0x91,
-  0x8e, 0x8b, 0x86, 0x7d, 0x76, 0x77, 0x82, 0x8c, 0x91, 0x8f, 0x8a, 0x84,
-  0x7b, 0x74, 0x75, 0x7d, 0x82, 0x81, 0x82, 0x86, 0x8a, 0x88, 0x85, 0x81,
-  0x7e, 0x7c, 0x79, 0x76, 0x7a, 0x86, 0x95, 0x9c, 0x96, 0x81, 0x6c, 0x65,
-  0x6c, 0x7c, 0x8d, 0x97, 0x9a, 0x95, 0x86, 0x78, 0x71, 0x76, 0x80, 0x89,
-  0x91, 0x94, 0x93, 0x8a, 0x7b, 0x6e, 0x6d, 0x77, 0x84, 0x8e, 0x93, 0x92,
-  0x89, 0x7f, 0x74, 0x6e, 0x73, 0x7c, 0x82, 0x82, 0x84, 0x8b, 0x8d, 0x8a,
-  0x86, 0x80, 0x76, 0x71, 0x7a, 0x8a, 0x99, 0x9d, 0x93, 0x80, 0x74, 0x75,
-  0x7e, 0x86, 0x8a, 0x8c, 0x8a, 0x85, 0x82, 0x81, 0x83, 0x85, 0x82, 0x7b,
-  0x78, 0x7f, 0x89, 0x8b, 0x87, 0x82, 0x7d, 0x7c, 0x7a, 0x78, 0x7a, 0x7f,
-  0x83, 0x84, 0x85, 0x84, 0x7e, 0x7b, 0x7b, 0x7f, 0x83, 0x86, 0x8a, 0x8d,
-  0x8a, 0x82, 0x7d, 0x7c, 0x7a, 0x72, 0x73, 0x86, 0x9c, 0xa7, 0xa2, 0x94,
-  0x82, 0x6d, 0x61, 0x63, 0x73, 0x89, 0x9a, 0x9c, 0x90, 0x83, 0x7e, 0x7e,
-  0x7b, 0x74, 0x6f, 0x73, 0x7e, 0x88, 0x8c, 0x8f, 0x8e, 0x89, 0x7f, 0x75,
-  0x70, 0x74, 0x7c, 0x85, 0x87, 0x83, 0x7e, 0x7e, 0x7f, 0x7a, 0x74, 0x74,
-  0x7c, 0x83, 0x84, 0x81, 0x7e, 0x7c, 0x7b, 0x78, 0x7b, 0x82, 0x86, 0x88,
-  0x88, 0x85, 0x80, 0x7b, 0x7a, 0x7e, 0x84, 0x8a, 0x8c, 0x8a, 0x87, 0x81,
-  0x7a, 0x77, 0x77, 0x7a, 0x7e, 0x80, 0x81, 0x83, 0x86, 0x86, 0x84, 0x7f,
-  0x77, 0x70, 0x6e, 0x75, 0x7f, 0x87, 0x8b, 0x88, 0x80, 0x77, 0x72, 0x75,
-  0x7d, 0x80, 0x7f, 0x82, 0x8c, 0x93, 0x91, 0x87, 0x7d, 0x79, 0x7d, 0x86,
-  0x8a, 0x84, 0x7c, 0x7b, 0x7e, 0x82, 0x82, 0x83, 0x82, 0x7a, 0x72, 0x73,
-  0x7c, 0x83, 0x81, 0x79, 0x75, 0x7a, 0x84, 0x8c, 0x88, 0x75, 0x5d, 0x57,
-  0x6c, 0x8c, 0xa0, 0x9e, 0x8c, 0x77, 0x6a, 0x66, 0x68, 0x73, 0x85, 0x93,
-  0x96, 0x8f, 0x86, 0x7e, 0x76, 0x6e, 0x6a, 0x71, 0x83, 0x94, 0x9b, 0x96,
-  0x8b, 0x7b, 0x6f, 0x6f, 0x78, 0x84, 0x8b, 0x8d, 0x8c, 0x8a, 0x86, 0x80,
-  0x77, 0x72, 0x70, 0x74, 0x7a, 0x80, 0x84, 0x86, 0x85, 0x81, 0x7c, 0x78,
-  0x77, 0x78, 0x79, 0x7a, 0x80, 0x84, 0x86, 0x82, 0x7a, 0x71, 0x6a, 0x68,
-  0x6d, 0x79, 0x87, 0x8e, 0x8b, 0x80, 0x76, 0x71, 0x76, 0x83, 0x8e, 0x8c,
-  0x7c, 0x64, 0x5b, 0x6b, 0x8a, 0xa0, 0x9d, 0x85, 0x6d, 0x68, 0x6e, 0x72,
-  0x72, 0x77, 0x82, 0x8f, 0x96, 0x94, 0x8a, 0x7b, 0x6c, 0x64, 0x6a, 0x7c,
-  0x8e, 0x99, 0x9b, 0x92, 0x82, 0x74, 0x6d, 0x71, 0x7b, 0x83, 0x87, 0x88,
-  0x8a, 0x8c, 0x89, 0x82, 0x79, 0x75, 0x76, 0x76, 0x76, 0x7c, 0x85, 0x8d,
-  0x8f, 0x8b, 0x83, 0x79, 0x70, 0x6c, 0x6d, 0x73, 0x7c, 0x84, 0x89, 0x88,
-  0x84, 0x80, 0x7c, 0x74, 0x6d, 0x70, 0x79, 0x84, 0x8c, 0x8e, 0x90, 0x90,
-  0x82, 0x5e, 0x3a, 0x37, 0x5a, 0x87, 0xa2, 0xa3, 0x94, 0x81, 0x73, 0x64,
-  0x54, 0x52, 0x64, 0x7d, 0x90, 0x9c, 0xa2, 0xa1, 0x94, 0x7b, 0x64, 0x5d,
-  0x6a, 0x7f, 0x92, 0xa0, 0xa6, 0xa0, 0x93, 0x86, 0x81, 0x80, 0x7f, 0x7d,
-  0x80, 0x87, 0x8c, 0x8c, 0x8a, 0x86, 0x7c, 0x71, 0x6a, 0x68, 0x6c, 0x72,
-  0x75, 0x77, 0x7b, 0x7e, 0x7d, 0x7b, 0x76, 0x72, 0x72, 0x72, 0x73, 0x76,
-  0x79, 0x7b, 0x7b, 0x7b, 0x7c, 0x7f, 0x89, 0x92, 0x91, 0x7a, 0x52, 0x33,
-  0x39, 0x61, 0x91, 0xb0, 0xb6, 0xa4, 0x89, 0x70, 0x5a, 0x4f, 0x55, 0x67,
-  0x7c, 0x90, 0xa2, 0xac, 0xa8, 0x91, 0x72, 0x5d, 0x60, 0x71, 0x83, 0x8e,
-  0x95, 0x9a, 0x9d, 0x9a, 0x93, 0x8d, 0x86, 0x7c, 0x71, 0x6c, 0x71, 0x7e,
-  0x8c, 0x94, 0x93, 0x89, 0x7a, 0x6c, 0x63, 0x60, 0x62, 0x68, 0x72, 0x7c,
-  0x83, 0x86, 0x86, 0x83, 0x7e, 0x78, 0x74, 0x6e, 0x6c, 0x6e, 0x76, 0x81,
-  0x8c, 0x94, 0x99, 0x9c, 0x9a, 0x84, 0x5a, 0x36, 0x33, 0x53, 0x83, 0xab,
-  0xbd, 0xb7, 0xa4, 0x88, 0x69, 0x53, 0x51, 0x5f, 0x74, 0x8b, 0x9e, 0xa9,
-  0xab, 0xa2, 0x90, 0x7e, 0x73, 0x72, 0x74, 0x7a, 0x81, 0x88, 0x94, 0xa1,
-  0xa8, 0xa5, 0x9a, 0x8c, 0x7c, 0x6c, 0x67, 0x6e, 0x7a, 0x87, 0x91, 0x95,
-  0x91, 0x85, 0x77, 0x6c, 0x66, 0x64, 0x67, 0x6e, 0x77, 0x7f, 0x86, 0x8b,
-  0x8f, 0x8e, 0x8a, 0x82, 0x76, 0x6c, 0x6c, 0x73, 0x7c, 0x88, 0x93, 0x9a,
-  0x9e, 0xa0, 0x94, 0x6c, 0x38, 0x1f, 0x38, 0x71, 0xa8, 0xc3, 0xc2, 0xac,
-  0x8e, 0x6f, 0x56, 0x4f, 0x5b, 0x72, 0x8a, 0x9e, 0xa9, 0xaa, 0xa4, 0x98,
-  0x8c, 0x83, 0x82, 0x87, 0x87, 0x81, 0x7d, 0x83, 0x91, 0x9e, 0xa6, 0xa9,
-  0xa3, 0x90, 0x77, 0x66, 0x64, 0x6d, 0x78, 0x82, 0x8a, 0x8c, 0x87, 0x7d,
-  0x72, 0x6c, 0x68, 0x66, 0x67, 0x6d, 0x76, 0x80, 0x8a, 0x90, 0x93, 0x92,
-  0x89, 0x7b, 0x70, 0x6e, 0x74, 0x80, 0x8b, 0x99, 0xa7, 0xb0, 0xa8, 0x80,
-  0x48, 0x24, 0x34, 0x69, 0x9f, 0xbe, 0xbc, 0xa4, 0x88, 0x72, 0x60, 0x5b,
-  0x66, 0x7b, 0x8e, 0x9a, 0x9c, 0x99, 0x99, 0x9a, 0x9a, 0x9a, 0x9b, 0x9c,
-  0x94, 0x82, 0x77, 0x80, 0x95, 0xa8, 0xb1, 0xae, 0xa2, 0x8f, 0x78, 0x68,
-  0x66, 0x6f, 0x78, 0x7b, 0x7a, 0x78, 0x76, 0x76, 0x77, 0x77, 0x74, 0x6f,
-  0x6a, 0x68, 0x6c, 0x75, 0x7f, 0x88, 0x90, 0x96, 0x94, 0x8b, 0x7f, 0x76,
-  0x77, 0x80, 0x8d, 0x9d, 0xab, 0xaa, 0x8e, 0x5a, 0x2e, 0x2a, 0x52, 0x89,
-  0xb2, 0xbe, 0xa9, 0x86, 0x68, 0x59, 0x56, 0x61, 0x75, 0x8c, 0x9c, 0x9d,
-  0x93, 0x8b, 0x8d, 0x95, 0x9d, 0xa0, 0x9d, 0x96, 0x88, 0x78, 0x73, 0x80,
-  0x97, 0xa9, 0xad, 0xa4, 0x90, 0x78, 0x69, 0x65, 0x69, 0x6f, 0x72, 0x72,
-  0x71, 0x6e, 0x6f, 0x72, 0x74, 0x74, 0x71, 0x6c, 0x6a, 0x6c, 0x72, 0x7a,
-  0x85, 0x8e, 0x96, 0x96, 0x8e, 0x82, 0x7a, 0x76, 0x76, 0x7d, 0x8a, 0x9b,
-  0xae, 0xb6, 0xa3, 0x6b, 0x2b, 0x12, 0x33, 0x79, 0xb7, 0xd0, 0xbb, 0x89,
-  0x60, 0x52, 0x55, 0x63, 0x72, 0x7e, 0x8d, 0x9a, 0x97, 0x8c, 0x8a, 0x97,
-  0xab, 0xb4, 0xac, 0x9a, 0x88, 0x79, 0x6f, 0x72, 0x86, 0xa2, 0xb2, 0xad,
-  0x99, 0x82, 0x6e, 0x65, 0x65, 0x6a, 0x71, 0x72, 0x6b, 0x61, 0x5b, 0x5d,
-  0x6a, 0x77, 0x7e, 0x7c, 0x73, 0x6a, 0x66, 0x69, 0x74, 0x88, 0x9a, 0xa1,
-  0x99, 0x8c, 0x81, 0x7c, 0x7e, 0x86, 0x8c, 0x8a, 0x8a, 0x91, 0xa1, 0xb0,
-  0xb8, 0xa3, 0x62, 0x1e, 0x06, 0x2d, 0x78, 0xbc, 0xe3, 0xce, 0x81, 0x43,
-  0x37, 0x4a, 0x61, 0x6c, 0x72, 0x82, 0x9b, 0xa5, 0x98, 0x8b, 0x92, 0xaa,
-  0xbf, 0xbc, 0x9b, 0x73, 0x5f, 0x65, 0x7a, 0x92, 0xaa, 0xb6, 0xac, 0x91,
-  0x73, 0x61, 0x5d, 0x60, 0x68, 0x6f, 0x6f, 0x66, 0x5c, 0x57, 0x5a, 0x65,
-  0x72, 0x7c, 0x7e, 0x77, 0x69, 0x60, 0x67, 0x7a, 0x8e, 0x9a, 0x99, 0x89,
-  0x76, 0x70, 0x7a, 0x8c, 0x99, 0x9b, 0x90, 0x81, 0x7d, 0x89, 0xa3, 0xbd,
-  0xc1, 0x98, 0x4a, 0x0b, 0x02, 0x39, 0x8c, 0xd0, 0xed, 0xba, 0x5e, 0x29,
-  0x28, 0x47, 0x63, 0x6b, 0x72, 0x85, 0x9d, 0xa4, 0x94, 0x81, 0x8a, 0xab,
-  0xc6, 0xbf, 0x8f, 0x54, 0x39, 0x52, 0x85, 0xb1, 0xc6, 0xbe, 0x9f, 0x77,
-  0x5c, 0x54, 0x5a, 0x63, 0x6b, 0x6c, 0x67, 0x60, 0x5c, 0x60, 0x6c, 0x77,
-  0x7c, 0x78, 0x6e, 0x64, 0x62, 0x66, 0x71, 0x84, 0x93, 0x9a, 0x9a, 0x92,
-  0x83, 0x78, 0x7a, 0x81, 0x87, 0x8a, 0x8a, 0x86, 0x8a, 0x9d, 0xb6, 0xc2,
-  0xab, 0x68, 0x1d, 0x00, 0x13, 0x61, 0xb2, 0xe4, 0xdd, 0x93, 0x46, 0x31,
-  0x47, 0x61, 0x6c, 0x6e, 0x75, 0x8d, 0xa2, 0xa2, 0x90, 0x8e, 0xaa, 0xcc,
-  0xd2, 0xab, 0x69, 0x3e, 0x48, 0x77, 0xa2, 0xba, 0xbb, 0xa8, 0x89, 0x6c,
-  0x59, 0x53, 0x5b, 0x66, 0x6e, 0x70, 0x66, 0x55, 0x50, 0x5c, 0x70, 0x83,
-  0x87, 0x7f, 0x75, 0x70, 0x71, 0x78, 0x84, 0x90, 0x9b, 0x9b, 0x92, 0x8a,
-  0x87, 0x88, 0x8d, 0x95, 0x97, 0x8e, 0x83, 0x7d, 0x86, 0xa3, 0xc3, 0xc6,
-  0x9c, 0x54, 0x11, 0x00, 0x23, 0x78, 0xc7, 0xea, 0xce, 0x81, 0x40, 0x35,
-  0x50, 0x6c, 0x7b, 0x83, 0x8a, 0x96, 0xa0, 0x9f, 0x99, 0xa1, 0xbc, 0xd1,
-  0xc6, 0x9a, 0x60, 0x42, 0x56, 0x88, 0xb6, 0xcc, 0xc7, 0xa7, 0x7d, 0x5c,
-  0x4c, 0x50, 0x63, 0x75, 0x7a, 0x73, 0x66, 0x5e, 0x67, 0x77, 0x7d, 0x7a,
-  0x74, 0x6b, 0x64, 0x69, 0x77, 0x88, 0x94, 0x9e, 0xa5, 0xa6, 0x9d, 0x91,
-  0x8a, 0x8a, 0x8c, 0x8d, 0x8d, 0x8b, 0x88, 0x8a, 0x93, 0xa0, 0xaf, 0xb4,
-  0x9d, 0x61, 0x1b, 0x00, 0x13, 0x62, 0xb4, 0xdc, 0xc4, 0x80, 0x49, 0x42,
-  0x55, 0x62, 0x68, 0x70, 0x7f, 0x90, 0x96, 0x8d, 0x8a, 0xa5, 0xd3, 0xea,
-  0xcd, 0x87, 0x48, 0x3e, 0x66, 0x98, 0xb4, 0xbc, 0xb9, 0xae, 0x96, 0x72,
-  0x52, 0x4a, 0x5d, 0x73, 0x78, 0x67, 0x51, 0x49, 0x53, 0x65, 0x72, 0x72,
-  0x66, 0x5a, 0x59, 0x63, 0x70, 0x7c, 0x86, 0x8c, 0x92, 0x98, 0x98, 0x90,
-  0x86, 0x85, 0x8a, 0x89, 0x83, 0x81, 0x83, 0x88, 0x8e, 0x95, 0x9e, 0xa4,
-  0x9c, 0x7e, 0x4a, 0x14, 0x00, 0x1d, 0x6b, 0xb2, 0xcc, 0xb0, 0x70, 0x37,
-  0x30, 0x50, 0x6f, 0x7c, 0x79, 0x6e, 0x6b, 0x78, 0x8c, 0x9f, 0xb4, 0xc7,
-  0xc8, 0xab, 0x79, 0x50, 0x49, 0x6b, 0x9e, 0xc0, 0xc6, 0xb0, 0x8e, 0x6d,
-  0x5e, 0x61, 0x6c, 0x74, 0x72, 0x66, 0x59, 0x56, 0x5f, 0x71, 0x7f, 0x7c,
-  0x68, 0x55, 0x50, 0x58, 0x64, 0x73, 0x83, 0x8c, 0x8b, 0x8b, 0x90, 0x95,
-  0x94, 0x8d, 0x8a, 0x89, 0x86, 0x87, 0x8e, 0x94, 0x99, 0xa0, 0xa5, 0xa5,
-  0x9b, 0x7e, 0x4d, 0x1e, 0x17, 0x47, 0x8b, 0xb7, 0xb7, 0x8d, 0x5e, 0x51,
-  0x61, 0x70, 0x75, 0x74, 0x74, 0x74, 0x77, 0x7c, 0x87, 0x9c, 0xb9, 0xd0,
-  0xcb, 0xa0, 0x6c, 0x58, 0x6f, 0x98, 0xb2, 0xb4, 0xaa, 0xa2, 0x9e, 0x95,
-  0x82, 0x6d, 0x6d, 0x7e, 0x86, 0x76, 0x5e, 0x5a, 0x6e, 0x82, 0x84, 0x77,
-  0x66, 0x5b, 0x5a, 0x60, 0x68, 0x75, 0x84, 0x90, 0x94, 0x91, 0x8e, 0x90,
-  0x91, 0x8c, 0x86, 0x86, 0x87, 0x88, 0x8a, 0x93, 0x9d, 0xa3, 0xa5, 0xa4,
-  0x9e, 0x94, 0x7c, 0x52, 0x2c, 0x32, 0x66, 0x9c, 0xb8, 0xb2, 0x91, 0x6b,
-  0x5b, 0x63, 0x70, 0x79, 0x7b, 0x75, 0x6d, 0x72, 0x86, 0x9c, 0xaa, 0xb1,
-  0xb6, 0xae, 0x95, 0x75, 0x64, 0x6e, 0x8d, 0xab, 0xb6, 0xaf, 0xa2, 0x97,
-  0x90, 0x8c, 0x86, 0x7f, 0x7b, 0x7a, 0x74, 0x6d, 0x71, 0x81, 0x8f, 0x92,
-  0x88, 0x77, 0x65, 0x5a, 0x5c, 0x69, 0x74, 0x7b, 0x82, 0x89, 0x8e, 0x8e,
-  0x8e, 0x8b, 0x85, 0x80, 0x80, 0x82, 0x87, 0x8e, 0x90, 0x93, 0x9a, 0xa3,
-  0xa8, 0xa4, 0x90, 0x6a, 0x41, 0x32, 0x51, 0x84, 0xa4, 0xa7, 0x93, 0x7a,
-  0x6d, 0x71, 0x7a, 0x7c, 0x7a, 0x78, 0x74, 0x71, 0x74, 0x80, 0x90, 0xa2,
-  0xb1, 0xb3, 0x9f, 0x7d, 0x66, 0x6a, 0x81, 0x97, 0x9c, 0x96, 0x92, 0x98,
-  0x9a, 0x93, 0x89, 0x87, 0x86, 0x7f, 0x70, 0x63, 0x65, 0x74, 0x85, 0x8c,
-  0x88, 0x7d, 0x70, 0x66, 0x64, 0x66, 0x6c, 0x72, 0x76, 0x7a, 0x7e, 0x85,
-  0x8b, 0x8c, 0x88, 0x84, 0x82, 0x7c, 0x76, 0x76, 0x7c, 0x83, 0x88, 0x8a,
-  0x89, 0x8c, 0x90, 0x8e, 0x82, 0x6e, 0x5a, 0x53, 0x63, 0x80, 0x96, 0x9a,
-  0x90, 0x83, 0x78, 0x78, 0x80, 0x83, 0x7e, 0x79, 0x77, 0x79, 0x7f, 0x88,
-  0x90, 0x94, 0x96, 0x95, 0x8c, 0x82, 0x7a, 0x79, 0x7e, 0x85, 0x8a, 0x89,
-  0x85, 0x84, 0x84, 0x87, 0x89, 0x8a, 0x87, 0x81, 0x79, 0x74, 0x75, 0x7a,
-  0x81, 0x86, 0x86, 0x82, 0x7c, 0x78, 0x78, 0x78, 0x79, 0x77, 0x77, 0x78,
-  0x7a, 0x7d, 0x82, 0x83, 0x81, 0x7d, 0x7a, 0x79, 0x7a, 0x7c, 0x7f, 0x82,
-  0x81, 0x80, 0x7e, 0x7d, 0x7e, 0x83, 0x86, 0x86, 0x82, 0x79, 0x70, 0x70,
-  0x79, 0x83, 0x85, 0x83, 0x80, 0x7e, 0x7e, 0x7d, 0x7b, 0x7a, 0x7b, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x81, 0x83, 0x83, 0x84, 0x85, 0x84, 0x81, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x80, 0x83, 0x85, 0x84, 0x82, 0x81, 0x82, 0x82, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x84, 0x83, 0x81, 0x7e,
-  0x7c, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x7f, 0x7c, 0x7a, 0x7b, 0x7d, 0x7e,
-  0x7c, 0x7a, 0x78, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7a, 0x7a, 0x7a, 0x79,
-  0x78, 0x77, 0x76, 0x76, 0x76, 0x77, 0x77, 0x76, 0x75, 0x75, 0x76, 0x78,
-  0x79, 0x7a, 0x7c, 0x7b, 0x79, 0x79, 0x7b, 0x7e, 0x80, 0x82, 0x82, 0x82,
-  0x83, 0x83, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7f, 0x83, 0x85, 0x86,
-  0x85, 0x85, 0x85, 0x86, 0x85, 0x84, 0x84, 0x85, 0x85, 0x83, 0x81, 0x82,
-  0x85, 0x87, 0x88, 0x87, 0x86, 0x84, 0x82, 0x80, 0x7f, 0x81, 0x84, 0x85,
-  0x84, 0x81, 0x7f, 0x80, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x7a, 0x7d,
-  0x7f, 0x7e, 0x7b, 0x7b, 0x7b, 0x7a, 0x78, 0x76, 0x76, 0x77, 0x7a, 0x7a,
-  0x77, 0x75, 0x76, 0x7a, 0x7e, 0x80, 0x7f, 0x7d, 0x7b, 0x7c, 0x7e, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x85, 0x87, 0x87, 0x84, 0x81,
-  0x7e, 0x80, 0x84, 0x88, 0x89, 0x88, 0x86, 0x85, 0x86, 0x87, 0x87, 0x88,
-  0x8a, 0x8c, 0x8c, 0x8a, 0x88, 0x88, 0x89, 0x8b, 0x8d, 0x8e, 0x8e, 0x8c,
-  0x8a, 0x84, 0x81, 0x81, 0x83, 0x84, 0x85, 0x84, 0x82, 0x80, 0x7f, 0x7d,
-  0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7d, 0x7c, 0x7b, 0x7a,
-  0x7a, 0x7b, 0x7b, 0x7a, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7d,
-  0x80, 0x81, 0x80, 0x7f, 0x7c, 0x7b, 0x7c, 0x7f, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x82, 0x84, 0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x83, 0x86, 0x88,
-  0x89, 0x88, 0x87, 0x87, 0x88, 0x89, 0x89, 0x88, 0x88, 0x88, 0x87, 0x87,
-  0x88, 0x8a, 0x8a, 0x8b, 0x8a, 0x89, 0x88, 0x84, 0x82, 0x80, 0x80, 0x7f,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7c, 0x79, 0x77, 0x77, 0x76, 0x75,
-  0x76, 0x79, 0x7a, 0x7a, 0x79, 0x79, 0x78, 0x78, 0x78, 0x77, 0x76, 0x75,
-  0x76, 0x77, 0x77, 0x76, 0x75, 0x75, 0x76, 0x78, 0x7c, 0x7b, 0x78, 0x75,
-  0x75, 0x79, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7c, 0x7d, 0x80, 0x84, 0x86, 0x85, 0x83, 0x80, 0x81,
-  0x82, 0x84, 0x83, 0x82, 0x83, 0x86, 0x87, 0x88, 0x87, 0x85, 0x84, 0x84,
-  0x84, 0x83, 0x81, 0x7f, 0x7d, 0x7e, 0x81, 0x82, 0x80, 0x7d, 0x7b, 0x7a,
-  0x7a, 0x79, 0x78, 0x78, 0x78, 0x77, 0x75, 0x74, 0x75, 0x77, 0x78, 0x78,
-  0x76, 0x75, 0x76, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76, 0x74, 0x72, 0x72,
-  0x74, 0x76, 0x78, 0x7a, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x78, 0x7a, 0x7d,
-  0x80, 0x81, 0x80, 0x80, 0x81, 0x84, 0x87, 0x87, 0x84, 0x80, 0x7e, 0x80,
-  0x82, 0x84, 0x88, 0x8a, 0x8b, 0x8a, 0x89, 0x89, 0x88, 0x88, 0x88, 0x89,
-  0x89, 0x89, 0x89, 0x8a, 0x8c, 0x8e, 0x8e, 0x8b, 0x88, 0x85, 0x82, 0x81,
-  0x82, 0x83, 0x85, 0x87, 0x86, 0x83, 0x81, 0x7e, 0x7c, 0x7a, 0x7a, 0x79,
-  0x78, 0x77, 0x77, 0x78, 0x78, 0x78, 0x76, 0x75, 0x74, 0x75, 0x75, 0x74,
-  0x73, 0x74, 0x75, 0x75, 0x76, 0x75, 0x75, 0x75, 0x75, 0x78, 0x7a, 0x7a,
-  0x78, 0x77, 0x78, 0x7b, 0x7e, 0x80, 0x84, 0x84, 0x83, 0x82, 0x82, 0x83,
-  0x86, 0x87, 0x85, 0x82, 0x82, 0x84, 0x86, 0x87, 0x88, 0x88, 0x8a, 0x8a,
-  0x8a, 0x8a, 0x89, 0x89, 0x8b, 0x8d, 0x8e, 0x8d, 0x8a, 0x89, 0x89, 0x8d,
-  0x8e, 0x8e, 0x8c, 0x89, 0x87, 0x85, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x81, 0x80, 0x80, 0x7e, 0x7b, 0x79, 0x77, 0x76, 0x75, 0x75, 0x76, 0x76,
-  0x75, 0x76, 0x76, 0x77, 0x78, 0x77, 0x75, 0x76, 0x77, 0x77, 0x77, 0x78,
-  0x76, 0x76, 0x76, 0x78, 0x7d, 0x81, 0x80, 0x7c, 0x78, 0x78, 0x7a, 0x7d,
-  0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x85, 0x86, 0x86, 0x86, 0x87, 0x87,
-  0x86, 0x85, 0x86, 0x89, 0x8c, 0x8e, 0x8e, 0x8e, 0x8c, 0x8a, 0x8a, 0x8a,
-  0x8c, 0x8d, 0x8e, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8c, 0x8a, 0x87,
-  0x86, 0x87, 0x87, 0x86, 0x82, 0x80, 0x7e, 0x7c, 0x7c, 0x7a, 0x78, 0x77,
-  0x76, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7a, 0x77, 0x75, 0x73, 0x74, 0x74,
-  0x75, 0x74, 0x74, 0x74, 0x76, 0x79, 0x7a, 0x7a, 0x78, 0x77, 0x79, 0x7b,
-  0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82,
-  0x83, 0x83, 0x83, 0x84, 0x86, 0x89, 0x8c, 0x8d, 0x8b, 0x89, 0x89, 0x8b,
-  0x8d, 0x8e, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8e, 0x8d, 0x8c, 0x8b, 0x8b,
-  0x8c, 0x8e, 0x8f, 0x8d, 0x8c, 0x8a, 0x88, 0x85, 0x82, 0x80, 0x7e, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x7e, 0x7c, 0x78, 0x76, 0x75, 0x74, 0x72, 0x72, 0x74,
-  0x76, 0x77, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7c, 0x7b, 0x77, 0x75, 0x76,
-  0x7a, 0x7c, 0x7c, 0x79, 0x79, 0x7b, 0x7e, 0x7f, 0x7c, 0x77, 0x76, 0x78,
-  0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x83, 0x84,
-  0x85, 0x85, 0x85, 0x87, 0x8a, 0x8e, 0x90, 0x8e, 0x8c, 0x8b, 0x8a, 0x8a,
-  0x8c, 0x90, 0x90, 0x8f, 0x8c, 0x8a, 0x8a, 0x8c, 0x8d, 0x8d, 0x8a, 0x86,
-  0x83, 0x82, 0x82, 0x84, 0x84, 0x83, 0x80, 0x7c, 0x7a, 0x78, 0x78, 0x77,
-  0x75, 0x74, 0x72, 0x71, 0x71, 0x71, 0x72, 0x74, 0x75, 0x75, 0x73, 0x70,
-  0x70, 0x70, 0x72, 0x72, 0x73, 0x72, 0x72, 0x74, 0x75, 0x76, 0x73, 0x70,
-  0x70, 0x75, 0x77, 0x77, 0x76, 0x74, 0x74, 0x77, 0x7a, 0x7b, 0x7d, 0x7e,
-  0x7e, 0x7c, 0x7b, 0x7c, 0x7f, 0x82, 0x84, 0x84, 0x83, 0x82, 0x82, 0x84,
-  0x89, 0x8d, 0x8e, 0x8c, 0x8b, 0x8b, 0x8c, 0x8e, 0x8f, 0x8e, 0x8b, 0x87,
-  0x85, 0x85, 0x89, 0x8e, 0x8e, 0x8d, 0x89, 0x84, 0x82, 0x7f, 0x7e, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x79, 0x79, 0x78, 0x76, 0x71, 0x6e,
-  0x6d, 0x6e, 0x72, 0x76, 0x76, 0x76, 0x74, 0x73, 0x72, 0x71, 0x72, 0x73,
-  0x74, 0x73, 0x74, 0x75, 0x75, 0x74, 0x72, 0x72, 0x74, 0x78, 0x7a, 0x79,
-  0x76, 0x74, 0x76, 0x77, 0x7a, 0x7e, 0x82, 0x85, 0x84, 0x82, 0x80, 0x82,
-  0x84, 0x86, 0x89, 0x8a, 0x88, 0x87, 0x85, 0x87, 0x8c, 0x90, 0x90, 0x8d,
-  0x8a, 0x89, 0x8c, 0x8e, 0x8f, 0x90, 0x90, 0x8f, 0x8e, 0x8c, 0x8b, 0x8b,
-  0x8b, 0x8b, 0x88, 0x85, 0x82, 0x81, 0x82, 0x84, 0x83, 0x81, 0x7d, 0x79,
-  0x78, 0x7a, 0x79, 0x79, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75,
-  0x75, 0x74, 0x74, 0x73, 0x71, 0x71, 0x72, 0x75, 0x76, 0x78, 0x79, 0x79,
-  0x77, 0x74, 0x72, 0x73, 0x76, 0x79, 0x7d, 0x7e, 0x7d, 0x7b, 0x7a, 0x7a,
-  0x7c, 0x80, 0x84, 0x85, 0x84, 0x83, 0x83, 0x86, 0x8b, 0x90, 0x91, 0x8f,
-  0x8b, 0x88, 0x89, 0x8c, 0x8f, 0x92, 0x92, 0x90, 0x8f, 0x90, 0x90, 0x90,
-  0x91, 0x90, 0x8e, 0x8d, 0x8c, 0x8c, 0x8d, 0x8f, 0x90, 0x8f, 0x8b, 0x86,
-  0x81, 0x80, 0x82, 0x82, 0x80, 0x7e, 0x7c, 0x7c, 0x7d, 0x7c, 0x78, 0x75,
-  0x74, 0x75, 0x75, 0x74, 0x72, 0x73, 0x76, 0x78, 0x79, 0x79, 0x77, 0x74,
-  0x72, 0x72, 0x72, 0x74, 0x74, 0x76, 0x79, 0x7b, 0x7b, 0x79, 0x77, 0x76,
-  0x77, 0x7b, 0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x7e, 0x82, 0x85, 0x86, 0x86,
-  0x85, 0x84, 0x85, 0x88, 0x8b, 0x8c, 0x8c, 0x8c, 0x8a, 0x8a, 0x8a, 0x8a,
-  0x8c, 0x8e, 0x8f, 0x8d, 0x8c, 0x8d, 0x90, 0x93, 0x94, 0x92, 0x90, 0x8e,
-  0x8d, 0x8e, 0x8f, 0x8e, 0x8e, 0x8c, 0x8c, 0x8b, 0x88, 0x86, 0x84, 0x82,
-  0x80, 0x7e, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x76, 0x74, 0x73, 0x73, 0x71,
-  0x6e, 0x6e, 0x70, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x70, 0x70, 0x71,
-  0x73, 0x74, 0x75, 0x77, 0x77, 0x77, 0x75, 0x75, 0x76, 0x78, 0x7b, 0x7c,
-  0x7d, 0x7c, 0x7b, 0x7c, 0x7e, 0x81, 0x83, 0x84, 0x84, 0x84, 0x83, 0x84,
-  0x85, 0x88, 0x8b, 0x8a, 0x88, 0x87, 0x87, 0x8a, 0x8d, 0x8f, 0x8e, 0x8d,
-  0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x91, 0x92, 0x91, 0x8f, 0x8e, 0x8d, 0x8c,
-  0x8d, 0x8d, 0x8c, 0x89, 0x85, 0x83, 0x83, 0x83, 0x83, 0x81, 0x7e, 0x7c,
-  0x7a, 0x7a, 0x7b, 0x79, 0x76, 0x74, 0x73, 0x72, 0x72, 0x74, 0x74, 0x75,
-  0x75, 0x75, 0x75, 0x74, 0x73, 0x72, 0x73, 0x73, 0x73, 0x74, 0x76, 0x77,
-  0x78, 0x78, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7e, 0x81, 0x83, 0x83, 0x82, 0x81, 0x81, 0x82, 0x84, 0x87, 0x88, 0x88,
-  0x88, 0x88, 0x89, 0x8a, 0x8c, 0x8c, 0x8c, 0x8d, 0x8c, 0x8e, 0x8e, 0x8e,
-  0x8f, 0x90, 0x90, 0x8e, 0x8d, 0x8b, 0x8a, 0x8b, 0x8c, 0x8d, 0x8d, 0x8a,
-  0x86, 0x84, 0x82, 0x81, 0x80, 0x7f, 0x7c, 0x79, 0x78, 0x79, 0x7a, 0x79,
-  0x77, 0x74, 0x73, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72,
-  0x73, 0x73, 0x72, 0x71, 0x70, 0x72, 0x74, 0x77, 0x78, 0x77, 0x75, 0x74,
-  0x75, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x80,
-  0x82, 0x82, 0x83, 0x85, 0x86, 0x86, 0x87, 0x88, 0x88, 0x88, 0x89, 0x88,
-  0x87, 0x88, 0x8a, 0x8c, 0x8b, 0x8c, 0x8c, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e,
-  0x8e, 0x8d, 0x8c, 0x8c, 0x8c, 0x8b, 0x8b, 0x8a, 0x88, 0x87, 0x86, 0x85,
-  0x84, 0x84, 0x82, 0x80, 0x7d, 0x7a, 0x79, 0x79, 0x78, 0x77, 0x76, 0x73,
-  0x72, 0x72, 0x71, 0x70, 0x70, 0x70, 0x71, 0x70, 0x71, 0x71, 0x71, 0x70,
-  0x70, 0x70, 0x71, 0x74, 0x76, 0x76, 0x76, 0x77, 0x76, 0x76, 0x77, 0x77,
-  0x78, 0x7a, 0x7c, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x81, 0x82, 0x84,
-  0x85, 0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x86, 0x86, 0x88,
-  0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8b, 0x8c, 0x8d,
-  0x8d, 0x8d, 0x8b, 0x8a, 0x8a, 0x8a, 0x88, 0x86, 0x84, 0x84, 0x83, 0x82,
-  0x80, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x78, 0x76, 0x74, 0x73, 0x72,
-  0x73, 0x74, 0x74, 0x73, 0x72, 0x70, 0x6f, 0x6f, 0x70, 0x71, 0x72, 0x71,
-  0x71, 0x72, 0x72, 0x73, 0x74, 0x74, 0x74, 0x74, 0x76, 0x76, 0x76, 0x78,
-  0x7b, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x83, 0x85, 0x86, 0x86, 0x87,
-  0x88, 0x88, 0x89, 0x8a, 0x8b, 0x8b, 0x8a, 0x89, 0x87, 0x87, 0x88, 0x8a,
-  0x8b, 0x8c, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8c, 0x8c, 0x8b, 0x8b, 0x8b,
-  0x8b, 0x8a, 0x8a, 0x8b, 0x8b, 0x8a, 0x88, 0x87, 0x86, 0x84, 0x82, 0x80,
-  0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x78, 0x74, 0x73, 0x73, 0x74,
-  0x75, 0x75, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x74, 0x73, 0x70, 0x6f,
-  0x6f, 0x70, 0x71, 0x72, 0x74, 0x75, 0x76, 0x78, 0x78, 0x78, 0x79, 0x7b,
-  0x7d, 0x80, 0x82, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x87, 0x87, 0x86,
-  0x86, 0x87, 0x88, 0x8a, 0x8c, 0x8d, 0x8b, 0x89, 0x88, 0x88, 0x88, 0x87,
-  0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8c, 0x8b, 0x8b, 0x8b,
-  0x8b, 0x8c, 0x8c, 0x8d, 0x8d, 0x8b, 0x88, 0x86, 0x85, 0x84, 0x83, 0x82,
-  0x82, 0x82, 0x81, 0x7f, 0x7d, 0x7c, 0x7c, 0x7a, 0x78, 0x77, 0x75, 0x73,
-  0x73, 0x74, 0x75, 0x76, 0x76, 0x74, 0x73, 0x73, 0x71, 0x70, 0x70, 0x70,
-  0x70, 0x71, 0x73, 0x74, 0x75, 0x76, 0x78, 0x7b, 0x7c, 0x7d, 0x7e, 0x7d,
-  0x7e, 0x7e, 0x7f, 0x80, 0x83, 0x84, 0x85, 0x84, 0x84, 0x83, 0x83, 0x84,
-  0x86, 0x88, 0x88, 0x87, 0x87, 0x88, 0x89, 0x8b, 0x8a, 0x88, 0x88, 0x87,
-  0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x88, 0x87, 0x86, 0x86, 0x86,
-  0x87, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x87, 0x86, 0x87, 0x87, 0x85, 0x83,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7c, 0x7b,
-  0x7a, 0x7a, 0x79, 0x7a, 0x79, 0x79, 0x7a, 0x79, 0x79, 0x78, 0x76, 0x74,
-  0x74, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x77, 0x77, 0x77, 0x78, 0x79,
-  0x7a, 0x7c, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x82, 0x82, 0x82,
-  0x83, 0x83, 0x84, 0x85, 0x86, 0x87, 0x86, 0x85, 0x85, 0x85, 0x84, 0x85,
-  0x86, 0x88, 0x89, 0x89, 0x88, 0x87, 0x86, 0x85, 0x86, 0x86, 0x87, 0x88,
-  0x88, 0x88, 0x87, 0x87, 0x87, 0x86, 0x86, 0x85, 0x84, 0x83, 0x82, 0x83,
-  0x84, 0x84, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82,
-  0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x79,
-  0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x77, 0x77, 0x78, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x82, 0x83, 0x84, 0x85, 0x84, 0x83, 0x82, 0x83, 0x83, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82,
-  0x83, 0x84, 0x85, 0x85, 0x85, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82,
-  0x82, 0x83, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7b,
-  0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x79,
-  0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x77, 0x76, 0x76, 0x76, 0x76,
-  0x77, 0x77, 0x76, 0x77, 0x78, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7b, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x82, 0x83, 0x83, 0x84,
-  0x83, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84, 0x84, 0x83, 0x82, 0x82, 0x82,
-  0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x83,
-  0x82, 0x81, 0x80, 0x80, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x83, 0x81,
-  0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x79, 0x7a, 0x79,
-  0x79, 0x78, 0x77, 0x78, 0x78, 0x78, 0x78, 0x79, 0x78, 0x78, 0x78, 0x79,
-  0x7a, 0x7a, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x83, 0x84,
-  0x82, 0x81, 0x81, 0x81, 0x82, 0x84, 0x85, 0x84, 0x83, 0x83, 0x83, 0x83,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x84, 0x84, 0x83, 0x83, 0x82, 0x83, 0x83, 0x84, 0x84, 0x82, 0x81,
-  0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83,
-  0x85, 0x85, 0x84, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x83, 0x84, 0x84, 0x86, 0x86, 0x85, 0x84, 0x83, 0x83, 0x84,
-  0x85, 0x85, 0x84, 0x82, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x81, 0x82, 0x81, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x84, 0x83,
-  0x82, 0x83, 0x84, 0x84, 0x84, 0x85, 0x84, 0x83, 0x82, 0x83, 0x83, 0x83,
-  0x84, 0x85, 0x84, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7e, 0x7e, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x80, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x80,
-  0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x83,
-  0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x83, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e,
-  0x7f, 0x80, 0x81, 0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7e, 0x7f, 0x7f, 0x7e, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7e, 0x7e,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x82,
-  0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x83, 0x84, 0x84, 0x83, 0x82,
-  0x82, 0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80,
-  0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f,
-  0x7e, 0x7d, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80,
-  0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x81,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x83, 0x83, 0x83, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80,
-  0x7e, 0x7e, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x81, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7e, 0x7f, 0x7f, 0x7e, 0x7d,
-  0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x7e,
-  0x7e, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x7f,
-  0x80, 0x80, 0x81, 0x80, 0x81, 0x82, 0x82, 0x80, 0x80, 0x80, 0x7f, 0x7e,
-  0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x82,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80,
-  0x81, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7f, 0x7f, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7d,
-  0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82,
-  0x82, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x80, 0x83,
-  0x85, 0x83, 0x7e, 0x7d, 0x7e, 0x80, 0x83, 0x86, 0x85, 0x7e, 0x78, 0x79,
-  0x80, 0x85, 0x81, 0x7d, 0x7c, 0x7e, 0x80, 0x82, 0x80, 0x7e, 0x7f, 0x81,
-  0x81, 0x7e, 0x7d, 0x7f, 0x81, 0x81, 0x82, 0x81, 0x7f, 0x7d, 0x7c, 0x7e,
-  0x81, 0x84, 0x84, 0x81, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82,
-  0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x81, 0x7f, 0x7e, 0x7f, 0x80,
-  0x81, 0x80, 0x81, 0x84, 0x8a, 0x8a, 0x84, 0x7d, 0x7a, 0x79, 0x7a, 0x81,
-  0x8a, 0x90, 0x8e, 0x84, 0x76, 0x74, 0x82, 0x90, 0x8b, 0x7e, 0x7a, 0x7c,
-  0x80, 0x83, 0x84, 0x7d, 0x79, 0x7a, 0x7b, 0x78, 0x73, 0x74, 0x7f, 0x85,
-  0x7f, 0x7b, 0x86, 0x91, 0x91, 0x8c, 0x80, 0x6d, 0x62, 0x6d, 0x89, 0x9c,
-  0x98, 0x86, 0x75, 0x76, 0x7e, 0x7c, 0x77, 0x7b, 0x8b, 0x98, 0x8e, 0x76,
-  0x70, 0x80, 0x92, 0x92, 0x7c, 0x63, 0x60, 0x74, 0x8a, 0x89, 0x78, 0x71,
-  0x7c, 0x8b, 0x90, 0x8b, 0x85, 0x7d, 0x74, 0x72, 0x78, 0x7e, 0x81, 0x82,
-  0x85, 0x81, 0x74, 0x6e, 0x71, 0x77, 0x78, 0x76, 0x77, 0x79, 0x79, 0x78,
-  0x7e, 0x84, 0x86, 0x84, 0x82, 0x7b, 0x75, 0x7a, 0x80, 0x7f, 0x7e, 0x83,
-  0x86, 0x86, 0x84, 0x80, 0x7b, 0x7a, 0x7d, 0x82, 0x88, 0x85, 0x75, 0x74,
-  0x87, 0x8e, 0x84, 0x83, 0x8e, 0x8c, 0x7e, 0x77, 0x79, 0x7c, 0x83, 0x88,
-  0x7e, 0x75, 0x7c, 0x86, 0x7f, 0x76, 0x7c, 0x87, 0x85, 0x77, 0x6f, 0x75,
-  0x7f, 0x81, 0x7e, 0x7b, 0x77, 0x78, 0x7c, 0x7e, 0x7b, 0x78, 0x78, 0x7b,
-  0x84, 0x8d, 0x88, 0x74, 0x68, 0x74, 0x87, 0x8c, 0x83, 0x7a, 0x77, 0x7e,
-  0x87, 0x89, 0x82, 0x7a, 0x79, 0x7d, 0x84, 0x83, 0x7a, 0x77, 0x84, 0x8d,
-  0x82, 0x76, 0x7a, 0x82, 0x84, 0x7e, 0x7a, 0x7d, 0x84, 0x86, 0x86, 0x84,
-  0x80, 0x7c, 0x7b, 0x79, 0x79, 0x85, 0x94, 0x94, 0x86, 0x73, 0x72, 0x87,
-  0x97, 0x90, 0x83, 0x7e, 0x77, 0x6e, 0x70, 0x84, 0x95, 0x93, 0x83, 0x77,
-  0x79, 0x7d, 0x7a, 0x75, 0x77, 0x81, 0x88, 0x86, 0x7d, 0x75, 0x76, 0x7d,
-  0x86, 0x88, 0x83, 0x7e, 0x7d, 0x7a, 0x76, 0x77, 0x7f, 0x83, 0x82, 0x82,
-  0x87, 0x86, 0x80, 0x7c, 0x7c, 0x7e, 0x80, 0x82, 0x80, 0x79, 0x76, 0x81,
-  0x8e, 0x8c, 0x7c, 0x73, 0x78, 0x82, 0x86, 0x84, 0x7f, 0x7d, 0x7c, 0x80,
-  0x88, 0x89, 0x80, 0x76, 0x76, 0x80, 0x86, 0x86, 0x84, 0x82, 0x81, 0x7e,
-  0x7a, 0x7a, 0x7f, 0x86, 0x89, 0x84, 0x7a, 0x76, 0x78, 0x80, 0x81, 0x7e,
-  0x80, 0x85, 0x88, 0x87, 0x83, 0x80, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x86,
-  0x8e, 0x8e, 0x86, 0x7c, 0x7c, 0x80, 0x81, 0x7d, 0x7a, 0x7e, 0x87, 0x8c,
-  0x86, 0x7c, 0x79, 0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x7b, 0x7e, 0x81, 0x84,
-  0x85, 0x86, 0x87, 0x85, 0x80, 0x7a, 0x78, 0x7b, 0x7f, 0x84, 0x8a, 0x8c,
-  0x89, 0x84, 0x81, 0x80, 0x7e, 0x7e, 0x81, 0x83, 0x84, 0x85, 0x87, 0x89,
-  0x87, 0x85, 0x83, 0x82, 0x7f, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x84, 0x82,
-  0x7e, 0x7d, 0x7c, 0x7c, 0x7e, 0x7e, 0x80, 0x7e, 0x80, 0x81, 0x81, 0x82,
-  0x85, 0x86, 0x86, 0x84, 0x80, 0x7c, 0x7c, 0x7f, 0x83, 0x86, 0x86, 0x84,
-  0x80, 0x7c, 0x7c, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x7d, 0x7a, 0x78, 0x79,
-  0x7d, 0x80, 0x7f, 0x7d, 0x7e, 0x80, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81,
-  0x85, 0x89, 0x8c, 0x8a, 0x87, 0x85, 0x83, 0x83, 0x83, 0x82, 0x82, 0x84,
-  0x88, 0x8a, 0x89, 0x87, 0x86, 0x85, 0x84, 0x82, 0x7e, 0x7c, 0x7d, 0x81,
-  0x85, 0x86, 0x83, 0x80, 0x7f, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7d, 0x80,
-  0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7d, 0x7e, 0x80, 0x82, 0x82,
-  0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x7e, 0x7b, 0x7b, 0x7d, 0x80,
-  0x83, 0x84, 0x82, 0x80, 0x80, 0x83, 0x85, 0x85, 0x84, 0x82, 0x82, 0x81,
-  0x80, 0x7e, 0x7e, 0x7f, 0x81, 0x84, 0x88, 0x89, 0x88, 0x86, 0x82, 0x80,
-  0x80, 0x82, 0x85, 0x89, 0x8b, 0x8a, 0x86, 0x81, 0x7c, 0x79, 0x7a, 0x7c,
-  0x80, 0x85, 0x86, 0x84, 0x82, 0x81, 0x7e, 0x7c, 0x7d, 0x81, 0x85, 0x89,
-  0x8c, 0x88, 0x83, 0x7d, 0x79, 0x78, 0x79, 0x7c, 0x7f, 0x82, 0x82, 0x7e,
-  0x7c, 0x7c, 0x7e, 0x80, 0x7e, 0x7c, 0x7a, 0x7a, 0x7c, 0x82, 0x84, 0x83,
-  0x7f, 0x7c, 0x79, 0x76, 0x75, 0x76, 0x76, 0x78, 0x7d, 0x82, 0x82, 0x80,
-  0x7e, 0x7b, 0x7a, 0x79, 0x79, 0x79, 0x7a, 0x7d, 0x80, 0x80, 0x7e, 0x7e,
-  0x7d, 0x7c, 0x7c, 0x79, 0x77, 0x77, 0x79, 0x7e, 0x83, 0x87, 0x86, 0x80,
-  0x7a, 0x79, 0x78, 0x79, 0x7b, 0x7e, 0x81, 0x84, 0x85, 0x84, 0x82, 0x7c,
-  0x77, 0x74, 0x74, 0x78, 0x7f, 0x84, 0x87, 0x89, 0x88, 0x82, 0x7c, 0x77,
-  0x75, 0x76, 0x79, 0x7c, 0x7f, 0x82, 0x83, 0x84, 0x84, 0x83, 0x80, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7e, 0x81, 0x82, 0x7f, 0x7d, 0x7f, 0x81, 0x7f, 0x7c,
-  0x79, 0x77, 0x76, 0x76, 0x78, 0x7c, 0x80, 0x81, 0x81, 0x84, 0x87, 0x89,
-  0x87, 0x83, 0x7f, 0x7b, 0x79, 0x78, 0x7a, 0x80, 0x86, 0x87, 0x85, 0x82,
-  0x7f, 0x7b, 0x78, 0x76, 0x74, 0x77, 0x7a, 0x7e, 0x83, 0x89, 0x8e, 0x8d,
-  0x88, 0x80, 0x78, 0x73, 0x72, 0x74, 0x77, 0x7c, 0x81, 0x84, 0x87, 0x8b,
-  0x8e, 0x8c, 0x83, 0x7b, 0x77, 0x76, 0x79, 0x80, 0x88, 0x8c, 0x8d, 0x8a,
-  0x85, 0x82, 0x7f, 0x7e, 0x7c, 0x78, 0x75, 0x76, 0x7c, 0x82, 0x87, 0x8b,
-  0x8a, 0x86, 0x83, 0x84, 0x85, 0x85, 0x83, 0x7f, 0x7a, 0x79, 0x7d, 0x85,
-  0x8c, 0x8d, 0x88, 0x80, 0x79, 0x76, 0x78, 0x7b, 0x7e, 0x83, 0x87, 0x88,
-  0x89, 0x8c, 0x90, 0x90, 0x88, 0x7c, 0x74, 0x72, 0x76, 0x7e, 0x85, 0x89,
-  0x89, 0x86, 0x81, 0x7e, 0x7d, 0x7b, 0x77, 0x77, 0x7d, 0x86, 0x8d, 0x90,
-  0x8f, 0x8c, 0x87, 0x82, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7f, 0x84, 0x85,
-  0x83, 0x80, 0x81, 0x85, 0x86, 0x84, 0x80, 0x7c, 0x7c, 0x81, 0x88, 0x8f,
-  0x93, 0x91, 0x85, 0x79, 0x73, 0x72, 0x72, 0x74, 0x78, 0x7e, 0x86, 0x89,
-  0x88, 0x86, 0x84, 0x80, 0x79, 0x75, 0x79, 0x84, 0x8b, 0x8a, 0x85, 0x84,
-  0x86, 0x87, 0x84, 0x7e, 0x79, 0x75, 0x71, 0x70, 0x76, 0x81, 0x89, 0x8a,
-  0x88, 0x88, 0x87, 0x84, 0x80, 0x7c, 0x7c, 0x80, 0x82, 0x84, 0x87, 0x8a,
-  0x87, 0x7e, 0x76, 0x74, 0x74, 0x75, 0x78, 0x7c, 0x7e, 0x80, 0x7e, 0x7f,
-  0x82, 0x84, 0x82, 0x7e, 0x7e, 0x82, 0x86, 0x8b, 0x90, 0x92, 0x8c, 0x82,
-  0x75, 0x6d, 0x6e, 0x74, 0x80, 0x89, 0x8c, 0x89, 0x83, 0x7d, 0x78, 0x77,
-  0x77, 0x7a, 0x7d, 0x80, 0x84, 0x86, 0x8a, 0x8c, 0x8b, 0x86, 0x7d, 0x73,
-  0x6c, 0x6d, 0x70, 0x76, 0x7d, 0x82, 0x80, 0x7a, 0x79, 0x7f, 0x87, 0x8c,
-  0x8a, 0x82, 0x7c, 0x78, 0x77, 0x7b, 0x85, 0x8d, 0x8e, 0x86, 0x7a, 0x75,
-  0x76, 0x78, 0x78, 0x77, 0x7a, 0x7c, 0x7d, 0x80, 0x84, 0x88, 0x87, 0x80,
-  0x7c, 0x80, 0x85, 0x86, 0x84, 0x82, 0x80, 0x80, 0x7e, 0x7e, 0x83, 0x85,
-  0x83, 0x7d, 0x79, 0x7a, 0x80, 0x84, 0x87, 0x8a, 0x86, 0x80, 0x7d, 0x7d,
-  0x82, 0x85, 0x84, 0x82, 0x80, 0x80, 0x83, 0x84, 0x80, 0x77, 0x6e, 0x6c,
-  0x70, 0x78, 0x83, 0x8c, 0x8f, 0x8c, 0x84, 0x7c, 0x77, 0x74, 0x75, 0x78,
-  0x7a, 0x7a, 0x7e, 0x85, 0x8b, 0x8e, 0x8a, 0x81, 0x77, 0x70, 0x6e, 0x70,
-  0x78, 0x80, 0x86, 0x88, 0x88, 0x88, 0x88, 0x86, 0x7f, 0x78, 0x72, 0x6e,
-  0x6e, 0x73, 0x7b, 0x84, 0x8a, 0x8b, 0x89, 0x82, 0x7b, 0x75, 0x73, 0x76,
-  0x78, 0x7b, 0x80, 0x86, 0x89, 0x8a, 0x88, 0x84, 0x7f, 0x7a, 0x77, 0x79,
-  0x7d, 0x7e, 0x7e, 0x80, 0x82, 0x84, 0x88, 0x8a, 0x88, 0x82, 0x7b, 0x74,
-  0x73, 0x76, 0x7c, 0x84, 0x87, 0x87, 0x84, 0x80, 0x7d, 0x7e, 0x80, 0x80,
-  0x7e, 0x7e, 0x7e, 0x80, 0x84, 0x88, 0x88, 0x83, 0x7c, 0x76, 0x74, 0x77,
-  0x7b, 0x7e, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x7e, 0x7a,
-  0x77, 0x77, 0x7a, 0x7d, 0x7d, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7c,
-  0x7a, 0x79, 0x7a, 0x80, 0x85, 0x87, 0x87, 0x84, 0x81, 0x80, 0x81, 0x83,
-  0x84, 0x82, 0x80, 0x7f, 0x7e, 0x7f, 0x83, 0x86, 0x86, 0x82, 0x7e, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x84, 0x85, 0x83, 0x81,
-  0x7d, 0x7a, 0x79, 0x78, 0x7a, 0x7f, 0x82, 0x83, 0x84, 0x85, 0x84, 0x83,
-  0x82, 0x80, 0x80, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x83, 0x82, 0x81, 0x7e,
-  0x7b, 0x7a, 0x7a, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x82,
-  0x80, 0x7b, 0x76, 0x76, 0x7b, 0x80, 0x84, 0x86, 0x87, 0x85, 0x82, 0x80,
-  0x80, 0x7e, 0x7c, 0x7a, 0x7a, 0x7d, 0x83, 0x86, 0x88, 0x88, 0x87, 0x85,
-  0x81, 0x7d, 0x7a, 0x7a, 0x7a, 0x7b, 0x7c, 0x7e, 0x81, 0x85, 0x89, 0x8c,
-  0x8e, 0x8d, 0x88, 0x7d, 0x6d, 0x60, 0x5b, 0x62, 0x74, 0x86, 0x91, 0x96,
-  0x94, 0x92, 0x90, 0x8f, 0x90, 0x90, 0x8e, 0x8b, 0x88, 0x88, 0x89, 0x88,
-  0x85, 0x82, 0x83, 0x85, 0x83, 0x81, 0x7f, 0x7b, 0x75, 0x70, 0x6e, 0x72,
-  0x79, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x81, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7c, 0x78, 0x75, 0x74, 0x76, 0x7b, 0x83, 0x8a, 0x8d, 0x8c, 0x8a,
-  0x88, 0x86, 0x84, 0x83, 0x82, 0x82, 0x82, 0x81, 0x82, 0x84, 0x85, 0x86,
-  0x84, 0x83, 0x81, 0x7d, 0x7a, 0x7c, 0x7e, 0x82, 0x85, 0x85, 0x85, 0x84,
-  0x81, 0x7e, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x82, 0x87, 0x8b, 0x84,
-  0x6d, 0x52, 0x47, 0x55, 0x79, 0x94, 0x9c, 0x9e, 0x9c, 0x99, 0x97, 0x98,
-  0x9b, 0x9d, 0x99, 0x8f, 0x85, 0x81, 0x82, 0x82, 0x80, 0x7d, 0x7d, 0x7e,
-  0x81, 0x82, 0x7e, 0x78, 0x73, 0x71, 0x72, 0x77, 0x7c, 0x7e, 0x7b, 0x77,
-  0x75, 0x78, 0x7e, 0x86, 0x88, 0x84, 0x7c, 0x76, 0x72, 0x70, 0x6f, 0x6f,
-  0x71, 0x75, 0x7a, 0x82, 0x89, 0x8c, 0x8a, 0x87, 0x83, 0x7e, 0x7a, 0x76,
-  0x74, 0x75, 0x79, 0x7d, 0x82, 0x88, 0x8b, 0x89, 0x86, 0x85, 0x84, 0x86,
-  0x87, 0x86, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x82, 0x87, 0x8e, 0x8e, 0x7a, 0x54, 0x36, 0x38, 0x60, 0x81, 0x89, 0x9b,
-  0xb2, 0xa7, 0x92, 0x9a, 0xa4, 0xa5, 0xa5, 0x9b, 0x83, 0x6c, 0x65, 0x6c,
-  0x75, 0x7a, 0x7c, 0x84, 0x8e, 0x94, 0x8d, 0x7d, 0x6c, 0x64, 0x68, 0x75,
-  0x83, 0x8b, 0x89, 0x7e, 0x75, 0x74, 0x7d, 0x89, 0x92, 0x91, 0x83, 0x70,
-  0x62, 0x5d, 0x5c, 0x5e, 0x67, 0x77, 0x87, 0x91, 0x8e, 0x85, 0x7c, 0x78,
-  0x7b, 0x82, 0x84, 0x7e, 0x70, 0x64, 0x64, 0x72, 0x88, 0x9a, 0xa3, 0xa0,
-  0x94, 0x89, 0x84, 0x83, 0x85, 0x85, 0x7e, 0x76, 0x70, 0x71, 0x7a, 0x88,
-  0x92, 0x97, 0x99, 0x96, 0x81, 0x55, 0x27, 0x18, 0x3b, 0x6e, 0x7c, 0x8e,
-  0xb8, 0xc7, 0x9e, 0x8d, 0xa5, 0xb2, 0xb7, 0xb3, 0x92, 0x62, 0x42, 0x40,
-  0x52, 0x68, 0x79, 0x8b, 0x9c, 0xa8, 0xa5, 0x8f, 0x73, 0x63, 0x6a, 0x80,
-  0x99, 0xa5, 0x9c, 0x84, 0x70, 0x6e, 0x80, 0x9a, 0xad, 0xae, 0x98, 0x72,
-  0x54, 0x4b, 0x55, 0x66, 0x77, 0x82, 0x84, 0x80, 0x78, 0x75, 0x7e, 0x8d,
-  0x9a, 0x9d, 0x93, 0x7c, 0x62, 0x55, 0x5c, 0x73, 0x90, 0xa2, 0xa5, 0x9b,
-  0x8c, 0x82, 0x7d, 0x7f, 0x85, 0x87, 0x81, 0x78, 0x73, 0x79, 0x88, 0x97,
-  0x9d, 0x8d, 0x5c, 0x23, 0x01, 0x10, 0x4a, 0x70, 0x89, 0xb9, 0xc6, 0x94,
-  0x88, 0xa8, 0xb7, 0xbe, 0xc0, 0xaa, 0x82, 0x59, 0x3f, 0x41, 0x57, 0x6c,
-  0x7b, 0x8a, 0x98, 0xa1, 0x9a, 0x80, 0x67, 0x63, 0x79, 0x98, 0xac, 0xab,
-  0x95, 0x76, 0x67, 0x70, 0x86, 0x9e, 0xaa, 0xa3, 0x88, 0x67, 0x51, 0x50,
-  0x5d, 0x6c, 0x7d, 0x86, 0x83, 0x7a, 0x73, 0x76, 0x82, 0x92, 0xa0, 0xa6,
-  0x9c, 0x86, 0x70, 0x6c, 0x7a, 0x8c, 0x99, 0x98, 0x8c, 0x7b, 0x6f, 0x6b,
-  0x71, 0x7c, 0x88, 0x90, 0x8f, 0x86, 0x84, 0x8c, 0x90, 0x76, 0x3b, 0x04,
-  0x00, 0x1e, 0x5d, 0x87, 0xb7, 0xcc, 0x92, 0x66, 0x82, 0xae, 0xc7, 0xcb,
-  0xb0, 0x84, 0x5a, 0x43, 0x42, 0x56, 0x6f, 0x84, 0x90, 0x94, 0x90, 0x85,
-  0x7b, 0x74, 0x73, 0x7c, 0x8f, 0x9f, 0xa1, 0x90, 0x74, 0x63, 0x6c, 0x87,
-  0x9e, 0xa4, 0x96, 0x7a, 0x60, 0x54, 0x5b, 0x6a, 0x78, 0x7e, 0x79, 0x6f,
-  0x6d, 0x74, 0x80, 0x91, 0xa6, 0xb7, 0xb6, 0x9e, 0x78, 0x5a, 0x52, 0x62,
-  0x79, 0x8c, 0x93, 0x87, 0x74, 0x69, 0x71, 0x84, 0x99, 0xa2, 0x9a, 0x8a,
-  0x84, 0x90, 0xa5, 0xa1, 0x67, 0x1b, 0x00, 0x0a, 0x52, 0x91, 0xc7, 0xe4,
-  0x9c, 0x42, 0x4b, 0x97, 0xda, 0xee, 0xc7, 0x83, 0x4e, 0x35, 0x34, 0x4b,
-  0x67, 0x80, 0x97, 0xa6, 0xa1, 0x8a, 0x70, 0x62, 0x61, 0x71, 0x8d, 0xa7,
-  0xb5, 0xa9, 0x80, 0x58, 0x57, 0x7e, 0xa7, 0xb7, 0xa3, 0x78, 0x56, 0x4e,
-  0x5c, 0x6e, 0x7b, 0x83, 0x81, 0x73, 0x66, 0x65, 0x73, 0x8c, 0xa7, 0xba,
-  0xbc, 0xa9, 0x81, 0x5c, 0x54, 0x6d, 0x90, 0xa2, 0x99, 0x7b, 0x5a, 0x48,
-  0x4f, 0x6a, 0x86, 0x95, 0x9a, 0x9c, 0xa5, 0xb4, 0xaf, 0x7b, 0x2d, 0x00,
-  0x00, 0x44, 0x8c, 0xca, 0xf7, 0xc4, 0x56, 0x2b, 0x60, 0xbc, 0xf6, 0xe8,
-  0x97, 0x43, 0x1f, 0x2b, 0x50, 0x70, 0x83, 0x93, 0xa7, 0xb6, 0xad, 0x89,
-  0x65, 0x5c, 0x71, 0x96, 0xb4, 0xb6, 0x99, 0x6e, 0x4e, 0x4c, 0x6e, 0x9a,
-  0xb6, 0xb0, 0x89, 0x5b, 0x44, 0x4b, 0x64, 0x7f, 0x94, 0x9d, 0x95, 0x82,
-  0x77, 0x7c, 0x8d, 0x9d, 0xa1, 0x93, 0x77, 0x5e, 0x52, 0x5b, 0x78, 0x97,
-  0xa8, 0xa1, 0x8a, 0x74, 0x6f, 0x7a, 0x85, 0x8b, 0x8c, 0x90, 0xa0, 0xb8,
-  0xc8, 0xab, 0x5a, 0x09, 0x00, 0x0e, 0x5c, 0xa4, 0xe4, 0xee, 0x8d, 0x2a,
-  0x31, 0x90, 0xee, 0xff, 0xd2, 0x74, 0x31, 0x1e, 0x36, 0x5c, 0x72, 0x82,
-  0x9a, 0xb4, 0xb7, 0x98, 0x66, 0x4d, 0x62, 0x90, 0xb9, 0xcb, 0xbc, 0x94,
-  0x64, 0x48, 0x52, 0x7c, 0xa8, 0xba, 0xa5, 0x75, 0x4e, 0x46, 0x56, 0x6d,
-  0x88, 0xa0, 0xa8, 0x9c, 0x83, 0x74, 0x7a, 0x8b, 0x9c, 0xa7, 0xa4, 0x91,
-  0x6e, 0x4a, 0x3b, 0x4a, 0x63, 0x71, 0x74, 0x73, 0x75, 0x81, 0x90, 0x9d,
-  0xa7, 0xb2, 0xbe, 0xca, 0xc5, 0x9c, 0x55, 0x0b, 0x00, 0x00, 0x44, 0x8a,
-  0xcf, 0xfd, 0xcb, 0x5d, 0x1c, 0x37, 0x97, 0xef, 0xff, 0xbc, 0x5a, 0x14,
-  0x05, 0x2f, 0x6f, 0xa1, 0xb9, 0xbc, 0xb2, 0x9e, 0x82, 0x61, 0x4b, 0x54,
-  0x7c, 0xad, 0xca, 0xbc, 0x83, 0x49, 0x3b, 0x62, 0x9e, 0xcb, 0xd1, 0xa7,
-  0x65, 0x3c, 0x42, 0x66, 0x90, 0xa9, 0xae, 0x9e, 0x87, 0x75, 0x6c, 0x6d,
-  0x75, 0x7f, 0x8a, 0x90, 0x8d, 0x84, 0x77, 0x70, 0x74, 0x7f, 0x8c, 0x90,
-  0x89, 0x7b, 0x70, 0x72, 0x81, 0x9c, 0xc1, 0xd9, 0xc4, 0x7a, 0x24, 0x00,
-  0x00, 0x2b, 0x72, 0xb2, 0xf6, 0xf7, 0x92, 0x31, 0x26, 0x76, 0xdd, 0xff,
-  0xd3, 0x6d, 0x1e, 0x04, 0x21, 0x58, 0x88, 0xa5, 0xb2, 0xb5, 0xb3, 0xa0,
-  0x7a, 0x51, 0x48, 0x6e, 0xaa, 0xd3, 0xc8, 0x82, 0x31, 0x11, 0x33, 0x7e,
-  0xc6, 0xe3, 0xc2, 0x77, 0x3c, 0x38, 0x62, 0x97, 0xb7, 0xb7, 0x98, 0x6f,
-  0x52, 0x4b, 0x52, 0x62, 0x77, 0x8d, 0x97, 0x8c, 0x71, 0x5a, 0x59, 0x6a,
-  0x82, 0x98, 0xa2, 0x9c, 0x90, 0x87, 0x86, 0x8a, 0x91, 0x9d, 0xae, 0xb7,
-  0xa4, 0x6f, 0x2c, 0x00, 0x00, 0x15, 0x55, 0x90, 0xd2, 0xff, 0xe5, 0x99,
-  0x5b, 0x4a, 0x6d, 0xa4, 0xc0, 0xad, 0x75, 0x3a, 0x19, 0x1b, 0x3a, 0x66,
-  0x96, 0xbe, 0xd0, 0xc2, 0x97, 0x6a, 0x57, 0x69, 0x93, 0xb9, 0xc5, 0xad,
-  0x7e, 0x57, 0x55, 0x74, 0x99, 0xac, 0xa4, 0x83, 0x5d, 0x4c, 0x56, 0x6b,
-  0x7d, 0x8a, 0x90, 0x91, 0x8c, 0x86, 0x84, 0x86, 0x8c, 0x92, 0x95, 0x90,
-  0x82, 0x6f, 0x61, 0x5f, 0x66, 0x6b, 0x74, 0x85, 0xa1, 0xc3, 0xdc, 0xcd,
-  0x8a, 0x35, 0x00, 0x00, 0x2e, 0x77, 0xb7, 0xf5, 0xf9, 0xa7, 0x4b, 0x33,
-  0x6f, 0xca, 0xf4, 0xd1, 0x7b, 0x2f, 0x0d, 0x17, 0x3d, 0x66, 0x86, 0xa4,
-  0xbf, 0xcf, 0xc8, 0xa2, 0x6d, 0x4b, 0x58, 0x8c, 0xbd, 0xc8, 0x9f, 0x57,
-  0x27, 0x30, 0x66, 0xa4, 0xca, 0xc3, 0x91, 0x5d, 0x51, 0x70, 0x9c, 0xbb,
-  0xbd, 0xa4, 0x80, 0x66, 0x5f, 0x67, 0x73, 0x7c, 0x82, 0x8a, 0x8d, 0x82,
-  0x65, 0x43, 0x36, 0x4b, 0x74, 0x98, 0xb0, 0xbd, 0xc2, 0xca, 0xd3, 0xc4,
-  0x8e, 0x46, 0x0d, 0x00, 0x27, 0x69, 0xa7, 0xe3, 0xff, 0xd7, 0x94, 0x67,
-  0x63, 0x81, 0x9f, 0xa5, 0x90, 0x69, 0x46, 0x3a, 0x44, 0x58, 0x72, 0x92,
-  0xb1, 0xc8, 0xca, 0xb1, 0x85, 0x5c, 0x4a, 0x58, 0x7f, 0xa7, 0xb8, 0xa8,
-  0x7c, 0x50, 0x48, 0x69, 0x9b, 0xc2, 0xc7, 0xa6, 0x72, 0x55, 0x60, 0x85,
-  0xab, 0xc3, 0xc0, 0xa0, 0x73, 0x54, 0x52, 0x69, 0x87, 0x97, 0x92, 0x7d,
-  0x6a, 0x66, 0x73, 0x87, 0x98, 0xa0, 0xa0, 0x99, 0x8e, 0x84, 0x83, 0x8a,
-  0x97, 0xa9, 0xb8, 0xb7, 0x97, 0x5f, 0x29, 0x07, 0x0c, 0x36, 0x6d, 0xa0,
-  0xdd, 0xff, 0xf1, 0xbb, 0x86, 0x66, 0x68, 0x83, 0x9b, 0x9b, 0x7e, 0x56,
-  0x38, 0x33, 0x4a, 0x6e, 0x9a, 0xc3, 0xd9, 0xce, 0xa6, 0x75, 0x58, 0x5d,
-  0x7e, 0xa4, 0xbb, 0xb7, 0x98, 0x72, 0x5f, 0x65, 0x79, 0x8a, 0x90, 0x87,
-  0x74, 0x67, 0x68, 0x7a, 0x94, 0xaa, 0xb6, 0xb1, 0x96, 0x70, 0x51, 0x44,
-  0x4b, 0x5e, 0x75, 0x88, 0x8e, 0x83, 0x66, 0x4a, 0x4b, 0x66, 0x84, 0x9d,
-  0xaa, 0xa3, 0x92, 0x87, 0x90, 0xa8, 0xb5, 0x9e, 0x65, 0x27, 0x03, 0x08,
-  0x33, 0x6d, 0xa6, 0xd1, 0xde, 0xca, 0xa8, 0x8c, 0x78, 0x69, 0x5a, 0x4e,
-  0x4a, 0x51, 0x5f, 0x6c, 0x75, 0x78, 0x7a, 0x7e, 0x88, 0x96, 0x9f, 0x97,
-  0x80, 0x67, 0x56, 0x55, 0x66, 0x81, 0x99, 0xa8, 0xa4, 0x89, 0x65, 0x4e,
-  0x4d, 0x64, 0x85, 0x9d, 0xa2, 0x95, 0x82, 0x7a, 0x7f, 0x89, 0x8f, 0x8b,
-  0x7a, 0x63, 0x54, 0x55, 0x64, 0x78, 0x86, 0x8b, 0x8a, 0x81, 0x79, 0x73,
-  0x6e, 0x6a, 0x6a, 0x6d, 0x78, 0x8e, 0xa7, 0xba, 0xb5, 0x8e, 0x52, 0x1d,
-  0x06, 0x16, 0x46, 0x7a, 0xab, 0xde, 0xf1, 0xda, 0xb2, 0x8a, 0x6b, 0x59,
-  0x4f, 0x4b, 0x4f, 0x58, 0x63, 0x6d, 0x71, 0x70, 0x71, 0x79, 0x8d, 0xa7,
-  0xb8, 0xb4, 0x9a, 0x71, 0x4f, 0x42, 0x51, 0x70, 0x90, 0xa5, 0xa5, 0x8c,
-  0x6a, 0x4f, 0x47, 0x53, 0x64, 0x70, 0x77, 0x7f, 0x8b, 0x97, 0x9f, 0xa4,
-  0xa6, 0xa2, 0x92, 0x76, 0x5a, 0x47, 0x40, 0x45, 0x56, 0x6c, 0x81, 0x8e,
-  0x90, 0x8e, 0x8d, 0x8e, 0x89, 0x7e, 0x6f, 0x64, 0x68, 0x7e, 0xa2, 0xbe,
-  0xb6, 0x7f, 0x35, 0x02, 0x00, 0x22, 0x5b, 0x8a, 0xc3, 0xf9, 0xf2, 0xb9,
-  0x7f, 0x59, 0x50, 0x61, 0x76, 0x7e, 0x78, 0x6a, 0x5d, 0x56, 0x56, 0x60,
-  0x74, 0x93, 0xb6, 0xd0, 0xcf, 0xab, 0x73, 0x46, 0x3c, 0x5a, 0x8e, 0xbe,
-  0xd4, 0xc1, 0x8e, 0x5a, 0x41, 0x4b, 0x6a, 0x86, 0x8b, 0x74, 0x56, 0x53,
-  0x78, 0xab, 0xd2, 0xdf, 0xce, 0xa7, 0x7d, 0x5c, 0x4c, 0x4e, 0x57, 0x5e,
-  0x64, 0x70, 0x7d, 0x87, 0x8b, 0x86, 0x84, 0x89, 0x8d, 0x8f, 0x90, 0x8b,
-  0x83, 0x7c, 0x78, 0x7c, 0x8a, 0x9c, 0xab, 0xa9, 0x8e, 0x5f, 0x2f, 0x11,
-  0x14, 0x38, 0x6d, 0xa0, 0xc9, 0xdd, 0xd7, 0xc3, 0xb0, 0xa3, 0x95, 0x7f,
-  0x64, 0x4f, 0x46, 0x50, 0x65, 0x77, 0x81, 0x81, 0x80, 0x86, 0x95, 0xa6,
-  0xb2, 0xb0, 0x9f, 0x88, 0x76, 0x74, 0x82, 0x96, 0xa2, 0x9e, 0x86, 0x61,
-  0x45, 0x45, 0x62, 0x8c, 0xae, 0xbb, 0xae, 0x94, 0x84, 0x87, 0x95, 0xa0,
-  0x9e, 0x8d, 0x76, 0x68, 0x69, 0x74, 0x82, 0x89, 0x86, 0x84, 0x89, 0x93,
-  0x94, 0x82, 0x60, 0x44, 0x42, 0x57, 0x77, 0x97, 0xb2, 0xbd, 0xb9, 0xae,
-  0xa6, 0xa4, 0xa4, 0x9d, 0x8e, 0x77, 0x5d, 0x45, 0x38, 0x3d, 0x55, 0x77,
-  0x9a, 0xb3, 0xbe, 0xbc, 0xb4, 0xb1, 0xb0, 0xac, 0x9e, 0x84, 0x64, 0x50,
-  0x50, 0x5e, 0x72, 0x7f, 0x84, 0x84, 0x84, 0x86, 0x8d, 0x94, 0x94, 0x90,
-  0x8a, 0x86, 0x86, 0x88, 0x8a, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x84, 0x79,
-  0x68, 0x59, 0x59, 0x68, 0x84, 0xa6, 0xc0, 0xce, 0xc8, 0xb5, 0x9c, 0x89,
-  0x7c, 0x70, 0x69, 0x66, 0x66, 0x68, 0x6e, 0x7a, 0x8b, 0x9a, 0x9e, 0x95,
-  0x88, 0x82, 0x83, 0x85, 0x85, 0x84, 0x82, 0x82, 0x87, 0x90, 0x9f, 0xb3,
-  0xbb, 0xa8, 0x7a, 0x42, 0x1a, 0x15, 0x34, 0x67, 0x98, 0xcb, 0xf3, 0xf1,
-  0xcf, 0xa4, 0x7f, 0x6b, 0x66, 0x67, 0x69, 0x6b, 0x6d, 0x6d, 0x6a, 0x67,
-  0x68, 0x74, 0x8c, 0xaa, 0xc4, 0xca, 0xb6, 0x8c, 0x64, 0x50, 0x56, 0x72,
-  0x95, 0xac, 0xac, 0x95, 0x71, 0x51, 0x40, 0x4a, 0x68, 0x8a, 0xa1, 0xa6,
-  0x96, 0x83, 0x82, 0x90, 0xa2, 0xaa, 0xa1, 0x8a, 0x74, 0x66, 0x60, 0x61,
-  0x69, 0x73, 0x7d, 0x85, 0x86, 0x81, 0x76, 0x6a, 0x61, 0x62, 0x68, 0x6f,
-  0x7a, 0x85, 0x8f, 0x9a, 0xa0, 0xa0, 0x9d, 0x98, 0x92, 0x8c, 0x7c, 0x5f,
-  0x3e, 0x26, 0x28, 0x49, 0x79, 0xa4, 0xbc, 0xbb, 0xac, 0x9e, 0x9c, 0xa2,
-  0xa4, 0x98, 0x7b, 0x5a, 0x47, 0x49, 0x58, 0x67, 0x71, 0x75, 0x78, 0x7c,
-  0x83, 0x8d, 0x94, 0x96, 0x92, 0x8a, 0x80, 0x79, 0x74, 0x74, 0x74, 0x75,
-  0x75, 0x73, 0x70, 0x6c, 0x68, 0x64, 0x61, 0x62, 0x6c, 0x7f, 0x94, 0xa2,
-  0xa3, 0x97, 0x88, 0x80, 0x81, 0x86, 0x85, 0x79, 0x69, 0x5b, 0x5a, 0x64,
-  0x6f, 0x77, 0x78, 0x75, 0x73, 0x77, 0x7e, 0x83, 0x84, 0x82, 0x7b, 0x73,
-  0x6f, 0x6e, 0x6d, 0x6d, 0x70, 0x7a, 0x8e, 0xa7, 0xba, 0xb5, 0x8e, 0x51,
-  0x1c, 0x04, 0x11, 0x3b, 0x6e, 0x9e, 0xce, 0xe6, 0xd8, 0xb5, 0x8d, 0x6d,
-  0x5c, 0x58, 0x59, 0x5a, 0x5a, 0x59, 0x57, 0x56, 0x5a, 0x66, 0x7c, 0x9a,
-  0xb6, 0xc5, 0xbd, 0x9b, 0x70, 0x4d, 0x41, 0x51, 0x72, 0x94, 0xa8, 0xa6,
-  0x8d, 0x68, 0x49, 0x3f, 0x4e, 0x6f, 0x94, 0xa9, 0x9c, 0x6f, 0x45, 0x45,
-  0x74, 0xac, 0xce, 0xc9, 0x9e, 0x69, 0x4b, 0x4c, 0x62, 0x78, 0x7f, 0x73,
-  0x5c, 0x52, 0x60, 0x7f, 0x98, 0x9e, 0x91, 0x7c, 0x67, 0x5b, 0x5a, 0x62,
-  0x6c, 0x74, 0x7a, 0x82, 0x95, 0xaf, 0xc3, 0xba, 0x8a, 0x48, 0x14, 0x00,
-  0x14, 0x46, 0x7a, 0xaa, 0xdd, 0xeb, 0xcb, 0xa2, 0x84, 0x78, 0x75, 0x69,
-  0x52, 0x3c, 0x37, 0x48, 0x64, 0x7d, 0x88, 0x86, 0x82, 0x89, 0x9a, 0xaa,
-  0xb0, 0xa5, 0x8c, 0x72, 0x60, 0x61, 0x71, 0x87, 0x99, 0xa0, 0x94, 0x77,
-  0x5a, 0x4c, 0x55, 0x70, 0x8d, 0x9c, 0x97, 0x80, 0x6f, 0x77, 0x92, 0xad,
-  0xb8, 0xac, 0x8b, 0x6c, 0x61, 0x67, 0x72, 0x78, 0x78, 0x73, 0x6f, 0x6c,
-  0x6b, 0x6b, 0x6d, 0x72, 0x7e, 0x8b, 0x90, 0x8e, 0x88, 0x82, 0x80, 0x7f,
-  0x7d, 0x7c, 0x7e, 0x87, 0x9a, 0xad, 0xae, 0x8d, 0x52, 0x1f, 0x07, 0x0e,
-  0x34, 0x68, 0x95, 0xc3, 0xe4, 0xe2, 0xc9, 0xa7, 0x86, 0x6a, 0x57, 0x4f,
-  0x51, 0x59, 0x61, 0x66, 0x65, 0x63, 0x67, 0x74, 0x8a, 0xa6, 0xbe, 0xca,
-  0xc1, 0xa2, 0x7a, 0x5a, 0x4d, 0x59, 0x76, 0x96, 0xa9, 0xa6, 0x89, 0x61,
-  0x44, 0x3d, 0x52, 0x7a, 0xa3, 0xbd, 0xba, 0x9e, 0x7a, 0x6b, 0x77, 0x8d,
-  0x9b, 0x9a, 0x89, 0x74, 0x69, 0x6b, 0x75, 0x7b, 0x78, 0x6d, 0x64, 0x69,
-  0x7b, 0x91, 0x9e, 0x9e, 0x91, 0x82, 0x7a, 0x7a, 0x7a, 0x72, 0x6c, 0x6e,
-  0x7a, 0x8e, 0xa2, 0xb2, 0xbc, 0xbd, 0xa9, 0x7e, 0x4c, 0x26, 0x16, 0x24,
-  0x4e, 0x7e, 0xaa, 0xdc, 0xf5, 0xe4, 0xc2, 0x9e, 0x83, 0x70, 0x61, 0x52,
-  0x46, 0x45, 0x51, 0x65, 0x7a, 0x8a, 0x95, 0x98, 0x9b, 0xa2, 0xab, 0xb1,
-  0xae, 0x9f, 0x8c, 0x7b, 0x72, 0x73, 0x7a, 0x84, 0x8e, 0x92, 0x8f, 0x83,
-  0x71, 0x60, 0x59, 0x5f, 0x72, 0x8b, 0xa2, 0xaf, 0xb0, 0xa6, 0x9a, 0x90,
-  0x8c, 0x8a, 0x86, 0x7c, 0x73, 0x6e, 0x6f, 0x76, 0x7d, 0x84, 0x84, 0x7f,
-  0x79, 0x78, 0x7b, 0x7d, 0x83, 0x8c, 0x95, 0x9c, 0x9d, 0x97, 0x8a, 0x80,
-  0x7c, 0x7f, 0x86, 0x8c, 0x92, 0x9c, 0xab, 0xb6, 0xad, 0x86, 0x4e, 0x23,
-  0x16, 0x2c, 0x5a, 0x8a, 0xb8, 0xe7, 0xf6, 0xe5, 0xc4, 0xa0, 0x82, 0x6a,
-  0x5b, 0x54, 0x53, 0x5a, 0x63, 0x6d, 0x75, 0x7c, 0x87, 0x99, 0xaf, 0xc6,
-  0xd2, 0xcc, 0xb2, 0x8c, 0x6a, 0x58, 0x5b, 0x6f, 0x8a, 0xa1, 0xa8, 0x9b,
-  0x80, 0x62, 0x4e, 0x4c, 0x62, 0x86, 0xae, 0xcc, 0xcf, 0xb0, 0x7e, 0x5c,
-  0x5f, 0x80, 0xa2, 0xac, 0x98, 0x78, 0x61, 0x62, 0x75, 0x87, 0x91, 0x8f,
-  0x84, 0x79, 0x77, 0x80, 0x89, 0x8b, 0x88, 0x84, 0x81, 0x81, 0x80, 0x7a,
-  0x75, 0x74, 0x7c, 0x8a, 0x9a, 0xa8, 0xb7, 0xbd, 0xab, 0x79, 0x3a, 0x0d,
-  0x07, 0x2a, 0x5c, 0x88, 0xbb, 0xf0, 0xf6, 0xca, 0x96, 0x6f, 0x64, 0x72,
-  0x7a, 0x6e, 0x54, 0x3f, 0x3c, 0x49, 0x5d, 0x71, 0x88, 0xa4, 0xc3, 0xdc,
-  0xdf, 0xc5, 0x94, 0x62, 0x46, 0x4b, 0x6d, 0x96, 0xb5, 0xb8, 0x9d, 0x70,
-  0x4b, 0x3d, 0x49, 0x68, 0x8c, 0xa7, 0xab, 0x94, 0x74, 0x68, 0x7d, 0xa3,
-  0xbd, 0xba, 0x98, 0x6b, 0x4e, 0x4a, 0x5c, 0x74, 0x87, 0x8c, 0x84, 0x74,
-  0x6b, 0x70, 0x7c, 0x85, 0x8b, 0x8e, 0x8c, 0x86, 0x79, 0x69, 0x61, 0x63,
-  0x69, 0x71, 0x7b, 0x81, 0x83, 0x83, 0x83, 0x87, 0x92, 0x9f, 0xa8, 0xa6,
-  0x8f, 0x65, 0x3b, 0x22, 0x21, 0x3d, 0x6b, 0x9c, 0xc2, 0xdb, 0xdc, 0xc8,
-  0xa9, 0x8c, 0x77, 0x69, 0x5f, 0x58, 0x56, 0x59, 0x60, 0x69, 0x73, 0x7e,
-  0x8c, 0x9a, 0xa6, 0xae, 0xac, 0xa1, 0x8d, 0x75, 0x61, 0x59, 0x5e, 0x6d,
-  0x81, 0x92, 0x99, 0x91, 0x7c, 0x62, 0x51, 0x56, 0x6e, 0x8e, 0xaa, 0xb3,
-  0xa7, 0x8d, 0x78, 0x74, 0x7b, 0x82, 0x83, 0x7d, 0x73, 0x6e, 0x71, 0x79,
-  0x81, 0x85, 0x85, 0x80, 0x7a, 0x79, 0x7c, 0x80, 0x82, 0x83, 0x82, 0x80,
-  0x7c, 0x78, 0x73, 0x6e, 0x6d, 0x6e, 0x6f, 0x70, 0x7a, 0x90, 0xae, 0xc4,
-  0xc4, 0xa0, 0x5e, 0x23, 0x09, 0x14, 0x40, 0x72, 0x9e, 0xd0, 0xea, 0xd9,
-  0xb5, 0x8f, 0x74, 0x65, 0x5c, 0x52, 0x48, 0x44, 0x48, 0x52, 0x5e, 0x6c,
-  0x76, 0x82, 0x94, 0xa7, 0xb8, 0xbf, 0xb4, 0x97, 0x74, 0x58, 0x4a, 0x4e,
-  0x62, 0x7a, 0x8c, 0x93, 0x89, 0x74, 0x62, 0x5b, 0x5f, 0x6b, 0x79, 0x82,
-  0x83, 0x81, 0x80, 0x82, 0x8a, 0x98, 0xa1, 0x9c, 0x88, 0x70, 0x5e, 0x57,
-  0x5a, 0x63, 0x6e, 0x79, 0x7e, 0x7d, 0x7b, 0x7b, 0x7e, 0x82, 0x7d, 0x74,
-  0x6a, 0x62, 0x5f, 0x62, 0x6b, 0x73, 0x7c, 0x81, 0x82, 0x82, 0x7f, 0x7a,
-  0x77, 0x7a, 0x82, 0x8e, 0x9a, 0xa0, 0x94, 0x71, 0x45, 0x24, 0x1d, 0x31,
-  0x58, 0x87, 0xb1, 0xce, 0xda, 0xd0, 0xb6, 0x97, 0x7a, 0x61, 0x50, 0x48,
-  0x4c, 0x56, 0x61, 0x6a, 0x71, 0x76, 0x7c, 0x86, 0x95, 0xa5, 0xaf, 0xaf,
-  0xa2, 0x88, 0x6c, 0x59, 0x52, 0x5b, 0x6e, 0x80, 0x8c, 0x8b, 0x7f, 0x70,
-  0x62, 0x5a, 0x5c, 0x67, 0x7b, 0x92, 0xa1, 0xa1, 0x92, 0x79, 0x68, 0x6a,
-  0x7b, 0x90, 0x9a, 0x90, 0x79, 0x63, 0x5b, 0x65, 0x77, 0x86, 0x8d, 0x8b,
-  0x84, 0x7c, 0x7a, 0x7c, 0x80, 0x81, 0x7e, 0x7a, 0x78, 0x79, 0x7b, 0x7c,
-  0x7e, 0x7d, 0x7b, 0x78, 0x79, 0x81, 0x8e, 0x9e, 0xb1, 0xba, 0x9f, 0x62,
-  0x25, 0x0b, 0x1d, 0x4c, 0x7c, 0xa9, 0xdf, 0xf6, 0xdb, 0xaf, 0x88, 0x72,
-  0x70, 0x70, 0x66, 0x56, 0x47, 0x45, 0x4f, 0x5e, 0x6e, 0x81, 0x99, 0xb6,
-  0xd1, 0xdb, 0xcc, 0xa7, 0x77, 0x53, 0x48, 0x5d, 0x84, 0xa6, 0xb5, 0xa9,
-  0x86, 0x62, 0x4e, 0x52, 0x67, 0x82, 0x96, 0x9d, 0x91, 0x79, 0x68, 0x6d,
-  0x87, 0xa9, 0xbe, 0xbb, 0x9e, 0x7a, 0x63, 0x60, 0x6c, 0x76, 0x7c, 0x7c,
-  0x78, 0x76, 0x7b, 0x86, 0x90, 0x94, 0x90, 0x84, 0x7a, 0x74, 0x70, 0x72,
-  0x78, 0x7b, 0x7c, 0x7e, 0x80, 0x83, 0x84, 0x7e, 0x75, 0x6e, 0x70, 0x7c,
-  0x8b, 0x9b, 0xaa, 0xb1, 0xa6, 0x86, 0x5c, 0x3f, 0x38, 0x49, 0x6c, 0x96,
-  0xbe, 0xd6, 0xda, 0xcc, 0xb1, 0x93, 0x79, 0x67, 0x5e, 0x61, 0x6c, 0x78,
-  0x80, 0x83, 0x81, 0x7c, 0x7d, 0x86, 0x94, 0xa4, 0xad, 0xa8, 0x95, 0x7d,
-  0x6a, 0x62, 0x68, 0x78, 0x8a, 0x96, 0x98, 0x8f, 0x81, 0x74, 0x70, 0x72,
-  0x76, 0x78, 0x7c, 0x83, 0x8b, 0x92, 0x94, 0x8e, 0x87, 0x82, 0x86, 0x8e,
-  0x94, 0x94, 0x8c, 0x7e, 0x74, 0x74, 0x7b, 0x84, 0x8a, 0x8d, 0x89, 0x81,
-  0x78, 0x76, 0x78, 0x7e, 0x81, 0x81, 0x7f, 0x7e, 0x80, 0x80, 0x7d, 0x7c,
-  0x79, 0x73, 0x6d, 0x68, 0x6a, 0x77, 0x8d, 0xa2, 0xb2, 0xbc, 0xba, 0xa4,
-  0x79, 0x47, 0x23, 0x1c, 0x36, 0x64, 0x93, 0xbe, 0xe1, 0xe6, 0xcf, 0xac,
-  0x8d, 0x7a, 0x6f, 0x64, 0x58, 0x52, 0x55, 0x60, 0x6f, 0x7c, 0x83, 0x86,
-  0x88, 0x91, 0xa0, 0xac, 0xaf, 0xa4, 0x8a, 0x6d, 0x59, 0x54, 0x61, 0x79,
-  0x90, 0x9e, 0x9f, 0x91, 0x7a, 0x69, 0x64, 0x67, 0x6c, 0x72, 0x77, 0x80,
-  0x8a, 0x95, 0x9d, 0x9e, 0x96, 0x88, 0x7e, 0x79, 0x7a, 0x7b, 0x7a, 0x79,
-  0x7a, 0x7e, 0x82, 0x88, 0x8c, 0x8b, 0x86, 0x80, 0x7c, 0x7b, 0x7d, 0x80,
-  0x80, 0x7c, 0x74, 0x70, 0x74, 0x7a, 0x81, 0x85, 0x84, 0x7e, 0x7b, 0x7b,
-  0x7f, 0x85, 0x8a, 0x8b, 0x88, 0x86, 0x8d, 0x9d, 0xab, 0xa9, 0x89, 0x58,
-  0x2f, 0x22, 0x36, 0x61, 0x94, 0xbe, 0xd6, 0xd8, 0xc6, 0xab, 0x92, 0x81,
-  0x74, 0x6b, 0x65, 0x64, 0x67, 0x6d, 0x72, 0x74, 0x72, 0x73, 0x7b, 0x8a,
-  0x9b, 0xab, 0xb1, 0xa9, 0x92, 0x76, 0x62, 0x5d, 0x68, 0x7c, 0x8f, 0x9a,
-  0x96, 0x89, 0x79, 0x6c, 0x66, 0x66, 0x68, 0x6d, 0x78, 0x89, 0x9c, 0xa8,
-  0xa7, 0x99, 0x84, 0x75, 0x73, 0x78, 0x80, 0x84, 0x81, 0x7b, 0x76, 0x76,
-  0x7d, 0x84, 0x88, 0x87, 0x83, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x80,
-  0x7c, 0x76, 0x72, 0x70, 0x74, 0x7d, 0x86, 0x8b, 0x8d, 0x89, 0x85, 0x82,
-  0x84, 0x8e, 0xa1, 0xb0, 0xaa, 0x7e, 0x3c, 0x0e, 0x0c, 0x32, 0x65, 0x90,
-  0xc2, 0xf1, 0xee, 0xbd, 0x86, 0x64, 0x64, 0x72, 0x76, 0x68, 0x53, 0x49,
-  0x54, 0x62, 0x6a, 0x6d, 0x77, 0x90, 0xb4, 0xd5, 0xdc, 0xb9, 0x7a, 0x41,
-  0x2d, 0x46, 0x7a, 0xaf, 0xd2, 0xd3, 0xac, 0x76, 0x51, 0x49, 0x56, 0x69,
-  0x73, 0x71, 0x67, 0x61, 0x6b, 0x82, 0x9b, 0xab, 0xab, 0x9d, 0x88, 0x75,
-  0x6c, 0x6d, 0x73, 0x7a, 0x7c, 0x7a, 0x75, 0x72, 0x72, 0x73, 0x74, 0x74,
-  0x75, 0x76, 0x74, 0x74, 0x7a, 0x81, 0x86, 0x84, 0x78, 0x6c, 0x69, 0x6d,
-  0x74, 0x76, 0x70, 0x62, 0x54, 0x52, 0x62, 0x79, 0x8b, 0x92, 0x8f, 0x8c,
-  0x8f, 0x99, 0xa8, 0xaf, 0x9c, 0x71, 0x42, 0x27, 0x2e, 0x51, 0x80, 0xad,
-  0xc9, 0xc9, 0xb4, 0x9a, 0x8b, 0x88, 0x8b, 0x8a, 0x80, 0x72, 0x68, 0x66,
-  0x6a, 0x6d, 0x6f, 0x70, 0x72, 0x7a, 0x83, 0x8d, 0x94, 0x94, 0x8b, 0x7b,
-  0x6e, 0x69, 0x6f, 0x7c, 0x8a, 0x93, 0x94, 0x8c, 0x7e, 0x71, 0x68, 0x66,
-  0x67, 0x6a, 0x70, 0x76, 0x81, 0x8b, 0x91, 0x91, 0x8e, 0x89, 0x83, 0x7e,
-  0x79, 0x76, 0x76, 0x7c, 0x84, 0x8c, 0x90, 0x8d, 0x86, 0x7e, 0x7b, 0x7c,
-  0x7d, 0x7d, 0x7c, 0x79, 0x77, 0x78, 0x7a, 0x79, 0x78, 0x7c, 0x82, 0x87,
-  0x88, 0x85, 0x7e, 0x77, 0x72, 0x6f, 0x6e, 0x71, 0x74, 0x75, 0x75, 0x77,
-  0x7e, 0x88, 0x97, 0xa6, 0xb1, 0xb1, 0x9e, 0x7a, 0x54, 0x3a, 0x35, 0x47,
-  0x65, 0x84, 0xa0, 0xb5, 0xbe, 0xb9, 0xab, 0x98, 0x84, 0x70, 0x61, 0x5a,
-  0x5d, 0x67, 0x70, 0x74, 0x74, 0x74, 0x76, 0x7b, 0x86, 0x92, 0x99, 0x96,
-  0x88, 0x74, 0x63, 0x5c, 0x60, 0x6d, 0x7b, 0x8a, 0x92, 0x92, 0x8b, 0x80,
-  0x73, 0x6b, 0x68, 0x69, 0x70, 0x78, 0x7e, 0x81, 0x84, 0x86, 0x87, 0x89,
-  0x8a, 0x8b, 0x89, 0x80, 0x71, 0x66, 0x64, 0x6e, 0x7e, 0x8b, 0x8f, 0x8d,
-  0x88, 0x83, 0x80, 0x7e, 0x7e, 0x7c, 0x78, 0x75, 0x76, 0x7a, 0x81, 0x84,
-  0x83, 0x7f, 0x7b, 0x7a, 0x7c, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x80,
-  0x7f, 0x7e, 0x84, 0x91, 0xa1, 0xb2, 0xaa, 0x76, 0x34, 0x0e, 0x14, 0x3f,
-  0x73, 0xa0, 0xd6, 0xf7, 0xdd, 0xa8, 0x7d, 0x6b, 0x72, 0x7a, 0x73, 0x61,
-  0x53, 0x53, 0x5e, 0x68, 0x6b, 0x70, 0x7e, 0x9a, 0xba, 0xce, 0xc5, 0x9d,
-  0x67, 0x41, 0x41, 0x66, 0x9a, 0xc6, 0xd8, 0xc3, 0x90, 0x5e, 0x45, 0x49,
-  0x60, 0x75, 0x7a, 0x70, 0x62, 0x67, 0x81, 0xa1, 0xb8, 0xbd, 0xae, 0x96,
-  0x82, 0x75, 0x73, 0x77, 0x7c, 0x80, 0x81, 0x80, 0x7e, 0x7a, 0x77, 0x77,
-  0x7b, 0x80, 0x84, 0x85, 0x83, 0x81, 0x80, 0x80, 0x81, 0x83, 0x84, 0x87,
-  0x86, 0x82, 0x79, 0x6f, 0x69, 0x6a, 0x6e, 0x74, 0x78, 0x7a, 0x79, 0x79,
-  0x77, 0x77, 0x85, 0x9c, 0xac, 0xb7, 0xc0, 0xb6, 0x8c, 0x5c, 0x3d, 0x36,
-  0x4a, 0x6f, 0x92, 0xad, 0xc0, 0xc2, 0xb8, 0xb0, 0xab, 0xa0, 0x8d, 0x79,
-  0x67, 0x5d, 0x5f, 0x6a, 0x75, 0x7c, 0x80, 0x80, 0x7f, 0x84, 0x8d, 0x94,
-  0x97, 0x92, 0x83, 0x70, 0x63, 0x61, 0x6d, 0x81, 0x94, 0xa0, 0xa1, 0x96,
-  0x84, 0x75, 0x6c, 0x69, 0x6a, 0x6e, 0x75, 0x7c, 0x81, 0x80, 0x81, 0x8a,
-  0x9a, 0xa7, 0xa9, 0x9f, 0x8f, 0x7e, 0x75, 0x76, 0x7b, 0x81, 0x82, 0x80,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x80,
-  0x86, 0x8b, 0x8b, 0x86, 0x7f, 0x77, 0x73, 0x76, 0x7b, 0x81, 0x84, 0x82,
-  0x80, 0x7d, 0x77, 0x77, 0x84, 0x9c, 0xb9, 0xca, 0xb7, 0x7c, 0x3a, 0x12,
-  0x14, 0x3d, 0x74, 0xa4, 0xd5, 0xee, 0xda, 0xb1, 0x8e, 0x7b, 0x76, 0x74,
-  0x6e, 0x68, 0x65, 0x66, 0x68, 0x65, 0x60, 0x5d, 0x65, 0x7d, 0x9e, 0xb9,
-  0xc1, 0xab, 0x7d, 0x4f, 0x3a, 0x46, 0x6c, 0x99, 0xbc, 0xc6, 0xaf, 0x86,
-  0x62, 0x52, 0x59, 0x6a, 0x76, 0x76, 0x6e, 0x66, 0x66, 0x6e, 0x7d, 0x8f,
-  0x9f, 0xa7, 0xa3, 0x93, 0x7c, 0x69, 0x63, 0x6b, 0x7a, 0x87, 0x8a, 0x83,
-  0x7a, 0x76, 0x78, 0x7d, 0x82, 0x82, 0x7d, 0x74, 0x6e, 0x6e, 0x73, 0x7a,
-  0x83, 0x8a, 0x8b, 0x86, 0x7c, 0x73, 0x6e, 0x70, 0x77, 0x7f, 0x86, 0x87,
-  0x85, 0x82, 0x83, 0x8d, 0x9a, 0xa6, 0x9e, 0x70, 0x30, 0x0a, 0x16, 0x48,
-  0x7d, 0xad, 0xe5, 0xf5, 0xc3, 0x85, 0x6b, 0x7f, 0xa2, 0xa8, 0x8e, 0x66,
-  0x4b, 0x4b, 0x59, 0x63, 0x68, 0x72, 0x88, 0xa9, 0xc6, 0xc9, 0xa6, 0x6d,
-  0x43, 0x3d, 0x5e, 0x93, 0xc2, 0xd7, 0xc6, 0x97, 0x66, 0x54, 0x62, 0x80,
-  0x96, 0x95, 0x78, 0x4f, 0x36, 0x3c, 0x5a, 0x81, 0xa4, 0xbc, 0xc4, 0xba,
-  0xa0, 0x7d, 0x60, 0x58, 0x68, 0x84, 0x96, 0x93, 0x81, 0x6f, 0x6c, 0x79,
-  0x8b, 0x96, 0x94, 0x83, 0x6c, 0x5e, 0x60, 0x6b, 0x79, 0x88, 0x92, 0x94,
-  0x8c, 0x7c, 0x6d, 0x64, 0x66, 0x72, 0x7d, 0x81, 0x7c, 0x6e, 0x61, 0x5e,
-  0x68, 0x7a, 0x8e, 0x99, 0x98, 0x92, 0x90, 0x93, 0x9e, 0xac, 0xa8, 0x88,
-  0x59, 0x32, 0x28, 0x3b, 0x60, 0x89, 0xaf, 0xc3, 0xc2, 0xb7, 0xac, 0xa3,
-  0x9a, 0x8d, 0x7b, 0x69, 0x5b, 0x58, 0x61, 0x6c, 0x73, 0x76, 0x75, 0x76,
-  0x7c, 0x86, 0x90, 0x96, 0x91, 0x81, 0x6c, 0x5e, 0x5f, 0x6c, 0x80, 0x93,
-  0x9d, 0x9a, 0x8e, 0x80, 0x77, 0x74, 0x76, 0x77, 0x76, 0x72, 0x6c, 0x6a,
-  0x69, 0x6b, 0x73, 0x81, 0x94, 0xa4, 0xa9, 0xa2, 0x90, 0x7e, 0x76, 0x77,
-  0x7d, 0x80, 0x7e, 0x78, 0x74, 0x75, 0x78, 0x7c, 0x7f, 0x7e, 0x7a, 0x77,
-  0x75, 0x74, 0x76, 0x7d, 0x86, 0x8e, 0x8e, 0x86, 0x7a, 0x73, 0x73, 0x79,
-  0x81, 0x84, 0x81, 0x79, 0x72, 0x71, 0x76, 0x7e, 0x85, 0x89, 0x88, 0x84,
-  0x82, 0x86, 0x94, 0xa5, 0xaf, 0xa4, 0x7c, 0x4c, 0x2f, 0x32, 0x50, 0x7b,
-  0xa5, 0xc0, 0xc6, 0xb6, 0x9e, 0x8e, 0x88, 0x85, 0x83, 0x7f, 0x7a, 0x73,
-  0x6e, 0x6a, 0x66, 0x65, 0x68, 0x71, 0x81, 0x93, 0xa1, 0xa5, 0x99, 0x80,
-  0x66, 0x57, 0x5d, 0x71, 0x89, 0x97, 0x96, 0x86, 0x73, 0x6b, 0x74, 0x85,
-  0x92, 0x95, 0x8e, 0x7f, 0x71, 0x6b, 0x6c, 0x70, 0x77, 0x80, 0x8a, 0x94,
-  0x99, 0x95, 0x89, 0x79, 0x70, 0x74, 0x81, 0x8b, 0x8d, 0x87, 0x81, 0x80,
-  0x86, 0x8d, 0x92, 0x92, 0x8a, 0x7c, 0x72, 0x72, 0x76, 0x7c, 0x83, 0x89,
-  0x8c, 0x8b, 0x85, 0x7e, 0x7b, 0x7d, 0x83, 0x87, 0x86, 0x80, 0x7a, 0x77,
-  0x7b, 0x81, 0x88, 0x8f, 0x97, 0x9f, 0xa7, 0xa6, 0x8c, 0x5a, 0x29, 0x12,
-  0x23, 0x54, 0x8b, 0xb9, 0xd5, 0xc3, 0x98, 0x87, 0x9f, 0xc7, 0xdb, 0xcd,
-  0xa5, 0x76, 0x57, 0x4d, 0x50, 0x54, 0x54, 0x59, 0x6e, 0x90, 0xaf, 0xba,
-  0xaa, 0x84, 0x61, 0x58, 0x6d, 0x90, 0xaa, 0xab, 0x8f, 0x66, 0x50, 0x5c,
-  0x7e, 0xa4, 0xb9, 0xb0, 0x89, 0x5e, 0x48, 0x4b, 0x5e, 0x6f, 0x7a, 0x80,
-  0x83, 0x87, 0x8c, 0x8e, 0x91, 0x96, 0x9d, 0xa3, 0xa0, 0x8f, 0x77, 0x65,
-  0x61, 0x6b, 0x7b, 0x87, 0x8a, 0x82, 0x76, 0x6f, 0x70, 0x75, 0x78, 0x7b,
-  0x7e, 0x81, 0x85, 0x87, 0x86, 0x85, 0x84, 0x81, 0x7d, 0x7b, 0x78, 0x71,
-  0x6b, 0x69, 0x68, 0x6b, 0x72, 0x78, 0x7e, 0x85, 0x89, 0x89, 0x88, 0x8c,
-  0x96, 0xa0, 0xa2, 0x96, 0x78, 0x54, 0x3f, 0x42, 0x56, 0x70, 0x8a, 0x9c,
-  0xa6, 0xa8, 0xa8, 0xa5, 0xa1, 0x9a, 0x8f, 0x86, 0x7e, 0x77, 0x6e, 0x67,
-  0x62, 0x60, 0x62, 0x66, 0x6d, 0x77, 0x82, 0x8c, 0x92, 0x92, 0x88, 0x78,
-  0x6a, 0x66, 0x6a, 0x74, 0x7d, 0x80, 0x7e, 0x79, 0x76, 0x79, 0x80, 0x86,
-  0x8b, 0x89, 0x81, 0x79, 0x71, 0x6d, 0x6d, 0x6e, 0x71, 0x73, 0x74, 0x77,
-  0x80, 0x8b, 0x92, 0x94, 0x92, 0x8b, 0x85, 0x80, 0x7d, 0x7b, 0x79, 0x79,
-  0x79, 0x7b, 0x7d, 0x7d, 0x7b, 0x7a, 0x7a, 0x79, 0x7a, 0x7d, 0x7c, 0x7c,
-  0x7e, 0x81, 0x82, 0x84, 0x85, 0x86, 0x88, 0x85, 0x80, 0x79, 0x74, 0x70,
-  0x6f, 0x70, 0x72, 0x73, 0x72, 0x74, 0x7a, 0x84, 0x94, 0xa4, 0xa8, 0x9b,
-  0x80, 0x62, 0x53, 0x58, 0x6a, 0x80, 0x92, 0x99, 0x98, 0x93, 0x92, 0x96,
-  0x9a, 0x9c, 0x9a, 0x93, 0x8a, 0x80, 0x77, 0x6e, 0x64, 0x5c, 0x58, 0x5c,
-  0x68, 0x77, 0x86, 0x91, 0x92, 0x8a, 0x7d, 0x74, 0x74, 0x7c, 0x87, 0x8c,
-  0x89, 0x7c, 0x6f, 0x69, 0x6d, 0x79, 0x87, 0x8e, 0x8e, 0x89, 0x81, 0x79,
-  0x77, 0x7a, 0x7e, 0x84, 0x87, 0x88, 0x87, 0x86, 0x83, 0x7f, 0x7e, 0x80,
-  0x87, 0x8d, 0x8e, 0x89, 0x80, 0x7a, 0x7a, 0x80, 0x8a, 0x91, 0x90, 0x89,
-  0x80, 0x7a, 0x7a, 0x7e, 0x85, 0x88, 0x87, 0x84, 0x80, 0x7b, 0x78, 0x7b,
-  0x80, 0x83, 0x85, 0x84, 0x84, 0x83, 0x83, 0x84, 0x85, 0x87, 0x8a, 0x8a,
-  0x89, 0x86, 0x86, 0x8a, 0x91, 0x98, 0x96, 0x80, 0x5d, 0x3f, 0x38, 0x49,
-  0x68, 0x89, 0x9f, 0xa0, 0x90, 0x86, 0x8c, 0xa0, 0xb6, 0xc2, 0xbf, 0xae,
-  0x98, 0x88, 0x80, 0x7a, 0x72, 0x6a, 0x63, 0x62, 0x67, 0x6f, 0x76, 0x79,
-  0x77, 0x72, 0x70, 0x75, 0x7f, 0x8b, 0x94, 0x95, 0x8a, 0x75, 0x64, 0x62,
-  0x6e, 0x82, 0x91, 0x94, 0x8d, 0x80, 0x77, 0x7a, 0x84, 0x8d, 0x90, 0x8d,
-  0x83, 0x7b, 0x78, 0x78, 0x77, 0x76, 0x76, 0x7a, 0x81, 0x87, 0x88, 0x84,
-  0x80, 0x7d, 0x81, 0x88, 0x8c, 0x8b, 0x84, 0x7d, 0x79, 0x79, 0x7d, 0x80,
-  0x82, 0x84, 0x84, 0x81, 0x7c, 0x79, 0x78, 0x78, 0x7a, 0x7d, 0x7e, 0x7c,
-  0x79, 0x77, 0x76, 0x78, 0x7c, 0x81, 0x83, 0x84, 0x84, 0x82, 0x80, 0x80,
-  0x81, 0x84, 0x88, 0x8d, 0x8e, 0x89, 0x80, 0x74, 0x6b, 0x68, 0x6c, 0x72,
-  0x7a, 0x80, 0x84, 0x85, 0x86, 0x87, 0x89, 0x8b, 0x8e, 0x8f, 0x8e, 0x8a,
-  0x85, 0x81, 0x7d, 0x79, 0x77, 0x76, 0x76, 0x76, 0x78, 0x79, 0x7a, 0x7a,
-  0x79, 0x77, 0x77, 0x78, 0x7a, 0x7d, 0x7e, 0x7c, 0x77, 0x71, 0x6e, 0x70,
-  0x76, 0x7d, 0x82, 0x84, 0x84, 0x84, 0x82, 0x82, 0x84, 0x87, 0x89, 0x8a,
-  0x88, 0x85, 0x81, 0x7c, 0x79, 0x79, 0x7b, 0x7e, 0x80, 0x80, 0x7e, 0x7d,
-  0x7c, 0x7d, 0x81, 0x85, 0x87, 0x86, 0x82, 0x7e, 0x7b, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7f, 0x80, 0x81, 0x82, 0x83,
-  0x84, 0x83, 0x81, 0x80, 0x80, 0x81, 0x83, 0x84, 0x84, 0x81, 0x7e, 0x7e,
-  0x81, 0x86, 0x8b, 0x8d, 0x8b, 0x84, 0x7c, 0x76, 0x74, 0x76, 0x7a, 0x7f,
-  0x82, 0x81, 0x80, 0x80, 0x82, 0x84, 0x86, 0x87, 0x85, 0x81, 0x7d, 0x7b,
-  0x7a, 0x7a, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7d,
-  0x7e, 0x80, 0x83, 0x86, 0x88, 0x88, 0x86, 0x83, 0x82, 0x81, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81,
-  0x82, 0x84, 0x86, 0x86, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85,
-  0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x81,
-  0x81, 0x82, 0x83, 0x84, 0x84, 0x83, 0x82, 0x81, 0x7e, 0x7b, 0x79, 0x78,
-  0x78, 0x7a, 0x7e, 0x81, 0x84, 0x84, 0x85, 0x85, 0x84, 0x81, 0x7e, 0x7e,
-  0x7f, 0x80, 0x81, 0x7f, 0x7c, 0x7a, 0x7a, 0x7b, 0x7e, 0x80, 0x82, 0x82,
-  0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x82, 0x80, 0x80, 0x7f, 0x7e, 0x7f,
-  0x7e, 0x7d, 0x7c, 0x7e, 0x81, 0x83, 0x84, 0x83, 0x81, 0x7f, 0x7d, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7c, 0x7b,
-  0x7a, 0x7b, 0x7c, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e, 0x7f,
-  0x80, 0x82, 0x81, 0x80, 0x81, 0x83, 0x84, 0x84, 0x84, 0x83, 0x81, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7a, 0x78, 0x78,
-  0x7c, 0x81, 0x85, 0x87, 0x87, 0x84, 0x81, 0x7f, 0x7e, 0x80, 0x82, 0x83,
-  0x84, 0x83, 0x81, 0x7e, 0x7d, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x83, 0x80, 0x7e,
-  0x7c, 0x7b, 0x7b, 0x7c, 0x7e, 0x81, 0x83, 0x84, 0x84, 0x85, 0x86, 0x87,
-  0x86, 0x83, 0x80, 0x7c, 0x79, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x7b,
-  0x7d, 0x81, 0x85, 0x86, 0x85, 0x82, 0x80, 0x7c, 0x79, 0x78, 0x78, 0x79,
-  0x7a, 0x7c, 0x7d, 0x7e, 0x82, 0x84, 0x84, 0x83, 0x83, 0x82, 0x81, 0x81,
-  0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82,
-  0x81, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x84, 0x83, 0x81, 0x7e, 0x7c,
-  0x7b, 0x7c, 0x7f, 0x83, 0x86, 0x88, 0x87, 0x86, 0x83, 0x81, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x80, 0x82, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x7e, 0x81, 0x83, 0x82, 0x80, 0x7e,
-  0x7b, 0x7b, 0x7c, 0x7e, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7f, 0x80,
-  0x81, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x80, 0x81, 0x80, 0x7e, 0x7a, 0x7a, 0x7a, 0x7b, 0x7c,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x84,
-  0x84, 0x83, 0x81, 0x7e, 0x7d, 0x80, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82,
-  0x81, 0x80, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83,
-  0x81, 0x7e, 0x7d, 0x7d, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x81, 0x83, 0x83,
-  0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x82,
-  0x82, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x7e, 0x7b, 0x7a, 0x7a, 0x7b, 0x7e, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b, 0x7a,
-  0x79, 0x78, 0x79, 0x7c, 0x80, 0x82, 0x82, 0x81, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7d, 0x7b, 0x7a, 0x7a, 0x7d, 0x80, 0x83, 0x83, 0x82, 0x82, 0x81, 0x82,
-  0x83, 0x83, 0x82, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x83, 0x84, 0x84, 0x86, 0x87, 0x86, 0x85, 0x83, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x7d, 0x79, 0x78, 0x7b, 0x7f, 0x84, 0x86, 0x87, 0x87,
-  0x86, 0x86, 0x86, 0x85, 0x83, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-  0x7d, 0x7e, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x80, 0x7d, 0x7b, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x82, 0x83, 0x82, 0x80, 0x7e, 0x7b, 0x7a, 0x7a, 0x7a, 0x7c,
-  0x7d, 0x7c, 0x7b, 0x7a, 0x7b, 0x7d, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7c, 0x7a, 0x78, 0x78, 0x79, 0x7a, 0x7c, 0x7e, 0x80, 0x81,
-  0x83, 0x84, 0x82, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x82, 0x80, 0x7e,
-  0x7e, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x7e, 0x7b, 0x7a, 0x7b, 0x7e, 0x82, 0x85, 0x85,
-  0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x80, 0x7d, 0x7a,
-  0x7a, 0x7b, 0x7e, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x80, 0x81, 0x82, 0x82,
-  0x80, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x7b, 0x7c, 0x7e, 0x80, 0x81,
-  0x80, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7a, 0x78, 0x79,
-  0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x7a, 0x7d, 0x7e, 0x7f, 0x7f, 0x80,
-  0x81, 0x81, 0x80, 0x7d, 0x7a, 0x7a, 0x7b, 0x7d, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x84, 0x84, 0x83, 0x83, 0x82, 0x83, 0x83, 0x82, 0x80, 0x7f,
-  0x80, 0x81, 0x82, 0x82, 0x82, 0x83, 0x84, 0x86, 0x86, 0x86, 0x84, 0x83,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7a, 0x7a, 0x7c, 0x81, 0x85,
-  0x86, 0x86, 0x86, 0x83, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x84, 0x84, 0x83, 0x82, 0x82, 0x83, 0x85,
-  0x85, 0x86, 0x86, 0x85, 0x84, 0x84, 0x82, 0x7f, 0x7d, 0x7c, 0x7d, 0x7f,
-  0x82, 0x82, 0x82, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x7f,
-  0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7c, 0x7b, 0x7d, 0x7f, 0x82, 0x82, 0x81,
-  0x81, 0x82, 0x83, 0x83, 0x80, 0x7c, 0x7a, 0x7a, 0x7c, 0x7e, 0x80, 0x80,
-  0x80, 0x81, 0x82, 0x84, 0x85, 0x84, 0x84, 0x83, 0x82, 0x82, 0x82, 0x81,
-  0x82, 0x83, 0x83, 0x84, 0x84, 0x83, 0x81, 0x80, 0x80, 0x80, 0x82, 0x83,
-  0x83, 0x82, 0x82, 0x82, 0x83, 0x84, 0x85, 0x85, 0x82, 0x7f, 0x7c, 0x7d,
-  0x81, 0x85, 0x86, 0x86, 0x85, 0x84, 0x84, 0x84, 0x83, 0x82, 0x80, 0x81,
-  0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7e, 0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x7d,
-  0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7b, 0x7b, 0x7c, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7b, 0x78, 0x78, 0x7a, 0x7b, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x84,
-  0x84, 0x84, 0x84, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7c, 0x78, 0x78,
-  0x7a, 0x7e, 0x82, 0x84, 0x84, 0x84, 0x85, 0x86, 0x86, 0x85, 0x84, 0x83,
-  0x82, 0x82, 0x82, 0x80, 0x7d, 0x7c, 0x7d, 0x80, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x82, 0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x82, 0x7f, 0x7b, 0x79,
-  0x7a, 0x7c, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a,
-  0x7a, 0x7b, 0x7c, 0x7f, 0x81, 0x81, 0x80, 0x7d, 0x7a, 0x7a, 0x7c, 0x7d,
-  0x7d, 0x7d, 0x7b, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82,
-  0x83, 0x84, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x84, 0x84, 0x83, 0x84,
-  0x84, 0x84, 0x84, 0x83, 0x82, 0x82, 0x82, 0x83, 0x84, 0x82, 0x7e, 0x7a,
-  0x79, 0x7a, 0x7c, 0x7e, 0x81, 0x82, 0x82, 0x82, 0x83, 0x85, 0x84, 0x82,
-  0x80, 0x80, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7d, 0x80, 0x83, 0x83, 0x82,
-  0x80, 0x80, 0x81, 0x82, 0x83, 0x82, 0x80, 0x80, 0x80, 0x7f, 0x7c, 0x7a,
-  0x79, 0x7b, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a,
-  0x7a, 0x7c, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d,
-  0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80,
-  0x7e, 0x7d, 0x7d, 0x7f, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83,
-  0x84, 0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x83, 0x86, 0x86, 0x86, 0x85, 0x84, 0x83, 0x83,
-  0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x82, 0x84, 0x84,
-  0x82, 0x7f, 0x7d, 0x7d, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7e,
-  0x7c, 0x7b, 0x7b, 0x7b, 0x7d, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x81, 0x7f, 0x7c, 0x7b, 0x7b, 0x7c, 0x7e, 0x80, 0x81, 0x80,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x80, 0x82, 0x85, 0x86, 0x86, 0x85,
-  0x84, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x83, 0x83,
-  0x84, 0x84, 0x85, 0x86, 0x86, 0x86, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x81, 0x84, 0x86, 0x86, 0x84, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7d, 0x7b, 0x7c,
-  0x7e, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x81,
-  0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x79, 0x7b, 0x7d, 0x7e, 0x7f, 0x7f,
-  0x80, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7c, 0x79, 0x78, 0x79, 0x7b, 0x7d,
-  0x7e, 0x7d, 0x7a, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x80,
-  0x7f, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b, 0x7c,
-  0x7e, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x84, 0x84, 0x83, 0x82, 0x81,
-  0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x84, 0x83, 0x83, 0x82,
-  0x82, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x80, 0x82,
-  0x83, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7e,
-  0x7c, 0x7b, 0x7b, 0x7c, 0x7f, 0x81, 0x81, 0x7f, 0x7d, 0x7c, 0x7e, 0x80,
-  0x82, 0x84, 0x85, 0x84, 0x83, 0x81, 0x7f, 0x7d, 0x7a, 0x7a, 0x7b, 0x7e,
-  0x80, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c,
-  0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7d, 0x7b, 0x7a, 0x7b, 0x7d, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x7b, 0x7c, 0x7f, 0x81, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x85, 0x84,
-  0x83, 0x81, 0x7f, 0x7f, 0x80, 0x82, 0x84, 0x84, 0x86, 0x86, 0x86, 0x85,
-  0x84, 0x84, 0x84, 0x85, 0x84, 0x85, 0x86, 0x85, 0x83, 0x80, 0x7d, 0x7b,
-  0x7b, 0x7e, 0x82, 0x84, 0x86, 0x86, 0x86, 0x85, 0x83, 0x82, 0x82, 0x81,
-  0x80, 0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x7f, 0x7e, 0x7d,
-  0x7d, 0x80, 0x82, 0x83, 0x83, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x80, 0x82, 0x83, 0x83, 0x83, 0x82, 0x81, 0x82, 0x83, 0x85, 0x85,
-  0x85, 0x83, 0x81, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7c, 0x7c, 0x7b, 0x7c, 0x7e, 0x80, 0x82, 0x83, 0x83, 0x82, 0x81,
-  0x80, 0x81, 0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81,
-  0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x82, 0x82, 0x82, 0x81, 0x7f,
-  0x7c, 0x7a, 0x7b, 0x7e, 0x82, 0x85, 0x86, 0x84, 0x81, 0x81, 0x82, 0x82,
-  0x83, 0x82, 0x81, 0x80, 0x81, 0x7f, 0x7c, 0x7a, 0x7a, 0x7d, 0x81, 0x84,
-  0x85, 0x84, 0x81, 0x80, 0x80, 0x82, 0x83, 0x84, 0x83, 0x83, 0x82, 0x81,
-  0x7f, 0x7e, 0x7d, 0x7d, 0x7f, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7c,
-  0x7b, 0x7a, 0x79, 0x7a, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x83, 0x84, 0x85, 0x84, 0x84, 0x82, 0x82, 0x82, 0x83,
-  0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x82, 0x7f, 0x7d, 0x7d, 0x80, 0x83, 0x86, 0x85, 0x84, 0x84,
-  0x83, 0x82, 0x81, 0x80, 0x7d, 0x7e, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x7a,
-  0x7e, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x82, 0x81, 0x81, 0x80,
-  0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7c, 0x7e, 0x81, 0x83, 0x84, 0x84, 0x83,
-  0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e,
-  0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7c, 0x79, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x81, 0x82, 0x82, 0x83, 0x82, 0x82, 0x82, 0x83, 0x84, 0x85, 0x84,
-  0x83, 0x83, 0x82, 0x80, 0x7c, 0x7b, 0x7b, 0x7e, 0x82, 0x85, 0x86, 0x85,
-  0x84, 0x84, 0x84, 0x84, 0x83, 0x81, 0x80, 0x80, 0x7f, 0x7d, 0x7b, 0x7a,
-  0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x7e, 0x7d, 0x7f, 0x81, 0x83, 0x84, 0x85,
-  0x84, 0x84, 0x83, 0x81, 0x7f, 0x7c, 0x7a, 0x7a, 0x7b, 0x7d, 0x7e, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7c,
-  0x7d, 0x7c, 0x7b, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x80, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x81, 0x83, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x82, 0x84, 0x85, 0x84,
-  0x83, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x85, 0x86, 0x86, 0x85,
-  0x84, 0x83, 0x82, 0x82, 0x82, 0x82, 0x7f, 0x7c, 0x7c, 0x80, 0x82, 0x83,
-  0x84, 0x84, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x83, 0x82, 0x7e, 0x7a,
-  0x7a, 0x7d, 0x7e, 0x7d, 0x7b, 0x79, 0x7a, 0x80, 0x88, 0x8e, 0x8f, 0x89,
-  0x82, 0x7e, 0x80, 0x83, 0x84, 0x80, 0x7a, 0x75, 0x75, 0x7a, 0x80, 0x81,
-  0x80, 0x7e, 0x7e, 0x84, 0x8a, 0x8c, 0x89, 0x84, 0x80, 0x7e, 0x7f, 0x80,
-  0x7d, 0x78, 0x73, 0x71, 0x72, 0x76, 0x79, 0x7b, 0x7b, 0x7c, 0x7e, 0x82,
-  0x86, 0x86, 0x83, 0x7f, 0x7c, 0x7a, 0x7b, 0x7a, 0x79, 0x7a, 0x7c, 0x7f,
-  0x81, 0x81, 0x80, 0x81, 0x82, 0x86, 0x87, 0x86, 0x82, 0x7e, 0x7d, 0x7e,
-  0x80, 0x82, 0x82, 0x82, 0x84, 0x86, 0x87, 0x88, 0x87, 0x88, 0x8b, 0x92,
-  0x97, 0x93, 0x7f, 0x64, 0x54, 0x51, 0x5d, 0x76, 0x84, 0x7d, 0x6c, 0x60,
-  0x68, 0x86, 0xa6, 0xb9, 0xb8, 0xa5, 0x90, 0x8c, 0x99, 0xa8, 0xa8, 0x94,
-  0x76, 0x67, 0x6f, 0x80, 0x89, 0x82, 0x71, 0x63, 0x67, 0x7e, 0x95, 0x9c,
-  0x8e, 0x74, 0x63, 0x67, 0x75, 0x7e, 0x7a, 0x67, 0x52, 0x4b, 0x55, 0x68,
-  0x79, 0x81, 0x80, 0x7d, 0x7e, 0x84, 0x8b, 0x8e, 0x8c, 0x86, 0x80, 0x7e,
-  0x7f, 0x7e, 0x77, 0x6f, 0x6b, 0x6d, 0x76, 0x82, 0x89, 0x8a, 0x89, 0x87,
-  0x88, 0x89, 0x89, 0x87, 0x85, 0x82, 0x82, 0x80, 0x7f, 0x7e, 0x7f, 0x83,
-  0x88, 0x8c, 0x8c, 0x89, 0x84, 0x82, 0x80, 0x7f, 0x7c, 0x79, 0x77, 0x78,
-  0x7b, 0x7e, 0x7e, 0x7e, 0x81, 0x86, 0x8c, 0x90, 0x90, 0x8b, 0x86, 0x84,
-  0x86, 0x8b, 0x8e, 0x90, 0x8f, 0x8e, 0x8e, 0x87, 0x72, 0x54, 0x3b, 0x3c,
-  0x57, 0x7a, 0x8e, 0x89, 0x72, 0x5d, 0x64, 0x8c, 0xbb, 0xd6, 0xcf, 0xac,
-  0x8b, 0x84, 0x94, 0xa4, 0xa3, 0x8c, 0x6c, 0x5b, 0x63, 0x75, 0x7e, 0x76,
-  0x63, 0x5a, 0x64, 0x7c, 0x92, 0x93, 0x7d, 0x62, 0x58, 0x62, 0x73, 0x7e,
-  0x7a, 0x69, 0x5b, 0x5b, 0x6c, 0x82, 0x92, 0x98, 0x93, 0x8b, 0x88, 0x8a,
-  0x8e, 0x8f, 0x88, 0x7e, 0x75, 0x72, 0x73, 0x73, 0x72, 0x72, 0x74, 0x78,
-  0x7c, 0x7e, 0x80, 0x81, 0x83, 0x87, 0x8a, 0x8b, 0x88, 0x83, 0x7e, 0x7d,
-  0x81, 0x85, 0x86, 0x86, 0x85, 0x85, 0x84, 0x82, 0x7e, 0x7a, 0x78, 0x78,
-  0x78, 0x76, 0x73, 0x72, 0x76, 0x7a, 0x7d, 0x80, 0x83, 0x86, 0x8b, 0x90,
-  0x94, 0x94, 0x90, 0x8a, 0x86, 0x88, 0x8c, 0x8e, 0x8e, 0x8f, 0x8f, 0x8c,
-  0x82, 0x67, 0x40, 0x26, 0x2d, 0x51, 0x7e, 0x98, 0x8d, 0x6b, 0x54, 0x66,
-  0x9f, 0xd5, 0xea, 0xdb, 0xb0, 0x8c, 0x89, 0x9c, 0xa9, 0x9e, 0x7e, 0x5d,
-  0x51, 0x5e, 0x6f, 0x70, 0x62, 0x56, 0x5b, 0x73, 0x8d, 0x9b, 0x90, 0x73,
-  0x5c, 0x5b, 0x6d, 0x81, 0x89, 0x80, 0x6e, 0x63, 0x68, 0x78, 0x8d, 0x9b,
-  0x9f, 0x98, 0x8f, 0x87, 0x81, 0x7d, 0x7a, 0x76, 0x72, 0x70, 0x6e, 0x6c,
-  0x6c, 0x6e, 0x78, 0x84, 0x90, 0x95, 0x8e, 0x80, 0x79, 0x7d, 0x87, 0x8d,
-  0x89, 0x7e, 0x77, 0x79, 0x80, 0x88, 0x8e, 0x91, 0x8e, 0x8a, 0x89, 0x86,
-  0x81, 0x79, 0x73, 0x74, 0x7a, 0x7c, 0x7a, 0x76, 0x74, 0x78, 0x81, 0x8b,
-  0x91, 0x90, 0x8c, 0x8a, 0x8c, 0x8f, 0x92, 0x90, 0x8a, 0x84, 0x83, 0x88,
-  0x8d, 0x8e, 0x8f, 0x94, 0x99, 0x99, 0x8a, 0x65, 0x38, 0x1e, 0x29, 0x53,
-  0x82, 0x9a, 0x8e, 0x6d, 0x5e, 0x77, 0xaf, 0xe2, 0xf4, 0xe4, 0xbd, 0x9a,
-  0x8e, 0x97, 0x9b, 0x8d, 0x72, 0x56, 0x4d, 0x56, 0x60, 0x62, 0x5d, 0x5b,
-  0x68, 0x80, 0x98, 0xa4, 0x9b, 0x80, 0x67, 0x62, 0x6d, 0x7f, 0x8a, 0x86,
-  0x79, 0x6c, 0x67, 0x71, 0x86, 0x9c, 0xab, 0xab, 0x9b, 0x86, 0x76, 0x6e,
-  0x6d, 0x70, 0x72, 0x70, 0x6d, 0x69, 0x6a, 0x70, 0x7b, 0x8a, 0x99, 0xa2,
-  0x9e, 0x92, 0x82, 0x7a, 0x7f, 0x84, 0x84, 0x81, 0x7b, 0x77, 0x7b, 0x81,
-  0x86, 0x8a, 0x8b, 0x8a, 0x8a, 0x88, 0x83, 0x78, 0x6f, 0x6d, 0x70, 0x76,
-  0x7a, 0x7b, 0x79, 0x7a, 0x80, 0x86, 0x8a, 0x8c, 0x8b, 0x87, 0x84, 0x84,
-  0x85, 0x84, 0x80, 0x7c, 0x7b, 0x7e, 0x84, 0x88, 0x8b, 0x90, 0x97, 0xa0,
-  0xa2, 0x8c, 0x5c, 0x29, 0x11, 0x24, 0x58, 0x91, 0xa7, 0x97, 0x72, 0x5f,
-  0x7e, 0xbd, 0xf0, 0xfd, 0xe3, 0xb3, 0x8b, 0x7e, 0x81, 0x81, 0x72, 0x58,
-  0x46, 0x47, 0x56, 0x62, 0x66, 0x60, 0x5f, 0x6e, 0x88, 0x9f, 0xa8, 0x9a,
-  0x7a, 0x5c, 0x53, 0x5f, 0x75, 0x87, 0x8e, 0x87, 0x78, 0x70, 0x77, 0x8a,
-  0xa0, 0xad, 0xa6, 0x8f, 0x72, 0x5b, 0x52, 0x56, 0x5f, 0x6b, 0x72, 0x75,
-  0x76, 0x78, 0x80, 0x8b, 0x9a, 0xa7, 0xaa, 0x9d, 0x85, 0x70, 0x6c, 0x73,
-  0x7b, 0x7c, 0x79, 0x78, 0x7c, 0x84, 0x8a, 0x8d, 0x8c, 0x8b, 0x89, 0x88,
-  0x85, 0x7e, 0x74, 0x6c, 0x6c, 0x72, 0x7d, 0x86, 0x87, 0x84, 0x80, 0x80,
-  0x84, 0x89, 0x8b, 0x89, 0x85, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x84, 0x88, 0x8a, 0x8a, 0x8d, 0x95, 0x9f, 0xa2, 0x92, 0x65, 0x2c, 0x0a,
-  0x12, 0x41, 0x7b, 0xa2, 0xab, 0x92, 0x73, 0x7c, 0xad, 0xe1, 0xfd, 0xf4,
-  0xcc, 0x99, 0x7a, 0x6e, 0x6b, 0x66, 0x5c, 0x52, 0x52, 0x5b, 0x66, 0x6a,
-  0x68, 0x69, 0x74, 0x87, 0x99, 0xa4, 0x9d, 0x82, 0x60, 0x4c, 0x51, 0x69,
-  0x87, 0x9e, 0xa6, 0x9a, 0x85, 0x78, 0x7e, 0x92, 0xa4, 0xa8, 0x96, 0x72,
-  0x50, 0x3e, 0x3f, 0x50, 0x67, 0x7c, 0x8a, 0x90, 0x8f, 0x88, 0x88, 0x91,
-  0x9d, 0xa6, 0xa2, 0x8a, 0x6c, 0x5b, 0x5d, 0x6a, 0x79, 0x86, 0x8b, 0x8a,
-  0x8a, 0x8d, 0x8e, 0x8e, 0x8a, 0x85, 0x81, 0x80, 0x7d, 0x76, 0x6e, 0x69,
-  0x6e, 0x7a, 0x8a, 0x94, 0x94, 0x8c, 0x83, 0x7c, 0x7a, 0x7f, 0x84, 0x86,
-  0x86, 0x83, 0x80, 0x82, 0x86, 0x8c, 0x91, 0x92, 0x90, 0x8c, 0x86, 0x84,
-  0x8b, 0x9b, 0xaa, 0xa9, 0x8c, 0x55, 0x1e, 0x02, 0x11, 0x48, 0x87, 0xb0,
-  0xba, 0x9a, 0x72, 0x74, 0xa0, 0xd6, 0xf6, 0xf2, 0xc8, 0x92, 0x6a, 0x58,
-  0x56, 0x5c, 0x63, 0x66, 0x66, 0x6c, 0x70, 0x6d, 0x67, 0x64, 0x6a, 0x7a,
-  0x8d, 0x98, 0x95, 0x80, 0x5e, 0x46, 0x48, 0x63, 0x89, 0xab, 0xbc, 0xb2,
-  0x94, 0x78, 0x6f, 0x7e, 0x95, 0xa0, 0x96, 0x77, 0x53, 0x3b, 0x39, 0x4a,
-  0x63, 0x7c, 0x92, 0x9f, 0xa0, 0x96, 0x8a, 0x82, 0x85, 0x90, 0x98, 0x92,
-  0x7a, 0x5d, 0x4b, 0x52, 0x69, 0x82, 0x92, 0x96, 0x92, 0x88, 0x82, 0x80,
-  0x82, 0x7f, 0x7a, 0x78, 0x7a, 0x7c, 0x78, 0x71, 0x6d, 0x72, 0x80, 0x92,
-  0x9b, 0x97, 0x88, 0x76, 0x6a, 0x6a, 0x70, 0x79, 0x81, 0x83, 0x80, 0x80,
-  0x83, 0x86, 0x8b, 0x8f, 0x92, 0x93, 0x8f, 0x86, 0x7c, 0x78, 0x7d, 0x8a,
-  0x99, 0xa3, 0x98, 0x6d, 0x32, 0x07, 0x03, 0x2b, 0x6b, 0xa0, 0xc3, 0xbe,
-  0x8f, 0x69, 0x77, 0xaf, 0xe3, 0xf7, 0xe4, 0xb1, 0x7a, 0x56, 0x49, 0x52,
-  0x64, 0x73, 0x79, 0x79, 0x74, 0x6b, 0x62, 0x5f, 0x63, 0x71, 0x83, 0x92,
-  0x96, 0x8a, 0x6e, 0x51, 0x4a, 0x5f, 0x88, 0xaf, 0xc7, 0xc6, 0xa6, 0x7b,
-  0x62, 0x67, 0x7e, 0x94, 0x95, 0x7c, 0x58, 0x3c, 0x38, 0x4c, 0x6a, 0x88,
-  0xa0, 0xad, 0xaa, 0x9e, 0x8f, 0x82, 0x80, 0x89, 0x95, 0x98, 0x89, 0x69,
-  0x4f, 0x50, 0x6b, 0x8b, 0x9d, 0x9f, 0x94, 0x86, 0x7c, 0x79, 0x7c, 0x80,
-  0x7e, 0x7c, 0x7e, 0x81, 0x7e, 0x77, 0x75, 0x79, 0x84, 0x91, 0x97, 0x93,
-  0x84, 0x70, 0x65, 0x67, 0x73, 0x80, 0x88, 0x8b, 0x89, 0x85, 0x82, 0x85,
-  0x8d, 0x94, 0x95, 0x91, 0x8b, 0x85, 0x7e, 0x79, 0x7e, 0x87, 0x8f, 0x96,
-  0x9f, 0x9c, 0x7d, 0x46, 0x13, 0x02, 0x1e, 0x5c, 0x9b, 0xc6, 0xcc, 0xa3,
-  0x72, 0x6e, 0x9b, 0xd6, 0xf7, 0xf2, 0xca, 0x91, 0x60, 0x49, 0x4b, 0x5e,
-  0x74, 0x80, 0x81, 0x78, 0x68, 0x5c, 0x5b, 0x65, 0x75, 0x84, 0x8e, 0x91,
-  0x8c, 0x7b, 0x65, 0x5c, 0x67, 0x84, 0xa7, 0xc4, 0xcd, 0xb8, 0x8e, 0x6a,
-  0x62, 0x71, 0x87, 0x91, 0x86, 0x69, 0x4a, 0x3f, 0x4b, 0x66, 0x85, 0xa0,
-  0xab, 0xa8, 0x9d, 0x90, 0x87, 0x85, 0x89, 0x91, 0x98, 0x95, 0x82, 0x66,
-  0x54, 0x5b, 0x78, 0x97, 0xa6, 0xa1, 0x90, 0x80, 0x79, 0x7a, 0x80, 0x86,
-  0x87, 0x85, 0x83, 0x84, 0x84, 0x81, 0x7c, 0x7b, 0x85, 0x91, 0x97, 0x90,
-  0x7f, 0x6d, 0x65, 0x69, 0x75, 0x82, 0x8a, 0x8b, 0x88, 0x84, 0x84, 0x87,
-  0x8c, 0x92, 0x95, 0x93, 0x8e, 0x86, 0x7c, 0x77, 0x79, 0x80, 0x88, 0x8f,
-  0x96, 0x9c, 0x95, 0x77, 0x46, 0x1a, 0x0c, 0x26, 0x5c, 0x99, 0xc2, 0xc8,
-  0xa9, 0x81, 0x78, 0x9a, 0xca, 0xe7, 0xe2, 0xbf, 0x8f, 0x64, 0x4c, 0x4b,
-  0x5c, 0x70, 0x7d, 0x80, 0x79, 0x6e, 0x65, 0x63, 0x69, 0x72, 0x79, 0x81,
-  0x85, 0x84, 0x7c, 0x6f, 0x65, 0x68, 0x78, 0x94, 0xb0, 0xbe, 0xb5, 0x98,
-  0x78, 0x66, 0x67, 0x74, 0x81, 0x7e, 0x6d, 0x56, 0x48, 0x4c, 0x60, 0x7b,
-  0x91, 0x9d, 0x9e, 0x98, 0x8f, 0x87, 0x82, 0x82, 0x85, 0x89, 0x8a, 0x84,
-  0x76, 0x66, 0x5c, 0x63, 0x79, 0x90, 0x99, 0x91, 0x7f, 0x74, 0x74, 0x7b,
-  0x83, 0x8a, 0x8c, 0x8a, 0x88, 0x88, 0x86, 0x7f, 0x77, 0x78, 0x82, 0x8c,
-  0x8d, 0x82, 0x6f, 0x63, 0x64, 0x71, 0x81, 0x8e, 0x90, 0x8b, 0x82, 0x7e,
-  0x81, 0x87, 0x8d, 0x90, 0x91, 0x8d, 0x86, 0x7e, 0x79, 0x77, 0x79, 0x7d,
-  0x84, 0x89, 0x8c, 0x90, 0x93, 0x8b, 0x6a, 0x37, 0x0f, 0x0b, 0x2d, 0x67,
-  0xa2, 0xc5, 0xc6, 0xa4, 0x80, 0x80, 0xa4, 0xd0, 0xe4, 0xd9, 0xb2, 0x81,
-  0x59, 0x44, 0x46, 0x58, 0x6c, 0x78, 0x7e, 0x7a, 0x71, 0x67, 0x63, 0x65,
-  0x6d, 0x77, 0x80, 0x85, 0x84, 0x7c, 0x71, 0x66, 0x67, 0x77, 0x92, 0xac,
-  0xbc, 0xb7, 0x9e, 0x7b, 0x62, 0x5c, 0x66, 0x74, 0x7a, 0x71, 0x5d, 0x4b,
-  0x47, 0x53, 0x6a, 0x85, 0x99, 0xa1, 0x9d, 0x94, 0x8a, 0x83, 0x80, 0x80,
-  0x83, 0x88, 0x8b, 0x8b, 0x83, 0x74, 0x65, 0x60, 0x6c, 0x81, 0x8f, 0x8f,
-  0x83, 0x74, 0x6d, 0x72, 0x7b, 0x82, 0x88, 0x8d, 0x8d, 0x8b, 0x86, 0x7e,
-  0x77, 0x77, 0x7c, 0x87, 0x8a, 0x82, 0x73, 0x68, 0x68, 0x74, 0x83, 0x8d,
-  0x8f, 0x8a, 0x81, 0x79, 0x79, 0x7e, 0x83, 0x89, 0x8d, 0x8c, 0x88, 0x80,
-  0x7a, 0x7a, 0x7c, 0x7e, 0x81, 0x83, 0x87, 0x8b, 0x90, 0x92, 0x84, 0x5a,
-  0x27, 0x0e, 0x1e, 0x4d, 0x89, 0xb7, 0xca, 0xbc, 0x96, 0x7c, 0x8a, 0xb1,
-  0xd1, 0xd9, 0xc6, 0x9f, 0x75, 0x54, 0x46, 0x4c, 0x60, 0x74, 0x83, 0x88,
-  0x82, 0x76, 0x6b, 0x65, 0x67, 0x70, 0x79, 0x80, 0x85, 0x85, 0x80, 0x77,
-  0x6e, 0x72, 0x84, 0x9d, 0xb5, 0xbf, 0xb3, 0x93, 0x71, 0x5e, 0x5f, 0x6d,
-  0x7a, 0x7b, 0x70, 0x5d, 0x52, 0x57, 0x6a, 0x83, 0x97, 0xa3, 0xa3, 0x9a,
-  0x8c, 0x81, 0x7c, 0x7f, 0x85, 0x8c, 0x8f, 0x8d, 0x88, 0x80, 0x76, 0x70,
-  0x6f, 0x74, 0x7c, 0x82, 0x83, 0x7b, 0x70, 0x6d, 0x75, 0x82, 0x90, 0x9a,
-  0x9e, 0x9a, 0x90, 0x84, 0x7d, 0x7d, 0x81, 0x86, 0x88, 0x84, 0x7b, 0x72,
-  0x6d, 0x72, 0x7e, 0x89, 0x8f, 0x8c, 0x82, 0x78, 0x73, 0x74, 0x7d, 0x89,
-  0x92, 0x97, 0x97, 0x93, 0x8e, 0x8c, 0x8a, 0x87, 0x85, 0x81, 0x7c, 0x79,
-  0x7b, 0x84, 0x91, 0x98, 0x87, 0x58, 0x22, 0x0c, 0x22, 0x56, 0x95, 0xc5,
-  0xd9, 0xc4, 0x96, 0x78, 0x86, 0xb0, 0xd3, 0xde, 0xcc, 0xa6, 0x7b, 0x5a,
-  0x4b, 0x50, 0x64, 0x7a, 0x89, 0x90, 0x87, 0x75, 0x63, 0x5a, 0x5c, 0x66,
-  0x74, 0x81, 0x8a, 0x8c, 0x84, 0x76, 0x6c, 0x72, 0x8a, 0xaa, 0xc4, 0xc9,
-  0xb2, 0x88, 0x63, 0x54, 0x5e, 0x74, 0x81, 0x7f, 0x6e, 0x5b, 0x55, 0x5f,
-  0x74, 0x8a, 0x9a, 0xa1, 0x9f, 0x96, 0x89, 0x7c, 0x76, 0x75, 0x7a, 0x86,
-  0x8f, 0x91, 0x8a, 0x80, 0x77, 0x75, 0x78, 0x7c, 0x7a, 0x74, 0x72, 0x75,
-  0x77, 0x78, 0x7c, 0x82, 0x8b, 0x94, 0x9a, 0x9c, 0x97, 0x8a, 0x7a, 0x74,
-  0x79, 0x81, 0x84, 0x7f, 0x77, 0x71, 0x70, 0x75, 0x7d, 0x86, 0x8a, 0x88,
-  0x7e, 0x73, 0x6c, 0x6c, 0x73, 0x7d, 0x88, 0x90, 0x93, 0x92, 0x8e, 0x89,
-  0x86, 0x85, 0x84, 0x7e, 0x77, 0x70, 0x6d, 0x74, 0x86, 0x97, 0x97, 0x76,
-  0x3b, 0x0f, 0x0f, 0x3b, 0x7c, 0xb5, 0xd2, 0xc8, 0x9a, 0x70, 0x73, 0x9f,
-  0xca, 0xdc, 0xd0, 0xab, 0x81, 0x60, 0x50, 0x50, 0x60, 0x74, 0x83, 0x8a,
-  0x82, 0x70, 0x5f, 0x54, 0x54, 0x5c, 0x6a, 0x79, 0x86, 0x8a, 0x83, 0x75,
-  0x69, 0x6d, 0x83, 0xa2, 0xbe, 0xca, 0xb9, 0x94, 0x6e, 0x5a, 0x5d, 0x6f,
-  0x7c, 0x7b, 0x6c, 0x58, 0x4c, 0x50, 0x63, 0x7a, 0x8d, 0x99, 0x9a, 0x94,
-  0x89, 0x7e, 0x76, 0x72, 0x76, 0x81, 0x8c, 0x92, 0x92, 0x8b, 0x81, 0x7a,
-  0x7b, 0x80, 0x7f, 0x74, 0x68, 0x67, 0x6d, 0x6f, 0x70, 0x74, 0x79, 0x82,
-  0x8d, 0x95, 0x96, 0x8d, 0x7f, 0x76, 0x77, 0x80, 0x88, 0x89, 0x84, 0x7d,
-  0x7a, 0x7a, 0x7d, 0x81, 0x83, 0x82, 0x7d, 0x76, 0x6d, 0x69, 0x6b, 0x72,
-  0x7c, 0x87, 0x8f, 0x92, 0x92, 0x8f, 0x8a, 0x86, 0x85, 0x82, 0x7d, 0x78,
-  0x77, 0x7a, 0x82, 0x8e, 0x9a, 0x9a, 0x85, 0x56, 0x22, 0x0a, 0x1f, 0x56,
-  0x96, 0xc3, 0xce, 0xb0, 0x81, 0x6f, 0x8b, 0xbe, 0xe0, 0xdf, 0xc0, 0x93,
-  0x71, 0x62, 0x61, 0x65, 0x6c, 0x72, 0x76, 0x7b, 0x7c, 0x76, 0x69, 0x5c,
-  0x57, 0x5d, 0x6c, 0x7f, 0x8e, 0x90, 0x80, 0x6a, 0x5e, 0x6b, 0x8c, 0xb0,
-  0xc7, 0xc7, 0xac, 0x84, 0x69, 0x67, 0x75, 0x82, 0x82, 0x73, 0x60, 0x57,
-  0x5c, 0x6a, 0x76, 0x80, 0x87, 0x8d, 0x93, 0x94, 0x8c, 0x7d, 0x6e, 0x6c,
-  0x7a, 0x8f, 0x9d, 0x9d, 0x90, 0x81, 0x7b, 0x81, 0x8c, 0x8d, 0x7e, 0x68,
-  0x5c, 0x64, 0x73, 0x7a, 0x78, 0x7a, 0x85, 0x94, 0x9d, 0x9a, 0x8e, 0x7e,
-  0x76, 0x7c, 0x8a, 0x92, 0x90, 0x82, 0x76, 0x76, 0x82, 0x8c, 0x8e, 0x89,
-  0x7f, 0x75, 0x6d, 0x66, 0x63, 0x65, 0x6a, 0x75, 0x82, 0x8d, 0x95, 0x9a,
-  0x9d, 0x9c, 0x97, 0x8f, 0x87, 0x80, 0x7a, 0x79, 0x7a, 0x7c, 0x83, 0x8d,
-  0x92, 0x86, 0x5d, 0x27, 0x08, 0x17, 0x4a, 0x8c, 0xbb, 0xc7, 0xac, 0x83,
-  0x74, 0x94, 0xc5, 0xe2, 0xdc, 0xba, 0x91, 0x7a, 0x78, 0x7a, 0x76, 0x71,
-  0x6d, 0x6e, 0x78, 0x80, 0x7a, 0x69, 0x53, 0x46, 0x4a, 0x5e, 0x76, 0x88,
-  0x8a, 0x7c, 0x68, 0x61, 0x72, 0x94, 0xb8, 0xcf, 0xcd, 0xb4, 0x93, 0x7b,
-  0x76, 0x7d, 0x81, 0x7b, 0x6d, 0x61, 0x5f, 0x66, 0x6e, 0x71, 0x73, 0x78,
-  0x84, 0x91, 0x97, 0x90, 0x7c, 0x69, 0x66, 0x76, 0x8d, 0x9d, 0x9e, 0x94,
-  0x86, 0x82, 0x86, 0x8b, 0x8b, 0x80, 0x73, 0x6e, 0x73, 0x79, 0x76, 0x71,
-  0x71, 0x7a, 0x88, 0x94, 0x96, 0x8d, 0x7d, 0x72, 0x74, 0x7e, 0x88, 0x8a,
-  0x86, 0x81, 0x82, 0x86, 0x8a, 0x8d, 0x8d, 0x8b, 0x87, 0x80, 0x76, 0x6d,
-  0x69, 0x6c, 0x73, 0x7c, 0x85, 0x8d, 0x93, 0x95, 0x97, 0x95, 0x8d, 0x85,
-  0x81, 0x80, 0x7e, 0x7a, 0x78, 0x7c, 0x86, 0x92, 0x98, 0x8d, 0x67, 0x33,
-  0x10, 0x17, 0x46, 0x83, 0xb2, 0xc2, 0xad, 0x8a, 0x7e, 0x99, 0xc2, 0xdc,
-  0xd5, 0xb1, 0x8c, 0x7b, 0x7e, 0x83, 0x7e, 0x73, 0x69, 0x6a, 0x78, 0x86,
-  0x84, 0x70, 0x53, 0x41, 0x46, 0x5e, 0x78, 0x87, 0x84, 0x71, 0x5f, 0x5e,
-  0x74, 0x98, 0xb6, 0xc4, 0xbc, 0xa3, 0x89, 0x7b, 0x7a, 0x7e, 0x7c, 0x73,
-  0x69, 0x65, 0x6a, 0x72, 0x76, 0x74, 0x73, 0x78, 0x84, 0x8f, 0x90, 0x84,
-  0x71, 0x65, 0x69, 0x7a, 0x8e, 0x97, 0x94, 0x8d, 0x8a, 0x8b, 0x8c, 0x89,
-  0x82, 0x7e, 0x7f, 0x81, 0x7f, 0x77, 0x6e, 0x6b, 0x72, 0x7f, 0x89, 0x8d,
-  0x87, 0x7c, 0x74, 0x73, 0x78, 0x7e, 0x81, 0x81, 0x81, 0x81, 0x83, 0x87,
-  0x8a, 0x8c, 0x8c, 0x8a, 0x84, 0x7c, 0x77, 0x74, 0x72, 0x73, 0x76, 0x7b,
-  0x83, 0x8a, 0x90, 0x90, 0x8c, 0x85, 0x81, 0x82, 0x83, 0x82, 0x83, 0x86,
-  0x8b, 0x90, 0x93, 0x84, 0x5c, 0x29, 0x0b, 0x18, 0x4b, 0x8b, 0xb8, 0xc1,
-  0xa6, 0x82, 0x80, 0xa3, 0xcc, 0xdb, 0xc4, 0x97, 0x74, 0x71, 0x81, 0x8c,
-  0x85, 0x72, 0x66, 0x6d, 0x80, 0x8f, 0x89, 0x6c, 0x4a, 0x3b, 0x48, 0x64,
-  0x7a, 0x81, 0x76, 0x64, 0x5c, 0x69, 0x86, 0xa6, 0xbc, 0xc0, 0xb2, 0x9c,
-  0x8b, 0x84, 0x7f, 0x79, 0x72, 0x6a, 0x68, 0x6e, 0x78, 0x7e, 0x7d, 0x77,
-  0x76, 0x7e, 0x8a, 0x90, 0x8a, 0x77, 0x65, 0x60, 0x6b, 0x7f, 0x8e, 0x94,
-  0x90, 0x8a, 0x89, 0x8c, 0x8c, 0x86, 0x7f, 0x7e, 0x82, 0x83, 0x7d, 0x73,
-  0x6e, 0x72, 0x7e, 0x8b, 0x90, 0x90, 0x87, 0x7a, 0x72, 0x71, 0x74, 0x77,
-  0x79, 0x7c, 0x7f, 0x82, 0x85, 0x89, 0x8f, 0x95, 0x98, 0x94, 0x88, 0x7b,
-  0x74, 0x70, 0x71, 0x73, 0x76, 0x7c, 0x84, 0x8b, 0x92, 0x96, 0x93, 0x8a,
-  0x81, 0x7c, 0x7b, 0x7e, 0x82, 0x86, 0x88, 0x8a, 0x8e, 0x91, 0x80, 0x54,
-  0x21, 0x0d, 0x27, 0x60, 0x9b, 0xbd, 0xb9, 0x97, 0x7e, 0x8e, 0xba, 0xda,
-  0xd6, 0xaf, 0x83, 0x75, 0x86, 0x9b, 0x9b, 0x84, 0x68, 0x60, 0x73, 0x8e,
-  0x97, 0x81, 0x5a, 0x40, 0x43, 0x5b, 0x73, 0x7c, 0x72, 0x5f, 0x57, 0x63,
-  0x7d, 0x9a, 0xac, 0xb0, 0xa8, 0x9e, 0x96, 0x8e, 0x84, 0x79, 0x6e, 0x69,
-  0x6e, 0x78, 0x82, 0x84, 0x7b, 0x71, 0x70, 0x7a, 0x86, 0x8a, 0x80, 0x6c,
-  0x5f, 0x61, 0x70, 0x7f, 0x88, 0x8a, 0x88, 0x88, 0x8e, 0x92, 0x8e, 0x82,
-  0x78, 0x7c, 0x87, 0x8a, 0x82, 0x74, 0x6f, 0x77, 0x82, 0x8a, 0x8a, 0x84,
-  0x78, 0x71, 0x71, 0x72, 0x72, 0x70, 0x70, 0x76, 0x80, 0x87, 0x88, 0x87,
-  0x89, 0x8f, 0x94, 0x94, 0x89, 0x7a, 0x6f, 0x6c, 0x72, 0x79, 0x7c, 0x7b,
-  0x7b, 0x81, 0x8a, 0x92, 0x94, 0x8c, 0x80, 0x77, 0x76, 0x78, 0x7b, 0x7d,
-  0x80, 0x84, 0x8a, 0x92, 0x95, 0x87, 0x61, 0x30, 0x12, 0x1f, 0x4f, 0x8a,
-  0xb4, 0xb8, 0x9c, 0x81, 0x89, 0xaf, 0xd0, 0xd1, 0xae, 0x82, 0x71, 0x83,
-  0x9d, 0xa1, 0x88, 0x65, 0x57, 0x6c, 0x8e, 0x9d, 0x8b, 0x61, 0x42, 0x43,
-  0x5c, 0x72, 0x76, 0x67, 0x52, 0x4e, 0x61, 0x7e, 0x96, 0xa4, 0xa5, 0xa1,
-  0xa0, 0xa1, 0x9b, 0x8c, 0x78, 0x6b, 0x6b, 0x76, 0x83, 0x88, 0x83, 0x76,
-  0x6e, 0x73, 0x80, 0x89, 0x88, 0x7b, 0x6a, 0x63, 0x66, 0x70, 0x77, 0x7a,
-  0x7c, 0x82, 0x8b, 0x96, 0x99, 0x8d, 0x7e, 0x7c, 0x87, 0x93, 0x94, 0x86,
-  0x75, 0x6e, 0x76, 0x85, 0x8e, 0x8d, 0x84, 0x79, 0x73, 0x74, 0x75, 0x72,
-  0x6e, 0x6f, 0x78, 0x82, 0x87, 0x86, 0x83, 0x85, 0x8e, 0x97, 0x99, 0x91,
-  0x83, 0x76, 0x72, 0x76, 0x7d, 0x81, 0x82, 0x80, 0x80, 0x87, 0x8f, 0x91,
-  0x8c, 0x84, 0x7c, 0x77, 0x76, 0x77, 0x7a, 0x7f, 0x84, 0x89, 0x8f, 0x96,
-  0x99, 0x8b, 0x60, 0x2c, 0x11, 0x23, 0x59, 0x94, 0xb8, 0xb4, 0x93, 0x7e,
-  0x94, 0xc0, 0xda, 0xca, 0x99, 0x6f, 0x71, 0x93, 0xab, 0x9f, 0x76, 0x54,
-  0x5a, 0x7e, 0x9e, 0x9f, 0x7d, 0x51, 0x42, 0x54, 0x70, 0x77, 0x67, 0x4d,
-  0x45, 0x59, 0x7b, 0x96, 0xa2, 0xa0, 0x9a, 0x9e, 0xa8, 0xab, 0x9e, 0x82,
-  0x6a, 0x64, 0x73, 0x85, 0x8d, 0x88, 0x7a, 0x70, 0x73, 0x80, 0x8b, 0x8c,
-  0x7e, 0x69, 0x60, 0x66, 0x72, 0x77, 0x76, 0x72, 0x73, 0x7e, 0x8d, 0x94,
-  0x90, 0x87, 0x84, 0x8a, 0x95, 0x99, 0x8f, 0x7c, 0x6e, 0x72, 0x80, 0x8c,
-  0x90, 0x88, 0x7b, 0x73, 0x72, 0x74, 0x72, 0x6b, 0x68, 0x6c, 0x77, 0x81,
-  0x85, 0x84, 0x86, 0x8d, 0x97, 0x9e, 0x9b, 0x91, 0x84, 0x7a, 0x78, 0x7c,
-  0x80, 0x80, 0x7c, 0x7c, 0x81, 0x87, 0x8b, 0x8b, 0x86, 0x81, 0x7d, 0x78,
-  0x75, 0x73, 0x72, 0x74, 0x7c, 0x86, 0x8e, 0x92, 0x96, 0x95, 0x83, 0x56,
-  0x24, 0x13, 0x33, 0x6e, 0xa2, 0xb8, 0xac, 0x8e, 0x84, 0xa1, 0xca, 0xd9,
-  0xbe, 0x8a, 0x6a, 0x78, 0x9e, 0xb0, 0x9a, 0x6c, 0x4d, 0x58, 0x7f, 0x9e,
-  0x9c, 0x76, 0x4b, 0x40, 0x5a, 0x78, 0x80, 0x6b, 0x4c, 0x43, 0x59, 0x7c,
-  0x96, 0x9e, 0x98, 0x92, 0x97, 0xa6, 0xaf, 0xa4, 0x86, 0x6b, 0x67, 0x76,
-  0x88, 0x8f, 0x88, 0x78, 0x6e, 0x73, 0x82, 0x8e, 0x8e, 0x81, 0x70, 0x69,
-  0x71, 0x7b, 0x7b, 0x70, 0x65, 0x67, 0x7a, 0x92, 0xa3, 0xa4, 0x97, 0x8d,
-  0x8e, 0x97, 0x9a, 0x90, 0x80, 0x73, 0x74, 0x7e, 0x89, 0x8c, 0x86, 0x7e,
-  0x7b, 0x7e, 0x7e, 0x77, 0x69, 0x60, 0x65, 0x74, 0x83, 0x89, 0x87, 0x86,
-  0x8c, 0x96, 0x9f, 0xa1, 0x98, 0x8a, 0x7e, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c,
-  0x81, 0x87, 0x8d, 0x8e, 0x8c, 0x87, 0x83, 0x7f, 0x7a, 0x73, 0x6f, 0x6f,
-  0x72, 0x78, 0x7e, 0x82, 0x85, 0x8e, 0x9a, 0xa0, 0x98, 0x7c, 0x4d, 0x26,
-  0x20, 0x3d, 0x68, 0x8b, 0x9a, 0x96, 0x91, 0x9c, 0xb6, 0xcd, 0xcd, 0xb2,
-  0x8e, 0x7e, 0x89, 0x99, 0x97, 0x7c, 0x5a, 0x4e, 0x62, 0x84, 0x98, 0x92,
-  0x74, 0x5a, 0x58, 0x6a, 0x76, 0x70, 0x57, 0x3f, 0x42, 0x5d, 0x7c, 0x8e,
-  0x93, 0x8f, 0x91, 0x9d, 0xab, 0xae, 0x9c, 0x81, 0x6f, 0x6f, 0x7a, 0x83,
-  0x81, 0x76, 0x6f, 0x73, 0x81, 0x8e, 0x91, 0x86, 0x77, 0x70, 0x72, 0x78,
-  0x78, 0x6e, 0x63, 0x61, 0x6c, 0x7f, 0x90, 0x96, 0x95, 0x90, 0x8f, 0x90,
-  0x91, 0x8f, 0x85, 0x7b, 0x78, 0x7c, 0x81, 0x86, 0x87, 0x86, 0x84, 0x82,
-  0x7e, 0x77, 0x70, 0x6b, 0x6c, 0x72, 0x77, 0x7b, 0x7b, 0x7c, 0x81, 0x89,
-  0x90, 0x93, 0x91, 0x8b, 0x84, 0x81, 0x7e, 0x7b, 0x7a, 0x7c, 0x7f, 0x82,
-  0x85, 0x84, 0x83, 0x82, 0x81, 0x82, 0x7e, 0x78, 0x74, 0x70, 0x6f, 0x72,
-  0x76, 0x7a, 0x7d, 0x80, 0x82, 0x85, 0x88, 0x87, 0x86, 0x87, 0x8e, 0x92,
-  0x8c, 0x76, 0x57, 0x3f, 0x3d, 0x54, 0x76, 0x90, 0x9a, 0x96, 0x94, 0x9b,
-  0xa9, 0xb1, 0xa8, 0x93, 0x82, 0x81, 0x8c, 0x96, 0x92, 0x84, 0x77, 0x77,
-  0x82, 0x8d, 0x8b, 0x7c, 0x6b, 0x66, 0x6c, 0x71, 0x6e, 0x63, 0x58, 0x5a,
-  0x69, 0x7a, 0x83, 0x84, 0x83, 0x85, 0x8c, 0x94, 0x94, 0x8c, 0x80, 0x79,
-  0x7a, 0x81, 0x86, 0x87, 0x85, 0x81, 0x81, 0x84, 0x86, 0x84, 0x80, 0x7b,
-  0x76, 0x75, 0x74, 0x73, 0x70, 0x6e, 0x71, 0x7a, 0x87, 0x92, 0x97, 0x98,
-  0x96, 0x92, 0x8f, 0x8a, 0x88, 0x86, 0x83, 0x82, 0x82, 0x83, 0x85, 0x86,
-  0x87, 0x87, 0x84, 0x7e, 0x77, 0x70, 0x6a, 0x68, 0x6b, 0x70, 0x76, 0x7c,
-  0x80, 0x85, 0x8b, 0x90, 0x93, 0x92, 0x8f, 0x8a, 0x84, 0x80, 0x7c, 0x79,
-  0x78, 0x7b, 0x80, 0x85, 0x88, 0x88, 0x86, 0x82, 0x7e, 0x7c, 0x79, 0x75,
-  0x72, 0x6f, 0x6f, 0x73, 0x78, 0x7c, 0x7f, 0x82, 0x83, 0x82, 0x84, 0x86,
-  0x85, 0x81, 0x7e, 0x7c, 0x7e, 0x83, 0x87, 0x8a, 0x86, 0x7d, 0x73, 0x70,
-  0x74, 0x7b, 0x80, 0x80, 0x7f, 0x7d, 0x7d, 0x81, 0x84, 0x84, 0x81, 0x81,
-  0x85, 0x8c, 0x91, 0x91, 0x8d, 0x8a, 0x89, 0x8a, 0x8a, 0x86, 0x80, 0x7b,
-  0x7a, 0x7a, 0x7a, 0x78, 0x74, 0x70, 0x70, 0x71, 0x74, 0x74, 0x74, 0x73,
-  0x74, 0x77, 0x79, 0x7b, 0x7c, 0x7b, 0x7c, 0x7d, 0x80, 0x82, 0x84, 0x85,
-  0x84, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7e, 0x7d, 0x7b,
-  0x7a, 0x7b, 0x7b, 0x7c, 0x7e, 0x81, 0x84, 0x85, 0x84, 0x83, 0x82, 0x82,
-  0x84, 0x84, 0x86, 0x85, 0x84, 0x83, 0x83, 0x83, 0x84, 0x85, 0x85, 0x83,
-  0x80, 0x7d, 0x7b, 0x79, 0x78, 0x79, 0x7a, 0x7b, 0x7b, 0x7c, 0x7f, 0x82,
-  0x83, 0x84, 0x85, 0x86, 0x86, 0x84, 0x83, 0x82, 0x82, 0x81, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c,
-  0x7c, 0x7c, 0x7b, 0x7b, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7e, 0x82, 0x84, 0x84, 0x83,
-  0x84, 0x83, 0x81, 0x7b, 0x76, 0x75, 0x75, 0x76, 0x79, 0x7c, 0x80, 0x82,
-  0x86, 0x8b, 0x90, 0x91, 0x8f, 0x8d, 0x8e, 0x90, 0x90, 0x8d, 0x89, 0x85,
-  0x82, 0x82, 0x83, 0x81, 0x7d, 0x7b, 0x7a, 0x7a, 0x79, 0x76, 0x74, 0x72,
-  0x71, 0x72, 0x75, 0x78, 0x7b, 0x7d, 0x7f, 0x82, 0x85, 0x86, 0x84, 0x83,
-  0x82, 0x84, 0x86, 0x87, 0x86, 0x85, 0x85, 0x86, 0x88, 0x88, 0x86, 0x82,
-  0x7e, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x81, 0x85, 0x88, 0x89, 0x88,
-  0x89, 0x88, 0x86, 0x86, 0x85, 0x83, 0x81, 0x80, 0x81, 0x82, 0x84, 0x84,
-  0x84, 0x83, 0x82, 0x80, 0x80, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x80,
-  0x82, 0x85, 0x88, 0x8b, 0x8d, 0x8b, 0x89, 0x88, 0x87, 0x85, 0x83, 0x81,
-  0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x81, 0x7f, 0x7d, 0x7c, 0x7d, 0x7c, 0x7a,
-  0x77, 0x77, 0x79, 0x7b, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x7f, 0x7d, 0x7b, 0x79, 0x79, 0x7b, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x82,
-  0x83, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f,
-  0x80, 0x7e, 0x7a, 0x77, 0x76, 0x77, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x83,
-  0x86, 0x87, 0x87, 0x86, 0x85, 0x86, 0x87, 0x86, 0x85, 0x85, 0x84, 0x82,
-  0x81, 0x80, 0x80, 0x7f, 0x7d, 0x7b, 0x7a, 0x7a, 0x7a, 0x7c, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x7f,
-  0x7d, 0x7c, 0x7d, 0x7f, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7c, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83,
-  0x80, 0x7d, 0x7b, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7f,
-  0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x81, 0x83,
-  0x86, 0x88, 0x88, 0x86, 0x85, 0x85, 0x86, 0x87, 0x87, 0x85, 0x83, 0x80,
-  0x80, 0x82, 0x84, 0x84, 0x83, 0x81, 0x7e, 0x7f, 0x80, 0x7f, 0x7d, 0x7b,
-  0x7a, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7e, 0x81, 0x82, 0x81,
-  0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81,
-  0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x80, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x80, 0x84, 0x86,
-  0x86, 0x84, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x80, 0x7e, 0x7f, 0x80,
-  0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7d, 0x7c,
-  0x7d, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x78, 0x79, 0x7a, 0x7c, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82,
-  0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7c, 0x7c, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x7f, 0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82, 0x83, 0x84,
-  0x84, 0x82, 0x80, 0x7e, 0x7e, 0x7d, 0x7d, 0x80, 0x82, 0x81, 0x81, 0x82,
-  0x83, 0x84, 0x83, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x80,
-  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81,
-  0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x82, 0x83, 0x83, 0x82, 0x83, 0x83, 0x83, 0x82, 0x83,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x83, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x83, 0x83,
-  0x84, 0x84, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7d, 0x7f, 0x80, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x80, 0x7e,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x7e, 0x7d,
-  0x7d, 0x7e, 0x7f, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x80, 0x80, 0x82, 0x83, 0x84, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x82,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7c, 0x7d, 0x7e, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x80, 0x81,
-  0x81, 0x81, 0x80, 0x7e, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x81,
-  0x80, 0x81, 0x80, 0x80, 0x7e, 0x7d, 0x7d, 0x80, 0x82, 0x83, 0x83, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x80, 0x80, 0x81, 0x82, 0x83, 0x82, 0x82, 0x81,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81,
-  0x82, 0x83, 0x83, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7e,
-  0x7f, 0x7e, 0x7e, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83,
-  0x83, 0x82, 0x83, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x80, 0x81, 0x82, 0x82,
-  0x83, 0x83, 0x84, 0x84, 0x83, 0x82, 0x80, 0x7e, 0x7f, 0x80, 0x7e, 0x7d,
-  0x7e, 0x80, 0x80, 0x82, 0x83, 0x82, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x82, 0x84, 0x84, 0x83, 0x82, 0x82, 0x83, 0x83, 0x81,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x81, 0x84,
-  0x84, 0x83, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x82, 0x80, 0x80, 0x81,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x81,
-  0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x82, 0x80, 0x7f,
-  0x80, 0x81, 0x80, 0x80, 0x7e, 0x7d, 0x7c, 0x7c, 0x7e, 0x7f, 0x7f, 0x80,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7f,
-  0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x7e, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x82, 0x81,
-  0x81, 0x80, 0x7e, 0x7c, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7e, 0x80,
-  0x83, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80,
-  0x81, 0x82, 0x81, 0x81, 0x82, 0x83, 0x84, 0x83, 0x82, 0x82, 0x82, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81,
-  0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7f, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x7c, 0x7e,
-  0x7d, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x7f, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83,
-  0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7c,
-  0x7d, 0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x82,
-  0x82, 0x82, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x82, 0x82, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7e, 0x7e, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x81, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x83, 0x84, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80,
-  0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x7e,
-  0x7f, 0x7f, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x83,
-  0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x80,
-  0x82, 0x82, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f,
-  0x7f, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x7f,
-  0x7e, 0x7d, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x82, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x80,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f,
-  0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x81,
-  0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x81, 0x80, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x80, 0x80,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82,
-  0x82, 0x82, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81,
-  0x82, 0x82, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e,
-  0x7d, 0x7c, 0x7d, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81,
-  0x81, 0x81, 0x82, 0x81, 0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83,
-  0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x81, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x82, 0x83, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80, 0x82, 0x82,
-  0x83, 0x83, 0x83, 0x83, 0x81, 0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
-  0x85, 0x84, 0x82, 0x82, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7b, 0x7b, 0x7b,
-  0x7c, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d,
-  0x7c, 0x7c, 0x7d, 0x7e, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82,
-  0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83,
-  0x82, 0x82, 0x81, 0x82, 0x83, 0x84, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x83, 0x84, 0x83, 0x82, 0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7e,
-  0x7d, 0x7e, 0x7f, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x82, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x82, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x81,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x82, 0x82, 0x83, 0x82, 0x81, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7c, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x82, 0x83, 0x83, 0x83,
-  0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e, 0x80, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x82, 0x84, 0x84, 0x82,
-  0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x80, 0x81,
-  0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x82, 0x83,
-  0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x83, 0x82, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7f,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7f,
-  0x7e, 0x7c, 0x7b, 0x7a, 0x7c, 0x7d, 0x7e, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x80, 0x81, 0x80, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x7e, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x80,
-  0x81, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x82,
-  0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80,
-  0x80, 0x7e, 0x7e, 0x7f, 0x81, 0x83, 0x83, 0x82, 0x82, 0x81, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x7f, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7e,
-  0x7f, 0x82, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x81,
-  0x82, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f,
-  0x7f, 0x80, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x80, 0x82, 0x82,
-  0x83, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x81, 0x82, 0x81,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x7f, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x82, 0x83, 0x82,
-  0x81, 0x81, 0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x82, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82,
-  0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x80, 0x80, 0x81,
-  0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x81,
-  0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7e, 0x7e, 0x80,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d,
-  0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x7f, 0x7d, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7e,
-  0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81,
-  0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81, 0x82, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81,
-  0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x82,
-  0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x82,
-  0x83, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x80, 0x7e, 0x7e,
-  0x7e, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81,
-  0x82, 0x81, 0x81, 0x82, 0x82, 0x84, 0x84, 0x83, 0x82, 0x81, 0x82, 0x82,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x83, 0x82, 0x83, 0x83, 0x83, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x82,
-  0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x7f, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x83, 0x83,
-  0x83, 0x83, 0x82, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x80,
-  0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7e, 0x7d,
-  0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x83, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x80,
-  0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x82,
-  0x82, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-  0x81, 0x81, 0x7e, 0x7d, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x81, 0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x83, 0x83, 0x82, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x82, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x7e,
-  0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x83, 0x84, 0x82, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x7f, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-  0x80, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x80, 0x82, 0x82, 0x80, 0x80, 0x81, 0x82, 0x81, 0x82, 0x83,
-  0x83, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x84, 0x85, 0x83,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80, 0x81, 0x81,
-  0x81, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f,
-  0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x80,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80,
-  0x81, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x7f, 0x7e, 0x7f,
-  0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7f, 0x82, 0x82, 0x83, 0x82, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x82,
-  0x82, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x81, 0x84, 0x85, 0x83, 0x82,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x82, 0x81,
-  0x80, 0x7f, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x81, 0x7f, 0x7c, 0x7b,
-  0x7d, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7e, 0x7d,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7e, 0x80, 0x81,
-  0x80, 0x7e, 0x7c, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7f, 0x82, 0x82, 0x80, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7c,
-  0x7c, 0x7c, 0x7e, 0x81, 0x84, 0x85, 0x84, 0x82, 0x7f, 0x7e, 0x7f, 0x80,
-  0x80, 0x7f, 0x7e, 0x80, 0x7e, 0x7c, 0x7b, 0x7c, 0x7f, 0x82, 0x82, 0x81,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7d, 0x7e, 0x80,
-  0x7f, 0x7d, 0x7c, 0x7e, 0x7e, 0x7e, 0x7d, 0x7b, 0x7b, 0x7d, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7e, 0x80, 0x83, 0x83, 0x82, 0x7f,
-  0x7b, 0x79, 0x7b, 0x80, 0x82, 0x7f, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c,
-  0x7e, 0x80, 0x80, 0x80, 0x80, 0x82, 0x84, 0x83, 0x83, 0x83, 0x82, 0x81,
-  0x82, 0x84, 0x87, 0x89, 0x88, 0x86, 0x82, 0x7f, 0x7f, 0x80, 0x81, 0x81,
-  0x82, 0x84, 0x84, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x81,
-  0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x84, 0x84, 0x82, 0x7e, 0x7d, 0x7e,
-  0x81, 0x83, 0x84, 0x83, 0x83, 0x83, 0x83, 0x82, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x7c,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x81, 0x81, 0x84, 0x86, 0x85, 0x84, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x84, 0x85, 0x86, 0x88, 0x88, 0x87, 0x85, 0x84, 0x86,
-  0x86, 0x84, 0x82, 0x7f, 0x7d, 0x7b, 0x79, 0x79, 0x7a, 0x7a, 0x7c, 0x7e,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7f, 0x80, 0x7e, 0x7e,
-  0x80, 0x83, 0x85, 0x83, 0x81, 0x80, 0x82, 0x84, 0x84, 0x82, 0x7e, 0x7e,
-  0x80, 0x7f, 0x7d, 0x7b, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x83,
-  0x82, 0x81, 0x82, 0x82, 0x81, 0x7e, 0x7b, 0x7a, 0x7c, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7f, 0x81, 0x81, 0x80, 0x80, 0x82, 0x83, 0x84, 0x86,
-  0x86, 0x83, 0x7d, 0x79, 0x79, 0x7c, 0x7f, 0x81, 0x80, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x81, 0x7f, 0x80, 0x83, 0x86, 0x86, 0x83,
-  0x82, 0x82, 0x83, 0x82, 0x81, 0x80, 0x81, 0x82, 0x80, 0x7e, 0x80, 0x83,
-  0x83, 0x7e, 0x78, 0x76, 0x79, 0x7e, 0x80, 0x7e, 0x7b, 0x7d, 0x80, 0x80,
-  0x7c, 0x7a, 0x7c, 0x7e, 0x7f, 0x7d, 0x7d, 0x81, 0x82, 0x81, 0x7e, 0x7b,
-  0x7c, 0x7f, 0x80, 0x7e, 0x7c, 0x7b, 0x7c, 0x7e, 0x82, 0x85, 0x86, 0x83,
-  0x7c, 0x7b, 0x80, 0x86, 0x86, 0x82, 0x7f, 0x80, 0x7f, 0x7c, 0x7a, 0x7c,
-  0x80, 0x80, 0x7d, 0x7b, 0x7e, 0x82, 0x81, 0x7c, 0x7a, 0x7c, 0x7e, 0x7e,
-  0x7e, 0x80, 0x83, 0x83, 0x7e, 0x7b, 0x7b, 0x7e, 0x81, 0x80, 0x7f, 0x80,
-  0x7f, 0x7e, 0x80, 0x82, 0x81, 0x7f, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7d, 0x7c, 0x7e, 0x80, 0x82, 0x82, 0x7f,
-  0x7c, 0x7a, 0x7a, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x82, 0x87, 0x8a, 0x89,
-  0x84, 0x7e, 0x7c, 0x7f, 0x83, 0x85, 0x82, 0x7e, 0x7c, 0x7c, 0x7e, 0x7c,
-  0x7a, 0x78, 0x7c, 0x81, 0x82, 0x80, 0x7c, 0x7d, 0x7e, 0x7e, 0x7c, 0x7b,
-  0x7e, 0x83, 0x85, 0x82, 0x7c, 0x7a, 0x7d, 0x82, 0x84, 0x83, 0x81, 0x7f,
-  0x80, 0x81, 0x82, 0x81, 0x7e, 0x7b, 0x7c, 0x7e, 0x80, 0x80, 0x82, 0x83,
-  0x82, 0x80, 0x7f, 0x82, 0x84, 0x84, 0x84, 0x85, 0x86, 0x86, 0x85, 0x84,
-  0x84, 0x84, 0x84, 0x85, 0x85, 0x83, 0x81, 0x80, 0x80, 0x82, 0x87, 0x89,
-  0x88, 0x86, 0x88, 0x8c, 0x8b, 0x86, 0x80, 0x7c, 0x7c, 0x7e, 0x80, 0x80,
-  0x7e, 0x7c, 0x7b, 0x7b, 0x7b, 0x7d, 0x80, 0x81, 0x7e, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x7d, 0x7a, 0x7a, 0x7f, 0x85, 0x87, 0x85, 0x81, 0x7e, 0x7e, 0x81,
-  0x84, 0x84, 0x82, 0x80, 0x81, 0x84, 0x85, 0x85, 0x84, 0x84, 0x83, 0x81,
-  0x7e, 0x7e, 0x83, 0x87, 0x87, 0x83, 0x7d, 0x7c, 0x7c, 0x78, 0x75, 0x7a,
-  0x83, 0x84, 0x7f, 0x7a, 0x7c, 0x80, 0x7e, 0x7a, 0x7a, 0x7a, 0x7a, 0x79,
-  0x7b, 0x81, 0x88, 0x8b, 0x8b, 0x87, 0x83, 0x7f, 0x7d, 0x7d, 0x81, 0x85,
-  0x86, 0x84, 0x83, 0x84, 0x84, 0x80, 0x7c, 0x7c, 0x81, 0x84, 0x83, 0x83,
-  0x84, 0x81, 0x7a, 0x72, 0x72, 0x7b, 0x84, 0x85, 0x7e, 0x78, 0x77, 0x77,
-  0x76, 0x76, 0x7b, 0x83, 0x85, 0x81, 0x7c, 0x7b, 0x7c, 0x7c, 0x7d, 0x81,
-  0x87, 0x8b, 0x87, 0x81, 0x7d, 0x7d, 0x7f, 0x7f, 0x7e, 0x7f, 0x82, 0x84,
-  0x85, 0x82, 0x80, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7c,
-  0x81, 0x85, 0x87, 0x89, 0x87, 0x81, 0x7c, 0x7a, 0x7c, 0x80, 0x81, 0x7e,
-  0x7c, 0x7a, 0x79, 0x7a, 0x7a, 0x78, 0x75, 0x75, 0x78, 0x7c, 0x7e, 0x7d,
-  0x7b, 0x7c, 0x7d, 0x7c, 0x7b, 0x7d, 0x83, 0x87, 0x84, 0x7b, 0x76, 0x77,
-  0x7e, 0x83, 0x80, 0x7b, 0x7a, 0x79, 0x78, 0x7a, 0x7e, 0x82, 0x85, 0x85,
-  0x84, 0x82, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x80, 0x83, 0x83, 0x80, 0x7c,
-  0x7c, 0x81, 0x85, 0x86, 0x87, 0x84, 0x7e, 0x7c, 0x7c, 0x7d, 0x7b, 0x7a,
-  0x7c, 0x81, 0x84, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x81, 0x85, 0x87, 0x82,
-  0x7d, 0x7e, 0x81, 0x80, 0x7d, 0x7a, 0x78, 0x7c, 0x84, 0x8b, 0x8b, 0x88,
-  0x84, 0x84, 0x84, 0x80, 0x7b, 0x7c, 0x83, 0x8a, 0x8b, 0x89, 0x85, 0x83,
-  0x83, 0x81, 0x7d, 0x7a, 0x7b, 0x82, 0x89, 0x8a, 0x86, 0x7e, 0x77, 0x76,
-  0x79, 0x7c, 0x7b, 0x79, 0x7a, 0x7e, 0x81, 0x80, 0x7d, 0x7e, 0x80, 0x7f,
-  0x80, 0x83, 0x86, 0x85, 0x80, 0x7d, 0x80, 0x85, 0x89, 0x8b, 0x8a, 0x84,
-  0x7f, 0x7e, 0x81, 0x85, 0x88, 0x87, 0x82, 0x7c, 0x7a, 0x7e, 0x84, 0x88,
-  0x88, 0x86, 0x83, 0x82, 0x82, 0x82, 0x7f, 0x7d, 0x7e, 0x81, 0x81, 0x7e,
-  0x7b, 0x7a, 0x7a, 0x79, 0x78, 0x7a, 0x7d, 0x7e, 0x7c, 0x7b, 0x7c, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x81, 0x87, 0x8c, 0x86, 0x7a, 0x74, 0x7a, 0x86, 0x8b,
-  0x86, 0x81, 0x7f, 0x7e, 0x7d, 0x7c, 0x7e, 0x85, 0x8a, 0x87, 0x7f, 0x7a,
-  0x78, 0x78, 0x79, 0x7a, 0x7c, 0x7f, 0x81, 0x80, 0x7e, 0x7e, 0x81, 0x81,
-  0x7c, 0x7a, 0x7b, 0x7e, 0x81, 0x7f, 0x7b, 0x7a, 0x7e, 0x84, 0x85, 0x83,
-  0x7d, 0x7a, 0x7e, 0x84, 0x88, 0x86, 0x83, 0x83, 0x84, 0x85, 0x84, 0x82,
-  0x7f, 0x7c, 0x7b, 0x80, 0x87, 0x89, 0x83, 0x7b, 0x79, 0x7c, 0x7e, 0x80,
-  0x83, 0x84, 0x84, 0x82, 0x7e, 0x7d, 0x7f, 0x80, 0x7f, 0x7c, 0x79, 0x77,
-  0x79, 0x7e, 0x82, 0x85, 0x87, 0x85, 0x81, 0x80, 0x82, 0x84, 0x82, 0x7e,
-  0x7a, 0x78, 0x7a, 0x7e, 0x81, 0x81, 0x7f, 0x7e, 0x80, 0x80, 0x7c, 0x7a,
-  0x7b, 0x7e, 0x83, 0x87, 0x85, 0x80, 0x7e, 0x83, 0x86, 0x83, 0x7e, 0x80,
-  0x84, 0x86, 0x85, 0x81, 0x7d, 0x7a, 0x7c, 0x82, 0x86, 0x85, 0x7e, 0x78,
-  0x76, 0x78, 0x7a, 0x7b, 0x7b, 0x7a, 0x7b, 0x7e, 0x82, 0x82, 0x7e, 0x7b,
-  0x7e, 0x87, 0x8e, 0x8b, 0x83, 0x7d, 0x82, 0x89, 0x89, 0x81, 0x7c, 0x7e,
-  0x86, 0x88, 0x87, 0x87, 0x86, 0x81, 0x7d, 0x7e, 0x83, 0x85, 0x82, 0x7c,
-  0x7b, 0x7c, 0x7c, 0x78, 0x76, 0x77, 0x7a, 0x7a, 0x78, 0x76, 0x76, 0x7d,
-  0x87, 0x8a, 0x83, 0x7c, 0x7d, 0x86, 0x8c, 0x88, 0x80, 0x7b, 0x80, 0x84,
-  0x85, 0x84, 0x85, 0x86, 0x84, 0x7e, 0x7c, 0x7f, 0x87, 0x8a, 0x87, 0x7f,
-  0x78, 0x76, 0x79, 0x7d, 0x7e, 0x7a, 0x78, 0x76, 0x78, 0x81, 0x88, 0x88,
-  0x80, 0x7b, 0x81, 0x90, 0x96, 0x8a, 0x7a, 0x79, 0x83, 0x86, 0x7e, 0x77,
-  0x7a, 0x82, 0x83, 0x81, 0x83, 0x86, 0x86, 0x80, 0x7b, 0x7a, 0x80, 0x84,
-  0x83, 0x7e, 0x76, 0x74, 0x77, 0x7b, 0x7b, 0x7c, 0x84, 0x8e, 0x8a, 0x7c,
-  0x76, 0x80, 0x8d, 0x8d, 0x80, 0x78, 0x7d, 0x87, 0x86, 0x79, 0x6e, 0x73,
-  0x86, 0x98, 0x99, 0x8e, 0x82, 0x81, 0x84, 0x83, 0x7d, 0x78, 0x79, 0x7c,
-  0x7e, 0x7a, 0x76, 0x73, 0x70, 0x72, 0x7a, 0x85, 0x8b, 0x8b, 0x84, 0x7b,
-  0x7b, 0x82, 0x84, 0x82, 0x7d, 0x7b, 0x7c, 0x7e, 0x80, 0x7e, 0x7f, 0x81,
-  0x82, 0x81, 0x83, 0x82, 0x80, 0x7f, 0x82, 0x84, 0x86, 0x86, 0x82, 0x7e,
-  0x83, 0x89, 0x86, 0x7d, 0x7a, 0x80, 0x88, 0x89, 0x83, 0x7c, 0x7b, 0x7d,
-  0x7c, 0x7a, 0x7c, 0x80, 0x84, 0x84, 0x7c, 0x74, 0x73, 0x77, 0x7a, 0x79,
-  0x7a, 0x82, 0x86, 0x7f, 0x76, 0x75, 0x7c, 0x82, 0x85, 0x87, 0x8a, 0x89,
-  0x84, 0x7d, 0x7e, 0x86, 0x8e, 0x8c, 0x83, 0x81, 0x86, 0x86, 0x7f, 0x79,
-  0x79, 0x80, 0x83, 0x81, 0x7d, 0x7d, 0x7b, 0x77, 0x76, 0x79, 0x7c, 0x7c,
-  0x7a, 0x7b, 0x81, 0x87, 0x86, 0x80, 0x80, 0x80, 0x7c, 0x78, 0x79, 0x80,
-  0x87, 0x89, 0x83, 0x7c, 0x7b, 0x7c, 0x7c, 0x7e, 0x83, 0x85, 0x84, 0x81,
-  0x7f, 0x80, 0x81, 0x7f, 0x7d, 0x7e, 0x82, 0x83, 0x82, 0x7d, 0x76, 0x73,
-  0x78, 0x7e, 0x80, 0x80, 0x82, 0x87, 0x88, 0x83, 0x80, 0x83, 0x88, 0x86,
-  0x7e, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a, 0x78, 0x79, 0x7a, 0x7c, 0x7e, 0x80,
-  0x7e, 0x7c, 0x7d, 0x81, 0x86, 0x8b, 0x8d, 0x8a, 0x83, 0x81, 0x84, 0x84,
-  0x81, 0x7d, 0x7d, 0x7e, 0x7d, 0x7c, 0x7c, 0x80, 0x83, 0x81, 0x7c, 0x77,
-  0x78, 0x7d, 0x7f, 0x7b, 0x76, 0x77, 0x7e, 0x82, 0x80, 0x7c, 0x7e, 0x81,
-  0x80, 0x7b, 0x7c, 0x84, 0x8a, 0x8a, 0x83, 0x7e, 0x82, 0x85, 0x84, 0x80,
-  0x7e, 0x7e, 0x80, 0x84, 0x8a, 0x8e, 0x8d, 0x88, 0x85, 0x82, 0x7c, 0x79,
-  0x7c, 0x84, 0x88, 0x86, 0x80, 0x7f, 0x80, 0x7f, 0x81, 0x83, 0x83, 0x7e,
-  0x7b, 0x7e, 0x80, 0x7d, 0x79, 0x7c, 0x84, 0x8a, 0x82, 0x75, 0x74, 0x7e,
-  0x86, 0x83, 0x7b, 0x79, 0x7d, 0x81, 0x80, 0x7e, 0x7e, 0x82, 0x81, 0x7d,
-  0x7e, 0x86, 0x8a, 0x88, 0x83, 0x82, 0x7e, 0x79, 0x77, 0x79, 0x7d, 0x7f,
-  0x82, 0x89, 0x8c, 0x83, 0x76, 0x75, 0x7f, 0x88, 0x88, 0x80, 0x79, 0x78,
-  0x7c, 0x83, 0x86, 0x81, 0x7a, 0x77, 0x7c, 0x82, 0x84, 0x80, 0x7e, 0x81,
-  0x83, 0x7f, 0x7b, 0x7c, 0x82, 0x86, 0x82, 0x7b, 0x7c, 0x84, 0x89, 0x85,
-  0x7c, 0x79, 0x7d, 0x81, 0x7f, 0x7c, 0x7b, 0x7c, 0x7f, 0x83, 0x87, 0x8d,
-  0x91, 0x89, 0x77, 0x70, 0x7d, 0x8c, 0x8a, 0x79, 0x70, 0x7a, 0x88, 0x87,
-  0x7e, 0x7c, 0x84, 0x88, 0x83, 0x7a, 0x75, 0x76, 0x74, 0x73, 0x77, 0x81,
-  0x89, 0x8c, 0x8c, 0x84, 0x75, 0x70, 0x7c, 0x8b, 0x8c, 0x7b, 0x6d, 0x74,
-  0x87, 0x8d, 0x84, 0x7b, 0x79, 0x7a, 0x7a, 0x77, 0x76, 0x78, 0x7e, 0x83,
-  0x80, 0x7b, 0x80, 0x8c, 0x92, 0x86, 0x76, 0x77, 0x88, 0x91, 0x84, 0x73,
-  0x78, 0x89, 0x90, 0x84, 0x75, 0x73, 0x7c, 0x80, 0x7c, 0x78, 0x7c, 0x85,
-  0x8c, 0x8b, 0x87, 0x81, 0x78, 0x71, 0x72, 0x7c, 0x8a, 0x8f, 0x8b, 0x85,
-  0x82, 0x80, 0x7c, 0x7b, 0x80, 0x85, 0x83, 0x7e, 0x7e, 0x85, 0x89, 0x83,
-  0x78, 0x73, 0x76, 0x7b, 0x7e, 0x7d, 0x7b, 0x79, 0x7a, 0x81, 0x87, 0x88,
-  0x87, 0x85, 0x83, 0x83, 0x86, 0x87, 0x84, 0x80, 0x7e, 0x82, 0x86, 0x87,
-  0x86, 0x83, 0x80, 0x7e, 0x7e, 0x7e, 0x7a, 0x74, 0x72, 0x75, 0x7b, 0x86,
-  0x8e, 0x87, 0x77, 0x72, 0x81, 0x94, 0x94, 0x80, 0x6f, 0x73, 0x80, 0x85,
-  0x80, 0x7c, 0x7e, 0x83, 0x87, 0x84, 0x7e, 0x7d, 0x7e, 0x7d, 0x78, 0x77,
-  0x7d, 0x86, 0x90, 0x8e, 0x82, 0x7b, 0x7d, 0x84, 0x88, 0x8b, 0x88, 0x84,
-  0x82, 0x84, 0x83, 0x80, 0x80, 0x82, 0x86, 0x85, 0x80, 0x7a, 0x78, 0x7c,
-  0x81, 0x83, 0x84, 0x83, 0x82, 0x83, 0x85, 0x82, 0x7e, 0x79, 0x7b, 0x81,
-  0x84, 0x82, 0x7d, 0x7b, 0x7b, 0x7b, 0x7a, 0x7b, 0x7f, 0x83, 0x84, 0x83,
-  0x82, 0x82, 0x81, 0x81, 0x82, 0x83, 0x82, 0x7d, 0x7b, 0x80, 0x87, 0x89,
-  0x86, 0x81, 0x7b, 0x73, 0x6f, 0x74, 0x7c, 0x80, 0x82, 0x8a, 0x92, 0x90,
-  0x84, 0x7c, 0x7d, 0x7f, 0x7d, 0x79, 0x7c, 0x87, 0x90, 0x90, 0x84, 0x7a,
-  0x7c, 0x82, 0x80, 0x78, 0x75, 0x79, 0x80, 0x85, 0x86, 0x84, 0x7b, 0x71,
-  0x6e, 0x76, 0x80, 0x86, 0x87, 0x86, 0x83, 0x82, 0x83, 0x83, 0x7e, 0x76,
-  0x75, 0x7d, 0x84, 0x82, 0x79, 0x74, 0x7b, 0x85, 0x8b, 0x8d, 0x8c, 0x82,
-  0x78, 0x78, 0x84, 0x8a, 0x80, 0x74, 0x70, 0x75, 0x7a, 0x7e, 0x82, 0x84,
-  0x80, 0x7a, 0x7b, 0x7e, 0x80, 0x7d, 0x78, 0x74, 0x71, 0x74, 0x78, 0x7d,
-  0x80, 0x7f, 0x7a, 0x79, 0x7b, 0x7d, 0x7d, 0x7e, 0x80, 0x7d, 0x77, 0x72,
-  0x74, 0x7f, 0x8b, 0x8f, 0x89, 0x83, 0x85, 0x88, 0x85, 0x83, 0x88, 0x8c,
-  0x89, 0x7f, 0x78, 0x76, 0x76, 0x6e, 0x63, 0x64, 0x77, 0x93, 0xa1, 0x9c,
-  0x8a, 0x75, 0x6f, 0x77, 0x80, 0x83, 0x81, 0x7a, 0x76, 0x78, 0x7c, 0x80,
-  0x82, 0x81, 0x7e, 0x7e, 0x82, 0x86, 0x85, 0x7f, 0x77, 0x74, 0x79, 0x81,
-  0x82, 0x7c, 0x77, 0x7a, 0x7e, 0x7c, 0x77, 0x79, 0x85, 0x90, 0x8e, 0x80,
-  0x74, 0x76, 0x7d, 0x83, 0x82, 0x86, 0x8f, 0x95, 0x90, 0x84, 0x7a, 0x74,
-  0x77, 0x7e, 0x83, 0x83, 0x81, 0x82, 0x86, 0x87, 0x83, 0x7c, 0x77, 0x77,
-  0x79, 0x7d, 0x80, 0x83, 0x87, 0x8a, 0x88, 0x82, 0x7c, 0x77, 0x75, 0x76,
-  0x7d, 0x88, 0x92, 0x92, 0x84, 0x74, 0x71, 0x7a, 0x81, 0x82, 0x82, 0x82,
-  0x86, 0x8a, 0x88, 0x82, 0x7c, 0x7e, 0x81, 0x82, 0x88, 0x90, 0x8b, 0x7b,
-  0x74, 0x7c, 0x87, 0x8a, 0x88, 0x87, 0x85, 0x80, 0x7c, 0x7b, 0x83, 0x86,
-  0x83, 0x82, 0x85, 0x8b, 0x8d, 0x85, 0x77, 0x6e, 0x75, 0x84, 0x8b, 0x88,
-  0x82, 0x7f, 0x81, 0x82, 0x7e, 0x7e, 0x81, 0x82, 0x81, 0x7c, 0x79, 0x7a,
-  0x84, 0x8d, 0x89, 0x80, 0x80, 0x84, 0x7e, 0x73, 0x70, 0x7c, 0x8e, 0x94,
-  0x8c, 0x82, 0x82, 0x82, 0x7e, 0x79, 0x7a, 0x80, 0x83, 0x80, 0x7d, 0x80,
-  0x82, 0x83, 0x85, 0x87, 0x83, 0x7a, 0x73, 0x75, 0x7c, 0x81, 0x82, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7b, 0x7a, 0x7b, 0x7e, 0x7c, 0x77, 0x7a, 0x84, 0x8a,
-  0x89, 0x85, 0x86, 0x86, 0x81, 0x79, 0x78, 0x7b, 0x7f, 0x7e, 0x7d, 0x82,
-  0x89, 0x8e, 0x8d, 0x86, 0x7e, 0x7c, 0x82, 0x87, 0x88, 0x84, 0x80, 0x7a,
-  0x78, 0x78, 0x79, 0x7d, 0x84, 0x84, 0x7f, 0x7d, 0x7c, 0x7d, 0x7c, 0x78,
-  0x73, 0x75, 0x7a, 0x80, 0x84, 0x87, 0x88, 0x86, 0x80, 0x7b, 0x7c, 0x80,
-  0x7d, 0x78, 0x79, 0x84, 0x8e, 0x8c, 0x80, 0x79, 0x7a, 0x80, 0x7f, 0x7a,
-  0x79, 0x7e, 0x86, 0x89, 0x85, 0x86, 0x89, 0x83, 0x77, 0x71, 0x7a, 0x8b,
-  0x90, 0x87, 0x7c, 0x7d, 0x84, 0x80, 0x75, 0x71, 0x79, 0x84, 0x89, 0x8d,
-  0x8e, 0x84, 0x75, 0x6f, 0x74, 0x7a, 0x7d, 0x80, 0x87, 0x8d, 0x8e, 0x87,
-  0x80, 0x7c, 0x78, 0x77, 0x7d, 0x86, 0x87, 0x7e, 0x76, 0x78, 0x7f, 0x7e,
-  0x77, 0x74, 0x7b, 0x83, 0x83, 0x82, 0x87, 0x8c, 0x86, 0x7a, 0x77, 0x7d,
-  0x81, 0x7e, 0x7d, 0x80, 0x84, 0x83, 0x7f, 0x7e, 0x7f, 0x7e, 0x7d, 0x7b,
-  0x79, 0x7a, 0x7f, 0x85, 0x8a, 0x8d, 0x89, 0x84, 0x81, 0x7f, 0x7d, 0x7b,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x82, 0x85, 0x80, 0x79, 0x78, 0x7b, 0x7e, 0x81,
-  0x87, 0x8e, 0x8f, 0x87, 0x7d, 0x7f, 0x8b, 0x93, 0x8e, 0x84, 0x7b, 0x7a,
-  0x7e, 0x83, 0x85, 0x84, 0x83, 0x7f, 0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7b,
-  0x7c, 0x81, 0x82, 0x7e, 0x78, 0x76, 0x7a, 0x7f, 0x80, 0x7d, 0x7b, 0x7c,
-  0x7f, 0x80, 0x7d, 0x7c, 0x7e, 0x81, 0x80, 0x7e, 0x7f, 0x86, 0x8b, 0x8c,
-  0x89, 0x83, 0x7e, 0x7d, 0x82, 0x87, 0x88, 0x82, 0x7a, 0x77, 0x7b, 0x7e,
-  0x7e, 0x80, 0x82, 0x81, 0x7c, 0x79, 0x7a, 0x7a, 0x7b, 0x7d, 0x7e, 0x7d,
-  0x7e, 0x80, 0x7d, 0x77, 0x70, 0x6d, 0x71, 0x7b, 0x82, 0x81, 0x7c, 0x7d,
-  0x84, 0x87, 0x82, 0x7c, 0x7d, 0x7f, 0x7e, 0x7b, 0x7a, 0x7b, 0x7d, 0x7f,
-  0x7f, 0x82, 0x87, 0x89, 0x86, 0x80, 0x79, 0x79, 0x7f, 0x86, 0x8a, 0x89,
-  0x82, 0x7c, 0x81, 0x89, 0x8a, 0x7e, 0x72, 0x72, 0x7d, 0x86, 0x82, 0x75,
-  0x6f, 0x76, 0x7f, 0x84, 0x81, 0x7e, 0x7d, 0x80, 0x82, 0x82, 0x7e, 0x77,
-  0x73, 0x74, 0x7e, 0x8b, 0x8b, 0x80, 0x77, 0x7c, 0x88, 0x8e, 0x89, 0x80,
-  0x7c, 0x7d, 0x83, 0x8a, 0x8b, 0x84, 0x7a, 0x75, 0x77, 0x79, 0x79, 0x79,
-  0x7e, 0x84, 0x87, 0x87, 0x83, 0x7f, 0x7b, 0x7a, 0x7a, 0x7e, 0x80, 0x81,
-  0x7f, 0x7e, 0x7e, 0x82, 0x85, 0x84, 0x80, 0x7b, 0x79, 0x7c, 0x7d, 0x7d,
-  0x7f, 0x82, 0x80, 0x7d, 0x7e, 0x7f, 0x7d, 0x7c, 0x7d, 0x82, 0x88, 0x90,
-  0x92, 0x88, 0x79, 0x74, 0x7a, 0x83, 0x82, 0x77, 0x6e, 0x70, 0x7a, 0x81,
-  0x83, 0x85, 0x89, 0x8b, 0x87, 0x80, 0x7c, 0x7e, 0x7e, 0x81, 0x84, 0x85,
-  0x83, 0x80, 0x79, 0x76, 0x77, 0x7a, 0x7f, 0x86, 0x8a, 0x87, 0x83, 0x81,
-  0x80, 0x80, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7f, 0x83,
-  0x84, 0x85, 0x86, 0x85, 0x81, 0x7b, 0x78, 0x7a, 0x83, 0x8a, 0x88, 0x80,
-  0x78, 0x79, 0x83, 0x89, 0x85, 0x7d, 0x79, 0x7c, 0x81, 0x84, 0x84, 0x85,
-  0x86, 0x83, 0x81, 0x81, 0x83, 0x82, 0x80, 0x7d, 0x7d, 0x82, 0x84, 0x83,
-  0x7d, 0x7a, 0x7c, 0x80, 0x83, 0x82, 0x7d, 0x79, 0x7d, 0x85, 0x85, 0x79,
-  0x71, 0x79, 0x89, 0x91, 0x8a, 0x7e, 0x7c, 0x82, 0x85, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x83, 0x82, 0x7f, 0x80,
-  0x84, 0x89, 0x8b, 0x88, 0x7f, 0x7b, 0x7f, 0x82, 0x83, 0x83, 0x81, 0x80,
-  0x7f, 0x7e, 0x7a, 0x78, 0x7c, 0x84, 0x8b, 0x89, 0x82, 0x80, 0x85, 0x87,
-  0x83, 0x7e, 0x7d, 0x80, 0x7f, 0x79, 0x7a, 0x81, 0x84, 0x80, 0x7b, 0x7c,
-  0x80, 0x7c, 0x75, 0x75, 0x7c, 0x82, 0x81, 0x82, 0x82, 0x7d, 0x77, 0x75,
-  0x79, 0x7c, 0x7a, 0x7a, 0x80, 0x89, 0x8d, 0x8a, 0x81, 0x7c, 0x80, 0x83,
-  0x7f, 0x7a, 0x79, 0x81, 0x8b, 0x8d, 0x84, 0x7c, 0x7c, 0x80, 0x80, 0x79,
-  0x74, 0x7b, 0x88, 0x90, 0x8b, 0x84, 0x82, 0x84, 0x82, 0x7c, 0x7b, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x81, 0x83, 0x80, 0x80, 0x84, 0x86, 0x84, 0x7e, 0x7a,
-  0x7a, 0x7e, 0x80, 0x7e, 0x80, 0x86, 0x8d, 0x8e, 0x87, 0x7e, 0x7e, 0x80,
-  0x7d, 0x79, 0x7a, 0x81, 0x88, 0x8b, 0x87, 0x7d, 0x72, 0x6a, 0x6b, 0x75,
-  0x81, 0x8a, 0x8c, 0x87, 0x83, 0x88, 0x90, 0x8a, 0x74, 0x64, 0x6b, 0x80,
-  0x8c, 0x8a, 0x82, 0x7e, 0x7f, 0x84, 0x86, 0x85, 0x80, 0x7f, 0x84, 0x8a,
-  0x88, 0x7e, 0x7d, 0x84, 0x87, 0x84, 0x81, 0x84, 0x8a, 0x8b, 0x86, 0x7f,
-  0x7b, 0x7b, 0x7c, 0x7e, 0x83, 0x87, 0x87, 0x84, 0x80, 0x83, 0x8b, 0x8e,
-  0x85, 0x78, 0x76, 0x7b, 0x7e, 0x7c, 0x78, 0x73, 0x75, 0x7d, 0x84, 0x85,
-  0x81, 0x80, 0x81, 0x81, 0x7d, 0x7a, 0x7b, 0x7f, 0x7f, 0x7b, 0x78, 0x7c,
-  0x83, 0x87, 0x84, 0x7f, 0x81, 0x83, 0x80, 0x7e, 0x88, 0x95, 0x90, 0x7c,
-  0x70, 0x78, 0x82, 0x80, 0x76, 0x72, 0x76, 0x7e, 0x81, 0x80, 0x7f, 0x81,
-  0x83, 0x84, 0x81, 0x80, 0x84, 0x88, 0x82, 0x75, 0x73, 0x7d, 0x85, 0x82,
-  0x7e, 0x81, 0x84, 0x7e, 0x72, 0x6d, 0x74, 0x80, 0x86, 0x80, 0x79, 0x7b,
-  0x7e, 0x7e, 0x7c, 0x7c, 0x7e, 0x7e, 0x7c, 0x7a, 0x7a, 0x7c, 0x7c, 0x7b,
-  0x7a, 0x7b, 0x7f, 0x82, 0x7d, 0x77, 0x78, 0x7f, 0x84, 0x83, 0x80, 0x7e,
-  0x80, 0x7e, 0x7c, 0x7e, 0x80, 0x7c, 0x75, 0x74, 0x7c, 0x85, 0x84, 0x7f,
-  0x7d, 0x84, 0x8e, 0x8e, 0x86, 0x7f, 0x7e, 0x81, 0x80, 0x7c, 0x7d, 0x81,
-  0x7e, 0x79, 0x7a, 0x84, 0x8e, 0x8a, 0x7c, 0x76, 0x7e, 0x86, 0x84, 0x7d,
-  0x79, 0x7c, 0x80, 0x7e, 0x78, 0x74, 0x77, 0x85, 0x90, 0x8d, 0x7e, 0x74,
-  0x76, 0x81, 0x86, 0x7c, 0x70, 0x74, 0x83, 0x8b, 0x88, 0x7f, 0x76, 0x72,
-  0x75, 0x7c, 0x82, 0x80, 0x79, 0x74, 0x7a, 0x84, 0x8b, 0x8b, 0x85, 0x7e,
-  0x7e, 0x84, 0x86, 0x82, 0x7d, 0x7c, 0x7e, 0x7f, 0x7e, 0x7b, 0x79, 0x7c,
-  0x83, 0x88, 0x8a, 0x87, 0x87, 0x8b, 0x8c, 0x88, 0x83, 0x81, 0x80, 0x81,
-  0x80, 0x7c, 0x7a, 0x7e, 0x86, 0x8a, 0x87, 0x81, 0x7d, 0x7c, 0x80, 0x85,
-  0x87, 0x82, 0x78, 0x72, 0x72, 0x77, 0x7e, 0x82, 0x85, 0x88, 0x88, 0x7f,
-  0x74, 0x70, 0x76, 0x80, 0x88, 0x8a, 0x87, 0x81, 0x7b, 0x7e, 0x87, 0x8d,
-  0x88, 0x7d, 0x77, 0x7a, 0x81, 0x87, 0x89, 0x87, 0x84, 0x82, 0x81, 0x83,
-  0x83, 0x83, 0x84, 0x84, 0x84, 0x80, 0x7c, 0x7a, 0x7b, 0x7e, 0x84, 0x89,
-  0x86, 0x7d, 0x7b, 0x81, 0x85, 0x81, 0x79, 0x76, 0x78, 0x7c, 0x83, 0x89,
-  0x89, 0x82, 0x7c, 0x80, 0x86, 0x86, 0x7e, 0x77, 0x79, 0x83, 0x8d, 0x8e,
-  0x85, 0x7a, 0x78, 0x7e, 0x80, 0x7d, 0x7b, 0x80, 0x88, 0x8c, 0x86, 0x7e,
-  0x80, 0x85, 0x86, 0x81, 0x81, 0x84, 0x80, 0x75, 0x71, 0x78, 0x7f, 0x7f,
-  0x7e, 0x82, 0x89, 0x8d, 0x87, 0x79, 0x72, 0x7a, 0x85, 0x84, 0x7b, 0x78,
-  0x7b, 0x7d, 0x7c, 0x7a, 0x7c, 0x84, 0x88, 0x83, 0x7c, 0x7e, 0x82, 0x7e,
-  0x76, 0x71, 0x72, 0x7a, 0x82, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7e, 0x7b,
-  0x7a, 0x7e, 0x80, 0x80, 0x80, 0x82, 0x82, 0x83, 0x88, 0x8a, 0x81, 0x73,
-  0x72, 0x7d, 0x86, 0x81, 0x77, 0x78, 0x83, 0x8a, 0x85, 0x7b, 0x78, 0x7c,
-  0x81, 0x83, 0x81, 0x7c, 0x78, 0x7a, 0x82, 0x84, 0x7d, 0x75, 0x78, 0x81,
-  0x84, 0x80, 0x7e, 0x82, 0x85, 0x82, 0x7c, 0x78, 0x78, 0x7b, 0x7f, 0x86,
-  0x8c, 0x87, 0x7e, 0x7e, 0x84, 0x86, 0x7f, 0x77, 0x77, 0x7d, 0x81, 0x7e,
-  0x7b, 0x7f, 0x88, 0x8c, 0x87, 0x84, 0x85, 0x86, 0x82, 0x7f, 0x81, 0x85,
-  0x82, 0x7a, 0x75, 0x77, 0x7e, 0x86, 0x8a, 0x8a, 0x83, 0x7d, 0x7c, 0x80,
-  0x84, 0x86, 0x85, 0x81, 0x7a, 0x76, 0x79, 0x82, 0x85, 0x80, 0x7a, 0x7a,
-  0x81, 0x86, 0x87, 0x82, 0x79, 0x72, 0x73, 0x7c, 0x85, 0x87, 0x80, 0x76,
-  0x74, 0x80, 0x8c, 0x8a, 0x7e, 0x78, 0x7e, 0x86, 0x87, 0x80, 0x7a, 0x7e,
-  0x83, 0x82, 0x80, 0x83, 0x8a, 0x8c, 0x87, 0x81, 0x7f, 0x83, 0x87, 0x85,
-  0x7f, 0x7e, 0x83, 0x85, 0x84, 0x80, 0x7a, 0x78, 0x7e, 0x86, 0x8c, 0x8c,
-  0x84, 0x7b, 0x79, 0x80, 0x86, 0x84, 0x7e, 0x7b, 0x79, 0x77, 0x78, 0x79,
-  0x7a, 0x7f, 0x7f, 0x79, 0x76, 0x79, 0x81, 0x88, 0x86, 0x7e, 0x7a, 0x7e,
-  0x88, 0x8b, 0x81, 0x75, 0x76, 0x84, 0x8c, 0x85, 0x79, 0x75, 0x7c, 0x82,
-  0x82, 0x80, 0x7e, 0x80, 0x87, 0x8a, 0x84, 0x7e, 0x7f, 0x84, 0x86, 0x82,
-  0x7b, 0x7a, 0x7e, 0x81, 0x7e, 0x7a, 0x7a, 0x7d, 0x82, 0x83, 0x7e, 0x76,
-  0x74, 0x7c, 0x84, 0x87, 0x88, 0x85, 0x82, 0x7f, 0x7c, 0x7b, 0x7f, 0x84,
-  0x85, 0x82, 0x7d, 0x7c, 0x84, 0x8a, 0x87, 0x7e, 0x7a, 0x7d, 0x83, 0x85,
-  0x82, 0x7e, 0x7c, 0x7c, 0x7f, 0x83, 0x85, 0x85, 0x83, 0x80, 0x7d, 0x7b,
-  0x7a, 0x7a, 0x7b, 0x7b, 0x7a, 0x7a, 0x7e, 0x80, 0x7e, 0x82, 0x8a, 0x90,
-  0x8d, 0x82, 0x77, 0x76, 0x7d, 0x83, 0x82, 0x7c, 0x78, 0x7d, 0x84, 0x83,
-  0x80, 0x83, 0x87, 0x82, 0x7a, 0x7d, 0x85, 0x87, 0x85, 0x80, 0x7c, 0x7d,
-  0x81, 0x81, 0x7d, 0x7a, 0x7a, 0x7d, 0x80, 0x7e, 0x7b, 0x7d, 0x85, 0x8a,
-  0x86, 0x78, 0x72, 0x7c, 0x8b, 0x8c, 0x81, 0x79, 0x7d, 0x82, 0x7e, 0x78,
-  0x75, 0x7a, 0x84, 0x88, 0x85, 0x85, 0x8c, 0x8e, 0x84, 0x79, 0x7a, 0x81,
-  0x84, 0x7f, 0x79, 0x77, 0x78, 0x7c, 0x82, 0x87, 0x8a, 0x8a, 0x87, 0x82,
-  0x7b, 0x79, 0x7b, 0x7e, 0x7c, 0x78, 0x77, 0x7c, 0x80, 0x7e, 0x79, 0x76,
-  0x78, 0x7f, 0x89, 0x90, 0x90, 0x87, 0x80, 0x7f, 0x81, 0x80, 0x7c, 0x75,
-  0x72, 0x79, 0x86, 0x90, 0x8d, 0x7d, 0x72, 0x77, 0x82, 0x85, 0x82, 0x82,
-  0x84, 0x84, 0x81, 0x7d, 0x7f, 0x87, 0x8c, 0x8a, 0x85, 0x82, 0x84, 0x84,
-  0x7d, 0x7a, 0x80, 0x88, 0x89, 0x82, 0x7b, 0x7c, 0x82, 0x84, 0x7e, 0x78,
-  0x7c, 0x85, 0x86, 0x83, 0x85, 0x87, 0x85, 0x81, 0x7e, 0x81, 0x85, 0x80,
-  0x78, 0x75, 0x78, 0x7e, 0x80, 0x81, 0x7f, 0x7c, 0x7b, 0x7d, 0x7e, 0x7d,
-  0x81, 0x88, 0x8a, 0x84, 0x7a, 0x74, 0x76, 0x74, 0x72, 0x79, 0x87, 0x8e,
-  0x87, 0x7c, 0x7a, 0x82, 0x8d, 0x8e, 0x85, 0x7a, 0x7b, 0x80, 0x80, 0x7c,
-  0x7a, 0x7d, 0x81, 0x7e, 0x7c, 0x80, 0x84, 0x85, 0x83, 0x83, 0x83, 0x81,
-  0x80, 0x82, 0x82, 0x7e, 0x7a, 0x79, 0x7e, 0x83, 0x82, 0x7e, 0x7d, 0x80,
-  0x81, 0x7e, 0x7a, 0x78, 0x78, 0x7c, 0x81, 0x81, 0x7d, 0x78, 0x77, 0x7c,
-  0x83, 0x85, 0x80, 0x7c, 0x7d, 0x7d, 0x7c, 0x7a, 0x7f, 0x86, 0x85, 0x7b,
-  0x75, 0x7a, 0x84, 0x84, 0x80, 0x80, 0x85, 0x87, 0x82, 0x7b, 0x76, 0x76,
-  0x7b, 0x7c, 0x78, 0x77, 0x7e, 0x86, 0x88, 0x86, 0x7e, 0x76, 0x73, 0x77,
-  0x7f, 0x85, 0x86, 0x82, 0x7c, 0x7a, 0x7e, 0x84, 0x84, 0x7b, 0x73, 0x75,
-  0x7c, 0x82, 0x84, 0x84, 0x81, 0x81, 0x87, 0x8a, 0x82, 0x73, 0x6f, 0x7a,
-  0x8b, 0x95, 0x92, 0x85, 0x77, 0x74, 0x78, 0x7d, 0x83, 0x87, 0x86, 0x82,
-  0x80, 0x83, 0x89, 0x8a, 0x83, 0x79, 0x77, 0x7e, 0x84, 0x82, 0x79, 0x76,
-  0x7b, 0x81, 0x82, 0x80, 0x80, 0x80, 0x80, 0x7d, 0x78, 0x77, 0x7a, 0x7d,
-  0x7d, 0x7a, 0x78, 0x7d, 0x85, 0x86, 0x7e, 0x7a, 0x80, 0x87, 0x85, 0x7c,
-  0x78, 0x7e, 0x86, 0x86, 0x80, 0x7c, 0x7c, 0x80, 0x84, 0x86, 0x88, 0x89,
-  0x86, 0x7f, 0x7c, 0x80, 0x86, 0x88, 0x85, 0x7e, 0x7a, 0x7b, 0x80, 0x82,
-  0x81, 0x7d, 0x7c, 0x80, 0x83, 0x82, 0x82, 0x82, 0x80, 0x7d, 0x80, 0x84,
-  0x84, 0x80, 0x7c, 0x7c, 0x82, 0x84, 0x7e, 0x77, 0x78, 0x82, 0x8a, 0x8b,
-  0x86, 0x82, 0x83, 0x81, 0x7d, 0x7e, 0x84, 0x88, 0x84, 0x79, 0x74, 0x7b,
-  0x84, 0x85, 0x81, 0x7d, 0x7d, 0x7f, 0x80, 0x81, 0x85, 0x8b, 0x8e, 0x87,
-  0x7a, 0x78, 0x83, 0x8b, 0x83, 0x74, 0x72, 0x7c, 0x86, 0x87, 0x85, 0x83,
-  0x80, 0x7c, 0x7e, 0x84, 0x85, 0x7f, 0x7c, 0x7d, 0x82, 0x83, 0x80, 0x78,
-  0x74, 0x78, 0x82, 0x8a, 0x8b, 0x89, 0x87, 0x85, 0x83, 0x80, 0x7b, 0x79,
-  0x7e, 0x82, 0x81, 0x7d, 0x7b, 0x7b, 0x7e, 0x82, 0x80, 0x79, 0x75, 0x7a,
-  0x83, 0x87, 0x84, 0x81, 0x83, 0x84, 0x82, 0x81, 0x7f, 0x7a, 0x76, 0x7a,
-  0x81, 0x85, 0x83, 0x82, 0x85, 0x85, 0x7c, 0x76, 0x78, 0x7e, 0x81, 0x80,
-  0x80, 0x81, 0x80, 0x7e, 0x7b, 0x7c, 0x7f, 0x7e, 0x7a, 0x79, 0x7d, 0x82,
-  0x83, 0x80, 0x7c, 0x7a, 0x7c, 0x7e, 0x7f, 0x7f, 0x81, 0x84, 0x85, 0x82,
-  0x7f, 0x7c, 0x7c, 0x80, 0x85, 0x86, 0x82, 0x7e, 0x7f, 0x82, 0x82, 0x80,
-  0x81, 0x85, 0x88, 0x83, 0x7c, 0x7a, 0x7e, 0x82, 0x80, 0x7c, 0x7b, 0x80,
-  0x85, 0x87, 0x85, 0x82, 0x7e, 0x80, 0x85, 0x87, 0x83, 0x7b, 0x76, 0x78,
-  0x7c, 0x7e, 0x7d, 0x7b, 0x7d, 0x81, 0x86, 0x84, 0x80, 0x80, 0x80, 0x80,
-  0x7d, 0x7b, 0x7e, 0x85, 0x86, 0x83, 0x80, 0x82, 0x82, 0x7d, 0x7a, 0x7e,
-  0x83, 0x83, 0x7e, 0x7a, 0x7a, 0x7d, 0x7f, 0x7e, 0x7d, 0x80, 0x80, 0x7e,
-  0x7d, 0x7e, 0x7c, 0x77, 0x75, 0x79, 0x81, 0x86, 0x83, 0x7e, 0x7d, 0x81,
-  0x85, 0x82, 0x7e, 0x7f, 0x82, 0x82, 0x80, 0x7d, 0x7e, 0x81, 0x80, 0x81,
-  0x85, 0x8a, 0x8f, 0x8d, 0x86, 0x7f, 0x7c, 0x7c, 0x80, 0x84, 0x82, 0x80,
-  0x80, 0x82, 0x83, 0x80, 0x7b, 0x7c, 0x81, 0x82, 0x7e, 0x7a, 0x79, 0x7c,
-  0x81, 0x84, 0x82, 0x7a, 0x77, 0x7b, 0x83, 0x84, 0x80, 0x7e, 0x7f, 0x7e,
-  0x7d, 0x7c, 0x7e, 0x80, 0x80, 0x7e, 0x7c, 0x7d, 0x7e, 0x80, 0x85, 0x89,
-  0x87, 0x84, 0x83, 0x83, 0x81, 0x7e, 0x7a, 0x79, 0x7b, 0x7e, 0x80, 0x82,
-  0x82, 0x7f, 0x7c, 0x7f, 0x86, 0x87, 0x81, 0x80, 0x87, 0x8a, 0x82, 0x77,
-  0x76, 0x80, 0x87, 0x86, 0x80, 0x7b, 0x7b, 0x7e, 0x80, 0x7f, 0x7d, 0x7d,
-  0x7f, 0x80, 0x82, 0x82, 0x7e, 0x79, 0x76, 0x7c, 0x87, 0x8e, 0x8b, 0x86,
-  0x84, 0x82, 0x7c, 0x75, 0x71, 0x75, 0x80, 0x8e, 0x94, 0x8e, 0x82, 0x7b,
-  0x7d, 0x82, 0x83, 0x82, 0x80, 0x82, 0x85, 0x87, 0x84, 0x81, 0x7e, 0x7a,
-  0x77, 0x7c, 0x85, 0x87, 0x82, 0x7e, 0x80, 0x84, 0x86, 0x85, 0x84, 0x83,
-  0x80, 0x7f, 0x7c, 0x79, 0x79, 0x80, 0x89, 0x8a, 0x86, 0x83, 0x84, 0x84,
-  0x82, 0x81, 0x84, 0x85, 0x80, 0x79, 0x78, 0x7e, 0x80, 0x7a, 0x74, 0x7a,
-  0x84, 0x85, 0x7f, 0x7c, 0x80, 0x86, 0x84, 0x7c, 0x7a, 0x80, 0x87, 0x88,
-  0x81, 0x7a, 0x7a, 0x80, 0x84, 0x82, 0x7f, 0x7e, 0x81, 0x85, 0x88, 0x89,
-  0x87, 0x82, 0x7d, 0x7e, 0x82, 0x84, 0x84, 0x82, 0x82, 0x82, 0x83, 0x82,
-  0x82, 0x83, 0x82, 0x80, 0x7e, 0x7e, 0x82, 0x85, 0x83, 0x7e, 0x7b, 0x7b,
-  0x7b, 0x7a, 0x7b, 0x7d, 0x80, 0x81, 0x80, 0x7d, 0x7e, 0x80, 0x82, 0x80,
-  0x7c, 0x7a, 0x7a, 0x7c, 0x80, 0x7f, 0x7c, 0x7a, 0x7d, 0x7e, 0x7f, 0x80,
-  0x7f, 0x7e, 0x7f, 0x82, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x7e, 0x7b, 0x7a, 0x7b,
-  0x7f, 0x80, 0x7d, 0x7c, 0x7e, 0x80, 0x80, 0x7e, 0x7c, 0x7b, 0x7a, 0x7a,
-  0x7d, 0x80, 0x81, 0x7f, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x7e, 0x7e,
-  0x81, 0x82, 0x84, 0x83, 0x80, 0x7e, 0x7d, 0x7e, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x7f, 0x7c, 0x7c, 0x80, 0x82, 0x7e, 0x7b, 0x7b, 0x80,
-  0x84, 0x82, 0x7e, 0x7e, 0x80, 0x7e, 0x7c, 0x7c, 0x80, 0x82, 0x82, 0x80,
-  0x7d, 0x7c, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x81, 0x82, 0x81, 0x7f,
-  0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x82, 0x84, 0x80,
-  0x7b, 0x78, 0x7a, 0x7e, 0x80, 0x80, 0x7e, 0x7c, 0x7b, 0x7c, 0x7c, 0x7b,
-  0x7a, 0x7a, 0x7c, 0x7d, 0x80, 0x82, 0x81, 0x7d, 0x79, 0x79, 0x7c, 0x7e,
-  0x7f, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x80, 0x80,
-  0x81, 0x83, 0x83, 0x81, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x82, 0x84, 0x82, 0x80, 0x80, 0x82, 0x83, 0x83, 0x82, 0x81,
-  0x81, 0x80, 0x7e, 0x7f, 0x82, 0x81, 0x7e, 0x7b, 0x7d, 0x81, 0x82, 0x81,
-  0x80, 0x82, 0x84, 0x82, 0x7e, 0x7c, 0x7d, 0x81, 0x83, 0x82, 0x7e, 0x7e,
-  0x7f, 0x7e, 0x7c, 0x7b, 0x7c, 0x80, 0x82, 0x82, 0x81, 0x7e, 0x7e, 0x80,
-  0x80, 0x7f, 0x7e, 0x80, 0x82, 0x82, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
-  0x80, 0x83, 0x85, 0x84, 0x81, 0x82, 0x86, 0x88, 0x85, 0x80, 0x7f, 0x80,
-  0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x83, 0x86,
-  0x86, 0x84, 0x83, 0x83, 0x84, 0x85, 0x86, 0x87, 0x84, 0x7d, 0x79, 0x7a,
-  0x80, 0x86, 0x88, 0x86, 0x81, 0x7e, 0x7c, 0x7e, 0x7e, 0x7e, 0x80, 0x82,
-  0x83, 0x80, 0x7c, 0x79, 0x7a, 0x7c, 0x7d, 0x7d, 0x7e, 0x81, 0x85, 0x86,
-  0x84, 0x80, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x81, 0x82, 0x80, 0x7f, 0x80,
-  0x81, 0x81, 0x83, 0x86, 0x85, 0x83, 0x80, 0x80, 0x81, 0x7f, 0x7b, 0x7a,
-  0x7c, 0x7f, 0x81, 0x82, 0x83, 0x83, 0x86, 0x87, 0x82, 0x7d, 0x7d, 0x82,
-  0x86, 0x84, 0x7c, 0x77, 0x79, 0x80, 0x82, 0x80, 0x7d, 0x7f, 0x83, 0x85,
-  0x84, 0x81, 0x7e, 0x7e, 0x82, 0x82, 0x80, 0x7f, 0x81, 0x82, 0x81, 0x80,
-  0x7f, 0x7e, 0x80, 0x84, 0x84, 0x82, 0x7e, 0x7b, 0x7a, 0x7c, 0x7e, 0x80,
-  0x82, 0x82, 0x81, 0x7e, 0x7e, 0x83, 0x86, 0x84, 0x80, 0x80, 0x84, 0x89,
-  0x8a, 0x84, 0x7f, 0x7c, 0x7b, 0x79, 0x79, 0x7c, 0x82, 0x86, 0x85, 0x81,
-  0x7d, 0x7e, 0x84, 0x86, 0x85, 0x83, 0x83, 0x82, 0x7d, 0x7a, 0x7b, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x86, 0x87, 0x81,
-  0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x82, 0x7e, 0x7c, 0x7b, 0x7b,
-  0x7c, 0x80, 0x83, 0x82, 0x7f, 0x7c, 0x7b, 0x7c, 0x7c, 0x7d, 0x81, 0x88,
-  0x89, 0x83, 0x7b, 0x7b, 0x80, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x80, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x80, 0x83, 0x84, 0x82, 0x80, 0x83,
-  0x86, 0x85, 0x80, 0x7b, 0x7a, 0x7b, 0x7d, 0x82, 0x85, 0x81, 0x79, 0x74,
-  0x77, 0x7d, 0x84, 0x86, 0x83, 0x80, 0x82, 0x84, 0x83, 0x7e, 0x7a, 0x7b,
-  0x7f, 0x83, 0x85, 0x85, 0x80, 0x7b, 0x7a, 0x7c, 0x80, 0x80, 0x7f, 0x80,
-  0x83, 0x83, 0x80, 0x7d, 0x7e, 0x80, 0x7f, 0x7c, 0x7a, 0x79, 0x7b, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x7e, 0x7b, 0x79, 0x78, 0x78, 0x7b, 0x80, 0x86, 0x87,
-  0x84, 0x7e, 0x79, 0x78, 0x7e, 0x86, 0x88, 0x84, 0x7f, 0x7e, 0x80, 0x81,
-  0x7e, 0x7a, 0x7a, 0x7e, 0x82, 0x82, 0x7c, 0x78, 0x78, 0x7e, 0x83, 0x83,
-  0x82, 0x83, 0x86, 0x85, 0x7e, 0x79, 0x7a, 0x7d, 0x81, 0x82, 0x81, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x80, 0x84, 0x83, 0x7e, 0x7c, 0x81, 0x84, 0x83, 0x7e,
-  0x7a, 0x7c, 0x81, 0x82, 0x7c, 0x75, 0x75, 0x7d, 0x84, 0x88, 0x88, 0x86,
-  0x84, 0x83, 0x81, 0x7f, 0x7c, 0x7a, 0x7c, 0x81, 0x83, 0x80, 0x7d, 0x7a,
-  0x7b, 0x7f, 0x82, 0x80, 0x7c, 0x7b, 0x7e, 0x82, 0x85, 0x80, 0x78, 0x77,
-  0x7d, 0x83, 0x82, 0x7c, 0x7b, 0x7e, 0x82, 0x80, 0x7a, 0x77, 0x7b, 0x81,
-  0x83, 0x81, 0x7f, 0x80, 0x80, 0x7d, 0x7e, 0x85, 0x8a, 0x84, 0x77, 0x74,
-  0x7d, 0x88, 0x88, 0x7e, 0x77, 0x7a, 0x82, 0x87, 0x88, 0x86, 0x80, 0x7a,
-  0x77, 0x78, 0x7d, 0x81, 0x82, 0x82, 0x82, 0x7e, 0x79, 0x7a, 0x82, 0x8a,
-  0x8a, 0x83, 0x7d, 0x7f, 0x84, 0x83, 0x7e, 0x7e, 0x82, 0x83, 0x80, 0x7d,
-  0x7c, 0x7d, 0x80, 0x83, 0x83, 0x82, 0x84, 0x86, 0x84, 0x7e, 0x7a, 0x7b,
-  0x82, 0x88, 0x8a, 0x87, 0x82, 0x7c, 0x7a, 0x7e, 0x84, 0x87, 0x86, 0x83,
-  0x80, 0x7e, 0x7c, 0x7c, 0x7d, 0x80, 0x81, 0x7f, 0x7b, 0x7a, 0x7e, 0x81,
-  0x80, 0x7c, 0x7c, 0x80, 0x84, 0x83, 0x81, 0x82, 0x83, 0x81, 0x7c, 0x78,
-  0x7a, 0x80, 0x84, 0x82, 0x80, 0x80, 0x82, 0x84, 0x85, 0x82, 0x80, 0x80,
-  0x81, 0x80, 0x7f, 0x7e, 0x82, 0x84, 0x82, 0x7c, 0x7c, 0x80, 0x84, 0x84,
-  0x84, 0x86, 0x84, 0x80, 0x80, 0x83, 0x86, 0x82, 0x7b, 0x78, 0x7e, 0x84,
-  0x84, 0x81, 0x7e, 0x7e, 0x82, 0x84, 0x82, 0x82, 0x84, 0x88, 0x87, 0x84,
-  0x80, 0x7e, 0x80, 0x82, 0x82, 0x7f, 0x7d, 0x7e, 0x81, 0x82, 0x7e, 0x7c,
-  0x7e, 0x82, 0x82, 0x82, 0x82, 0x81, 0x7f, 0x7e, 0x80, 0x80, 0x7c, 0x7a,
-  0x7b, 0x7e, 0x83, 0x84, 0x7f, 0x79, 0x79, 0x7f, 0x85, 0x87, 0x85, 0x81,
-  0x80, 0x7e, 0x7d, 0x7c, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7d, 0x7c, 0x80, 0x84, 0x84, 0x81, 0x82, 0x88, 0x8a, 0x84, 0x7e, 0x7e,
-  0x82, 0x84, 0x82, 0x7e, 0x7e, 0x83, 0x86, 0x86, 0x82, 0x80, 0x84, 0x89,
-  0x88, 0x83, 0x7f, 0x80, 0x80, 0x7e, 0x7e, 0x80, 0x82, 0x83, 0x81, 0x80,
-  0x7e, 0x7b, 0x79, 0x7a, 0x7e, 0x81, 0x7f, 0x7c, 0x7d, 0x83, 0x87, 0x85,
-  0x7d, 0x7b, 0x82, 0x88, 0x86, 0x7e, 0x7a, 0x7b, 0x7f, 0x80, 0x7f, 0x81,
-  0x82, 0x80, 0x7b, 0x7a, 0x7d, 0x7f, 0x7c, 0x77, 0x77, 0x7b, 0x80, 0x80,
-  0x80, 0x83, 0x82, 0x7a, 0x73, 0x75, 0x80, 0x88, 0x87, 0x84, 0x82, 0x83,
-  0x83, 0x80, 0x7d, 0x7d, 0x81, 0x84, 0x84, 0x83, 0x82, 0x80, 0x7d, 0x7b,
-  0x7a, 0x7c, 0x81, 0x84, 0x83, 0x80, 0x7c, 0x7a, 0x7a, 0x7d, 0x81, 0x84,
-  0x84, 0x82, 0x84, 0x86, 0x83, 0x79, 0x72, 0x72, 0x78, 0x7f, 0x80, 0x7e,
-  0x7f, 0x82, 0x81, 0x7b, 0x75, 0x77, 0x7e, 0x82, 0x81, 0x7c, 0x7b, 0x7e,
-  0x85, 0x88, 0x87, 0x84, 0x81, 0x7e, 0x7d, 0x7f, 0x80, 0x7e, 0x7c, 0x80,
-  0x87, 0x89, 0x81, 0x76, 0x73, 0x78, 0x80, 0x84, 0x82, 0x83, 0x86, 0x87,
-  0x84, 0x7c, 0x77, 0x7a, 0x7f, 0x80, 0x7f, 0x7d, 0x7e, 0x80, 0x7e, 0x7a,
-  0x7b, 0x7d, 0x80, 0x81, 0x81, 0x84, 0x85, 0x83, 0x80, 0x7f, 0x81, 0x82,
-  0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x81, 0x80, 0x81, 0x83, 0x83, 0x80, 0x7c,
-  0x7a, 0x7c, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7e, 0x81, 0x82, 0x7f,
-  0x7b, 0x7b, 0x80, 0x83, 0x82, 0x7f, 0x80, 0x81, 0x7f, 0x7b, 0x79, 0x7b,
-  0x7e, 0x81, 0x81, 0x81, 0x83, 0x84, 0x82, 0x81, 0x82, 0x84, 0x85, 0x86,
-  0x86, 0x84, 0x80, 0x7c, 0x7c, 0x7e, 0x80, 0x80, 0x81, 0x83, 0x83, 0x82,
-  0x7e, 0x7b, 0x7a, 0x7b, 0x7f, 0x82, 0x82, 0x80, 0x81, 0x85, 0x86, 0x83,
-  0x7e, 0x7e, 0x81, 0x82, 0x82, 0x82, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83,
-  0x81, 0x7e, 0x7c, 0x7e, 0x85, 0x89, 0x87, 0x83, 0x7f, 0x80, 0x82, 0x80,
-  0x7e, 0x7c, 0x7f, 0x82, 0x83, 0x81, 0x7c, 0x7c, 0x7e, 0x82, 0x83, 0x80,
-  0x7c, 0x7d, 0x83, 0x86, 0x85, 0x80, 0x7f, 0x84, 0x89, 0x88, 0x80, 0x7c,
-  0x7e, 0x82, 0x83, 0x81, 0x80, 0x82, 0x85, 0x85, 0x83, 0x7e, 0x7d, 0x7f,
-  0x81, 0x81, 0x7f, 0x7e, 0x81, 0x85, 0x87, 0x87, 0x84, 0x80, 0x7d, 0x7c,
-  0x7d, 0x81, 0x82, 0x82, 0x7f, 0x7d, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7c, 0x7e, 0x80, 0x80, 0x7e, 0x7c, 0x7c, 0x80, 0x82,
-  0x82, 0x80, 0x80, 0x80, 0x81, 0x83, 0x83, 0x81, 0x7d, 0x7e, 0x82, 0x84,
-  0x81, 0x7e, 0x7d, 0x7e, 0x82, 0x86, 0x86, 0x82, 0x7e, 0x7b, 0x7c, 0x7e,
-  0x80, 0x82, 0x81, 0x81, 0x82, 0x80, 0x7c, 0x7b, 0x7d, 0x80, 0x82, 0x80,
-  0x7c, 0x7b, 0x7e, 0x81, 0x82, 0x7f, 0x7c, 0x7c, 0x7e, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x83, 0x82, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x7f,
-  0x7e, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x7f, 0x7c, 0x7d, 0x7e, 0x7e, 0x7c,
-  0x7c, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x84, 0x80, 0x7b, 0x78, 0x7b, 0x7f,
-  0x81, 0x80, 0x7c, 0x7c, 0x7e, 0x7d, 0x7b, 0x7c, 0x7e, 0x81, 0x82, 0x80,
-  0x7b, 0x79, 0x80, 0x87, 0x83, 0x7d, 0x7e, 0x82, 0x86, 0x85, 0x7f, 0x7b,
-  0x7d, 0x80, 0x7f, 0x7d, 0x7f, 0x81, 0x7e, 0x7c, 0x7d, 0x81, 0x80, 0x7b,
-  0x78, 0x7d, 0x84, 0x87, 0x83, 0x7c, 0x7b, 0x80, 0x81, 0x7e, 0x7d, 0x7e,
-  0x81, 0x84, 0x83, 0x81, 0x81, 0x84, 0x84, 0x82, 0x81, 0x80, 0x7f, 0x7e,
-  0x80, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x7f, 0x7c, 0x7c,
-  0x7f, 0x7f, 0x7c, 0x78, 0x78, 0x7b, 0x7e, 0x7d, 0x7a, 0x7b, 0x7e, 0x7d,
-  0x7a, 0x79, 0x80, 0x87, 0x86, 0x80, 0x7a, 0x7a, 0x81, 0x83, 0x7f, 0x7b,
-  0x7c, 0x82, 0x84, 0x81, 0x7b, 0x78, 0x7d, 0x84, 0x84, 0x7e, 0x7a, 0x7e,
-  0x85, 0x86, 0x82, 0x7e, 0x7e, 0x80, 0x80, 0x7c, 0x7b, 0x81, 0x87, 0x87,
-  0x85, 0x82, 0x7d, 0x79, 0x7a, 0x7e, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7e,
-  0x7b, 0x7b, 0x7e, 0x81, 0x81, 0x7e, 0x80, 0x85, 0x87, 0x84, 0x7e, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x7e, 0x80, 0x84, 0x84, 0x80, 0x7d, 0x81, 0x86, 0x85,
-  0x7f, 0x7c, 0x7f, 0x82, 0x82, 0x80, 0x7e, 0x80, 0x82, 0x80, 0x7d, 0x80,
-  0x86, 0x87, 0x82, 0x7d, 0x7e, 0x82, 0x82, 0x7f, 0x7b, 0x7d, 0x84, 0x86,
-  0x83, 0x7e, 0x7a, 0x7b, 0x7e, 0x82, 0x83, 0x80, 0x7e, 0x7f, 0x83, 0x86,
-  0x83, 0x7b, 0x78, 0x7b, 0x81, 0x83, 0x80, 0x80, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x83, 0x85, 0x84, 0x83, 0x82, 0x82, 0x82, 0x7e, 0x7b,
-  0x7b, 0x80, 0x83, 0x82, 0x81, 0x82, 0x82, 0x80, 0x7c, 0x7b, 0x7d, 0x81,
-  0x81, 0x80, 0x81, 0x84, 0x86, 0x82, 0x7e, 0x7f, 0x82, 0x81, 0x7e, 0x7d,
-  0x80, 0x86, 0x86, 0x82, 0x7f, 0x80, 0x83, 0x84, 0x81, 0x7c, 0x7a, 0x7e,
-  0x84, 0x86, 0x84, 0x80, 0x7f, 0x82, 0x84, 0x82, 0x7d, 0x7d, 0x80, 0x82,
-  0x82, 0x82, 0x7f, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x81, 0x84, 0x83,
-  0x7e, 0x7c, 0x7e, 0x83, 0x87, 0x86, 0x82, 0x80, 0x80, 0x83, 0x84, 0x84,
-  0x81, 0x7e, 0x7e, 0x80, 0x80, 0x7e, 0x7b, 0x7c, 0x7e, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x7e,
-  0x7c, 0x7c, 0x80, 0x82, 0x82, 0x7e, 0x7c, 0x7d, 0x80, 0x82, 0x82, 0x82,
-  0x83, 0x86, 0x87, 0x86, 0x82, 0x80, 0x81, 0x84, 0x84, 0x80, 0x7d, 0x80,
-  0x86, 0x88, 0x85, 0x7d, 0x7a, 0x82, 0x8a, 0x8b, 0x84, 0x7f, 0x81, 0x84,
-  0x82, 0x7e, 0x7c, 0x7e, 0x81, 0x83, 0x82, 0x82, 0x82, 0x80, 0x80, 0x83,
-  0x83, 0x81, 0x7e, 0x7e, 0x80, 0x84, 0x85, 0x83, 0x81, 0x80, 0x80, 0x80,
-  0x7e, 0x7a, 0x79, 0x7c, 0x80, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x81, 0x82, 0x80, 0x80, 0x81, 0x83, 0x82, 0x7e, 0x7b, 0x7c, 0x80, 0x82,
-  0x81, 0x7e, 0x7b, 0x7a, 0x7a, 0x7b, 0x80, 0x83, 0x83, 0x81, 0x80, 0x81,
-  0x80, 0x7c, 0x7d, 0x85, 0x8b, 0x87, 0x80, 0x7e, 0x82, 0x84, 0x82, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7b, 0x7b, 0x7c, 0x7d,
-  0x7f, 0x80, 0x7e, 0x7c, 0x7b, 0x7c, 0x80, 0x82, 0x80, 0x7d, 0x7d, 0x80,
-  0x84, 0x84, 0x81, 0x7d, 0x7c, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x80, 0x7d,
-  0x7c, 0x7e, 0x80, 0x82, 0x80, 0x7e, 0x7e, 0x80, 0x82, 0x80, 0x7e, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7c, 0x7b, 0x7c, 0x7f, 0x81, 0x7e, 0x7b, 0x7a, 0x7c,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x81, 0x7e, 0x7c,
-  0x7e, 0x81, 0x83, 0x82, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7f, 0x80, 0x7e, 0x7e, 0x81, 0x81, 0x7f,
-  0x7e, 0x80, 0x83, 0x84, 0x82, 0x81, 0x82, 0x82, 0x80, 0x7f, 0x81, 0x84,
-  0x85, 0x82, 0x7e, 0x7f, 0x83, 0x83, 0x80, 0x7c, 0x7b, 0x7e, 0x82, 0x83,
-  0x82, 0x80, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7e, 0x82, 0x84, 0x82, 0x80,
-  0x7f, 0x80, 0x81, 0x81, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7c, 0x7b, 0x7b,
-  0x7d, 0x80, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82,
-  0x81, 0x7e, 0x7d, 0x7f, 0x81, 0x80, 0x7e, 0x7c, 0x7d, 0x82, 0x83, 0x81,
-  0x80, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x83, 0x83, 0x80, 0x7d, 0x80, 0x83,
-  0x83, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80,
-  0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82,
-  0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x83, 0x82, 0x7f, 0x7f,
-  0x82, 0x84, 0x84, 0x82, 0x80, 0x81, 0x82, 0x80, 0x7c, 0x7a, 0x7d, 0x81,
-  0x84, 0x83, 0x80, 0x7c, 0x7c, 0x7e, 0x82, 0x81, 0x7c, 0x7a, 0x7e, 0x83,
-  0x84, 0x82, 0x80, 0x82, 0x85, 0x84, 0x80, 0x7e, 0x7f, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x7e, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x82, 0x81, 0x7e, 0x7c, 0x7c, 0x80, 0x7f, 0x7e,
-  0x7e, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x7e, 0x7c, 0x7b, 0x7d, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x7f, 0x7d, 0x7d, 0x7e, 0x80, 0x82, 0x81, 0x7e,
-  0x7e, 0x81, 0x86, 0x86, 0x82, 0x7e, 0x7d, 0x80, 0x82, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x7e, 0x7c, 0x7b, 0x7c, 0x7e, 0x7f, 0x7d, 0x7c, 0x7c, 0x7e, 0x7f,
-  0x7f, 0x80, 0x7f, 0x7d, 0x7d, 0x7e, 0x81, 0x81, 0x7d, 0x7c, 0x7f, 0x81,
-  0x81, 0x7e, 0x7c, 0x80, 0x84, 0x84, 0x81, 0x80, 0x81, 0x83, 0x83, 0x80,
-  0x7f, 0x81, 0x82, 0x81, 0x7f, 0x7d, 0x7e, 0x80, 0x80, 0x7e, 0x7f, 0x81,
-  0x82, 0x80, 0x80, 0x82, 0x83, 0x81, 0x7d, 0x7c, 0x7e, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7e, 0x7c, 0x7b, 0x7d, 0x80, 0x81, 0x7f, 0x7e, 0x7d, 0x7e,
-  0x82, 0x83, 0x80, 0x7d, 0x7e, 0x81, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82,
-  0x80, 0x7d, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x7e, 0x7f, 0x80, 0x81, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x82, 0x84, 0x84, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x83, 0x85, 0x85, 0x82, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x81,
-  0x82, 0x83, 0x81, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x81, 0x82, 0x82,
-  0x7f, 0x7e, 0x80, 0x82, 0x83, 0x82, 0x82, 0x82, 0x83, 0x84, 0x82, 0x80,
-  0x7e, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x82, 0x83,
-  0x82, 0x80, 0x82, 0x83, 0x82, 0x81, 0x80, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e,
-  0x80, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7d, 0x7f, 0x81, 0x80, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x82, 0x83, 0x84,
-  0x83, 0x82, 0x80, 0x7d, 0x7d, 0x7f, 0x81, 0x82, 0x80, 0x7e, 0x7f, 0x80,
-  0x81, 0x83, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x7e, 0x7d,
-  0x7e, 0x7e, 0x80, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7e, 0x80, 0x80, 0x7e, 0x7c, 0x7d, 0x7f, 0x81, 0x82, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x82, 0x7f, 0x7e,
-  0x80, 0x82, 0x82, 0x80, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7e, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7e, 0x80, 0x80,
-  0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x7e, 0x7c, 0x7e, 0x81, 0x82, 0x81, 0x81,
-  0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7f, 0x82, 0x83,
-  0x80, 0x7b, 0x78, 0x7c, 0x80, 0x7f, 0x7d, 0x7b, 0x7e, 0x81, 0x80, 0x7d,
-  0x7d, 0x7f, 0x80, 0x7f, 0x7d, 0x7e, 0x81, 0x84, 0x83, 0x82, 0x82, 0x83,
-  0x84, 0x84, 0x82, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x7c, 0x7c,
-  0x7e, 0x80, 0x81, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x82, 0x80,
-  0x7e, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7e,
-  0x80, 0x80, 0x7f, 0x80, 0x82, 0x83, 0x82, 0x7f, 0x7a, 0x74, 0x72, 0x74,
-  0x79, 0x7e, 0x84, 0x89, 0x8b, 0x88, 0x85, 0x82, 0x80, 0x7d, 0x7b, 0x7a,
-  0x7c, 0x7f, 0x82, 0x86, 0x88, 0x88, 0x87, 0x84, 0x82, 0x81, 0x80, 0x7e,
-  0x7b, 0x7a, 0x79, 0x7a, 0x7d, 0x81, 0x82, 0x82, 0x81, 0x7e, 0x7b, 0x7b,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x81, 0x7f, 0x7e, 0x80, 0x7f,
-  0x7e, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x84, 0x82, 0x81, 0x80, 0x7e,
-  0x7c, 0x7c, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x80, 0x7e, 0x7d, 0x80,
-  0x81, 0x80, 0x7e, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0xc1, 0xd0, 0xd0, 0xcc,
-  0x80, 0x80, 0x80, 0xe0, 0xd3, 0xc6, 0xd8, 0xa1, 0x80, 0x81, 0xc3, 0x00,
-  0x80, 0x81, 0xe4, 0x80, 0x80, 0x81, 0xe4, 0x80, 0x80, 0x81, 0xe4, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x84,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0xe4, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80
+
+// generated by tauntgen, 22257 Hz mono ima adpcm in 256 byte blocks
+//
+#include "taunt.h"
+
+const unsigned char taunt_adpcm[] = {
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x77, 0x92, 0xaa, 0x09, 0x82,
+  0xb0, 0xaf, 0x40, 0x34, 0xa0, 0x9b, 0x74, 0x81, 0xbb, 0x0a, 0x22, 0xb8,
+  0x8a, 0x32, 0x83, 0xa9, 0x0a, 0xbe, 0x1b, 0x02, 0xcd, 0x1c, 0x32, 0x91,
+  0xbc, 0x10, 0x24, 0xbc, 0x80, 0x42, 0x42, 0x41, 0x35, 0x43, 0x82, 0x90,
+  0xcb, 0xda, 0xab, 0xaa, 0x09, 0x48, 0x80, 0x07, 0x13, 0x91, 0xdb, 0xad,
+  0xaa, 0x8a, 0x98, 0x98, 0x44, 0x37, 0x12, 0x02, 0x02, 0x11, 0xb9, 0xaf,
+  0xbb, 0x99, 0x80, 0x80, 0x89, 0x72, 0x04, 0x88, 0x20, 0x32, 0xa8, 0x00,
+  0x45, 0x11, 0xa0, 0x20, 0x9e, 0xc9, 0xc9, 0x99, 0xa9, 0x0a, 0x32, 0xcb,
+  0xad, 0x89, 0xa2, 0x08, 0x48, 0x73, 0x17, 0x23, 0x11, 0x23, 0x03, 0x21,
+  0x08, 0xef, 0xbe, 0xac, 0x88, 0x89, 0x10, 0x30, 0x24, 0x43, 0x44, 0x11,
+  0x90, 0xc9, 0x99, 0x09, 0xb8, 0xbc, 0x8b, 0x44, 0x14, 0xa9, 0x9c, 0x10,
+  0x82, 0xd8, 0x9d, 0x31, 0x35, 0x83, 0x88, 0x51, 0x15, 0xb1, 0xcd, 0x8a,
+  0x20, 0xa0, 0x9c, 0x40, 0x24, 0x81, 0x99, 0x18, 0x02, 0xd8, 0xbb, 0x8b,
+  0x24, 0x90, 0xba, 0x2b, 0x35, 0xb8, 0x9f, 0x19, 0x23, 0x98, 0x00, 0x61,
+  0x24, 0x02, 0x08, 0xfb, 0x9a, 0x81, 0x88, 0x20, 0x37, 0x04, 0x10, 0x28,
+  0x02, 0xfc, 0xac, 0x9b, 0x98, 0x8a, 0x08, 0x28, 0x35, 0x31, 0x11, 0xa0,
+  0x32, 0x20, 0x02, 0x42, 0x25, 0x42, 0x16, 0x00, 0xdc, 0x9a, 0xb9, 0x9c,
+  0x9b, 0x38, 0x53, 0x33, 0x22, 0x11, 0x02, 0xa8, 0xfb, 0x80, 0x58, 0x81,
+  0x12, 0x80, 0x23, 0xf3, 0xbb, 0x0c, 0x0a, 0xf8, 0xaa, 0x8a, 0x80, 0xa0,
+  0xcc, 0x89, 0x34, 0x15, 0x62, 0x44, 0x22, 0xa8, 0xab, 0x8a, 0x98, 0x09,
+  0x01, 0x08, 0x38, 0x48, 0xb8, 0xcf, 0xbe, 0xbc, 0x18, 0x24, 0x00, 0x0a,
+  0x72, 0x14, 0x90, 0xbc, 0xb8, 0xf9, 0x38, 0x00, 0x18, 0x33, 0x00, 0xaa,
+  0x41, 0x26, 0x02, 0xcc, 0x9a, 0x18, 0xa0, 0xea, 0xab, 0x31, 0x47, 0xa0,
+  0x89, 0x52, 0x12, 0xa9, 0x0b, 0x22, 0x00, 0xea, 0xbb, 0x08, 0x10, 0xdb,
+  0xac, 0x20, 0x14, 0x98, 0x8a, 0x43, 0x81, 0x91, 0x89, 0x57, 0x11, 0xfb,
+  0xab, 0x31, 0x25, 0x91, 0x18, 0x43, 0x23, 0x91, 0xad, 0xbb, 0x9b, 0xba,
+  0xaa, 0x28, 0xb8, 0xbf, 0x89, 0x91, 0xed, 0x8b, 0x41, 0x35, 0x01, 0x18,
+  0x44, 0x23, 0xa0, 0xac, 0x08, 0x12, 0x88, 0x89, 0x99, 0xfd, 0x09, 0xa8,
+  0xbb, 0x41, 0x44, 0x91, 0x18, 0x33, 0x92, 0xaa, 0x8b, 0x82, 0x52, 0xa0,
+  0xca, 0x1c, 0x84, 0xd9, 0xcb, 0x99, 0xa9, 0x08, 0x9a, 0xbd, 0x41, 0x47,
+  0x81, 0xbb, 0x8a, 0x53, 0x33, 0x25, 0x31, 0x33, 0x00, 0xc9, 0x9d, 0x9a,
+  0xbf, 0xbb, 0x18, 0x13, 0xc0, 0xcb, 0x99, 0x11, 0x91, 0x9d, 0x38, 0x57,
+  0x13, 0x01, 0x80, 0x11, 0x21, 0xa8, 0x9d, 0x29, 0x34, 0xd2, 0xce, 0x19,
+  0x11, 0xca, 0x0b, 0x32, 0x34, 0x90, 0x08, 0x20, 0x21, 0xa8, 0xac, 0x18,
+  0x16, 0x98, 0x9c, 0x80, 0x82, 0xbd, 0xda, 0x19, 0x83, 0xa9, 0x49, 0x55,
+  0xd0, 0xbf, 0x1a, 0x52, 0x12, 0x80, 0x10, 0x34, 0x03, 0xc9, 0xab, 0x08,
+  0x10, 0x90, 0x88, 0x01, 0xcd, 0xad, 0xa9, 0xeb, 0xab, 0x48, 0x43, 0x00,
+  0x88, 0x31, 0x24, 0xb8, 0x0c, 0x73, 0x22, 0x82, 0x28, 0x90, 0xa9, 0xaa,
+  0xbb, 0x89, 0x54, 0x12, 0xda, 0xaa, 0xba, 0xdb, 0x9b, 0x89, 0x63, 0x23,
+  0x90, 0x0a, 0x42, 0x08, 0xac, 0x62, 0x33, 0x22, 0x61, 0x02, 0xfe, 0xbd,
+  0x28, 0x23, 0xb1, 0x8b, 0x72, 0x23, 0xb8, 0xad, 0x10, 0x22, 0x80, 0x99,
+  0x31, 0x14, 0xb1, 0xdc, 0xbb, 0x19, 0x21, 0x90, 0xad, 0x20, 0x25, 0xc8,
+  0xae, 0x19, 0x23, 0x82, 0x80, 0x52, 0x24, 0x81, 0x9c, 0x09, 0x36, 0x00,
+  0x8a, 0x19, 0x43, 0x80, 0x9a, 0x2a, 0x98, 0xaa, 0x8d, 0x89, 0x80, 0xea,
+  0x21, 0xa1, 0xa0, 0x88, 0x40, 0x08, 0xbc, 0x43, 0x24, 0xb3, 0xec, 0xcb,
+  0x39, 0x80, 0xb0, 0xb0, 0x08, 0x97, 0xaa, 0x0a, 0x88, 0x00, 0x78, 0xa1,
+  0x32, 0x73, 0x94, 0x08, 0xa8, 0x02, 0x80, 0x03, 0x84, 0x84, 0xc0, 0x4b,
+  0xb8, 0xfb, 0x9a, 0x22, 0xdb, 0x08, 0x08, 0x08, 0x08, 0x8c, 0x00, 0x58,
+  0x43, 0x16, 0xa0, 0x2a, 0x83, 0x0b, 0x3c, 0xc0, 0x73, 0x80, 0x80, 0x20,
+  0x03, 0xc8, 0xc0, 0x0b, 0x43, 0xc0, 0xc0, 0x80, 0x43, 0x06, 0xc8, 0xa9,
+  0x82, 0x83, 0x0b, 0xbc, 0x80, 0x04, 0x48, 0x0f, 0x98, 0x88, 0x83, 0xbb,
+  0x4b, 0x48, 0x83, 0xb4, 0x0f, 0x88, 0x20, 0xea, 0x0b, 0x21, 0x85, 0xa0,
+  0xaa, 0x20, 0x43, 0xbb, 0xbb, 0x48, 0x84, 0x84, 0xbb, 0x80, 0x35, 0x83,
+  0x80, 0x80, 0x77, 0x10, 0x80, 0x82, 0x20, 0x38, 0x80, 0x80, 0x35, 0x00,
+  0x9f, 0x02, 0x02, 0xf3, 0x9c, 0xa0, 0x80, 0xb9, 0x80, 0x80, 0x04, 0x08,
+  0xbd, 0xbb, 0x88, 0x05, 0xec, 0x80, 0x82, 0x32, 0x83, 0xcb, 0x08, 0x0c,
+  0xbc, 0x9f, 0x2a, 0x82, 0xbd, 0x0a, 0x38, 0x32, 0xc0, 0x30, 0x27, 0x43,
+  0xa0, 0x80, 0x80, 0x30, 0x03, 0x0d, 0x33, 0x07, 0x20, 0x32, 0x48, 0x32,
+  0x87, 0x09, 0xa8, 0xbd, 0x21, 0x15, 0xa9, 0x9c, 0x28, 0x82, 0xfa, 0x09,
+  0x01, 0x84, 0x80, 0xaa, 0x0b, 0x43, 0xb8, 0xdf, 0x18, 0x01, 0x08, 0xa8,
+  0xb0, 0x0e, 0x8a, 0xda, 0x89, 0x20, 0xa2, 0x08, 0xc8, 0x07, 0x0a, 0x08,
+  0x08, 0x38, 0x40, 0x8b, 0x84, 0x70, 0x04, 0x28, 0x84, 0x40, 0x01, 0x2a,
+  0x80, 0x33, 0x34, 0x08, 0xc8, 0xec, 0x41, 0x05, 0xb8, 0x09, 0x41, 0xa9,
+  0xa9, 0x2a, 0x33, 0x83, 0xd0, 0xbe, 0x2a, 0x22, 0xfa, 0x8a, 0x21, 0x82,
+  0xdc, 0x03, 0x29, 0x00, 0xaa, 0xcb, 0xad, 0x80, 0xaa, 0xcf, 0x1a, 0x02,
+  0xa9, 0xac, 0x29, 0x08, 0x68, 0xa9, 0x20, 0x15, 0x82, 0x80, 0x63, 0x21,
+  0x22, 0x08, 0x16, 0x22, 0x82, 0x30, 0x73, 0x03, 0xaa, 0x9f, 0x38, 0x15,
+  0x99, 0x9c, 0x21, 0x03, 0x0a, 0x08, 0x3b, 0x43, 0x83, 0xff, 0x19, 0x12,
+  0xa1, 0xac, 0x81, 0x03, 0xca, 0xa9, 0xce, 0x00, 0xa0, 0x9d, 0x09, 0x10,
+  0x99, 0x9c, 0x8b, 0x20, 0x15, 0xc9, 0x28, 0x31, 0x82, 0xb0, 0x03, 0x57,
+  0x13, 0x83, 0x02, 0x62, 0x14, 0x91, 0x10, 0xa2, 0xba, 0x70, 0x44, 0xa0,
+  0x89, 0x13, 0xa0, 0x20, 0x32, 0xc0, 0x73, 0xa3, 0xad, 0x2a, 0x28, 0xaa,
+  0x8d, 0xab, 0xa8, 0xba, 0xf8, 0x9f, 0x08, 0xb9, 0xac, 0x11, 0x89, 0xab,
+  0xaa, 0x9d, 0x51, 0x02, 0x9a, 0x28, 0x83, 0x80, 0x80, 0x57, 0x21, 0x33,
+  0x22, 0x23, 0x47, 0x82, 0x10, 0xa0, 0x0a, 0x35, 0x17, 0xaa, 0x28, 0x24,
+  0xa1, 0x9a, 0x12, 0x20, 0x63, 0x98, 0x9f, 0x18, 0x02, 0xba, 0xa9, 0x82,
+  0x8a, 0xc0, 0xdf, 0x8a, 0x90, 0xfa, 0x9a, 0x88, 0xb0, 0x0a, 0xb8, 0x9a,
+  0x22, 0x02, 0xcb, 0x48, 0x32, 0x0f, 0x48, 0x83, 0x62, 0x11, 0x81, 0x24,
+  0x25, 0x08, 0xa9, 0x20, 0x71, 0x23, 0xa9, 0x19, 0x26, 0x08, 0x89, 0x39,
+  0x17, 0x22, 0xa8, 0xca, 0x31, 0x12, 0xbc, 0x0c, 0x13, 0xd0, 0x99, 0x9c,
+  0x8b, 0xfa, 0xca, 0xab, 0x10, 0xaa, 0x9e, 0xaa, 0x8c, 0x80, 0x01, 0xab,
+  0x24, 0xa8, 0x0a, 0x72, 0x81, 0x24, 0x10, 0x14, 0x32, 0x26, 0x80, 0x9b,
+  0x44, 0x44, 0x82, 0x89, 0x38, 0x13, 0x82, 0x0a, 0x62, 0x27, 0x82, 0xaa,
+  0x11, 0x32, 0x9a, 0x9d, 0x01, 0x08, 0xdb, 0xcf, 0x98, 0x98, 0xc8, 0xba,
+  0x89, 0x90, 0xce, 0xaa, 0x0b, 0x18, 0x91, 0xab, 0x22, 0xba, 0x8e, 0x14,
+  0x32, 0x04, 0x01, 0x68, 0x2c, 0xf1, 0x2f, 0x00, 0x24, 0x04, 0xb8, 0x0c,
+  0x73, 0x14, 0x88, 0x88, 0x32, 0x11, 0x90, 0x2a, 0x55, 0x15, 0x90, 0x8b,
+  0x01, 0x12, 0x90, 0x0c, 0x28, 0x01, 0xf8, 0xaf, 0x08, 0x98, 0xc9, 0xaa,
+  0x80, 0x9a, 0xbd, 0xa9, 0x18, 0xb8, 0x9e, 0x80, 0x80, 0x9b, 0x0d, 0x28,
+  0x23, 0x20, 0x37, 0x11, 0x82, 0xaa, 0x73, 0x26, 0x11, 0x89, 0x20, 0x33,
+  0x35, 0x01, 0x51, 0x63, 0x02, 0x98, 0x88, 0x32, 0xa1, 0x00, 0x01, 0x60,
+  0x98, 0xbf, 0x9c, 0x09, 0x9a, 0xcc, 0xaa, 0xba, 0xda, 0xab, 0x0b, 0x89,
+  0xa0, 0xac, 0xb0, 0xda, 0x28, 0x80, 0x20, 0x37, 0x91, 0x28, 0x83, 0x4b,
+  0x65, 0x23, 0x10, 0x31, 0x14, 0x21, 0x14, 0x54, 0x22, 0x33, 0x21, 0x08,
+  0x28, 0x80, 0x80, 0x44, 0x08, 0x33, 0xd0, 0xf0, 0xae, 0x89, 0xb9, 0xac,
+  0x9c, 0xb9, 0xbb, 0xad, 0x99, 0x08, 0xca, 0xa9, 0x9a, 0xae, 0x08, 0x28,
+  0x22, 0x96, 0x0a, 0xa8, 0x02, 0x70, 0x27, 0x81, 0x10, 0x34, 0x10, 0x11,
+  0x33, 0x54, 0x33, 0x81, 0x82, 0x22, 0x01, 0x16, 0x19, 0x24, 0xa8, 0x80,
+  0xed, 0x0a, 0x9b, 0xdb, 0xaa, 0x0b, 0xac, 0xbd, 0x9b, 0xa9, 0xa9, 0xa9,
+  0xbf, 0xa8, 0x9c, 0x89, 0x49, 0x34, 0xb8, 0x9f, 0x30, 0x83, 0x43, 0x12,
+  0x01, 0x41, 0x14, 0x01, 0x73, 0x03, 0x53, 0x23, 0x11, 0x08, 0x81, 0x30,
+  0x22, 0x37, 0x20, 0x98, 0xbc, 0xcb, 0x9b, 0xa8, 0xdf, 0xaa, 0xa9, 0x09,
+  0xd9, 0xab, 0x89, 0xb9, 0xe9, 0xac, 0x9b, 0x10, 0x32, 0x37, 0xf9, 0xaf,
+  0x21, 0x03, 0xaa, 0x30, 0x25, 0xa0, 0xab, 0x52, 0x33, 0x22, 0x80, 0x11,
+  0x63, 0x91, 0xad, 0x39, 0x57, 0x80, 0x99, 0x19, 0x00, 0xa8, 0x8b, 0x33,
+  0xf0, 0xbe, 0x88, 0x01, 0x99, 0x89, 0x81, 0xa8, 0xcc, 0x8a, 0x32, 0x55,
+  0x12, 0xfb, 0xaf, 0x28, 0x15, 0xb9, 0x28, 0x35, 0x5f, 0x1b, 0x4a, 0x00,
+  0xa8, 0x9c, 0x40, 0x14, 0x10, 0x88, 0x09, 0x10, 0xc9, 0xbb, 0x51, 0x13,
+  0xea, 0xab, 0x08, 0x08, 0xa9, 0x19, 0x45, 0xa0, 0x9d, 0x30, 0x15, 0x80,
+  0x08, 0x12, 0xb0, 0xcc, 0x29, 0x42, 0x02, 0x90, 0xff, 0x9c, 0x28, 0x14,
+  0x98, 0x29, 0x34, 0xc8, 0x8b, 0x53, 0x21, 0x04, 0xa9, 0x99, 0x98, 0xc9,
+  0x8c, 0x43, 0x93, 0xce, 0x9a, 0x11, 0x10, 0x00, 0x22, 0x13, 0xfb, 0x8a,
+  0x45, 0x12, 0xa8, 0x89, 0x88, 0xba, 0x9a, 0x73, 0x33, 0xfa, 0xae, 0x88,
+  0x43, 0x91, 0x8b, 0x44, 0x81, 0xcb, 0x28, 0x14, 0x13, 0xb8, 0x9b, 0x89,
+  0xc9, 0xcb, 0x50, 0x23, 0xda, 0x9c, 0x10, 0x12, 0x01, 0x22, 0x13, 0xf9,
+  0x9c, 0x41, 0x13, 0xb8, 0x89, 0x00, 0xaa, 0x88, 0x52, 0x14, 0xfc, 0x9d,
+  0x20, 0x23, 0xc9, 0x48, 0x33, 0xc8, 0x9b, 0x52, 0x22, 0x90, 0xaa, 0x99,
+  0xa9, 0xbb, 0x9d, 0x51, 0x13, 0xfb, 0x0a, 0x22, 0x00, 0x10, 0x23, 0x02,
+  0xeb, 0x9a, 0x43, 0x03, 0xbc, 0x09, 0x82, 0xdb, 0x8b, 0x64, 0x13, 0xde,
+  0x8a, 0x20, 0x34, 0xa8, 0x1a, 0x25, 0xa1, 0xad, 0x40, 0x23, 0x90, 0xbb,
+  0xab, 0x89, 0x98, 0x89, 0x72, 0x13, 0xdb, 0x1b, 0x43, 0x12, 0x80, 0x80,
+  0xa8, 0xdd, 0x0a, 0x34, 0x83, 0xac, 0x09, 0x00, 0x11, 0x11, 0x45, 0xe1,
+  0xbf, 0x88, 0x41, 0x03, 0xaa, 0x51, 0x12, 0xda, 0x0a, 0x34, 0x83, 0xb8,
+  0xbb, 0x9a, 0x9a, 0x99, 0x30, 0x57, 0x90, 0xac, 0x28, 0x33, 0x12, 0x80,
+  0x89, 0xdb, 0xac, 0x30, 0x26, 0xa8, 0xab, 0x21, 0x82, 0x28, 0x94, 0xff,
+  0x0c, 0x38, 0x15, 0xb9, 0x38, 0x25, 0xb9, 0x9b, 0x53, 0x12, 0xa9, 0xbb,
+  0x9a, 0x09, 0x99, 0x09, 0x55, 0x83, 0xbb, 0x18, 0x34, 0x14, 0xa8, 0x9b,
+  0xb9, 0xcc, 0x39, 0x36, 0x91, 0xac, 0x08, 0x80, 0x88, 0x72, 0x34, 0xc0,
+  0xa1, 0x2a, 0x4a, 0x00, 0xbf, 0x8a, 0x41, 0x24, 0x80, 0x8a, 0x10, 0x80,
+  0xab, 0x28, 0x35, 0x02, 0xec, 0xcb, 0x09, 0x31, 0x23, 0x81, 0x88, 0x81,
+  0xda, 0x19, 0x35, 0x82, 0xeb, 0xab, 0x00, 0x12, 0x11, 0x22, 0x03, 0xba,
+  0xab, 0x38, 0x47, 0x14, 0xfb, 0xbf, 0x08, 0x53, 0x12, 0xa9, 0x28, 0x23,
+  0xc8, 0x9d, 0x31, 0x23, 0xc9, 0xbd, 0x8a, 0x30, 0x12, 0x00, 0x42, 0x14,
+  0xea, 0x8b, 0x42, 0x81, 0xba, 0x8a, 0x10, 0x11, 0x11, 0x01, 0x80, 0x01,
+  0xb9, 0x8b, 0x32, 0x27, 0xff, 0x9f, 0x08, 0x43, 0x12, 0xba, 0x42, 0x04,
+  0xca, 0x8b, 0x42, 0x01, 0xba, 0xbc, 0x89, 0x21, 0x22, 0x11, 0x44, 0x13,
+  0xea, 0xab, 0x21, 0x03, 0xca, 0xab, 0x08, 0x08, 0x62, 0x34, 0x81, 0x9a,
+  0xa9, 0x0b, 0x46, 0xc2, 0xdf, 0x09, 0x38, 0x53, 0x91, 0x0c, 0x42, 0x91,
+  0xbc, 0x19, 0x24, 0xa1, 0xad, 0x8a, 0x11, 0x21, 0x42, 0x23, 0xa1, 0xcd,
+  0x09, 0x01, 0x91, 0xa9, 0x8a, 0xa9, 0x89, 0x73, 0x35, 0x12, 0xb9, 0xac,
+  0x09, 0x21, 0xc0, 0xdf, 0x0a, 0x63, 0x03, 0xc9, 0x0a, 0x43, 0x12, 0xc9,
+  0x9b, 0x30, 0x83, 0xfb, 0x8a, 0x21, 0x22, 0x80, 0x98, 0xa8, 0x19, 0x33,
+  0x14, 0x98, 0xda, 0xbc, 0x09, 0x32, 0x23, 0x33, 0x81, 0xcf, 0xab, 0x28,
+  0x32, 0x35, 0x03, 0xff, 0x9c, 0x30, 0x43, 0x23, 0x91, 0xbb, 0x9a, 0x88,
+  0xa9, 0x9a, 0x48, 0x44, 0xa1, 0xbe, 0x1a, 0x54, 0x12, 0x90, 0x99, 0xba,
+  0xbb, 0x18, 0x43, 0x02, 0x98, 0xa9, 0x89, 0x41, 0x36, 0x02, 0xeb, 0xac,
+  0x08, 0x54, 0x14, 0xfa, 0x9d, 0x18, 0x43, 0x02, 0x9a, 0x20, 0x13, 0xea,
+  0xac, 0x28, 0x32, 0x82, 0xdb, 0x8b, 0x31, 0x33, 0x02, 0x09, 0x80, 0xdc,
+  0xab, 0x29, 0x33, 0x13, 0x08, 0x01, 0x80, 0xca, 0x9c, 0x20, 0x02, 0x08,
+  0x53, 0xf1, 0xff, 0x8c, 0x00, 0x80, 0x50, 0x00, 0x10, 0x34, 0x13, 0x8b,
+  0x53, 0xa1, 0xbe, 0x0a, 0x21, 0x01, 0x98, 0xaa, 0x29, 0x34, 0x01, 0x61,
+  0x24, 0xd9, 0xbc, 0x89, 0x11, 0x01, 0x08, 0x12, 0x11, 0x01, 0x90, 0xeb,
+  0x9c, 0x28, 0x80, 0x9a, 0x57, 0x82, 0xde, 0x8a, 0x30, 0x34, 0x22, 0x90,
+  0xba, 0xbb, 0x9a, 0x99, 0x18, 0x73, 0x34, 0xb1, 0xcd, 0x18, 0x33, 0x02,
+  0xa9, 0x99, 0xca, 0xab, 0x28, 0x53, 0x24, 0x81, 0xb9, 0xbc, 0x9b, 0x20,
+  0x36, 0x00, 0xb9, 0xaa, 0x48, 0x36, 0xf8, 0xbe, 0x18, 0x53, 0x23, 0x02,
+  0x99, 0xac, 0x8a, 0x88, 0xa9, 0x89, 0x54, 0x23, 0xc8, 0xad, 0x28, 0x44,
+  0x01, 0xaa, 0x8a, 0xa9, 0x9b, 0x30, 0x45, 0x22, 0x88, 0x98, 0xda, 0xac,
+  0x20, 0x33, 0x81, 0xdc, 0x89, 0x62, 0x03, 0xde, 0x9b, 0x41, 0x24, 0x13,
+  0x88, 0x99, 0xa9, 0xba, 0xbc, 0x89, 0x62, 0x43, 0x81, 0xac, 0x0a, 0x43,
+  0x02, 0xba, 0x89, 0x98, 0xcc, 0x0a, 0x53, 0x24, 0x81, 0x90, 0x98, 0xbb,
+  0x9d, 0x19, 0x12, 0x99, 0x1a, 0x77, 0x14, 0xfb, 0xbb, 0x28, 0x34, 0x34,
+  0xb8, 0x8a, 0x21, 0xc0, 0xbe, 0x89, 0x42, 0x43, 0x91, 0xcb, 0x09, 0x22,
+  0x90, 0x08, 0x24, 0xb0, 0xce, 0x08, 0x21, 0x02, 0x00, 0x80, 0xa9, 0xab,
+  0x88, 0x31, 0x81, 0x88, 0x38, 0x57, 0xf8, 0xcd, 0x09, 0x63, 0x22, 0x90,
+  0x99, 0x11, 0xa0, 0xcc, 0x8b, 0x28, 0x53, 0x12, 0xa0, 0xac, 0x18, 0x23,
+  0x80, 0xda, 0x9a, 0x10, 0x80, 0x10, 0x34, 0x24, 0x90, 0x9a, 0xcb, 0xbd,
+  0x9a, 0x34, 0x02, 0xdc, 0x8a, 0x53, 0x35, 0x82, 0xdd, 0xac, 0x28, 0x44,
+  0x23, 0x91, 0xcb, 0x9a, 0x00, 0x90, 0xaa, 0x09, 0x54, 0x24, 0xa1, 0xcd,
+  0x09, 0x21, 0x02, 0x99, 0x28, 0x01, 0xca, 0x9a, 0x42, 0x22, 0x98, 0xcc,
+  0x9a, 0x31, 0x13, 0xa1, 0xab, 0x20, 0x55, 0x15, 0x75, 0x18, 0x3f, 0x00,
+  0xfb, 0xbf, 0x19, 0x53, 0x22, 0x80, 0x00, 0x12, 0xd9, 0xbc, 0x9b, 0x10,
+  0x43, 0x23, 0xa0, 0xaa, 0x20, 0x81, 0xa9, 0x9a, 0x99, 0xcc, 0x9a, 0x41,
+  0x46, 0x23, 0x00, 0x99, 0xeb, 0xbc, 0x8a, 0x43, 0x23, 0x11, 0x44, 0xc2,
+  0xff, 0x9a, 0x20, 0x33, 0x24, 0x8a, 0x32, 0x92, 0xcf, 0xaa, 0x09, 0x21,
+  0x33, 0x22, 0x08, 0x01, 0xe8, 0xad, 0x38, 0x22, 0xc8, 0x9b, 0x31, 0x02,
+  0x08, 0x31, 0x13, 0xd9, 0xbd, 0x9b, 0x41, 0x22, 0xa0, 0x9a, 0x38, 0x37,
+  0xa2, 0xdc, 0x9b, 0x18, 0x54, 0x33, 0x03, 0xd9, 0xab, 0x99, 0x90, 0xa8,
+  0x89, 0x73, 0x43, 0x90, 0xdb, 0x8a, 0x20, 0x23, 0x00, 0x00, 0x81, 0xb9,
+  0xbd, 0x19, 0x34, 0xa2, 0xcf, 0x0a, 0x43, 0x02, 0xa9, 0x50, 0x15, 0xa8,
+  0xab, 0xcd, 0xbd, 0x0a, 0x44, 0x34, 0x23, 0x12, 0x90, 0xcc, 0xbc, 0xab,
+  0x8a, 0x42, 0x34, 0x14, 0x80, 0x99, 0x99, 0x99, 0xb9, 0xad, 0x08, 0x00,
+  0x21, 0x45, 0x24, 0x02, 0xa9, 0xcc, 0xbb, 0x09, 0x21, 0x32, 0x22, 0x51,
+  0x44, 0xf0, 0xdf, 0x89, 0x41, 0x32, 0x01, 0x09, 0x32, 0xd0, 0xbd, 0x9b,
+  0x18, 0x42, 0x23, 0x01, 0x08, 0x90, 0xbb, 0xab, 0x11, 0xc0, 0x9c, 0x10,
+  0x33, 0x33, 0x24, 0x02, 0xeb, 0xbb, 0x88, 0x01, 0x21, 0x82, 0x88, 0x75,
+  0xb2, 0xff, 0x8e, 0x52, 0x12, 0xb9, 0x0b, 0x44, 0x81, 0xbc, 0x8a, 0x21,
+  0x13, 0x98, 0x9a, 0x31, 0x24, 0xc0, 0xcd, 0x09, 0x22, 0x82, 0x89, 0x31,
+  0x24, 0xd9, 0x9c, 0x18, 0x00, 0x08, 0x20, 0x80, 0x98, 0xbc, 0x8c, 0x61,
+  0x34, 0xa1, 0xcd, 0x8b, 0x20, 0x44, 0x24, 0x82, 0xa9, 0x9b, 0xa9, 0xdb,
+  0xab, 0x28, 0x52, 0x25, 0x03, 0xc9, 0x9b, 0x10, 0xa0, 0xac, 0x18, 0x34,
+  0x02, 0x09, 0x11, 0x81, 0xfb, 0xac, 0x0a, 0x32, 0x81, 0x9a, 0x55, 0x14,
+  0x97, 0x14, 0x3f, 0x00, 0x80, 0x40, 0xc3, 0xff, 0x9b, 0x28, 0x53, 0x22,
+  0x00, 0x18, 0x01, 0xd9, 0xbd, 0x9b, 0x29, 0x34, 0x24, 0x98, 0x18, 0x22,
+  0xd0, 0xbd, 0x8a, 0x22, 0x91, 0x08, 0x44, 0x13, 0xa8, 0x8a, 0x00, 0xfb,
+  0xab, 0x18, 0x32, 0x32, 0x45, 0x02, 0xfd, 0xac, 0x18, 0x43, 0x91, 0x0a,
+  0x55, 0x02, 0xc8, 0xab, 0x08, 0x98, 0x99, 0x31, 0x34, 0x24, 0x81, 0xdb,
+  0x8b, 0x80, 0xca, 0x0a, 0x52, 0x02, 0x88, 0x20, 0x22, 0x98, 0xbc, 0xab,
+  0xa9, 0x49, 0x36, 0x02, 0x08, 0xfb, 0xff, 0x18, 0x33, 0xa2, 0x9c, 0x73,
+  0x82, 0xb9, 0x9b, 0x21, 0xa8, 0x8b, 0x42, 0x33, 0x21, 0x81, 0xdb, 0x9d,
+  0x09, 0x98, 0x89, 0x53, 0x23, 0x98, 0x09, 0x21, 0xd8, 0xce, 0x88, 0x11,
+  0x22, 0x22, 0x00, 0xa9, 0x9c, 0x38, 0x82, 0xec, 0xac, 0x28, 0x63, 0x33,
+  0x22, 0x90, 0xca, 0xab, 0x89, 0xda, 0xcb, 0x28, 0x55, 0x12, 0x98, 0x0a,
+  0x12, 0xa1, 0xbf, 0x89, 0x11, 0x81, 0x08, 0x51, 0x12, 0x90, 0xad, 0x0a,
+  0x11, 0x80, 0x81, 0x11, 0xb0, 0x8c, 0x75, 0x15, 0xe9, 0xbc, 0x09, 0x42,
+  0x22, 0x22, 0x12, 0x02, 0x81, 0xec, 0xbd, 0x9b, 0x30, 0x24, 0x01, 0x18,
+  0x31, 0x04, 0xda, 0xcc, 0x89, 0x21, 0x00, 0x08, 0x53, 0x23, 0x98, 0x99,
+  0x98, 0xec, 0xbb, 0x10, 0x24, 0x22, 0x32, 0x34, 0xf8, 0xdf, 0x0a, 0x31,
+  0x13, 0x9a, 0x72, 0x14, 0x98, 0xbb, 0x8a, 0x98, 0x9b, 0x28, 0x34, 0x35,
+  0x23, 0xb9, 0xac, 0x99, 0xdb, 0xab, 0x41, 0x13, 0x81, 0x31, 0x25, 0x91,
+  0xab, 0xcb, 0xab, 0x09, 0x41, 0x44, 0x12, 0xa3, 0xff, 0x8e, 0x30, 0x03,
+  0xbb, 0x71, 0x14, 0x98, 0xab, 0x00, 0xa0, 0xac, 0x28, 0x22, 0x33, 0x25,
+  0x90, 0xba, 0x9a, 0xdb, 0xac, 0x20, 0x24, 0x80, 0x30, 0x33, 0x81, 0xbd,
+  0xab, 0xaa, 0xaa, 0x18, 0x5e, 0xdd, 0x39, 0x00, 0x53, 0x43, 0x24, 0x02,
+  0x99, 0xb0, 0xff, 0xab, 0x10, 0x34, 0x33, 0x33, 0x12, 0xc8, 0xcb, 0xbb,
+  0xcd, 0x9b, 0x41, 0x25, 0x82, 0x99, 0x20, 0x12, 0xd9, 0xac, 0x19, 0x01,
+  0x89, 0x18, 0x34, 0x03, 0x88, 0x18, 0xd9, 0xbd, 0x19, 0x23, 0x91, 0x9b,
+  0x52, 0x14, 0x31, 0x26, 0xfa, 0xcf, 0x0a, 0x41, 0x33, 0x12, 0x98, 0x20,
+  0x12, 0xfb, 0xbd, 0xaa, 0x28, 0x33, 0x04, 0x80, 0x30, 0x34, 0xd0, 0xbd,
+  0x0a, 0x11, 0xa9, 0x19, 0x45, 0x13, 0x89, 0x19, 0x00, 0xda, 0xac, 0x09,
+  0x00, 0x10, 0x54, 0x34, 0xa1, 0xcf, 0xab, 0x20, 0x22, 0x81, 0x52, 0x36,
+  0x02, 0xca, 0xbb, 0xa9, 0xaa, 0x9a, 0x31, 0x45, 0x34, 0x02, 0xaa, 0x89,
+  0xea, 0xac, 0x09, 0x21, 0x01, 0x31, 0x44, 0x13, 0x98, 0xab, 0xdb, 0x9c,
+  0x89, 0x20, 0x53, 0x25, 0xc1, 0xcf, 0x0a, 0x42, 0x92, 0x9c, 0x73, 0x12,
+  0x98, 0x9b, 0x00, 0xb8, 0xad, 0x18, 0x11, 0x32, 0x25, 0x01, 0x9a, 0x88,
+  0xd9, 0xad, 0x09, 0x02, 0x80, 0x20, 0x35, 0x03, 0xa8, 0x89, 0xa8, 0xcd,
+  0x9a, 0x08, 0x00, 0x61, 0x44, 0x12, 0xeb, 0xad, 0x08, 0x32, 0x02, 0x18,
+  0x44, 0x14, 0xb0, 0xad, 0xaa, 0x9a, 0x88, 0x20, 0x32, 0x44, 0x24, 0x91,
+  0xca, 0x9a, 0x89, 0xbc, 0x8a, 0x43, 0x13, 0x11, 0x32, 0x26, 0x90, 0xdc,
+  0x9a, 0x8a, 0x99, 0x88, 0x51, 0x34, 0x34, 0x32, 0xe8, 0xce, 0xaa, 0x28,
+  0x33, 0x24, 0x12, 0x11, 0x32, 0xb1, 0xdf, 0xcb, 0x8a, 0x10, 0x22, 0x01,
+  0x20, 0x54, 0x22, 0xc9, 0xac, 0x08, 0xa8, 0xbb, 0x39, 0x36, 0x13, 0x10,
+  0x22, 0xa1, 0xcf, 0x9a, 0x89, 0x00, 0x11, 0x33, 0x44, 0x15, 0xe9, 0xae,
+  0x09, 0x32, 0x81, 0x19, 0x64, 0x13, 0x90, 0xbb, 0xbb, 0xbb, 0xba, 0xaa,
+  0x30, 0x57, 0x34, 0x81, 0x98, 0x08, 0xc9, 0xae, 0x1e, 0xda, 0x4a, 0x00,
+  0x0a, 0x10, 0x00, 0x21, 0x25, 0x23, 0x80, 0x99, 0xcb, 0xcc, 0xab, 0x09,
+  0x52, 0x35, 0x13, 0xf9, 0xad, 0x19, 0x23, 0xb1, 0x1b, 0x57, 0x02, 0xa0,
+  0x9a, 0x88, 0xba, 0xad, 0x09, 0x21, 0x53, 0x23, 0x00, 0x20, 0x12, 0xfc,
+  0xab, 0x89, 0x90, 0xaa, 0x51, 0x34, 0x12, 0x01, 0x01, 0xc9, 0xbc, 0xab,
+  0xaa, 0x19, 0x54, 0x43, 0x81, 0xeb, 0x8a, 0x44, 0x82, 0xeb, 0x29, 0x44,
+  0x81, 0xbb, 0x1a, 0x22, 0xd9, 0x9c, 0x18, 0x22, 0x22, 0x80, 0x01, 0x23,
+  0xe8, 0xad, 0x0a, 0x02, 0x98, 0x19, 0x35, 0x13, 0x99, 0x0a, 0xa9, 0xac,
+  0x88, 0xa9, 0xba, 0x41, 0x44, 0x44, 0x13, 0xda, 0xbe, 0x0a, 0x30, 0x53,
+  0x33, 0x14, 0x81, 0x99, 0x99, 0xdd, 0xcc, 0x9a, 0x18, 0x33, 0x33, 0x02,
+  0x21, 0x34, 0xa1, 0xdf, 0x89, 0x00, 0xa8, 0x9a, 0x31, 0x33, 0x22, 0x44,
+  0x22, 0xc9, 0xab, 0xca, 0xbd, 0x9c, 0x20, 0x33, 0x45, 0x34, 0x92, 0xcf,
+  0x8b, 0x11, 0x01, 0x99, 0x52, 0x44, 0x12, 0x98, 0xc9, 0xcb, 0x9b, 0x99,
+  0x88, 0x18, 0x55, 0x33, 0x02, 0x98, 0x08, 0xea, 0xbc, 0x8a, 0x10, 0x10,
+  0x22, 0x45, 0x22, 0x81, 0xa9, 0xdb, 0xab, 0xba, 0x8a, 0x61, 0x54, 0x23,
+  0xf9, 0xbc, 0x19, 0x23, 0x90, 0x0a, 0x57, 0x22, 0x90, 0xaa, 0x99, 0xba,
+  0xbd, 0x9a, 0x28, 0x53, 0x34, 0x02, 0x08, 0x24, 0xb1, 0xcf, 0x8a, 0x08,
+  0xa9, 0x1a, 0x62, 0x32, 0x11, 0x11, 0x81, 0xca, 0xbc, 0xbb, 0x9a, 0x42,
+  0x34, 0xd1, 0xaf, 0x40, 0x34, 0xd8, 0x9b, 0x63, 0x02, 0xb8, 0x8b, 0x43,
+  0xa0, 0xad, 0x09, 0x00, 0x18, 0x21, 0x01, 0x30, 0x44, 0xa1, 0xcc, 0x89,
+  0x91, 0xdb, 0x8a, 0x33, 0x24, 0x10, 0x22, 0x02, 0xbc, 0xcb, 0xba, 0xab,
+  0x31, 0x34, 0x43, 0x35, 0xc8, 0xcd, 0x19, 0x21, 0x80, 0x41, 0x53, 0x11,
+  0x24, 0x3d, 0x44, 0x00, 0x80, 0x90, 0xec, 0xac, 0x8a, 0x08, 0x01, 0x21,
+  0x44, 0x43, 0x11, 0x98, 0xaa, 0xbb, 0xcd, 0xab, 0x09, 0x32, 0x34, 0x53,
+  0x23, 0x80, 0xa9, 0xcb, 0xcc, 0xba, 0x09, 0x00, 0x42, 0x46, 0x24, 0xa0,
+  0xbd, 0xaa, 0x08, 0x21, 0x43, 0x24, 0x21, 0x23, 0x02, 0xfb, 0xbf, 0x9a,
+  0x89, 0x01, 0x11, 0x22, 0x45, 0x23, 0x81, 0xba, 0xbb, 0xbb, 0xcd, 0xab,
+  0x30, 0x43, 0x24, 0x43, 0x12, 0x90, 0xea, 0xbb, 0xba, 0x89, 0x18, 0x42,
+  0x37, 0x15, 0xe9, 0xac, 0x18, 0x23, 0xb0, 0x8a, 0x57, 0x22, 0x90, 0xaa,
+  0x89, 0xa9, 0xcd, 0xaa, 0x00, 0x42, 0x33, 0x12, 0x11, 0x33, 0x83, 0xef,
+  0x9a, 0x08, 0x99, 0x9b, 0x48, 0x34, 0x22, 0x11, 0x11, 0x81, 0xdb, 0xcc,
+  0x9a, 0x09, 0x22, 0x83, 0xef, 0x0a, 0x44, 0x02, 0xbc, 0x48, 0x35, 0x80,
+  0xab, 0x28, 0x83, 0xec, 0x9a, 0x08, 0x88, 0x11, 0x23, 0x10, 0x52, 0x15,
+  0xa0, 0xac, 0x18, 0xa8, 0xaf, 0x0a, 0x21, 0x11, 0x21, 0x34, 0x13, 0x80,
+  0xb9, 0xce, 0xab, 0x99, 0x08, 0x30, 0x35, 0x81, 0x0a, 0x52, 0x13, 0xb8,
+  0x1a, 0x44, 0x22, 0x11, 0xa1, 0xdf, 0xbb, 0x89, 0xaa, 0x9c, 0x40, 0x34,
+  0x24, 0x12, 0x12, 0x01, 0xc8, 0xcd, 0xac, 0x89, 0x09, 0x08, 0x43, 0x36,
+  0x02, 0x81, 0x98, 0xc9, 0xcb, 0xaa, 0xba, 0x0a, 0x42, 0x44, 0x34, 0x14,
+  0x90, 0xcd, 0x8a, 0x28, 0x11, 0x21, 0x33, 0x23, 0x22, 0xa0, 0xfe, 0xcc,
+  0xaa, 0x08, 0x21, 0x22, 0x32, 0x34, 0x25, 0x81, 0xcc, 0x9b, 0x80, 0xc9,
+  0x9c, 0x20, 0x24, 0x10, 0x20, 0x33, 0x03, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0x28, 0x77, 0x24, 0x91, 0xdd, 0x9a, 0x21, 0x02, 0x98, 0x58, 0x45, 0x13,
+  0x90, 0xba, 0xab, 0xba, 0xce, 0xab, 0x19, 0x53, 0x23, 0x12, 0x21, 0x34,
+  0x82, 0xec, 0xaa, 0x89, 0xc2, 0xef, 0x44, 0x00, 0xa9, 0xac, 0x29, 0x34,
+  0x24, 0x12, 0x23, 0x12, 0xa9, 0xcd, 0xcb, 0x9b, 0x20, 0x13, 0xfb, 0xaf,
+  0x30, 0x34, 0xa0, 0x8c, 0x64, 0x13, 0x98, 0x9b, 0x21, 0xb1, 0xbf, 0x9b,
+  0x08, 0x00, 0x10, 0x32, 0x33, 0x54, 0x14, 0xa0, 0xab, 0x88, 0xfa, 0xbc,
+  0x0a, 0x11, 0x01, 0x32, 0x45, 0x22, 0x10, 0x90, 0xda, 0xbb, 0x9b, 0x99,
+  0x89, 0xa8, 0xad, 0x72, 0x37, 0xa0, 0x9c, 0x62, 0x13, 0xc9, 0x8a, 0x42,
+  0x90, 0xbd, 0x88, 0x01, 0x98, 0x19, 0x22, 0x01, 0x53, 0x33, 0xb9, 0x0d,
+  0x21, 0xe8, 0xad, 0x18, 0x01, 0x99, 0x18, 0x25, 0x12, 0x81, 0x98, 0xba,
+  0x09, 0xc9, 0xcd, 0x29, 0x45, 0x02, 0xa9, 0x99, 0x00, 0x90, 0x88, 0x32,
+  0x35, 0x34, 0x11, 0x21, 0x00, 0xfc, 0xce, 0x99, 0x08, 0x80, 0x09, 0x51,
+  0x33, 0x23, 0x00, 0x88, 0x98, 0xca, 0xdc, 0xaa, 0x19, 0x00, 0x99, 0x30,
+  0x46, 0x23, 0x80, 0x09, 0x81, 0xaa, 0xde, 0x9b, 0x08, 0x52, 0x34, 0x03,
+  0xfb, 0x9e, 0x18, 0x11, 0x80, 0x88, 0x63, 0x34, 0x13, 0xb8, 0xbc, 0x99,
+  0xb9, 0xbf, 0x9c, 0x18, 0x33, 0x14, 0x81, 0x32, 0x35, 0x92, 0xdb, 0x9a,
+  0x89, 0xca, 0xac, 0x19, 0x22, 0x23, 0x22, 0x34, 0x24, 0x12, 0xb0, 0xcd,
+  0x8a, 0x00, 0xc9, 0xbe, 0xbd, 0x19, 0x43, 0x01, 0xab, 0x75, 0x25, 0x81,
+  0x89, 0x10, 0x81, 0xdc, 0xbb, 0x99, 0x98, 0x8a, 0x21, 0x42, 0x44, 0x33,
+  0x02, 0x88, 0x21, 0xc8, 0xcf, 0xaa, 0x88, 0xa9, 0x8a, 0x43, 0x35, 0x32,
+  0x22, 0x12, 0x80, 0xc9, 0xcc, 0xbb, 0xda, 0xcc, 0x0a, 0x43, 0x02, 0x8a,
+  0x75, 0x22, 0x91, 0x88, 0x22, 0xc8, 0xbc, 0xaa, 0xba, 0xac, 0x21, 0x03,
+  0x09, 0x65, 0x14, 0x90, 0x19, 0x23, 0xc0, 0xbc, 0x09, 0xa9, 0xbc, 0x09,
+  0x11, 0x11, 0x55, 0x14, 0x91, 0x08, 0x02, 0xe9, 0x70, 0x0f, 0x46, 0x00,
+  0xac, 0x08, 0x80, 0x88, 0x21, 0x81, 0x9a, 0x62, 0x23, 0x90, 0x48, 0x43,
+  0x02, 0x31, 0x12, 0xfc, 0xad, 0x88, 0xb9, 0xbc, 0x8a, 0x22, 0x24, 0x23,
+  0x22, 0x45, 0x24, 0x81, 0xcb, 0x99, 0xa8, 0xcd, 0xab, 0x08, 0x02, 0x11,
+  0x53, 0x33, 0x23, 0x23, 0xb0, 0xcc, 0xbb, 0xba, 0xaf, 0x19, 0x34, 0x81,
+  0xbb, 0x2a, 0x45, 0x22, 0x22, 0x21, 0x31, 0x46, 0x33, 0xd8, 0xbd, 0xbc,
+  0x9a, 0xbb, 0xcb, 0x9a, 0x62, 0x34, 0x13, 0x00, 0x63, 0x13, 0xb8, 0xac,
+  0x89, 0xa9, 0xbe, 0x9a, 0x10, 0x31, 0x32, 0x43, 0x53, 0x32, 0x81, 0xca,
+  0x9b, 0xb9, 0xdb, 0x8a, 0x90, 0xff, 0x9c, 0x30, 0x23, 0xa8, 0x39, 0x77,
+  0x22, 0x88, 0x09, 0x01, 0xa0, 0xbe, 0xac, 0x89, 0x99, 0x89, 0x28, 0x53,
+  0x43, 0x23, 0x11, 0x10, 0x01, 0xc9, 0xbe, 0x8b, 0xa8, 0xca, 0x8a, 0x42,
+  0x33, 0x33, 0x34, 0x23, 0x22, 0x80, 0xec, 0xbc, 0x09, 0xd8, 0xce, 0x8a,
+  0x41, 0x12, 0x9a, 0x60, 0x26, 0x02, 0x89, 0x18, 0x02, 0xda, 0xac, 0x9a,
+  0x9a, 0x8a, 0x08, 0x10, 0x51, 0x35, 0x02, 0x99, 0x62, 0x03, 0xc9, 0x8a,
+  0x11, 0xd8, 0xbc, 0x09, 0x80, 0x88, 0x20, 0x33, 0x42, 0x35, 0x02, 0xb9,
+  0x8b, 0x01, 0xfb, 0xac, 0xaa, 0x09, 0x41, 0x22, 0x88, 0x72, 0x36, 0x83,
+  0xa8, 0x28, 0x12, 0xea, 0xbc, 0x99, 0xa8, 0xb9, 0xa9, 0x00, 0x42, 0x24,
+  0x00, 0x41, 0x43, 0x12, 0x98, 0x10, 0x23, 0xd9, 0xbd, 0x9a, 0x9a, 0xcb,
+  0xac, 0x28, 0x53, 0x22, 0x21, 0x54, 0x14, 0x98, 0xba, 0x09, 0x08, 0xed,
+  0xbc, 0x9b, 0x30, 0x44, 0x02, 0x31, 0x46, 0x33, 0x11, 0x98, 0xbb, 0xcc,
+  0xac, 0xbc, 0xcb, 0x9a, 0x21, 0x13, 0x01, 0x41, 0x36, 0x13, 0xa8, 0x19,
+  0x34, 0xa1, 0xbc, 0x2a, 0x02, 0xfb, 0xbc, 0x19, 0x90, 0x98, 0x20, 0x25,
+  0xb8, 0xf7, 0x38, 0x00, 0x32, 0x12, 0x12, 0x00, 0x10, 0x98, 0xdc, 0xfd,
+  0xac, 0x28, 0x24, 0xc8, 0x8c, 0x64, 0x23, 0xa8, 0x1a, 0x44, 0x92, 0xcc,
+  0x8a, 0x10, 0xb9, 0xad, 0x19, 0x01, 0x80, 0x20, 0x23, 0x22, 0x42, 0x13,
+  0xc9, 0x8b, 0x43, 0xb1, 0xbd, 0x30, 0x25, 0xca, 0x9c, 0x10, 0x81, 0xbb,
+  0x09, 0x24, 0x82, 0x31, 0x34, 0x33, 0x24, 0xfa, 0xef, 0x08, 0x11, 0xb8,
+  0x8b, 0x55, 0x13, 0x80, 0x18, 0x24, 0xa1, 0xbb, 0x9b, 0xcb, 0xad, 0x9a,
+  0xaa, 0x0a, 0x43, 0x13, 0x00, 0x72, 0x24, 0x98, 0x99, 0x32, 0x92, 0xbd,
+  0x09, 0x81, 0xcb, 0x8a, 0x12, 0x01, 0x42, 0x15, 0x91, 0x00, 0x34, 0xc1,
+  0x9b, 0x31, 0x14, 0xf0, 0xfb, 0x8a, 0x22, 0xb1, 0xbe, 0x40, 0x26, 0x98,
+  0x18, 0x43, 0x82, 0xa9, 0x00, 0xa0, 0xbe, 0x9b, 0xa1, 0xdb, 0x1a, 0x22,
+  0x83, 0x98, 0x73, 0x12, 0xb8, 0x8a, 0x10, 0xc9, 0x9d, 0x20, 0x10, 0x08,
+  0x73, 0x23, 0x80, 0x28, 0x23, 0xd0, 0xac, 0x21, 0xb1, 0xda, 0x30, 0x36,
+  0xf9, 0x9c, 0x31, 0x93, 0xde, 0x19, 0x33, 0x90, 0x0a, 0x64, 0x12, 0x99,
+  0x28, 0x81, 0xcc, 0x9b, 0x01, 0xda, 0x9b, 0x31, 0x12, 0x99, 0x50, 0x33,
+  0x91, 0xab, 0x1a, 0xb8, 0xef, 0x09, 0x10, 0x81, 0x18, 0x32, 0x34, 0x12,
+  0x30, 0x30, 0x95, 0xac, 0x09, 0xa8, 0xcb, 0x3a, 0x43, 0xf8, 0x8e, 0x43,
+  0x92, 0xbe, 0x18, 0x24, 0xa8, 0x0a, 0x34, 0x84, 0x99, 0x11, 0x91, 0xcc,
+  0x99, 0x90, 0xbc, 0x0b, 0x34, 0x91, 0x08, 0x41, 0x14, 0xc9, 0xab, 0x00,
+  0xe9, 0xcb, 0x09, 0x12, 0x81, 0x31, 0x56, 0x00, 0x00, 0x31, 0x12, 0xab,
+  0x0a, 0x12, 0xd0, 0x8d, 0x53, 0xa3, 0xae, 0x19, 0x33, 0xf9, 0x9e, 0x20,
+  0x02, 0x08, 0x50, 0x33, 0x82, 0x10, 0x02, 0xe8, 0xcb, 0x99, 0xb9, 0xad,
+  0x29, 0x22, 0xb0, 0x1a, 0x15, 0xf6, 0x30, 0x00, 0x46, 0x01, 0xaa, 0x38,
+  0x13, 0xed, 0x9b, 0x08, 0x88, 0xba, 0x61, 0x24, 0x11, 0x11, 0x52, 0x22,
+  0xaa, 0x8c, 0x88, 0xdb, 0x9b, 0x32, 0x14, 0xc0, 0x20, 0x44, 0x83, 0xbe,
+  0x8a, 0x12, 0xa0, 0x19, 0x55, 0x02, 0x20, 0x12, 0x99, 0xdc, 0xab, 0xc9,
+  0xab, 0x10, 0x43, 0x93, 0x19, 0x61, 0x01, 0xc9, 0xbb, 0x28, 0xda, 0xad,
+  0x00, 0x11, 0xa8, 0x38, 0x54, 0x02, 0x51, 0x11, 0x91, 0x9b, 0x23, 0xdc,
+  0x8c, 0x08, 0x81, 0x89, 0x72, 0x15, 0x08, 0x19, 0x32, 0xf8, 0xac, 0x08,
+  0x98, 0x8a, 0x62, 0x34, 0x03, 0x10, 0x01, 0xa1, 0xdd, 0xba, 0xab, 0xca,
+  0x89, 0x21, 0x44, 0x33, 0x22, 0x12, 0x91, 0xdd, 0xad, 0xaa, 0xac, 0x9a,
+  0x28, 0x42, 0x15, 0x33, 0x43, 0x11, 0x81, 0xaa, 0xcc, 0xbc, 0xaa, 0xaa,
+  0x18, 0x71, 0x33, 0x34, 0x33, 0x03, 0x11, 0xa8, 0xae, 0xac, 0x9a, 0x9c,
+  0x19, 0x13, 0x12, 0x64, 0x33, 0xa2, 0xac, 0x11, 0xd1, 0xec, 0x8a, 0x10,
+  0x88, 0x09, 0x50, 0x03, 0x90, 0x80, 0x90, 0xcc, 0xcb, 0x18, 0xa9, 0x8b,
+  0x54, 0x22, 0x81, 0x21, 0x73, 0xc3, 0xbc, 0x98, 0x99, 0x98, 0x2a, 0x27,
+  0x22, 0x33, 0x34, 0x25, 0x91, 0x89, 0xab, 0xcd, 0xbe, 0x09, 0x08, 0x10,
+  0x42, 0x35, 0x33, 0x21, 0x02, 0xc0, 0xcd, 0xab, 0xbb, 0xbc, 0x8b, 0x12,
+  0x42, 0x53, 0x33, 0x12, 0x98, 0x99, 0xcd, 0xbc, 0x9c, 0x00, 0x90, 0x21,
+  0x72, 0x02, 0x92, 0x00, 0xba, 0xbb, 0xa9, 0x8a, 0x8a, 0x70, 0x63, 0x34,
+  0x10, 0x82, 0x13, 0xa0, 0xbc, 0x0c, 0x08, 0x8c, 0x10, 0x53, 0x43, 0x38,
+  0x34, 0x23, 0xa2, 0xdd, 0xbc, 0xac, 0xab, 0x8a, 0xaa, 0x28, 0x56, 0x13,
+  0x22, 0x22, 0x28, 0xba, 0xbf, 0xa9, 0xae, 0x9a, 0x89, 0x88, 0x22, 0x16,
+  0x43, 0x18, 0x10, 0x18, 0xcb, 0xbb, 0x9c, 0x12, 0xf7, 0xf7, 0x2b, 0x00,
+  0xa0, 0x3b, 0x36, 0x20, 0x88, 0x00, 0x83, 0x74, 0x28, 0x28, 0x52, 0x23,
+  0x22, 0x08, 0x33, 0x03, 0xfc, 0x9a, 0xaa, 0xab, 0x80, 0x0c, 0x43, 0x38,
+  0x34, 0xc3, 0x30, 0xf0, 0xa8, 0xcd, 0xac, 0xaa, 0xa9, 0x89, 0x22, 0x25,
+  0x71, 0x12, 0x80, 0xa0, 0x80, 0xa9, 0xfb, 0x9b, 0x89, 0xa9, 0x38, 0x38,
+  0x73, 0x12, 0x80, 0x30, 0x02, 0x48, 0x30, 0x04, 0x43, 0x54, 0x80, 0xb0,
+  0x80, 0x84, 0x3b, 0x04, 0x73, 0x10, 0xa2, 0x20, 0x80, 0x08, 0xdf, 0x99,
+  0xa8, 0xbc, 0xa9, 0x08, 0x0e, 0x08, 0x14, 0x82, 0x0a, 0xb8, 0x8b, 0xfb,
+  0xab, 0x08, 0x83, 0xc0, 0x3b, 0xb4, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x78,
+  0x04, 0xc3, 0x0b, 0x48, 0x17, 0xa2, 0x0c, 0x28, 0x08, 0x08, 0x08, 0x34,
+  0x70, 0x02, 0x01, 0x20, 0x84, 0x30, 0x03, 0x58, 0x43, 0x83, 0xf0, 0x88,
+  0x80, 0xb0, 0x8b, 0x80, 0xbd, 0x08, 0x8c, 0xd0, 0xbb, 0xc0, 0x9f, 0xba,
+  0x28, 0x80, 0x30, 0x43, 0x84, 0x80, 0xdb, 0xb0, 0x8b, 0xfc, 0x80, 0x82,
+  0x32, 0x32, 0x43, 0x3b, 0x80, 0xc8, 0xbc, 0xbc, 0x80, 0x40, 0x48, 0x17,
+  0x14, 0x81, 0x00, 0xa1, 0x80, 0x80, 0x07, 0x80, 0x53, 0x14, 0x80, 0x08,
+  0x80, 0x08, 0xaf, 0xc9, 0x08, 0x82, 0x02, 0xb8, 0x84, 0xc0, 0xfb, 0x99,
+  0x08, 0xba, 0xba, 0xb8, 0x8c, 0xc0, 0x03, 0x03, 0x0d, 0x08, 0x58, 0xcb,
+  0x30, 0x48, 0x80, 0x80, 0x0d, 0x0c, 0xac, 0x3b, 0x40, 0x33, 0x40, 0x27,
+  0x21, 0x80, 0x80, 0xc0, 0x83, 0x4b, 0x08, 0xc8, 0x34, 0x73, 0x21, 0x80,
+  0x62, 0x10, 0xaa, 0x00, 0x02, 0xc8, 0x4b, 0x08, 0xb8, 0x8c, 0x80, 0xd0,
+  0xb8, 0xc8, 0xbc, 0x00, 0x3c, 0x08, 0xbd, 0x0b, 0x08, 0xbd, 0xc8, 0x0b,
+  0x0d, 0x8b, 0x00, 0x84, 0x04, 0x08, 0x08, 0xe8, 0x80, 0x40, 0x80, 0x04,
+  0x0a, 0xfb, 0x24, 0x00, 0x84, 0x84, 0xb4, 0x30, 0x97, 0x01, 0x38, 0xb8,
+  0x30, 0x85, 0x80, 0x80, 0x35, 0x88, 0x04, 0x08, 0x08, 0x45, 0x0b, 0x17,
+  0x20, 0x82, 0x80, 0x80, 0xaf, 0xa8, 0x0a, 0xbb, 0x43, 0x30, 0x80, 0x80,
+  0xfe, 0x9b, 0x9c, 0x9a, 0xaa, 0x9d, 0xa8, 0x32, 0x32, 0x8b, 0x40, 0x34,
+  0x8b, 0xfc, 0x80, 0x10, 0xda, 0x39, 0x22, 0x3a, 0x02, 0x30, 0x50, 0x08,
+  0x3c, 0x34, 0x33, 0x80, 0x50, 0x80, 0x8c, 0x4c, 0xe8, 0x28, 0x82, 0x80,
+  0x73, 0x21, 0x28, 0x50, 0x08, 0xaa, 0x8a, 0x80, 0x08, 0x80, 0x05, 0x34,
+  0xb8, 0xbd, 0x4b, 0xbb, 0xec, 0x08, 0x0a, 0xa8, 0xb8, 0x0c, 0x08, 0xbc,
+  0x3c, 0xcb, 0xc0, 0x80, 0x03, 0x08, 0x70, 0x04, 0x82, 0x08, 0x80, 0x08,
+  0x80, 0xbe, 0x48, 0x80, 0x40, 0x80, 0x44, 0x48, 0x38, 0x80, 0x80, 0x85,
+  0x80, 0x80, 0x00, 0x78, 0x30, 0x80, 0x0d, 0x48, 0x80, 0x80, 0x80, 0x60,
+  0x80, 0xcc, 0x73, 0x01, 0x28, 0xa8, 0x83, 0xc0, 0x80, 0x8b, 0x80, 0xb5,
+  0x8c, 0x80, 0xcc, 0xbb, 0x40, 0xfb, 0x0a, 0x08, 0xa8, 0x8b, 0x84, 0x80,
+  0xd0, 0xb0, 0x03, 0x08, 0x88, 0x70, 0x80, 0x80, 0x50, 0x84, 0x0b, 0x48,
+  0x80, 0x17, 0x82, 0x80, 0x43, 0xb8, 0x80, 0xd0, 0x8b, 0x04, 0x08, 0x04,
+  0x03, 0xe0, 0x80, 0x0c, 0x08, 0x84, 0x80, 0x80, 0x86, 0xc0, 0x4b, 0x08,
+  0x8b, 0x74, 0x21, 0x28, 0x38, 0xb2, 0x80, 0xbc, 0xd0, 0xba, 0xfb, 0x0c,
+  0x08, 0xaa, 0x80, 0x80, 0x80, 0xc0, 0x0c, 0x08, 0x08, 0xbd, 0x48, 0x03,
+  0x8c, 0x34, 0x83, 0x3c, 0x07, 0xa2, 0x08, 0x08, 0x08, 0xbc, 0xc8, 0x30,
+  0x34, 0x80, 0x80, 0x36, 0x08, 0xc8, 0x48, 0x80, 0x04, 0xc8, 0x80, 0xd0,
+  0x80, 0x34, 0xb8, 0x03, 0x35, 0x80, 0x80, 0x80, 0x80, 0x70, 0x00, 0x08,
+  0x78, 0xc0, 0x80, 0x03, 0x00, 0x05, 0x24, 0x00, 0x80, 0x85, 0x80, 0x8f,
+  0xba, 0xba, 0xcb, 0xc0, 0x3a, 0x83, 0xd0, 0x0b, 0xb3, 0x0d, 0xc8, 0x80,
+  0x40, 0x03, 0x08, 0x58, 0x34, 0xfb, 0x0a, 0x08, 0x82, 0x30, 0x03, 0x80,
+  0x60, 0x83, 0x40, 0x8b, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0x80,
+  0x78, 0xd1, 0x80, 0x80, 0x05, 0x03, 0xd8, 0x03, 0x8c, 0x8b, 0x80, 0x60,
+  0x48, 0x83, 0x34, 0x03, 0x48, 0xc0, 0xb8, 0x8c, 0x80, 0x80, 0xf0, 0x8a,
+  0xc0, 0xbb, 0x80, 0xd0, 0xb8, 0x8c, 0x80, 0x80, 0x80, 0xf0, 0x03, 0x88,
+  0x00, 0x88, 0xf0, 0x48, 0x08, 0x84, 0x7b, 0x00, 0x08, 0x38, 0x03, 0x08,
+  0x08, 0x88, 0x00, 0xf8, 0x0e, 0x08, 0x48, 0x38, 0x27, 0x08, 0xa8, 0x80,
+  0x80, 0x0c, 0x08, 0xd8, 0x03, 0x84, 0xc0, 0x48, 0x08, 0x08, 0x80, 0x05,
+  0x84, 0x4b, 0x08, 0x58, 0xb8, 0x84, 0x80, 0x3c, 0xc0, 0x08, 0x04, 0x8c,
+  0x80, 0x8b, 0x68, 0xfb, 0x99, 0xca, 0x0a, 0xb0, 0xb0, 0x8a, 0x34, 0x48,
+  0x83, 0x48, 0x0b, 0x08, 0x08, 0x78, 0x08, 0x08, 0x40, 0x07, 0x02, 0x82,
+  0x80, 0x8b, 0x85, 0x8e, 0x0c, 0x28, 0xa8, 0x33, 0x08, 0x88, 0x05, 0x08,
+  0x08, 0x08, 0x08, 0x78, 0x81, 0x80, 0x0e, 0x88, 0x0c, 0xf8, 0x21, 0x08,
+  0xf8, 0x10, 0x82, 0x80, 0x38, 0x80, 0x40, 0x4b, 0x48, 0x83, 0x40, 0x08,
+  0xb4, 0xbc, 0x3b, 0xc0, 0xc8, 0xfb, 0x08, 0x08, 0xad, 0x82, 0xb9, 0x80,
+  0x4b, 0x08, 0x08, 0x58, 0xc0, 0x48, 0xb8, 0x24, 0x03, 0x3c, 0x03, 0xcc,
+  0x33, 0x08, 0x08, 0x78, 0x82, 0x30, 0x08, 0x08, 0xb5, 0xc8, 0x03, 0xd8,
+  0x80, 0x04, 0x03, 0x08, 0x08, 0x08, 0x78, 0x81, 0x80, 0x0e, 0x08, 0x0d,
+  0x0c, 0xb8, 0x40, 0x48, 0xb8, 0x84, 0x03, 0x84, 0x40, 0x08, 0xb4, 0x48,
+  0xcb, 0x0b, 0xac, 0x33, 0x80, 0x50, 0x3b, 0xd0, 0xfa, 0x01, 0x26, 0x00,
+  0x8b, 0xd0, 0x0b, 0x0c, 0x43, 0x8b, 0xcb, 0x08, 0x8c, 0x80, 0xbc, 0x48,
+  0x40, 0xb8, 0x08, 0x08, 0x08, 0x78, 0x04, 0x48, 0x08, 0x08, 0x44, 0xb8,
+  0x8b, 0x08, 0x45, 0x48, 0x38, 0x03, 0x08, 0x8d, 0x8b, 0x80, 0xe0, 0x03,
+  0x34, 0x08, 0x08, 0x0e, 0x8b, 0x84, 0x8b, 0xd0, 0x48, 0xb3, 0xc8, 0x80,
+  0x40, 0x84, 0x80, 0x04, 0xc8, 0x80, 0xd0, 0x80, 0x3c, 0xc0, 0x80, 0x80,
+  0x80, 0x36, 0x08, 0x88, 0x8c, 0x85, 0x80, 0xd0, 0xb3, 0x08, 0xed, 0xa0,
+  0x0a, 0x08, 0x08, 0x48, 0x30, 0x80, 0x80, 0x80, 0xf0, 0x8c, 0x0b, 0x88,
+  0xcc, 0x83, 0x8b, 0x78, 0x15, 0x12, 0x02, 0x83, 0x30, 0xd0, 0x80, 0x80,
+  0x04, 0x84, 0xc0, 0x8b, 0x80, 0x80, 0x80, 0x80, 0x80, 0x70, 0x82, 0x80,
+  0x80, 0x80, 0x3f, 0x0e, 0xc8, 0xc0, 0x83, 0x34, 0x37, 0x01, 0xc8, 0xbe,
+  0xbb, 0x19, 0x62, 0x14, 0x81, 0x00, 0x0a, 0xcb, 0x98, 0x10, 0x02, 0x20,
+  0x0b, 0x08, 0x8d, 0x80, 0x80, 0xe0, 0xcb, 0x0b, 0x48, 0x43, 0x73, 0x08,
+  0x98, 0xba, 0xba, 0x8b, 0x34, 0xc0, 0x3b, 0x0c, 0x08, 0x08, 0x05, 0x88,
+  0x00, 0x08, 0x37, 0x34, 0xb8, 0x0d, 0x33, 0x08, 0x58, 0x30, 0x40, 0xb4,
+  0x08, 0xc8, 0xac, 0xac, 0x1f, 0x80, 0x40, 0x21, 0x08, 0x02, 0xbb, 0x08,
+  0x08, 0x08, 0x06, 0xc8, 0xbc, 0x30, 0x07, 0x80, 0xb0, 0xb0, 0x08, 0xbf,
+  0x2a, 0x30, 0x33, 0x80, 0x50, 0x8b, 0xd0, 0x08, 0x8c, 0x80, 0x50, 0xc3,
+  0x30, 0x80, 0x9f, 0x83, 0x02, 0x80, 0xd0, 0x80, 0x84, 0x03, 0x84, 0xcb,
+  0x08, 0x08, 0xfd, 0x19, 0x80, 0x50, 0x01, 0x8a, 0x20, 0x00, 0x88, 0x00,
+  0xbe, 0x43, 0x9e, 0x41, 0x80, 0x80, 0x20, 0x80, 0xb8, 0xd8, 0x30, 0x80,
+  0x9f, 0x08, 0x60, 0x22, 0x28, 0xea, 0x08, 0x08, 0xab, 0xb8, 0x40, 0x17,
+  0xf5, 0x00, 0x2d, 0x00, 0x01, 0x80, 0x08, 0x06, 0xae, 0x09, 0x16, 0x08,
+  0xdb, 0x31, 0xba, 0x01, 0x89, 0x91, 0x8c, 0x70, 0x17, 0x99, 0x89, 0x89,
+  0x00, 0xc0, 0x38, 0xa2, 0x41, 0xf0, 0x29, 0x82, 0x81, 0x89, 0x88, 0x0b,
+  0xaa, 0x1d, 0x46, 0x82, 0xaa, 0xb0, 0x89, 0x80, 0x62, 0x11, 0x01, 0xaa,
+  0xe0, 0x9b, 0x91, 0x58, 0x43, 0xb8, 0xa9, 0x82, 0x83, 0x84, 0x0b, 0x43,
+  0x80, 0xbc, 0x4b, 0x48, 0x38, 0xc0, 0x03, 0xbc, 0xc8, 0x80, 0x34, 0x84,
+  0x84, 0x8e, 0x20, 0x2a, 0x80, 0x03, 0x84, 0xcb, 0x8b, 0xfc, 0x30, 0x08,
+  0x38, 0x02, 0x08, 0x88, 0x4c, 0xc3, 0x80, 0x80, 0xd0, 0x3b, 0x04, 0x07,
+  0x08, 0x08, 0xbe, 0xa9, 0x8c, 0x22, 0x22, 0x80, 0x80, 0x80, 0x80, 0xf0,
+  0x08, 0x84, 0xf0, 0x48, 0xab, 0x22, 0x22, 0xab, 0xb8, 0x08, 0x08, 0x88,
+  0x0f, 0x73, 0x92, 0x8d, 0x00, 0x88, 0x00, 0xb2, 0x40, 0xc3, 0xbb, 0x84,
+  0x70, 0x80, 0x80, 0xb0, 0x80, 0x7b, 0x94, 0x08, 0xa2, 0x3b, 0x08, 0xc8,
+  0x30, 0xb4, 0xb4, 0x8b, 0x04, 0x0c, 0x78, 0x10, 0xa0, 0x08, 0xae, 0x89,
+  0x20, 0x83, 0x80, 0x80, 0x0d, 0xc3, 0x0b, 0x8f, 0x08, 0x38, 0x07, 0x00,
+  0x28, 0x8a, 0x8d, 0x80, 0x80, 0x30, 0x24, 0xbb, 0xbc, 0x48, 0x43, 0x06,
+  0x8a, 0x20, 0x8a, 0xc0, 0x3b, 0x80, 0x35, 0x08, 0x08, 0x8d, 0x8b, 0x8f,
+  0x08, 0xb8, 0x03, 0x78, 0x81, 0x80, 0x0b, 0x84, 0x03, 0xaf, 0x08, 0x22,
+  0xf0, 0x10, 0x01, 0xa2, 0xb8, 0xbb, 0x08, 0x75, 0x91, 0x08, 0x08, 0x08,
+  0x88, 0x8f, 0x80, 0x80, 0xc0, 0x30, 0x26, 0x8a, 0xaa, 0x83, 0x80, 0x8c,
+  0x40, 0x84, 0x80, 0x80, 0x0d, 0x0c, 0x08, 0x48, 0x40, 0x83, 0x00, 0x88,
+  0x00, 0x37, 0xc0, 0xcb, 0x08, 0x80, 0xc8, 0x8c, 0x07, 0x28, 0x02, 0xb8,
+  0x80, 0x8b, 0xf8, 0x89, 0xf3, 0xfd, 0x27, 0x00, 0x30, 0x03, 0x08, 0x80,
+  0x0f, 0x33, 0x80, 0xbd, 0x8b, 0x80, 0x78, 0x08, 0x08, 0x8c, 0x07, 0x08,
+  0x8a, 0x30, 0x08, 0x08, 0x08, 0x8e, 0x04, 0x88, 0x00, 0xd8, 0x48, 0x80,
+  0x80, 0x0d, 0x0c, 0x48, 0x08, 0x08, 0xbd, 0x4b, 0x38, 0xb4, 0x43, 0x33,
+  0x80, 0xc8, 0x08, 0xd8, 0x08, 0x07, 0x89, 0x08, 0x8b, 0x40, 0x80, 0x85,
+  0x80, 0x40, 0x8b, 0x08, 0xf0, 0x30, 0x0c, 0x38, 0x40, 0x08, 0xb4, 0xbc,
+  0x80, 0xb4, 0x80, 0x80, 0xe8, 0x80, 0x80, 0x80, 0xbe, 0x53, 0x08, 0x08,
+  0x08, 0x08, 0x3e, 0x08, 0xc8, 0x8c, 0x80, 0x80, 0xb6, 0x78, 0x00, 0xa1,
+  0x80, 0x80, 0x80, 0x8c, 0x00, 0xe8, 0x80, 0x34, 0x48, 0x38, 0x00, 0xd8,
+  0x03, 0x08, 0xd8, 0x08, 0x08, 0x8d, 0x40, 0x40, 0x0c, 0x0b, 0x88, 0x17,
+  0x82, 0xba, 0x08, 0x08, 0xd8, 0x48, 0x0b, 0x08, 0x85, 0x80, 0x3c, 0xb4,
+  0x84, 0x0b, 0x08, 0x8d, 0x34, 0x08, 0x08, 0x08, 0x08, 0x08, 0x9f, 0x80,
+  0x80, 0x80, 0x8f, 0x40, 0x0c, 0x3b, 0xd0, 0x80, 0x8b, 0x40, 0x80, 0xb5,
+  0x48, 0x80, 0x80, 0x50, 0xb4, 0x8b, 0x80, 0x0d, 0x0c, 0x83, 0x0c, 0x08,
+  0x08, 0xe8, 0x30, 0x80, 0x80, 0x70, 0x8b, 0x80, 0x80, 0x86, 0x40, 0x8b,
+  0x4b, 0x08, 0x3c, 0xb4, 0x83, 0x00, 0x58, 0x8b, 0x8c, 0x3c, 0xb4, 0x80,
+  0x80, 0xf5, 0x10, 0x0a, 0x08, 0x08, 0x80, 0x58, 0x83, 0xc0, 0xc3, 0x80,
+  0xc0, 0x78, 0x09, 0xa8, 0x80, 0x80, 0x80, 0x40, 0x0c, 0x48, 0x0b, 0x48,
+  0x80, 0x3c, 0x00, 0x58, 0xb4, 0x80, 0xc8, 0x80, 0x04, 0x8c, 0x40, 0x08,
+  0x08, 0xe0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0xb6, 0x24, 0x40, 0xc3, 0x3a,
+  0x83, 0x80, 0xbd, 0x08, 0x58, 0x0b, 0x48, 0x80, 0x80, 0xe0, 0xb3, 0x48,
+  0x8b, 0x85, 0x80, 0xd0, 0x80, 0x80, 0x80, 0xe0, 0x0c, 0xff, 0x26, 0x00,
+  0x7b, 0x80, 0x80, 0x80, 0x48, 0x08, 0x08, 0xb4, 0x3c, 0x03, 0x88, 0x8c,
+  0x8c, 0xd0, 0x30, 0x08, 0x40, 0xb4, 0xc0, 0x08, 0xf8, 0x81, 0x8a, 0x87,
+  0x82, 0x10, 0x80, 0x80, 0x80, 0xb4, 0x80, 0x8c, 0x04, 0x48, 0x80, 0xd0,
+  0xb3, 0x08, 0x08, 0xe8, 0x8b, 0x80, 0x00, 0x88, 0x80, 0x00, 0x78, 0x62,
+  0x80, 0x58, 0x0b, 0x08, 0x0d, 0xc8, 0x80, 0xb4, 0x80, 0x80, 0x50, 0xb8,
+  0x08, 0xc5, 0x80, 0x40, 0x08, 0x08, 0x8d, 0xf0, 0x48, 0x98, 0x08, 0x02,
+  0x08, 0x0c, 0x88, 0x8b, 0x08, 0x3e, 0x8b, 0x80, 0x60, 0x08, 0xc8, 0x08,
+  0x08, 0x78, 0x05, 0x28, 0x80, 0x80, 0x80, 0xf0, 0x2c, 0x0a, 0x08, 0x3b,
+  0x97, 0x2a, 0x80, 0x08, 0x80, 0x58, 0xbb, 0x48, 0x80, 0x04, 0xc8, 0x30,
+  0x40, 0x84, 0xbb, 0x03, 0x85, 0xc0, 0x80, 0x8c, 0x04, 0xc8, 0x3a, 0xc8,
+  0x1f, 0x80, 0x40, 0x80, 0x80, 0x80, 0x0b, 0x84, 0x80, 0x3c, 0x00, 0x3d,
+  0x8f, 0x82, 0xb0, 0x30, 0x03, 0xcc, 0x33, 0xb8, 0x84, 0xcb, 0x08, 0x84,
+  0x80, 0x50, 0xb8, 0x84, 0x80, 0x85, 0x8b, 0x4b, 0x08, 0x8c, 0x04, 0x0c,
+  0x33, 0xbc, 0x30, 0x8f, 0x08, 0x95, 0x28, 0x08, 0x80, 0x48, 0x80, 0x80,
+  0x00, 0x88, 0xf0, 0x88, 0x80, 0x80, 0x00, 0x88, 0x17, 0x9f, 0x02, 0x08,
+  0x3c, 0x80, 0x8f, 0x82, 0x20, 0x80, 0x80, 0x40, 0x0c, 0x08, 0xb4, 0x08,
+  0xc4, 0xc0, 0x30, 0x08, 0x58, 0x80, 0x80, 0xe0, 0x80, 0x80, 0x80, 0x60,
+  0xc3, 0x3a, 0x0c, 0x08, 0x88, 0x00, 0x88, 0xf0, 0x3c, 0xb8, 0x34, 0x48,
+  0x03, 0x80, 0xb5, 0x08, 0x0d, 0x08, 0x84, 0xcb, 0x08, 0xc8, 0x03, 0x44,
+  0x3b, 0x80, 0x80, 0x80, 0xce, 0x30, 0x08, 0x0d, 0x83, 0x8b, 0x08, 0xbe,
+  0x48, 0x03, 0x3c, 0x80, 0xb5, 0x3b, 0x04, 0xc8, 0x30, 0x80, 0x0d, 0xc8,
+  0xf5, 0xfe, 0x26, 0x00, 0x8b, 0x07, 0xa2, 0x80, 0x80, 0x3f, 0x10, 0x0a,
+  0x02, 0x30, 0xbc, 0x48, 0xc0, 0x80, 0x80, 0x8c, 0x04, 0xbc, 0x30, 0x40,
+  0xc0, 0xb8, 0x34, 0x08, 0x04, 0x8c, 0x80, 0xd0, 0xc0, 0x83, 0x8b, 0x50,
+  0x83, 0x80, 0x80, 0xf0, 0x7b, 0x91, 0x98, 0x08, 0x02, 0x08, 0x08, 0x08,
+  0x78, 0x83, 0xc0, 0x48, 0x0b, 0xc8, 0x30, 0xb4, 0xc8, 0x84, 0x0b, 0x08,
+  0x08, 0xe8, 0x03, 0xbc, 0x08, 0x08, 0x68, 0xb3, 0xb4, 0x0c, 0x48, 0xb8,
+  0x43, 0x84, 0x4b, 0x08, 0x08, 0x8c, 0x8f, 0x80, 0xa0, 0x08, 0xc8, 0x33,
+  0x97, 0x89, 0xa2, 0x32, 0x80, 0xbc, 0x43, 0x80, 0x80, 0x8c, 0x35, 0x83,
+  0x0c, 0x08, 0x58, 0x80, 0x0c, 0xc8, 0xc0, 0x0b, 0x03, 0x04, 0xcc, 0x80,
+  0x24, 0x4b, 0x08, 0x1f, 0x01, 0x80, 0x80, 0x08, 0x80, 0xc8, 0x8c, 0x07,
+  0x08, 0x08, 0x38, 0x0b, 0x84, 0x8b, 0x50, 0xb8, 0xc8, 0x03, 0xd8, 0x0b,
+  0xc4, 0x83, 0x70, 0xa2, 0x20, 0x0b, 0xf8, 0x89, 0x20, 0xb2, 0xb3, 0x43,
+  0x48, 0x08, 0x3b, 0xd0, 0x3b, 0x40, 0xcb, 0x30, 0x48, 0x0b, 0x08, 0x04,
+  0x08, 0x0e, 0xb8, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0xb7, 0x06, 0xc8,
+  0x03, 0x58, 0xc0, 0x30, 0x0c, 0x48, 0x8e, 0x22, 0xba, 0xb0, 0x30, 0xbc,
+  0x03, 0xc8, 0x34, 0xbc, 0x40, 0x8b, 0x80, 0x50, 0x83, 0x80, 0x4c, 0x83,
+  0x0c, 0x03, 0x8c, 0x80, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x08, 0x0f, 0x0c,
+  0x8b, 0x40, 0xc0, 0x08, 0x48, 0x80, 0x0c, 0x48, 0xb3, 0x08, 0x50, 0x08,
+  0x8c, 0x04, 0x0c, 0x0c, 0x33, 0xc3, 0x03, 0x70, 0xa0, 0xb0, 0x80, 0xb4,
+  0x3b, 0xb5, 0x30, 0xbc, 0x0b, 0x84, 0x84, 0x80, 0x40, 0x8b, 0x40, 0x04,
+  0x08, 0x08, 0xe8, 0x30, 0xd0, 0x0b, 0xbc, 0x80, 0xb4, 0x4b, 0x78, 0xa0,
+  0x0a, 0x32, 0x0b, 0x8c, 0xdd, 0xfd, 0x26, 0x00, 0x84, 0x0b, 0x84, 0x30,
+  0x80, 0x1f, 0x22, 0xb3, 0x48, 0x80, 0x80, 0x00, 0x88, 0x0f, 0x88, 0xb5,
+  0x03, 0xff, 0xef, 0x58, 0x25, 0x91, 0xae, 0x10, 0xb0, 0x0c, 0x45, 0x81,
+  0xac, 0x20, 0xb1, 0x9d, 0x53, 0x12, 0xb8, 0xca, 0x8a, 0x62, 0x22, 0xa8,
+  0xdb, 0x19, 0x02, 0x18, 0x63, 0x91, 0xbc, 0x9c, 0x41, 0x33, 0xc1, 0x8e,
+  0x10, 0x08, 0x31, 0x84, 0xda, 0x9a, 0x38, 0x03, 0xaa, 0x64, 0xa2, 0xad,
+  0x28, 0x11, 0x80, 0x99, 0xaa, 0x0a, 0x64, 0x02, 0xa8, 0x9a, 0x98, 0x88,
+  0x42, 0x14, 0x80, 0xc9, 0xac, 0x28, 0x24, 0x40, 0x02, 0xcd, 0x29, 0x83,
+  0xdc, 0x09, 0x22, 0x00, 0x08, 0x34, 0xf9, 0x1b, 0x24, 0xc8, 0x0a, 0x02,
+  0x88, 0x31, 0xb2, 0xaf, 0x28, 0x82, 0x40, 0x33, 0xf8, 0xac, 0x21, 0x81,
+  0x18, 0x15, 0xfa, 0x19, 0x22, 0xa0, 0x09, 0x01, 0xc9, 0x09, 0x10, 0x10,
+  0x08, 0xfb, 0x3a, 0x36, 0xb1, 0x9d, 0x21, 0xa8, 0x0a, 0x36, 0x91, 0xaa,
+  0x9b, 0x18, 0x36, 0x03, 0xba, 0x08, 0xd9, 0x1a, 0x45, 0x83, 0xbc, 0x99,
+  0x89, 0x19, 0x54, 0x12, 0xea, 0xbd, 0x29, 0x25, 0x82, 0xa9, 0xb9, 0x09,
+  0x54, 0x12, 0x90, 0xbb, 0xad, 0x31, 0x34, 0x02, 0xdb, 0xaa, 0x99, 0x72,
+  0x23, 0x91, 0xcb, 0xbb, 0x30, 0x26, 0x12, 0x98, 0xbc, 0x0a, 0x32, 0x43,
+  0x23, 0xfd, 0xab, 0x28, 0x12, 0x00, 0x90, 0xeb, 0x9a, 0x31, 0x12, 0x12,
+  0x81, 0xbb, 0x51, 0x92, 0x8b, 0x25, 0xc9, 0x3b, 0x27, 0x90, 0x09, 0x98,
+  0x9a, 0x71, 0x23, 0xc9, 0x9b, 0x12, 0x28, 0x34, 0xb0, 0xab, 0x9a, 0x60,
+  0x27, 0xc9, 0x9b, 0xa8, 0xaa, 0x10, 0xa8, 0x9b, 0x80, 0xfc, 0xad, 0x53,
+  0x24, 0x88, 0x88, 0xa8, 0x09, 0x20, 0x64, 0x24, 0xc8, 0x89, 0x02, 0x98,
+  0x38, 0x27, 0xb8, 0x8c, 0x22, 0x00, 0xb9, 0x99, 0x06, 0x15, 0x3c, 0x00,
+  0x00, 0x90, 0x1a, 0x24, 0xfb, 0xaf, 0x08, 0x88, 0x8a, 0x23, 0xeb, 0x9c,
+  0xa9, 0x8a, 0x66, 0x12, 0x90, 0x99, 0x00, 0x12, 0x18, 0x55, 0x12, 0xc9,
+  0x19, 0x24, 0xa9, 0x28, 0x14, 0xeb, 0x18, 0x22, 0xb8, 0xbe, 0x18, 0x80,
+  0xcb, 0x09, 0x00, 0xca, 0x0a, 0x13, 0xa9, 0x18, 0xe8, 0xcc, 0xbd, 0x3a,
+  0x47, 0x12, 0x98, 0x89, 0x01, 0x88, 0x51, 0x34, 0x91, 0x9a, 0x51, 0x04,
+  0xab, 0x31, 0xc0, 0xad, 0x41, 0x13, 0xea, 0xab, 0x88, 0x9a, 0x19, 0x13,
+  0xd8, 0x0b, 0x24, 0xa0, 0x30, 0xc1, 0xdf, 0x9a, 0x48, 0x43, 0x11, 0x98,
+  0x89, 0x08, 0x20, 0x45, 0x81, 0x88, 0x11, 0x54, 0x01, 0x99, 0xb9, 0xbc,
+  0x19, 0x34, 0xa3, 0xdf, 0x8a, 0x99, 0x98, 0x88, 0x00, 0x00, 0x63, 0x13,
+  0x10, 0x92, 0xff, 0xaa, 0x08, 0x43, 0x12, 0x10, 0x01, 0xa8, 0x89, 0x44,
+  0x91, 0x8b, 0x54, 0x23, 0x11, 0x81, 0xe9, 0xbe, 0x19, 0x11, 0x80, 0xa9,
+  0x9b, 0x9a, 0x99, 0xa9, 0xac, 0x28, 0x57, 0x13, 0x22, 0x23, 0xfd, 0xad,
+  0x09, 0x31, 0x81, 0x10, 0x44, 0x80, 0x8a, 0x22, 0xb0, 0xad, 0x52, 0x23,
+  0x11, 0x31, 0xa0, 0xef, 0x0a, 0x00, 0xa8, 0x99, 0x18, 0x00, 0x00, 0x80,
+  0xc9, 0x9a, 0x71, 0x43, 0x21, 0x31, 0xfa, 0xaf, 0x09, 0x22, 0x98, 0x1a,
+  0x36, 0x82, 0x0a, 0x33, 0xd1, 0x9d, 0x30, 0x02, 0x08, 0x22, 0x82, 0xce,
+  0x0a, 0x80, 0xdb, 0x9b, 0x20, 0x03, 0x11, 0x23, 0xb1, 0xac, 0x73, 0x82,
+  0x19, 0x13, 0xff, 0x8b, 0x30, 0x84, 0xbb, 0x50, 0x14, 0x98, 0x39, 0x24,
+  0xca, 0x1a, 0x22, 0x98, 0x29, 0x24, 0xea, 0x9b, 0x21, 0xc9, 0xbe, 0x18,
+  0x12, 0x80, 0x31, 0x24, 0xa8, 0x38, 0x04, 0x8a, 0x92, 0xff, 0xab, 0x40,
+  0x83, 0xca, 0x40, 0x24, 0xa8, 0x19, 0x24, 0xb8, 0x8b, 0x22, 0x81, 0x08,
+  0x4d, 0x32, 0x42, 0x00, 0x25, 0xd0, 0xac, 0x18, 0xb0, 0xcf, 0x18, 0x11,
+  0x88, 0x30, 0x33, 0x90, 0x28, 0x14, 0xca, 0x29, 0xf0, 0xbf, 0x19, 0x24,
+  0xc0, 0x0b, 0x55, 0x81, 0xaa, 0x40, 0x02, 0xbb, 0x29, 0x03, 0xa9, 0x30,
+  0x15, 0xeb, 0x0a, 0x11, 0xfb, 0x8a, 0x31, 0x91, 0x89, 0x44, 0x02, 0x99,
+  0x20, 0xb8, 0x8c, 0x42, 0xf9, 0x8e, 0x38, 0x12, 0xdb, 0x38, 0x25, 0xb8,
+  0x1b, 0x34, 0xa1, 0x9c, 0x22, 0xa0, 0x1a, 0x34, 0xe0, 0x9c, 0x21, 0xb0,
+  0xae, 0x20, 0x12, 0xa9, 0x41, 0x24, 0x88, 0x19, 0x80, 0xcb, 0x28, 0xa2,
+  0xff, 0x09, 0x31, 0xa0, 0x9b, 0x54, 0x02, 0xaa, 0x48, 0x23, 0xb9, 0x09,
+  0x03, 0x98, 0x40, 0x92, 0xce, 0x0a, 0x91, 0xdc, 0x8a, 0x12, 0x80, 0x28,
+  0x46, 0x12, 0x00, 0x00, 0xa8, 0x9b, 0x81, 0xfd, 0xac, 0x28, 0x03, 0xc9,
+  0x49, 0x35, 0x90, 0x8b, 0x63, 0x91, 0xaa, 0x30, 0x81, 0x08, 0x12, 0xe8,
+  0x9b, 0x81, 0xfb, 0xab, 0x28, 0x80, 0x19, 0x64, 0x23, 0x01, 0x00, 0x80,
+  0x98, 0x89, 0xfb, 0xbf, 0x09, 0x22, 0xb8, 0x0a, 0x47, 0x02, 0x9a, 0x41,
+  0x02, 0xca, 0x09, 0x02, 0x99, 0x20, 0xa0, 0xab, 0x00, 0xfa, 0x9f, 0x19,
+  0x88, 0x09, 0x43, 0x25, 0x10, 0x21, 0x00, 0x88, 0x88, 0xfa, 0xdd, 0x8a,
+  0x11, 0xa1, 0x8c, 0x73, 0x12, 0x99, 0x41, 0x03, 0xca, 0x08, 0x91, 0xaa,
+  0x20, 0xa0, 0x9d, 0x11, 0xc8, 0xad, 0x08, 0xa8, 0x1a, 0x55, 0x32, 0x22,
+  0x34, 0x80, 0x98, 0xa8, 0xdc, 0xdb, 0xbb, 0x8b, 0x21, 0x91, 0x2a, 0x77,
+  0x02, 0x88, 0x22, 0x81, 0xbb, 0x20, 0x90, 0x9c, 0x20, 0x91, 0xdb, 0xaa,
+  0xce, 0x9b, 0x89, 0x88, 0x51, 0x45, 0x23, 0x22, 0x11, 0x00, 0xaa, 0xeb,
+  0xbb, 0xce, 0xaa, 0x21, 0x02, 0xab, 0x73, 0x17, 0x90, 0x19, 0x12, 0xb9,
+  0x1a, 0x02, 0xa9, 0x2a, 0xef, 0x1c, 0x43, 0x00, 0x13, 0xca, 0xcb, 0xca,
+  0xbc, 0x9b, 0x88, 0x30, 0x55, 0x34, 0x33, 0x23, 0x81, 0x90, 0xca, 0xbe,
+  0xba, 0xce, 0x8a, 0x41, 0x82, 0xab, 0x73, 0x15, 0xa8, 0x29, 0x13, 0xb9,
+  0x1a, 0x12, 0xba, 0x1a, 0x04, 0xdc, 0x9c, 0x99, 0xb9, 0x8a, 0x21, 0x45,
+  0x35, 0x32, 0x12, 0x00, 0x98, 0xda, 0xdb, 0xab, 0xbc, 0xac, 0x30, 0x24,
+  0xb8, 0x78, 0x25, 0x92, 0x9a, 0x42, 0x91, 0x9b, 0x10, 0x91, 0xac, 0x08,
+  0xc0, 0xbe, 0x8a, 0x88, 0xba, 0x18, 0x64, 0x34, 0x32, 0x23, 0x12, 0x90,
+  0xc9, 0xcc, 0xac, 0xaa, 0xda, 0xab, 0x48, 0x25, 0xb0, 0x2a, 0x47, 0x81,
+  0xa9, 0x30, 0x13, 0xa9, 0x19, 0x81, 0xcb, 0x9a, 0xca, 0xce, 0x9a, 0x80,
+  0x99, 0x18, 0x64, 0x33, 0x33, 0x14, 0x02, 0x80, 0xc9, 0xdc, 0xab, 0x89,
+  0x99, 0xeb, 0x1a, 0x54, 0x03, 0xcb, 0x39, 0x35, 0xa1, 0x9c, 0x53, 0x02,
+  0x98, 0x0a, 0x00, 0xc9, 0xbc, 0xaa, 0xbb, 0x8a, 0x20, 0x22, 0x73, 0x27,
+  0x22, 0x80, 0x18, 0x90, 0xdb, 0xbb, 0x8a, 0x80, 0xda, 0xac, 0x52, 0x34,
+  0xd0, 0x8b, 0x53, 0x03, 0xcb, 0x30, 0x16, 0x80, 0x8a, 0x10, 0xa8, 0xbc,
+  0xbb, 0xaa, 0x9a, 0x20, 0x22, 0x44, 0x37, 0x23, 0x81, 0x98, 0x80, 0xdb,
+  0x9c, 0xa9, 0xcc, 0x9a, 0x51, 0x13, 0xb9, 0x4a, 0x37, 0x82, 0xbc, 0x40,
+  0x23, 0xb8, 0x9c, 0x21, 0x91, 0xcc, 0x9a, 0x98, 0x98, 0x80, 0x18, 0x63,
+  0x34, 0x14, 0x00, 0x11, 0x80, 0xca, 0xab, 0x98, 0xfb, 0xbe, 0x09, 0x42,
+  0x90, 0x9c, 0x63, 0x24, 0xb1, 0x0b, 0x35, 0x81, 0xdb, 0x09, 0x11, 0xd9,
+  0xaa, 0x08, 0x08, 0x18, 0x00, 0x10, 0x55, 0x14, 0x81, 0x19, 0x12, 0xb8,
+  0xbe, 0x09, 0x80, 0xdb, 0xbc, 0x1a, 0x42, 0x92, 0xac, 0x73, 0x24, 0x91,
+  0x89, 0x44, 0x80, 0xc9, 0x8a, 0x00, 0xea, 0x9b, 0xac, 0xac, 0x4c, 0x00,
+  0x88, 0x01, 0x00, 0x20, 0x53, 0x44, 0x12, 0x98, 0x00, 0x80, 0xfa, 0xbb,
+  0x8a, 0x01, 0x11, 0xd8, 0xac, 0x41, 0x25, 0xc9, 0x8b, 0x73, 0x22, 0xb8,
+  0x29, 0x34, 0x91, 0xcc, 0x8a, 0x01, 0xeb, 0x9b, 0x18, 0x11, 0x81, 0x41,
+  0x54, 0x12, 0x81, 0x98, 0x80, 0xb9, 0xce, 0xaa, 0x20, 0xa1, 0xcd, 0x29,
+  0x35, 0xa2, 0xad, 0x51, 0x33, 0xb8, 0x0b, 0x36, 0x81, 0xba, 0x09, 0x81,
+  0xec, 0xaa, 0x88, 0x88, 0x00, 0x21, 0x63, 0x34, 0x12, 0x08, 0x08, 0x90,
+  0xce, 0xac, 0x08, 0x80, 0x89, 0x99, 0x42, 0x44, 0x01, 0xaa, 0x38, 0x34,
+  0x91, 0x9a, 0x52, 0x34, 0xa8, 0xbd, 0x9a, 0xb9, 0xde, 0x9b, 0x10, 0x01,
+  0x10, 0x73, 0x24, 0x13, 0x00, 0x08, 0x98, 0xea, 0xac, 0x89, 0x80, 0xcc,
+  0x8b, 0x63, 0x13, 0xdb, 0x39, 0x36, 0x91, 0xbb, 0x62, 0x03, 0xb8, 0x8c,
+  0x30, 0xb0, 0xae, 0x8a, 0x00, 0x88, 0x8a, 0x41, 0x45, 0x12, 0x80, 0x20,
+  0x02, 0xd9, 0xbc, 0x09, 0xa8, 0xcc, 0x8a, 0x30, 0x24, 0xb0, 0x29, 0x67,
+  0x02, 0xa9, 0x28, 0x24, 0xb0, 0xbc, 0x10, 0x91, 0xcd, 0x9a, 0x88, 0x81,
+  0x98, 0x28, 0x55, 0x24, 0x00, 0x10, 0x22, 0xa0, 0xcd, 0x99, 0x9a, 0xac,
+  0x09, 0x02, 0xb9, 0x28, 0x56, 0x02, 0xa9, 0x20, 0x36, 0x83, 0xaa, 0x30,
+  0x16, 0xd8, 0x9d, 0x18, 0xb8, 0xcc, 0x08, 0x11, 0x80, 0x28, 0x46, 0x13,
+  0x01, 0x08, 0x01, 0xb9, 0xce, 0x9b, 0x88, 0x90, 0xab, 0x09, 0x63, 0x24,
+  0x90, 0x0a, 0x45, 0x14, 0xb8, 0x29, 0x44, 0x91, 0xbc, 0x0b, 0x81, 0xec,
+  0xab, 0x08, 0x11, 0x98, 0x48, 0x36, 0x14, 0x01, 0x18, 0x01, 0xb8, 0xbe,
+  0x9c, 0xa9, 0x99, 0x09, 0x53, 0x03, 0x08, 0x52, 0x23, 0xb8, 0xbc, 0x30,
+  0x36, 0xa1, 0x89, 0x41, 0x13, 0xfb, 0x9e, 0x88, 0xa9, 0xab, 0x19, 0x43,
+  0x79, 0xbc, 0x46, 0x00, 0x22, 0x51, 0x45, 0x11, 0x80, 0x09, 0x98, 0xcc,
+  0xac, 0x9b, 0x00, 0x01, 0xb9, 0x38, 0x77, 0x01, 0xba, 0x28, 0x34, 0xa0,
+  0x8b, 0x52, 0x13, 0xa8, 0x9d, 0x08, 0xb8, 0xce, 0x8a, 0x18, 0x88, 0x08,
+  0x73, 0x24, 0x02, 0x00, 0x01, 0x80, 0xdc, 0x9c, 0x99, 0x99, 0x8a, 0x42,
+  0x15, 0x80, 0x21, 0x25, 0xa8, 0xcc, 0x08, 0x12, 0x01, 0x89, 0x52, 0x23,
+  0xc8, 0xad, 0x9a, 0xb9, 0xbd, 0x8a, 0x30, 0x34, 0x31, 0x47, 0x23, 0x80,
+  0x89, 0x80, 0xea, 0xcc, 0x99, 0x88, 0x00, 0x08, 0x18, 0x55, 0x13, 0xc9,
+  0x19, 0x22, 0x91, 0xab, 0x62, 0x23, 0x81, 0xda, 0x0a, 0xa8, 0xce, 0xbb,
+  0x88, 0x81, 0x89, 0x71, 0x25, 0x13, 0x11, 0x10, 0x81, 0xda, 0xcb, 0xbb,
+  0xba, 0xaa, 0x39, 0x55, 0x13, 0x09, 0x63, 0x13, 0xcb, 0x9b, 0x11, 0x01,
+  0x08, 0x22, 0x43, 0x14, 0xca, 0xbd, 0xbb, 0xda, 0xbb, 0x8b, 0x40, 0x25,
+  0x32, 0x55, 0x23, 0x08, 0x88, 0x80, 0xfb, 0xac, 0x9a, 0x99, 0x00, 0x01,
+  0x18, 0x73, 0x34, 0x90, 0x8b, 0x31, 0x01, 0xaa, 0x1a, 0x44, 0x14, 0xc9,
+  0xac, 0x89, 0xd8, 0xbd, 0x8a, 0x10, 0x80, 0x31, 0x56, 0x33, 0x12, 0x00,
+  0x11, 0xb8, 0xbf, 0xac, 0xaa, 0xaa, 0x09, 0x52, 0x23, 0x00, 0x62, 0x24,
+  0xa0, 0xbb, 0x28, 0x13, 0xa8, 0x0a, 0x73, 0x12, 0xda, 0x9c, 0xaa, 0xcb,
+  0xab, 0x8a, 0x38, 0x64, 0x23, 0x35, 0x24, 0x01, 0x08, 0x98, 0xdc, 0xbc,
+  0x9a, 0x9a, 0x08, 0x23, 0x80, 0x60, 0x36, 0x82, 0xad, 0x20, 0x23, 0xc9,
+  0x0b, 0x44, 0x13, 0xc9, 0x8c, 0x21, 0xd8, 0xbd, 0x88, 0x01, 0xa8, 0x28,
+  0x46, 0x13, 0x01, 0x20, 0x11, 0xb8, 0xbe, 0xab, 0xb9, 0xbd, 0x0a, 0x53,
+  0x03, 0x99, 0x73, 0x24, 0xa8, 0x9a, 0x30, 0x01, 0xca, 0x09, 0x34, 0x82,
+  0xeb, 0x8a, 0x80, 0xcc, 0xa3, 0xda, 0x46, 0x00, 0xab, 0x08, 0x00, 0x32,
+  0x73, 0x63, 0x22, 0x80, 0x10, 0x80, 0xfb, 0xab, 0x9a, 0xba, 0x8a, 0x33,
+  0x82, 0x20, 0x57, 0x12, 0x99, 0x09, 0x42, 0x81, 0xa9, 0x38, 0x36, 0xb1,
+  0xbe, 0x09, 0x90, 0xbf, 0x9b, 0x00, 0x81, 0x10, 0x64, 0x44, 0x01, 0x00,
+  0x01, 0xa0, 0xcc, 0xab, 0xaa, 0xcb, 0x0a, 0x33, 0x14, 0x89, 0x64, 0x33,
+  0xb0, 0x9a, 0x21, 0x83, 0xb9, 0x0b, 0x52, 0x13, 0xfb, 0xab, 0x90, 0xea,
+  0xbb, 0x8a, 0x08, 0x42, 0x33, 0x65, 0x24, 0x12, 0x00, 0x00, 0xc8, 0xcd,
+  0x9a, 0xba, 0xaa, 0x18, 0x24, 0x81, 0x39, 0x37, 0x13, 0xb9, 0x1a, 0x24,
+  0x82, 0xba, 0x39, 0x47, 0x91, 0xcc, 0x09, 0x91, 0xfb, 0xab, 0x18, 0x00,
+  0x89, 0x62, 0x44, 0x12, 0x01, 0x21, 0x81, 0xeb, 0xbb, 0xaa, 0xcb, 0xac,
+  0x10, 0x23, 0xb8, 0x60, 0x45, 0x01, 0xaa, 0x21, 0x14, 0xa8, 0x8a, 0x31,
+  0x23, 0xdc, 0xab, 0x00, 0xdb, 0xbd, 0x89, 0x08, 0x00, 0x21, 0x56, 0x33,
+  0x13, 0x11, 0x22, 0xd0, 0xcc, 0xaa, 0xca, 0xab, 0x8a, 0x34, 0xa0, 0x8c,
+  0x55, 0x03, 0xba, 0x29, 0x45, 0x91, 0xaa, 0x40, 0x15, 0xb0, 0x9c, 0x20,
+  0xa1, 0xbf, 0x8b, 0x11, 0xb8, 0x0b, 0x73, 0x33, 0x02, 0x30, 0x34, 0xa1,
+  0xbc, 0x9b, 0xb9, 0xcf, 0x9b, 0x21, 0x01, 0xbb, 0x70, 0x24, 0x91, 0x89,
+  0x53, 0x02, 0xa9, 0x09, 0x32, 0xa1, 0xbd, 0x9a, 0x91, 0xce, 0x9b, 0x08,
+  0x88, 0x09, 0x51, 0x35, 0x23, 0x23, 0x43, 0x12, 0xc9, 0xac, 0x9b, 0xcc,
+  0xbc, 0x89, 0x21, 0x81, 0xa9, 0x60, 0x44, 0x91, 0x8a, 0x41, 0x23, 0x90,
+  0x0a, 0x54, 0x12, 0xc9, 0x9c, 0x18, 0xd8, 0xbd, 0x0b, 0x10, 0xb9, 0x19,
+  0x47, 0x23, 0x10, 0x31, 0x24, 0xb8, 0xcb, 0x9a, 0xca, 0xbe, 0x9a, 0x22,
+  0x91, 0xbc, 0x73, 0x23, 0xb0, 0x19, 0x35, 0x02, 0x81, 0x27, 0x41, 0x00,
+  0x99, 0x10, 0x24, 0x98, 0xbd, 0x8a, 0xa0, 0xdd, 0xab, 0x08, 0x98, 0x9a,
+  0x52, 0x35, 0x23, 0x31, 0x44, 0x12, 0xb9, 0xbb, 0x9a, 0xdd, 0xbc, 0x8a,
+  0x21, 0x91, 0xac, 0x48, 0x26, 0x91, 0x9a, 0x52, 0x24, 0xa0, 0x89, 0x53,
+  0x04, 0xca, 0x8b, 0x21, 0xd1, 0xbe, 0x19, 0x01, 0xca, 0x0a, 0x44, 0x11,
+  0x80, 0x52, 0x23, 0xa0, 0x9a, 0x08, 0xb0, 0xdf, 0x8a, 0x10, 0x90, 0xbc,
+  0x38, 0x26, 0x90, 0x0a, 0x63, 0x12, 0x98, 0x10, 0x33, 0x80, 0xbb, 0x8a,
+  0x90, 0xee, 0xab, 0x89, 0xa8, 0xac, 0x19, 0x44, 0x11, 0x30, 0x54, 0x14,
+  0x81, 0x09, 0x00, 0xb8, 0xce, 0x8a, 0x98, 0xa9, 0x09, 0x98, 0x1b, 0x63,
+  0x22, 0x88, 0x30, 0x37, 0x23, 0x90, 0x20, 0x47, 0x91, 0xcb, 0x09, 0x02,
+  0xfc, 0x9c, 0x00, 0xa8, 0x9b, 0x40, 0x33, 0x81, 0x50, 0x35, 0x01, 0x98,
+  0x00, 0x91, 0xfb, 0xab, 0x09, 0x80, 0xec, 0x8a, 0x32, 0x82, 0x9c, 0x50,
+  0x25, 0x80, 0x88, 0x53, 0x12, 0xa8, 0x9b, 0x31, 0xc0, 0xcf, 0x0a, 0x00,
+  0xca, 0x9b, 0x42, 0x02, 0x8a, 0x71, 0x33, 0x81, 0x09, 0x42, 0x81, 0xeb,
+  0x9a, 0x80, 0xb9, 0xad, 0x00, 0x90, 0x9a, 0x41, 0x23, 0x12, 0x28, 0x47,
+  0x33, 0x80, 0x2a, 0x34, 0xa2, 0xbf, 0x0a, 0x81, 0xfa, 0xac, 0x19, 0x80,
+  0xba, 0x28, 0x35, 0x13, 0x21, 0x35, 0x25, 0x90, 0x99, 0x11, 0xd9, 0xcd,
+  0x89, 0x00, 0xc9, 0xbb, 0x48, 0x14, 0x98, 0x19, 0x44, 0x14, 0x88, 0x20,
+  0x43, 0x02, 0xb9, 0xaa, 0x80, 0xd9, 0xbf, 0x9a, 0x88, 0xd9, 0x9b, 0x42,
+  0x02, 0x88, 0x73, 0x33, 0x82, 0x00, 0x22, 0x91, 0xcd, 0x9b, 0x99, 0xca,
+  0xab, 0x8a, 0x9b, 0x89, 0x62, 0x23, 0x21, 0x53, 0x45, 0x12, 0x81, 0x31,
+  0x24, 0xb8, 0xcc, 0x09, 0xa1, 0xcf, 0x9b, 0x08, 0xb8, 0xad, 0x28, 0x14,
+  0x1b, 0xe4, 0x3d, 0x00, 0x80, 0x30, 0x46, 0x12, 0x80, 0x21, 0x13, 0xb8,
+  0xbe, 0x08, 0xa0, 0xfb, 0xbc, 0x09, 0x01, 0xb8, 0x8b, 0x73, 0x14, 0x00,
+  0x20, 0x35, 0x14, 0x88, 0x88, 0x32, 0xb1, 0xdf, 0x89, 0x80, 0xfb, 0x9a,
+  0x10, 0x90, 0x9a, 0x41, 0x25, 0x00, 0x20, 0x34, 0x13, 0xa9, 0x89, 0x12,
+  0xd9, 0xcc, 0xab, 0xba, 0xba, 0xac, 0x09, 0x13, 0x32, 0x54, 0x44, 0x33,
+  0x43, 0x24, 0x02, 0x08, 0x88, 0xc8, 0xbe, 0xbb, 0xcb, 0xbc, 0xab, 0x89,
+  0x80, 0x10, 0x73, 0x33, 0x25, 0x23, 0x33, 0x24, 0x80, 0x99, 0x98, 0xd9,
+  0xcd, 0xcb, 0xab, 0xaa, 0x98, 0x9a, 0x28, 0x27, 0x23, 0x43, 0x44, 0x33,
+  0x23, 0x00, 0x19, 0x81, 0xfb, 0xae, 0x99, 0xb9, 0xbd, 0x0a, 0x00, 0x99,
+  0x39, 0x45, 0x22, 0x20, 0x44, 0x33, 0x00, 0x89, 0x11, 0x98, 0xec, 0xbc,
+  0xab, 0x99, 0xba, 0xae, 0x18, 0x33, 0x81, 0x40, 0x46, 0x33, 0x11, 0x31,
+  0x53, 0x81, 0xdb, 0x09, 0x98, 0xce, 0x9c, 0x08, 0xa9, 0xac, 0x28, 0x33,
+  0x98, 0x38, 0x37, 0x13, 0x90, 0x32, 0x34, 0x80, 0x89, 0x10, 0xfa, 0xae,
+  0x89, 0xa0, 0xad, 0x8a, 0x12, 0x81, 0x1a, 0x64, 0x24, 0x02, 0x28, 0x63,
+  0x02, 0xaa, 0x8a, 0x01, 0xfa, 0xad, 0x88, 0x90, 0xcb, 0x09, 0x12, 0x80,
+  0x0a, 0x54, 0x23, 0x01, 0x30, 0x36, 0x12, 0xa0, 0x9a, 0x9a, 0xca, 0xce,
+  0xac, 0x88, 0x80, 0xa8, 0x29, 0x36, 0x24, 0x01, 0x42, 0x34, 0x03, 0xa9,
+  0x19, 0x82, 0xef, 0x9a, 0x88, 0xc9, 0x9c, 0x10, 0x80, 0x98, 0x30, 0x45,
+  0x01, 0x00, 0x42, 0x13, 0x90, 0x88, 0x23, 0xe9, 0xae, 0x19, 0xa0, 0xcc,
+  0x8a, 0x11, 0x81, 0x09, 0x62, 0x34, 0x03, 0x20, 0x52, 0x23, 0xb8, 0x9d,
+  0x00, 0xd9, 0xbd, 0x8b, 0x08, 0xd9, 0x8b, 0x42, 0x01, 0x0a, 0x41, 0x25,
+  0x91, 0x08, 0x43, 0x12, 0x5e, 0x12, 0x36, 0x00, 0x99, 0x11, 0xc8, 0xcc,
+  0x89, 0xb8, 0xed, 0x8a, 0x11, 0x88, 0x8b, 0x72, 0x24, 0x80, 0x38, 0x45,
+  0x03, 0xab, 0x39, 0x14, 0xfa, 0xab, 0x21, 0xb8, 0xbf, 0x18, 0x01, 0xc9,
+  0x0a, 0x32, 0x02, 0x98, 0x52, 0x44, 0x82, 0x88, 0x62, 0x02, 0xca, 0x0b,
+  0x11, 0xd9, 0xae, 0x08, 0x81, 0xb9, 0x89, 0x53, 0x13, 0x80, 0x42, 0x45,
+  0x02, 0xa8, 0x20, 0x13, 0xfb, 0xac, 0x00, 0xb8, 0xbe, 0x19, 0x02, 0xca,
+  0x1a, 0x34, 0x83, 0x89, 0x72, 0x14, 0x80, 0x18, 0x32, 0xa1, 0xbe, 0x09,
+  0x01, 0xdd, 0x9c, 0x21, 0x91, 0xbb, 0x40, 0x26, 0x80, 0x09, 0x44, 0x03,
+  0xa9, 0x09, 0x24, 0xc8, 0xae, 0x18, 0x81, 0xdc, 0x89, 0x21, 0xa0, 0x9b,
+  0x50, 0x13, 0xa0, 0x2a, 0x54, 0x02, 0xaa, 0x38, 0x16, 0xb8, 0xac, 0x30,
+  0x82, 0xdd, 0x0a, 0x32, 0xb8, 0xbb, 0x62, 0x22, 0xa0, 0x19, 0x45, 0x12,
+  0xaa, 0x28, 0x23, 0xe8, 0xac, 0x19, 0x00, 0xec, 0x8a, 0x22, 0xa1, 0xbb,
+  0x50, 0x14, 0xb8, 0x1a, 0x35, 0x92, 0xb9, 0x51, 0x34, 0xb9, 0x9c, 0x31,
+  0x93, 0xcf, 0x0a, 0x22, 0xb8, 0xae, 0x31, 0x15, 0xa9, 0x2a, 0x45, 0x82,
+  0xab, 0x40, 0x33, 0xda, 0x9b, 0x31, 0xa1, 0xbf, 0x09, 0x13, 0xd9, 0x9b,
+  0x42, 0x82, 0xbb, 0x48, 0x44, 0xa0, 0x89, 0x51, 0x04, 0xa9, 0x8a, 0x52,
+  0x90, 0xcc, 0x19, 0x23, 0xd9, 0x9b, 0x42, 0x03, 0xbb, 0x39, 0x37, 0x80,
+  0xaa, 0x50, 0x13, 0xc9, 0x9b, 0x31, 0xa2, 0xdf, 0x08, 0x12, 0xb8, 0x9c,
+  0x41, 0x02, 0xca, 0x29, 0x34, 0x90, 0x9b, 0x52, 0x23, 0xb9, 0x9c, 0x43,
+  0x81, 0xcc, 0x0b, 0x31, 0xb0, 0xae, 0x20, 0x33, 0xb0, 0x0c, 0x73, 0x13,
+  0xa8, 0x19, 0x45, 0x80, 0xac, 0x18, 0x83, 0xec, 0x9a, 0x21, 0xa0, 0xbc,
+  0x29, 0x23, 0xb9, 0x8c, 0x63, 0x03, 0x99, 0x38, 0x72, 0xfa, 0x38, 0x00,
+  0x45, 0x01, 0xba, 0x18, 0x43, 0xc8, 0xbc, 0x1a, 0x22, 0xe9, 0x9c, 0x20,
+  0x14, 0xa8, 0x29, 0x45, 0x02, 0xa8, 0x11, 0x25, 0xa0, 0xad, 0x18, 0x82,
+  0xdd, 0x9b, 0x21, 0xa1, 0xbd, 0x20, 0x23, 0xb9, 0x9c, 0x54, 0x02, 0xa9,
+  0x28, 0x35, 0x01, 0xa9, 0x09, 0x42, 0xa2, 0xbf, 0x1a, 0x32, 0xd8, 0xad,
+  0x31, 0x15, 0xb9, 0x1a, 0x46, 0x81, 0x9b, 0x48, 0x14, 0xb9, 0x8c, 0x42,
+  0x90, 0xae, 0x19, 0x12, 0xc9, 0x9b, 0x22, 0x92, 0xcb, 0x39, 0x43, 0x92,
+  0x9b, 0x52, 0x24, 0x91, 0x9b, 0x41, 0x13, 0xd9, 0x9c, 0x20, 0x92, 0xae,
+  0x1a, 0x33, 0x90, 0x0b, 0x45, 0x14, 0x91, 0x19, 0x33, 0x05, 0xda, 0x0b,
+  0x01, 0xda, 0xae, 0x09, 0x81, 0xcb, 0x8b, 0x43, 0x91, 0x9c, 0x51, 0x13,
+  0x90, 0x39, 0x25, 0x13, 0x00, 0x88, 0x92, 0x08, 0xe0, 0xce, 0x08, 0x81,
+  0xca, 0x9b, 0x63, 0x02, 0xb9, 0x58, 0x35, 0x91, 0x9a, 0x62, 0x03, 0xcb,
+  0x0a, 0x32, 0xe9, 0x9d, 0x28, 0x91, 0xcb, 0x09, 0x32, 0xa0, 0xac, 0x41,
+  0x13, 0xa0, 0x0a, 0x62, 0x23, 0x90, 0x89, 0x32, 0x15, 0xca, 0xaa, 0x38,
+  0x05, 0xec, 0x0a, 0x33, 0x93, 0xae, 0x30, 0x34, 0xb0, 0x9b, 0x55, 0x82,
+  0xcb, 0x29, 0x23, 0xf9, 0x9b, 0x11, 0x82, 0xbd, 0x19, 0x13, 0xb9, 0xac,
+  0x42, 0x12, 0x9a, 0x20, 0x73, 0x81, 0x10, 0x11, 0x90, 0x10, 0x12, 0xf9,
+  0x9d, 0x38, 0x90, 0xbe, 0x29, 0x15, 0xa0, 0x99, 0x54, 0x03, 0xaa, 0x41,
+  0x25, 0xb8, 0x8b, 0x32, 0xd2, 0xaf, 0x09, 0x81, 0xca, 0x8a, 0x10, 0x81,
+  0x99, 0x30, 0x25, 0x03, 0x98, 0x21, 0x35, 0x02, 0xc9, 0x0a, 0x11, 0xb1,
+  0xdf, 0x89, 0x22, 0xa0, 0xad, 0x41, 0x14, 0x88, 0x20, 0x73, 0x02, 0x08,
+  0x20, 0x12, 0xc8, 0xad, 0x89, 0xc0, 0xcd, 0x9a, 0x11, 0xa9, 0x9d, 0x21,
+  0x25, 0xed, 0x36, 0x00, 0x12, 0xa9, 0x48, 0x33, 0x10, 0x80, 0x12, 0x46,
+  0x23, 0x90, 0xbb, 0x60, 0x83, 0xfb, 0x8d, 0x10, 0x92, 0xac, 0x39, 0x35,
+  0x91, 0x8c, 0x53, 0x12, 0xb9, 0x2a, 0x45, 0xa1, 0x9c, 0x20, 0x84, 0xeb,
+  0x8a, 0x21, 0xb9, 0xad, 0x08, 0x02, 0xda, 0x8a, 0x23, 0x13, 0xba, 0x38,
+  0x37, 0x14, 0x80, 0x29, 0x32, 0x11, 0xfa, 0x8b, 0x11, 0x92, 0xfd, 0x09,
+  0x32, 0xb1, 0xca, 0x71, 0x13, 0xa8, 0x09, 0x34, 0x82, 0xbc, 0x28, 0x13,
+  0xfb, 0x9c, 0x18, 0x91, 0xcb, 0x8a, 0x23, 0xc1, 0xbb, 0x48, 0x25, 0x80,
+  0x9a, 0x44, 0x23, 0x88, 0x09, 0x21, 0xb8, 0xc9, 0xbc, 0x9b, 0x10, 0x80,
+  0xcc, 0x71, 0x35, 0x88, 0x19, 0x53, 0x12, 0xa9, 0x29, 0x16, 0xb0, 0xae,
+  0x28, 0xa2, 0xec, 0x9a, 0x02, 0xa9, 0x9d, 0x30, 0x12, 0xa9, 0x18, 0x53,
+  0x03, 0xa0, 0x19, 0x26, 0x91, 0xab, 0x8a, 0x13, 0xa0, 0xcc, 0x2b, 0x41,
+  0xa0, 0x80, 0x5a, 0x54, 0x02, 0x13, 0x38, 0x46, 0x02, 0x98, 0x19, 0x33,
+  0xfa, 0xae, 0x28, 0xb8, 0xbf, 0x09, 0x01, 0xca, 0x8a, 0x53, 0x91, 0x89,
+  0x41, 0x24, 0x98, 0x10, 0x33, 0x24, 0xd1, 0xac, 0x08, 0x23, 0xfa, 0x8e,
+  0x20, 0x81, 0xab, 0x39, 0x36, 0x91, 0x9a, 0x72, 0x13, 0xa8, 0x09, 0x53,
+  0x92, 0xdc, 0x09, 0x12, 0xe9, 0x9c, 0x10, 0x92, 0xdb, 0x19, 0x23, 0xa1,
+  0x9c, 0x43, 0x23, 0xb9, 0x2a, 0x45, 0x12, 0xca, 0x0a, 0x22, 0x92, 0xbf,
+  0x0b, 0x24, 0xa0, 0xad, 0x40, 0x33, 0xc8, 0x1a, 0x34, 0x13, 0xbb, 0x48,
+  0x24, 0xb0, 0xad, 0x29, 0x91, 0xdc, 0xab, 0x20, 0xa2, 0xbd, 0x09, 0x34,
+  0x91, 0x9c, 0x52, 0x23, 0xc8, 0x19, 0x64, 0x11, 0xb9, 0x8b, 0x12, 0x91,
+  0xcf, 0x8a, 0x23, 0xa0, 0xac, 0x51, 0x24, 0x90, 0x1a, 0x54, 0x02, 0xa9,
+  0x09, 0x22, 0xc0, 0xbd, 0x4b, 0x04, 0x3c, 0x00, 0x0a, 0x81, 0xeb, 0xab,
+  0x31, 0x03, 0xeb, 0x29, 0x35, 0x91, 0x9b, 0x62, 0x12, 0xba, 0x2b, 0x44,
+  0x91, 0xdc, 0x0a, 0x13, 0xc0, 0xac, 0x20, 0x14, 0xa8, 0x29, 0x46, 0x02,
+  0x09, 0x21, 0x12, 0xa9, 0xaa, 0x98, 0xcd, 0xac, 0xb9, 0xb9, 0x8b, 0x90,
+  0x9a, 0x73, 0x23, 0x90, 0x68, 0x25, 0x90, 0x89, 0x42, 0x01, 0xbc, 0x28,
+  0x35, 0xda, 0xbd, 0x08, 0x01, 0xda, 0x9a, 0x42, 0x33, 0x00, 0x40, 0x36,
+  0x13, 0x00, 0x00, 0x80, 0xa9, 0xcc, 0xcc, 0xbb, 0x8a, 0xba, 0xbd, 0x38,
+  0x12, 0xa9, 0x69, 0x25, 0x01, 0x19, 0x44, 0x02, 0x8a, 0x19, 0x81, 0x89,
+  0x14, 0xf9, 0xdf, 0x19, 0x01, 0xba, 0x8b, 0x44, 0x23, 0x80, 0x41, 0x36,
+  0x03, 0xa8, 0x9a, 0x10, 0xa1, 0xff, 0x8a, 0x01, 0xb0, 0xac, 0x30, 0x13,
+  0xd9, 0x19, 0x44, 0x82, 0x9a, 0x31, 0x24, 0xb9, 0x9a, 0x21, 0x91, 0x0a,
+  0xc8, 0xcd, 0xbc, 0x09, 0x81, 0xa8, 0x19, 0x73, 0x44, 0x33, 0x20, 0x52,
+  0x23, 0xa0, 0xbd, 0x8a, 0x92, 0xed, 0xab, 0x18, 0x90, 0xbb, 0x0a, 0x54,
+  0x92, 0x88, 0x52, 0x34, 0x80, 0x89, 0x53, 0x92, 0xbb, 0x8b, 0x33, 0x91,
+  0xff, 0x9e, 0x18, 0x11, 0xc9, 0x0a, 0x54, 0x02, 0x98, 0x40, 0x24, 0x81,
+  0xba, 0x99, 0x10, 0xb8, 0xde, 0x9a, 0x21, 0x90, 0xcc, 0x28, 0x24, 0xa1,
+  0x8b, 0x73, 0x13, 0x98, 0x1a, 0x32, 0xa1, 0xbd, 0x8a, 0x18, 0x81, 0xda,
+  0xbd, 0x09, 0x12, 0x98, 0x0a, 0x46, 0x13, 0x32, 0x37, 0x02, 0x99, 0x18,
+  0x82, 0xcf, 0xab, 0x08, 0xa8, 0xbd, 0x0a, 0x33, 0x91, 0x9a, 0x74, 0x34,
+  0x80, 0x18, 0x32, 0x92, 0xbd, 0x9a, 0x98, 0xeb, 0x9b, 0x30, 0x03, 0xed,
+  0x8b, 0x31, 0x23, 0xcb, 0x60, 0x15, 0x31, 0x81, 0x10, 0x02, 0xa8, 0xdc,
+  0xac, 0xaa, 0x99, 0xb9, 0xab, 0x41, 0x24, 0x80, 0xa9, 0xd3, 0x40, 0x00,
+  0x29, 0x47, 0x23, 0x88, 0x21, 0x13, 0xc8, 0xbc, 0xab, 0xcb, 0xcb, 0x9b,
+  0x52, 0x04, 0xda, 0x8c, 0x30, 0x12, 0x99, 0x71, 0x14, 0x32, 0x02, 0x10,
+  0x80, 0xcb, 0xbd, 0xdb, 0xab, 0x8a, 0x00, 0x98, 0x50, 0x34, 0x02, 0x11,
+  0x63, 0x12, 0x98, 0x88, 0x98, 0xda, 0xbc, 0xcb, 0x8a, 0x10, 0x44, 0x34,
+  0xf8, 0xad, 0x08, 0x33, 0xb0, 0x2b, 0x37, 0x41, 0x92, 0x8c, 0x23, 0xa0,
+  0xbf, 0x9a, 0x10, 0x81, 0x99, 0x19, 0x44, 0x01, 0xca, 0x28, 0x45, 0x82,
+  0x89, 0x18, 0x02, 0xdc, 0xbb, 0x89, 0x90, 0xba, 0x38, 0x47, 0x03, 0xeb,
+  0x8a, 0x20, 0x12, 0x11, 0x53, 0x24, 0x01, 0x98, 0xba, 0xcd, 0xcb, 0x99,
+  0x00, 0x00, 0x30, 0x35, 0xa1, 0xbb, 0x48, 0x35, 0x12, 0x21, 0x13, 0xa8,
+  0xdf, 0xab, 0xab, 0x99, 0x10, 0x43, 0x34, 0x25, 0xa2, 0xcf, 0x9a, 0x10,
+  0x32, 0x22, 0x43, 0x33, 0x03, 0xe9, 0xcc, 0x9b, 0x89, 0x00, 0x10, 0x22,
+  0x43, 0x81, 0xcf, 0x0b, 0x32, 0x24, 0x11, 0x23, 0x01, 0xfb, 0xcb, 0x9a,
+  0x09, 0x00, 0x21, 0x33, 0xa0, 0x2a, 0x27, 0xf9, 0xae, 0x10, 0x43, 0x12,
+  0x01, 0x00, 0x88, 0xba, 0xcd, 0x9a, 0x11, 0x21, 0x13, 0xb0, 0xbe, 0x08,
+  0x02, 0xbc, 0x70, 0x35, 0x02, 0xa9, 0x89, 0x98, 0xca, 0xab, 0x18, 0x25,
+  0x82, 0xcb, 0x0a, 0x22, 0x24, 0xc1, 0xdf, 0x8a, 0x32, 0x25, 0x11, 0x08,
+  0x80, 0x08, 0x98, 0xcc, 0x8a, 0x21, 0x80, 0xa9, 0xeb, 0xab, 0x30, 0x81,
+  0x39, 0x77, 0x13, 0x90, 0x99, 0x99, 0xa8, 0x99, 0x9a, 0x28, 0x04, 0xd9,
+  0xab, 0x51, 0x47, 0x92, 0xcf, 0x8a, 0x31, 0x34, 0xb0, 0x0c, 0x42, 0x01,
+  0xc9, 0x9c, 0x38, 0x24, 0xa0, 0xad, 0x89, 0x12, 0x81, 0xbb, 0x49, 0x37,
+  0x02, 0xbb, 0x29, 0x23, 0xc8, 0xac, 0x08, 0x01, 0x90, 0xcc, 0x0b, 0x51,
+  0xeb, 0xd8, 0x49, 0x00, 0x34, 0xa2, 0xce, 0x0a, 0x41, 0x14, 0x82, 0x88,
+  0x99, 0x88, 0xa8, 0xab, 0x0a, 0x32, 0xa1, 0xbe, 0x9b, 0x19, 0x64, 0x23,
+  0x01, 0x40, 0x14, 0xb8, 0xad, 0x18, 0x90, 0xba, 0xaa, 0x8a, 0x41, 0x03,
+  0xfb, 0x59, 0x47, 0xc0, 0xbc, 0x19, 0x53, 0x22, 0x98, 0xaa, 0x09, 0x21,
+  0x80, 0x9b, 0x20, 0x14, 0xda, 0xcd, 0x8a, 0x42, 0x24, 0xb0, 0x9d, 0x42,
+  0x03, 0x9a, 0x18, 0x13, 0xa8, 0xbc, 0xac, 0x09, 0x22, 0xc0, 0xac, 0x72,
+  0x33, 0xe0, 0xbc, 0x28, 0x34, 0x24, 0x91, 0xca, 0x9b, 0x28, 0x23, 0x80,
+  0xaa, 0xaa, 0xba, 0xbe, 0x0a, 0x64, 0x24, 0x91, 0xac, 0x20, 0x14, 0x88,
+  0x08, 0x90, 0xba, 0xcc, 0xaa, 0x39, 0x25, 0xb1, 0x0c, 0x55, 0xa2, 0xcf,
+  0x08, 0x23, 0x43, 0x90, 0xbb, 0x8b, 0x32, 0x33, 0x80, 0xb9, 0xbc, 0xac,
+  0xab, 0x09, 0x74, 0x34, 0xb0, 0xbe, 0x28, 0x25, 0x81, 0x88, 0x90, 0xb9,
+  0xab, 0x89, 0x52, 0x22, 0xc8, 0xbd, 0x39, 0x26, 0xb0, 0xaf, 0x20, 0x43,
+  0x22, 0xa0, 0xcb, 0x0a, 0x32, 0x23, 0xa8, 0xcc, 0xbb, 0x89, 0x08, 0x21,
+  0x54, 0x03, 0xfa, 0x0b, 0x44, 0x12, 0x80, 0xa9, 0xaa, 0x8b, 0x89, 0x89,
+  0x61, 0x03, 0xcc, 0x1b, 0x35, 0xe9, 0x9d, 0x31, 0x34, 0x03, 0xca, 0x9b,
+  0x21, 0x24, 0x01, 0xba, 0xdb, 0xaa, 0x89, 0x00, 0x31, 0x36, 0xa1, 0xcf,
+  0x29, 0x35, 0x02, 0x98, 0x99, 0x9a, 0x89, 0x80, 0x98, 0x88, 0xda, 0xad,
+  0x38, 0x56, 0x82, 0xcd, 0x09, 0x33, 0x24, 0x92, 0xbb, 0x9c, 0x31, 0x32,
+  0x90, 0xdb, 0xcb, 0x99, 0x10, 0x10, 0x43, 0x23, 0xea, 0x8b, 0x64, 0x22,
+  0x90, 0x9a, 0x9b, 0x8a, 0x88, 0x88, 0x09, 0xc9, 0xcc, 0x39, 0x57, 0xa2,
+  0xbe, 0x29, 0x34, 0x33, 0xb0, 0xbd, 0x08, 0x33, 0x13, 0xb9, 0xcc, 0xaa,
+  0x89, 0x00, 0x01, 0x52, 0x49, 0xf7, 0x45, 0x00, 0x03, 0xce, 0x1a, 0x55,
+  0x02, 0x98, 0x99, 0x99, 0x00, 0x80, 0x98, 0x99, 0xcb, 0xcb, 0x1b, 0x57,
+  0x92, 0xcd, 0x18, 0x42, 0x33, 0xa1, 0xbc, 0x09, 0x42, 0x22, 0xa8, 0xbc,
+  0xac, 0x8a, 0x11, 0x01, 0x10, 0x81, 0xdb, 0x3a, 0x77, 0x12, 0x98, 0x9a,
+  0x89, 0x00, 0x98, 0x9a, 0x09, 0x90, 0xbc, 0x68, 0x04, 0xee, 0x09, 0x43,
+  0x33, 0xc8, 0x9c, 0x30, 0x32, 0x81, 0xa0, 0xca, 0xbb, 0x8b, 0x31, 0x01,
+  0x88, 0xc8, 0xcd, 0x49, 0x46, 0x12, 0x98, 0x9a, 0x08, 0x11, 0x98, 0xdb,
+  0xaa, 0xa9, 0xab, 0x51, 0x35, 0xb2, 0xdf, 0x18, 0x24, 0x33, 0xb0, 0xbc,
+  0x19, 0x24, 0x02, 0xa8, 0xbd, 0xba, 0x09, 0x21, 0x22, 0x01, 0xd9, 0xad,
+  0x72, 0x34, 0x81, 0x99, 0x9b, 0x18, 0x11, 0xa9, 0xbd, 0xaa, 0xa9, 0x09,
+  0x66, 0x82, 0xcd, 0x1a, 0x53, 0x32, 0xa1, 0xbc, 0x10, 0x33, 0x01, 0xa8,
+  0xcc, 0xbb, 0x8a, 0x21, 0x11, 0x00, 0xb8, 0xce, 0x48, 0x47, 0x02, 0x99,
+  0x9a, 0x18, 0x11, 0x98, 0xbc, 0x8b, 0x08, 0x80, 0x32, 0xf2, 0xdf, 0x18,
+  0x34, 0x14, 0xeb, 0x09, 0x23, 0x02, 0x80, 0x89, 0xb9, 0xac, 0x0a, 0x31,
+  0x81, 0xb9, 0xcc, 0x9b, 0x73, 0x35, 0x82, 0xaa, 0x08, 0x21, 0x01, 0xb8,
+  0xdc, 0xba, 0x9a, 0x09, 0x52, 0x14, 0xf9, 0x9c, 0x31, 0x44, 0x12, 0xca,
+  0x8a, 0x31, 0x23, 0x80, 0xca, 0xbc, 0xab, 0x18, 0x22, 0x02, 0xc8, 0xae,
+  0x38, 0x47, 0x12, 0xa0, 0xa9, 0x10, 0x11, 0xa0, 0xbd, 0xaa, 0xa8, 0x99,
+  0x41, 0x05, 0xee, 0x09, 0x43, 0x24, 0xc0, 0x8c, 0x21, 0x22, 0x00, 0x89,
+  0xaa, 0xbc, 0x9a, 0x11, 0x02, 0xa9, 0xcb, 0xac, 0x50, 0x46, 0x22, 0xa8,
+  0x8a, 0x20, 0x22, 0xa0, 0xcc, 0xbb, 0x99, 0x08, 0x90, 0x99, 0xff, 0x0a,
+  0x71, 0x33, 0xc0, 0x9c, 0x41, 0x12, 0x00, 0x98, 0xc2, 0x55, 0x4d, 0x00,
+  0xa8, 0xac, 0x99, 0x11, 0x80, 0xba, 0xad, 0x8a, 0x71, 0x34, 0x03, 0x99,
+  0x19, 0x22, 0x12, 0xb9, 0xbe, 0xac, 0x9a, 0x08, 0x22, 0xd0, 0xcf, 0x08,
+  0x44, 0x33, 0xc8, 0x9c, 0x32, 0x33, 0x81, 0xa8, 0xcc, 0xaa, 0x09, 0x01,
+  0x90, 0xcb, 0xab, 0x0a, 0x65, 0x44, 0x01, 0x99, 0x09, 0x32, 0x02, 0xc9,
+  0xad, 0x9a, 0x18, 0x11, 0xc8, 0xcf, 0x0a, 0x70, 0x33, 0xd8, 0x9b, 0x32,
+  0x23, 0x01, 0x80, 0xb8, 0xae, 0x1a, 0x12, 0x90, 0xcb, 0xac, 0x8a, 0x31,
+  0x47, 0x12, 0xa9, 0x19, 0x33, 0x22, 0xa8, 0xbd, 0xab, 0xaa, 0x8a, 0x00,
+  0xe0, 0xcf, 0x09, 0x53, 0x24, 0xa0, 0x9c, 0x31, 0x33, 0x12, 0x98, 0xda,
+  0xbb, 0x8a, 0x00, 0xa9, 0xbc, 0xcb, 0x9a, 0x72, 0x44, 0x12, 0xa8, 0x28,
+  0x42, 0x12, 0xa8, 0xcc, 0x9a, 0x00, 0x08, 0xda, 0xcf, 0x8a, 0x61, 0x24,
+  0xc9, 0x8b, 0x32, 0x23, 0x02, 0x80, 0xb8, 0xbc, 0x18, 0x22, 0xc9, 0xcc,
+  0xac, 0x89, 0x31, 0x35, 0x02, 0x99, 0x31, 0x35, 0x13, 0x90, 0xdb, 0xab,
+  0x08, 0xa8, 0xcc, 0xbe, 0x9c, 0x20, 0x36, 0x02, 0xbc, 0x29, 0x35, 0x33,
+  0x81, 0xa8, 0xcb, 0x8a, 0x01, 0x90, 0xec, 0xac, 0x9a, 0x20, 0x53, 0x02,
+  0x99, 0x48, 0x53, 0x22, 0x81, 0xa9, 0x9a, 0x89, 0x00, 0xfa, 0xce, 0xac,
+  0x30, 0x27, 0xa0, 0xac, 0x20, 0x33, 0x23, 0x80, 0xa9, 0xba, 0x19, 0x33,
+  0xb1, 0xcf, 0xac, 0x8b, 0x20, 0x34, 0x90, 0x9a, 0x52, 0x44, 0x12, 0x80,
+  0x9a, 0x99, 0x08, 0xa1, 0xed, 0xcd, 0x8a, 0x53, 0x23, 0xda, 0x8b, 0x31,
+  0x34, 0x12, 0x88, 0x99, 0x9a, 0x19, 0x22, 0xb0, 0xdf, 0xbb, 0x8a, 0x43,
+  0x23, 0xda, 0x0a, 0x43, 0x43, 0x12, 0x89, 0x8a, 0x10, 0x33, 0xb0, 0xff,
+  0xad, 0x29, 0x44, 0x91, 0xbc, 0x19, 0x32, 0x23, 0x01, 0x98, 0xaa, 0x18,
+  0x00, 0x13, 0x43, 0x00, 0x43, 0x82, 0xfa, 0xbc, 0x9a, 0x31, 0x12, 0xb9,
+  0x9c, 0x42, 0x25, 0x23, 0x98, 0x88, 0x00, 0x61, 0x93, 0xff, 0x9b, 0x31,
+  0x26, 0xb9, 0x9c, 0x10, 0x32, 0x12, 0x88, 0x89, 0x99, 0x08, 0x53, 0x02,
+  0xea, 0xcc, 0x89, 0x32, 0x02, 0xc9, 0x9b, 0x31, 0x44, 0x12, 0x90, 0xa8,
+  0x28, 0x63, 0x02, 0xed, 0xad, 0x38, 0x35, 0xb0, 0xad, 0x18, 0x32, 0x03,
+  0x98, 0x89, 0x89, 0x19, 0x34, 0x03, 0xfa, 0xbc, 0x0a, 0x53, 0x82, 0xca,
+  0x8a, 0x31, 0x34, 0x02, 0xbc, 0x19, 0x32, 0x32, 0x92, 0xce, 0xeb, 0x8b,
+  0x52, 0x24, 0xb8, 0xad, 0x18, 0x33, 0x33, 0x90, 0xda, 0xaa, 0x30, 0x25,
+  0x81, 0xcc, 0xbb, 0x29, 0x34, 0x83, 0xdb, 0x8a, 0x31, 0x43, 0x12, 0xb8,
+  0x9a, 0x11, 0x45, 0x92, 0xfe, 0xab, 0x51, 0x24, 0xb9, 0xac, 0x10, 0x33,
+  0x82, 0x88, 0x98, 0x9a, 0x28, 0x44, 0x01, 0xda, 0xbc, 0x0a, 0x42, 0x13,
+  0xda, 0x9a, 0x41, 0x32, 0x02, 0x99, 0x89, 0x11, 0x42, 0x91, 0xff, 0xac,
+  0x40, 0x25, 0xb8, 0xac, 0x20, 0x33, 0x01, 0x98, 0x98, 0x99, 0x10, 0x43,
+  0x91, 0xdc, 0xcb, 0x0a, 0x43, 0x12, 0xca, 0xab, 0x41, 0x34, 0x02, 0xa9,
+  0x8b, 0x41, 0x24, 0x92, 0xde, 0xad, 0x38, 0x35, 0xa1, 0xbd, 0x19, 0x32,
+  0x23, 0x90, 0xaa, 0x88, 0x08, 0x31, 0x14, 0xb8, 0xdf, 0x8a, 0x21, 0x22,
+  0xa8, 0xbb, 0x30, 0x45, 0x22, 0xb9, 0x9d, 0x21, 0x32, 0x13, 0xfa, 0xdd,
+  0x8a, 0x42, 0x34, 0xb0, 0xbd, 0x19, 0x43, 0x13, 0x90, 0xab, 0x9b, 0x20,
+  0x33, 0x93, 0xed, 0xab, 0x18, 0x33, 0x03, 0xca, 0x9b, 0x53, 0x34, 0x81,
+  0xa9, 0x19, 0x33, 0x14, 0xfc, 0xdf, 0x28, 0x53, 0xa1, 0xac, 0x19, 0x32,
+  0x13, 0xa8, 0x8a, 0x89, 0x10, 0x32, 0x83, 0xeb, 0xcc, 0xaa, 0x51, 0x23,
+  0xc9, 0xab, 0x30, 0x35, 0x4f, 0x13, 0x4a, 0x00, 0x12, 0xa9, 0x89, 0x21,
+  0x12, 0x80, 0xfd, 0xbf, 0x30, 0x35, 0xb0, 0x9e, 0x18, 0x32, 0x02, 0xa8,
+  0x89, 0x08, 0x00, 0x32, 0x81, 0xcd, 0xad, 0x1a, 0x32, 0x82, 0xca, 0x9a,
+  0x32, 0x35, 0x12, 0xa9, 0x09, 0x51, 0x34, 0x81, 0xde, 0xbc, 0x29, 0x36,
+  0xa2, 0xbd, 0x09, 0x32, 0x23, 0x91, 0xa9, 0x9a, 0x28, 0x54, 0x02, 0xca,
+  0xbc, 0x0a, 0x41, 0x12, 0xd9, 0xab, 0x31, 0x35, 0x01, 0xa9, 0x09, 0x32,
+  0x02, 0x01, 0xfd, 0xcf, 0x20, 0x34, 0xb1, 0xbd, 0x18, 0x43, 0x02, 0xa8,
+  0x99, 0x88, 0x10, 0x23, 0x83, 0xfb, 0xbc, 0x0a, 0x53, 0x12, 0xca, 0x9b,
+  0x30, 0x34, 0x12, 0xb9, 0x8b, 0x30, 0x35, 0x23, 0xfc, 0xae, 0x19, 0x35,
+  0x82, 0xbd, 0x0a, 0x32, 0x23, 0x91, 0xaa, 0x9a, 0x18, 0x53, 0x13, 0xe9,
+  0xbc, 0x89, 0x53, 0x02, 0xca, 0x9a, 0x31, 0x43, 0x01, 0x9a, 0x09, 0x22,
+  0x82, 0xa8, 0xff, 0x9e, 0x41, 0x14, 0xc8, 0x9b, 0x21, 0x33, 0x81, 0xaa,
+  0x89, 0x00, 0x21, 0x23, 0xc9, 0xce, 0x9b, 0x30, 0x24, 0xa0, 0xac, 0x19,
+  0x34, 0x24, 0xa0, 0xaa, 0x20, 0x24, 0x23, 0xf9, 0xcf, 0x0a, 0x53, 0x03,
+  0xdb, 0x8a, 0x21, 0x24, 0x80, 0x99, 0x9a, 0x18, 0x42, 0x12, 0xc9, 0xbc,
+  0x9c, 0x40, 0x33, 0xc8, 0xac, 0x28, 0x34, 0x23, 0xa9, 0x9a, 0x08, 0x41,
+  0x23, 0xf8, 0xcf, 0x09, 0x53, 0x02, 0xda, 0x8a, 0x21, 0x14, 0x01, 0xa9,
+  0x9a, 0x00, 0x22, 0x23, 0xca, 0xce, 0x8a, 0x31, 0x14, 0xb0, 0x9d, 0x28,
+  0x32, 0x23, 0xa8, 0x9b, 0x20, 0x25, 0x23, 0xf9, 0xbf, 0x0a, 0x63, 0x03,
+  0xdb, 0x9a, 0x31, 0x33, 0x01, 0xb9, 0xaa, 0x19, 0x43, 0x14, 0xb0, 0xcc,
+  0xab, 0x19, 0x34, 0x82, 0xdc, 0x0a, 0x43, 0x23, 0x91, 0xb9, 0x10, 0x21,
+  0x12, 0xb0, 0xff, 0xaf, 0x41, 0x23, 0xd9, 0x8b, 0x87, 0x96, 0x52, 0x00,
+  0x20, 0x24, 0x81, 0xa9, 0x89, 0x00, 0x22, 0x12, 0xd9, 0xbc, 0x9a, 0x38,
+  0x23, 0xb8, 0xbc, 0x29, 0x55, 0x23, 0xa0, 0x99, 0x30, 0x35, 0x02, 0xfa,
+  0xcd, 0x8b, 0x73, 0x12, 0xda, 0x8a, 0x20, 0x23, 0x82, 0xb9, 0x99, 0x10,
+  0x33, 0x14, 0xc8, 0xbd, 0xab, 0x40, 0x24, 0xb8, 0xad, 0x29, 0x53, 0x12,
+  0x98, 0x99, 0x09, 0x32, 0x43, 0xb2, 0xff, 0x9c, 0x42, 0x23, 0xd8, 0xab,
+  0x20, 0x43, 0x02, 0xa9, 0xab, 0x18, 0x32, 0x33, 0xc0, 0xcd, 0xab, 0x48,
+  0x43, 0xa1, 0xbd, 0x18, 0x23, 0x33, 0x90, 0xac, 0x18, 0x43, 0x33, 0xf9,
+  0xcd, 0x1b, 0x63, 0x03, 0xcb, 0x9b, 0x21, 0x24, 0x02, 0xb9, 0xbb, 0x20,
+  0x34, 0x04, 0xb9, 0xbd, 0x99, 0x21, 0x22, 0x90, 0xcc, 0x1a, 0x63, 0x23,
+  0x00, 0xaa, 0x09, 0x21, 0x22, 0xc1, 0xff, 0x9d, 0x30, 0x26, 0xb8, 0xac,
+  0x20, 0x33, 0x03, 0xa9, 0xab, 0x28, 0x42, 0x13, 0xe9, 0xab, 0xaa, 0x19,
+  0x32, 0x90, 0xaa, 0x9b, 0x64, 0x34, 0x02, 0x99, 0x0a, 0x53, 0x22, 0xb0,
+  0xcf, 0xbd, 0x2a, 0x46, 0x81, 0xad, 0x09, 0x31, 0x23, 0x90, 0xb9, 0x09,
+  0x31, 0x23, 0x00, 0xeb, 0xbc, 0x8a, 0x20, 0x01, 0xa0, 0xad, 0x29, 0x37,
+  0x13, 0x82, 0xba, 0x8c, 0x44, 0x22, 0xd9, 0xcf, 0x0a, 0x43, 0x14, 0xd9,
+  0xaa, 0x30, 0x32, 0x13, 0xb9, 0xac, 0x29, 0x32, 0x24, 0xb9, 0xbe, 0xab,
+  0x40, 0x43, 0xa1, 0xbc, 0x19, 0x32, 0x34, 0x91, 0xba, 0x09, 0x52, 0x24,
+  0xc0, 0xcf, 0x8b, 0x44, 0x13, 0xda, 0x9b, 0x20, 0x43, 0x11, 0xa8, 0xbb,
+  0x19, 0x53, 0x12, 0xc9, 0xab, 0x9a, 0x10, 0x12, 0x01, 0xb9, 0x9d, 0x72,
+  0x33, 0x12, 0xb9, 0x9b, 0x11, 0x12, 0x80, 0xfe, 0xcf, 0x18, 0x35, 0x91,
+  0xbc, 0x09, 0x43, 0x13, 0x80, 0xab, 0x8a, 0x31, 0x33, 0xc0, 0xbd, 0xab,
+  0xc0, 0xcf, 0x46, 0x00, 0x89, 0x11, 0x23, 0x91, 0xaa, 0x29, 0x67, 0x13,
+  0x80, 0x9a, 0x18, 0x21, 0x82, 0xcb, 0xfd, 0xad, 0x29, 0x45, 0x82, 0xbc,
+  0x8a, 0x32, 0x35, 0x81, 0xba, 0x9c, 0x30, 0x24, 0x80, 0xdb, 0xaa, 0x89,
+  0x10, 0x21, 0x00, 0xa8, 0x09, 0x47, 0x33, 0x81, 0xba, 0x9c, 0x20, 0x02,
+  0xb9, 0xde, 0xcd, 0x09, 0x73, 0x13, 0xca, 0x9b, 0x41, 0x43, 0x01, 0xb9,
+  0xaa, 0x18, 0x22, 0x02, 0xcc, 0xbc, 0x99, 0x11, 0x32, 0x12, 0xa8, 0x99,
+  0x73, 0x34, 0x02, 0xb9, 0xb9, 0x08, 0x01, 0x90, 0xfe, 0xbe, 0x19, 0x54,
+  0x02, 0xca, 0x8b, 0x32, 0x35, 0x81, 0xc9, 0x9a, 0x20, 0x22, 0xa0, 0xbc,
+  0xab, 0x99, 0x89, 0x30, 0x45, 0x02, 0x98, 0x51, 0x44, 0x02, 0xc8, 0x9b,
+  0x09, 0x98, 0x88, 0xe8, 0xce, 0x9b, 0x71, 0x43, 0xa0, 0xbc, 0x20, 0x34,
+  0x12, 0x98, 0xcb, 0x8a, 0x11, 0x12, 0xc8, 0xbc, 0xab, 0x18, 0x43, 0x24,
+  0x02, 0xa9, 0x19, 0x35, 0x24, 0x91, 0xdb, 0xab, 0x18, 0x00, 0xb8, 0xff,
+  0xaa, 0x40, 0x35, 0x91, 0xbc, 0x29, 0x43, 0x23, 0x90, 0xcb, 0x8a, 0x00,
+  0x01, 0xb8, 0xad, 0x8a, 0x80, 0x99, 0x48, 0x47, 0x13, 0x98, 0x08, 0x12,
+  0x98, 0xba, 0xaa, 0xb8, 0xcf, 0x8a, 0x10, 0xfc, 0x9b, 0x73, 0x25, 0xa0,
+  0xac, 0x38, 0x24, 0x01, 0xa8, 0xbb, 0x8a, 0x10, 0x11, 0xb8, 0xbe, 0x8a,
+  0x20, 0x21, 0x55, 0x33, 0x91, 0xbc, 0x20, 0x32, 0x81, 0xcd, 0x9c, 0x89,
+  0x80, 0x00, 0xd0, 0xbe, 0x39, 0x47, 0x22, 0xc9, 0x8c, 0x21, 0x23, 0x81,
+  0xba, 0xcb, 0x9b, 0x28, 0x32, 0xa0, 0xad, 0x18, 0x80, 0x40, 0x57, 0x12,
+  0x98, 0xab, 0x08, 0x01, 0xa9, 0xbb, 0x9a, 0xa9, 0xad, 0x20, 0xf9, 0x9d,
+  0x72, 0x25, 0x92, 0xdb, 0x19, 0x32, 0x12, 0x98, 0xbc, 0xab, 0x09, 0x11,
+  0x01, 0x98, 0x89, 0x10, 0xfe, 0xe0, 0x3d, 0x00, 0x20, 0x57, 0x25, 0x82,
+  0xda, 0x9a, 0x18, 0x80, 0xa9, 0x9b, 0x08, 0x00, 0x08, 0xc0, 0xce, 0x38,
+  0x77, 0x12, 0xa8, 0xac, 0x18, 0x23, 0x82, 0xb9, 0xbc, 0x9b, 0x08, 0x11,
+  0x22, 0x44, 0x13, 0xa9, 0x0b, 0x64, 0x22, 0xa8, 0xcd, 0x9a, 0x08, 0x10,
+  0x98, 0x18, 0x03, 0xff, 0x9a, 0x63, 0x24, 0x91, 0xcb, 0x19, 0x22, 0x01,
+  0x99, 0x8a, 0xd9, 0xbb, 0x8a, 0x42, 0x43, 0x11, 0xa9, 0x28, 0x44, 0x14,
+  0x90, 0xba, 0xbc, 0xab, 0xaa, 0x19, 0x52, 0x23, 0x88, 0xfb, 0x9e, 0x38,
+  0x47, 0x12, 0xa8, 0xcb, 0x0a, 0x11, 0x13, 0x80, 0xca, 0xac, 0x9a, 0x28,
+  0x42, 0x34, 0x23, 0x80, 0xbb, 0x1a, 0x33, 0x93, 0xdf, 0xab, 0x9b, 0x09,
+  0x31, 0x36, 0x32, 0x91, 0xff, 0x0a, 0x52, 0x14, 0x90, 0xbb, 0x0a, 0x21,
+  0x81, 0xb9, 0x8a, 0x43, 0xa1, 0xbe, 0x1a, 0x44, 0x43, 0x81, 0xba, 0x0a,
+  0x23, 0xb0, 0xce, 0x89, 0x02, 0xba, 0xab, 0x48, 0x45, 0x43, 0x13, 0x90,
+  0xce, 0xab, 0x30, 0x35, 0x03, 0xda, 0xac, 0x89, 0x31, 0x33, 0x12, 0x98,
+  0xaa, 0xcb, 0x8b, 0x30, 0x46, 0x22, 0xb9, 0xbe, 0x8a, 0x21, 0x12, 0x02,
+  0x20, 0x02, 0xca, 0xbd, 0x39, 0x55, 0x24, 0xe8, 0xbc, 0x0b, 0x53, 0x33,
+  0xa0, 0xac, 0x19, 0x43, 0x81, 0xca, 0x0a, 0x32, 0x91, 0xdd, 0x8a, 0x31,
+  0x33, 0x82, 0xaa, 0x29, 0x26, 0xa0, 0xbd, 0x0a, 0x11, 0xb9, 0x9c, 0x42,
+  0x44, 0x23, 0x01, 0xb8, 0xdf, 0xaa, 0x28, 0x35, 0x23, 0xb8, 0xae, 0x9a,
+  0x22, 0x43, 0x01, 0x98, 0x9a, 0xba, 0xac, 0x88, 0x31, 0x36, 0x13, 0xa9,
+  0xac, 0x11, 0x81, 0xa9, 0x09, 0x31, 0x82, 0xfa, 0xbc, 0x28, 0x37, 0x35,
+  0xb0, 0xdf, 0x8a, 0x42, 0x23, 0x91, 0xbb, 0x0a, 0x32, 0x83, 0xdd, 0x8a,
+  0x32, 0x03, 0xca, 0x9c, 0x21, 0x32, 0x02, 0x88, 0x81, 0x07, 0x39, 0x00,
+  0x22, 0x36, 0xc0, 0xce, 0x9a, 0x10, 0x00, 0x08, 0x21, 0x44, 0x12, 0x21,
+  0x01, 0xc0, 0xef, 0xab, 0x28, 0x53, 0x13, 0xa0, 0xba, 0x0a, 0x41, 0x02,
+  0x88, 0x08, 0x01, 0xec, 0xbc, 0x09, 0x41, 0x23, 0x13, 0x00, 0x11, 0x83,
+  0xec, 0xac, 0x09, 0x11, 0x88, 0x99, 0x41, 0x55, 0x03, 0xfd, 0x9b, 0x48,
+  0x34, 0x01, 0xb8, 0xaa, 0x20, 0x82, 0xfa, 0x9b, 0x30, 0x25, 0xa0, 0xac,
+  0x20, 0x23, 0x81, 0x99, 0x31, 0x25, 0xc1, 0xbe, 0xab, 0x88, 0x01, 0x10,
+  0x42, 0x35, 0x12, 0x80, 0x32, 0x12, 0xfd, 0xbe, 0x8a, 0x30, 0x43, 0x02,
+  0x98, 0x08, 0x08, 0x00, 0x88, 0x99, 0x21, 0xb8, 0xfc, 0xab, 0x10, 0x21,
+  0x10, 0x63, 0x44, 0x12, 0x98, 0xcc, 0xaa, 0x99, 0x9a, 0x19, 0x41, 0x44,
+  0x42, 0x23, 0xe0, 0xce, 0x8a, 0x42, 0x33, 0x91, 0x9a, 0x89, 0x80, 0x98,
+  0xcc, 0x9b, 0x30, 0x36, 0x03, 0x98, 0x89, 0x88, 0xa8, 0x9a, 0x51, 0x34,
+  0x91, 0xed, 0xbb, 0x89, 0x21, 0x11, 0x63, 0x44, 0x02, 0x88, 0x80, 0xa0,
+  0xef, 0xab, 0x0a, 0x32, 0x34, 0x22, 0x21, 0x81, 0xb9, 0xbc, 0xab, 0x8a,
+  0x18, 0x11, 0xa8, 0x1a, 0x46, 0x82, 0xaa, 0x38, 0x56, 0x22, 0x88, 0xda,
+  0xaa, 0xba, 0xbb, 0x0a, 0x51, 0x33, 0x35, 0x63, 0x14, 0xea, 0xbd, 0x0b,
+  0x33, 0x24, 0x00, 0x08, 0x80, 0x90, 0x9a, 0xfa, 0xab, 0x19, 0x44, 0x12,
+  0x00, 0x11, 0x98, 0xcc, 0x8a, 0x31, 0x15, 0x98, 0xbd, 0x09, 0x20, 0xa0,
+  0xbb, 0x72, 0x26, 0x11, 0x80, 0x10, 0x91, 0xdf, 0xbc, 0x09, 0x22, 0x22,
+  0x22, 0x44, 0x21, 0x98, 0xbb, 0xbd, 0xba, 0x09, 0x00, 0x00, 0x53, 0x34,
+  0x12, 0xba, 0x8d, 0x20, 0x01, 0x88, 0x39, 0x22, 0xa1, 0xde, 0xaa, 0x9a,
+  0x98, 0xa9, 0x49, 0x36, 0x37, 0x02, 0xda, 0xbc, 0x09, 0x32, 0x23, 0x20,
+  0x73, 0x06, 0x34, 0x00, 0x31, 0x03, 0xa8, 0xdc, 0xab, 0xbe, 0x8d, 0x28,
+  0x33, 0x43, 0x12, 0x01, 0xaa, 0xb8, 0x80, 0xa2, 0xae, 0x89, 0xb0, 0xaa,
+  0xcc, 0x48, 0x22, 0x9a, 0x74, 0x46, 0x23, 0x90, 0xdc, 0xbb, 0x9a, 0x10,
+  0x11, 0x32, 0x34, 0x25, 0x80, 0xa0, 0xba, 0xcc, 0xbb, 0x8b, 0x02, 0x24,
+  0x25, 0x33, 0x82, 0xca, 0xaa, 0x99, 0xb9, 0x2a, 0x52, 0x03, 0x82, 0xba,
+  0xca, 0xed, 0x19, 0x43, 0x26, 0x81, 0xec, 0xac, 0x18, 0x43, 0x02, 0x88,
+  0x08, 0x23, 0x01, 0xb9, 0xbd, 0xcb, 0xbb, 0x0a, 0x34, 0x36, 0x31, 0x28,
+  0x98, 0x09, 0x98, 0xcc, 0xbc, 0x9a, 0x80, 0x01, 0x28, 0x3a, 0x36, 0x82,
+  0x80, 0x73, 0x47, 0x02, 0xb9, 0xbd, 0xac, 0x89, 0x18, 0x21, 0x62, 0x13,
+  0x12, 0x02, 0xa8, 0xcc, 0xad, 0xaa, 0x99, 0x00, 0x11, 0x64, 0x33, 0x21,
+  0x98, 0x9a, 0x90, 0xba, 0xbf, 0x89, 0x11, 0x33, 0x84, 0x82, 0xa9, 0xae,
+  0xcb, 0x09, 0x71, 0x27, 0x12, 0xa0, 0xbd, 0x8a, 0x21, 0x23, 0xc9, 0x8a,
+  0x28, 0x43, 0x13, 0x98, 0xb9, 0xbc, 0xbd, 0x89, 0x23, 0x08, 0x31, 0x68,
+  0x14, 0x98, 0x08, 0x08, 0x08, 0xb8, 0xc8, 0xcf, 0x80, 0x12, 0x80, 0x80,
+  0x76, 0x25, 0xc0, 0xbf, 0x8b, 0x31, 0x25, 0x81, 0x88, 0x28, 0x34, 0x01,
+  0xca, 0xae, 0xab, 0x99, 0x10, 0x32, 0x42, 0x31, 0x33, 0x14, 0xa9, 0x8b,
+  0x99, 0xfd, 0xbc, 0x0a, 0x22, 0x14, 0x81, 0x31, 0x34, 0x12, 0x89, 0x8c,
+  0x08, 0x98, 0xdc, 0xbe, 0xbc, 0x08, 0x63, 0x23, 0x02, 0x00, 0x22, 0x32,
+  0xd8, 0xcd, 0xbb, 0x88, 0x09, 0x08, 0x10, 0x64, 0x33, 0x02, 0x00, 0xaa,
+  0xaa, 0x9b, 0xdb, 0x9a, 0x19, 0x12, 0x34, 0x22, 0x22, 0x80, 0x0f, 0x9c,
+  0x80, 0x22, 0x27, 0x24, 0xa8, 0xdf, 0xbb, 0x18, 0x43, 0x23, 0x08, 0x00,
+  0x42, 0x23, 0xa0, 0xfa, 0x1c, 0x09, 0x37, 0x00, 0xcc, 0xab, 0x89, 0x21,
+  0x23, 0x01, 0x31, 0x47, 0x43, 0x81, 0xa9, 0xbc, 0xbc, 0xaa, 0xbb, 0x09,
+  0x44, 0x32, 0x26, 0x13, 0x33, 0x21, 0x10, 0xea, 0xdc, 0xbd, 0xba, 0x88,
+  0x38, 0x35, 0x43, 0x23, 0x31, 0x01, 0x90, 0xce, 0xbb, 0xac, 0x9a, 0x08,
+  0x30, 0x52, 0x22, 0x43, 0x22, 0x02, 0xa9, 0xad, 0x99, 0xaa, 0xca, 0x98,
+  0x98, 0x80, 0x80, 0x80, 0x36, 0x25, 0x22, 0x62, 0x25, 0x02, 0xfa, 0xbe,
+  0x9a, 0x20, 0x33, 0x81, 0x99, 0x41, 0x64, 0x02, 0xa0, 0xcc, 0xaa, 0x09,
+  0x00, 0x01, 0x99, 0x1a, 0x55, 0x35, 0x01, 0xa9, 0xaa, 0x98, 0xaa, 0xcd,
+  0xbb, 0x19, 0x53, 0x33, 0x04, 0x22, 0x44, 0x33, 0x90, 0xdd, 0xcb, 0xac,
+  0x9b, 0x19, 0x52, 0x43, 0x23, 0x22, 0x12, 0x80, 0xe9, 0xdb, 0xab, 0xaa,
+  0x89, 0x00, 0x42, 0x53, 0x32, 0x13, 0x91, 0xa1, 0x98, 0xd8, 0xbb, 0x9d,
+  0x99, 0x90, 0x00, 0x00, 0x13, 0x42, 0x23, 0x16, 0x81, 0x21, 0x47, 0x01,
+  0xfa, 0xbe, 0x9a, 0x21, 0x44, 0x02, 0x90, 0x08, 0x42, 0x23, 0xc8, 0xdd,
+  0xaa, 0x09, 0x10, 0x11, 0x00, 0x00, 0x52, 0x53, 0x02, 0xb8, 0xa9, 0x09,
+  0xa9, 0xce, 0xab, 0x9a, 0x80, 0x33, 0x36, 0x34, 0x33, 0x34, 0x23, 0xb8,
+  0xcf, 0xcc, 0xbb, 0x9a, 0x30, 0x46, 0x22, 0x02, 0x01, 0x01, 0x80, 0xdb,
+  0xbd, 0xcb, 0x99, 0x10, 0x22, 0x32, 0x43, 0x33, 0x83, 0xd9, 0xbb, 0x19,
+  0x21, 0x82, 0xb0, 0x9b, 0xbc, 0x80, 0xfa, 0xdb, 0x89, 0x30, 0x36, 0x43,
+  0x21, 0x11, 0x43, 0x03, 0xfa, 0xff, 0x9a, 0x08, 0x22, 0x24, 0x10, 0x09,
+  0x21, 0x34, 0x91, 0xec, 0xbb, 0x9b, 0x00, 0x22, 0x12, 0x98, 0x28, 0x56,
+  0x23, 0xa0, 0xba, 0x0a, 0x81, 0xda, 0xcb, 0x89, 0x00, 0x11, 0x80, 0x08,
+  0x43, 0x47, 0x32, 0x02, 0xa9, 0x18, 0x32, 0xfa, 0xd8, 0x11, 0x39, 0x00,
+  0xff, 0x9b, 0x08, 0x32, 0x24, 0x11, 0x01, 0x32, 0x22, 0xa0, 0xce, 0xad,
+  0xab, 0x89, 0x10, 0x21, 0x23, 0x34, 0x23, 0x22, 0x90, 0xb9, 0x88, 0x98,
+  0xfa, 0xad, 0x89, 0x28, 0x90, 0xeb, 0xac, 0x28, 0x46, 0x23, 0x01, 0x08,
+  0x20, 0x23, 0x12, 0xfb, 0xbf, 0xad, 0x9a, 0x20, 0x43, 0x23, 0x11, 0x22,
+  0x44, 0x22, 0xb8, 0xdf, 0xaa, 0x8a, 0x10, 0x00, 0x08, 0x18, 0x62, 0x33,
+  0x03, 0x89, 0x88, 0x80, 0xb8, 0xcd, 0xac, 0x8a, 0x88, 0x00, 0x08, 0x31,
+  0x37, 0x34, 0x03, 0x88, 0x10, 0x10, 0x11, 0xe3, 0xff, 0x9f, 0x89, 0x21,
+  0x33, 0x82, 0x18, 0x54, 0x23, 0xa0, 0xca, 0xbc, 0xbb, 0xab, 0x89, 0x21,
+  0x01, 0x38, 0x57, 0x14, 0x81, 0x89, 0x08, 0x01, 0xa8, 0xae, 0x9a, 0x99,
+  0x99, 0x20, 0x01, 0x10, 0x54, 0x24, 0x82, 0xbb, 0x9b, 0x53, 0x02, 0x80,
+  0x43, 0x82, 0xdf, 0xbc, 0x8a, 0x32, 0x33, 0x12, 0x22, 0x52, 0x45, 0x12,
+  0xb9, 0xce, 0x9c, 0x89, 0x80, 0x88, 0x08, 0x21, 0x43, 0x43, 0x11, 0x01,
+  0x88, 0x18, 0x11, 0xfb, 0xbd, 0x9a, 0x99, 0x88, 0x99, 0x42, 0x26, 0x22,
+  0x10, 0x01, 0x10, 0x42, 0x32, 0xe0, 0xff, 0xac, 0x89, 0x32, 0x14, 0x91,
+  0x20, 0x46, 0x12, 0x90, 0xaa, 0xcb, 0xcb, 0x9c, 0x09, 0x01, 0x98, 0x18,
+  0x56, 0x23, 0x80, 0x09, 0x11, 0x92, 0xda, 0xab, 0xab, 0xcb, 0x9a, 0x21,
+  0x24, 0x10, 0x63, 0x34, 0x02, 0xb9, 0x9b, 0x10, 0xba, 0xac, 0x80, 0xfc,
+  0xcc, 0x0a, 0x44, 0x23, 0x12, 0x10, 0x31, 0x24, 0x81, 0xd9, 0xdd, 0xab,
+  0x9a, 0x00, 0x08, 0x88, 0x41, 0x43, 0x33, 0x23, 0x02, 0x98, 0xca, 0x99,
+  0x90, 0xbf, 0xbc, 0x8a, 0x10, 0x01, 0x21, 0x26, 0x32, 0x11, 0x80, 0x99,
+  0xb9, 0x38, 0x47, 0x13, 0xfb, 0xef, 0x89, 0x21, 0x23, 0x80, 0x08, 0x53,
+  0x07, 0x1f, 0x43, 0x00, 0x24, 0x81, 0xba, 0xbc, 0xdb, 0xab, 0x89, 0x11,
+  0x90, 0x19, 0x74, 0x24, 0x12, 0x99, 0x08, 0x01, 0xb8, 0xcc, 0x9c, 0xbb,
+  0x8a, 0x21, 0x24, 0x02, 0x31, 0x47, 0x11, 0x90, 0x00, 0x11, 0xb8, 0xdf,
+  0xcc, 0x9b, 0x19, 0x53, 0x12, 0x08, 0x72, 0x24, 0x02, 0x98, 0x99, 0xca,
+  0xbd, 0x9b, 0x18, 0xa8, 0xab, 0x51, 0x36, 0x02, 0x88, 0x30, 0x33, 0xa0,
+  0xba, 0xaa, 0xec, 0xad, 0x8a, 0x11, 0x91, 0x19, 0x73, 0x23, 0x81, 0x98,
+  0x21, 0x91, 0x9c, 0x89, 0x90, 0xff, 0xab, 0x18, 0x44, 0x12, 0x80, 0x21,
+  0x43, 0x23, 0x90, 0xda, 0xcd, 0xab, 0x8a, 0x00, 0x90, 0x88, 0x40, 0x24,
+  0x43, 0x12, 0x91, 0x99, 0x18, 0x12, 0xb0, 0xef, 0xaa, 0x89, 0x80, 0x00,
+  0x21, 0x24, 0x22, 0x02, 0x02, 0x80, 0xa9, 0x9c, 0x72, 0x36, 0xf8, 0xbe,
+  0x9b, 0x21, 0x25, 0x01, 0x08, 0x63, 0x24, 0x81, 0xa8, 0xaa, 0xeb, 0xac,
+  0x9b, 0x10, 0x80, 0x99, 0x50, 0x45, 0x12, 0x00, 0x08, 0x01, 0xa8, 0xba,
+  0xcb, 0xcc, 0xac, 0x09, 0x32, 0x13, 0x10, 0x52, 0x44, 0x02, 0x88, 0x08,
+  0x01, 0xea, 0xdd, 0xbb, 0x0a, 0x31, 0x24, 0x00, 0x40, 0x46, 0x13, 0x81,
+  0x88, 0xa9, 0xce, 0xab, 0x08, 0x80, 0xcb, 0x0a, 0x44, 0x33, 0x81, 0x08,
+  0x11, 0x02, 0x28, 0x32, 0xa1, 0xff, 0xab, 0x09, 0x80, 0x98, 0x19, 0x43,
+  0x23, 0x12, 0x42, 0x12, 0xda, 0x8a, 0x43, 0xe0, 0xcf, 0x9a, 0x10, 0x33,
+  0x23, 0x12, 0x53, 0x33, 0x23, 0x90, 0xfc, 0xcb, 0xbb, 0x99, 0x80, 0x80,
+  0x00, 0x40, 0x44, 0x33, 0x12, 0xa0, 0x89, 0x11, 0x82, 0xdc, 0xbd, 0xac,
+  0x8a, 0x00, 0x21, 0x22, 0x43, 0x53, 0x22, 0x02, 0x91, 0xba, 0xbc, 0x99,
+  0xc9, 0xff, 0xac, 0x08, 0x42, 0x33, 0x02, 0x31, 0x46, 0x12, 0x90, 0xb9,
+  0xbc, 0xdc, 0xab, 0x0a, 0x02, 0xc6, 0x44, 0x00, 0x00, 0x98, 0x08, 0x73,
+  0x24, 0x03, 0x08, 0x18, 0x11, 0x90, 0x99, 0xcb, 0xde, 0xab, 0x09, 0x22,
+  0x11, 0x10, 0x42, 0x43, 0x12, 0x12, 0x11, 0x99, 0xcc, 0xec, 0xcc, 0xaa,
+  0x18, 0x32, 0x14, 0x32, 0x45, 0x34, 0x02, 0x90, 0xa9, 0xdc, 0xbc, 0xab,
+  0x88, 0x98, 0x99, 0x30, 0x36, 0x24, 0x01, 0x10, 0x11, 0x10, 0x00, 0x12,
+  0xfa, 0xdc, 0xab, 0x89, 0x00, 0x81, 0x32, 0x43, 0x12, 0x33, 0x53, 0x12,
+  0xb9, 0xad, 0xb9, 0xde, 0xbd, 0x9b, 0x21, 0x25, 0x33, 0x43, 0x44, 0x22,
+  0x01, 0xa8, 0xbc, 0xbe, 0xbc, 0x8b, 0x88, 0x80, 0x00, 0x42, 0x34, 0x24,
+  0x01, 0x21, 0x12, 0x00, 0xaa, 0xcc, 0xdd, 0xca, 0x99, 0x10, 0x11, 0x01,
+  0x21, 0x44, 0x24, 0x12, 0x00, 0xba, 0xab, 0xa9, 0xfd, 0xbd, 0x9b, 0x31,
+  0x36, 0x22, 0x10, 0x41, 0x53, 0x01, 0xa8, 0xba, 0xcd, 0xcb, 0x9a, 0x10,
+  0x10, 0xa9, 0x0a, 0x45, 0x24, 0x01, 0x98, 0x08, 0x12, 0x22, 0x11, 0xa0,
+  0xdf, 0xac, 0x8a, 0x11, 0x81, 0x80, 0x10, 0x24, 0x23, 0x23, 0x33, 0x82,
+  0x89, 0xeb, 0xff, 0xcb, 0x9b, 0x21, 0x34, 0x33, 0x33, 0x36, 0x23, 0x01,
+  0xb8, 0xec, 0xcb, 0xac, 0x9a, 0x10, 0x00, 0x00, 0x20, 0x34, 0x24, 0x12,
+  0x11, 0x01, 0x80, 0x88, 0xb9, 0xdf, 0xbc, 0x9c, 0x08, 0x21, 0x22, 0x01,
+  0x22, 0x52, 0x33, 0x33, 0x82, 0xcd, 0xbb, 0xbd, 0xdc, 0xbb, 0x19, 0x44,
+  0x33, 0x32, 0x44, 0x34, 0x12, 0x98, 0xbb, 0xbd, 0xcd, 0xab, 0x88, 0x00,
+  0x99, 0x08, 0x34, 0x24, 0x81, 0x08, 0x53, 0x33, 0x33, 0x02, 0xb8, 0xff,
+  0xab, 0x8a, 0x08, 0x00, 0x00, 0x32, 0x43, 0x33, 0x33, 0x44, 0x02, 0xd8,
+  0xee, 0xac, 0x9a, 0x10, 0x33, 0x43, 0x43, 0x43, 0x32, 0x11, 0x98, 0xdc,
+  0xbd, 0xbb, 0x8a, 0x10, 0x01, 0x00, 0x20, 0x33, 0x28, 0xf1, 0x39, 0x00,
+  0x14, 0x20, 0x30, 0x32, 0x53, 0x34, 0x83, 0xfa, 0xbd, 0xac, 0x89, 0x88,
+  0x11, 0x12, 0x31, 0x42, 0x26, 0x22, 0x01, 0xb9, 0xad, 0xda, 0xcd, 0xbb,
+  0x89, 0x52, 0x43, 0x32, 0x34, 0x24, 0x11, 0x88, 0xba, 0xdc, 0xbc, 0xbb,
+  0x89, 0x20, 0x10, 0x88, 0x08, 0x33, 0x02, 0x62, 0x45, 0x43, 0x02, 0x01,
+  0xa9, 0xdd, 0xcb, 0x9a, 0x09, 0x00, 0x01, 0x21, 0x43, 0x33, 0x53, 0x33,
+  0x23, 0xe9, 0xef, 0xaa, 0x89, 0x21, 0x33, 0x22, 0x32, 0x35, 0x22, 0x01,
+  0xba, 0xde, 0xcb, 0x9a, 0x10, 0x12, 0x91, 0xb9, 0x0a, 0x21, 0x13, 0x01,
+  0x52, 0x34, 0x43, 0x43, 0x01, 0xea, 0xcd, 0x9a, 0x00, 0x88, 0x00, 0x20,
+  0x32, 0x33, 0x33, 0x04, 0xa1, 0xcd, 0x08, 0x91, 0xef, 0xcc, 0x99, 0x31,
+  0x54, 0x22, 0x12, 0x11, 0x11, 0x88, 0xca, 0xeb, 0xdb, 0xaa, 0x09, 0x23,
+  0x12, 0xa9, 0x8b, 0x18, 0x22, 0x45, 0x25, 0x24, 0x01, 0x88, 0xaa, 0xcc,
+  0xbc, 0xbb, 0x18, 0x21, 0x00, 0x10, 0x53, 0x34, 0x13, 0x13, 0x81, 0x80,
+  0xee, 0xcd, 0xac, 0x09, 0x52, 0x43, 0x02, 0x81, 0x21, 0x22, 0x90, 0xeb,
+  0xbc, 0xba, 0x99, 0x20, 0x32, 0xa0, 0xce, 0x8a, 0x32, 0x24, 0x01, 0x10,
+  0x53, 0x22, 0x81, 0xa0, 0xeb, 0xbd, 0x9b, 0x28, 0x22, 0x92, 0x09, 0x41,
+  0x42, 0x90, 0xaa, 0x8b, 0x73, 0x15, 0xe8, 0xce, 0xaa, 0x10, 0x36, 0x24,
+  0x00, 0x80, 0x10, 0x81, 0xc9, 0xcb, 0xcb, 0xaa, 0x89, 0x42, 0x14, 0xb0,
+  0xac, 0x09, 0x33, 0x34, 0x32, 0x43, 0x12, 0xb9, 0xbc, 0xbb, 0xeb, 0xab,
+  0x8b, 0x32, 0x12, 0x80, 0x51, 0x54, 0x12, 0x91, 0x99, 0x88, 0x90, 0xfe,
+  0xcb, 0x9c, 0x20, 0x55, 0x23, 0x01, 0x98, 0x20, 0x11, 0xb8, 0xce, 0xab,
+  0x9a, 0x08, 0x20, 0x22, 0xb0, 0xbe, 0x09, 0x44, 0x33, 0x81, 0x88, 0x31,
+  0x4a, 0x10, 0x38, 0x00, 0x33, 0x91, 0xca, 0xdd, 0xaa, 0x9a, 0x28, 0x33,
+  0xa0, 0x8c, 0x50, 0x32, 0xb0, 0xae, 0x18, 0x46, 0x03, 0xed, 0xbc, 0x89,
+  0x52, 0x35, 0x12, 0x90, 0x8a, 0x20, 0x01, 0xeb, 0xbc, 0x9a, 0x09, 0x20,
+  0x33, 0x02, 0xdc, 0x9c, 0x20, 0x53, 0x22, 0x10, 0x01, 0x81, 0xc9, 0xbb,
+  0xab, 0xba, 0xa9, 0x29, 0x43, 0x91, 0x0a, 0x66, 0x33, 0x03, 0xb9, 0x0a,
+  0xa9, 0xff, 0xbc, 0x9b, 0x38, 0x47, 0x23, 0x82, 0x90, 0x10, 0x01, 0xb8,
+  0xce, 0xab, 0x88, 0x08, 0x11, 0x90, 0xb9, 0xbd, 0x29, 0x55, 0x23, 0x01,
+  0x88, 0x41, 0x02, 0xb9, 0xbc, 0xbb, 0xab, 0x99, 0x29, 0x24, 0x92, 0x51,
+  0x45, 0x22, 0xda, 0xcc, 0x19, 0x43, 0x91, 0xcf, 0xbb, 0x18, 0x64, 0x24,
+  0x12, 0xa8, 0x9a, 0x11, 0x82, 0xea, 0xbc, 0x8a, 0x20, 0x21, 0x00, 0xba,
+  0x9c, 0x08, 0x63, 0x43, 0x12, 0x00, 0x00, 0x99, 0xd9, 0xcc, 0x09, 0x88,
+  0x10, 0x80, 0x09, 0x10, 0x38, 0x46, 0x11, 0x12, 0x11, 0x20, 0xb4, 0xff,
+  0xbf, 0x88, 0x21, 0x34, 0x12, 0x01, 0x21, 0x01, 0xb8, 0xcc, 0xbb, 0xa9,
+  0x9a, 0x31, 0x12, 0xf8, 0xbd, 0x0a, 0x54, 0x13, 0x81, 0x08, 0x22, 0x82,
+  0xa9, 0x99, 0xcc, 0xbc, 0x9a, 0x11, 0x81, 0x09, 0x72, 0x25, 0x02, 0xb9,
+  0x09, 0x32, 0xf1, 0xdf, 0x9b, 0x08, 0x32, 0x35, 0x23, 0x12, 0x00, 0x80,
+  0x90, 0xcc, 0xbd, 0x9a, 0x08, 0x08, 0x80, 0xa8, 0xbc, 0x29, 0x47, 0x23,
+  0x12, 0x23, 0x00, 0xd9, 0xbc, 0x9a, 0x99, 0xba, 0x19, 0x80, 0x31, 0x46,
+  0x34, 0x23, 0xc9, 0xbe, 0x8a, 0x21, 0x51, 0x13, 0xfb, 0xae, 0x9a, 0x41,
+  0x44, 0x13, 0x98, 0x8a, 0x31, 0x02, 0xea, 0xbd, 0x89, 0x10, 0x22, 0x90,
+  0xba, 0x8a, 0x42, 0x34, 0x13, 0x11, 0x31, 0x13, 0xfb, 0xcd, 0x9a, 0x08,
+  0x01, 0x01, 0x80, 0x80, 0xe3, 0xf2, 0x3a, 0x00, 0x20, 0x65, 0x13, 0x90,
+  0xca, 0x9b, 0x20, 0x44, 0xa1, 0xff, 0x9b, 0x19, 0x62, 0x23, 0x81, 0x8a,
+  0x31, 0x23, 0xe8, 0xbd, 0x89, 0x10, 0x88, 0x89, 0x18, 0x81, 0xaa, 0x71,
+  0x34, 0x12, 0x80, 0x80, 0xa8, 0xdd, 0xbb, 0x18, 0x11, 0xa0, 0x89, 0x63,
+  0x24, 0x01, 0x10, 0x11, 0xca, 0xbd, 0x09, 0x22, 0xfb, 0xbf, 0x8a, 0x31,
+  0x45, 0x22, 0x81, 0x01, 0x11, 0x90, 0xcc, 0xad, 0x99, 0x98, 0x88, 0x10,
+  0x21, 0x88, 0x28, 0x65, 0x43, 0x01, 0x08, 0xa8, 0xca, 0xdc, 0x9a, 0x00,
+  0x01, 0x00, 0x22, 0x35, 0x12, 0x01, 0x00, 0xb8, 0xff, 0x9a, 0x88, 0x11,
+  0x31, 0x43, 0xc0, 0xbf, 0x8a, 0x62, 0x34, 0x11, 0xa8, 0xaa, 0x10, 0x81,
+  0xfb, 0xbb, 0x8a, 0x41, 0x43, 0x82, 0xca, 0x09, 0x41, 0x33, 0x91, 0xb9,
+  0x99, 0xca, 0xdb, 0xaa, 0x18, 0x42, 0x43, 0x22, 0x02, 0x99, 0x09, 0x22,
+  0xc1, 0xef, 0x9a, 0x18, 0x32, 0x36, 0xa1, 0xdf, 0x9a, 0x28, 0x35, 0x23,
+  0xa0, 0x8b, 0x43, 0x83, 0xdd, 0xbb, 0x18, 0x21, 0x90, 0x09, 0x42, 0x02,
+  0xaa, 0x38, 0x37, 0x02, 0xa9, 0xcb, 0xbc, 0xac, 0x18, 0x43, 0x13, 0x80,
+  0x28, 0x24, 0x90, 0xba, 0x0a, 0xc0, 0xbe, 0x1b, 0x46, 0x92, 0xcf, 0x9a,
+  0x38, 0x44, 0x23, 0x80, 0x88, 0x21, 0x81, 0xec, 0xac, 0x99, 0x01, 0x01,
+  0x08, 0x11, 0x23, 0x02, 0x21, 0x44, 0x13, 0xa8, 0xde, 0xbb, 0xac, 0x09,
+  0x30, 0x34, 0x22, 0x22, 0x33, 0x02, 0xc9, 0xcd, 0xcb, 0xaa, 0x09, 0x21,
+  0x22, 0x62, 0x55, 0x23, 0xf9, 0xac, 0x0a, 0x42, 0x24, 0x91, 0xba, 0x1a,
+  0x22, 0xa1, 0xce, 0x9a, 0x40, 0x33, 0x03, 0xcb, 0xaa, 0x21, 0x21, 0xa0,
+  0x8a, 0x30, 0x13, 0xe8, 0xbc, 0x8a, 0x40, 0x44, 0x11, 0x90, 0xba, 0x0b,
+  0x11, 0x01, 0xb9, 0xac, 0x1a, 0x73, 0x34, 0x82, 0x1b, 0x13, 0x39, 0x00,
+  0x20, 0x82, 0xff, 0xdf, 0x08, 0x32, 0x43, 0x81, 0x9a, 0x40, 0x02, 0xfb,
+  0xab, 0x19, 0x13, 0x90, 0x0a, 0x42, 0x02, 0xa8, 0x28, 0x44, 0x01, 0xaa,
+  0xdb, 0xbc, 0xab, 0x30, 0x53, 0x03, 0x01, 0x43, 0x03, 0xcb, 0x9b, 0x10,
+  0xc8, 0xce, 0x8a, 0x10, 0x23, 0x45, 0x13, 0xfb, 0xad, 0x00, 0x34, 0x33,
+  0x91, 0xaa, 0x1a, 0x00, 0xca, 0xcd, 0xaa, 0x28, 0x53, 0x23, 0x91, 0xaa,
+  0x10, 0x13, 0xb0, 0xae, 0x09, 0x01, 0xda, 0xaa, 0x28, 0x45, 0x23, 0x01,
+  0x98, 0xaa, 0x8a, 0xba, 0xbb, 0x9c, 0x18, 0x44, 0x11, 0x01, 0x51, 0x57,
+  0x24, 0xd9, 0xbe, 0x8a, 0x31, 0x35, 0x82, 0xaa, 0x09, 0x33, 0x92, 0xed,
+  0xab, 0x28, 0x34, 0x01, 0xbb, 0x0a, 0x42, 0x12, 0xa9, 0x0a, 0x42, 0x01,
+  0xea, 0xac, 0x08, 0x12, 0x22, 0x12, 0x90, 0x18, 0x81, 0x80, 0x98, 0x89,
+  0x80, 0xff, 0x9a, 0x20, 0x63, 0x32, 0x25, 0xfc, 0xaf, 0x09, 0x43, 0x24,
+  0x98, 0x8a, 0x34, 0x91, 0xbe, 0x9b, 0x20, 0x81, 0x99, 0x41, 0x32, 0x90,
+  0x19, 0x21, 0x80, 0x99, 0x91, 0xdf, 0xbc, 0x18, 0x22, 0x02, 0x31, 0x44,
+  0x03, 0xa8, 0xab, 0x99, 0xbb, 0xcc, 0xbb, 0x29, 0x35, 0x13, 0x31, 0x67,
+  0x82, 0xee, 0xaa, 0x10, 0x44, 0x12, 0x80, 0x89, 0x18, 0x90, 0xcc, 0xbc,
+  0x09, 0x42, 0x23, 0x80, 0x99, 0x21, 0x12, 0xa8, 0x9b, 0x80, 0xa8, 0xcf,
+  0xac, 0x19, 0x42, 0x34, 0x22, 0x11, 0x08, 0xb9, 0xcb, 0xcc, 0xba, 0xab,
+  0x32, 0x25, 0x32, 0x23, 0x33, 0x44, 0x34, 0xc2, 0xff, 0x9c, 0x09, 0x32,
+  0x34, 0x82, 0xb9, 0x09, 0x22, 0x91, 0xde, 0xaa, 0x20, 0x43, 0x81, 0xbb,
+  0x0a, 0x34, 0x24, 0x90, 0xaa, 0x18, 0x91, 0xfb, 0xab, 0x28, 0x43, 0x12,
+  0x00, 0x98, 0x08, 0x24, 0x02, 0xc9, 0xad, 0xaa, 0xaa, 0x08, 0x54, 0x34,
+  0x3b, 0x0a, 0x3b, 0x00, 0x33, 0x45, 0xf1, 0xcf, 0x8a, 0x31, 0x25, 0x83,
+  0xbb, 0x50, 0x03, 0xea, 0xab, 0x18, 0x12, 0x80, 0x88, 0x22, 0x12, 0x98,
+  0x18, 0x23, 0x03, 0xda, 0xec, 0xac, 0x09, 0x21, 0x22, 0x12, 0x42, 0x23,
+  0x91, 0xcc, 0x8a, 0x00, 0xb8, 0xbf, 0x9b, 0x41, 0x34, 0x12, 0x32, 0x34,
+  0xfa, 0xef, 0x89, 0x31, 0x33, 0x02, 0xba, 0x28, 0x15, 0xd9, 0xbb, 0x8b,
+  0x41, 0x23, 0x90, 0xab, 0x38, 0x34, 0x80, 0x08, 0x42, 0xa2, 0xed, 0xbb,
+  0x99, 0x31, 0x43, 0x33, 0x02, 0x11, 0x98, 0xbc, 0xaa, 0xda, 0xbc, 0x9b,
+  0x31, 0x44, 0x23, 0x04, 0x10, 0x63, 0x24, 0xd8, 0xbf, 0xab, 0x28, 0x34,
+  0x25, 0x81, 0xa9, 0x8a, 0x11, 0x81, 0xda, 0xac, 0x18, 0x22, 0x82, 0xcb,
+  0x8b, 0x63, 0x34, 0x13, 0xa9, 0xbc, 0x89, 0x98, 0xa9, 0x10, 0x31, 0x03,
+  0xa8, 0x9a, 0x71, 0x44, 0x12, 0xc8, 0xcc, 0x99, 0x98, 0x88, 0x31, 0x44,
+  0x53, 0x43, 0xc3, 0xff, 0x9b, 0x20, 0x25, 0x14, 0xb9, 0x0a, 0x43, 0xb8,
+  0xbd, 0x09, 0x22, 0x81, 0x88, 0x00, 0x90, 0x19, 0x54, 0x34, 0x81, 0xca,
+  0xac, 0xab, 0x89, 0x20, 0x23, 0x12, 0x31, 0x33, 0x11, 0x00, 0x32, 0xb3,
+  0xff, 0xbf, 0x99, 0x20, 0x33, 0x33, 0x34, 0x13, 0xff, 0xac, 0x18, 0x43,
+  0x33, 0xb0, 0x9c, 0x33, 0xa1, 0xaf, 0x89, 0x12, 0x80, 0x08, 0x11, 0xb9,
+  0x8c, 0x62, 0x24, 0x01, 0x99, 0xb9, 0xbd, 0xaa, 0x20, 0x32, 0x22, 0x11,
+  0x32, 0x21, 0x00, 0x88, 0xec, 0xcd, 0xbb, 0x8a, 0x22, 0x33, 0x81, 0x31,
+  0x57, 0x43, 0x82, 0xfc, 0xab, 0x18, 0x42, 0x22, 0x81, 0xa9, 0xaa, 0x9a,
+  0x08, 0x32, 0x23, 0x98, 0xbc, 0xa8, 0xeb, 0xaa, 0x18, 0x47, 0x24, 0x81,
+  0xcb, 0xab, 0x28, 0x33, 0x21, 0x88, 0xa8, 0xd9, 0xbc, 0x8a, 0x22, 0x45,
+  0x02, 0x91, 0xab, 0x0a, 0x0f, 0xfe, 0x33, 0x00, 0x8a, 0x89, 0x31, 0x26,
+  0x56, 0x24, 0xfa, 0xdf, 0x89, 0x42, 0x24, 0x82, 0xcb, 0x8a, 0x21, 0x02,
+  0xb9, 0x9a, 0x08, 0x81, 0xa8, 0xbb, 0x10, 0x56, 0x34, 0x13, 0xc9, 0xbd,
+  0x0a, 0x21, 0x11, 0x99, 0xa9, 0x99, 0x28, 0x54, 0x33, 0x13, 0x90, 0xbc,
+  0xcd, 0xac, 0x08, 0x32, 0x24, 0x32, 0x27, 0xe8, 0xbe, 0x8a, 0x62, 0x33,
+  0x92, 0xbd, 0x19, 0x13, 0xa8, 0x29, 0x23, 0xe9, 0x9c, 0x18, 0x91, 0x9a,
+  0x60, 0x34, 0x02, 0xca, 0x8a, 0x00, 0x00, 0x00, 0xa8, 0xcc, 0xaa, 0x31,
+  0x35, 0x13, 0x88, 0x18, 0xa8, 0xdc, 0x8b, 0x21, 0x23, 0x82, 0xff, 0xad,
+  0x28, 0x44, 0x23, 0xc0, 0x9a, 0x21, 0x00, 0x09, 0x11, 0xb8, 0xbf, 0x8a,
+  0x08, 0x80, 0x00, 0x44, 0x53, 0x11, 0xb9, 0xab, 0x20, 0x24, 0xa1, 0xde,
+  0x9a, 0x19, 0x32, 0x33, 0x10, 0x10, 0x88, 0xda, 0xcb, 0x29, 0x03, 0x90,
+  0xbc, 0x60, 0x45, 0xa1, 0xcf, 0x8a, 0x40, 0x44, 0x11, 0xb9, 0xac, 0x18,
+  0x32, 0x11, 0xa8, 0xba, 0xcb, 0x89, 0x88, 0x21, 0x21, 0x43, 0x35, 0x81,
+  0xcc, 0x0b, 0x43, 0x14, 0xb9, 0xbe, 0x8a, 0x21, 0x22, 0x02, 0x08, 0x89,
+  0x8b, 0x11, 0x11, 0x34, 0x82, 0xeb, 0xba, 0x1b, 0x57, 0x43, 0xb2, 0xff,
+  0xab, 0x38, 0x45, 0x23, 0xc8, 0xad, 0x00, 0x23, 0x11, 0x80, 0xb9, 0xbb,
+  0xab, 0x18, 0x21, 0x21, 0x32, 0x03, 0xe9, 0x8b, 0x51, 0x34, 0x13, 0xd9,
+  0xbd, 0x89, 0x21, 0x11, 0x91, 0xa9, 0x8a, 0x21, 0x25, 0x23, 0x99, 0x9a,
+  0xca, 0x30, 0x37, 0x93, 0xff, 0x9f, 0x18, 0x34, 0x04, 0xba, 0x8b, 0x21,
+  0x32, 0x32, 0x81, 0xdc, 0x9c, 0x88, 0x80, 0x08, 0x01, 0x80, 0x99, 0xa9,
+  0xbb, 0x71, 0x47, 0x12, 0xba, 0x9d, 0x20, 0x22, 0x81, 0xbb, 0xac, 0x09,
+  0x21, 0x33, 0x02, 0x9a, 0x9b, 0x28, 0x45, 0x23, 0x8f, 0x14, 0x39, 0x00,
+  0xfa, 0xef, 0x09, 0x32, 0x24, 0xa8, 0xab, 0x00, 0x31, 0x34, 0x15, 0xb8,
+  0xad, 0x89, 0x80, 0x18, 0x00, 0x99, 0xaa, 0xdb, 0x9c, 0x61, 0x34, 0x81,
+  0xba, 0x19, 0x32, 0x23, 0x91, 0xca, 0xcc, 0xaa, 0x31, 0x43, 0x92, 0xaa,
+  0xdb, 0xbb, 0x38, 0x57, 0x12, 0xb9, 0x8c, 0x30, 0x81, 0xcc, 0x29, 0x35,
+  0x80, 0x8a, 0x34, 0x90, 0xcd, 0x28, 0x26, 0x81, 0xcb, 0x8b, 0x18, 0x00,
+  0x81, 0xa0, 0xac, 0xac, 0x28, 0x32, 0x24, 0x02, 0x11, 0xa0, 0x18, 0x64,
+  0x24, 0xa0, 0xcc, 0x99, 0x88, 0xa9, 0x09, 0x10, 0x21, 0xc8, 0xaa, 0x71,
+  0x24, 0xa0, 0xab, 0x31, 0x57, 0x03, 0xf9, 0xbc, 0x28, 0x34, 0x13, 0xb8,
+  0x9c, 0x89, 0x21, 0x53, 0x23, 0xc8, 0xcd, 0x99, 0x10, 0x81, 0x00, 0x98,
+  0xd9, 0x9a, 0x28, 0x23, 0x22, 0x13, 0x03, 0xcb, 0x49, 0x47, 0x02, 0xd9,
+  0xaa, 0x09, 0x01, 0x88, 0x9a, 0x9a, 0xbb, 0x78, 0x63, 0x12, 0x98, 0x0b,
+  0x28, 0x24, 0x22, 0x86, 0xdf, 0x9b, 0x39, 0x36, 0x81, 0xaa, 0x9a, 0x10,
+  0x42, 0x24, 0x02, 0xc9, 0xac, 0x0a, 0x42, 0x23, 0xd0, 0xbe, 0x9a, 0x20,
+  0x11, 0x80, 0x88, 0x09, 0x21, 0x33, 0x27, 0x91, 0xaa, 0x8a, 0x10, 0x11,
+  0x13, 0xda, 0x0a, 0x9b, 0x41, 0x33, 0x26, 0x22, 0x01, 0x21, 0x01, 0x85,
+  0xfd, 0xdf, 0x8a, 0x42, 0x23, 0xa0, 0xab, 0x09, 0x30, 0x44, 0x33, 0x91,
+  0xcb, 0x8c, 0x20, 0x24, 0xb0, 0xde, 0x8a, 0x18, 0x22, 0x91, 0xcb, 0x8a,
+  0x10, 0x12, 0x98, 0x19, 0x10, 0x31, 0x86, 0x28, 0x82, 0x49, 0x98, 0x61,
+  0x81, 0x01, 0x53, 0x22, 0x93, 0xfa, 0x8d, 0x80, 0x08, 0x80, 0x91, 0xdc,
+  0x1a, 0x47, 0x91, 0x9c, 0x21, 0x13, 0xa8, 0x18, 0xd8, 0x9c, 0x09, 0x11,
+  0x8a, 0x31, 0x24, 0x02, 0xf9, 0x9e, 0x21, 0x98, 0x8b, 0x52, 0x91, 0xad,
+  0x30, 0xf3, 0x39, 0x00, 0x20, 0x23, 0xb0, 0x20, 0x93, 0xab, 0x68, 0x14,
+  0x90, 0xb8, 0xa0, 0xb9, 0x2a, 0x55, 0xd8, 0x8c, 0x23, 0x33, 0xe0, 0x8d,
+  0x33, 0xa1, 0xaf, 0x50, 0x83, 0xcb, 0x18, 0x12, 0xb8, 0x28, 0xa2, 0x40,
+  0xd8, 0x49, 0x93, 0x99, 0x0b, 0x18, 0x22, 0xda, 0x08, 0x93, 0xad, 0x73,
+  0x91, 0x9b, 0x31, 0xd0, 0x09, 0x22, 0xa8, 0x1b, 0x10, 0x04, 0x9c, 0x61,
+  0xc0, 0xbb, 0x53, 0x82, 0xbb, 0x30, 0x81, 0x8d, 0x04, 0x78, 0xa4, 0x9e,
+  0x11, 0x01, 0xa0, 0x8c, 0x42, 0xa1, 0x9c, 0x44, 0x81, 0xab, 0x30, 0xb8,
+  0x09, 0x89, 0x37, 0xe8, 0x2a, 0x92, 0x48, 0xa0, 0x28, 0x12, 0xab, 0x09,
+  0x89, 0xa9, 0x82, 0x26, 0xdb, 0x3a, 0x11, 0xda, 0x69, 0xa1, 0x48, 0xa2,
+  0x8b, 0xa1, 0x3d, 0xd2, 0x19, 0xb8, 0x31, 0xdb, 0x8a, 0x55, 0x81, 0x81,
+  0x28, 0xa1, 0x0b, 0xb8, 0x9d, 0x30, 0x80, 0x85, 0xe9, 0x0a, 0x53, 0x90,
+  0x8d, 0x35, 0x81, 0x99, 0xa0, 0x38, 0xb2, 0xbb, 0x2a, 0x57, 0xbb, 0x39,
+  0x03, 0xcb, 0x89, 0x61, 0x00, 0x08, 0x89, 0x10, 0xd9, 0x50, 0xf9, 0x18,
+  0x91, 0x08, 0x01, 0x80, 0x99, 0x43, 0x82, 0xca, 0x12, 0xda, 0x89, 0x9c,
+  0x01, 0x22, 0x30, 0xac, 0x08, 0x37, 0x02, 0xa8, 0x38, 0x03, 0x8c, 0x84,
+  0x40, 0xf8, 0x9e, 0x21, 0xa2, 0xad, 0x88, 0x51, 0x81, 0x8c, 0x43, 0xb0,
+  0x19, 0x02, 0x01, 0xdc, 0x1a, 0x32, 0x80, 0xa0, 0xad, 0x80, 0x72, 0x00,
+  0x89, 0x21, 0xa8, 0x00, 0xf8, 0x30, 0x03, 0xa8, 0xba, 0x7b, 0xc0, 0x19,
+  0x82, 0xb0, 0x80, 0x4b, 0x33, 0x08, 0x78, 0x84, 0xca, 0x08, 0x80, 0x23,
+  0x84, 0xbb, 0x80, 0xff, 0x0a, 0x22, 0x01, 0x28, 0x14, 0x82, 0x3a, 0x8b,
+  0x40, 0xef, 0x08, 0x02, 0xac, 0x80, 0x90, 0x48, 0x32, 0x12, 0x85, 0x9b,
+  0x51, 0xa9, 0x12, 0xa0, 0x09, 0x03, 0x29, 0x00, 0xdf, 0x99, 0x81, 0x14,
+  0xa0, 0x2b, 0x24, 0xa9, 0x53, 0x83, 0x9b, 0x08, 0x8a, 0x8a, 0x0b, 0x08,
+  0xfd, 0x8b, 0x27, 0x99, 0x18, 0x14, 0x80, 0x08, 0x80, 0xd8, 0x10, 0xa9,
+  0x0b, 0xb8, 0xaf, 0x34, 0x91, 0x28, 0x37, 0x89, 0x91, 0x80, 0x80, 0xee,
+  0x28, 0x90, 0x18, 0x99, 0x28, 0x85, 0xab, 0x52, 0x11, 0xa9, 0x50, 0x9a,
+  0x08, 0x08, 0x48, 0xdf, 0x28, 0x12, 0x90, 0x4a, 0x81, 0xc9, 0x9b, 0x65,
+  0x91, 0x0a, 0x33, 0xa8, 0xab, 0xa9, 0xcc, 0x89, 0x54, 0xa0, 0x29, 0x42,
+  0xa9, 0x12, 0x20, 0x32, 0x83, 0xfb, 0x0f, 0x01, 0x99, 0x30, 0xa1, 0xaf,
+  0x30, 0x90, 0x59, 0x02, 0x9b, 0x23, 0x84, 0x89, 0xa2, 0xff, 0x08, 0x11,
+  0x01, 0x22, 0xb0, 0x9f, 0x09, 0x18, 0x22, 0x10, 0x15, 0xb9, 0xa0, 0xbd,
+  0x39, 0x84, 0x61, 0x91, 0x8c, 0x19, 0xa1, 0x30, 0xa2, 0xb0, 0x30, 0x8f,
+  0x12, 0x22, 0xb0, 0x8e, 0x02, 0xbd, 0x50, 0x01, 0x9a, 0x82, 0x9f, 0x01,
+  0x18, 0xc0, 0x2b, 0x35, 0x02, 0x9d, 0x08, 0x8b, 0x42, 0xa2, 0x08, 0xd8,
+  0x48, 0x82, 0xf0, 0x8c, 0x33, 0x92, 0xac, 0x89, 0x72, 0x91, 0xbb, 0x51,
+  0x12, 0xa9, 0x9a, 0x13, 0xa0, 0x82, 0x3a, 0x9f, 0x81, 0x00, 0xbf, 0x31,
+  0x91, 0x28, 0x80, 0x36, 0xba, 0x8c, 0x40, 0xb8, 0x0d, 0x64, 0xa8, 0x98,
+  0x90, 0x3b, 0x25, 0x99, 0x08, 0x21, 0x82, 0x8a, 0xb3, 0x84, 0xbf, 0x52,
+  0xa1, 0x0f, 0x81, 0x90, 0x0a, 0x24, 0x12, 0xa0, 0x20, 0xa8, 0x9e, 0x41,
+  0x91, 0x9c, 0x0a, 0x22, 0xf8, 0x8f, 0x24, 0x80, 0x98, 0x11, 0x10, 0xda,
+  0x38, 0x13, 0xcb, 0x32, 0xba, 0x80, 0xa2, 0xbf, 0x73, 0xa1, 0xbc, 0x62,
+  0x03, 0xcb, 0x18, 0x02, 0x89, 0xba, 0x51, 0x82, 0xdb, 0x21, 0x82, 0x19,
+  0x11, 0x0b, 0x91, 0xb8, 0xcf, 0x20, 0x83, 0x0b, 0x39, 0xfe, 0x2b, 0x00,
+  0x84, 0xa0, 0x22, 0x8a, 0x9f, 0x28, 0x84, 0xa2, 0xfc, 0x68, 0x92, 0x9a,
+  0x08, 0x13, 0x98, 0x12, 0xb8, 0x28, 0xa2, 0x8b, 0x40, 0x17, 0x89, 0x02,
+  0xfb, 0x2e, 0x15, 0xb9, 0x0a, 0x12, 0xc8, 0x0a, 0x82, 0x91, 0x12, 0x20,
+  0x15, 0xec, 0x08, 0x90, 0x8c, 0x34, 0xa8, 0x38, 0x91, 0x9c, 0x61, 0x90,
+  0x11, 0x9a, 0xc0, 0x9a, 0x78, 0x93, 0x8b, 0x80, 0x82, 0x52, 0xa0, 0x0a,
+  0xa8, 0x83, 0xbc, 0x70, 0x84, 0x99, 0x48, 0x80, 0x82, 0x0d, 0x21, 0xb0,
+  0xad, 0x82, 0x00, 0x42, 0x38, 0xb8, 0x8f, 0xa2, 0xab, 0x38, 0x84, 0x84,
+  0xb0, 0x48, 0xf3, 0x08, 0x28, 0xb3, 0x80, 0x84, 0x30, 0x80, 0x05, 0x08,
+  0xd8, 0x30, 0x80, 0xf5, 0x2b, 0xa1, 0xaf, 0x10, 0x11, 0x08, 0xa2, 0xf8,
+  0x3a, 0xa0, 0x42, 0x9a, 0x42, 0xc0, 0x3c, 0x85, 0x9a, 0x31, 0xa2, 0xae,
+  0x18, 0x32, 0xc1, 0xad, 0x62, 0x80, 0xa9, 0x59, 0x82, 0x9e, 0x31, 0xc1,
+  0x0b, 0x22, 0x82, 0x80, 0xb9, 0xca, 0x39, 0x57, 0xa9, 0x08, 0x83, 0x09,
+  0x01, 0x9e, 0x23, 0x9b, 0xa5, 0xbf, 0x62, 0x03, 0xdb, 0x18, 0x11, 0xa9,
+  0x10, 0x92, 0x98, 0x98, 0x81, 0xa0, 0x29, 0x47, 0xa8, 0x1b, 0x32, 0xbf,
+  0x51, 0x91, 0x8a, 0x82, 0xa9, 0x18, 0x13, 0x20, 0xa8, 0xe8, 0x23, 0xfa,
+  0x30, 0x81, 0x09, 0xa1, 0x80, 0xb6, 0x30, 0x9a, 0xa5, 0xcf, 0x22, 0x28,
+  0x98, 0x39, 0x91, 0x78, 0xd9, 0x19, 0x03, 0x90, 0xab, 0x59, 0x06, 0x99,
+  0x28, 0x84, 0xad, 0x52, 0xd8, 0x19, 0x02, 0xa8, 0x0a, 0x32, 0x08, 0xb2,
+  0x9f, 0x24, 0x80, 0xba, 0x52, 0xc2, 0x0d, 0x22, 0x90, 0x98, 0x90, 0x58,
+  0x92, 0xad, 0x43, 0xc8, 0x8a, 0x24, 0xa9, 0x08, 0x30, 0xd9, 0x30, 0xb1,
+  0x9e, 0x62, 0x90, 0x18, 0x81, 0xbb, 0x32, 0x80, 0xc9, 0x21, 0x0e, 0x84,
+  0x63, 0x01, 0x32, 0x00, 0x0b, 0x13, 0x81, 0xf9, 0x68, 0xb2, 0x8b, 0x44,
+  0xd9, 0x1b, 0x33, 0xc8, 0x8b, 0x32, 0x21, 0xe0, 0x0b, 0x45, 0xb8, 0x0a,
+  0x28, 0xa9, 0x43, 0xeb, 0x10, 0x22, 0xa8, 0x8c, 0x43, 0xb9, 0x8e, 0x63,
+  0xb2, 0x8d, 0x24, 0xb8, 0x0c, 0x23, 0xa9, 0x9a, 0x42, 0xa0, 0x18, 0xa8,
+  0x09, 0x44, 0xb1, 0x0e, 0x25, 0xda, 0x08, 0x13, 0xbb, 0x42, 0x80, 0xaa,
+  0x10, 0xab, 0x45, 0x81, 0xac, 0x41, 0x82, 0x9b, 0xa0, 0x1b, 0x16, 0xb8,
+  0x6a, 0x92, 0x8d, 0x13, 0x80, 0xaa, 0x34, 0xab, 0x11, 0x91, 0xac, 0x74,
+  0xd8, 0x19, 0x23, 0xdb, 0x49, 0x92, 0x89, 0x80, 0x88, 0x19, 0xa8, 0x11,
+  0x30, 0xf2, 0x9e, 0x44, 0xb8, 0x50, 0xb0, 0x0b, 0x41, 0x82, 0x8d, 0x02,
+  0x08, 0xba, 0x28, 0x33, 0xfa, 0x89, 0x65, 0xd1, 0x0a, 0x22, 0xa9, 0x8a,
+  0x41, 0x12, 0xd8, 0x9c, 0x51, 0x02, 0xba, 0x0b, 0x25, 0xb8, 0x0a, 0x32,
+  0xb2, 0x0c, 0x06, 0xca, 0x19, 0x33, 0xa8, 0x8c, 0x32, 0xa2, 0xcd, 0x68,
+  0x92, 0x8b, 0x53, 0xb8, 0x9c, 0x62, 0x91, 0xac, 0x21, 0x11, 0xc9, 0x58,
+  0xa2, 0x9c, 0x43, 0xb0, 0x8a, 0x62, 0xc8, 0x19, 0x83, 0x99, 0x00, 0x00,
+  0xa8, 0x41, 0x91, 0x0a, 0x83, 0xdd, 0x7a, 0x83, 0xad, 0x00, 0x23, 0x99,
+  0x32, 0xea, 0x09, 0x30, 0x87, 0xae, 0x30, 0x13, 0xd9, 0x19, 0x01, 0x89,
+  0x11, 0xa8, 0x2a, 0x92, 0x19, 0x82, 0xac, 0x62, 0x12, 0xdb, 0x18, 0x01,
+  0xba, 0x28, 0x2a, 0x77, 0xc1, 0x8c, 0x22, 0x83, 0xbb, 0x11, 0x12, 0xe8,
+  0x1b, 0x14, 0x88, 0x10, 0xe1, 0x8c, 0x32, 0x80, 0x9b, 0x18, 0x03, 0x9f,
+  0x34, 0xf8, 0x0a, 0x44, 0xc0, 0x8b, 0x33, 0xc9, 0x19, 0x24, 0xc0, 0x8c,
+  0x34, 0xb8, 0x0b, 0x15, 0xb9, 0x38, 0x91, 0x0a, 0x18, 0x80, 0x99, 0x11,
+  0x01, 0xbd, 0x19, 0x26, 0x5f, 0x02, 0x38, 0x00, 0x98, 0xaa, 0x72, 0xa0,
+  0x1a, 0x10, 0x41, 0xfa, 0x49, 0xa2, 0x19, 0x01, 0xb8, 0x3a, 0xb4, 0x3a,
+  0xc0, 0xac, 0x60, 0x83, 0xeb, 0x3a, 0x25, 0xa8, 0x0b, 0x22, 0x81, 0xbe,
+  0x51, 0x03, 0xe9, 0x1a, 0x23, 0xc8, 0x8c, 0x43, 0x90, 0x9b, 0x11, 0x90,
+  0x1a, 0x34, 0xa1, 0x9f, 0x41, 0x91, 0x9c, 0x33, 0xb8, 0x1a, 0x02, 0xaa,
+  0x09, 0x92, 0xce, 0x72, 0x93, 0xcb, 0x50, 0x83, 0xfb, 0x28, 0x12, 0x99,
+  0x08, 0x91, 0x9c, 0x43, 0xa0, 0x0c, 0x12, 0x00, 0xb8, 0x3a, 0x95, 0x2a,
+  0x25, 0xcc, 0x08, 0x00, 0x18, 0x82, 0x88, 0x9c, 0x09, 0x62, 0xb0, 0x1c,
+  0x81, 0x81, 0x23, 0xd0, 0x9c, 0x72, 0x82, 0xad, 0x41, 0x82, 0xaa, 0x1a,
+  0x25, 0xb8, 0x29, 0x91, 0x0a, 0xb1, 0x2c, 0x91, 0x08, 0x54, 0xf9, 0x9a,
+  0x31, 0x91, 0x88, 0x01, 0x98, 0xaa, 0x62, 0xf9, 0x8d, 0x73, 0x92, 0xac,
+  0x30, 0x92, 0x8c, 0x44, 0x81, 0xcb, 0x48, 0x02, 0xc9, 0x09, 0x12, 0xba,
+  0x18, 0x02, 0x8a, 0x30, 0xa2, 0xac, 0x71, 0x05, 0xba, 0x41, 0x00, 0xa8,
+  0x8a, 0x09, 0x8a, 0x63, 0x13, 0xca, 0x0a, 0xdb, 0x99, 0x88, 0xc9, 0x19,
+  0xd9, 0xab, 0x1a, 0x35, 0x18, 0x74, 0x83, 0xa9, 0x43, 0x92, 0x0a, 0x21,
+  0xa8, 0x29, 0x73, 0x84, 0xb9, 0xbc, 0xcf, 0x2a, 0x25, 0x90, 0x08, 0x01,
+  0x00, 0x33, 0x22, 0x08, 0x45, 0x14, 0xcb, 0x9a, 0xb9, 0xac, 0x99, 0x99,
+  0xba, 0xdb, 0xab, 0xca, 0x18, 0x10, 0x41, 0x91, 0x28, 0x02, 0xbb, 0x70,
+  0x57, 0x11, 0x90, 0x80, 0xa8, 0x38, 0x25, 0x10, 0x39, 0x77, 0xa1, 0xbe,
+  0x8a, 0x99, 0x18, 0x33, 0x12, 0x53, 0x34, 0x90, 0x8a, 0x42, 0x23, 0x33,
+  0x92, 0xbb, 0xdf, 0xbc, 0xab, 0x9b, 0x10, 0x80, 0xab, 0xbb, 0x1a, 0x25,
+  0x82, 0x48, 0x55, 0x01, 0x80, 0xaa, 0x09, 0x32, 0xc3, 0xf7, 0x2f, 0x00,
+  0x36, 0x80, 0x22, 0x12, 0x82, 0x89, 0x38, 0x05, 0x36, 0xe3, 0xff, 0x9a,
+  0x08, 0x08, 0x31, 0x43, 0x23, 0x22, 0x02, 0x01, 0x20, 0x24, 0x22, 0xba,
+  0xfc, 0xbc, 0xbd, 0xab, 0x8a, 0x08, 0x11, 0x81, 0x80, 0x23, 0x23, 0x21,
+  0x41, 0x36, 0x02, 0xbb, 0x9e, 0x18, 0x02, 0x44, 0x24, 0x22, 0x81, 0x9a,
+  0xcb, 0x8a, 0x31, 0x34, 0xfd, 0xff, 0x09, 0x00, 0x10, 0x21, 0x43, 0x12,
+  0x12, 0x01, 0xa8, 0x08, 0x10, 0x90, 0xbc, 0xce, 0xbc, 0xba, 0x9a, 0x8a,
+  0x89, 0x11, 0x32, 0x32, 0x34, 0x35, 0x44, 0x12, 0x21, 0xa1, 0xcf, 0xa9,
+  0x88, 0x10, 0x32, 0x14, 0x11, 0x10, 0x11, 0xd9, 0xbc, 0x89, 0x72, 0x84,
+  0xff, 0x9a, 0x28, 0x21, 0x00, 0x43, 0x33, 0x23, 0x22, 0x98, 0xab, 0x80,
+  0xc9, 0xbe, 0xab, 0xdb, 0xcb, 0xaa, 0x89, 0x00, 0x08, 0x41, 0x33, 0x31,
+  0x43, 0x34, 0x24, 0x21, 0x31, 0xf8, 0xac, 0x9b, 0x08, 0x10, 0x21, 0x23,
+  0x23, 0x23, 0xa1, 0x80, 0xba, 0xbf, 0x52, 0xf1, 0xff, 0x0d, 0x21, 0x00,
+  0x18, 0x34, 0x13, 0x02, 0x00, 0x88, 0xa9, 0xc9, 0xab, 0xbc, 0xca, 0xbc,
+  0xbb, 0x9a, 0x01, 0x11, 0x08, 0x30, 0x37, 0x43, 0x43, 0x32, 0x31, 0x02,
+  0xd9, 0xcd, 0x9a, 0xa8, 0x08, 0x21, 0x25, 0x02, 0x92, 0x91, 0x09, 0xb9,
+  0x2b, 0x34, 0xff, 0xff, 0x18, 0x01, 0x88, 0x41, 0x24, 0x10, 0x10, 0x01,
+  0x98, 0xb9, 0xbb, 0xcb, 0xbb, 0xb9, 0xbd, 0x8a, 0x10, 0x88, 0xaa, 0x29,
+  0x35, 0x43, 0x45, 0x34, 0x13, 0x81, 0x88, 0xcc, 0xad, 0x8a, 0x89, 0x10,
+  0x43, 0x14, 0x08, 0x81, 0x99, 0x98, 0x19, 0x85, 0xff, 0xaf, 0x30, 0x81,
+  0x8a, 0x73, 0x13, 0x80, 0x21, 0x01, 0x99, 0xba, 0xab, 0xcb, 0xab, 0xa8,
+  0xbe, 0x08, 0x11, 0xa9, 0xaa, 0x29, 0x53, 0x53, 0x45, 0x23, 0x01, 0x88,
+  0x1c, 0x21, 0x3c, 0x00, 0xa0, 0xcd, 0xab, 0x89, 0x99, 0x31, 0x26, 0x11,
+  0x11, 0x99, 0xca, 0x89, 0x10, 0xfd, 0xdf, 0x20, 0x81, 0x99, 0x53, 0x23,
+  0x00, 0x41, 0x02, 0x99, 0xa9, 0xca, 0xab, 0xba, 0xa9, 0xbd, 0x89, 0x08,
+  0x98, 0x00, 0x21, 0x53, 0x44, 0x44, 0x33, 0x02, 0x99, 0xa8, 0xcd, 0xac,
+  0x9a, 0x08, 0x32, 0x34, 0x22, 0x13, 0x91, 0xf9, 0x9a, 0x90, 0xff, 0x8f,
+  0x22, 0xa1, 0x0c, 0x54, 0x01, 0x89, 0x22, 0x91, 0x9a, 0x88, 0xba, 0x9b,
+  0x99, 0xa9, 0xbd, 0x08, 0x80, 0x99, 0x20, 0x12, 0x42, 0x47, 0x43, 0x12,
+  0x81, 0x88, 0xc9, 0xcd, 0x9a, 0x89, 0x88, 0x41, 0x33, 0x22, 0x42, 0x92,
+  0xbc, 0x18, 0xfc, 0xff, 0x28, 0x01, 0x9a, 0x61, 0x13, 0x98, 0x20, 0x03,
+  0xba, 0x89, 0xc9, 0xab, 0x09, 0x90, 0x99, 0x19, 0x98, 0xac, 0x81, 0x99,
+  0x08, 0x74, 0x36, 0x33, 0x12, 0x08, 0x88, 0xfb, 0xad, 0x99, 0x88, 0x89,
+  0x42, 0x23, 0x22, 0x22, 0xa0, 0xab, 0xfa, 0xff, 0x0b, 0x23, 0xc9, 0x49,
+  0x35, 0x81, 0x19, 0x23, 0xb8, 0x8b, 0xa8, 0xbe, 0x08, 0x88, 0x89, 0x18,
+  0x91, 0xbd, 0x1a, 0x81, 0x29, 0x47, 0x33, 0x23, 0x22, 0xa8, 0xdb, 0xcb,
+  0xbd, 0x0a, 0x10, 0x00, 0x43, 0x34, 0x32, 0x81, 0xb8, 0xde, 0xbf, 0x8a,
+  0x23, 0xb9, 0x78, 0x25, 0x81, 0x18, 0x12, 0xaa, 0x8a, 0xc9, 0x9c, 0x18,
+  0x08, 0x88, 0x21, 0xb0, 0xae, 0x09, 0x99, 0x28, 0x65, 0x33, 0x21, 0x13,
+  0xa0, 0xca, 0xcb, 0xcd, 0x8a, 0x18, 0x08, 0x41, 0x43, 0x22, 0x11, 0x88,
+  0xfb, 0xdf, 0x09, 0x12, 0xba, 0x50, 0x26, 0x90, 0x10, 0x03, 0xaa, 0x09,
+  0xda, 0x8c, 0x10, 0x98, 0x09, 0x43, 0xa0, 0xab, 0x89, 0xa9, 0x89, 0x74,
+  0x23, 0x43, 0x13, 0x99, 0x88, 0xeb, 0xad, 0x8a, 0x80, 0x99, 0x41, 0x33,
+  0x33, 0x23, 0x90, 0xfd, 0xdb, 0x02, 0x45, 0x00, 0xbf, 0x29, 0x02, 0xbb,
+  0x73, 0x24, 0x88, 0x21, 0x82, 0xab, 0x88, 0xdd, 0x0a, 0x82, 0xa9, 0x30,
+  0x14, 0xa9, 0x9a, 0xa9, 0xa9, 0x28, 0x36, 0x35, 0x43, 0x02, 0x99, 0x90,
+  0xfb, 0xac, 0x88, 0x98, 0x09, 0x31, 0x43, 0x33, 0x03, 0xa9, 0xfe, 0xbd,
+  0x38, 0x93, 0x9c, 0x64, 0x03, 0x08, 0x21, 0x91, 0xaa, 0x90, 0xbf, 0x2a,
+  0x81, 0xab, 0x51, 0x02, 0xa9, 0x8a, 0xa9, 0x9b, 0x12, 0x54, 0x53, 0x43,
+  0x01, 0x89, 0x80, 0xeb, 0xac, 0x88, 0x98, 0x98, 0x21, 0x33, 0x34, 0x04,
+  0xa8, 0xea, 0xdf, 0x19, 0x03, 0xbb, 0x72, 0x14, 0x80, 0x21, 0x92, 0x9a,
+  0x80, 0xce, 0x19, 0x81, 0xba, 0x40, 0x02, 0xaa, 0x8a, 0xa9, 0x8a, 0x21,
+  0x53, 0x45, 0x33, 0x03, 0x89, 0x11, 0xfa, 0xac, 0x98, 0x99, 0xaa, 0x28,
+  0x23, 0x62, 0x12, 0x00, 0xb9, 0xff, 0x0d, 0x03, 0xba, 0x60, 0x23, 0x80,
+  0x31, 0x82, 0x8a, 0x80, 0xde, 0x19, 0x82, 0xbb, 0x39, 0x03, 0xaa, 0xba,
+  0xdb, 0x99, 0x80, 0x40, 0x36, 0x34, 0x12, 0x01, 0x12, 0xb8, 0xbe, 0x98,
+  0xc9, 0xcb, 0x08, 0x88, 0x32, 0x23, 0x30, 0x03, 0xff, 0x9f, 0x13, 0xc9,
+  0x38, 0x25, 0x80, 0x21, 0x82, 0x09, 0x11, 0xfc, 0x1a, 0x01, 0xb9, 0x1a,
+  0x12, 0xa9, 0x89, 0xcb, 0x9a, 0x99, 0x99, 0x51, 0x35, 0x33, 0x13, 0x62,
+  0x24, 0xb8, 0x09, 0xa0, 0xcc, 0x9b, 0x98, 0x99, 0x01, 0x89, 0x20, 0x36,
+  0xb2, 0xff, 0x2b, 0x04, 0xcb, 0x50, 0x13, 0x98, 0x32, 0x90, 0x18, 0x83,
+  0xcd, 0x1a, 0x04, 0xbb, 0x30, 0x03, 0xbc, 0x80, 0xda, 0x09, 0xa0, 0xac,
+  0x31, 0x13, 0x10, 0x00, 0x30, 0x33, 0xad, 0x34, 0x05, 0x01, 0x90, 0x08,
+  0x18, 0xe0, 0x0a, 0x12, 0xc0, 0x10, 0xe9, 0x9b, 0x62, 0xa0, 0x89, 0x22,
+  0xb0, 0x30, 0x94, 0x1c, 0x12, 0xa2, 0x50, 0x27, 0x21, 0x0a, 0x33, 0x00,
+  0x98, 0x40, 0x82, 0x9a, 0xa0, 0xa0, 0x9d, 0x08, 0xdc, 0x81, 0x80, 0xc9,
+  0x9b, 0x0c, 0xa8, 0xbe, 0x21, 0x27, 0x82, 0x32, 0x92, 0xab, 0x08, 0xaa,
+  0xb2, 0xf0, 0x19, 0x34, 0x9a, 0x28, 0x05, 0x0a, 0xa8, 0x0b, 0x08, 0xbc,
+  0x48, 0x17, 0x12, 0x70, 0x01, 0xa9, 0x19, 0x9a, 0xea, 0x30, 0x15, 0x08,
+  0x18, 0x04, 0x9a, 0xaa, 0xbd, 0x8a, 0x83, 0x78, 0x81, 0x82, 0xa2, 0x80,
+  0x3b, 0xfb, 0xca, 0x9a, 0xa8, 0x0d, 0x4a, 0xa2, 0x08, 0x68, 0xa9, 0xa0,
+  0x2a, 0x8a, 0x80, 0x00, 0x74, 0x27, 0x80, 0x90, 0x08, 0x08, 0x08, 0xab,
+  0x3b, 0x97, 0x80, 0x80, 0x86, 0x89, 0x80, 0x80, 0xb0, 0x0c, 0x48, 0x38,
+  0x34, 0x48, 0x83, 0xb4, 0x80, 0xaf, 0x82, 0x02, 0xb8, 0x40, 0xb8, 0xaf,
+  0x88, 0xe0, 0x9b, 0xa2, 0xd8, 0x89, 0xa0, 0x38, 0x08, 0x0c, 0x78, 0x80,
+  0x0c, 0x48, 0x80, 0x0c, 0x23, 0xa2, 0x3b, 0x43, 0xb8, 0x80, 0x17, 0xba,
+  0x30, 0x48, 0x78, 0x21, 0x0c, 0x41, 0xa1, 0x89, 0x50, 0x91, 0x8a, 0x83,
+  0xb0, 0x48, 0x80, 0x08, 0x9f, 0x32, 0xb8, 0xaf, 0x80, 0x80, 0x80, 0x84,
+  0xeb, 0x2a, 0xb0, 0xfa, 0x8a, 0x80, 0x2a, 0xb0, 0xb0, 0x3c, 0x17, 0xc9,
+  0x51, 0x01, 0xaa, 0x48, 0xa3, 0x19, 0x02, 0x20, 0x24, 0x80, 0x80, 0x35,
+  0x06, 0xa8, 0x2a, 0x8a, 0xb4, 0x8b, 0x04, 0x43, 0x43, 0x83, 0x80, 0xd0,
+  0xb8, 0x08, 0x08, 0x08, 0x08, 0xb7, 0xcc, 0x30, 0xbc, 0x0b, 0x84, 0x80,
+  0x3c, 0x04, 0xbc, 0x1f, 0x82, 0xd0, 0x80, 0xc0, 0x08, 0x08, 0xab, 0x48,
+  0x02, 0xb8, 0x3c, 0x78, 0x00, 0xaa, 0x32, 0xc0, 0x0b, 0x48, 0xcb, 0x70,
+  0x01, 0x88, 0x43, 0x22, 0x80, 0x27, 0xb0, 0x08, 0xa8, 0xeb, 0x80, 0x14,
+  0x80, 0x02, 0x80, 0x43, 0x08, 0x48, 0x03, 0xbc, 0x8f, 0x10, 0xaa, 0x8a,
+  0xf4, 0x01, 0x26, 0x00, 0xc0, 0x9e, 0x08, 0x31, 0xb8, 0x40, 0xb2, 0x8f,
+  0x80, 0x80, 0xba, 0xc0, 0xbb, 0x8f, 0xa2, 0x38, 0x08, 0x03, 0x53, 0x48,
+  0x08, 0xc3, 0x30, 0x48, 0x80, 0xc0, 0x08, 0x84, 0x8b, 0x85, 0x64, 0x10,
+  0x80, 0x80, 0x03, 0x03, 0x08, 0x0e, 0x83, 0x80, 0x80, 0xaf, 0x33, 0x48,
+  0x30, 0x00, 0x88, 0x70, 0x33, 0xc8, 0x8e, 0x0a, 0x9d, 0x08, 0xab, 0xe0,
+  0x08, 0x28, 0xb0, 0x27, 0xa2, 0x89, 0xb0, 0x80, 0xce, 0x21, 0xa8, 0xaa,
+  0x83, 0x03, 0x0c, 0x48, 0x48, 0xc0, 0xad, 0x80, 0xb0, 0x80, 0x47, 0x98,
+  0x21, 0x14, 0xa0, 0x8c, 0x44, 0x18, 0x29, 0x34, 0x08, 0xa8, 0x8a, 0xc0,
+  0x83, 0x8b, 0x80, 0x8d, 0x00, 0xbd, 0x03, 0x34, 0x8b, 0x70, 0x04, 0xcb,
+  0x2a, 0x02, 0xcb, 0xb0, 0x30, 0xbc, 0x48, 0xc0, 0x0b, 0x0c, 0xcb, 0xb8,
+  0x4b, 0xb8, 0x58, 0x38, 0x70, 0xc0, 0x19, 0x04, 0x08, 0x38, 0x25, 0x01,
+  0xba, 0x30, 0xbc, 0x4b, 0xbb, 0xc8, 0x1f, 0x12, 0xa9, 0xb8, 0x73, 0x03,
+  0x21, 0x8a, 0x80, 0xbb, 0x8c, 0x80, 0x80, 0x60, 0x73, 0x80, 0x44, 0x98,
+  0xa9, 0x28, 0xe0, 0x0b, 0x01, 0xa8, 0x80, 0x43, 0xc0, 0x3a, 0xc8, 0x4b,
+  0x38, 0x8b, 0x74, 0xa0, 0xa9, 0x82, 0xe0, 0x0a, 0xa8, 0x0a, 0x08, 0x08,
+  0x08, 0x68, 0x80, 0x80, 0xb5, 0x48, 0xc0, 0xc0, 0x80, 0x80, 0x40, 0x27,
+  0x53, 0x18, 0xa0, 0xa2, 0x0d, 0x8c, 0x09, 0x01, 0xa8, 0x83, 0x84, 0x0b,
+  0x58, 0x38, 0x9f, 0x21, 0x8a, 0x83, 0x84, 0x03, 0x08, 0x08, 0xdf, 0x82,
+  0xa0, 0x82, 0xfa, 0x28, 0xa8, 0x80, 0x33, 0x08, 0xc8, 0x34, 0xc8, 0xbb,
+  0x8b, 0x85, 0x80, 0x27, 0x22, 0x20, 0x80, 0x8f, 0xa0, 0x0a, 0x08, 0x08,
+  0x08, 0x88, 0xf0, 0xbb, 0x8b, 0xcc, 0x80, 0x70, 0x22, 0x08, 0x08, 0xc3,
+  0x80, 0x80, 0x80, 0xe0, 0x04, 0xfd, 0x26, 0x00, 0x73, 0xa0, 0x80, 0xb3,
+  0x0b, 0x48, 0xb3, 0xbc, 0x3c, 0xb8, 0x8f, 0x28, 0xb0, 0x30, 0x27, 0x28,
+  0x82, 0x80, 0x84, 0xbb, 0x7b, 0x02, 0x88, 0x30, 0x48, 0xb8, 0x80, 0x80,
+  0x80, 0xf0, 0xcb, 0x83, 0xf0, 0x88, 0x32, 0x8e, 0x20, 0xa8, 0x20, 0x30,
+  0x08, 0x78, 0x21, 0xea, 0x21, 0x08, 0xa8, 0x83, 0xf0, 0x1a, 0xaa, 0xab,
+  0x48, 0x83, 0x34, 0x78, 0x80, 0x9a, 0x88, 0xf0, 0x21, 0x08, 0x0d, 0x13,
+  0x80, 0x0a, 0x38, 0xf0, 0x8a, 0xd0, 0x28, 0x84, 0x89, 0x32, 0xb8, 0x40,
+  0x02, 0x80, 0x58, 0x80, 0x80, 0x35, 0xcb, 0x48, 0x48, 0x02, 0x8b, 0x80,
+  0x9f, 0x02, 0x8b, 0x70, 0x02, 0xba, 0x83, 0xc0, 0x8a, 0x08, 0xd0, 0xcb,
+  0x48, 0xe8, 0x30, 0x82, 0xb3, 0x30, 0x08, 0x0d, 0xb8, 0x8f, 0x21, 0xb0,
+  0x8a, 0xb4, 0x08, 0x58, 0x48, 0xb8, 0x0b, 0xc8, 0x0c, 0x48, 0x48, 0x32,
+  0x3b, 0x80, 0x05, 0x0c, 0xc3, 0xbb, 0x80, 0xd0, 0x73, 0x80, 0x80, 0x80,
+  0x03, 0x0c, 0x3c, 0xb8, 0x80, 0xcc, 0x4b, 0xb8, 0x70, 0x80, 0xa2, 0x08,
+  0x80, 0x08, 0x40, 0x40, 0x80, 0x8c, 0x0c, 0x08, 0x08, 0xb5, 0x08, 0x78,
+  0x82, 0x08, 0x97, 0x08, 0x82, 0xb0, 0x80, 0xf0, 0x09, 0x0b, 0xc0, 0x83,
+  0x07, 0x08, 0x84, 0x89, 0x0a, 0x88, 0x1e, 0x02, 0x08, 0xb8, 0x84, 0x80,
+  0xb4, 0x48, 0xb3, 0x08, 0x0d, 0x08, 0x34, 0x8b, 0xe0, 0x33, 0xc0, 0x0c,
+  0xb8, 0x8b, 0x80, 0x80, 0x70, 0x03, 0x8c, 0x84, 0x80, 0x80, 0x80, 0x0e,
+  0x03, 0xf4, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x83, 0x8f, 0x22,
+  0xab, 0x08, 0x08, 0x08, 0x80, 0x80, 0x3f, 0x08, 0x80, 0x78, 0x83, 0x04,
+  0x48, 0x38, 0x80, 0xd0, 0x48, 0x80, 0xd0, 0x80, 0x80, 0xbc, 0x40, 0xac,
+  0x8b, 0x00, 0x88, 0x70, 0x02, 0x48, 0x38, 0x80, 0xe5, 0x01, 0x23, 0x00,
+  0x0c, 0xc4, 0xb3, 0x8b, 0xd0, 0x80, 0xc0, 0x08, 0x08, 0x85, 0x84, 0x0b,
+  0x8c, 0x80, 0x80, 0x80, 0x70, 0x0b, 0x48, 0x80, 0x35, 0x83, 0x80, 0x50,
+  0x80, 0x85, 0xc0, 0xc0, 0x8a, 0x03, 0x0c, 0x08, 0x0d, 0x0c, 0x83, 0x84,
+  0x73, 0x00, 0xaa, 0x08, 0x8b, 0xc0, 0x08, 0x34, 0x08, 0x04, 0x08, 0x08,
+  0x8e, 0x80, 0x0c, 0x8c, 0xcb, 0x08, 0x08, 0x58, 0x80, 0x85, 0x80, 0x4c,
+  0x08, 0x3c, 0x08, 0x03, 0x04, 0x84, 0x80, 0xd0, 0xcb, 0x80, 0xc0, 0xcb,
+  0x08, 0x84, 0x43, 0x08, 0x08, 0x04, 0xbc, 0x08, 0xd8, 0x4b, 0x08, 0xc8,
+  0x43, 0x83, 0xb4, 0x48, 0x80, 0x0c, 0xb8, 0x84, 0x8b, 0x80, 0xe0, 0x08,
+  0x08, 0x08, 0xbe, 0xc3, 0x4b, 0x33, 0x48, 0x03, 0x08, 0x08, 0x86, 0x4b,
+  0x3b, 0xfc, 0x80, 0x80, 0x80, 0x80, 0x87, 0x0b, 0x08, 0xa8, 0x38, 0x8b,
+  0x0c, 0x0d, 0x83, 0x84, 0x07, 0x81, 0x02, 0x08, 0xbb, 0xbc, 0xc0, 0x80,
+  0xb4, 0x03, 0x03, 0x80, 0x08, 0x07, 0x0c, 0x33, 0x80, 0x05, 0x43, 0x8b,
+  0x40, 0x8b, 0x8c, 0x80, 0x00, 0x0f, 0x83, 0x08, 0xb4, 0x08, 0xd8, 0xc8,
+  0xc0, 0x4b, 0x02, 0x3b, 0x04, 0x88, 0x80, 0x70, 0x32, 0x03, 0x8c, 0xc0,
+  0x8b, 0x80, 0xe0, 0xc0, 0x3a, 0xc8, 0x80, 0xcb, 0x03, 0x8c, 0x40, 0x48,
+  0x08, 0x78, 0x92, 0x08, 0x38, 0xb8, 0x08, 0x08, 0x06, 0x43, 0x80, 0x08,
+  0x85, 0xc0, 0xc0, 0x0b, 0xc8, 0xc0, 0x83, 0x80, 0x50, 0x48, 0x08, 0x48,
+  0x80, 0x80, 0x8c, 0x8c, 0xd0, 0x4b, 0x08, 0x48, 0x38, 0x00, 0x0d, 0xb8,
+  0x88, 0xcc, 0x33, 0x40, 0x84, 0xc0, 0xb3, 0x30, 0xd0, 0x30, 0x80, 0x80,
+  0x0e, 0x03, 0x08, 0x08, 0x8f, 0x0b, 0xc8, 0x0c, 0xb8, 0x84, 0x70, 0x00,
+  0x88, 0x00, 0x88, 0x80, 0x00, 0x3f, 0x08, 0x08, 0x08, 0x08, 0x08, 0xf8,
+  0x32, 0xff, 0x24, 0x00, 0x48, 0xbc, 0x40, 0x83, 0xb8, 0x08, 0x88, 0x37,
+  0x08, 0x58, 0x08, 0xac, 0x88, 0x8b, 0x3d, 0xe4, 0x28, 0x08, 0x02, 0x08,
+  0x08, 0xd8, 0x0b, 0x03, 0xe0, 0x80, 0x08, 0x40, 0x40, 0x84, 0x80, 0x80,
+  0x80, 0x80, 0x07, 0xc8, 0x4b, 0x8b, 0x40, 0x08, 0x8c, 0xb4, 0x80, 0x0c,
+  0xc8, 0x80, 0x80, 0x80, 0x06, 0x08, 0xf4, 0x98, 0x01, 0x02, 0x08, 0xc8,
+  0x70, 0x80, 0x80, 0x20, 0x0b, 0x08, 0x9f, 0x80, 0x80, 0x80, 0x0c, 0x43,
+  0x03, 0xb4, 0x48, 0xc0, 0x03, 0x8c, 0x07, 0x9a, 0x28, 0x8a, 0xb3, 0x80,
+  0x80, 0x80, 0x80, 0x8f, 0x84, 0xcb, 0x48, 0xf3, 0x08, 0x82, 0x02, 0x08,
+  0x08, 0x88, 0xb5, 0x3b, 0xd0, 0x30, 0x80, 0x80, 0x0e, 0xc3, 0x80, 0x40,
+  0x08, 0x8c, 0x80, 0x50, 0x80, 0x08, 0x80, 0xb7, 0x80, 0x08, 0xe0, 0x0b,
+  0x03, 0x3d, 0x03, 0x58, 0x83, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9f, 0x80,
+  0x80, 0xf8, 0x08, 0x58, 0x8b, 0x40, 0x80, 0x3c, 0x80, 0xd0, 0x08, 0x58,
+  0x8b, 0x80, 0x80, 0x87, 0x80, 0x8b, 0x80, 0x80, 0xbf, 0x24, 0x4b, 0x02,
+  0x8b, 0x08, 0x08, 0x80, 0xf8, 0x43, 0x80, 0x80, 0x05, 0x08, 0x88, 0xe0,
+  0x48, 0xbb, 0x84, 0x80, 0x80, 0x80, 0x80, 0x07, 0x03, 0x3d, 0xc0, 0x80,
+  0x08, 0x3c, 0x80, 0x0d, 0x08, 0x08, 0x08, 0xf8, 0xb8, 0x84, 0x80, 0xf0,
+  0x89, 0x80, 0x00, 0x88, 0x70, 0xb2, 0x0b, 0x08, 0x08, 0x08, 0x8f, 0x07,
+  0x0a, 0x82, 0x38, 0x80, 0x80, 0x08, 0x80, 0x87, 0x80, 0x80, 0x05, 0x0c,
+  0x08, 0x08, 0x8d, 0x80, 0x8f, 0x0b, 0x80, 0x3b, 0x40, 0x84, 0x84, 0x80,
+  0x80, 0x97, 0x3a, 0x0b, 0x08, 0x08, 0x8d, 0x84, 0x80, 0xd0, 0x0b, 0x48,
+  0xc0, 0x03, 0x03, 0x08, 0xbe, 0x80, 0x27, 0xa0, 0x38, 0x80, 0xb8, 0x88,
+  0x00, 0xf8, 0x48, 0x08, 0x05, 0x00, 0x25, 0x00, 0xbc, 0x40, 0x02, 0x0c,
+  0xb8, 0x34, 0x80, 0x80, 0x08, 0x08, 0x80, 0x08, 0x70, 0x02, 0x08, 0xb7,
+  0xc8, 0xc8, 0x03, 0x08, 0x60, 0x83, 0x80, 0x8c, 0x80, 0x86, 0x0b, 0x08,
+  0xd8, 0x03, 0x0d, 0x08, 0xb4, 0x48, 0x08, 0x84, 0xc0, 0x80, 0x3c, 0xc0,
+  0xcb, 0x80, 0xb8, 0x0d, 0x08, 0x88, 0x05, 0x08, 0x04, 0x34, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0xb7, 0x80, 0xaf, 0xb8, 0x80, 0x35, 0x08, 0x03, 0x80,
+  0x80, 0x08, 0x17, 0xc4, 0x30, 0x08, 0x8c, 0x0c, 0x3c, 0xb8, 0x58, 0x08,
+  0x08, 0x08, 0x80, 0x08, 0x08, 0x3f, 0x08, 0x8e, 0x04, 0x83, 0xd0, 0x80,
+  0xc0, 0x48, 0xb8, 0x84, 0xc0, 0x30, 0xc8, 0xc0, 0x30, 0x48, 0x30, 0xc0,
+  0x08, 0x04, 0x88, 0x8c, 0x80, 0x8d, 0x80, 0x50, 0x80, 0x80, 0x80, 0x80,
+  0x8f, 0x84, 0x80, 0x0c, 0x08, 0x8d, 0x80, 0x35, 0x08, 0x03, 0x80, 0x80,
+  0x08, 0x80, 0xf0, 0x6a, 0x08, 0xc8, 0x80, 0xb4, 0x08, 0xd8, 0x08, 0x58,
+  0x80, 0x80, 0x80, 0x80, 0xf0, 0xc8, 0x78, 0x80, 0x80, 0x3a, 0x83, 0x8b,
+  0xcc, 0x30, 0x0c, 0x06, 0x22, 0x3b, 0xbb, 0x03, 0xd8, 0x80, 0x80, 0x50,
+  0x8b, 0x04, 0x08, 0xb5, 0x48, 0xb8, 0x08, 0x68, 0xbb, 0x08, 0x08, 0x80,
+  0xf8, 0x80, 0x40, 0x08, 0x08, 0x08, 0x80, 0x80, 0x78, 0x52, 0x80, 0x80,
+  0x08, 0x08, 0xf0, 0x09, 0xbd, 0xc8, 0xc0, 0x83, 0xc0, 0x73, 0xa9, 0x22,
+  0x0d, 0x08, 0x08, 0x08, 0x33, 0xb4, 0x34, 0x48, 0x38, 0x80, 0x80, 0x0d,
+  0xc8, 0xc8, 0x8b, 0xb4, 0x40, 0xc3, 0x80, 0xb4, 0xb8, 0x08, 0x68, 0x08,
+  0x84, 0x4b, 0xb8, 0x08, 0x08, 0xe8, 0x80, 0x80, 0x80, 0x0f, 0x83, 0x80,
+  0xd0, 0x8b, 0x04, 0x0c, 0x08, 0x08, 0x68, 0xc3, 0x8a, 0x30, 0xd0, 0x80,
+  0x40, 0x83, 0x04, 0x03, 0x8c, 0x0c, 0x8f, 0x80, 0xfc, 0xfd, 0x2a, 0x00,
+  0xb0, 0x30, 0x33, 0x80, 0x35, 0x8b, 0xcc, 0x80, 0x80, 0xd0, 0x08, 0x08,
+  0x50, 0x03, 0x80, 0xf0, 0x8a, 0x03, 0x58, 0x08, 0x8f, 0xa0, 0x82, 0x83,
+  0x0b, 0x3c, 0x30, 0x85, 0x00, 0xc8, 0x03, 0x08, 0xe8, 0x3b, 0xb4, 0xc0,
+  0x73, 0xa0, 0xd0, 0x10, 0xa2, 0x08, 0x0b, 0x08, 0x03, 0x0d, 0xb7, 0x08,
+  0x08, 0x38, 0x0b, 0x88, 0x00, 0x08, 0x88, 0x17, 0x58, 0x80, 0x80, 0x80,
+  0x80, 0x08, 0x9f, 0x85, 0x40, 0x08, 0x08, 0x08, 0x08, 0x06, 0xc8, 0x08,
+  0x08, 0x0e, 0x08, 0x84, 0x8b, 0x80, 0xcd, 0x33, 0x84, 0x0b, 0x08, 0x08,
+  0xb6, 0x03, 0x0d, 0x08, 0x08, 0x08, 0x88, 0x80, 0x00, 0x88, 0x00, 0x3f,
+  0x08, 0x78, 0x6b, 0x83, 0x80, 0x80, 0x08, 0xbf, 0x80, 0xf0, 0x09, 0xa8,
+  0x33, 0x48, 0x80, 0x40, 0x80, 0x80, 0x80, 0x08, 0x07, 0x80, 0x80, 0x80,
+  0x3f, 0xac, 0x48, 0x38, 0xc0, 0xcb, 0x80, 0x80, 0x08, 0x80, 0x87, 0x80,
+  0x80, 0x00, 0x86, 0x80, 0x80, 0x3d, 0x0c, 0x03, 0x80, 0x78, 0xb8, 0x00,
+  0x88, 0xd0, 0xc8, 0x0b, 0xc3, 0x3b, 0x85, 0x0b, 0x08, 0xb5, 0x3c, 0x48,
+  0x08, 0x84, 0x80, 0xd0, 0x3b, 0x00, 0x08, 0xc5, 0x0b, 0x30, 0x0c, 0x08,
+  0x08, 0x36, 0x3c, 0x97, 0x0a, 0xa8, 0x23, 0xbb, 0x40, 0x08, 0x08, 0x85,
+  0x4b, 0x03, 0xc8, 0x48, 0x80, 0x0c, 0x08, 0x08, 0x85, 0x00, 0x8d, 0x8b,
+  0x44, 0x08, 0x0c, 0x8b, 0x0c, 0x0c, 0x48, 0xbb, 0x03, 0x08, 0x08, 0x78,
+  0x80, 0x04, 0x48, 0x80, 0x84, 0x00, 0xbd, 0x80, 0x34, 0xc0, 0x08, 0xc8,
+  0x80, 0x40, 0x80, 0xe0, 0x80, 0x80, 0x80, 0xb6, 0x3b, 0x80, 0x80, 0x70,
+  0x3b, 0x8b, 0x80, 0xbe, 0x24, 0x80, 0x80, 0x80, 0x80, 0x80, 0xf0, 0x6d,
+  0x08, 0x2a, 0x08, 0x23, 0x80, 0x80, 0x8c, 0x8c, 0xbc, 0x84, 0x4b, 0x83,
+  0x04, 0x00, 0x25, 0x00, 0x08, 0x08, 0xcf, 0x08, 0x08, 0x83, 0x80, 0x44,
+  0x08, 0x80, 0x08, 0x80, 0xf8, 0x8b, 0x80, 0xe0, 0x80, 0x80, 0x85, 0x30,
+  0x0c, 0x43, 0x80, 0x04, 0x0c, 0x48, 0x08, 0xc8, 0xcb, 0x03, 0x0c, 0x78,
+  0xa9, 0x40, 0x80, 0x80, 0x30, 0x8b, 0xc8, 0xc0, 0xc3, 0x30, 0x08, 0x04,
+  0x08, 0x8d, 0xc0, 0x48, 0x30, 0x08, 0x9f, 0x80, 0x8a, 0x03, 0x80, 0x17,
+  0x20, 0xc0, 0x8a, 0x0b, 0x88, 0x00, 0x88, 0x47, 0x08, 0x08, 0xc4, 0x80,
+  0x80, 0x80, 0x05, 0x03, 0xb4, 0x08, 0x08, 0xf8, 0x33, 0x8b, 0x3c, 0xbc,
+  0x80, 0x85, 0x80, 0x80, 0x80, 0x3e, 0x8b, 0x80, 0x86, 0x0b, 0x08, 0x08,
+  0xf8, 0x7b, 0x01, 0x08, 0x08, 0x38, 0x80, 0xd0, 0x0b, 0x3c, 0x80, 0xd0,
+  0x80, 0x84, 0x80, 0x40, 0x8b, 0x80, 0x08, 0x78, 0x30, 0x4b, 0x03, 0x8c,
+  0x04, 0x08, 0x0d, 0x08, 0xc8, 0x3c, 0xc0, 0x08, 0xf8, 0x08, 0xa8, 0x08,
+  0x83, 0x04, 0x08, 0x08, 0x78, 0x02, 0xb8, 0x34, 0x80, 0xcc, 0x80, 0x80,
+  0x08, 0x3d, 0xd0, 0x33, 0x84, 0x4b, 0x08, 0x48, 0x0b, 0xc8, 0x08, 0x58,
+  0x80, 0x0c, 0x08, 0x08, 0x08, 0x8f, 0x80, 0x00, 0x88, 0x87, 0x4b, 0x02,
+  0x08, 0x08, 0x85, 0x8b, 0xd0, 0x3b, 0x80, 0x80, 0x0e, 0x0c, 0x0c, 0xb8,
+  0x3c, 0x43, 0xc0, 0x80, 0x80, 0xd0, 0x73, 0x80, 0xa2, 0x08, 0xb8, 0xbb,
+  0x08, 0x04, 0x08, 0x05, 0x58, 0xb8, 0x80, 0x80, 0x3e, 0xb3, 0x84, 0x84,
+  0x80, 0xc0, 0xc8, 0x80, 0x80, 0x50, 0x80, 0x9f, 0x02, 0x83, 0x80, 0x84,
+  0x8b, 0x80, 0xe0, 0xcb, 0x83, 0x40, 0x30, 0x80, 0x80, 0xe8, 0x0c, 0xc3,
+  0xbb, 0x80, 0x80, 0xe0, 0x3b, 0x04, 0x03, 0x58, 0x3b, 0xc0, 0x03, 0x08,
+  0x08, 0x08, 0x47, 0x80, 0x08, 0x80, 0x08, 0xb7, 0xb3, 0x1f, 0xb2, 0x00,
+  0x02, 0x08, 0x0d, 0x48, 0x08, 0x00, 0x27, 0x00, 0xbb, 0x08, 0x58, 0x03,
+  0xc8, 0x84, 0x80, 0x80, 0x05, 0x08, 0x08, 0x3e, 0x8b, 0x40, 0x80, 0x08,
+  0x8d, 0x80, 0xb5, 0xc8, 0x7b, 0x80, 0xa9, 0x08, 0x42, 0x38, 0xb3, 0x08,
+  0xc4, 0xc0, 0xb0, 0x88, 0x80, 0x60, 0x30, 0x80, 0x3d, 0x84, 0x0b, 0x8c,
+  0x80, 0x8c, 0x44, 0xb2, 0x30, 0x8b, 0x85, 0x80, 0x80, 0x00, 0x46, 0xbb,
+  0x08, 0xbd, 0x80, 0x07, 0x80, 0xb0, 0x03, 0x08, 0x58, 0x80, 0x0c, 0x48,
+  0xb8, 0xc8, 0x8b, 0xcc, 0x33, 0x80, 0x80, 0x80, 0x37, 0xb8, 0x08, 0x08,
+  0x0f, 0xc3, 0x83, 0x0b, 0x08, 0x08, 0x88, 0xf0, 0x8c, 0x80, 0x40, 0xc0,
+  0x48, 0x08, 0x84, 0x30, 0x80, 0x05, 0x08, 0x0d, 0x83, 0xd0, 0x80, 0x8b,
+  0xf0, 0x2c, 0x08, 0x02, 0x88, 0x00, 0x0d, 0x83, 0x3c, 0xc0, 0x3b, 0x80,
+  0x80, 0x80, 0x80, 0x70, 0xdb, 0x30, 0x0c, 0x08, 0x84, 0x40, 0x40, 0x48,
+  0xb8, 0x84, 0x80, 0xc0, 0x08, 0x08, 0x68, 0x80, 0x80, 0x0d, 0x08, 0x58,
+  0x08, 0x58, 0x08, 0x80, 0x08, 0xf0, 0x8a, 0x3b, 0xc0, 0x48, 0x80, 0xd0,
+  0x30, 0x08, 0x08, 0x08, 0xf8, 0x03, 0x08, 0xd8, 0x03, 0x08, 0x45, 0x08,
+  0x0c, 0xc3, 0x0b, 0x80, 0x8c, 0x80, 0x35, 0xc0, 0x8b, 0x80, 0x3d, 0x84,
+  0x80, 0xf0, 0x29, 0x83, 0x33, 0x40, 0x08, 0x08, 0x3d, 0xc0, 0x8b, 0xd0,
+  0xbb, 0x80, 0x40, 0xd0, 0x30, 0x3c, 0x80, 0x34, 0x40, 0xb8, 0xb4, 0x0c,
+  0x88, 0x80, 0x00, 0x08, 0x88, 0x00, 0x88, 0xf0, 0x9f, 0x08, 0x08, 0x08,
+  0x08, 0x07, 0x43, 0x8b, 0xdb, 0xbb, 0x84, 0x30, 0xd0, 0x03, 0x08, 0x08,
+  0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0xef, 0x68, 0x80, 0x80, 0x80,
+  0x06, 0xc8, 0x80, 0x80, 0x35, 0x40, 0x83, 0xf0, 0x81, 0x80, 0x80, 0x8b,
+  0x08, 0xf0, 0x30, 0xc8, 0x0b, 0x3c, 0x03, 0x40, 0x05, 0x00, 0x25, 0x00,
+  0x08, 0x08, 0x80, 0x87, 0x80, 0x0c, 0xbc, 0x84, 0x0b, 0xb3, 0x78, 0x01,
+  0x88, 0x00, 0x03, 0x85, 0x00, 0x0d, 0x48, 0x08, 0x0c, 0x48, 0xb8, 0x08,
+  0x08, 0x8d, 0x80, 0x05, 0x08, 0x08, 0x85, 0x00, 0x88, 0x87, 0x80, 0x80,
+  0x80, 0xe0, 0x08, 0x58, 0xfb, 0x80, 0x80, 0xaa, 0x32, 0x30, 0x40, 0x84,
+  0x0b, 0x88, 0xf0, 0x0a, 0x80, 0x0c, 0x03, 0x88, 0x50, 0x80, 0x85, 0x84,
+  0x80, 0xdb, 0x8a, 0x80, 0x80, 0x50, 0x80, 0x80, 0x60, 0x08, 0x84, 0xc0,
+  0x8b, 0x04, 0x0c, 0x3c, 0xb8, 0x80, 0x3c, 0x80, 0xe0, 0x03, 0x08, 0x84,
+  0x40, 0xcb, 0x48, 0xb8, 0x84, 0x80, 0x80, 0xd0, 0x03, 0x08, 0xe8, 0xb3,
+  0xc8, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x78, 0xc0, 0x0b, 0xc8, 0x43, 0x03,
+  0x84, 0xcb, 0x08, 0x8c, 0xb4, 0xc0, 0x33, 0xc0, 0x08, 0x84, 0x80, 0x80,
+  0x86, 0x30, 0xf0, 0x09, 0x08, 0x16, 0x89, 0x80, 0x3a, 0x8b, 0x04, 0x08,
+  0xbd, 0x80, 0x80, 0x50, 0x8b, 0x08, 0x70, 0x82, 0x80, 0x04, 0x0c, 0x0c,
+  0x48, 0x08, 0xac, 0x48, 0x0b, 0x08, 0xc3, 0x84, 0x03, 0xd0, 0x0b, 0x07,
+  0x08, 0x08, 0x02, 0x08, 0x03, 0x80, 0x8e, 0x00, 0x0d, 0xf8, 0x08, 0x2a,
+  0x08, 0x08, 0x34, 0x38, 0x40, 0x80, 0x80, 0x80, 0x00, 0xcf, 0x08, 0x48,
+  0x03, 0xc8, 0xb8, 0x08, 0xe8, 0x48, 0x80, 0x24, 0x00, 0x88, 0xd0, 0x08,
+  0xb4, 0x3c, 0x08, 0x08, 0xe8, 0x4b, 0x02, 0x30, 0x0c, 0xcc, 0x80, 0x80,
+  0x04, 0x3c, 0x80, 0x80, 0xb5, 0xc8, 0xc0, 0x30, 0x0c, 0x08, 0x8c, 0x84,
+  0x30, 0xf4, 0x80, 0x80, 0x80, 0x33, 0x48, 0x08, 0x0c, 0x3c, 0x08, 0x08,
+  0x08, 0xcd, 0x30, 0x03, 0x08, 0x05, 0x8c, 0x80, 0x1f, 0xa2, 0x8b, 0x00,
+  0x53, 0x08, 0x08, 0x44, 0xb8, 0x80, 0xd0, 0x08, 0x08, 0xbd, 0xf8, 0x88,
+  0xca, 0xfb, 0x2a, 0x00, 0x00, 0x02, 0x73, 0x80, 0x80, 0x8a, 0x0b, 0x07,
+  0x08, 0xa8, 0x20, 0x80, 0x80, 0x80, 0xf0, 0x80, 0x64, 0x89, 0x10, 0x30,
+  0x8b, 0xcb, 0x08, 0x08, 0x04, 0x04, 0x08, 0x08, 0x08, 0x07, 0xc8, 0xcb,
+  0x80, 0xc0, 0x8b, 0x80, 0x68, 0x48, 0x08, 0x08, 0xc8, 0x48, 0x4b, 0xb8,
+  0x80, 0x80, 0x05, 0x08, 0x3d, 0x80, 0x80, 0x08, 0xb7, 0x80, 0x58, 0x0b,
+  0x48, 0x30, 0x80, 0x85, 0x04, 0x08, 0xad, 0x83, 0x80, 0x8c, 0xd0, 0xbb,
+  0x8b, 0x80, 0x70, 0xb2, 0x80, 0x58, 0x06, 0x08, 0x88, 0x00, 0xc8, 0xb0,
+  0x08, 0x08, 0x88, 0x00, 0xf8, 0x83, 0x8c, 0x80, 0x8d, 0x40, 0x84, 0x80,
+  0x80, 0x87, 0x0b, 0x48, 0x08, 0x08, 0x8c, 0x80, 0x80, 0xe0, 0x03, 0xc8,
+  0xc8, 0x30, 0xd0, 0x80, 0x80, 0x35, 0x08, 0x03, 0x3d, 0xc0, 0x8b, 0x0c,
+  0x07, 0xaa, 0x02, 0x08, 0x08, 0x84, 0xc0, 0x43, 0x02, 0xac, 0x0c, 0x3b,
+  0x84, 0x80, 0x04, 0x48, 0x80, 0x0c, 0x8c, 0x00, 0x8c, 0xc0, 0x33, 0x00,
+  0x88, 0x00, 0x88, 0x00, 0x88, 0xaf, 0x08, 0x07, 0x8c, 0xc0, 0x08, 0x80,
+  0xe0, 0x30, 0x03, 0x08, 0xb5, 0x03, 0x85, 0x4b, 0x08, 0x84, 0x40, 0x8b,
+  0x0c, 0xc8, 0x03, 0x8c, 0x00, 0xd8, 0x3b, 0x0c, 0x07, 0xaa, 0x8c, 0xa0,
+  0x38, 0x08, 0x34, 0x73, 0x80, 0x20, 0x08, 0x88, 0x00, 0xd8, 0x80, 0xfc,
+  0x80, 0x10, 0x20, 0xb0, 0xb8, 0x08, 0x17, 0xad, 0x89, 0x32, 0x68, 0xa0,
+  0x20, 0x08, 0x08, 0x08, 0xc4, 0x80, 0xcb, 0x43, 0x08, 0x0c, 0x88, 0x00,
+  0xd8, 0x08, 0x44, 0x08, 0x08, 0x58, 0xc0, 0x08, 0x80, 0x08, 0x80, 0x87,
+  0x0b, 0x08, 0x08, 0x08, 0x08, 0xdf, 0x38, 0x84, 0x30, 0xc8, 0xc0, 0x30,
+  0x08, 0x04, 0xc8, 0x48, 0x80, 0x80, 0x05, 0x08, 0x0d, 0xb8, 0x0d, 0x48,
+  0x02, 0x08, 0x8c, 0x40, 0x14, 0x01, 0x26, 0x00, 0x3b, 0x80, 0x80, 0xbe,
+  0x03, 0x3d, 0x80, 0x04, 0x08, 0xbd, 0x0b, 0x88, 0x50, 0x80, 0xd0, 0xb8,
+  0x3c, 0x84, 0x70, 0xc0, 0x21, 0xa1, 0x80, 0x03, 0x88, 0xf0, 0x81, 0x80,
+  0x03, 0x08, 0x88, 0x86, 0x0b, 0x8c, 0x80, 0x80, 0x60, 0x30, 0x80, 0x80,
+  0x60, 0x8b, 0x08, 0x60, 0x8b, 0x0c, 0x03, 0x08, 0xe8, 0x08, 0x40, 0x08,
+  0x3c, 0x80, 0x80, 0xf0, 0x08, 0xec, 0x10, 0xaa, 0x55, 0xda, 0x19, 0x16,
+  0xba, 0x30, 0x83, 0xab, 0x21, 0xa0, 0x89, 0x32, 0x83, 0xc0, 0x8b, 0x34,
+  0xc0, 0x8f, 0x82, 0x02, 0xab, 0x33, 0x84, 0x0f, 0x28, 0x28, 0xea, 0x89,
+  0xa0, 0x02, 0xb8, 0x40, 0x08, 0x43, 0x80, 0xb4, 0xc8, 0x0b, 0x84, 0xcb,
+  0x08, 0x34, 0x08, 0x0d, 0x48, 0xbb, 0x48, 0x17, 0xc9, 0x30, 0x84, 0xa0,
+  0x20, 0x08, 0x8b, 0x30, 0xbc, 0xc8, 0x0c, 0x83, 0xd0, 0x80, 0x34, 0xb8,
+  0xc8, 0x07, 0xaa, 0x80, 0x30, 0x48, 0x38, 0x40, 0xb8, 0x3c, 0x80, 0x8c,
+  0xd0, 0x80, 0xc0, 0xb8, 0x34, 0xc8, 0x80, 0xc0, 0x0c, 0x3c, 0x83, 0x34,
+  0x83, 0x34, 0x80, 0x85, 0x80, 0xc0, 0x08, 0xd8, 0x3b, 0x8b, 0xb5, 0x3c,
+  0xb3, 0x08, 0x08, 0xb6, 0x08, 0x08, 0xbe, 0xb3, 0xc8, 0x24, 0x84, 0x30,
+  0x03, 0x8c, 0x0c, 0x08, 0x9f, 0x80, 0x80, 0x0b, 0x27, 0x82, 0x83, 0x80,
+  0xc0, 0x3c, 0xb8, 0x8b, 0x85, 0x80, 0x80, 0x80, 0xf0, 0x30, 0x08, 0xbd,
+  0x30, 0xbc, 0x34, 0x83, 0xd0, 0x30, 0xb8, 0xbd, 0x80, 0xd0, 0x33, 0x07,
+  0x0a, 0x82, 0x8a, 0x0b, 0x08, 0x17, 0x85, 0xa9, 0x20, 0xb8, 0x4b, 0x57,
+  0xd9, 0x29, 0x13, 0xc9, 0x88, 0x81, 0x99, 0x41, 0x21, 0xa1, 0xac, 0x89,
+  0x35, 0x04, 0xcc, 0x20, 0xb1, 0x8b, 0xd0, 0xad, 0x45, 0xa1, 0xba, 0x2a,
+  0x27, 0xa9, 0x19, 0x11, 0xa9, 0x42, 0xb8, 0x11, 0xbd, 0x01, 0x2d, 0x00,
+  0x9d, 0x31, 0xd1, 0x8b, 0x24, 0xa8, 0x32, 0x86, 0xbc, 0x29, 0x24, 0xc0,
+  0x0e, 0x21, 0x88, 0x00, 0x18, 0xe8, 0x8d, 0x36, 0xb8, 0x2a, 0x04, 0xbb,
+  0x28, 0x81, 0x20, 0x23, 0xda, 0xfb, 0xac, 0x76, 0x91, 0x8d, 0x11, 0x00,
+  0xa8, 0x19, 0x32, 0xc9, 0x8d, 0x52, 0xb0, 0x0b, 0x43, 0xa1, 0x9c, 0x30,
+  0xa2, 0x2a, 0x83, 0xba, 0x40, 0xe0, 0xad, 0x62, 0x02, 0xa9, 0x00, 0xb9,
+  0x48, 0x91, 0x39, 0x93, 0xbe, 0x21, 0x98, 0x31, 0x91, 0x62, 0xb0, 0x8d,
+  0x02, 0x39, 0x07, 0xad, 0x22, 0x80, 0x09, 0x92, 0xaf, 0x34, 0xc8, 0x89,
+  0x88, 0x42, 0x92, 0xbe, 0x20, 0x02, 0x01, 0x99, 0xb9, 0x0c, 0x47, 0xc9,
+  0x28, 0x92, 0x8c, 0x42, 0xc8, 0x8b, 0x64, 0xa1, 0x9c, 0x40, 0x93, 0x8b,
+  0x02, 0x98, 0x11, 0xa8, 0x29, 0xb8, 0x74, 0xd0, 0x0d, 0x34, 0xb9, 0x19,
+  0x82, 0xba, 0x51, 0xa1, 0x8c, 0x11, 0xa9, 0x40, 0x90, 0x20, 0xeb, 0x60,
+  0xb1, 0x9b, 0x43, 0x12, 0xca, 0x19, 0x13, 0xbe, 0x61, 0x01, 0x88, 0xac,
+  0x42, 0xa1, 0x89, 0x90, 0x8c, 0x32, 0x15, 0xc0, 0x9f, 0x51, 0x90, 0x19,
+  0x00, 0x08, 0xaa, 0x50, 0xb0, 0x29, 0x01, 0xa9, 0xcb, 0x68, 0x15, 0xb9,
+  0x08, 0x18, 0xb0, 0x9e, 0x54, 0x92, 0x9c, 0x00, 0x00, 0xb9, 0x59, 0x16,
+  0xaa, 0x19, 0x81, 0x08, 0x89, 0x63, 0xd0, 0x8b, 0x24, 0x98, 0x89, 0x00,
+  0x00, 0xda, 0x51, 0xa2, 0x8b, 0x22, 0x90, 0x9f, 0x42, 0xa1, 0x9a, 0x21,
+  0x98, 0x21, 0x90, 0x88, 0xda, 0x19, 0x45, 0xa1, 0xab, 0x10, 0x13, 0xba,
+  0xbc, 0x58, 0x02, 0x10, 0xfa, 0x8c, 0x34, 0x81, 0x99, 0x11, 0xa0, 0x89,
+  0x98, 0x28, 0xcb, 0x56, 0x92, 0xac, 0x30, 0xa2, 0x8d, 0x33, 0xc2, 0xae,
+  0x30, 0x83, 0xaa, 0x32, 0x82, 0xec, 0x18, 0x01, 0x80, 0x10, 0x01, 0xaa,
+  0xc2, 0xfd, 0x31, 0x00, 0xc8, 0x8c, 0x65, 0x82, 0xaa, 0x28, 0x80, 0xaa,
+  0x88, 0x21, 0x9b, 0x55, 0xc9, 0x28, 0xb2, 0xcc, 0x38, 0x54, 0x82, 0x9b,
+  0x21, 0xb8, 0x89, 0x42, 0x91, 0x9f, 0x28, 0x81, 0xbe, 0x59, 0x13, 0x99,
+  0x89, 0xa2, 0x8a, 0xac, 0x72, 0x11, 0x99, 0x88, 0x00, 0x83, 0x23, 0xc8,
+  0x19, 0xd2, 0x43, 0x92, 0xcf, 0x09, 0x21, 0x33, 0xc1, 0x09, 0x98, 0x9b,
+  0xf2, 0x98, 0x62, 0x02, 0x98, 0x8a, 0xb0, 0x68, 0x31, 0x03, 0xba, 0xa9,
+  0xbc, 0x0a, 0x9d, 0x65, 0x12, 0x89, 0xa9, 0x0a, 0x94, 0xbf, 0x39, 0x15,
+  0x91, 0xba, 0x2a, 0x94, 0xab, 0x30, 0x46, 0x81, 0x0a, 0x21, 0xfb, 0x9e,
+  0x18, 0x33, 0x80, 0x99, 0x82, 0x8a, 0x18, 0x43, 0x17, 0x98, 0xbc, 0x8b,
+  0x98, 0x09, 0x32, 0x45, 0x02, 0x99, 0x61, 0x80, 0xba, 0x3a, 0x91, 0xec,
+  0x18, 0x12, 0xa8, 0x19, 0x67, 0x81, 0x89, 0x08, 0x10, 0xb8, 0xcd, 0x8a,
+  0x01, 0x31, 0x15, 0x20, 0xb0, 0x30, 0xb8, 0xbc, 0x19, 0x80, 0x0a, 0xfb,
+  0xae, 0x31, 0x33, 0x91, 0x2a, 0x34, 0xd0, 0x8a, 0x52, 0x02, 0xbb, 0x0c,
+  0x9a, 0x2a, 0x15, 0xc9, 0x0c, 0x11, 0x00, 0x0b, 0x63, 0x85, 0x88, 0xb9,
+  0x2a, 0x82, 0xfd, 0x2a, 0x22, 0xa0, 0x08, 0x4a, 0x14, 0x08, 0xaa, 0xaa,
+  0x83, 0xfb, 0x9c, 0x80, 0x89, 0x45, 0x13, 0x08, 0xc1, 0x80, 0xa0, 0x22,
+  0x80, 0xb4, 0xf0, 0x0c, 0x81, 0x34, 0xc0, 0x9d, 0x33, 0xa1, 0x0c, 0x38,
+  0x54, 0xda, 0x9a, 0x08, 0x10, 0x51, 0x00, 0x11, 0x90, 0xdc, 0x0a, 0x99,
+  0x19, 0x62, 0x33, 0xa9, 0x89, 0x52, 0xb1, 0x9c, 0x28, 0x94, 0xbc, 0xc9,
+  0x08, 0x34, 0x01, 0x88, 0x00, 0x88, 0x47, 0xcb, 0x1b, 0x03, 0x9a, 0xa8,
+  0x3b, 0x67, 0x81, 0x80, 0x80, 0xbb, 0x0a, 0x08, 0x02, 0x08, 0xb7, 0x08,
+  0x50, 0x26, 0xba, 0xaa, 0xc4, 0xfd, 0x2d, 0x00, 0x14, 0x01, 0xaa, 0xb0,
+  0x8a, 0xfb, 0x28, 0x34, 0x80, 0x02, 0x32, 0xf3, 0xcd, 0x89, 0x62, 0x98,
+  0x9a, 0x38, 0x25, 0x91, 0x9a, 0x30, 0x81, 0xd9, 0x10, 0x01, 0x15, 0xba,
+  0x2a, 0xba, 0x0e, 0xa3, 0xaa, 0x30, 0x67, 0x81, 0xb9, 0x58, 0x14, 0xba,
+  0xcb, 0x21, 0x08, 0xaa, 0x48, 0x44, 0xa1, 0x9c, 0x01, 0x88, 0xe9, 0x20,
+  0x12, 0xa0, 0x9d, 0x32, 0x84, 0xa0, 0x29, 0x42, 0xc2, 0x9f, 0x1a, 0x02,
+  0x98, 0x8d, 0x51, 0x11, 0x9a, 0x19, 0x82, 0xfa, 0x8c, 0x22, 0x13, 0x80,
+  0xcb, 0x39, 0x26, 0x88, 0x2a, 0x9a, 0xda, 0xb9, 0x7a, 0x04, 0x80, 0x09,
+  0x08, 0x11, 0xe9, 0x0c, 0x28, 0x14, 0xda, 0x19, 0x22, 0xa8, 0xeb, 0x21,
+  0x32, 0x91, 0x10, 0x22, 0xb0, 0xc0, 0x60, 0x91, 0xaa, 0xfa, 0x18, 0x08,
+  0x28, 0x38, 0xbb, 0x0b, 0x08, 0x17, 0xd8, 0x08, 0x08, 0x05, 0xc8, 0x9c,
+  0x19, 0x22, 0x62, 0xa9, 0x40, 0xc3, 0xbf, 0x99, 0x22, 0x10, 0x30, 0x27,
+  0x53, 0x02, 0x91, 0xa8, 0xdc, 0xbb, 0xab, 0x0b, 0x38, 0x11, 0x73, 0x32,
+  0x00, 0xc9, 0x8c, 0xa9, 0xcd, 0xaa, 0x31, 0x25, 0x22, 0x42, 0x24, 0x02,
+  0x01, 0xc1, 0xff, 0x99, 0x08, 0x10, 0x89, 0x73, 0x33, 0x02, 0x00, 0x01,
+  0xa8, 0xfb, 0xcb, 0x9a, 0x98, 0x99, 0x10, 0x30, 0x14, 0xa8, 0xcc, 0x0b,
+  0x72, 0x22, 0x22, 0x53, 0x12, 0xc8, 0xcc, 0x89, 0xb8, 0xbc, 0x0a, 0x21,
+  0x42, 0x63, 0x35, 0xa1, 0xaf, 0x89, 0x80, 0xaa, 0x29, 0x47, 0x10, 0x21,
+  0x33, 0x13, 0xa8, 0xcd, 0xab, 0xca, 0xbb, 0x99, 0x21, 0x42, 0x33, 0x32,
+  0xb8, 0x9d, 0x00, 0x99, 0x9b, 0x52, 0x25, 0x81, 0xa9, 0x28, 0xb0, 0xbd,
+  0xab, 0x10, 0x47, 0x93, 0xdf, 0x8a, 0x10, 0x98, 0x9a, 0x73, 0x06, 0x11,
+  0x21, 0x22, 0x00, 0xc9, 0xac, 0xaa, 0xbc, 0xab, 0x13, 0xd4, 0x41, 0x00,
+  0x08, 0x22, 0x42, 0x22, 0x02, 0x98, 0x31, 0x82, 0xa9, 0x20, 0x11, 0xfb,
+  0x9f, 0x09, 0x21, 0x98, 0x38, 0x77, 0xa1, 0xcf, 0x09, 0x01, 0xa8, 0x0a,
+  0x36, 0x11, 0x32, 0x31, 0x24, 0x90, 0xcc, 0xab, 0xba, 0xcd, 0x8a, 0x21,
+  0x12, 0x22, 0x22, 0x11, 0x88, 0x32, 0xa1, 0xad, 0x89, 0xa2, 0xde, 0x8a,
+  0x10, 0x23, 0x52, 0x46, 0xb2, 0xef, 0x88, 0x10, 0xa8, 0x0a, 0x35, 0x01,
+  0x33, 0x11, 0x34, 0xa9, 0xcd, 0x9a, 0xc9, 0xbb, 0x09, 0x43, 0x11, 0x31,
+  0x45, 0x02, 0x98, 0x99, 0xba, 0xbd, 0x8b, 0x00, 0x88, 0x18, 0x74, 0x34,
+  0x23, 0xc8, 0xbf, 0x89, 0x80, 0xba, 0x1a, 0x46, 0x11, 0x23, 0x31, 0x14,
+  0xb8, 0xcc, 0xab, 0xcb, 0xbb, 0x19, 0x24, 0x33, 0x43, 0x43, 0x22, 0xb8,
+  0xca, 0xdb, 0xab, 0x9a, 0x88, 0x18, 0x43, 0x45, 0x53, 0x23, 0xf9, 0xad,
+  0x08, 0x00, 0xba, 0x38, 0x26, 0x22, 0x83, 0x31, 0x13, 0xeb, 0xbc, 0x9a,
+  0xca, 0xab, 0x40, 0x33, 0x23, 0x43, 0x43, 0x81, 0xba, 0xad, 0xba, 0xbc,
+  0x09, 0x10, 0x21, 0x63, 0x54, 0x33, 0xe0, 0xad, 0x09, 0x01, 0xba, 0x1a,
+  0x27, 0x32, 0x81, 0x20, 0x12, 0xd9, 0xbc, 0xaa, 0xca, 0x9a, 0x20, 0x35,
+  0x23, 0x32, 0x23, 0x81, 0xeb, 0xcb, 0xbb, 0xaa, 0x18, 0x11, 0x21, 0x65,
+  0x45, 0x82, 0xec, 0x8a, 0x20, 0xa0, 0x9c, 0x42, 0x33, 0x02, 0x19, 0x23,
+  0xa0, 0xbf, 0x9b, 0xaa, 0xac, 0x89, 0x42, 0x44, 0x22, 0x21, 0x02, 0x90,
+  0xeb, 0xbb, 0xbb, 0x9a, 0x80, 0x11, 0x63, 0x46, 0x33, 0xb0, 0xcf, 0x09,
+  0x11, 0xc8, 0x0b, 0x44, 0x22, 0x88, 0x28, 0x13, 0xe9, 0xab, 0x9a, 0xaa,
+  0x9c, 0x30, 0x34, 0x34, 0x22, 0x21, 0x01, 0xc9, 0xcd, 0xab, 0x9b, 0x88,
+  0x89, 0x33, 0x56, 0x33, 0x43, 0x92, 0xde, 0xaa, 0x20, 0xa1, 0xbc, 0x50,
+  0x17, 0xc3, 0x4e, 0x00, 0x34, 0x01, 0x99, 0x32, 0x92, 0xce, 0x9a, 0x88,
+  0xa9, 0x0a, 0x44, 0x24, 0x00, 0x10, 0x22, 0xb8, 0xaf, 0x9a, 0x98, 0x9a,
+  0x09, 0x33, 0x44, 0x44, 0x43, 0xc0, 0xbd, 0x0a, 0x21, 0xc8, 0x8c, 0x62,
+  0x22, 0x81, 0x1a, 0x31, 0xc0, 0xcc, 0x8a, 0x89, 0xaa, 0x28, 0x44, 0x33,
+  0x11, 0x21, 0x12, 0xc8, 0xbe, 0xba, 0x9a, 0xaa, 0x09, 0x31, 0x55, 0x44,
+  0x33, 0x91, 0xdd, 0x9b, 0x10, 0xa1, 0xac, 0x40, 0x36, 0x01, 0x98, 0x20,
+  0x81, 0xcd, 0xab, 0x89, 0x98, 0x09, 0x54, 0x33, 0x01, 0x18, 0x31, 0xb0,
+  0xcf, 0x9a, 0x88, 0xa9, 0x8b, 0x41, 0x35, 0x34, 0x23, 0xe9, 0xad, 0x09,
+  0x13, 0xd9, 0x0b, 0x73, 0x12, 0x90, 0x08, 0x12, 0xb8, 0xae, 0x9a, 0x98,
+  0x99, 0x30, 0x35, 0x23, 0x11, 0x22, 0x83, 0xfb, 0xac, 0x9a, 0xa9, 0xa9,
+  0x19, 0x53, 0x44, 0x25, 0x83, 0xfb, 0x9b, 0x20, 0x92, 0xdb, 0x28, 0x36,
+  0x02, 0xa8, 0x18, 0x01, 0xda, 0xac, 0x8a, 0x98, 0x88, 0x42, 0x34, 0x23,
+  0x00, 0x21, 0x91, 0xde, 0xab, 0x09, 0x98, 0xab, 0x20, 0x46, 0x24, 0x23,
+  0xc1, 0xdd, 0x89, 0x21, 0xa0, 0x9d, 0x41, 0x34, 0x91, 0x99, 0x21, 0x91,
+  0xbe, 0x9b, 0x89, 0xa9, 0x28, 0x45, 0x23, 0x01, 0x11, 0x13, 0xd8, 0xcc,
+  0xaa, 0x98, 0xba, 0x8b, 0x43, 0x44, 0x43, 0x42, 0x13, 0xea, 0xbc, 0x09,
+  0x01, 0xba, 0x1a, 0x55, 0x24, 0x80, 0x88, 0x08, 0xa9, 0xbe, 0x9a, 0x89,
+  0x00, 0x41, 0x44, 0x12, 0x00, 0x00, 0x80, 0xda, 0xbc, 0x8a, 0x08, 0xa0,
+  0x09, 0x73, 0x44, 0x33, 0xa0, 0xdf, 0x8a, 0x21, 0x91, 0xac, 0x40, 0x35,
+  0x82, 0x9a, 0x21, 0x92, 0xcd, 0x9b, 0x98, 0xa9, 0x19, 0x44, 0x23, 0x11,
+  0x31, 0x22, 0xb0, 0xbf, 0x9a, 0xa9, 0xab, 0xac, 0x38, 0x44, 0x44, 0x23,
+  0x91, 0xce, 0x9b, 0x20, 0xf4, 0xdd, 0x46, 0x00, 0x03, 0xa9, 0x49, 0x46,
+  0x13, 0x98, 0x9a, 0x89, 0xca, 0xcc, 0xaa, 0x18, 0x31, 0x32, 0x43, 0x34,
+  0x12, 0x88, 0xa9, 0xdb, 0xbd, 0x9b, 0x18, 0x90, 0x89, 0x72, 0x35, 0x32,
+  0x92, 0xcf, 0xab, 0x28, 0x02, 0xb9, 0x49, 0x46, 0x23, 0x88, 0x99, 0x98,
+  0xca, 0xcc, 0xaa, 0x88, 0x20, 0x43, 0x33, 0x43, 0x13, 0x00, 0x98, 0xba,
+  0xcf, 0xab, 0x9a, 0xa8, 0x8b, 0x51, 0x35, 0x24, 0x33, 0x24, 0xd8, 0xbe,
+  0x8b, 0x20, 0x90, 0x9a, 0x71, 0x34, 0x02, 0x89, 0x89, 0xa8, 0xdc, 0xab,
+  0x89, 0x08, 0x20, 0x45, 0x33, 0x01, 0x00, 0x20, 0xb1, 0xde, 0x9b, 0x08,
+  0x88, 0xa9, 0x29, 0x45, 0x33, 0x33, 0xc1, 0xef, 0x8a, 0x20, 0x02, 0xaa,
+  0x60, 0x44, 0x01, 0x99, 0x09, 0x90, 0xcc, 0xab, 0x09, 0x88, 0x28, 0x54,
+  0x24, 0x80, 0x08, 0x21, 0xa0, 0xcd, 0x9b, 0x00, 0xa0, 0xbb, 0x20, 0x45,
+  0x13, 0x10, 0x54, 0x82, 0xde, 0x9b, 0x20, 0x12, 0xc9, 0x39, 0x46, 0x02,
+  0x98, 0x09, 0x80, 0xeb, 0xaa, 0x88, 0x98, 0x09, 0x63, 0x24, 0x81, 0x08,
+  0x11, 0x90, 0xdb, 0xbb, 0x8a, 0x09, 0x09, 0x18, 0x44, 0x44, 0x23, 0x24,
+  0xe8, 0xce, 0x89, 0x21, 0x91, 0x9c, 0x71, 0x23, 0x91, 0x9a, 0x31, 0xb1,
+  0xbf, 0x8b, 0x11, 0xa9, 0x09, 0x55, 0x22, 0x98, 0x09, 0x23, 0xa0, 0xbf,
+  0x89, 0x20, 0xa8, 0xab, 0x41, 0x24, 0x81, 0x19, 0x43, 0xb2, 0xef, 0x9a,
+  0x21, 0x12, 0x98, 0x30, 0x37, 0x03, 0xa9, 0xaa, 0x90, 0xec, 0xab, 0x18,
+  0x01, 0x08, 0x63, 0x24, 0x81, 0x9a, 0x10, 0xa0, 0xdc, 0x9a, 0x18, 0x10,
+  0x10, 0x20, 0x32, 0x21, 0x32, 0x35, 0xc2, 0xff, 0x9d, 0x28, 0x12, 0x90,
+  0x19, 0x36, 0x14, 0x98, 0x9b, 0x80, 0xd9, 0xac, 0x09, 0x10, 0x81, 0x31,
+  0x45, 0x12, 0xa9, 0x8a, 0x11, 0xa0, 0xdc, 0x9a, 0x03, 0xe8, 0x41, 0x00,
+  0x31, 0x82, 0xbc, 0x2a, 0x34, 0x91, 0x2a, 0x67, 0x82, 0xdd, 0x8b, 0x21,
+  0x03, 0xb9, 0x49, 0x36, 0x02, 0xaa, 0x89, 0x90, 0xeb, 0xab, 0x00, 0x02,
+  0x00, 0x41, 0x34, 0x12, 0xba, 0xab, 0x31, 0x02, 0xfb, 0x9c, 0x28, 0x02,
+  0xda, 0x09, 0x41, 0x32, 0x44, 0x03, 0xef, 0xab, 0x20, 0x33, 0xb8, 0x1c,
+  0x47, 0x03, 0xb8, 0x8b, 0x21, 0xd8, 0xbd, 0x08, 0x23, 0xa1, 0x89, 0x54,
+  0x13, 0xda, 0x9b, 0x32, 0x03, 0xdb, 0x1a, 0x33, 0x91, 0xcc, 0x19, 0x22,
+  0xa8, 0x1b, 0x46, 0xa1, 0xcf, 0x09, 0x32, 0x03, 0xcb, 0x40, 0x25, 0x81,
+  0xba, 0x09, 0x01, 0xfb, 0x9b, 0x20, 0x23, 0x88, 0x19, 0x34, 0x03, 0xeb,
+  0x9b, 0x21, 0x12, 0xb9, 0xab, 0x41, 0x13, 0xc9, 0x9a, 0x72, 0x32, 0x24,
+  0xe9, 0xbe, 0x8b, 0x31, 0x03, 0xcb, 0x60, 0x26, 0x82, 0xba, 0x29, 0x13,
+  0xec, 0xab, 0x20, 0x24, 0xb8, 0x8b, 0x45, 0x02, 0xea, 0x8a, 0x32, 0x83,
+  0xda, 0x19, 0x32, 0x91, 0xbc, 0x29, 0x23, 0xa0, 0x8c, 0x33, 0xe0, 0xbd,
+  0x19, 0x42, 0x12, 0x99, 0x52, 0x25, 0x91, 0xca, 0x8a, 0x88, 0xc9, 0xab,
+  0x30, 0x35, 0x02, 0x8a, 0x10, 0x12, 0xf9, 0xac, 0x30, 0x33, 0x91, 0xaa,
+  0x0a, 0x14, 0x91, 0xcc, 0x0a, 0x42, 0x35, 0x91, 0xef, 0x9a, 0x10, 0x23,
+  0x91, 0x09, 0x55, 0x23, 0xb0, 0xcc, 0x08, 0x81, 0xda, 0xab, 0x52, 0x33,
+  0xa0, 0xac, 0x30, 0x24, 0xda, 0x8c, 0x31, 0x33, 0xb8, 0x9c, 0x10, 0x12,
+  0xda, 0xab, 0x21, 0x23, 0x42, 0x22, 0xfa, 0xae, 0x0a, 0x32, 0x23, 0x98,
+  0x51, 0x25, 0x82, 0xdb, 0x9b, 0x89, 0x98, 0xa9, 0x28, 0x55, 0x13, 0xa8,
+  0xad, 0x19, 0x02, 0xb9, 0x19, 0x37, 0x14, 0xb8, 0xac, 0x18, 0x02, 0xb9,
+  0x9d, 0x41, 0x35, 0xb1, 0xdf, 0x89, 0x21, 0x13, 0xb9, 0x49, 0x36, 0x82,
+  0x5f, 0x74, 0x4d, 0x00, 0xdb, 0x8a, 0x31, 0x90, 0xae, 0x19, 0x34, 0x03,
+  0xdb, 0x8a, 0x21, 0x81, 0xac, 0x38, 0x34, 0x12, 0xb8, 0xac, 0x09, 0x10,
+  0xa8, 0xbc, 0x39, 0x57, 0x12, 0xfa, 0xaa, 0x19, 0x33, 0x82, 0xaa, 0x72,
+  0x24, 0x90, 0xbc, 0x0b, 0x21, 0xa1, 0xcb, 0x28, 0x36, 0x82, 0xda, 0x9b,
+  0x20, 0x02, 0x99, 0x29, 0x54, 0x22, 0xb9, 0xbe, 0x08, 0x32, 0x91, 0xba,
+  0x58, 0x45, 0xa1, 0xcf, 0x89, 0x30, 0x23, 0xc9, 0x2a, 0x36, 0x02, 0xdb,
+  0x8b, 0x21, 0x02, 0xca, 0x09, 0x53, 0x02, 0xda, 0x9a, 0x18, 0x00, 0x18,
+  0x22, 0x11, 0x30, 0x24, 0xdc, 0xac, 0x38, 0x23, 0xc0, 0xac, 0x52, 0x14,
+  0xd9, 0xbc, 0x08, 0x43, 0x22, 0xb9, 0x39, 0x36, 0x91, 0xcc, 0x8b, 0x31,
+  0x12, 0xa8, 0x8b, 0x42, 0x03, 0xec, 0xaa, 0x18, 0x32, 0x22, 0x81, 0x09,
+  0x20, 0x02, 0xfb, 0x9d, 0x30, 0x24, 0x98, 0x8c, 0x50, 0x83, 0xed, 0xab,
+  0x38, 0x35, 0xa2, 0xab, 0x62, 0x13, 0xc9, 0xac, 0x10, 0x23, 0x91, 0xba,
+  0x30, 0x14, 0xd9, 0xac, 0x00, 0x80, 0x18, 0x44, 0x01, 0xa9, 0x08, 0x13,
+  0xc9, 0x9d, 0x50, 0x02, 0xb9, 0x0a, 0x44, 0xb1, 0xef, 0x0a, 0x31, 0x14,
+  0xb8, 0x19, 0x35, 0x92, 0xcc, 0x0a, 0x32, 0x11, 0xb9, 0x0a, 0x43, 0xa1,
+  0xbe, 0x09, 0x01, 0xa9, 0x28, 0x35, 0x82, 0x9b, 0x30, 0x84, 0xdb, 0x2b,
+  0x54, 0xa1, 0xac, 0x38, 0x34, 0xc0, 0xcf, 0x09, 0x42, 0x12, 0xca, 0x28,
+  0x43, 0xa0, 0xac, 0x19, 0x32, 0x82, 0xb9, 0x29, 0x32, 0xa0, 0xbf, 0x09,
+  0x91, 0x99, 0x41, 0x23, 0xa8, 0x89, 0x10, 0xb0, 0xbd, 0x70, 0x14, 0xc8,
+  0x8c, 0x41, 0x12, 0xb8, 0xbe, 0x19, 0x45, 0x80, 0xbb, 0x38, 0x15, 0xa8,
+  0xab, 0x10, 0x22, 0x12, 0xba, 0x29, 0x36, 0x81, 0xcb, 0x09, 0x80, 0xa8,
+  0x19, 0x34, 0x22, 0xdb, 0xcd, 0x07, 0x34, 0x00, 0xad, 0x91, 0xab, 0x30,
+  0x63, 0xc1, 0x9c, 0x10, 0x53, 0x91, 0xeb, 0x9c, 0x20, 0x13, 0xba, 0x48,
+  0x35, 0xb0, 0x9b, 0x18, 0x52, 0x22, 0xb8, 0x38, 0x36, 0xa2, 0x9b, 0x08,
+  0x10, 0xdd, 0x19, 0x42, 0x04, 0xd9, 0x9b, 0x23, 0xd9, 0x8b, 0x43, 0x80,
+  0xdb, 0x8a, 0x43, 0x02, 0xd9, 0xbc, 0x8a, 0x31, 0x91, 0x0a, 0x75, 0x82,
+  0xa9, 0x99, 0x01, 0x53, 0x82, 0x89, 0x42, 0x14, 0xaa, 0x00, 0xa0, 0xcb,
+  0x29, 0x01, 0x71, 0x23, 0xca, 0x8c, 0x80, 0xbd, 0x58, 0x03, 0xba, 0x1a,
+  0xa8, 0x9b, 0x83, 0xe9, 0xcc, 0xbc, 0x29, 0x35, 0x80, 0x21, 0x03, 0x9a,
+  0x21, 0xbb, 0x79, 0x47, 0x88, 0x08, 0x13, 0x80, 0x18, 0xba, 0x8b, 0x26,
+  0xca, 0x58, 0x25, 0xca, 0x8b, 0x88, 0x99, 0x21, 0xb0, 0x8d, 0x33, 0xdd,
+  0x0a, 0x22, 0x98, 0xb9, 0xbf, 0x29, 0x25, 0x98, 0x29, 0x13, 0x98, 0x11,
+  0xd9, 0x70, 0x24, 0x98, 0x19, 0x22, 0x80, 0x81, 0xe9, 0x19, 0x33, 0xb8,
+  0x4a, 0x14, 0xcb, 0x0a, 0xb9, 0xaf, 0x10, 0x83, 0xb9, 0x90, 0xbe, 0x0a,
+  0x25, 0xa9, 0x1b, 0xb8, 0xdf, 0x28, 0x23, 0x88, 0x43, 0xa8, 0x1a, 0x24,
+  0xcb, 0x71, 0x04, 0x98, 0x21, 0x02, 0x29, 0x11, 0xbc, 0x50, 0x82, 0x9b,
+  0x51, 0x91, 0xcc, 0x9a, 0x9b, 0x28, 0x03, 0xe9, 0x80, 0xb0, 0x9d, 0x08,
+  0x98, 0x39, 0x94, 0xff, 0x19, 0x12, 0x81, 0x19, 0x90, 0x39, 0x23, 0xcc,
+  0x61, 0x25, 0x98, 0x18, 0x12, 0x88, 0x21, 0xa0, 0x29, 0x07, 0xb9, 0x30,
+  0x93, 0xcf, 0x8a, 0x80, 0x90, 0x00, 0x98, 0x38, 0xb1, 0xff, 0x09, 0x11,
+  0x99, 0x18, 0xc9, 0x9d, 0x18, 0x12, 0x00, 0x01, 0x11, 0x55, 0x81, 0xa8,
+  0x74, 0x02, 0x98, 0x11, 0x30, 0x32, 0x82, 0x9d, 0x40, 0x81, 0xbd, 0x19,
+  0x82, 0xaa, 0x9a, 0xae, 0x28, 0x24, 0xc9, 0xbb, 0xd5, 0x01, 0x2f, 0x00,
+  0xda, 0xac, 0x80, 0xa0, 0x29, 0x24, 0xfa, 0xad, 0x19, 0x21, 0x11, 0x00,
+  0x19, 0x53, 0x12, 0x99, 0x71, 0x16, 0x01, 0x21, 0x81, 0x00, 0x01, 0xb8,
+  0x09, 0x8a, 0x80, 0x56, 0xa1, 0xbe, 0x19, 0x91, 0xbc, 0x9a, 0x09, 0x83,
+  0xf0, 0xaf, 0x01, 0x91, 0x8a, 0x08, 0x99, 0xaa, 0xcd, 0x38, 0x24, 0xa0,
+  0x18, 0x12, 0x51, 0x81, 0x70, 0x36, 0x02, 0x88, 0x00, 0x11, 0x08, 0x9b,
+  0x4a, 0x56, 0x98, 0x9a, 0x10, 0xa0, 0xbc, 0xad, 0x88, 0x22, 0x91, 0xbd,
+  0x99, 0xba, 0xb8, 0xdc, 0x0c, 0x30, 0x00, 0xb9, 0xce, 0x1a, 0x53, 0xa1,
+  0x9b, 0x42, 0x44, 0x12, 0x99, 0x71, 0x15, 0x88, 0x98, 0x10, 0x32, 0x03,
+  0xbb, 0x58, 0x22, 0xc8, 0xab, 0x9c, 0x10, 0xb1, 0xad, 0x20, 0xc1, 0xba,
+  0xcb, 0xbd, 0xaa, 0x08, 0x9a, 0xaa, 0x9d, 0x2a, 0x17, 0xdc, 0x09, 0x22,
+  0x33, 0x11, 0xa9, 0x69, 0x34, 0x91, 0x08, 0x37, 0x22, 0x01, 0xaa, 0x38,
+  0x26, 0x90, 0x11, 0x11, 0x09, 0xc8, 0x9c, 0xac, 0x89, 0x9a, 0x28, 0xe0,
+  0xcd, 0x88, 0x98, 0xad, 0xaa, 0xb9, 0xb8, 0xdb, 0x8a, 0x43, 0x33, 0xf0,
+  0x8a, 0x42, 0x32, 0xa0, 0x99, 0x74, 0x13, 0x90, 0x48, 0x25, 0x82, 0x09,
+  0x19, 0x41, 0x85, 0x08, 0x11, 0xb1, 0xac, 0x81, 0xa9, 0xb0, 0x0a, 0xde,
+  0x99, 0xcb, 0xbc, 0x99, 0x99, 0xad, 0x99, 0x28, 0xca, 0xbd, 0x18, 0x53,
+  0x92, 0xba, 0x8b, 0x74, 0x22, 0x98, 0x10, 0x36, 0x32, 0x81, 0x10, 0x51,
+  0x02, 0x18, 0x12, 0x5a, 0x33, 0x12, 0x3a, 0x27, 0xca, 0xba, 0x89, 0x80,
+  0xaa, 0xbe, 0xab, 0xd0, 0x9b, 0x80, 0xaa, 0xef, 0x99, 0x0a, 0x89, 0xcd,
+  0x99, 0x30, 0x01, 0x19, 0x80, 0x36, 0x33, 0x11, 0x08, 0x42, 0x42, 0x21,
+  0x34, 0x14, 0x63, 0x92, 0x10, 0x98, 0x2a, 0x38, 0x45, 0x08, 0x41, 0xa2,
+  0xef, 0x13, 0x2b, 0x00, 0x0c, 0x8c, 0xa9, 0x89, 0xba, 0x9e, 0xbc, 0xab,
+  0x89, 0xbd, 0xaa, 0xaa, 0xcf, 0x8a, 0xa9, 0xbb, 0x28, 0x08, 0x0b, 0x83,
+  0x40, 0x47, 0x32, 0x12, 0x72, 0x22, 0x11, 0x21, 0x08, 0x72, 0x32, 0x81,
+  0x30, 0x04, 0x0a, 0x0b, 0x6a, 0x23, 0x8a, 0xb0, 0xbb, 0xc0, 0x9f, 0x0a,
+  0x2a, 0x8a, 0x80, 0x9f, 0xaa, 0x22, 0xb0, 0xcb, 0x9e, 0xbe, 0x9a, 0x08,
+  0xa9, 0x9c, 0xca, 0x0a, 0x82, 0x80, 0x47, 0x13, 0x31, 0x84, 0x80, 0x22,
+  0x27, 0x08, 0x38, 0x41, 0x03, 0x01, 0x28, 0x30, 0x0c, 0x08, 0xbc, 0x30,
+  0x25, 0xf0, 0x19, 0xa0, 0x2a, 0xa8, 0xac, 0x38, 0x00, 0x08, 0xf8, 0x1d,
+  0x89, 0xba, 0x80, 0x8b, 0xcc, 0xca, 0xcd, 0x9b, 0xaa, 0xca, 0xc8, 0x21,
+  0x80, 0x60, 0x43, 0x08, 0x08, 0x78, 0x23, 0x91, 0x01, 0x14, 0x26, 0x08,
+  0x08, 0x01, 0xa8, 0x8a, 0x30, 0x48, 0x03, 0x40, 0xb8, 0x88, 0x60, 0x03,
+  0x08, 0xd8, 0xc8, 0x80, 0x80, 0xbd, 0x80, 0x8c, 0xf0, 0x9f, 0x80, 0x10,
+  0x98, 0xaa, 0x0a, 0xf0, 0x99, 0x9a, 0x2a, 0x02, 0x80, 0xb8, 0xbd, 0xc0,
+  0x3b, 0x00, 0x74, 0x80, 0x52, 0x81, 0x14, 0x32, 0x04, 0x84, 0x21, 0xd0,
+  0x80, 0x82, 0x02, 0x68, 0x80, 0xaa, 0x20, 0x03, 0x48, 0x80, 0xd0, 0x30,
+  0xaf, 0xa9, 0xa2, 0xbb, 0x8b, 0x40, 0x8b, 0x85, 0x0f, 0x98, 0xa8, 0xe0,
+  0x89, 0x80, 0x02, 0x0b, 0x08, 0x08, 0x08, 0xdf, 0x08, 0x38, 0xb8, 0x80,
+  0x80, 0x50, 0x84, 0x80, 0x70, 0x35, 0x08, 0x21, 0x38, 0x08, 0x08, 0x8c,
+  0x8f, 0x80, 0x32, 0x02, 0xb8, 0x08, 0x08, 0x08, 0xbf, 0x88, 0x50, 0xb8,
+  0x58, 0x48, 0x32, 0x03, 0x84, 0xc0, 0xcb, 0x80, 0x0c, 0x08, 0x08, 0x0d,
+  0x03, 0x08, 0x3e, 0x03, 0x08, 0xcf, 0x82, 0x80, 0xe0, 0x9a, 0xaa, 0x2a,
+  0x03, 0x08, 0x58, 0xf3, 0x18, 0xfc, 0x2d, 0x00, 0x0a, 0x98, 0xb8, 0x03,
+  0x43, 0x24, 0x06, 0x08, 0x08, 0x08, 0x08, 0x8f, 0x08, 0x68, 0x08, 0x01,
+  0xaa, 0x38, 0x08, 0x70, 0x00, 0x02, 0x02, 0x80, 0x44, 0x48, 0x38, 0x80,
+  0xb4, 0x43, 0x80, 0xb4, 0x0c, 0xcb, 0xfb, 0x9b, 0x9e, 0x98, 0x11, 0x01,
+  0x0a, 0x88, 0x00, 0xc3, 0xfb, 0x9a, 0x28, 0x20, 0xb0, 0x3c, 0x03, 0x88,
+  0x4c, 0x83, 0x04, 0x03, 0x8c, 0x80, 0x05, 0x8c, 0x80, 0x00, 0x74, 0x02,
+  0x22, 0x30, 0xc8, 0xb0, 0x08, 0x0d, 0xc3, 0xb3, 0x08, 0x17, 0x88, 0x03,
+  0x08, 0x88, 0xd0, 0x0c, 0xb8, 0x53, 0xb8, 0x80, 0x8c, 0x44, 0x08, 0x08,
+  0x08, 0x04, 0x08, 0xf8, 0x0d, 0x88, 0x00, 0x38, 0x80, 0x80, 0x80, 0xf0,
+  0xb8, 0x8c, 0x80, 0x17, 0xba, 0x30, 0x83, 0x80, 0xb5, 0xbc, 0x00, 0xcc,
+  0x80, 0x80, 0x80, 0x35, 0x80, 0x70, 0xa1, 0x0b, 0x08, 0x08, 0x85, 0x84,
+  0x80, 0x04, 0xc8, 0x80, 0x40, 0x40, 0x08, 0xc8, 0x08, 0x44, 0x8b, 0x8b,
+  0x80, 0x86, 0x0b, 0x08, 0x35, 0x84, 0x8b, 0xc0, 0x08, 0xd8, 0xc0, 0x30,
+  0x08, 0x3d, 0x8b, 0x80, 0x05, 0x08, 0xd8, 0x30, 0xd0, 0x80, 0x8b, 0x80,
+  0xf0, 0x30, 0x88, 0x00, 0x58, 0x80, 0xcc, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x47, 0x70, 0x08, 0x08, 0x2a, 0x80, 0xcb, 0x0b, 0x08, 0x04, 0x08, 0x08,
+  0x3e, 0x80, 0xcc, 0xc0, 0x80, 0xb3, 0x58, 0x08, 0x07, 0x08, 0x2a, 0x08,
+  0xcb, 0x33, 0xcb, 0x17, 0xa9, 0x0a, 0x8a, 0x08, 0x30, 0x00, 0x85, 0x40,
+  0x34, 0xcb, 0xb8, 0x84, 0x80, 0x00, 0x8d, 0x34, 0x83, 0x80, 0xe0, 0x80,
+  0xc0, 0x08, 0x8c, 0x34, 0xb8, 0x08, 0x08, 0x08, 0xb7, 0x08, 0xb4, 0x08,
+  0x58, 0xc0, 0x08, 0xaf, 0x08, 0x38, 0x08, 0x08, 0x58, 0x30, 0xb4, 0xbc,
+  0x80, 0x80, 0x05, 0x0c, 0x08, 0x34, 0x08, 0x0d, 0x0c, 0xff, 0x26, 0x00,
+  0xb8, 0x08, 0x08, 0x78, 0x83, 0x84, 0x40, 0xbb, 0x88, 0x00, 0xf8, 0x3a,
+  0x83, 0x80, 0x80, 0x00, 0xf8, 0xbc, 0x80, 0x84, 0x00, 0x84, 0x40, 0x40,
+  0x83, 0xc0, 0xc8, 0x80, 0xbc, 0x24, 0x40, 0x83, 0x08, 0xc8, 0x8c, 0x8b,
+  0x50, 0x48, 0x08, 0x48, 0xb3, 0x08, 0xbd, 0xc8, 0x80, 0x80, 0x80, 0x80,
+  0x70, 0x00, 0x9f, 0x8c, 0x20, 0x82, 0x00, 0x08, 0x88, 0x27, 0x08, 0x8f,
+  0x29, 0x31, 0x88, 0x80, 0x34, 0x43, 0xbb, 0xbc, 0x80, 0x34, 0x80, 0x50,
+  0x03, 0x84, 0x80, 0xd0, 0x8b, 0x08, 0x80, 0x78, 0xc0, 0x8a, 0x80, 0xb4,
+  0xac, 0xac, 0x08, 0x43, 0x80, 0x80, 0x35, 0x84, 0xfb, 0x08, 0xc8, 0x08,
+  0x82, 0x80, 0x80, 0x00, 0xd8, 0x0c, 0x0c, 0x08, 0x48, 0x43, 0x83, 0x34,
+  0x08, 0xf8, 0xa1, 0x38, 0x33, 0x53, 0x0b, 0x08, 0x08, 0xbd, 0xaf, 0x19,
+  0x02, 0x32, 0x80, 0x40, 0x84, 0xc0, 0xbb, 0x8b, 0x8c, 0x80, 0x05, 0x08,
+  0x34, 0x8b, 0xe0, 0xbb, 0xb8, 0x08, 0x85, 0x40, 0x84, 0x80, 0x04, 0x0c,
+  0xf8, 0x28, 0xa2, 0xb2, 0x03, 0x08, 0x08, 0x08, 0xbf, 0x80, 0x40, 0x84,
+  0x80, 0x80, 0x05, 0x48, 0xc0, 0x0b, 0x08, 0x08, 0x88, 0x00, 0x88, 0xf0,
+  0x0f, 0x0b, 0x8b, 0x84, 0x00, 0x48, 0x80, 0x80, 0x80, 0x8e, 0x80, 0x05,
+  0x07, 0x08, 0x08, 0xb2, 0x80, 0xd0, 0xbb, 0x80, 0x80, 0x36, 0x08, 0x07,
+  0x08, 0xba, 0xbb, 0x80, 0x80, 0x36, 0x0c, 0x33, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x3f, 0x08, 0x08, 0x80, 0x9f, 0x85, 0x00, 0x88, 0x00, 0x88, 0x80,
+  0x00, 0xaf, 0x8d, 0x80, 0x50, 0x4b, 0x83, 0x00, 0x44, 0xc0, 0x80, 0xc0,
+  0x3c, 0x08, 0x08, 0x80, 0x78, 0xb8, 0x00, 0xcc, 0x83, 0x0b, 0xb4, 0x07,
+  0x08, 0x88, 0xba, 0x80, 0x80, 0x80, 0x60, 0x84, 0x80, 0x04, 0x08, 0x08,
+  0x11, 0x01, 0x21, 0x00, 0x08, 0x8f, 0x80, 0x4b, 0x48, 0x0b, 0x84, 0x40,
+  0x8b, 0x8c, 0xc0, 0x8b, 0x40, 0x40, 0x48, 0x48, 0x08, 0xb8, 0x88, 0x8c,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x3f, 0x08, 0x08, 0x80, 0x08,
+  0xff, 0x8b, 0x80, 0x60, 0x84, 0x80, 0x40, 0xb4, 0xb8, 0x58, 0x08, 0x48,
+  0x0b, 0x3c, 0xc8, 0x30, 0x80, 0x05, 0x08, 0x08, 0x08, 0x0f, 0x48, 0xbb,
+  0x43, 0xc0, 0xb8, 0x80, 0x80, 0xf0, 0x30, 0x8b, 0x84, 0x80, 0x80, 0x00,
+  0x78, 0xc0, 0x80, 0x80, 0x58, 0x30, 0x80, 0x80, 0xf0, 0x80, 0x84, 0x0b,
+  0x03, 0x0d, 0xbc, 0x37, 0x98, 0x8c, 0x04, 0x9a, 0x88, 0x30, 0x02, 0xfc,
+  0x79, 0x02, 0x99, 0x88, 0x99, 0x39, 0x82, 0xbf, 0x25, 0xb8, 0x9b, 0x58,
+  0x24, 0x9b, 0x38, 0xf1, 0x1b, 0x25, 0xa8, 0x89, 0x91, 0x8c, 0x22, 0x8a,
+  0x03, 0xa8, 0xae, 0x11, 0x73, 0xa1, 0x0c, 0x22, 0xa1, 0x9d, 0x20, 0x02,
+  0xa9, 0xc9, 0x1c, 0x45, 0xa8, 0x8c, 0x10, 0x22, 0x11, 0xfb, 0x18, 0x05,
+  0xbb, 0x40, 0xa8, 0x1a, 0x12, 0x81, 0xe2, 0x8c, 0x43, 0x91, 0xb9, 0x50,
+  0x82, 0xaa, 0x2b, 0x21, 0x01, 0xa2, 0xbb, 0x08, 0x37, 0x82, 0xab, 0xf3,
+  0x1e, 0x14, 0xc8, 0x1b, 0x24, 0xb9, 0x48, 0xc0, 0x20, 0x82, 0xab, 0x28,
+  0x21, 0xb0, 0xbe, 0x2a, 0x17, 0x80, 0x9e, 0x30, 0x93, 0x8c, 0x00, 0x11,
+  0x21, 0x2a, 0x83, 0xbb, 0x30, 0x35, 0xf3, 0x9c, 0x12, 0x91, 0x5a, 0x91,
+  0x9d, 0x23, 0x8c, 0x12, 0xa0, 0x7a, 0xe2, 0x9a, 0x42, 0x80, 0x88, 0x99,
+  0x11, 0x80, 0x0a, 0x25, 0xfa, 0x1a, 0x02, 0x8b, 0x36, 0xb0, 0xba, 0x83,
+  0x80, 0x17, 0xcd, 0x28, 0x84, 0xbb, 0x61, 0x92, 0x18, 0x88, 0x80, 0x90,
+  0xbb, 0x35, 0xf9, 0x19, 0x15, 0xba, 0x08, 0x32, 0x82, 0xda, 0x2a, 0x11,
+  0xa2, 0x19, 0x20, 0x8a, 0xf6, 0x01, 0x26, 0x00, 0x8b, 0xcf, 0x51, 0x90,
+  0x0b, 0x81, 0x49, 0x84, 0x0b, 0x14, 0xa0, 0xbd, 0x52, 0x99, 0x10, 0xa2,
+  0xda, 0x59, 0x14, 0xca, 0x09, 0x53, 0xa1, 0xad, 0x41, 0x00, 0x80, 0xbd,
+  0x20, 0x12, 0x9c, 0x12, 0xb0, 0x0a, 0x08, 0xa2, 0x8e, 0x14, 0x43, 0xd9,
+  0x8c, 0x72, 0x82, 0x9c, 0x22, 0xc8, 0x1a, 0x24, 0xb9, 0x09, 0x21, 0x01,
+  0xf9, 0x0b, 0x45, 0xa8, 0x9a, 0x51, 0x80, 0x80, 0xdb, 0x10, 0x83, 0x0b,
+  0x12, 0xbb, 0x72, 0xb8, 0x2a, 0x16, 0xb9, 0x20, 0xa8, 0x0d, 0x23, 0x89,
+  0x82, 0xa0, 0x1d, 0x84, 0xbc, 0x37, 0xd8, 0x0b, 0x13, 0x89, 0x84, 0xb9,
+  0x21, 0x91, 0x31, 0xfd, 0x58, 0xa2, 0x9a, 0x23, 0xb8, 0x49, 0x83, 0x9a,
+  0x9a, 0x9b, 0x43, 0xc2, 0xbd, 0x71, 0x81, 0x9b, 0x21, 0x02, 0x18, 0xbb,
+  0x19, 0x15, 0xdd, 0x30, 0x05, 0xba, 0x01, 0x80, 0x80, 0x10, 0xcb, 0x41,
+  0xb1, 0xca, 0x2d, 0x17, 0x99, 0x1b, 0x21, 0x05, 0xc9, 0x09, 0x14, 0xaa,
+  0x21, 0xea, 0x39, 0x25, 0xd8, 0x1a, 0x15, 0xa8, 0x99, 0x09, 0x83, 0xb9,
+  0x51, 0x88, 0x28, 0x90, 0x9d, 0x42, 0xc0, 0x1b, 0x05, 0xaa, 0x13, 0x09,
+  0x73, 0xc1, 0x8e, 0x21, 0x93, 0xb9, 0x98, 0x41, 0x94, 0xad, 0x43, 0xa1,
+  0x0a, 0x06, 0xab, 0x11, 0x82, 0x89, 0xa9, 0x20, 0x94, 0xad, 0x52, 0xa1,
+  0x8d, 0x03, 0x9a, 0x88, 0x10, 0x94, 0x8b, 0x14, 0xeb, 0x0a, 0x73, 0x93,
+  0x8f, 0x10, 0x90, 0x28, 0x11, 0xa8, 0x0c, 0x32, 0x84, 0x8b, 0x88, 0x00,
+  0x43, 0x93, 0xae, 0x3b, 0x33, 0xa9, 0xda, 0x71, 0x84, 0x9b, 0x01, 0xaa,
+  0x08, 0xb8, 0x01, 0xfa, 0x3a, 0xdb, 0x48, 0x24, 0xcc, 0x08, 0xca, 0x40,
+  0x25, 0x89, 0xca, 0x8a, 0x54, 0x81, 0xa9, 0x1a, 0x21, 0x01, 0x30, 0xc0,
+  0x09, 0xa0, 0x63, 0x80, 0x19, 0x24, 0xe9, 0x08, 0xb1, 0x04, 0x33, 0x00,
+  0x13, 0x00, 0x80, 0xcb, 0x79, 0x12, 0xea, 0x0a, 0x88, 0x1a, 0xe8, 0x0a,
+  0x23, 0xba, 0x9e, 0x43, 0x84, 0xcf, 0x18, 0x26, 0xa8, 0x9b, 0x11, 0x03,
+  0x18, 0x82, 0xce, 0x28, 0x16, 0xb8, 0x1a, 0x12, 0xa9, 0x40, 0x94, 0xab,
+  0x52, 0x83, 0xbc, 0x20, 0x13, 0xb9, 0x88, 0xa9, 0x2a, 0x27, 0xdb, 0x8a,
+  0x22, 0xd0, 0x9d, 0x12, 0xb8, 0x1a, 0x36, 0xd0, 0xae, 0x61, 0x03, 0xba,
+  0x0b, 0x33, 0x81, 0x9a, 0x01, 0xcb, 0x71, 0x82, 0xba, 0x58, 0x92, 0xab,
+  0x52, 0x91, 0xaa, 0x32, 0xa0, 0x2a, 0x06, 0xaa, 0x29, 0x12, 0x9a, 0x09,
+  0x02, 0xaa, 0x9e, 0x28, 0xd0, 0xad, 0x89, 0x00, 0x22, 0xb3, 0xff, 0x1f,
+  0x44, 0xb1, 0xac, 0x30, 0x03, 0x89, 0x11, 0xea, 0x29, 0x25, 0xb9, 0x1b,
+  0x24, 0xb9, 0x19, 0x14, 0xa8, 0x18, 0x91, 0x0a, 0x53, 0x90, 0xad, 0x30,
+  0x33, 0xb9, 0x8c, 0x99, 0x89, 0x52, 0xf9, 0x9c, 0x10, 0x00, 0x80, 0xd8,
+  0xbf, 0x72, 0x13, 0xcc, 0x19, 0x23, 0xa0, 0x18, 0x92, 0x9d, 0x41, 0x83,
+  0xcb, 0x20, 0x83, 0x9a, 0x30, 0x83, 0x9a, 0x18, 0xa0, 0x39, 0x26, 0xb8,
+  0xaf, 0x51, 0x02, 0xaa, 0x09, 0x90, 0x8b, 0x43, 0xfa, 0x8d, 0x10, 0x88,
+  0x88, 0xce, 0x49, 0x27, 0xb9, 0x8d, 0x33, 0x91, 0x0a, 0x01, 0xab, 0x60,
+  0x13, 0xda, 0x29, 0x13, 0xa9, 0x10, 0x02, 0xab, 0x39, 0x13, 0xb8, 0x30,
+  0xe8, 0x9d, 0x54, 0xa2, 0xbc, 0x21, 0x90, 0x8a, 0x80, 0xdb, 0x19, 0x13,
+  0xda, 0xcf, 0x3a, 0x47, 0xb0, 0xac, 0x31, 0x03, 0x98, 0x00, 0xc9, 0x29,
+  0x36, 0xb0, 0x8c, 0x21, 0x81, 0x08, 0x11, 0xa8, 0x8a, 0x32, 0x81, 0xaa,
+  0x31, 0xee, 0x29, 0x16, 0xc8, 0x0b, 0x01, 0x99, 0x10, 0xc8, 0x8c, 0x41,
+  0xd8, 0xce, 0x48, 0x25, 0xc8, 0x9b, 0x32, 0x02, 0x08, 0x81, 0xcd, 0x48,
+  0x0e, 0xec, 0x4c, 0x00, 0x24, 0xb8, 0x8a, 0x21, 0x80, 0x20, 0x91, 0xaa,
+  0x28, 0x03, 0xa8, 0x1a, 0x23, 0xfc, 0x0b, 0x33, 0xb0, 0x9d, 0xa8, 0x9c,
+  0x42, 0xa0, 0xad, 0x21, 0xf0, 0xcf, 0x30, 0x17, 0xb8, 0x9b, 0x32, 0x02,
+  0x18, 0x82, 0xce, 0x39, 0x26, 0xa8, 0x8a, 0x11, 0x80, 0x10, 0x82, 0xba,
+  0x28, 0x13, 0xda, 0x30, 0x85, 0xcc, 0x18, 0x11, 0x98, 0x99, 0xbc, 0x1a,
+  0x24, 0x90, 0x9b, 0xfd, 0xae, 0x70, 0x23, 0xd9, 0x9a, 0x22, 0x01, 0x10,
+  0x92, 0xcd, 0x38, 0x25, 0xb8, 0x09, 0x11, 0xa8, 0x18, 0x13, 0xa0, 0x09,
+  0x80, 0xcd, 0x40, 0x24, 0xdb, 0x8b, 0x12, 0x00, 0x98, 0xdb, 0x0a, 0x33,
+  0x03, 0xa9, 0xef, 0x9c, 0x63, 0x04, 0xca, 0x0a, 0x22, 0x80, 0x21, 0x91,
+  0xbd, 0x40, 0x14, 0xa9, 0x18, 0x02, 0xba, 0x3a, 0x34, 0x91, 0x8a, 0xc9,
+  0x9d, 0x44, 0x82, 0xbc, 0x09, 0x00, 0x00, 0x98, 0xab, 0x18, 0x22, 0x91,
+  0xff, 0xae, 0x40, 0x16, 0xb8, 0x8c, 0x21, 0x01, 0x10, 0x82, 0xeb, 0x19,
+  0x25, 0x90, 0x8b, 0x22, 0x91, 0xab, 0x41, 0x12, 0x99, 0x00, 0xdd, 0x3a,
+  0x25, 0xb8, 0x9d, 0x00, 0x01, 0x00, 0xa9, 0x99, 0x38, 0x15, 0xfc, 0x9e,
+  0x52, 0x03, 0xca, 0x8a, 0x12, 0x11, 0x22, 0xb8, 0xad, 0x41, 0x13, 0xa9,
+  0x19, 0x33, 0xc9, 0x9b, 0x52, 0x02, 0x80, 0xd9, 0x9e, 0x40, 0x02, 0xb9,
+  0x9b, 0x18, 0x01, 0x00, 0x98, 0x08, 0x02, 0xff, 0x9f, 0x52, 0x12, 0xc9,
+  0x8a, 0x01, 0x11, 0x42, 0x91, 0xbd, 0x20, 0x23, 0x98, 0x19, 0x33, 0xc8,
+  0xad, 0x10, 0x33, 0x22, 0xd0, 0xbf, 0x18, 0x32, 0x91, 0xbb, 0x9a, 0x01,
+  0x08, 0x20, 0x13, 0xb1, 0xff, 0xaf, 0x43, 0x04, 0xb9, 0x8a, 0x00, 0x20,
+  0x34, 0x92, 0xbc, 0x28, 0x02, 0x89, 0x61, 0x23, 0xc9, 0xac, 0x08, 0x32,
+  0x25, 0xd8, 0xac, 0x18, 0xeb, 0xf3, 0x49, 0x00, 0x11, 0x88, 0x89, 0x88,
+  0x98, 0x88, 0x11, 0x33, 0xfe, 0xaf, 0x42, 0x13, 0xda, 0x19, 0x01, 0x88,
+  0x41, 0x02, 0xab, 0x30, 0x93, 0xbc, 0x61, 0x24, 0xa9, 0xab, 0x80, 0x18,
+  0x34, 0xc1, 0xae, 0x10, 0x80, 0xaa, 0x19, 0x23, 0x91, 0xab, 0x10, 0xc1,
+  0xff, 0x0c, 0x45, 0x91, 0xbb, 0x28, 0x01, 0x18, 0x44, 0xa0, 0x9a, 0x32,
+  0xb1, 0x9c, 0x54, 0x04, 0xc9, 0x0a, 0x08, 0x08, 0x43, 0xb0, 0xae, 0x00,
+  0x81, 0xba, 0x38, 0x24, 0x91, 0x9a, 0x00, 0xfc, 0xad, 0x58, 0x25, 0xa8,
+  0x9c, 0x20, 0x08, 0x20, 0x24, 0xa8, 0x0b, 0x22, 0xd9, 0x1a, 0x46, 0x82,
+  0xcb, 0x89, 0x80, 0x10, 0x23, 0xd8, 0x9c, 0x00, 0xa0, 0xab, 0x61, 0x24,
+  0x80, 0x9a, 0xba, 0xbf, 0x2b, 0x47, 0x82, 0xcb, 0x19, 0x82, 0x09, 0x42,
+  0x03, 0x99, 0x19, 0xb0, 0xae, 0x61, 0x34, 0xb8, 0x9c, 0x18, 0x89, 0x28,
+  0x02, 0xa9, 0x8b, 0xa8, 0xbf, 0x29, 0x37, 0x02, 0x99, 0xba, 0xce, 0x1a,
+  0x55, 0x82, 0xbb, 0x18, 0x81, 0x9a, 0x42, 0x14, 0x81, 0x88, 0xd9, 0xab,
+  0x71, 0x33, 0xa8, 0x9c, 0x00, 0xaa, 0x19, 0x22, 0x00, 0x88, 0xd9, 0xbe,
+  0x3a, 0x45, 0x12, 0x99, 0xdb, 0xcb, 0x48, 0x24, 0xa1, 0x8b, 0x21, 0xb0,
+  0xac, 0x52, 0x32, 0x22, 0x90, 0xdc, 0x9b, 0x42, 0x14, 0xa8, 0x09, 0x01,
+  0xdb, 0xab, 0x28, 0x32, 0x03, 0xb8, 0xcf, 0x19, 0x53, 0x03, 0xb8, 0xcd,
+  0x8a, 0x52, 0x02, 0xba, 0x28, 0x24, 0xa8, 0x9c, 0x31, 0x34, 0x23, 0xb8,
+  0xbe, 0x09, 0x44, 0x80, 0xab, 0x20, 0x02, 0xdc, 0xac, 0x10, 0x11, 0x01,
+  0xb8, 0x8c, 0x63, 0x14, 0xa0, 0xfb, 0xab, 0x51, 0x14, 0xb8, 0x8b, 0x33,
+  0x91, 0x9c, 0x38, 0x34, 0x33, 0xa0, 0xce, 0x0a, 0x43, 0x82, 0xbb, 0x28,
+  0x12, 0xfa, 0xbb, 0x1a, 0x13, 0x02, 0xa8, 0x9c, 0x77, 0xe0, 0x3d, 0x00,
+  0x62, 0x25, 0xa0, 0xdd, 0x9a, 0x42, 0x14, 0xc8, 0x0a, 0x22, 0x81, 0xab,
+  0x28, 0x34, 0x25, 0xa0, 0xcc, 0x09, 0x33, 0x92, 0xac, 0x29, 0x14, 0xd9,
+  0xbc, 0x19, 0x12, 0x01, 0x99, 0x89, 0x44, 0x34, 0xb0, 0xdf, 0x9a, 0x51,
+  0x13, 0xb8, 0x8b, 0x33, 0xa2, 0xcb, 0x28, 0x45, 0x22, 0x91, 0xbc, 0x8b,
+  0x42, 0x83, 0xbc, 0x29, 0x24, 0xd0, 0xbc, 0x8a, 0x22, 0x00, 0x88, 0x08,
+  0x54, 0x33, 0xc0, 0xde, 0xab, 0x51, 0x33, 0xc0, 0x8b, 0x32, 0x82, 0xbc,
+  0x19, 0x44, 0x23, 0x02, 0xdb, 0x9b, 0x31, 0x82, 0xdb, 0x29, 0x44, 0xb0,
+  0xbe, 0x89, 0x11, 0x00, 0x08, 0x20, 0x53, 0x14, 0xb8, 0xef, 0x8a, 0x41,
+  0x13, 0xb9, 0x1a, 0x24, 0xa0, 0xad, 0x10, 0x43, 0x32, 0x91, 0xca, 0x8a,
+  0x21, 0xb0, 0xbd, 0x50, 0x24, 0xb8, 0xbd, 0x09, 0x00, 0x88, 0x18, 0x42,
+  0x34, 0x23, 0xd0, 0xdf, 0x8a, 0x41, 0x12, 0xb9, 0x28, 0x24, 0xb0, 0xad,
+  0x18, 0x33, 0x24, 0x81, 0xba, 0x8a, 0x21, 0xf9, 0xac, 0x31, 0x25, 0xb0,
+  0xac, 0x89, 0x80, 0xa8, 0x18, 0x44, 0x34, 0x23, 0xe9, 0xbe, 0x0b, 0x43,
+  0x82, 0xab, 0x62, 0x13, 0xca, 0x8c, 0x20, 0x22, 0x11, 0x01, 0x99, 0x18,
+  0x91, 0xdf, 0x8a, 0x42, 0x12, 0xba, 0x9a, 0x00, 0xb9, 0x9d, 0x20, 0x45,
+  0x42, 0x02, 0xda, 0xae, 0x19, 0x23, 0xb8, 0x1a, 0x55, 0x02, 0xcb, 0x0a,
+  0x11, 0x02, 0x01, 0x01, 0x10, 0x10, 0xc0, 0xcf, 0x8a, 0x42, 0x81, 0xb9,
+  0x19, 0x03, 0xfa, 0x9a, 0x30, 0x33, 0x34, 0x03, 0xed, 0xac, 0x30, 0x82,
+  0xca, 0x48, 0x35, 0x90, 0xbb, 0x18, 0x03, 0x00, 0x00, 0x11, 0x21, 0x24,
+  0xf8, 0xbd, 0x09, 0x32, 0xa0, 0xac, 0x40, 0x02, 0xcc, 0x0a, 0x22, 0x43,
+  0x33, 0xb1, 0xff, 0x0a, 0x22, 0xa0, 0xab, 0x73, 0x13, 0xb9, 0x9a, 0x32,
+  0x8b, 0x09, 0x44, 0x00, 0x02, 0xa9, 0x20, 0x22, 0x31, 0x90, 0xee, 0xab,
+  0x40, 0x81, 0xda, 0x09, 0x33, 0xb0, 0xbd, 0x30, 0x24, 0x22, 0x13, 0xf9,
+  0xaf, 0x29, 0x13, 0xca, 0x1a, 0x36, 0x83, 0xdb, 0x18, 0x22, 0x98, 0x89,
+  0x22, 0x01, 0x00, 0x98, 0xce, 0x0a, 0x21, 0xb8, 0xae, 0x31, 0x13, 0xeb,
+  0x8a, 0x33, 0x14, 0x21, 0x81, 0xfd, 0x8c, 0x21, 0x92, 0xac, 0x50, 0x24,
+  0xa0, 0x9c, 0x21, 0x02, 0xa8, 0x19, 0x23, 0x01, 0x80, 0xca, 0xcd, 0x08,
+  0x02, 0xda, 0x8a, 0x41, 0x93, 0xcb, 0x29, 0x25, 0x12, 0x21, 0xc1, 0xdf,
+  0x0a, 0x23, 0xc0, 0x8b, 0x63, 0x13, 0xc9, 0x0a, 0x33, 0x91, 0xba, 0x30,
+  0x24, 0x80, 0x98, 0xc9, 0xbc, 0x18, 0x81, 0xbe, 0x09, 0x25, 0xb0, 0xac,
+  0x52, 0x23, 0x10, 0x11, 0xfa, 0xaf, 0x28, 0x02, 0xba, 0x2a, 0x47, 0x81,
+  0xab, 0x38, 0x13, 0xa8, 0x8b, 0x33, 0x23, 0x99, 0xb8, 0xcc, 0xab, 0x10,
+  0xf8, 0xbb, 0x51, 0x13, 0xcb, 0x09, 0x63, 0x22, 0x10, 0x80, 0xfc, 0x9c,
+  0x30, 0x90, 0xbb, 0x71, 0x24, 0xb0, 0x8b, 0x41, 0x82, 0xba, 0x29, 0x24,
+  0x81, 0x99, 0xa9, 0xaa, 0x8b, 0x98, 0xde, 0x0a, 0x42, 0x92, 0x9b, 0x40,
+  0x36, 0x11, 0x10, 0xd8, 0xce, 0x0a, 0x22, 0xa8, 0x9c, 0x64, 0x13, 0xb9,
+  0x8a, 0x43, 0x91, 0xbb, 0x38, 0x25, 0x90, 0x99, 0x98, 0xba, 0x9b, 0xa8,
+  0xcd, 0x09, 0x43, 0xa0, 0x8c, 0x73, 0x23, 0x01, 0x11, 0xe9, 0xce, 0x19,
+  0x12, 0xa8, 0x0b, 0x55, 0x03, 0xaa, 0x1a, 0x24, 0xa8, 0xbb, 0x32, 0x24,
+  0x98, 0x88, 0xa8, 0xdb, 0xaa, 0xbb, 0xbb, 0x38, 0x26, 0xab, 0x40, 0x37,
+  0x22, 0x01, 0x91, 0xee, 0xac, 0x20, 0x81, 0xba, 0x50, 0x36, 0x91, 0xab,
+  0x30, 0x04, 0xba, 0x1b, 0x43, 0x02, 0xaa, 0x00, 0xa8, 0xcc, 0xaa, 0xcb,
+  0x8b, 0x31, 0x04, 0x9a, 0x5f, 0xed, 0x34, 0x00, 0x60, 0x36, 0x11, 0x10,
+  0x00, 0xfd, 0xbb, 0x10, 0x82, 0xac, 0x50, 0x35, 0x91, 0xaa, 0x32, 0x83,
+  0xbd, 0x19, 0x24, 0x91, 0x99, 0x00, 0xa8, 0xcb, 0xac, 0xaa, 0x8c, 0x32,
+  0xa0, 0x1a, 0x75, 0x33, 0x02, 0x00, 0xb1, 0xff, 0x8b, 0x11, 0x90, 0x8b,
+  0x73, 0x14, 0x90, 0x8a, 0x41, 0x91, 0xac, 0x19, 0x33, 0x92, 0x9a, 0x10,
+  0xa1, 0xad, 0xac, 0xab, 0x9a, 0x31, 0x83, 0x88, 0x72, 0x37, 0x01, 0x28,
+  0x81, 0xee, 0xab, 0x00, 0x82, 0xbb, 0x71, 0x25, 0x80, 0x9a, 0x22, 0x82,
+  0xdb, 0x1a, 0x32, 0x91, 0x09, 0x00, 0x88, 0xda, 0xdc, 0x99, 0x99, 0x10,
+  0x01, 0x1a, 0x55, 0x23, 0x22, 0x12, 0x98, 0xff, 0x9c, 0x10, 0x90, 0x89,
+  0x52, 0x24, 0x81, 0x9a, 0x31, 0x92, 0xcd, 0x19, 0x13, 0x11, 0xa8, 0x18,
+  0x92, 0xbd, 0xbc, 0xbb, 0x99, 0x81, 0x20, 0x12, 0x64, 0x63, 0x12, 0x00,
+  0xa2, 0xdf, 0xab, 0x18, 0x00, 0xa8, 0x68, 0x35, 0x82, 0x8a, 0x10, 0x03,
+  0xcc, 0x8a, 0x22, 0x03, 0x98, 0x00, 0x84, 0xc9, 0xcd, 0x99, 0x99, 0x19,
+  0x18, 0x28, 0x64, 0x32, 0x31, 0x22, 0xa2, 0xef, 0xbc, 0x09, 0x01, 0xa8,
+  0x38, 0x47, 0x12, 0x98, 0x08, 0x11, 0xc9, 0xab, 0x40, 0x13, 0x08, 0x18,
+  0x11, 0xc0, 0xbf, 0xaa, 0xa9, 0x89, 0x08, 0x12, 0x44, 0x33, 0x35, 0x53,
+  0x02, 0xfb, 0xcc, 0x8a, 0x00, 0x98, 0x89, 0x55, 0x33, 0x90, 0x89, 0x22,
+  0xa1, 0xbe, 0x19, 0x32, 0x82, 0x18, 0x11, 0x91, 0xce, 0xbb, 0x9c, 0x99,
+  0x08, 0x18, 0x31, 0x36, 0x24, 0x34, 0x13, 0xe0, 0xce, 0xaa, 0x00, 0x88,
+  0x8a, 0x73, 0x15, 0x81, 0x89, 0x20, 0x91, 0xbc, 0x8a, 0x43, 0x11, 0x80,
+  0x18, 0x90, 0xc9, 0xcc, 0xbb, 0x89, 0x00, 0x10, 0x40, 0x23, 0x45, 0x34,
+  0x34, 0xb8, 0xbf, 0xad, 0x09, 0x88, 0x99, 0x40, 0xcf, 0xe6, 0x3b, 0x00,
+  0x46, 0x02, 0xa8, 0x00, 0x12, 0xd9, 0x9b, 0x30, 0x24, 0x80, 0x88, 0x11,
+  0xa9, 0xaf, 0xac, 0x89, 0x80, 0x01, 0x30, 0x21, 0x34, 0x36, 0x16, 0x91,
+  0xbd, 0xac, 0x8a, 0x80, 0x9a, 0x48, 0x47, 0x11, 0x98, 0x19, 0x11, 0xc8,
+  0xac, 0x30, 0x24, 0x90, 0x88, 0x20, 0xa0, 0xbe, 0xab, 0x8a, 0x09, 0x08,
+  0x30, 0x31, 0x27, 0x54, 0x43, 0x01, 0xbd, 0xbc, 0x8b, 0x80, 0xa9, 0x48,
+  0x46, 0x13, 0x98, 0x19, 0x22, 0xd0, 0xbc, 0x20, 0x24, 0x80, 0x99, 0x10,
+  0xa8, 0xbe, 0xcb, 0x99, 0x00, 0x18, 0x20, 0x24, 0x42, 0x45, 0x53, 0x81,
+  0xeb, 0xbb, 0x9c, 0x00, 0x98, 0x19, 0x55, 0x14, 0x90, 0x89, 0x12, 0xa1,
+  0xcc, 0x28, 0x24, 0x01, 0x89, 0x08, 0xb9, 0xbc, 0xae, 0x98, 0x8a, 0x28,
+  0x01, 0x10, 0x41, 0x55, 0x34, 0x23, 0xb9, 0xdf, 0xaa, 0x08, 0x90, 0x98,
+  0x62, 0x24, 0x81, 0xa9, 0x20, 0x02, 0xca, 0x8a, 0x35, 0x03, 0x98, 0x8a,
+  0xda, 0xcb, 0xaa, 0x9a, 0xba, 0x40, 0x23, 0x81, 0x91, 0x71, 0x47, 0x32,
+  0xa1, 0xcd, 0xbb, 0x8a, 0x80, 0x99, 0x40, 0x46, 0x03, 0xb8, 0x29, 0x22,
+  0xa9, 0x9c, 0x51, 0x23, 0x88, 0x98, 0xea, 0xaa, 0x9b, 0x99, 0xba, 0x5a,
+  0x24, 0x89, 0xa9, 0x68, 0x46, 0x22, 0x13, 0xfb, 0xba, 0xab, 0x80, 0x98,
+  0x28, 0x55, 0x33, 0xb0, 0x8a, 0x21, 0x80, 0xba, 0x48, 0x46, 0x00, 0x99,
+  0xb9, 0xbd, 0x9a, 0x08, 0xb1, 0x8c, 0x41, 0x02, 0xcb, 0x0a, 0x56, 0x44,
+  0x23, 0xa8, 0xbc, 0xcc, 0x9b, 0x80, 0x00, 0x32, 0x45, 0x13, 0xba, 0x8a,
+  0x20, 0x00, 0x88, 0x64, 0x22, 0x80, 0xba, 0xbd, 0xad, 0x0a, 0x22, 0x88,
+  0x89, 0xa8, 0x90, 0xfb, 0x29, 0x74, 0x35, 0x23, 0x90, 0xcc, 0xbc, 0x9b,
+  0x08, 0x21, 0x21, 0x44, 0x13, 0xc9, 0x9c, 0x28, 0x13, 0x11, 0x44, 0x02,
+  0xe5, 0x21, 0x3b, 0x00, 0x90, 0xfb, 0xaa, 0xaa, 0x19, 0x33, 0x82, 0xc9,
+  0xdb, 0xab, 0x8a, 0x51, 0x45, 0x45, 0x22, 0x91, 0xeb, 0xab, 0xbb, 0x29,
+  0x33, 0x13, 0x00, 0x00, 0xe8, 0xad, 0x31, 0x35, 0x13, 0x22, 0x80, 0xda,
+  0xac, 0x9a, 0x80, 0x18, 0x11, 0x83, 0xee, 0xaa, 0x9b, 0x20, 0x54, 0x43,
+  0x32, 0x31, 0x04, 0xfb, 0xab, 0x99, 0xa9, 0x20, 0x43, 0xb0, 0xad, 0x19,
+  0x01, 0x18, 0x74, 0x24, 0x01, 0x89, 0x99, 0xaa, 0x88, 0x20, 0x82, 0xca,
+  0xcd, 0xba, 0xcb, 0x89, 0x80, 0x40, 0x37, 0x12, 0x11, 0x31, 0x36, 0xb0,
+  0x9d, 0x89, 0xda, 0x9d, 0x28, 0x80, 0xaa, 0x28, 0x35, 0x81, 0x28, 0x36,
+  0x02, 0x88, 0x11, 0x80, 0xb9, 0xa9, 0xba, 0xdf, 0xbb, 0xa9, 0xaa, 0x01,
+  0x00, 0xc9, 0x79, 0x36, 0x12, 0x12, 0x32, 0x16, 0xc8, 0x9b, 0xa9, 0xdc,
+  0x9d, 0x28, 0x82, 0xa9, 0x28, 0x33, 0x82, 0x50, 0x37, 0x82, 0x80, 0x01,
+  0xb0, 0xbc, 0x99, 0xb8, 0xbe, 0xab, 0xcb, 0x19, 0x32, 0x82, 0xb9, 0x74,
+  0x37, 0x01, 0x10, 0x01, 0x81, 0xc9, 0x9a, 0xb9, 0xdd, 0xbd, 0x0a, 0x23,
+  0x90, 0x00, 0x53, 0x12, 0x00, 0x74, 0x13, 0x80, 0x09, 0x80, 0xdc, 0x9b,
+  0x89, 0x99, 0xab, 0x9b, 0xaa, 0x51, 0x15, 0x81, 0x31, 0x77, 0x02, 0x88,
+  0x08, 0x99, 0x99, 0x88, 0x00, 0xea, 0xdc, 0xac, 0x38, 0x33, 0x00, 0x20,
+  0x22, 0x98, 0x71, 0x36, 0x91, 0x99, 0x88, 0xda, 0xad, 0x19, 0x00, 0x99,
+  0x89, 0xa9, 0x18, 0x64, 0x23, 0x12, 0x23, 0x14, 0xb0, 0x9b, 0xa0, 0xce,
+  0x89, 0x21, 0x91, 0xed, 0xcc, 0x8b, 0x73, 0x12, 0x80, 0x08, 0x88, 0x18,
+  0x63, 0x12, 0xb8, 0xba, 0xa8, 0xcd, 0x8c, 0x21, 0x81, 0x98, 0x99, 0x8a,
+  0x72, 0x35, 0x11, 0x80, 0x88, 0x98, 0x99, 0x00, 0xd9, 0xcc, 0x9a, 0x21,
+  0x13, 0xf9, 0xbe, 0x49, 0x11, 0xaf, 0x4c, 0x00, 0x25, 0x11, 0x98, 0x88,
+  0x88, 0x40, 0x33, 0xd8, 0xab, 0x99, 0xba, 0x9d, 0x20, 0x23, 0x80, 0x89,
+  0x0a, 0x71, 0x45, 0x22, 0x98, 0xaa, 0xaa, 0x09, 0x01, 0xa8, 0xec, 0xac,
+  0x89, 0x28, 0x46, 0x13, 0xfa, 0x8c, 0x53, 0x02, 0x98, 0x09, 0x90, 0xaa,
+  0x31, 0xa3, 0xaf, 0x08, 0x91, 0xba, 0x30, 0x26, 0x80, 0x10, 0x91, 0x1a,
+  0x44, 0x82, 0xaa, 0xbb, 0xcc, 0xaa, 0x41, 0x02, 0x99, 0xb9, 0x8d, 0x30,
+  0x64, 0x43, 0x22, 0xb0, 0xff, 0x09, 0x33, 0x02, 0xda, 0x9a, 0x88, 0x10,
+  0x21, 0x03, 0xa0, 0x9b, 0x20, 0x02, 0x53, 0x34, 0xa1, 0xce, 0x9b, 0x10,
+  0x12, 0x90, 0x9c, 0x00, 0xa8, 0x09, 0x65, 0x34, 0x91, 0xbb, 0xbb, 0x10,
+  0x45, 0x11, 0x90, 0xc9, 0xff, 0x0b, 0x44, 0x02, 0xba, 0x1a, 0x81, 0x18,
+  0x54, 0x82, 0xbb, 0x8a, 0x80, 0x89, 0x32, 0xa2, 0xcc, 0x9a, 0x89, 0x72,
+  0x24, 0x90, 0x9b, 0x21, 0x90, 0x0b, 0x33, 0x43, 0xfa, 0xad, 0x09, 0x21,
+  0x12, 0x89, 0x21, 0x13, 0xfa, 0xbf, 0x62, 0x24, 0xb0, 0xbd, 0x18, 0x23,
+  0x01, 0x99, 0x99, 0x9a, 0x1a, 0x43, 0x22, 0x98, 0x89, 0xba, 0xaa, 0x71,
+  0x25, 0x90, 0xcd, 0x8a, 0x42, 0x02, 0x99, 0x98, 0x18, 0x98, 0x38, 0x35,
+  0x11, 0xba, 0x8b, 0x33, 0xfc, 0xbf, 0x41, 0x33, 0xb0, 0xae, 0x10, 0x13,
+  0x12, 0x80, 0xa8, 0xcb, 0x1a, 0x23, 0x98, 0xab, 0xbc, 0x99, 0x0a, 0x65,
+  0x32, 0x80, 0xdb, 0x29, 0x26, 0x90, 0x99, 0x98, 0x90, 0xac, 0x11, 0xa2,
+  0xa9, 0x99, 0x40, 0x37, 0x14, 0xfa, 0x9c, 0x51, 0x24, 0xb1, 0xae, 0x0a,
+  0x23, 0x03, 0xb9, 0xac, 0x18, 0x22, 0x13, 0x00, 0x08, 0x81, 0xbb, 0x9b,
+  0x44, 0x84, 0xc9, 0xbe, 0x09, 0x31, 0x24, 0xb0, 0xaa, 0x10, 0x36, 0x11,
+  0x18, 0x80, 0x8c, 0x9c, 0x18, 0xd9, 0xcf, 0x09, 0x3c, 0xe7, 0x3c, 0x00,
+  0x73, 0x12, 0xc9, 0x9a, 0x20, 0x35, 0x01, 0xba, 0xab, 0x19, 0x22, 0x82,
+  0xbb, 0xba, 0x9b, 0x51, 0x23, 0x25, 0x91, 0x89, 0xbb, 0x73, 0x24, 0x99,
+  0xbc, 0x9a, 0x08, 0xa1, 0x9a, 0xa9, 0x82, 0xb0, 0x78, 0x67, 0x31, 0xa0,
+  0xcf, 0x09, 0x62, 0x12, 0xb9, 0xad, 0x18, 0x43, 0x02, 0xa9, 0xbb, 0x8a,
+  0x53, 0x13, 0x98, 0xab, 0x89, 0x09, 0x38, 0x36, 0x91, 0xcc, 0x99, 0x31,
+  0x23, 0xd1, 0xba, 0x89, 0x42, 0x22, 0x81, 0xb9, 0x9c, 0x80, 0x40, 0x84,
+  0x44, 0x24, 0xca, 0xbe, 0x8c, 0x52, 0x33, 0xb9, 0xbd, 0x29, 0x44, 0x12,
+  0xb9, 0xca, 0x08, 0x11, 0x13, 0xa1, 0xdb, 0x8a, 0x29, 0x43, 0x13, 0x98,
+  0xcc, 0x19, 0x32, 0x80, 0xa9, 0x9d, 0x41, 0x21, 0x21, 0xa8, 0xba, 0xb8,
+  0xaf, 0xa8, 0x80, 0x33, 0x07, 0xa8, 0xe9, 0x30, 0x13, 0x52, 0xf9, 0x8d,
+  0x41, 0x04, 0xb8, 0x89, 0x19, 0x20, 0x33, 0xf0, 0xbe, 0x20, 0x22, 0x90,
+  0x99, 0x11, 0x81, 0x34, 0x14, 0xc8, 0xa9, 0xba, 0xba, 0x41, 0x83, 0x9c,
+  0x19, 0x24, 0xdc, 0xad, 0x50, 0x45, 0x82, 0xab, 0x89, 0x10, 0x13, 0xb0,
+  0xdd, 0x9a, 0x20, 0x22, 0x08, 0x99, 0x1a, 0x33, 0x56, 0x12, 0xa0, 0x0b,
+  0x11, 0xfb, 0xbc, 0x09, 0x54, 0x81, 0xca, 0xab, 0x31, 0x25, 0x12, 0xa9,
+  0xba, 0x08, 0x43, 0x13, 0x80, 0xfb, 0x9c, 0x10, 0x20, 0x90, 0xbb, 0x09,
+  0x28, 0x62, 0x13, 0x80, 0x80, 0x83, 0x84, 0xb0, 0xc8, 0x08, 0xd0, 0x30,
+  0xc8, 0xfb, 0x4a, 0xa0, 0xa0, 0x08, 0x38, 0x03, 0x27, 0x02, 0x22, 0x33,
+  0xc0, 0x08, 0xc8, 0x80, 0xcc, 0x8e, 0xa9, 0x80, 0x86, 0xc0, 0xbb, 0x58,
+  0x02, 0x01, 0x12, 0x83, 0x80, 0x34, 0xcb, 0xbb, 0x8f, 0x10, 0xa0, 0xe8,
+  0x8d, 0xa8, 0x10, 0x22, 0x44, 0x83, 0x80, 0x02, 0x38, 0x37, 0x10, 0xdc,
+  0x16, 0x02, 0x31, 0x00, 0x99, 0x99, 0xc9, 0x9d, 0x01, 0x31, 0x93, 0x9d,
+  0x01, 0x64, 0x01, 0x21, 0x11, 0x0a, 0xca, 0x0b, 0x88, 0xda, 0xaa, 0x02,
+  0xeb, 0x0d, 0x38, 0x34, 0x88, 0x40, 0x33, 0x34, 0xa8, 0xde, 0x8a, 0x21,
+  0x92, 0x99, 0xad, 0x1a, 0x67, 0x91, 0xbd, 0x1a, 0x46, 0x81, 0xcb, 0x0a,
+  0x31, 0x14, 0x98, 0xca, 0x09, 0x22, 0x22, 0x80, 0xda, 0x9b, 0x38, 0x33,
+  0x98, 0xaa, 0x99, 0x41, 0x25, 0x02, 0xda, 0x80, 0x20, 0x21, 0x9a, 0xbf,
+  0x9c, 0x20, 0x06, 0xb0, 0xa9, 0x89, 0x35, 0x13, 0xb0, 0x19, 0x22, 0x22,
+  0xba, 0x8f, 0xa0, 0x89, 0x8a, 0xeb, 0x2a, 0x45, 0x83, 0xdd, 0x18, 0x25,
+  0x91, 0x89, 0x88, 0x01, 0x89, 0xa0, 0xaa, 0xbd, 0x98, 0x0b, 0x23, 0x24,
+  0x0b, 0x77, 0xb1, 0x28, 0x04, 0xc8, 0xab, 0x61, 0x82, 0xcb, 0x8b, 0x10,
+  0x33, 0x22, 0xb8, 0xbf, 0x30, 0x14, 0x12, 0x32, 0xf0, 0xaf, 0x18, 0x33,
+  0x81, 0xcb, 0x8a, 0x38, 0x33, 0x24, 0xd8, 0xab, 0x1a, 0x44, 0x02, 0xca,
+  0x9c, 0x39, 0x23, 0x92, 0xdb, 0x89, 0x58, 0x34, 0xa1, 0xbb, 0x0c, 0x32,
+  0x81, 0xc9, 0x9a, 0xa8, 0x20, 0x73, 0x01, 0xaa, 0x80, 0x60, 0x91, 0xa8,
+  0x0a, 0x08, 0xc8, 0x8b, 0x00, 0x3d, 0x43, 0x24, 0x80, 0x8b, 0x74, 0x82,
+  0xdc, 0x8a, 0x15, 0x80, 0x98, 0x0a, 0xc8, 0x80, 0x34, 0x80, 0x00, 0xb8,
+  0x03, 0x78, 0x81, 0xba, 0xcf, 0x88, 0x20, 0x12, 0x80, 0xfa, 0x28, 0x25,
+  0x18, 0x99, 0xad, 0x28, 0x18, 0xa2, 0xdf, 0x28, 0x10, 0x33, 0x12, 0xd0,
+  0xad, 0x39, 0x44, 0x81, 0xc9, 0x9c, 0x18, 0x24, 0x81, 0xda, 0x9a, 0x11,
+  0x43, 0x01, 0x8a, 0xaa, 0x2b, 0x34, 0xa0, 0x8a, 0x80, 0x37, 0x03, 0xff,
+  0x8a, 0x20, 0x25, 0xa1, 0xad, 0x08, 0x33, 0x12, 0xb8, 0xac, 0x99, 0x22,
+  0x14, 0xa8, 0x9b, 0x1b, 0xf6, 0xf9, 0x2b, 0x00, 0x24, 0x15, 0xb0, 0xac,
+  0x18, 0x02, 0x08, 0xe8, 0xab, 0x22, 0x32, 0x38, 0x80, 0x8c, 0x70, 0x35,
+  0x83, 0x9a, 0x9d, 0x21, 0x82, 0xa2, 0xf8, 0x9c, 0x19, 0x23, 0x08, 0x38,
+  0x78, 0x01, 0x08, 0x8a, 0x80, 0x80, 0x80, 0xf0, 0xbf, 0x19, 0x57, 0xa9,
+  0x8a, 0x40, 0x93, 0xaa, 0x58, 0x02, 0xbd, 0x10, 0x24, 0xb8, 0x9b, 0x81,
+  0x80, 0x32, 0x01, 0xaf, 0x19, 0x21, 0x01, 0x0d, 0x28, 0x21, 0xa2, 0x0b,
+  0x73, 0xc2, 0x9b, 0x73, 0x00, 0xfb, 0x9b, 0x28, 0x73, 0x23, 0xb9, 0x9f,
+  0x18, 0x34, 0x01, 0xb9, 0xbc, 0x09, 0x41, 0x01, 0xc8, 0xbb, 0x18, 0x73,
+  0x02, 0x98, 0x89, 0x30, 0x34, 0xa0, 0xcd, 0x89, 0x81, 0x11, 0x90, 0xab,
+  0x8b, 0x42, 0x55, 0x23, 0xf8, 0xbe, 0x18, 0x45, 0x12, 0xd9, 0xab, 0x28,
+  0x25, 0x82, 0xc9, 0xab, 0x28, 0x43, 0x81, 0xc9, 0x9b, 0x30, 0x24, 0x02,
+  0xba, 0x9d, 0x20, 0x33, 0x93, 0xeb, 0x8b, 0x11, 0x14, 0xb1, 0xbc, 0x18,
+  0x62, 0x12, 0x11, 0x00, 0xf8, 0xcf, 0x08, 0x44, 0x02, 0xca, 0x9c, 0x18,
+  0x34, 0x03, 0xc9, 0xac, 0x29, 0x43, 0x02, 0xc9, 0x9b, 0x10, 0x33, 0x13,
+  0xcb, 0xac, 0x20, 0x32, 0x82, 0xcc, 0x9a, 0x32, 0x24, 0x93, 0xcb, 0x89,
+  0x33, 0x16, 0x12, 0xe9, 0xbf, 0x8b, 0x44, 0x14, 0xa0, 0xbd, 0x19, 0x42,
+  0x14, 0xa0, 0xbc, 0x89, 0x32, 0x14, 0xa8, 0xbc, 0x0a, 0x32, 0x24, 0xa8,
+  0xbb, 0x1a, 0x44, 0x13, 0xba, 0xab, 0x28, 0x25, 0x88, 0xc9, 0xac, 0x38,
+  0x25, 0x21, 0x00, 0x00, 0xff, 0xab, 0x48, 0x45, 0x81, 0xcb, 0xaa, 0x40,
+  0x34, 0x01, 0xda, 0xab, 0x20, 0x43, 0x01, 0xcb, 0x9c, 0x10, 0x33, 0x82,
+  0xbb, 0x8a, 0x63, 0x13, 0xa8, 0xad, 0x89, 0x43, 0x81, 0xba, 0x9c, 0x08,
+  0x53, 0x11, 0x98, 0x09, 0x53, 0xd1, 0xbf, 0x19, 0x90, 0xe5, 0x3f, 0x00,
+  0x54, 0x13, 0xc9, 0xbc, 0x18, 0x63, 0x12, 0xb8, 0xad, 0x09, 0x43, 0x02,
+  0xb9, 0xac, 0x28, 0x33, 0x02, 0xc9, 0x9b, 0x41, 0x24, 0xa0, 0xab, 0x88,
+  0x90, 0x1a, 0x33, 0xd8, 0x9f, 0x21, 0x14, 0x10, 0x88, 0x10, 0x63, 0xe0,
+  0xbe, 0x19, 0x54, 0x02, 0xc9, 0x9c, 0x18, 0x34, 0x13, 0xd9, 0xbb, 0x18,
+  0x43, 0x22, 0xd9, 0xab, 0x18, 0x32, 0x12, 0xba, 0x9d, 0x30, 0x35, 0x90,
+  0xbb, 0x19, 0x34, 0x23, 0xfc, 0xab, 0x20, 0x14, 0xa8, 0x9a, 0x20, 0x25,
+  0x43, 0xd1, 0xcf, 0x19, 0x63, 0x02, 0xc9, 0xab, 0x28, 0x53, 0x12, 0xb9,
+  0xad, 0x09, 0x43, 0x12, 0xb8, 0xbc, 0x19, 0x32, 0x25, 0xb8, 0xad, 0x29,
+  0x34, 0x82, 0xdb, 0x8a, 0x31, 0x32, 0x80, 0xcc, 0xaa, 0x28, 0x44, 0x91,
+  0xbb, 0x1a, 0x45, 0x33, 0xc1, 0xdf, 0x0a, 0x62, 0x12, 0xb8, 0xad, 0x08,
+  0x43, 0x13, 0xa8, 0xbd, 0x09, 0x32, 0x24, 0xa8, 0xbc, 0x8a, 0x32, 0x24,
+  0x90, 0xbd, 0x0a, 0x53, 0x13, 0xa8, 0xad, 0x28, 0x22, 0x82, 0xca, 0x9b,
+  0x18, 0x43, 0x82, 0xca, 0x1a, 0x55, 0x13, 0xfd, 0x9b, 0x51, 0x24, 0xa0,
+  0xad, 0x09, 0x33, 0x24, 0xb8, 0xcc, 0x09, 0x32, 0x13, 0xb8, 0xbd, 0x09,
+  0x22, 0x24, 0x90, 0xeb, 0x0a, 0x31, 0x24, 0x91, 0xac, 0x8a, 0x42, 0x03,
+  0xaa, 0xac, 0x09, 0x11, 0x01, 0xa9, 0x8a, 0x54, 0x24, 0x24, 0x91, 0xef,
+  0x9b, 0x51, 0x34, 0xa0, 0xbd, 0x8a, 0x53, 0x22, 0x90, 0xbc, 0x9b, 0x42,
+  0x24, 0x90, 0xcb, 0x8b, 0x21, 0x43, 0x81, 0xda, 0x9c, 0x30, 0x34, 0x81,
+  0xbc, 0x1b, 0x42, 0x13, 0xa9, 0xbc, 0x19, 0x22, 0x12, 0xb8, 0xad, 0x72,
+  0x14, 0xf9, 0x9d, 0x31, 0x43, 0xc0, 0xac, 0x20, 0x23, 0x84, 0xbb, 0x8a,
+  0x11, 0x21, 0x11, 0xa8, 0xbe, 0x8a, 0x42, 0x33, 0xb0, 0xbe, 0x19, 0x44,
+  0x4d, 0x15, 0x4d, 0x00, 0x12, 0xb8, 0xac, 0x30, 0x43, 0x82, 0xdc, 0x9b,
+  0x11, 0x22, 0xb8, 0x9b, 0x09, 0x32, 0x55, 0x23, 0x81, 0xec, 0xbc, 0x30,
+  0x36, 0x93, 0xdc, 0x9b, 0x41, 0x33, 0x91, 0xbc, 0x8c, 0x30, 0x33, 0x82,
+  0xdb, 0x9b, 0x20, 0x42, 0x12, 0xc9, 0xbc, 0x19, 0x53, 0x12, 0xc9, 0x9b,
+  0x21, 0x24, 0x01, 0xca, 0x9a, 0x28, 0x22, 0x90, 0xda, 0x0a, 0x64, 0x33,
+  0xf9, 0xbf, 0x20, 0x35, 0x91, 0xbd, 0x19, 0x43, 0x02, 0xb9, 0xab, 0x00,
+  0x22, 0x22, 0x91, 0xdd, 0xaa, 0x30, 0x43, 0x82, 0xfb, 0x0a, 0x31, 0x14,
+  0xa0, 0xab, 0x28, 0x43, 0x11, 0xb8, 0xbd, 0x18, 0x23, 0xdb, 0x9b, 0x1a,
+  0x14, 0x21, 0x22, 0x04, 0xff, 0x0b, 0x44, 0x23, 0xc8, 0xad, 0x28, 0x43,
+  0x01, 0xb9, 0xac, 0x09, 0x33, 0x13, 0xc8, 0xad, 0x09, 0x31, 0x33, 0x82,
+  0xda, 0x9c, 0x20, 0x34, 0x82, 0xcb, 0x8b, 0x21, 0x23, 0x90, 0xcc, 0x9b,
+  0x22, 0x22, 0xc0, 0xbb, 0x48, 0x46, 0x33, 0xe8, 0xbf, 0x29, 0x44, 0x13,
+  0xdb, 0x8c, 0x20, 0x24, 0x81, 0xca, 0x9a, 0x28, 0x32, 0x03, 0xc9, 0xbc,
+  0x09, 0x32, 0x24, 0xb1, 0xcd, 0x09, 0x33, 0x14, 0xa9, 0x9c, 0x20, 0x23,
+  0x81, 0xba, 0xad, 0x10, 0x12, 0x00, 0xda, 0x1a, 0x55, 0x13, 0xfb, 0xaf,
+  0x40, 0x24, 0xa8, 0x9e, 0x28, 0x23, 0x82, 0xba, 0x9b, 0x10, 0x21, 0x23,
+  0xa1, 0xce, 0xab, 0x30, 0x35, 0x82, 0xdc, 0x8a, 0x22, 0x33, 0x90, 0xab,
+  0x19, 0x43, 0x12, 0x90, 0xdb, 0x89, 0x10, 0x81, 0xfb, 0xaa, 0x18, 0x23,
+  0x21, 0xf8, 0xef, 0x28, 0x44, 0x82, 0xdb, 0x0a, 0x33, 0x23, 0x88, 0xbc,
+  0x8a, 0x11, 0x11, 0x01, 0xea, 0xac, 0x09, 0x32, 0x23, 0xa0, 0xdb, 0x0a,
+  0x52, 0x34, 0x82, 0xda, 0x8a, 0x33, 0x12, 0xb9, 0xbe, 0x88, 0x01, 0x98,
+  0x99, 0x0a, 0x08, 0x75, 0x29, 0xfc, 0x47, 0x00, 0x23, 0xf0, 0xae, 0x20,
+  0x35, 0x82, 0xcc, 0x8a, 0x42, 0x13, 0xa0, 0xcb, 0x99, 0x21, 0x22, 0x82,
+  0xdb, 0xab, 0x19, 0x34, 0x22, 0xa8, 0xad, 0x19, 0x52, 0x23, 0xb0, 0xbc,
+  0x18, 0x33, 0x81, 0xdb, 0x9a, 0x00, 0x00, 0xa8, 0xbd, 0x19, 0x67, 0x92,
+  0xed, 0x8a, 0x63, 0x23, 0xc9, 0x9c, 0x20, 0x24, 0x81, 0xb9, 0x9b, 0x19,
+  0x22, 0x13, 0xc0, 0xbd, 0x9b, 0x31, 0x34, 0x02, 0xda, 0xac, 0x20, 0x35,
+  0x14, 0xc9, 0x9b, 0x31, 0x33, 0xa0, 0xbd, 0x99, 0x10, 0x00, 0x99, 0x9b,
+  0x18, 0x74, 0x05, 0xfc, 0x8a, 0x52, 0x23, 0xd0, 0xab, 0x20, 0x34, 0x01,
+  0xc9, 0x9b, 0x18, 0x21, 0x13, 0xb8, 0xcc, 0xaa, 0x18, 0x54, 0x12, 0xda,
+  0x9b, 0x31, 0x35, 0x81, 0xcb, 0x0a, 0x32, 0x23, 0xc9, 0xbb, 0x88, 0x11,
+  0x90, 0x8a, 0x98, 0x9b, 0x45, 0x92, 0xff, 0x0d, 0x44, 0x12, 0xea, 0x8a,
+  0x32, 0x22, 0x80, 0xbb, 0x9b, 0x21, 0x23, 0x02, 0xfa, 0xbb, 0x8b, 0x32,
+  0x34, 0x92, 0xdc, 0x8b, 0x42, 0x25, 0x82, 0xdb, 0x19, 0x23, 0x02, 0xc9,
+  0xaa, 0x00, 0x89, 0x88, 0x88, 0xba, 0x2a, 0x77, 0x82, 0xcf, 0x09, 0x34,
+  0x04, 0xda, 0x8a, 0x31, 0x23, 0x82, 0xcb, 0x9b, 0x28, 0x33, 0x02, 0xba,
+  0xbe, 0x9b, 0x28, 0x36, 0x02, 0xea, 0x8b, 0x28, 0x44, 0x12, 0xca, 0x8b,
+  0x32, 0x23, 0xa0, 0xbb, 0xab, 0x18, 0x12, 0xa0, 0xab, 0xcb, 0x1a, 0x46,
+  0xd1, 0xef, 0x08, 0x44, 0x03, 0xea, 0x8a, 0x32, 0x23, 0x80, 0xcc, 0x89,
+  0x31, 0x21, 0x80, 0xdb, 0xab, 0x08, 0x22, 0x12, 0x90, 0xfa, 0x9b, 0x51,
+  0x34, 0x82, 0xdb, 0x09, 0x42, 0x12, 0xb8, 0xab, 0x09, 0x80, 0x89, 0x08,
+  0xc9, 0xab, 0x72, 0x27, 0xf9, 0x9b, 0x40, 0x34, 0xa2, 0xaf, 0x18, 0x22,
+  0x22, 0x98, 0xbc, 0x0a, 0x33, 0x12, 0x98, 0xcb, 0x8e, 0x01, 0x49, 0x00,
+  0xba, 0x9a, 0x52, 0x43, 0xa0, 0xbd, 0x8a, 0x62, 0x33, 0xb1, 0xad, 0x20,
+  0x33, 0x01, 0xb9, 0xcb, 0x09, 0x00, 0x80, 0x80, 0x9c, 0x19, 0x54, 0xf0,
+  0xbf, 0x20, 0x45, 0x81, 0xbc, 0x09, 0x33, 0x24, 0x90, 0xcc, 0x09, 0x22,
+  0x12, 0x90, 0xca, 0xba, 0x99, 0x21, 0x24, 0x82, 0xce, 0xaa, 0x41, 0x34,
+  0x82, 0xcb, 0x09, 0x43, 0x12, 0xa0, 0xa9, 0xaa, 0x89, 0x28, 0x11, 0xdb,
+  0xcc, 0x89, 0x64, 0x83, 0xde, 0x8a, 0x52, 0x24, 0xc8, 0xab, 0x30, 0x33,
+  0x13, 0xc9, 0xac, 0x28, 0x22, 0x01, 0xa9, 0xbb, 0xbb, 0xad, 0x30, 0x36,
+  0xa1, 0xbf, 0x08, 0x33, 0x24, 0xa1, 0xac, 0x20, 0x23, 0x83, 0x88, 0xca,
+  0xbb, 0x09, 0x12, 0xa0, 0xcd, 0x9b, 0x40, 0x37, 0xf9, 0xbc, 0x38, 0x37,
+  0x82, 0xcc, 0x09, 0x31, 0x33, 0x90, 0xcc, 0x0a, 0x21, 0x13, 0x80, 0xbb,
+  0xac, 0x9a, 0x28, 0x44, 0x92, 0xcd, 0x89, 0x30, 0x53, 0x12, 0xba, 0x0a,
+  0x42, 0x22, 0x80, 0xb8, 0xbd, 0x0a, 0x10, 0x01, 0xb9, 0xac, 0x8a, 0x74,
+  0x94, 0xdf, 0x0a, 0x62, 0x13, 0xd9, 0x9a, 0x21, 0x32, 0x13, 0xda, 0x9c,
+  0x21, 0x22, 0x90, 0x89, 0xa9, 0xdb, 0x0a, 0x22, 0x13, 0xb9, 0xbe, 0x8a,
+  0x62, 0x33, 0x90, 0xaa, 0x28, 0x33, 0x24, 0x02, 0xca, 0xac, 0x89, 0x10,
+  0x22, 0xd9, 0xad, 0x9b, 0x73, 0x15, 0xf9, 0x9c, 0x30, 0x44, 0x90, 0xac,
+  0x09, 0x22, 0x33, 0x82, 0xcc, 0x1a, 0x22, 0x98, 0x10, 0x13, 0xdc, 0x9c,
+  0x09, 0x11, 0x43, 0xb0, 0xbf, 0x19, 0x33, 0x22, 0xa0, 0xa9, 0x28, 0x43,
+  0x23, 0x91, 0xb9, 0xdc, 0x09, 0x33, 0x91, 0xcc, 0x99, 0x31, 0x46, 0xf1,
+  0xaf, 0x28, 0x34, 0xa2, 0xbc, 0x09, 0x21, 0x63, 0x82, 0xda, 0x19, 0x11,
+  0x80, 0x20, 0x91, 0xcb, 0xab, 0x88, 0x32, 0x25, 0xe9, 0xac, 0x28, 0x22,
+  0xbd, 0xe8, 0x48, 0x00, 0x21, 0x98, 0xaa, 0x28, 0x34, 0x12, 0x12, 0x98,
+  0xcb, 0x08, 0x22, 0x80, 0x8a, 0x89, 0x40, 0x47, 0xfd, 0x9e, 0x20, 0x24,
+  0x90, 0xbb, 0x09, 0x20, 0x45, 0x02, 0xb9, 0x0a, 0x11, 0x18, 0x32, 0xa3,
+  0xdd, 0xaa, 0x89, 0x30, 0x13, 0xfb, 0xac, 0x09, 0x21, 0x32, 0x81, 0xba,
+  0x29, 0x44, 0x33, 0x12, 0xb0, 0x9d, 0x10, 0x23, 0x00, 0x09, 0x58, 0x36,
+  0xf1, 0xcf, 0x09, 0x33, 0x01, 0xa8, 0xac, 0x09, 0x42, 0x24, 0x80, 0x98,
+  0x90, 0x9a, 0x41, 0x35, 0x82, 0xdc, 0xab, 0x29, 0x33, 0xa1, 0xcd, 0x9a,
+  0x88, 0x01, 0x20, 0x10, 0x82, 0xaa, 0x38, 0x46, 0x13, 0x80, 0xbb, 0x29,
+  0x12, 0x88, 0x43, 0x34, 0x77, 0xa1, 0xbe, 0x0a, 0x22, 0x22, 0xa1, 0xae,
+  0x19, 0x33, 0x81, 0x98, 0x08, 0x32, 0x03, 0xc8, 0x9b, 0x54, 0x92, 0xba,
+  0xad, 0x0b, 0x33, 0x01, 0xed, 0xaa, 0x09, 0x28, 0x11, 0xbb, 0x98, 0xab,
+  0x62, 0x03, 0x73, 0xd3, 0x0a, 0x24, 0x99, 0x40, 0xa4, 0x39, 0x14, 0x89,
+  0x31, 0xe8, 0xbf, 0x10, 0x24, 0xa0, 0x8a, 0x98, 0x08, 0x42, 0x83, 0xb9,
+  0x20, 0x12, 0x0a, 0x01, 0xac, 0x72, 0x82, 0xbc, 0xbb, 0x2b, 0x15, 0x99,
+  0x11, 0xcf, 0x0a, 0x80, 0x29, 0x84, 0xab, 0xba, 0x25, 0xa9, 0x31, 0x87,
+  0xab, 0x16, 0x48, 0xa1, 0x1a, 0x02, 0x91, 0x8f, 0x16, 0x89, 0xb9, 0x31,
+  0x80, 0x11, 0xa1, 0xcf, 0x48, 0x03, 0xa0, 0x0b, 0x81, 0x08, 0x24, 0xa0,
+  0x8c, 0x30, 0x11, 0xe9, 0xba, 0x6b, 0xa1, 0x0b, 0x9a, 0x18, 0x16, 0xc8,
+  0xa9, 0x9a, 0x34, 0x99, 0x49, 0x22, 0x48, 0xda, 0xca, 0x39, 0x05, 0x11,
+  0xdc, 0x10, 0x00, 0x00, 0x22, 0xc9, 0x1b, 0xc2, 0x71, 0x83, 0x0b, 0x34,
+  0xbc, 0x38, 0x17, 0x89, 0xac, 0x33, 0xa8, 0x00, 0xb0, 0xbb, 0x36, 0x20,
+  0xd1, 0x0c, 0x90, 0x19, 0x1e, 0xfd, 0x31, 0x00, 0x33, 0xea, 0x09, 0x31,
+  0x14, 0x9a, 0x98, 0x21, 0x9f, 0x83, 0x2a, 0xc0, 0x31, 0xcd, 0x29, 0x18,
+  0xb3, 0x8d, 0x21, 0xb8, 0x3c, 0x05, 0x98, 0x98, 0x10, 0x02, 0x20, 0x67,
+  0xaa, 0x11, 0x89, 0x93, 0x0c, 0x08, 0x34, 0x9a, 0xfa, 0x3d, 0x01, 0x42,
+  0xd9, 0x88, 0x9a, 0x35, 0x02, 0x99, 0x99, 0x89, 0x24, 0x23, 0xbc, 0x21,
+  0x0a, 0xa8, 0x1e, 0x82, 0x02, 0xaf, 0x06, 0x1b, 0xb0, 0x68, 0xb0, 0x89,
+  0x99, 0x91, 0x10, 0x02, 0x22, 0xeb, 0x41, 0xc0, 0x80, 0x10, 0x07, 0xca,
+  0x09, 0x33, 0xb9, 0x0a, 0x72, 0x91, 0xd9, 0x0c, 0x15, 0x88, 0x89, 0x12,
+  0x90, 0x11, 0x10, 0x83, 0x23, 0xee, 0xac, 0x63, 0x80, 0x99, 0x90, 0x09,
+  0x38, 0x53, 0xf9, 0x09, 0x08, 0x23, 0x90, 0xba, 0x51, 0x02, 0xb9, 0x41,
+  0x91, 0x8a, 0x59, 0x08, 0xcc, 0x30, 0xf8, 0x1c, 0x34, 0x80, 0xda, 0x19,
+  0x01, 0x12, 0x19, 0xbb, 0x41, 0x89, 0xa2, 0x5a, 0x32, 0xa2, 0xbd, 0x2a,
+  0x27, 0x98, 0xb9, 0x80, 0x0c, 0x03, 0x0f, 0xa0, 0x38, 0x86, 0x81, 0xea,
+  0x12, 0x18, 0x43, 0x80, 0xad, 0x99, 0x41, 0x82, 0x80, 0xf9, 0x9b, 0x32,
+  0x24, 0x90, 0xbc, 0x9b, 0x40, 0x15, 0x18, 0xd9, 0x0a, 0x32, 0x14, 0xa9,
+  0xca, 0x58, 0xa0, 0x18, 0xa1, 0xa0, 0x89, 0x02, 0x78, 0xa9, 0xc9, 0x19,
+  0xb0, 0x57, 0x90, 0xa8, 0x0d, 0x03, 0x34, 0xb9, 0x88, 0x9c, 0x14, 0x08,
+  0x81, 0x8b, 0xb4, 0x8e, 0x88, 0x53, 0xa8, 0x8b, 0x80, 0xa0, 0x8a, 0x33,
+  0xc3, 0x60, 0x82, 0xcc, 0x25, 0xa8, 0x22, 0xba, 0xfa, 0x22, 0x11, 0xd8,
+  0x8a, 0xb2, 0x28, 0x8a, 0x80, 0x73, 0xd3, 0x19, 0xb9, 0x71, 0x92, 0xa9,
+  0x1b, 0x25, 0xb1, 0x9c, 0x11, 0x41, 0x11, 0xa9, 0xde, 0x10, 0x11, 0x04,
+  0x98, 0xba, 0x19, 0x14, 0xc0, 0x68, 0x10, 0xca, 0xd8, 0xfd, 0x32, 0x00,
+  0x00, 0x80, 0x43, 0xb8, 0x09, 0xad, 0x13, 0x0a, 0x94, 0xac, 0x80, 0x35,
+  0x89, 0xa8, 0x4d, 0x18, 0xa0, 0xbc, 0x40, 0x83, 0x9c, 0x14, 0x93, 0x28,
+  0x08, 0x80, 0x08, 0x57, 0xab, 0xaf, 0x30, 0x83, 0x10, 0xc9, 0x8a, 0x30,
+  0x04, 0xae, 0x09, 0x23, 0x80, 0x89, 0x62, 0x01, 0x41, 0xcb, 0xb9, 0x4a,
+  0x15, 0x99, 0xd9, 0x19, 0x43, 0xd0, 0x80, 0x10, 0x22, 0x9f, 0x28, 0x11,
+  0xa3, 0x9c, 0x28, 0x01, 0xaa, 0x08, 0xb8, 0x70, 0xb4, 0xa9, 0x20, 0x85,
+  0xa9, 0xaa, 0x38, 0x08, 0x84, 0x3f, 0x84, 0x80, 0xd0, 0x99, 0x23, 0xaa,
+  0xa8, 0xac, 0x33, 0x08, 0x9f, 0x32, 0xb8, 0x9f, 0x19, 0x47, 0x80, 0xb9,
+  0x19, 0x04, 0x89, 0x13, 0xa9, 0x80, 0x20, 0x0b, 0x27, 0x0a, 0x08, 0xb8,
+  0x84, 0x24, 0xbb, 0xfb, 0x4a, 0xa3, 0x89, 0xb0, 0x30, 0xc8, 0x80, 0x04,
+  0x37, 0x20, 0xb2, 0xe0, 0x2a, 0x20, 0x38, 0xb8, 0xec, 0x8b, 0x87, 0x8b,
+  0x00, 0x31, 0xe2, 0x19, 0x38, 0x84, 0x09, 0x08, 0x28, 0x33, 0xcb, 0xb8,
+  0xc0, 0x08, 0x58, 0x83, 0x40, 0xb8, 0xcf, 0x11, 0x80, 0x95, 0x0e, 0x28,
+  0x93, 0x2a, 0x08, 0xa8, 0x08, 0x17, 0xa0, 0xaa, 0x20, 0x17, 0x08, 0x08,
+  0xbd, 0x12, 0x19, 0xe3, 0x89, 0xa2, 0x80, 0x3a, 0x37, 0x0a, 0x08, 0xab,
+  0x33, 0x03, 0x44, 0xe8, 0xaa, 0x80, 0x30, 0x03, 0xcc, 0xcd, 0x19, 0x16,
+  0x9a, 0x18, 0xa9, 0x85, 0x2b, 0x95, 0x8a, 0x82, 0x20, 0x38, 0xb2, 0xaf,
+  0x20, 0x24, 0xbc, 0x01, 0x82, 0xeb, 0x80, 0x42, 0xa0, 0x9f, 0x10, 0x52,
+  0x80, 0x81, 0x8c, 0x83, 0xa0, 0x20, 0x35, 0xc9, 0x0a, 0x28, 0x0a, 0xfb,
+  0x39, 0xa2, 0x08, 0xe8, 0xc0, 0x59, 0x93, 0x3a, 0xe8, 0x21, 0x08, 0x21,
+  0xbc, 0x28, 0x82, 0x23, 0x96, 0x0a, 0x8a, 0x30, 0x0c, 0xc3, 0x83, 0xce,
+  0xf4, 0xfd, 0x2e, 0x00, 0x89, 0x20, 0xd8, 0x30, 0x80, 0xb0, 0x73, 0x01,
+  0x48, 0xc2, 0x1b, 0x82, 0x32, 0xe8, 0x41, 0xf9, 0x88, 0x11, 0x01, 0x9c,
+  0x98, 0x59, 0x91, 0x89, 0x20, 0x21, 0xaa, 0xb2, 0x40, 0x83, 0x44, 0x9e,
+  0x91, 0x8a, 0x20, 0x3a, 0xf8, 0x4a, 0x28, 0x0a, 0xa8, 0x33, 0x3c, 0x08,
+  0x08, 0xbd, 0x73, 0x29, 0xb0, 0xba, 0x43, 0x8b, 0x34, 0x78, 0xc0, 0x2b,
+  0x0a, 0x08, 0x3b, 0xc3, 0xca, 0x80, 0x43, 0xb3, 0x8f, 0xa2, 0x52, 0xcb,
+  0x28, 0x01, 0xaa, 0x32, 0x43, 0xb3, 0xbc, 0x8b, 0x77, 0xaa, 0x10, 0xba,
+  0x21, 0x48, 0xc2, 0x2b, 0xc8, 0x48, 0x03, 0x2a, 0xb2, 0x8f, 0x31, 0x03,
+  0x8a, 0x83, 0x9e, 0x01, 0x22, 0xbf, 0xb1, 0x5b, 0xa4, 0x80, 0x99, 0x43,
+  0x08, 0xc8, 0x80, 0x44, 0xa1, 0xbb, 0x08, 0x88, 0x27, 0xb0, 0x1c, 0xc2,
+  0x30, 0x08, 0xba, 0x33, 0x8b, 0x07, 0xaa, 0x0a, 0x33, 0x37, 0xa9, 0xb0,
+  0x80, 0x84, 0x3b, 0xb4, 0x0b, 0xfc, 0x5b, 0x81, 0xb0, 0x98, 0x2a, 0x32,
+  0x83, 0x8f, 0x80, 0x35, 0xab, 0xa2, 0x6b, 0x83, 0x02, 0xaf, 0x12, 0x31,
+  0xb8, 0x5a, 0x98, 0x08, 0x0d, 0x01, 0x21, 0x9d, 0x91, 0x28, 0xea, 0x61,
+  0x88, 0x89, 0x12, 0x98, 0x8a, 0x20, 0x24, 0xf0, 0xc9, 0x80, 0x80, 0x04,
+  0x08, 0x82, 0xea, 0x48, 0xc9, 0x80, 0x10, 0xa2, 0x0a, 0x42, 0x38, 0xb7,
+  0x80, 0x38, 0xe2, 0x1d, 0x02, 0x88, 0xa0, 0x02, 0xad, 0x02, 0x22, 0xb2,
+  0xbf, 0x14, 0x19, 0x91, 0x72, 0xb9, 0xb9, 0x48, 0x01, 0x01, 0xd8, 0x8d,
+  0x11, 0x25, 0xa9, 0xbb, 0x32, 0xc2, 0x28, 0xb0, 0x63, 0xb1, 0x8a, 0x0a,
+  0x27, 0x19, 0xa0, 0x3d, 0xc0, 0x3b, 0x80, 0x50, 0xa9, 0x80, 0x38, 0xbb,
+  0x30, 0x37, 0x80, 0xfa, 0x30, 0x2a, 0x08, 0x08, 0x0f, 0x13, 0x98, 0x0d,
+  0x13, 0x80, 0xb0, 0x0e, 0x2d, 0xfe, 0x2c, 0x00, 0x48, 0x03, 0xaa, 0x83,
+  0xbe, 0x8c, 0x26, 0x12, 0xa9, 0x4a, 0x98, 0x10, 0x80, 0x02, 0xbb, 0xb8,
+  0x88, 0x27, 0x3b, 0x0f, 0x08, 0x28, 0xea, 0x50, 0x82, 0x99, 0x82, 0x98,
+  0x22, 0x80, 0xfb, 0x8c, 0x10, 0x24, 0x8c, 0xa0, 0xa0, 0x2a, 0x06, 0x8c,
+  0xc0, 0x32, 0x91, 0x82, 0xe8, 0x80, 0x20, 0x52, 0xfb, 0x22, 0x08, 0xb8,
+  0x39, 0x04, 0x28, 0xfa, 0x89, 0x10, 0x23, 0x2a, 0xea, 0x10, 0xa0, 0x82,
+  0x60, 0x91, 0x8c, 0x80, 0x80, 0x83, 0x7b, 0x14, 0xbb, 0x01, 0x8a, 0xb0,
+  0x06, 0x08, 0xad, 0x02, 0xa8, 0x3b, 0x43, 0x48, 0xeb, 0x98, 0x1c, 0x14,
+  0x32, 0x82, 0xbd, 0x80, 0x0d, 0x68, 0x12, 0xab, 0x81, 0x89, 0xa2, 0x33,
+  0x3c, 0xc3, 0xaf, 0x10, 0x94, 0x8b, 0x26, 0x98, 0x8a, 0x19, 0x80, 0x73,
+  0x12, 0xeb, 0x8a, 0x22, 0x01, 0xa9, 0x0a, 0x08, 0x3b, 0xf0, 0x88, 0x85,
+  0x14, 0xda, 0x09, 0x98, 0x80, 0x72, 0xc1, 0x88, 0x11, 0x13, 0x0a, 0xa8,
+  0x3a, 0x72, 0x99, 0xca, 0x39, 0x04, 0x08, 0x9f, 0x20, 0x01, 0x9c, 0x85,
+  0x0a, 0x98, 0x89, 0x22, 0x32, 0x83, 0xaf, 0x02, 0x58, 0x91, 0x28, 0xda,
+  0x08, 0xd8, 0x12, 0x82, 0x80, 0xbe, 0x01, 0x2a, 0x80, 0x73, 0xa0, 0x20,
+  0xa2, 0x08, 0x08, 0x04, 0x08, 0xd8, 0x48, 0xdf, 0x81, 0x21, 0x08, 0x01,
+  0xcb, 0x8c, 0x14, 0x89, 0x04, 0x8c, 0x00, 0xa8, 0x02, 0x86, 0x02, 0xea,
+  0x8a, 0x03, 0xa2, 0x0b, 0x83, 0x40, 0x97, 0x0c, 0x83, 0x49, 0xe1, 0x1a,
+  0x80, 0x01, 0x08, 0xa8, 0x33, 0xc8, 0x8a, 0x70, 0xcb, 0x43, 0x8b, 0x94,
+  0x4a, 0xb8, 0x40, 0x08, 0x08, 0x08, 0x08, 0x8f, 0x14, 0x89, 0xd0, 0x80,
+  0x89, 0x52, 0x80, 0xaa, 0xe0, 0x51, 0x10, 0x98, 0xa9, 0x22, 0x02, 0xb2,
+  0x8f, 0x22, 0x08, 0xe8, 0x28, 0xa0, 0x82, 0x80, 0xee, 0xff, 0x25, 0x00,
+  0x80, 0x80, 0x70, 0xb8, 0x97, 0x0a, 0x08, 0x08, 0x08, 0x3c, 0x80, 0x40,
+  0xc0, 0x78, 0x80, 0x80, 0x0a, 0x8b, 0x80, 0xb5, 0x43, 0xb8, 0xc0, 0x83,
+  0x0c, 0x6c, 0x82, 0x1c, 0x80, 0x3a, 0xb8, 0x80, 0x04, 0x08, 0x3c, 0x40,
+  0x80, 0x8c, 0x0c, 0x03, 0xb4, 0x08, 0xbd, 0x48, 0x08, 0xb4, 0x8f, 0x34,
+  0x9a, 0x82, 0x8a, 0x03, 0x03, 0xd8, 0x03, 0xbc, 0x48, 0x8b, 0xb4, 0x3b,
+  0xf0, 0x2c, 0x08, 0x20, 0x0b, 0xc3, 0x80, 0xd0, 0x73, 0x19, 0x80, 0x80,
+  0x0b, 0x03, 0x08, 0x08, 0x86, 0x9f, 0x8c, 0x10, 0x02, 0xa8, 0x3b, 0x8b,
+  0x74, 0xa0, 0x80, 0x80, 0x43, 0x3b, 0x48, 0x08, 0x84, 0x80, 0x04, 0xbc,
+  0x8b, 0x44, 0xbb, 0x80, 0xaf, 0x22, 0x08, 0xb2, 0x8b, 0xb5, 0x08, 0x78,
+  0x81, 0x23, 0xbb, 0x30, 0xd0, 0x80, 0x70, 0x00, 0xba, 0x30, 0x0c, 0x48,
+  0x08, 0x08, 0xed, 0xa9, 0x58, 0x21, 0x28, 0x8a, 0x80, 0xb4, 0x33, 0xcb,
+  0x33, 0xdb, 0x30, 0x08, 0x04, 0xc8, 0xc8, 0x43, 0x0b, 0xbc, 0x30, 0xb4,
+  0xaf, 0x22, 0x8a, 0x83, 0x03, 0xaf, 0x16, 0x19, 0x89, 0x80, 0x02, 0x0b,
+  0x08, 0x08, 0xf8, 0x89, 0x16, 0x29, 0x8a, 0xb0, 0x48, 0xb8, 0xcb, 0x33,
+  0x04, 0x0c, 0x33, 0x00, 0x88, 0x0e, 0x43, 0x0b, 0x03, 0xbd, 0xc8, 0x24,
+  0xc0, 0x80, 0xf0, 0x2a, 0xa8, 0x86, 0x2b, 0x03, 0x08, 0x38, 0x84, 0x9e,
+  0x01, 0x08, 0x02, 0x08, 0x8c, 0x80, 0x80, 0x80, 0xf0, 0x08, 0x84, 0x80,
+  0x80, 0x8d, 0x04, 0x08, 0x04, 0xc8, 0xbc, 0x30, 0x40, 0x40, 0x83, 0x8f,
+  0x0a, 0x02, 0xb8, 0x27, 0xa8, 0x0a, 0x02, 0x08, 0x84, 0x80, 0xd0, 0x0f,
+  0x13, 0x02, 0xe8, 0x09, 0x03, 0x8a, 0x8a, 0x03, 0x84, 0xfb, 0x6a, 0x88,
+  0x11, 0x08, 0xaa, 0xa2, 0x0f, 0x83, 0x10, 0x0a, 0x02, 0xbf, 0x12, 0x0a,
+  0x12, 0xfe, 0x29, 0x00, 0x55, 0xb9, 0x81, 0x01, 0xca, 0x48, 0x10, 0x24,
+  0xdc, 0x00, 0x10, 0x01, 0x98, 0xa8, 0x38, 0xcb, 0x33, 0x80, 0x00, 0x0e,
+  0x06, 0x28, 0xea, 0x4b, 0x94, 0x09, 0xba, 0x42, 0x28, 0x08, 0xba, 0xbb,
+  0x80, 0x40, 0x0c, 0x48, 0xbb, 0x6c, 0x80, 0x80, 0x33, 0xb8, 0xf3, 0x88,
+  0xb0, 0x83, 0x4b, 0xb7, 0x48, 0xa9, 0x00, 0x22, 0x08, 0x08, 0x08, 0xd8,
+  0x48, 0x07, 0x0a, 0x8a, 0x9f, 0x32, 0x08, 0x80, 0x08, 0xb0, 0xb8, 0x78,
+  0xa3, 0x8a, 0xc0, 0x33, 0x48, 0xc3, 0xfa, 0x01, 0x0a, 0x04, 0x8c, 0x84,
+  0xc0, 0x01, 0x28, 0x80, 0x02, 0xbb, 0xf3, 0x4a, 0x91, 0x28, 0x80, 0x03,
+  0xbc, 0x30, 0xb4, 0x4b, 0x08, 0x8f, 0x28, 0x02, 0x8e, 0x80, 0x80, 0x03,
+  0x48, 0x3b, 0x08, 0x80, 0x78, 0xeb, 0x21, 0x9c, 0x01, 0x22, 0x08, 0x08,
+  0x8f, 0x22, 0x88, 0x03, 0x0c, 0x83, 0xc0, 0x0c, 0x83, 0x77, 0x0a, 0xba,
+  0x82, 0x0f, 0x93, 0x48, 0x80, 0xb2, 0x2f, 0x90, 0x00, 0x18, 0x93, 0x1b,
+  0xe0, 0x00, 0x18, 0x92, 0x12, 0xb9, 0x80, 0x9f, 0x28, 0x22, 0x08, 0x83,
+  0x7b, 0xe9, 0x38, 0x2a, 0x01, 0x28, 0x80, 0x80, 0x0c, 0x08, 0x84, 0x4b,
+  0xc3, 0x3a, 0xbc, 0x80, 0x80, 0x80, 0x70, 0xb8, 0xcb, 0x33, 0x80, 0x05,
+  0x3c, 0x80, 0xc8, 0x80, 0x17, 0x2a, 0xe8, 0x8b, 0x44, 0xb8, 0x2b, 0x21,
+  0x20, 0xca, 0x1d, 0x44, 0xbb, 0x10, 0x80, 0x80, 0xb0, 0x48, 0x48, 0x83,
+  0xbf, 0x48, 0xa9, 0x42, 0xc9, 0x48, 0x08, 0x0a, 0xa2, 0x38, 0x30, 0x0c,
+  0x08, 0x84, 0xc0, 0x3c, 0x08, 0x80, 0x0d, 0x48, 0xb8, 0x7c, 0x08, 0x08,
+  0x02, 0x3b, 0xc3, 0x0e, 0x21, 0x8a, 0x83, 0x4b, 0xb8, 0x8f, 0x40, 0x21,
+  0xaa, 0x80, 0x80, 0x8b, 0x04, 0xb4, 0xc8, 0xcb, 0x03, 0x08, 0x08, 0x0f,
+  0x83, 0x43, 0xb8, 0x8b, 0xfd, 0xfd, 0x23, 0x00, 0x04, 0x58, 0x08, 0x3c,
+  0x80, 0xf0, 0x59, 0x9b, 0x2a, 0x82, 0x8a, 0x30, 0x80, 0xe0, 0x3b, 0x04,
+  0x88, 0x70, 0x81, 0xb0, 0x3b, 0x84, 0x40, 0x08, 0xc8, 0x30, 0x80, 0x35,
+  0x8b, 0x80, 0xe0, 0xc3, 0x0b, 0x84, 0xcb, 0x30, 0x84, 0xcb, 0xb3, 0x0c,
+  0x08, 0x34, 0xdb, 0x33, 0x08, 0x58, 0x83, 0x80, 0xcc, 0x3b, 0x04, 0x0c,
+  0x08, 0x08, 0x44, 0xc3, 0xba, 0x48, 0x0b, 0x48, 0xc0, 0x08, 0x80, 0xc8,
+  0x7c, 0x01, 0x08, 0x88, 0x80, 0xc0, 0x03, 0x0c, 0x48, 0x8b, 0x40, 0x8b,
+  0x40, 0xdb, 0x33, 0xb8, 0x08, 0x08, 0x36, 0x0c, 0xc3, 0x80, 0x4b, 0x48,
+  0xb8, 0x80, 0x3c, 0xb4, 0x8b, 0xb4, 0x08, 0x08, 0x78, 0x0b, 0x08, 0x3d,
+  0x03, 0xfc, 0x08, 0x80, 0x07, 0x3b, 0xb1, 0x8b, 0x0a, 0x08, 0x78, 0x91,
+  0x0c, 0x08, 0x01, 0x08, 0x0b, 0x48, 0x80, 0x07, 0xd0, 0x99, 0x41, 0x23,
+  0xc8, 0x82, 0xaa, 0x02, 0x48, 0xb3, 0xaf, 0x14, 0x89, 0x04, 0xec, 0x2a,
+  0x27, 0x9a, 0x88, 0x09, 0x01, 0x10, 0xbb, 0x43, 0xb8, 0x80, 0x0a, 0x45,
+  0xdb, 0x48, 0x80, 0x10, 0xda, 0x21, 0x10, 0xb1, 0xaa, 0x32, 0xc3, 0x30,
+  0xf3, 0x61, 0xb8, 0x98, 0x30, 0x80, 0xa0, 0xbb, 0x97, 0x28, 0x08, 0xa8,
+  0x8b, 0xcb, 0x78, 0x87, 0x8a, 0x19, 0x05, 0x8b, 0x93, 0x0d, 0x03, 0xb0,
+  0x29, 0x0a, 0xa4, 0x29, 0x52, 0xc9, 0x28, 0xf2, 0x2b, 0x06, 0x89, 0x29,
+  0xa1, 0x0f, 0x03, 0x98, 0x18, 0xb1, 0x29, 0x9c, 0x35, 0x9a, 0x08, 0xbc,
+  0x12, 0x07, 0x10, 0xb1, 0x9b, 0x01, 0xda, 0x61, 0xb1, 0x0a, 0x11, 0x94,
+  0x9f, 0x62, 0xb9, 0x00, 0x88, 0x21, 0x1c, 0x96, 0x0b, 0x02, 0x88, 0x0a,
+  0x83, 0x3f, 0xa3, 0x29, 0xa9, 0x81, 0xc9, 0x68, 0x12, 0xac, 0x13, 0x9d,
+  0x23, 0x80, 0x9c, 0x92, 0x50, 0xf9, 0x30, 0xb0, 0xec, 0xfd, 0x33, 0x00,
+  0x2a, 0x14, 0xb1, 0x08, 0xdb, 0x73, 0xd8, 0x28, 0x84, 0x9d, 0x11, 0x11,
+  0x08, 0xa9, 0x18, 0x1a, 0xc2, 0x1d, 0x26, 0xc9, 0x10, 0x00, 0xa9, 0x30,
+  0xa2, 0x9e, 0x46, 0xfa, 0x28, 0x03, 0xa9, 0x0a, 0x83, 0x8a, 0x21, 0xe0,
+  0x69, 0xa2, 0x9a, 0x20, 0x92, 0x8e, 0x23, 0xa8, 0xa9, 0x10, 0x39, 0x07,
+  0xb9, 0x0d, 0x34, 0xc1, 0x1c, 0x93, 0x0d, 0x03, 0x8b, 0x12, 0x80, 0x99,
+  0x34, 0xfa, 0x3c, 0x83, 0x8b, 0x10, 0xb9, 0x59, 0x26, 0xda, 0x00, 0x09,
+  0x04, 0x9c, 0x11, 0x08, 0x40, 0xc1, 0x19, 0xdb, 0x70, 0x93, 0xca, 0x19,
+  0x14, 0xa0, 0x09, 0x93, 0x8f, 0x12, 0x98, 0x09, 0x04, 0x9a, 0x20, 0xc2,
+  0x8f, 0x44, 0x99, 0x98, 0x18, 0x90, 0x19, 0x21, 0x88, 0x00, 0x2b, 0x27,
+  0xef, 0x28, 0x14, 0x99, 0x0a, 0x81, 0x2a, 0x94, 0x9a, 0x58, 0x85, 0xae,
+  0x32, 0x00, 0xa9, 0x2b, 0x82, 0x89, 0x02, 0xbb, 0x37, 0xac, 0x36, 0xac,
+  0x10, 0x29, 0xb8, 0x48, 0xa3, 0xcd, 0x50, 0x92, 0x19, 0xb9, 0x34, 0xc9,
+  0x18, 0x91, 0x39, 0xe0, 0x29, 0x18, 0x27, 0xda, 0x8b, 0x43, 0x90, 0x0a,
+  0x31, 0xc1, 0x18, 0xd8, 0x10, 0x99, 0x22, 0x31, 0xf0, 0x1e, 0x23, 0xa8,
+  0xab, 0x24, 0xa8, 0x20, 0xa0, 0xad, 0x64, 0xb0, 0x1b, 0x01, 0x80, 0x8a,
+  0x80, 0x49, 0x14, 0x80, 0xad, 0x01, 0xab, 0x56, 0x91, 0x9b, 0x11, 0xb8,
+  0x5a, 0x94, 0x9d, 0x32, 0xb0, 0x0b, 0x32, 0xa0, 0x28, 0xc2, 0xaf, 0x52,
+  0x90, 0x89, 0x21, 0x91, 0x09, 0x90, 0x9a, 0x52, 0xa3, 0x9e, 0x11, 0x89,
+  0x10, 0x01, 0x0a, 0x01, 0xdc, 0x08, 0x18, 0x33, 0x85, 0xcf, 0x49, 0x13,
+  0xba, 0x10, 0x01, 0x99, 0x26, 0xea, 0x08, 0x81, 0x8a, 0x91, 0x19, 0x14,
+  0x42, 0x92, 0x90, 0xbb, 0x73, 0x03, 0xcb, 0x99, 0x30, 0x33, 0x04, 0xd9,
+  0x0a, 0x0c, 0x37, 0x00, 0x39, 0xb8, 0xdb, 0x9c, 0xa9, 0xac, 0x48, 0xd8,
+  0x19, 0x33, 0x06, 0x20, 0x91, 0x8b, 0x47, 0x90, 0xcb, 0x20, 0x88, 0x22,
+  0xbc, 0xbb, 0x68, 0x23, 0x80, 0x0a, 0x83, 0x1b, 0xc1, 0x19, 0x66, 0x13,
+  0xb9, 0x1a, 0x11, 0x01, 0xfa, 0xbd, 0x98, 0x9a, 0xac, 0x89, 0x20, 0x26,
+  0x80, 0x88, 0x42, 0x43, 0x23, 0x98, 0x72, 0xc2, 0xbe, 0x09, 0x43, 0x82,
+  0xdb, 0x9a, 0x38, 0x33, 0x32, 0xa8, 0x58, 0x01, 0xb1, 0xbb, 0x73, 0x06,
+  0xd8, 0xab, 0x08, 0x11, 0xa8, 0x9a, 0x88, 0x98, 0x09, 0x52, 0x43, 0xa1,
+  0x29, 0x85, 0x12, 0x09, 0x12, 0x99, 0x66, 0xc0, 0xab, 0x0a, 0x80, 0x30,
+  0xf8, 0x8f, 0x28, 0x34, 0x00, 0x11, 0x90, 0x0b, 0x37, 0xa0, 0x99, 0x08,
+  0x19, 0xa0, 0xff, 0x09, 0x02, 0xa9, 0x89, 0x09, 0x11, 0x10, 0x42, 0x33,
+  0x99, 0x21, 0x34, 0xa1, 0xab, 0x0b, 0x76, 0x03, 0xba, 0xef, 0x89, 0x22,
+  0xb1, 0xad, 0x31, 0x34, 0x12, 0xa8, 0x39, 0x35, 0x80, 0x9a, 0x90, 0xa9,
+  0xbd, 0xbb, 0xbc, 0xae, 0x20, 0x23, 0xc9, 0x8b, 0x54, 0x33, 0x03, 0x80,
+  0x89, 0x08, 0x08, 0xfa, 0x99, 0x9a, 0x10, 0x63, 0x26, 0xc1, 0xbe, 0xa9,
+  0xab, 0x4a, 0x37, 0x11, 0x81, 0x88, 0x09, 0x31, 0x25, 0x12, 0xc9, 0xbe,
+  0xaa, 0x19, 0x81, 0x89, 0xa8, 0xcc, 0x8b, 0x31, 0x64, 0x33, 0x02, 0x98,
+  0x88, 0x18, 0x00, 0x90, 0xdb, 0xcd, 0x8a, 0x30, 0x44, 0x55, 0xa2, 0xdf,
+  0x9a, 0x40, 0x12, 0x02, 0xab, 0x00, 0x10, 0x22, 0x33, 0x43, 0xc0, 0xce,
+  0x9a, 0x00, 0x10, 0x81, 0xa9, 0xbb, 0xac, 0x51, 0x34, 0x22, 0x90, 0x8a,
+  0x30, 0x13, 0x88, 0xa8, 0xd9, 0xbe, 0x09, 0x11, 0x11, 0x77, 0x03, 0xdf,
+  0x9a, 0x41, 0x12, 0x81, 0x99, 0x99, 0x20, 0x02, 0x22, 0x25, 0xb8, 0xaf,
+  0x9a, 0x08, 0x23, 0x90, 0xa4, 0xfd, 0x43, 0x00, 0xca, 0x99, 0xa9, 0x29,
+  0x57, 0x13, 0xa8, 0x9c, 0x30, 0x23, 0x90, 0xa9, 0xca, 0xab, 0x30, 0x12,
+  0x62, 0x46, 0xd1, 0xbf, 0x1a, 0x24, 0x22, 0xb9, 0xa9, 0x1a, 0x43, 0x02,
+  0x31, 0x84, 0xdd, 0x9a, 0x08, 0x31, 0x03, 0xdb, 0x9b, 0x00, 0x18, 0x43,
+  0x44, 0xa1, 0xbb, 0x19, 0x44, 0x02, 0xb8, 0xbb, 0xab, 0x10, 0x34, 0x22,
+  0x57, 0xc1, 0xdf, 0x09, 0x33, 0x23, 0xcb, 0x89, 0x89, 0x32, 0x14, 0x10,
+  0x03, 0xfc, 0x9b, 0x10, 0x32, 0x01, 0xca, 0xac, 0x08, 0x21, 0x53, 0x22,
+  0xc9, 0xab, 0x30, 0x24, 0x02, 0xba, 0xca, 0xab, 0x30, 0x16, 0x01, 0x52,
+  0x93, 0xff, 0x8c, 0x32, 0x43, 0xd8, 0x8a, 0x08, 0x20, 0x42, 0x81, 0x99,
+  0xb9, 0xcb, 0x48, 0x33, 0x81, 0xbc, 0xac, 0x28, 0x43, 0x12, 0x88, 0xba,
+  0x8a, 0x31, 0x24, 0x82, 0xc9, 0x9c, 0x99, 0x28, 0x46, 0x34, 0xd2, 0xef,
+  0x09, 0x32, 0x23, 0xea, 0x8a, 0x10, 0x11, 0x31, 0x01, 0xb9, 0xba, 0xac,
+  0x28, 0x36, 0x82, 0xeb, 0xab, 0x30, 0x43, 0x02, 0xaa, 0x8a, 0x18, 0x98,
+  0x38, 0x34, 0x82, 0xcc, 0xcb, 0x48, 0x34, 0x43, 0xa3, 0xff, 0x8b, 0x40,
+  0x24, 0xa0, 0xad, 0x08, 0x12, 0x22, 0x12, 0xc9, 0xbb, 0x88, 0x10, 0x43,
+  0x15, 0xda, 0xbb, 0x28, 0x34, 0x02, 0xa8, 0xab, 0x89, 0x10, 0x11, 0x53,
+  0x83, 0xc9, 0xcc, 0x19, 0x54, 0x24, 0xb1, 0xdf, 0x0a, 0x41, 0x23, 0xc8,
+  0xac, 0x10, 0x11, 0x23, 0x02, 0xcb, 0x9b, 0x00, 0x08, 0x51, 0x33, 0xf9,
+  0xac, 0x19, 0x24, 0x12, 0xb8, 0xab, 0x08, 0x22, 0x33, 0xa1, 0xbd, 0x89,
+  0x11, 0x00, 0x64, 0x44, 0xf8, 0x9e, 0x28, 0x33, 0x82, 0xcd, 0x89, 0x21,
+  0x32, 0x12, 0xc9, 0x9d, 0x18, 0x01, 0x11, 0x12, 0xe8, 0xcb, 0x19, 0x43,
+  0x22, 0xc8, 0xab, 0x18, 0x11, 0x22, 0x01, 0x98, 0x01, 0x11, 0x42, 0x00,
+  0xbb, 0x9b, 0x30, 0x47, 0x25, 0xb0, 0xff, 0x09, 0x31, 0x14, 0xc8, 0xab,
+  0x18, 0x33, 0x33, 0xa0, 0xbe, 0x0a, 0x21, 0x12, 0x33, 0xb0, 0xcf, 0x8b,
+  0x32, 0x24, 0x91, 0xad, 0x0a, 0x21, 0x22, 0x80, 0xaa, 0x0a, 0x21, 0x11,
+  0x30, 0x57, 0xd1, 0xbf, 0x19, 0x44, 0x12, 0xda, 0x9a, 0x18, 0x32, 0x24,
+  0xa8, 0xbd, 0x09, 0x33, 0x12, 0x88, 0x98, 0xcd, 0x8a, 0x42, 0x33, 0xa0,
+  0xbd, 0x8a, 0x42, 0x22, 0xa0, 0xbb, 0x0a, 0x53, 0x03, 0xb8, 0x88, 0x54,
+  0x03, 0xfe, 0x9a, 0x41, 0x24, 0xb1, 0xad, 0x0a, 0x32, 0x34, 0x90, 0xdc,
+  0x89, 0x31, 0x13, 0x90, 0x9a, 0xba, 0x9b, 0x72, 0x33, 0xa0, 0xbd, 0x8a,
+  0x31, 0x25, 0x90, 0xbb, 0x8b, 0x32, 0x24, 0x88, 0x30, 0x14, 0xff, 0x9b,
+  0x52, 0x33, 0xa8, 0xad, 0x89, 0x20, 0x35, 0x82, 0xdc, 0x8a, 0x22, 0x22,
+  0x80, 0xa9, 0xba, 0x9a, 0x42, 0x34, 0x91, 0xdc, 0x9a, 0x21, 0x33, 0x81,
+  0xc9, 0xab, 0x18, 0x53, 0x11, 0x80, 0x10, 0xf8, 0xbe, 0x38, 0x46, 0x81,
+  0xca, 0x8b, 0x28, 0x53, 0x13, 0xea, 0xab, 0x20, 0x43, 0x82, 0xc9, 0x9b,
+  0x20, 0x21, 0x11, 0x80, 0xda, 0xbb, 0x20, 0x43, 0x13, 0xc8, 0xbc, 0x09,
+  0x53, 0x22, 0x99, 0x9c, 0x18, 0x21, 0x91, 0xae, 0x49, 0x34, 0xa2, 0xbc,
+  0x8b, 0x21, 0x35, 0x03, 0xdc, 0x9c, 0x11, 0x33, 0x02, 0xea, 0x9b, 0x20,
+  0x42, 0x12, 0xba, 0xab, 0x1a, 0x21, 0x11, 0x02, 0xdb, 0xad, 0x2a, 0x44,
+  0x11, 0xb9, 0x9b, 0x14, 0xaa, 0x49, 0x37, 0x92, 0xdf, 0x19, 0x33, 0x81,
+  0x99, 0xbb, 0x89, 0x71, 0x14, 0xb9, 0xac, 0x11, 0x21, 0x22, 0xa9, 0xbb,
+  0x10, 0x24, 0x23, 0xb8, 0xcd, 0x9b, 0x63, 0x03, 0x89, 0xfa, 0x09, 0x13,
+  0x82, 0x80, 0x98, 0x01, 0xaf, 0x11, 0xaf, 0x32, 0x80, 0x33, 0xa0, 0xaf,
+  0x94, 0xf4, 0x3c, 0x00, 0xba, 0x71, 0x05, 0x99, 0xa9, 0x8a, 0x43, 0x12,
+  0x89, 0xc9, 0x8a, 0x43, 0x12, 0x81, 0xb9, 0xcb, 0x0a, 0x34, 0x34, 0xb9,
+  0xbd, 0x8a, 0x63, 0x24, 0xb0, 0xbf, 0x29, 0x14, 0x81, 0xcb, 0x10, 0x12,
+  0xba, 0x9b, 0x46, 0x91, 0xab, 0x32, 0xe8, 0x9c, 0x72, 0x13, 0xca, 0x8b,
+  0x31, 0x12, 0x99, 0x00, 0xb9, 0x0a, 0x40, 0x15, 0xa8, 0x9a, 0x18, 0x14,
+  0x09, 0x28, 0xa0, 0xbd, 0x38, 0x57, 0xa9, 0x8a, 0x12, 0x21, 0xb8, 0xaf,
+  0x25, 0x90, 0xbd, 0x38, 0x37, 0xa8, 0xae, 0x29, 0x32, 0x11, 0x90, 0xda,
+  0xad, 0x50, 0x24, 0xa0, 0xbb, 0x0a, 0x43, 0x13, 0xa0, 0xbe, 0x29, 0x34,
+  0x81, 0xca, 0x89, 0x01, 0x11, 0x02, 0xc8, 0x8a, 0x01, 0x11, 0x43, 0xd8,
+  0xbc, 0x48, 0x34, 0x91, 0xbd, 0x08, 0x31, 0x12, 0x88, 0xee, 0x09, 0x53,
+  0x01, 0xda, 0x8a, 0x32, 0x01, 0x08, 0xa9, 0x9c, 0x32, 0x14, 0xca, 0x1a,
+  0x26, 0xb8, 0x9b, 0x42, 0x80, 0x09, 0x88, 0x0a, 0x90, 0x72, 0x91, 0xad,
+  0x28, 0x13, 0x9a, 0x99, 0x38, 0x84, 0xb9, 0x0a, 0x64, 0x92, 0x99, 0xa9,
+  0x80, 0x8c, 0x02, 0x08, 0xb8, 0x48, 0xfb, 0xab, 0x42, 0x84, 0x89, 0xd9,
+  0x0d, 0x21, 0x28, 0x9a, 0xa8, 0x80, 0x33, 0x80, 0xd0, 0x8b, 0x40, 0x07,
+  0x9c, 0x0a, 0x22, 0x27, 0xf9, 0x9a, 0x33, 0x03, 0xe0, 0x9c, 0x30, 0x02,
+  0x88, 0x08, 0x98, 0x08, 0x28, 0x00, 0xcb, 0x3a, 0x83, 0xd0, 0x4b, 0x02,
+  0x08, 0xaf, 0x28, 0x35, 0xa2, 0x3a, 0xbb, 0x0f, 0x33, 0xa0, 0x9d, 0x08,
+  0x08, 0xb8, 0x80, 0x34, 0x84, 0xb4, 0xf0, 0x8b, 0x36, 0xa1, 0x8d, 0x28,
+  0x01, 0xba, 0x20, 0x24, 0x01, 0xa8, 0xfb, 0x9b, 0x41, 0x84, 0xb1, 0x8b,
+  0x22, 0x83, 0x30, 0x0c, 0xbc, 0x24, 0x03, 0xaf, 0x0c, 0x28, 0x82, 0xb0,
+  0xb0, 0x43, 0x73, 0xa2, 0xe7, 0xfc, 0x2b, 0x00, 0xca, 0x3c, 0x43, 0x93,
+  0xdc, 0x0a, 0x32, 0x98, 0xa9, 0x5a, 0x23, 0x01, 0xdf, 0x18, 0x02, 0x12,
+  0xb9, 0x89, 0x80, 0x26, 0x80, 0x80, 0xa0, 0x08, 0x08, 0x8c, 0x80, 0x80,
+  0xf0, 0x3a, 0x73, 0x23, 0xa2, 0xea, 0x0b, 0x03, 0x04, 0x21, 0xda, 0xbc,
+  0x30, 0x44, 0x11, 0x08, 0xca, 0xbc, 0x3b, 0x37, 0x11, 0xeb, 0x99, 0x01,
+  0x14, 0x88, 0x01, 0x28, 0xca, 0x28, 0x82, 0xba, 0x00, 0x03, 0xbd, 0x30,
+  0x27, 0x02, 0xad, 0x89, 0x20, 0x16, 0x01, 0xca, 0xaa, 0x00, 0x88, 0x17,
+  0x80, 0x20, 0x08, 0x9e, 0x8a, 0x35, 0x23, 0xdc, 0x89, 0x31, 0xa2, 0x80,
+  0x0d, 0x45, 0xc1, 0x99, 0x08, 0x28, 0x2a, 0xc8, 0x9a, 0x52, 0x21, 0xc8,
+  0x9c, 0x21, 0x22, 0x82, 0x30, 0x0c, 0x9f, 0x28, 0x14, 0xa0, 0x22, 0xba,
+  0xcb, 0x73, 0x28, 0xaa, 0xa0, 0xbb, 0xbb, 0x27, 0x22, 0xab, 0x9e, 0x21,
+  0x82, 0x30, 0x83, 0xfc, 0x89, 0xab, 0x35, 0x25, 0xb1, 0x9c, 0x0b, 0x21,
+  0x51, 0x01, 0xaa, 0x0a, 0xbb, 0x80, 0x27, 0x02, 0xa8, 0xcf, 0x39, 0x12,
+  0xa2, 0xca, 0x80, 0x0d, 0x48, 0x21, 0x01, 0x9d, 0x0a, 0x42, 0x20, 0x01,
+  0xbe, 0x89, 0xa0, 0x15, 0x22, 0xa8, 0x20, 0xfb, 0x21, 0x28, 0x80, 0xca,
+  0xfa, 0x19, 0x24, 0x80, 0x89, 0x3a, 0xb8, 0x30, 0x44, 0x02, 0xdc, 0x2a,
+  0x80, 0x83, 0x80, 0x0c, 0x08, 0x84, 0x80, 0xcc, 0x8b, 0x74, 0x08, 0x9a,
+  0x0d, 0x68, 0x01, 0x80, 0xb9, 0x08, 0x38, 0x0b, 0x88, 0xf0, 0x09, 0x08,
+  0x80, 0x48, 0x24, 0x80, 0xcb, 0x0c, 0x33, 0x03, 0xf4, 0xab, 0x10, 0x26,
+  0xa2, 0xa0, 0x8a, 0x80, 0x30, 0x00, 0x08, 0x0f, 0x08, 0xbc, 0x0b, 0x67,
+  0xb0, 0x90, 0x01, 0x91, 0xa8, 0x02, 0x08, 0x8f, 0xa8, 0x02, 0x08, 0x80,
+  0x40, 0xbc, 0x84, 0x0b, 0x03, 0x50, 0xf8, 0x8a, 0xcb, 0xfb, 0x2a, 0x00,
+  0x20, 0x63, 0x91, 0x8c, 0x22, 0xba, 0x80, 0x30, 0xb5, 0xfb, 0x10, 0x0a,
+  0x02, 0x08, 0xc8, 0x03, 0x03, 0xd8, 0x30, 0x40, 0x84, 0x9f, 0x01, 0xa2,
+  0x08, 0x08, 0xc8, 0xfb, 0x08, 0x21, 0x00, 0x02, 0xc8, 0xf0, 0x21, 0x21,
+  0xb0, 0x8a, 0x8f, 0x82, 0xa2, 0x80, 0xb3, 0x3c, 0x80, 0x8c, 0x80, 0x80,
+  0x36, 0xc0, 0x08, 0x8c, 0x34, 0xb3, 0x88, 0x00, 0x78, 0x83, 0x80, 0x80,
+  0x8d, 0x3c, 0xc0, 0x80, 0x34, 0xcb, 0x08, 0x34, 0xc8, 0x30, 0xc0, 0x08,
+  0x0d, 0x83, 0x40, 0x80, 0xd0, 0x48, 0x48, 0x0b, 0x0c, 0x3b, 0x80, 0x50,
+  0x08, 0xc8, 0x0c, 0x43, 0x08, 0xc8, 0x80, 0x74, 0x08, 0x98, 0xba, 0xb3,
+  0x30, 0x40, 0xb4, 0xcb, 0x0b, 0xbc, 0x77, 0x15, 0xb0, 0xad, 0x1a, 0x53,
+  0x81, 0x99, 0xca, 0x29, 0x15, 0x89, 0x02, 0xbb, 0x40, 0x02, 0xdb, 0x09,
+  0x53, 0x02, 0xda, 0x9b, 0x41, 0x14, 0x81, 0xb9, 0xae, 0x88, 0x63, 0x82,
+  0xaa, 0x88, 0x08, 0x11, 0x8a, 0x05, 0x90, 0xda, 0x38, 0x34, 0xa1, 0xbf,
+  0x20, 0x35, 0x91, 0xeb, 0x8a, 0x21, 0x12, 0x25, 0xf8, 0x9c, 0x10, 0x43,
+  0x01, 0xba, 0xbb, 0x29, 0x46, 0x12, 0xc9, 0xbc, 0x20, 0x25, 0x91, 0xba,
+  0x8a, 0x11, 0x13, 0x91, 0xa8, 0xac, 0x70, 0xa0, 0x1a, 0xd8, 0x69, 0x05,
+  0x98, 0xb9, 0x0a, 0x35, 0x81, 0xaa, 0xad, 0x30, 0x82, 0x20, 0xa3, 0xba,
+  0x9b, 0xbc, 0x75, 0x16, 0xd9, 0x9b, 0x31, 0x24, 0x90, 0xcb, 0x1a, 0x33,
+  0x12, 0xc8, 0xae, 0x28, 0x24, 0x81, 0xbb, 0xac, 0x32, 0x02, 0x40, 0x90,
+  0xba, 0x9f, 0x63, 0x03, 0xda, 0x0a, 0x21, 0x01, 0xa8, 0x89, 0x11, 0xca,
+  0x4a, 0x05, 0x99, 0x8a, 0x99, 0x31, 0x13, 0x91, 0x9f, 0x28, 0x23, 0x24,
+  0xfb, 0x8a, 0xc8, 0x70, 0x16, 0xa8, 0xcb, 0x89, 0x53, 0x02, 0xaa, 0x09,
+  0xaf, 0xfe, 0x41, 0x00, 0x99, 0x19, 0x34, 0x10, 0xa8, 0xbd, 0x19, 0x53,
+  0x90, 0x0a, 0xb0, 0x8b, 0x36, 0xa0, 0x99, 0xa8, 0x63, 0x02, 0xa0, 0xcb,
+  0x39, 0x35, 0x91, 0xda, 0x9c, 0x10, 0x12, 0x11, 0x02, 0xea, 0xbd, 0x49,
+  0x34, 0x81, 0xcc, 0x09, 0x04, 0x18, 0x25, 0xb9, 0x9c, 0x41, 0xa1, 0x9b,
+  0x22, 0x08, 0xf8, 0x0b, 0x34, 0xb9, 0x3a, 0x26, 0xf9, 0x8d, 0x62, 0x01,
+  0xaa, 0x8a, 0x20, 0x23, 0xa1, 0xaa, 0xab, 0x3a, 0x57, 0x91, 0xba, 0x8a,
+  0x33, 0x12, 0x98, 0xba, 0xad, 0x18, 0x43, 0x02, 0xa8, 0xac, 0x08, 0x01,
+  0x26, 0xb1, 0xbe, 0x9b, 0x73, 0x14, 0xb8, 0x9b, 0x51, 0x83, 0xed, 0x29,
+  0x25, 0xa8, 0x8c, 0x10, 0x08, 0x32, 0x81, 0xcb, 0x9c, 0x41, 0x24, 0x98,
+  0xac, 0x09, 0x22, 0x01, 0x01, 0xb9, 0x9d, 0x80, 0x30, 0x35, 0xa1, 0xdc,
+  0x9a, 0x38, 0x34, 0x81, 0xa9, 0xdb, 0x1b, 0x45, 0x12, 0x80, 0xfe, 0x8d,
+  0x43, 0x02, 0xa9, 0x9a, 0x8a, 0x53, 0x12, 0x81, 0xda, 0x9b, 0x42, 0x23,
+  0x80, 0xbb, 0x89, 0x98, 0x31, 0x83, 0xa9, 0xcf, 0x8a, 0x21, 0x11, 0x21,
+  0x89, 0xac, 0x08, 0x30, 0x22, 0x80, 0x51, 0x67, 0xf8, 0xae, 0x40, 0x14,
+  0x90, 0xaa, 0x9a, 0x30, 0x33, 0x14, 0xd8, 0xac, 0x20, 0x22, 0x01, 0x80,
+  0xa9, 0xc9, 0x9b, 0x42, 0x15, 0xa8, 0xbc, 0x9a, 0x11, 0x34, 0x12, 0x98,
+  0xba, 0xca, 0x19, 0x55, 0x33, 0x11, 0xf8, 0xef, 0x28, 0x43, 0x80, 0xa9,
+  0xab, 0x28, 0x33, 0x14, 0xa0, 0xbb, 0x8b, 0x11, 0x32, 0x54, 0x81, 0xcb,
+  0xbc, 0x19, 0x43, 0x03, 0xc9, 0xcb, 0x89, 0x30, 0x33, 0x23, 0x82, 0xeb,
+  0xad, 0x28, 0x53, 0x23, 0x01, 0xfc, 0xcf, 0x41, 0x13, 0xa0, 0xaa, 0x8b,
+  0x31, 0x33, 0x82, 0xb8, 0xab, 0x18, 0xa0, 0x3a, 0x37, 0x12, 0xfa, 0xac,
+  0x18, 0x22, 0x01, 0xb9, 0x98, 0xfc, 0x3e, 0x00, 0xab, 0x8a, 0x30, 0x45,
+  0x23, 0x81, 0xec, 0x8a, 0x41, 0x42, 0x23, 0xfa, 0xcf, 0x40, 0x12, 0x90,
+  0xaa, 0x89, 0x21, 0x22, 0x80, 0x08, 0x08, 0x08, 0xfa, 0x2a, 0x34, 0x92,
+  0xda, 0xac, 0x28, 0x01, 0x88, 0x08, 0x80, 0xa9, 0x9a, 0x63, 0x43, 0x22,
+  0xc8, 0xbc, 0x30, 0x36, 0x84, 0xfe, 0x0b, 0x52, 0x02, 0xa9, 0x9a, 0x18,
+  0x22, 0x02, 0x99, 0x10, 0x02, 0xb8, 0xcd, 0x28, 0x26, 0xa1, 0xdb, 0x8a,
+  0x10, 0x80, 0x90, 0x10, 0x00, 0xb9, 0x08, 0x44, 0x35, 0x02, 0xeb, 0x8a,
+  0x28, 0x45, 0x14, 0xfb, 0xaf, 0x32, 0x14, 0xb9, 0x9a, 0x10, 0x11, 0x21,
+  0xa8, 0x38, 0x14, 0xc9, 0xbb, 0x09, 0x55, 0x81, 0xca, 0x9a, 0x18, 0x81,
+  0xa9, 0x09, 0x34, 0x82, 0xcb, 0x19, 0x55, 0x04, 0xa9, 0x9a, 0x20, 0x82,
+  0x38, 0x37, 0xe2, 0xef, 0x18, 0x33, 0x82, 0xae, 0x18, 0x00, 0x10, 0x02,
+  0x99, 0x21, 0x83, 0xdd, 0x09, 0x22, 0x12, 0xb9, 0xad, 0x08, 0x11, 0x98,
+  0x9a, 0x31, 0x43, 0xa0, 0xad, 0x52, 0x14, 0xb0, 0x9c, 0x42, 0x02, 0xca,
+  0x28, 0x36, 0xf1, 0xae, 0x28, 0x25, 0xa1, 0x9d, 0x18, 0x01, 0x10, 0x01,
+  0x99, 0x40, 0x92, 0xcd, 0x19, 0x24, 0x81, 0xca, 0x99, 0x10, 0x00, 0x98,
+  0x08, 0x22, 0x81, 0xbb, 0x18, 0x55, 0x13, 0x98, 0xad, 0x20, 0x01, 0x90,
+  0x71, 0x15, 0xfb, 0x9f, 0x30, 0x24, 0xc8, 0x9a, 0x11, 0x00, 0x28, 0x01,
+  0x0a, 0x43, 0xc0, 0xaf, 0x21, 0x22, 0x98, 0xab, 0x8a, 0x20, 0x00, 0xc9,
+  0x28, 0x34, 0x90, 0x9a, 0x20, 0x34, 0x03, 0xac, 0x88, 0x42, 0xb0, 0xad,
+  0x73, 0x07, 0xdc, 0x9b, 0x62, 0x13, 0xc9, 0x8b, 0x21, 0x00, 0x10, 0x00,
+  0x08, 0x24, 0xe9, 0xac, 0x41, 0x22, 0xb8, 0xbb, 0x0a, 0x32, 0x90, 0x9a,
+  0x32, 0x92, 0xc9, 0x2a, 0x45, 0x23, 0x01, 0xcb, 0x6f, 0x10, 0x40, 0x00,
+  0x89, 0x00, 0x90, 0x19, 0x55, 0x14, 0xfe, 0x8e, 0x30, 0x15, 0xa9, 0x8b,
+  0x01, 0x10, 0x20, 0x90, 0x48, 0x15, 0xea, 0x8b, 0x32, 0x02, 0x88, 0xcb,
+  0x8b, 0x22, 0xb1, 0x8c, 0x31, 0x82, 0xba, 0x38, 0x34, 0x23, 0x22, 0xc0,
+  0x8c, 0x82, 0x8b, 0x30, 0x44, 0x24, 0xfb, 0xff, 0x1a, 0x34, 0x91, 0xac,
+  0x18, 0x12, 0x98, 0x10, 0x22, 0x23, 0xd0, 0xaf, 0x28, 0x24, 0x90, 0xbb,
+  0x0a, 0x11, 0xa8, 0x8a, 0x42, 0x83, 0xbd, 0x19, 0x43, 0x23, 0x88, 0x12,
+  0xb8, 0x89, 0x09, 0x25, 0x33, 0x03, 0xff, 0xdf, 0x38, 0x24, 0xa8, 0x8b,
+  0x10, 0x81, 0x08, 0x00, 0x42, 0x34, 0xf8, 0x9c, 0x22, 0x02, 0x89, 0x98,
+  0xca, 0x20, 0xb1, 0x8c, 0x43, 0x98, 0x9c, 0x18, 0x31, 0x24, 0x91, 0x08,
+  0x90, 0x0b, 0x00, 0x61, 0x33, 0x80, 0xeb, 0xff, 0x0b, 0x35, 0x82, 0xbb,
+  0x09, 0x11, 0x90, 0x19, 0x44, 0x11, 0x91, 0xce, 0x19, 0x43, 0x91, 0x99,
+  0x89, 0x99, 0x09, 0x9a, 0x61, 0x12, 0xcb, 0xac, 0x30, 0x22, 0x22, 0x01,
+  0x98, 0xab, 0x18, 0x54, 0x10, 0x44, 0xa2, 0xff, 0x9d, 0x52, 0x01, 0xa9,
+  0x08, 0x00, 0x88, 0x88, 0x20, 0x43, 0x03, 0xdd, 0x0a, 0x32, 0x91, 0x18,
+  0xa0, 0x8a, 0xb8, 0xbe, 0x40, 0x14, 0xb8, 0xab, 0x19, 0x22, 0x21, 0x42,
+  0x03, 0xba, 0xc9, 0x8c, 0x34, 0x03, 0x28, 0x93, 0xff, 0x9e, 0x42, 0x03,
+  0xa9, 0x0a, 0x01, 0x99, 0x08, 0x42, 0x22, 0x80, 0xcc, 0x8b, 0x32, 0x82,
+  0x8a, 0x38, 0x11, 0xdc, 0xad, 0x30, 0x33, 0xb0, 0xad, 0x80, 0xa1, 0x00,
+  0x42, 0x05, 0xb9, 0x8b, 0x21, 0x43, 0x98, 0x9b, 0x71, 0x84, 0xfb, 0x0c,
+  0x43, 0x80, 0x99, 0x80, 0x89, 0x00, 0x00, 0x31, 0x83, 0x21, 0xea, 0x9b,
+  0x08, 0x41, 0x34, 0xaa, 0x2a, 0xc8, 0xaa, 0x80, 0x80, 0x37, 0x93, 0xdc,
+  0x31, 0xfe, 0x31, 0x00, 0x9a, 0x11, 0x23, 0xfa, 0x1a, 0x12, 0xbb, 0x8b,
+  0x20, 0x32, 0x0b, 0xc8, 0xbc, 0x0b, 0x48, 0xc0, 0x8b, 0x74, 0x21, 0xa3,
+  0x0c, 0x54, 0x22, 0x80, 0x82, 0x9c, 0x28, 0xda, 0x71, 0x12, 0x89, 0x10,
+  0xa9, 0x10, 0xd0, 0x1b, 0x17, 0x91, 0xb8, 0xbb, 0x4a, 0x15, 0xc9, 0x1a,
+  0xb1, 0x9a, 0xac, 0x60, 0x92, 0x0c, 0x98, 0xbb, 0x28, 0x07, 0x9c, 0x50,
+  0x13, 0xa8, 0x1a, 0x32, 0x12, 0x80, 0x80, 0x73, 0x03, 0xbe, 0x2c, 0x44,
+  0x80, 0x9a, 0x11, 0x10, 0x42, 0xb8, 0x0b, 0x51, 0x13, 0xc0, 0xfb, 0x0d,
+  0x10, 0x80, 0xaa, 0xa9, 0x19, 0xa0, 0xa0, 0x82, 0xb3, 0xcb, 0x48, 0xb8,
+  0x8b, 0x04, 0x08, 0x75, 0x05, 0x98, 0x8d, 0x40, 0x83, 0x09, 0x18, 0x84,
+  0xa0, 0xa9, 0x40, 0x27, 0x90, 0x09, 0x21, 0xa8, 0x80, 0x8a, 0x54, 0x10,
+  0xaa, 0xfa, 0x9e, 0x90, 0x91, 0x89, 0xa2, 0xcc, 0x0b, 0xa9, 0x62, 0x81,
+  0x09, 0x89, 0xa0, 0xab, 0x42, 0xb8, 0x0b, 0x74, 0x86, 0xbb, 0x68, 0x23,
+  0x80, 0x88, 0x80, 0x9b, 0x10, 0xd0, 0x61, 0x24, 0xa9, 0x1b, 0x31, 0x9a,
+  0x71, 0x11, 0xb9, 0x89, 0xa0, 0xcc, 0x1b, 0x16, 0xca, 0x9a, 0x90, 0x89,
+  0x98, 0x9d, 0x41, 0x01, 0x9c, 0x21, 0x8a, 0x00, 0xf8, 0x0b, 0x43, 0x24,
+  0xc0, 0x09, 0x4a, 0x53, 0x04, 0x88, 0x41, 0x03, 0xdc, 0x19, 0x22, 0x24,
+  0x91, 0x89, 0x09, 0x28, 0x08, 0x38, 0x37, 0xe0, 0xcb, 0x9a, 0x11, 0x32,
+  0xe9, 0xba, 0xba, 0x98, 0x9a, 0x28, 0x00, 0x9f, 0x2a, 0xa8, 0x3a, 0x02,
+  0xb3, 0x88, 0x70, 0x17, 0x9a, 0x61, 0x23, 0x05, 0x99, 0x10, 0x14, 0xcb,
+  0x20, 0x13, 0x01, 0x84, 0x80, 0x0a, 0x45, 0x91, 0x9e, 0x50, 0x00, 0xba,
+  0xab, 0xa9, 0x80, 0x0a, 0xbb, 0xf0, 0xad, 0x9b, 0x89, 0x02, 0x2a, 0x38,
+  0xb3, 0x1f, 0x82, 0x20, 0xf8, 0xf7, 0x27, 0x00, 0x8e, 0x40, 0x47, 0xb8,
+  0x8b, 0x32, 0x04, 0x11, 0x81, 0x21, 0x08, 0x82, 0xab, 0x73, 0x17, 0x80,
+  0xb9, 0x00, 0x22, 0x21, 0x80, 0x80, 0xfb, 0xcc, 0x19, 0x90, 0x9f, 0xaa,
+  0xa0, 0xaa, 0x09, 0x28, 0x52, 0xe0, 0xaa, 0x81, 0xa2, 0x80, 0x55, 0x00,
+  0xaa, 0x43, 0x92, 0x80, 0x72, 0x01, 0x80, 0x29, 0x01, 0x38, 0x65, 0x13,
+  0xab, 0x48, 0x12, 0x84, 0xa0, 0x89, 0xaa, 0x8a, 0x73, 0xc2, 0xb9, 0xdc,
+  0xab, 0xba, 0x10, 0x82, 0xfc, 0x9a, 0xa8, 0x38, 0x13, 0x89, 0x22, 0x36,
+  0xf9, 0x1a, 0x14, 0xb0, 0x28, 0x05, 0xeb, 0x18, 0x22, 0x08, 0x18, 0x13,
+  0x08, 0x14, 0x02, 0x58, 0x55, 0x91, 0x9a, 0x88, 0x63, 0x90, 0xab, 0x38,
+  0x01, 0xce, 0x8b, 0x28, 0x90, 0xcd, 0xa9, 0x88, 0x9b, 0x9b, 0x08, 0x52,
+  0x01, 0xdc, 0x08, 0x83, 0x91, 0x58, 0x11, 0xcd, 0x50, 0x82, 0x99, 0x48,
+  0x13, 0x12, 0xc0, 0x19, 0x26, 0x02, 0x99, 0x48, 0x27, 0xa1, 0x08, 0x20,
+  0x91, 0xdc, 0x0a, 0x44, 0x90, 0xdb, 0xa9, 0x98, 0x88, 0x90, 0x99, 0x08,
+  0xda, 0xaf, 0x19, 0x34, 0x08, 0x9a, 0x99, 0x21, 0xa1, 0x32, 0xb8, 0x0f,
+  0x73, 0x92, 0xab, 0x22, 0x54, 0x24, 0x99, 0x2a, 0x22, 0x14, 0x9a, 0x3b,
+  0x57, 0x98, 0x9a, 0x13, 0x11, 0x98, 0xb9, 0x0a, 0x08, 0xdf, 0x9a, 0x21,
+  0xa9, 0xbf, 0x28, 0x89, 0x9a, 0x00, 0x88, 0xa0, 0xb0, 0xb8, 0x8f, 0x62,
+  0x21, 0x01, 0xeb, 0x1a, 0x34, 0x14, 0xa9, 0x09, 0x73, 0x03, 0x98, 0x30,
+  0x37, 0xa1, 0xbb, 0x41, 0x32, 0xa0, 0x2a, 0x08, 0xa1, 0x9d, 0x0a, 0x52,
+  0x91, 0xef, 0x9a, 0x01, 0xa9, 0x89, 0x91, 0xae, 0x08, 0x90, 0x2b, 0x24,
+  0x82, 0xeb, 0x0a, 0x38, 0x48, 0x24, 0xa8, 0xab, 0x72, 0x84, 0x89, 0x20,
+  0x25, 0x81, 0x98, 0x41, 0x14, 0x08, 0x8b, 0x00, 0x3a, 0x0a, 0x2b, 0x00,
+  0x34, 0xc1, 0x29, 0x36, 0xa1, 0xcb, 0x19, 0xa2, 0xd0, 0xa0, 0xbd, 0xba,
+  0xcb, 0x9e, 0x88, 0xb0, 0x9a, 0xc8, 0x8c, 0x33, 0x08, 0x08, 0xba, 0x48,
+  0x25, 0x42, 0x80, 0x0d, 0x41, 0x05, 0x91, 0x19, 0x44, 0x12, 0x80, 0x19,
+  0x72, 0x93, 0x9a, 0x58, 0x14, 0x98, 0x18, 0x12, 0x82, 0xa2, 0x9e, 0xa9,
+  0x82, 0xfa, 0x9e, 0x08, 0x98, 0x9c, 0x8a, 0xa1, 0xad, 0x99, 0x30, 0x28,
+  0x08, 0xa8, 0xbb, 0x03, 0x40, 0x27, 0x02, 0x0b, 0x16, 0x22, 0xa2, 0x08,
+  0x66, 0x82, 0x99, 0x10, 0x54, 0x00, 0x08, 0x21, 0x03, 0x38, 0x6b, 0x80,
+  0x22, 0xd8, 0xca, 0x19, 0x22, 0xf0, 0x9e, 0x99, 0x98, 0xac, 0x19, 0x91,
+  0xeb, 0x98, 0x08, 0x01, 0x08, 0x8a, 0x02, 0xbb, 0x6c, 0x44, 0x91, 0x9b,
+  0x41, 0x31, 0x22, 0x08, 0x38, 0x73, 0x84, 0x41, 0x81, 0x12, 0x80, 0xb3,
+  0x4b, 0x45, 0x19, 0x28, 0x80, 0x83, 0xc0, 0x0b, 0xc8, 0xc0, 0x9e, 0xaa,
+  0x0a, 0xbe, 0xbd, 0x89, 0x99, 0xea, 0x09, 0x9a, 0x80, 0xa2, 0x02, 0xb8,
+  0x80, 0x75, 0x84, 0x10, 0x89, 0x82, 0x52, 0x63, 0x82, 0x99, 0x30, 0x42,
+  0x21, 0x04, 0x88, 0x80, 0xba, 0x70, 0x15, 0x08, 0x80, 0x08, 0x8a, 0x33,
+  0x08, 0xaf, 0x08, 0xbd, 0x8c, 0xa9, 0xbc, 0x9a, 0xba, 0xe0, 0xcb, 0xa9,
+  0x22, 0xa8, 0xeb, 0x89, 0x22, 0xa2, 0x38, 0x40, 0x03, 0x08, 0x17, 0x68,
+  0x35, 0x82, 0x09, 0x61, 0x12, 0x18, 0x01, 0x21, 0x02, 0xbb, 0x8e, 0x52,
+  0x11, 0xa0, 0x80, 0x38, 0xc0, 0x80, 0xc0, 0x48, 0xb8, 0xaf, 0xc9, 0xcb,
+  0x0b, 0xaa, 0xb0, 0xea, 0x9f, 0x10, 0x00, 0x89, 0x09, 0x08, 0xb2, 0xaf,
+  0x10, 0x12, 0x24, 0x41, 0x80, 0x42, 0x54, 0x22, 0x81, 0x01, 0x28, 0xa8,
+  0x30, 0x73, 0x23, 0xbc, 0x0a, 0xa8, 0x72, 0x08, 0x08, 0x82, 0xa2, 0x08,
+  0x04, 0x0b, 0x25, 0x00, 0x48, 0x30, 0xf0, 0xaf, 0x98, 0x99, 0x08, 0xca,
+  0xab, 0xd0, 0x9b, 0xbc, 0x10, 0x22, 0xd8, 0x0a, 0x9d, 0x80, 0x38, 0x24,
+  0x32, 0x65, 0x01, 0x91, 0x01, 0x12, 0x17, 0x91, 0x98, 0x28, 0x34, 0xa0,
+  0x20, 0x72, 0xb9, 0x98, 0x2a, 0x32, 0x02, 0xf0, 0xaa, 0x08, 0x32, 0x87,
+  0x00, 0x9f, 0x01, 0xab, 0xa9, 0x80, 0xb0, 0x80, 0x9f, 0xa9, 0x0a, 0x3b,
+  0x0b, 0xc3, 0xc0, 0xbe, 0xa8, 0x32, 0x32, 0xb3, 0x08, 0x35, 0x64, 0x43,
+  0x01, 0xa8, 0x32, 0x08, 0x83, 0x34, 0x34, 0xcb, 0x80, 0x3c, 0x73, 0x82,
+  0xa9, 0xab, 0x83, 0x34, 0x88, 0x8b, 0xd8, 0xc0, 0xac, 0x3b, 0x84, 0xb3,
+  0xbc, 0xbc, 0x30, 0x04, 0xbc, 0x0b, 0xc8, 0xf8, 0xaa, 0x0a, 0x08, 0x08,
+  0x08, 0x8d, 0x8b, 0x65, 0x08, 0x38, 0x82, 0x80, 0x34, 0x08, 0x58, 0x27,
+  0x21, 0xaa, 0x3a, 0x38, 0x80, 0x80, 0x80, 0xbe, 0x08, 0x08, 0x08, 0x46,
+  0xb8, 0x80, 0x8c, 0x80, 0x35, 0x84, 0xc0, 0x8a, 0xb8, 0x08, 0x68, 0x80,
+  0xbc, 0xc8, 0x9f, 0xa9, 0x2a, 0x02, 0x80, 0xb8, 0x0d, 0xc8, 0x80, 0x84,
+  0x00, 0xdd, 0x0a, 0x08, 0x02, 0x3b, 0x34, 0x80, 0x50, 0x73, 0x80, 0x80,
+  0x20, 0x80, 0x40, 0x73, 0x80, 0x80, 0x0a, 0x8b, 0x27, 0x28, 0x0a, 0x02,
+  0x3c, 0x08, 0xbc, 0x80, 0x40, 0x80, 0xd0, 0x8b, 0x80, 0x35, 0xcb, 0x8b,
+  0x07, 0x82, 0x0a, 0xf3, 0xc9, 0x80, 0xa0, 0xca, 0x0a, 0xa2, 0xb8, 0x4b,
+  0x08, 0x48, 0x8b, 0x40, 0x84, 0xb4, 0x80, 0x80, 0x40, 0x34, 0x00, 0x74,
+  0x19, 0x80, 0x0d, 0x08, 0x22, 0x23, 0x00, 0x8c, 0x40, 0x33, 0xaf, 0x08,
+  0x62, 0x91, 0x0a, 0x08, 0x02, 0x08, 0xc8, 0xc8, 0xc0, 0x03, 0x08, 0x88,
+  0x60, 0x8b, 0x0c, 0x08, 0x74, 0xa0, 0xa0, 0x02, 0x02, 0xaf, 0xa0, 0x8a,
+  0x30, 0xcb, 0xbb, 0x3c, 0xec, 0xfb, 0x26, 0x00, 0x80, 0xd0, 0x03, 0x0c,
+  0x83, 0x80, 0x80, 0x70, 0x33, 0x48, 0x80, 0x80, 0x47, 0xa8, 0x0a, 0x83,
+  0x08, 0x08, 0xe0, 0x80, 0x84, 0x43, 0xb8, 0x80, 0x17, 0x2a, 0xa8, 0x08,
+  0x08, 0x88, 0x80, 0x3f, 0x70, 0xa0, 0xaa, 0x20, 0x84, 0xfb, 0x0b, 0x08,
+  0x8a, 0x33, 0xb8, 0xf8, 0x21, 0x08, 0x0f, 0x98, 0x01, 0xaa, 0x32, 0x8b,
+  0xd0, 0x30, 0x84, 0x70, 0xa0, 0x82, 0xba, 0x30, 0x84, 0x0b, 0xc8, 0x08,
+  0x58, 0x03, 0x08, 0x08, 0x78, 0xc0, 0x8d, 0x22, 0x20, 0xb3, 0x3c, 0x43,
+  0x33, 0xbc, 0x4b, 0x83, 0x40, 0xcb, 0x3b, 0x80, 0x35, 0xac, 0xae, 0x80,
+  0x00, 0x88, 0xbb, 0x08, 0x08, 0x08, 0x8f, 0x80, 0x65, 0x98, 0x0a, 0x08,
+  0x08, 0x8c, 0x40, 0xb8, 0x3c, 0x80, 0x0c, 0x48, 0x03, 0xc8, 0x0c, 0x03,
+  0x03, 0x85, 0x40, 0xb8, 0xc8, 0x34, 0x88, 0x00, 0x88, 0xbe, 0x80, 0x08,
+  0xb5, 0x08, 0x08, 0x78, 0xb3, 0x08, 0xf4, 0x48, 0x01, 0x08, 0x82, 0xab,
+  0xb8, 0x3c, 0x08, 0x6d, 0x10, 0x89, 0xba, 0x80, 0x80, 0x80, 0x60, 0x03,
+  0x8f, 0x08, 0x68, 0x81, 0x29, 0x08, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x88,
+  0x17, 0xd8, 0x80, 0x80, 0x0d, 0x03, 0x0d, 0x8b, 0x34, 0x97, 0x98, 0x08,
+  0x0e, 0x81, 0x02, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x0a, 0x88, 0x80, 0x00,
+  0xb6, 0x78, 0x02, 0x82, 0x83, 0x0b, 0x08, 0x58, 0x80, 0x80, 0xe0, 0xb8,
+  0x08, 0x35, 0xc0, 0x08, 0xc8, 0x3c, 0x08, 0x80, 0x85, 0x34, 0xb8, 0xc8,
+  0xb8, 0xc4, 0x0b, 0x48, 0x80, 0x0c, 0x08, 0x9f, 0x32, 0x32, 0x03, 0xbc,
+  0x08, 0x08, 0x3e, 0x8b, 0x80, 0x80, 0xf0, 0x0b, 0x78, 0x02, 0xa8, 0x80,
+  0xc0, 0x0b, 0x08, 0x08, 0x75, 0x82, 0x0a, 0x38, 0x0b, 0x03, 0x08, 0x0e,
+  0x08, 0x8c, 0x80, 0x1f, 0x82, 0x80, 0x80, 0xf0, 0x83, 0xfe, 0x2b, 0x00,
+  0x81, 0xb0, 0x80, 0xb8, 0x88, 0x60, 0x80, 0x08, 0x85, 0xc0, 0x3b, 0x07,
+  0x89, 0xb0, 0x08, 0x30, 0x85, 0xbb, 0xb4, 0x08, 0x0d, 0x83, 0x04, 0x43,
+  0x80, 0x80, 0x0d, 0x08, 0x84, 0x8b, 0xbd, 0x78, 0x02, 0xa8, 0xba, 0x48,
+  0x83, 0x80, 0xcc, 0x33, 0xb4, 0x80, 0xbc, 0x43, 0x80, 0xd0, 0x0b, 0x08,
+  0x40, 0xd0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x70, 0xd7, 0x01, 0x9a,
+  0x82, 0x20, 0x84, 0xb0, 0x03, 0x08, 0x08, 0x06, 0x8c, 0x84, 0x80, 0x80,
+  0x80, 0x80, 0x0f, 0x03, 0x58, 0x8b, 0xd0, 0x80, 0x80, 0x80, 0x3d, 0x80,
+  0xcc, 0x08, 0x08, 0x08, 0x36, 0x80, 0x44, 0x0b, 0x08, 0x88, 0x00, 0x88,
+  0xf0, 0x03, 0xbd, 0x03, 0xd8, 0x80, 0xc8, 0x84, 0x03, 0x8f, 0x08, 0x08,
+  0xc3, 0x33, 0x48, 0xb8, 0x40, 0x08, 0xc8, 0x08, 0xb4, 0x08, 0xd8, 0x0c,
+  0x33, 0xc0, 0x3c, 0x03, 0x08, 0x08, 0x0f, 0x08, 0x48, 0xb3, 0x08, 0x85,
+  0x40, 0xb8, 0x08, 0x08, 0x8e, 0x8f, 0x04, 0xa1, 0x20, 0x8a, 0x3b, 0x80,
+  0x80, 0x80, 0x8e, 0x04, 0x08, 0x08, 0x08, 0x08, 0x78, 0x81, 0x0d, 0x08,
+  0x0d, 0x83, 0x80, 0x05, 0x03, 0xd8, 0x0b, 0x53, 0x0b, 0x08, 0xd8, 0x43,
+  0xbb, 0x03, 0x08, 0x3d, 0x80, 0xbd, 0x80, 0x8c, 0xd0, 0x03, 0x43, 0x80,
+  0x08, 0x80, 0x06, 0x88, 0x50, 0xb8, 0xc8, 0x80, 0xc8, 0x84, 0x80, 0x85,
+  0x0b, 0xc8, 0x03, 0x08, 0x68, 0x8b, 0x8b, 0x50, 0x53, 0x38, 0x03, 0xbc,
+  0x08, 0xbd, 0x03, 0x80, 0x80, 0x8e, 0x00, 0x58, 0xb8, 0x58, 0x3b, 0xc0,
+  0x3b, 0xd0, 0x0b, 0x08, 0x58, 0xb3, 0xbc, 0x03, 0x07, 0x00, 0x02, 0x0c,
+  0x08, 0xc8, 0x30, 0x80, 0x80, 0x80, 0xf0, 0x6c, 0x01, 0x08, 0xa2, 0x8b,
+  0x80, 0x80, 0x3d, 0x40, 0xc0, 0x08, 0x58, 0x0b, 0x08, 0x08, 0x88, 0x00,
+  0x0f, 0x00, 0x1d, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
+  0xf8, 0x83, 0xf0, 0x5f, 0x8f, 0x12, 0x0a, 0x0b, 0x43, 0x08, 0xc3, 0x80,
+  0x80, 0x80, 0x80, 0x07, 0xc8, 0xc0, 0x4b, 0x02, 0x08, 0xc8, 0x3c, 0x4b,
+  0xb8, 0x08, 0x8c, 0x34, 0x8b, 0x80, 0x27, 0x0b, 0x88, 0xb4, 0x8b, 0x40,
+  0x34, 0x8b, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0xf0, 0x83, 0x00, 0x88,
+  0x00, 0xb7, 0x07, 0xc8, 0x84, 0x80, 0xd0, 0x80, 0xcb, 0x08, 0x58, 0x08,
+  0x0c, 0x48, 0x33, 0x08, 0x08, 0xe8, 0xf0, 0x2a, 0x28, 0x83, 0x48, 0xeb,
+  0x21, 0x80, 0x38, 0xc0, 0x80, 0x03, 0xbc, 0x03, 0x9f, 0x62, 0x19, 0x08,
+  0x08, 0x08, 0x08, 0x48, 0x84, 0xc0, 0x8a, 0x84, 0x0b, 0xc3, 0x80, 0xd0,
+  0x03, 0xc8, 0x30, 0x0c, 0x48, 0x4b, 0x08, 0x0c, 0x88, 0x04, 0xbc, 0x24,
+  0x0b, 0xb8, 0x84, 0x80, 0x50, 0xc0, 0x08, 0x8c, 0x8b, 0x80, 0xe0, 0x43,
+  0x83, 0x80, 0x40, 0x80, 0x0d, 0xc3, 0xbb, 0x3c, 0x07, 0x08, 0x08, 0x08,
+  0xb8, 0x48, 0x80, 0x85, 0xc0, 0x0b, 0xb8, 0x88, 0x80, 0x8e, 0x04, 0x0c,
+  0x83, 0x70, 0x09, 0x02, 0xb8, 0x08, 0x04, 0x08, 0x08, 0x78, 0xb8, 0x80,
+  0x85, 0x0b, 0x48, 0xc0, 0x48, 0x0b, 0x08, 0x58, 0x8b, 0x3c, 0xf0, 0x48,
+  0x08, 0x38, 0x88, 0x8a, 0x3b, 0x00, 0x68, 0x80, 0x0c, 0x8c, 0xb4, 0x80,
+  0x84, 0xc0, 0x30, 0x08, 0x08, 0x08, 0x08, 0x07, 0x3c, 0xc0, 0x0f, 0x31,
+  0x89, 0x80, 0x80, 0xb4, 0x03, 0x8c, 0x80, 0xcc, 0x33, 0x8f, 0x80, 0x20,
+  0x83, 0x03, 0x80, 0x80, 0x8e, 0x34, 0x3b, 0x80, 0xe0, 0x80, 0xb4, 0x48,
+  0x0b, 0x3c, 0xb8, 0x08, 0x08, 0x08, 0x8f, 0xe4, 0x01, 0xaa, 0x62, 0x08,
+  0x08, 0x82, 0x80, 0x4b, 0x48, 0x08, 0x08, 0xc8, 0x03, 0x08, 0x08, 0x3f,
+  0xcb, 0x03, 0x8c, 0x00, 0x1f, 0x00, 0x24, 0x00, 0xf8, 0x59, 0x08, 0x0a,
+  0xa2, 0x02, 0x8b, 0x08, 0x85, 0x8f, 0x80, 0x23, 0x08, 0xcb, 0x33, 0xb8,
+  0x84, 0x80, 0x50, 0x8b, 0x3c, 0xf4, 0x09, 0x88, 0x50, 0xa0, 0x08, 0x08,
+  0x83, 0x84, 0x84, 0xbb, 0x80, 0x50, 0xc3, 0x4b, 0x02, 0xb8, 0x8c, 0xf0,
+  0x18, 0x00, 0x88, 0xc0, 0xb0, 0x08, 0x74, 0xc0, 0x30, 0x08, 0x38, 0xbb,
+  0x30, 0x80, 0x80, 0x80, 0x80, 0x3f, 0x85, 0xcb, 0x03, 0xc3, 0x43, 0xf0,
+  0x08, 0x9a, 0x22, 0xb8, 0x84, 0x0b, 0x48, 0x80, 0x80, 0x3d, 0x04, 0xc3,
+  0x0b, 0x78, 0x0b, 0x82, 0x8a, 0x48, 0x30, 0xbc, 0x43, 0x0b, 0xc8, 0x80,
+  0x80, 0xb5, 0x08, 0xb4, 0xbc, 0x08, 0x88, 0x00, 0x06, 0x7c, 0x08, 0x08,
+  0x82, 0xb0, 0xb8, 0x34, 0x80, 0xd0, 0x78, 0x80, 0x89, 0x80, 0x0b, 0xc3,
+  0x1f, 0xa0, 0x89, 0x62, 0x08, 0x80, 0xe0, 0x30, 0x08, 0x08, 0x0b, 0xc3,
+  0xba, 0x3b, 0x34, 0x40, 0x08, 0x0c, 0x8c, 0x70, 0x80, 0xa0, 0x3b, 0xb3,
+  0x03, 0x04, 0x48, 0xcb, 0x08, 0x08, 0x08, 0x06, 0x6c, 0xa0, 0xa8, 0x83,
+  0x0b, 0x24, 0xc0, 0x8a, 0xb8, 0x08, 0x3e, 0x03, 0x48, 0xc0, 0x3b, 0xb4,
+  0x8f, 0x54, 0xb2, 0x8e, 0x10, 0x33, 0xf9, 0x0c, 0x33, 0xba, 0x18, 0x22,
+  0xba, 0x31, 0xe0, 0x29, 0x83, 0xa2, 0xbc, 0x49, 0x44, 0xc0, 0x09, 0x02,
+  0x08, 0x91, 0x8f, 0x10, 0x11, 0x89, 0xab, 0x22, 0xa2, 0x73, 0x27, 0xcd,
+  0x89, 0x40, 0x25, 0xd8, 0x8c, 0x34, 0xc9, 0x08, 0x10, 0xa0, 0x0a, 0x90,
+  0x0b, 0x37, 0xaa, 0x35, 0xa0, 0xdd, 0x2a, 0x27, 0xa8, 0x0b, 0x81, 0x19,
+  0x34, 0xeb, 0x28, 0x83, 0xcc, 0x38, 0x03, 0x9c, 0x32, 0x91, 0xb9, 0x9a,
+  0x32, 0x01, 0xb2, 0xbf, 0x21, 0x90, 0x10, 0x90, 0x35, 0x91, 0xd9, 0x2b,
+  0x84, 0x38, 0x82, 0xc9, 0x8c, 0x42, 0xa4, 0x9f, 0xfb, 0xf3, 0x3f, 0x00,
+  0x16, 0x8a, 0x83, 0x9c, 0x00, 0x12, 0xcb, 0x42, 0xba, 0x52, 0xd8, 0x19,
+  0x02, 0x98, 0x09, 0x11, 0xa9, 0x20, 0x37, 0xf9, 0x2c, 0x04, 0xa9, 0x28,
+  0x02, 0xba, 0x28, 0x93, 0x9c, 0x26, 0xcb, 0x21, 0x90, 0x1a, 0x13, 0x90,
+  0xbb, 0xa8, 0x78, 0x27, 0xcc, 0x58, 0x92, 0x9a, 0x99, 0x50, 0x83, 0xbb,
+  0x10, 0x99, 0x40, 0x93, 0xac, 0x38, 0x05, 0xa9, 0x98, 0x0a, 0x25, 0x88,
+  0x83, 0xad, 0x10, 0x11, 0xf9, 0x59, 0x84, 0xac, 0x21, 0x81, 0x8a, 0x28,
+  0x04, 0xcc, 0x48, 0x01, 0x98, 0x98, 0x0a, 0x53, 0xa1, 0x9f, 0x21, 0x90,
+  0x21, 0x81, 0xaa, 0x9a, 0x00, 0x71, 0x87, 0xba, 0x28, 0xa0, 0x29, 0x16,
+  0xca, 0x19, 0x80, 0x88, 0x20, 0x22, 0x11, 0xa0, 0xcf, 0x29, 0x42, 0x13,
+  0xba, 0x8b, 0x8a, 0x24, 0x10, 0x33, 0xcb, 0x9b, 0x9e, 0x12, 0x22, 0xc0,
+  0x9e, 0x88, 0x83, 0xb3, 0x13, 0x20, 0x17, 0xb0, 0xce, 0x20, 0x33, 0xb0,
+  0xbd, 0x28, 0x11, 0x91, 0xcd, 0x09, 0x25, 0xa8, 0x21, 0x92, 0x89, 0x20,
+  0x57, 0x92, 0x9b, 0x8a, 0x90, 0x48, 0x25, 0xa9, 0x99, 0xb9, 0xaf, 0x41,
+  0x13, 0xcb, 0x08, 0xb8, 0x09, 0x61, 0x91, 0x18, 0xa0, 0xc9, 0x41, 0x83,
+  0xcb, 0x28, 0x22, 0xdb, 0x0e, 0x32, 0x14, 0xba, 0x50, 0x82, 0xa9, 0xa8,
+  0xd9, 0x10, 0x44, 0x15, 0xa9, 0xac, 0x20, 0x63, 0x81, 0xcc, 0xab, 0x11,
+  0x44, 0x90, 0x99, 0x9b, 0x60, 0x32, 0xc3, 0xcc, 0x8a, 0x11, 0x23, 0xc8,
+  0x89, 0x22, 0xba, 0x0b, 0x74, 0x82, 0xac, 0xaa, 0x19, 0x20, 0x37, 0x90,
+  0xba, 0x98, 0x08, 0x51, 0x84, 0x0a, 0x99, 0xd8, 0x0a, 0x72, 0x24, 0xc8,
+  0x8c, 0x08, 0x21, 0x32, 0x80, 0xfa, 0xab, 0x38, 0x27, 0x01, 0xb8, 0xbc,
+  0x19, 0x31, 0x32, 0x10, 0x90, 0xbd, 0x09, 0x38, 0x15, 0xac, 0x32, 0xcb,
+  0x3b, 0xfc, 0x30, 0x00, 0xac, 0x09, 0x72, 0x03, 0x38, 0x23, 0xea, 0xbb,
+  0x8a, 0x72, 0x04, 0x99, 0xba, 0x9a, 0x3a, 0x53, 0x35, 0x83, 0xdc, 0x9c,
+  0x08, 0x22, 0x13, 0x32, 0xa3, 0xdf, 0x89, 0x31, 0x14, 0x90, 0x9b, 0x8a,
+  0xc9, 0x1a, 0x35, 0x24, 0xa9, 0x1a, 0x80, 0xd9, 0x8c, 0x63, 0x03, 0xcb,
+  0x8c, 0x10, 0x31, 0x03, 0x30, 0x84, 0xdf, 0x8a, 0x31, 0x22, 0x98, 0x9b,
+  0x99, 0x8b, 0x47, 0x13, 0xa8, 0xca, 0x8a, 0x88, 0x48, 0x13, 0xaa, 0x50,
+  0x90, 0xbc, 0x40, 0x36, 0x92, 0xbf, 0x8a, 0x00, 0x31, 0x05, 0x90, 0x99,
+  0x9d, 0x61, 0x82, 0x0a, 0x00, 0xb9, 0xbb, 0x9a, 0x56, 0x03, 0x09, 0xa8,
+  0xaa, 0x38, 0x12, 0x43, 0xfb, 0x8d, 0x08, 0x21, 0x10, 0x09, 0x13, 0xca,
+  0x30, 0x35, 0x14, 0xec, 0xac, 0x28, 0x25, 0x80, 0xaa, 0x8a, 0x10, 0x12,
+  0x13, 0x14, 0xc9, 0xbf, 0x8a, 0x31, 0x24, 0xb9, 0x48, 0x24, 0xd8, 0x9a,
+  0x28, 0x35, 0xc0, 0x9c, 0x00, 0x88, 0x02, 0x20, 0x33, 0xf9, 0x19, 0x03,
+  0x99, 0x89, 0x89, 0x16, 0xd9, 0x0a, 0x24, 0x12, 0xda, 0x0a, 0x23, 0xa8,
+  0x89, 0x04, 0xfc, 0x8c, 0x31, 0x25, 0x91, 0xbb, 0xaa, 0x20, 0x01, 0x73,
+  0x13, 0xea, 0xbb, 0x18, 0x53, 0x02, 0x80, 0x90, 0xbd, 0x9b, 0x38, 0x46,
+  0x01, 0xb8, 0xbb, 0x19, 0x22, 0x44, 0x02, 0xb9, 0xbd, 0x19, 0x03, 0x20,
+  0x22, 0x16, 0xe9, 0xbc, 0x28, 0x53, 0x01, 0xaa, 0x09, 0x01, 0x8a, 0x20,
+  0x36, 0xd0, 0xad, 0x19, 0x22, 0x02, 0x19, 0x18, 0xa0, 0xdc, 0x0b, 0x33,
+  0x80, 0x23, 0x08, 0xbd, 0xab, 0x72, 0x17, 0x90, 0x8a, 0x10, 0xa1, 0x9a,
+  0x19, 0x27, 0xc0, 0x9b, 0x18, 0x30, 0x11, 0x80, 0x14, 0xcb, 0xaf, 0x89,
+  0x52, 0x12, 0x10, 0x89, 0xaa, 0xa8, 0x52, 0x11, 0xa9, 0xfa, 0x8c, 0x08,
+  0x12, 0x13, 0x04, 0x08, 0x36, 0x02, 0x2b, 0x00, 0xfd, 0x8b, 0x34, 0x13,
+  0xa1, 0xab, 0xb0, 0xbb, 0x78, 0x16, 0x01, 0x99, 0xcb, 0x8a, 0x00, 0x21,
+  0x45, 0x23, 0x92, 0xfe, 0xbd, 0x18, 0x35, 0x12, 0x88, 0x88, 0x00, 0x99,
+  0x89, 0x80, 0xba, 0x21, 0xba, 0xfa, 0xbc, 0x39, 0x16, 0x00, 0x18, 0x01,
+  0x99, 0x09, 0xa8, 0xaf, 0x18, 0x55, 0x13, 0x88, 0xa9, 0x89, 0x09, 0x98,
+  0x31, 0x12, 0x9c, 0xec, 0x2b, 0x52, 0x82, 0x90, 0xcb, 0x19, 0x01, 0x2a,
+  0x56, 0xe3, 0xff, 0x19, 0x34, 0x00, 0x88, 0x08, 0x00, 0xa8, 0x9b, 0x80,
+  0x98, 0x00, 0x01, 0xda, 0x8b, 0x30, 0x14, 0xba, 0x29, 0x47, 0x90, 0xac,
+  0x8a, 0x88, 0x31, 0x54, 0x13, 0x99, 0xbb, 0xbb, 0x1a, 0x44, 0x44, 0x91,
+  0x99, 0x18, 0x91, 0xab, 0xb9, 0x9a, 0x84, 0x10, 0x67, 0x84, 0xff, 0x0e,
+  0x23, 0x20, 0x92, 0x1b, 0x01, 0xa0, 0xbe, 0x08, 0x02, 0x20, 0x12, 0xda,
+  0x9c, 0x30, 0x14, 0xa8, 0x8b, 0x53, 0x82, 0xdc, 0x9a, 0x00, 0x51, 0x23,
+  0xa9, 0x9a, 0x21, 0xb1, 0xbf, 0x40, 0x35, 0x81, 0xab, 0x89, 0x81, 0xba,
+  0x0b, 0x55, 0x22, 0x90, 0xff, 0x9c, 0x43, 0x10, 0x13, 0xab, 0x13, 0x80,
+  0xde, 0x0a, 0x21, 0x11, 0x12, 0xc0, 0xab, 0x40, 0x23, 0xd9, 0x8a, 0x43,
+  0x83, 0xdc, 0x8b, 0x20, 0x13, 0x90, 0x89, 0x42, 0x03, 0xfa, 0x9c, 0x40,
+  0x23, 0x90, 0x9b, 0x09, 0x01, 0xb9, 0x3a, 0x37, 0xc1, 0xff, 0x09, 0x23,
+  0x41, 0xb0, 0x39, 0x01, 0xb0, 0xbd, 0x0b, 0x32, 0x22, 0x12, 0xe9, 0x8b,
+  0x63, 0x01, 0xbb, 0x1a, 0x53, 0x81, 0xbd, 0x0b, 0x31, 0x22, 0x99, 0x1a,
+  0x63, 0x12, 0xea, 0x8b, 0x42, 0x01, 0xca, 0x8a, 0x21, 0x23, 0xa8, 0x39,
+  0xf2, 0xff, 0x1a, 0x24, 0x12, 0xac, 0x22, 0x02, 0xda, 0xaa, 0x10, 0x22,
+  0x01, 0x98, 0x99, 0x28, 0x34, 0xd1, 0xad, 0x41, 0x3b, 0x06, 0x49, 0x00,
+  0x03, 0xca, 0xab, 0x21, 0x13, 0xa9, 0x29, 0x54, 0x24, 0xd0, 0xad, 0x29,
+  0x22, 0xa1, 0x9b, 0x41, 0x14, 0xb9, 0x39, 0x85, 0xff, 0x0a, 0x43, 0x12,
+  0xcc, 0x30, 0x13, 0xca, 0x9b, 0x10, 0x12, 0x12, 0xa8, 0x9c, 0x28, 0x34,
+  0xa2, 0xce, 0x30, 0x13, 0xe9, 0x8a, 0x11, 0x01, 0xa0, 0x89, 0x52, 0x33,
+  0xb0, 0xcf, 0x28, 0x13, 0xc8, 0xab, 0x31, 0x24, 0x80, 0x22, 0xf9, 0xbf,
+  0x48, 0x33, 0xb2, 0x9f, 0x41, 0x81, 0xbb, 0x09, 0x12, 0x11, 0x11, 0xc8,
+  0x9b, 0x52, 0x02, 0xdb, 0x0a, 0x52, 0x81, 0xcb, 0x09, 0x22, 0x12, 0xb8,
+  0x09, 0x33, 0xc1, 0xbe, 0x19, 0x35, 0x92, 0xbb, 0x29, 0x12, 0x10, 0x55,
+  0xd2, 0xdf, 0x08, 0x33, 0x13, 0xaf, 0x38, 0x04, 0xc9, 0x99, 0x11, 0x01,
+  0x11, 0xa0, 0x9c, 0x31, 0x14, 0xb9, 0xad, 0x31, 0x14, 0xca, 0x8b, 0x21,
+  0x33, 0x90, 0xac, 0x21, 0x23, 0xd8, 0xcd, 0x19, 0x13, 0x80, 0x20, 0x23,
+  0x32, 0x33, 0xf9, 0xff, 0x0a, 0x42, 0x22, 0xea, 0x1a, 0x43, 0xa0, 0xac,
+  0x29, 0x32, 0x81, 0x98, 0xba, 0x1a, 0x45, 0x81, 0xbd, 0x28, 0x34, 0xb0,
+  0x9e, 0x28, 0x22, 0x90, 0x9a, 0x09, 0x10, 0x02, 0x98, 0xab, 0x31, 0x05,
+  0xc9, 0x0a, 0x64, 0x25, 0xfa, 0x9d, 0x10, 0x33, 0x84, 0xbd, 0x38, 0x15,
+  0xc9, 0x9a, 0x21, 0x12, 0x00, 0x98, 0xbb, 0x49, 0x26, 0xc9, 0x9c, 0x41,
+  0x13, 0xd9, 0x0a, 0x31, 0x01, 0xba, 0x8a, 0x10, 0x23, 0x91, 0xad, 0x28,
+  0x34, 0x91, 0x9a, 0x18, 0x31, 0x25, 0xfc, 0xaf, 0x00, 0x24, 0x23, 0xd9,
+  0x9a, 0x32, 0x91, 0xcc, 0x89, 0x32, 0x24, 0x81, 0xbc, 0x2a, 0x34, 0xa0,
+  0xad, 0x28, 0x14, 0xb8, 0x9c, 0x20, 0x12, 0x81, 0x98, 0x08, 0x12, 0x90,
+  0xdd, 0x8a, 0x11, 0x52, 0x45, 0xa3, 0xef, 0x0a, 0x31, 0x43, 0xc8, 0x9b,
+  0xf4, 0xb5, 0x52, 0x00, 0x53, 0x91, 0xbc, 0x09, 0x22, 0x12, 0x12, 0xc8,
+  0xac, 0x41, 0x03, 0xeb, 0x0a, 0x43, 0x82, 0xac, 0x29, 0x23, 0xa0, 0xac,
+  0x08, 0x11, 0x11, 0xa0, 0xbf, 0x29, 0x26, 0x12, 0x00, 0xa1, 0xdf, 0x8b,
+  0x42, 0x33, 0xa1, 0xad, 0x28, 0x01, 0xb9, 0x8c, 0x20, 0x33, 0x24, 0xb0,
+  0xbe, 0x1a, 0x25, 0x91, 0xbc, 0x49, 0x24, 0xa0, 0xad, 0x21, 0x23, 0xb8,
+  0xad, 0x28, 0x13, 0xb8, 0x9a, 0x52, 0x12, 0x98, 0xaa, 0x10, 0x54, 0x82,
+  0xfe, 0xab, 0x30, 0x25, 0x14, 0xb8, 0xbb, 0x20, 0x02, 0xeb, 0x8a, 0x42,
+  0x43, 0x81, 0xbc, 0x0b, 0x34, 0x81, 0xcb, 0x0a, 0x23, 0x90, 0xbb, 0x40,
+  0x35, 0x81, 0xcd, 0x9b, 0x20, 0x24, 0x90, 0xbd, 0x30, 0x25, 0x81, 0xaa,
+  0x51, 0xb1, 0xdf, 0x09, 0x32, 0x24, 0x90, 0xaa, 0x99, 0x9a, 0x18, 0x22,
+  0x01, 0x10, 0x52, 0x91, 0xbe, 0x8b, 0x63, 0x13, 0xc8, 0x9d, 0x28, 0x24,
+  0x90, 0x9a, 0x20, 0x80, 0xcc, 0x8a, 0x43, 0x12, 0x98, 0xaa, 0x99, 0x10,
+  0x74, 0x25, 0xe8, 0xbd, 0x19, 0x34, 0x33, 0x91, 0xbc, 0x9b, 0x89, 0x10,
+  0x12, 0x00, 0x28, 0x46, 0x82, 0xec, 0x9a, 0x31, 0x14, 0xb0, 0xac, 0x19,
+  0x22, 0x11, 0x22, 0x11, 0x90, 0xfd, 0xab, 0x08, 0x33, 0x24, 0x80, 0x08,
+  0xb9, 0xbc, 0x71, 0x35, 0xf9, 0xac, 0x10, 0x33, 0x44, 0xb8, 0x9c, 0x08,
+  0x01, 0x88, 0x99, 0x10, 0x52, 0x24, 0xb8, 0xaf, 0x29, 0x34, 0x91, 0xcc,
+  0x09, 0x22, 0xa0, 0x8a, 0x54, 0x12, 0xb9, 0xad, 0x88, 0x01, 0x10, 0x12,
+  0x90, 0x18, 0x01, 0x98, 0xba, 0x29, 0x47, 0x83, 0xdf, 0xbb, 0x40, 0x34,
+  0x13, 0x98, 0x9a, 0xba, 0xbc, 0x18, 0x43, 0x81, 0x10, 0x43, 0x82, 0xdc,
+  0x8a, 0x42, 0x92, 0xec, 0x8a, 0x53, 0x03, 0xa9, 0x0a, 0x12, 0xc0, 0xab,
+  0x28, 0x14, 0x89, 0x31, 0x4c, 0x13, 0x3f, 0x00, 0xe0, 0xaf, 0x28, 0x34,
+  0x12, 0x98, 0x89, 0x90, 0xcc, 0xbc, 0x09, 0x54, 0x33, 0x81, 0x89, 0x88,
+  0xeb, 0xac, 0x10, 0x13, 0x81, 0x00, 0x21, 0x90, 0xaa, 0x00, 0x11, 0x98,
+  0x90, 0xfc, 0xbf, 0x30, 0x56, 0x12, 0xa8, 0x9c, 0x9a, 0x98, 0x00, 0x21,
+  0x25, 0x90, 0x9b, 0x00, 0x08, 0x09, 0x52, 0x55, 0xb1, 0xff, 0x0a, 0x31,
+  0x43, 0x82, 0xba, 0xab, 0x88, 0x00, 0x80, 0x88, 0x30, 0x47, 0x12, 0xeb,
+  0x9b, 0x20, 0x15, 0xa0, 0xbc, 0x19, 0x43, 0x03, 0xba, 0x20, 0x23, 0xea,
+  0xab, 0x09, 0x31, 0x22, 0xa0, 0xbc, 0x8b, 0x33, 0x45, 0x42, 0x81, 0xa8,
+  0xb9, 0xef, 0xac, 0x30, 0x27, 0x82, 0x99, 0x00, 0xa0, 0xcc, 0x89, 0x22,
+  0x01, 0x00, 0x21, 0x02, 0xa9, 0xac, 0x89, 0x00, 0x88, 0xaa, 0xbb, 0x0a,
+  0x77, 0x17, 0x90, 0x9a, 0x00, 0xa8, 0xbc, 0x38, 0x23, 0x90, 0x29, 0x33,
+  0x90, 0xcd, 0x89, 0x88, 0x62, 0x57, 0x82, 0xde, 0x9b, 0x21, 0x25, 0x13,
+  0xb8, 0xac, 0x89, 0x00, 0x88, 0x80, 0x20, 0x45, 0x23, 0xd9, 0xad, 0x19,
+  0x43, 0x82, 0xcb, 0x9b, 0x42, 0x24, 0xd9, 0x8b, 0x35, 0x82, 0xdb, 0x0a,
+  0x21, 0x90, 0x9a, 0x42, 0x03, 0xb9, 0x9c, 0x18, 0x12, 0x21, 0x55, 0x92,
+  0xdf, 0x9a, 0x31, 0x24, 0x04, 0xaa, 0x9a, 0x90, 0xba, 0x28, 0x25, 0x81,
+  0x18, 0x33, 0xa0, 0xce, 0x0a, 0x32, 0x13, 0xfa, 0x9b, 0x31, 0x15, 0xb8,
+  0x1a, 0x35, 0xa1, 0xbd, 0x09, 0x02, 0x90, 0x98, 0x80, 0x20, 0x44, 0x81,
+  0x9a, 0x89, 0x88, 0x51, 0x47, 0xe0, 0xbe, 0x09, 0x43, 0x33, 0x83, 0xca,
+  0xab, 0x8a, 0x18, 0x01, 0x80, 0x30, 0x37, 0x14, 0xc9, 0xad, 0x19, 0x33,
+  0x82, 0xdc, 0x8b, 0x52, 0x23, 0xa8, 0x9d, 0x21, 0x01, 0xba, 0x0a, 0x12,
+  0xb8, 0x1a, 0x46, 0x82, 0xba, 0x89, 0xb0, 0x09, 0x0d, 0xee, 0x3c, 0x00,
+  0x65, 0x23, 0x02, 0xfd, 0xac, 0x08, 0x34, 0x43, 0x91, 0xba, 0xab, 0xa9,
+  0x89, 0x42, 0x33, 0x11, 0x10, 0x13, 0xd9, 0xbd, 0x09, 0x21, 0x13, 0xd9,
+  0xcc, 0x19, 0x44, 0x14, 0x98, 0xa9, 0x88, 0xb8, 0x9a, 0x20, 0x33, 0xa8,
+  0x8c, 0x11, 0x54, 0x33, 0xb0, 0xaf, 0x09, 0x32, 0x42, 0x26, 0xfa, 0xbf,
+  0x18, 0x43, 0x33, 0x91, 0xcb, 0xba, 0x89, 0x18, 0x11, 0x12, 0x42, 0x35,
+  0x92, 0xdd, 0x9b, 0x20, 0x33, 0xa1, 0xcd, 0x8a, 0x53, 0x24, 0xb0, 0xad,
+  0x38, 0x13, 0xca, 0x0b, 0x32, 0x81, 0xaa, 0x28, 0x03, 0x99, 0x09, 0xb8,
+  0x8b, 0x75, 0x24, 0x13, 0xfc, 0xaf, 0x18, 0x33, 0x34, 0xb0, 0xad, 0x18,
+  0x90, 0x9a, 0x18, 0x32, 0x53, 0x24, 0xb0, 0xbf, 0x09, 0x42, 0x02, 0xcb,
+  0x9b, 0x31, 0x25, 0x98, 0x8c, 0x41, 0x82, 0xdb, 0x8a, 0x21, 0x03, 0xa9,
+  0x1a, 0x22, 0x11, 0x99, 0xcd, 0x09, 0x21, 0x22, 0x81, 0x10, 0x46, 0x82,
+  0xef, 0xab, 0x38, 0x45, 0x22, 0x98, 0xbb, 0x9a, 0x8a, 0x08, 0x21, 0x32,
+  0x44, 0x22, 0xb8, 0xbf, 0x9b, 0x30, 0x25, 0x91, 0xdc, 0x09, 0x53, 0x03,
+  0xb9, 0x9b, 0x11, 0x90, 0x9b, 0x31, 0x13, 0xb0, 0x8b, 0x22, 0x12, 0xa9,
+  0xcd, 0xcb, 0x08, 0x10, 0x77, 0x37, 0xc8, 0xaf, 0x09, 0x32, 0x34, 0x91,
+  0xbb, 0xaa, 0x98, 0x99, 0x11, 0x33, 0x32, 0x36, 0x13, 0xfa, 0xbc, 0x09,
+  0x42, 0x02, 0xb9, 0x9b, 0x30, 0x33, 0x88, 0x18, 0x73, 0x92, 0xbe, 0x9b,
+  0x20, 0x32, 0x81, 0x88, 0x21, 0xea, 0xbb, 0x19, 0x25, 0x14, 0x80, 0xa9,
+  0x29, 0x64, 0x23, 0xfc, 0xaf, 0x18, 0x43, 0x23, 0x91, 0xca, 0xba, 0x8a,
+  0x10, 0x12, 0x11, 0x31, 0x35, 0x82, 0xfb, 0x9d, 0x19, 0x32, 0x01, 0xba,
+  0x9c, 0x30, 0x45, 0x82, 0xda, 0x0a, 0x42, 0x91, 0xbc, 0x19, 0x24, 0x81,
+  0x1b, 0x0d, 0x43, 0x00, 0x9a, 0x08, 0x01, 0x99, 0x09, 0x01, 0x81, 0xaa,
+  0x70, 0x47, 0x23, 0xfe, 0x9c, 0x30, 0x33, 0x15, 0xaa, 0xab, 0x80, 0xa8,
+  0x0a, 0x21, 0x43, 0x44, 0x13, 0xea, 0xac, 0x29, 0x43, 0x91, 0xbc, 0x09,
+  0x32, 0x03, 0xd9, 0x0a, 0x54, 0x01, 0xdb, 0x89, 0x01, 0x81, 0x88, 0x11,
+  0x12, 0xb9, 0xab, 0x19, 0x12, 0x01, 0x21, 0xe1, 0xbc, 0x61, 0x34, 0x14,
+  0xfa, 0x9e, 0x29, 0x42, 0x23, 0x90, 0xcb, 0xaa, 0x09, 0x21, 0x02, 0x98,
+  0x38, 0x35, 0x92, 0xdd, 0x9b, 0x31, 0x14, 0x90, 0xbb, 0x09, 0x01, 0x32,
+  0x24, 0xb1, 0xac, 0x42, 0x83, 0xec, 0x0b, 0x32, 0x02, 0xc9, 0x9b, 0x31,
+  0x01, 0x8a, 0x82, 0x9b, 0xfb, 0xad, 0x71, 0x36, 0x12, 0xc8, 0xcf, 0x9a,
+  0x42, 0x24, 0x02, 0xaa, 0xab, 0x99, 0x99, 0x20, 0x33, 0x01, 0x21, 0x26,
+  0xb1, 0xcf, 0x8a, 0x41, 0x22, 0xa0, 0xbc, 0x08, 0x11, 0x20, 0x33, 0x03,
+  0xfb, 0x8a, 0x08, 0x88, 0x20, 0x31, 0x82, 0xbc, 0x8a, 0x21, 0xc0, 0x9f,
+  0x31, 0x23, 0xc8, 0x89, 0x43, 0x03, 0x9a, 0x76, 0x84, 0xdf, 0x9a, 0x41,
+  0x24, 0x01, 0xa9, 0x9b, 0x99, 0x88, 0x10, 0x00, 0x08, 0x52, 0x34, 0xa1,
+  0xce, 0x8a, 0x31, 0x23, 0xb8, 0xbc, 0x09, 0x10, 0x54, 0x33, 0xc8, 0xac,
+  0x08, 0x02, 0xa8, 0x09, 0x32, 0x82, 0xba, 0x18, 0x01, 0xa0, 0xdd, 0x9a,
+  0x72, 0x23, 0xa1, 0x9a, 0x71, 0x27, 0xf9, 0x9f, 0x28, 0x22, 0x24, 0xb8,
+  0x9c, 0x18, 0x88, 0x9a, 0x21, 0x00, 0x52, 0x44, 0xb0, 0xbf, 0x18, 0x43,
+  0x82, 0xcb, 0x8a, 0x20, 0x00, 0x89, 0x31, 0x24, 0xa0, 0xbc, 0x89, 0x21,
+  0x90, 0x89, 0x08, 0x00, 0x00, 0x89, 0x45, 0x92, 0xce, 0x18, 0x11, 0xea,
+  0x8b, 0x54, 0x13, 0x98, 0x21, 0x14, 0xfc, 0x9e, 0x20, 0x43, 0x01, 0xb9,
+  0x09, 0x08, 0xa9, 0x8a, 0xeb, 0xe3, 0x43, 0x00, 0x01, 0x00, 0x30, 0x43,
+  0x02, 0xdc, 0x9b, 0x41, 0x14, 0xa0, 0xcb, 0x9a, 0x10, 0x22, 0x35, 0x82,
+  0xa9, 0xba, 0x9b, 0x58, 0x44, 0x91, 0xcb, 0x09, 0x00, 0xa8, 0x09, 0x92,
+  0x48, 0x36, 0xa0, 0xbd, 0x9b, 0x29, 0x12, 0x28, 0x67, 0x35, 0x02, 0xee,
+  0xab, 0x18, 0x34, 0x14, 0x81, 0xaa, 0xcb, 0x99, 0x10, 0x12, 0x08, 0x10,
+  0x44, 0x81, 0xcd, 0x9b, 0x31, 0x43, 0x82, 0xc9, 0xab, 0x88, 0x33, 0x22,
+  0x11, 0x10, 0x10, 0xfa, 0xbf, 0x28, 0x35, 0x80, 0x99, 0x89, 0x88, 0x9a,
+  0x30, 0x15, 0xa8, 0x8b, 0x31, 0x90, 0x88, 0x20, 0x99, 0x77, 0x67, 0xf9,
+  0x9c, 0x38, 0x33, 0x15, 0xb9, 0xab, 0x01, 0xa8, 0x0a, 0x21, 0x00, 0x73,
+  0x24, 0xd9, 0xac, 0x38, 0x25, 0x91, 0xbc, 0x0a, 0x12, 0x80, 0x0a, 0x35,
+  0x12, 0xca, 0xaa, 0x18, 0x10, 0x08, 0x89, 0x89, 0x22, 0x11, 0x99, 0x09,
+  0x20, 0x31, 0xd9, 0xef, 0x09, 0x11, 0x02, 0x88, 0x88, 0x77, 0x13, 0x91,
+  0xef, 0x89, 0x21, 0x23, 0x01, 0x89, 0xa8, 0xcb, 0xaa, 0x20, 0x22, 0x81,
+  0x28, 0x33, 0xb2, 0xef, 0x8a, 0x42, 0x23, 0xa0, 0xad, 0x99, 0x10, 0x21,
+  0x82, 0x30, 0x47, 0xa0, 0xbc, 0x0a, 0x21, 0x88, 0x88, 0x80, 0x10, 0x08,
+  0x99, 0x59, 0x34, 0xb8, 0xbe, 0x1a, 0x43, 0x91, 0x99, 0x8d, 0x77, 0x14,
+  0xf9, 0x9d, 0x10, 0x33, 0x13, 0xb9, 0x9c, 0x88, 0x88, 0x08, 0x80, 0x89,
+  0x61, 0x25, 0xa1, 0xaf, 0x09, 0x43, 0x02, 0xc9, 0x9b, 0x20, 0x81, 0x98,
+  0x28, 0x52, 0x12, 0xc8, 0xac, 0x19, 0x33, 0xa0, 0x9a, 0x11, 0x82, 0xda,
+  0x0a, 0x32, 0x25, 0xa0, 0xbd, 0x09, 0x43, 0x03, 0x99, 0x70, 0x34, 0xfa,
+  0xdf, 0x20, 0x33, 0x13, 0xcc, 0x19, 0x02, 0xca, 0x89, 0x11, 0x00, 0x53,
+  0x02, 0xdc, 0x8b, 0x43, 0x14, 0xc9, 0x9a, 0x30, 0x65, 0x05, 0x4c, 0x00,
+  0x01, 0xdb, 0x0a, 0x43, 0x23, 0x80, 0xbc, 0x8c, 0x41, 0x81, 0xaa, 0x28,
+  0x23, 0xc8, 0xac, 0x20, 0x42, 0x01, 0xc9, 0xab, 0x30, 0x04, 0xc9, 0x9b,
+  0x73, 0x13, 0x90, 0x08, 0x43, 0xf8, 0xaf, 0x19, 0x43, 0x22, 0x98, 0x98,
+  0x99, 0xbb, 0x9a, 0x32, 0x11, 0x08, 0x52, 0x13, 0xf9, 0xac, 0x20, 0x34,
+  0x82, 0xbb, 0x9a, 0x00, 0x98, 0x9b, 0x18, 0x66, 0x34, 0xa1, 0xcc, 0x09,
+  0x01, 0x98, 0x09, 0x20, 0x81, 0xaa, 0x89, 0x61, 0x25, 0xb0, 0x9e, 0x28,
+  0x12, 0xc9, 0x8a, 0x42, 0x13, 0xa8, 0x39, 0x77, 0x91, 0xdf, 0x89, 0x42,
+  0x22, 0x90, 0x9a, 0x09, 0x98, 0x98, 0x89, 0x89, 0x31, 0x46, 0x02, 0xea,
+  0xab, 0x40, 0x23, 0xa8, 0x9c, 0x31, 0x13, 0xda, 0xaa, 0x10, 0x32, 0x43,
+  0x92, 0xdd, 0x09, 0x23, 0xa1, 0x8a, 0x23, 0x83, 0xdd, 0x0b, 0x11, 0x33,
+  0x81, 0xbc, 0x1a, 0x24, 0xc8, 0xab, 0x43, 0x44, 0x33, 0x84, 0xff, 0x9f,
+  0x30, 0x33, 0x92, 0x9c, 0x32, 0x92, 0xcd, 0x8a, 0x00, 0x08, 0x43, 0x13,
+  0xda, 0x9b, 0x52, 0x82, 0xda, 0x1a, 0x43, 0x92, 0xcc, 0x09, 0x21, 0x10,
+  0x00, 0x00, 0x10, 0x11, 0xe8, 0xac, 0x18, 0x23, 0x90, 0x9c, 0x10, 0x10,
+  0x11, 0x11, 0x89, 0xa8, 0x9b, 0xfb, 0x9b, 0x28, 0x35, 0x43, 0x82, 0x28,
+  0x47, 0xc0, 0xdf, 0x09, 0x31, 0x23, 0x01, 0x88, 0x98, 0xab, 0xab, 0xab,
+  0x9a, 0x21, 0x64, 0x33, 0x02, 0xdd, 0x8b, 0x21, 0x03, 0xa8, 0x29, 0x43,
+  0x92, 0xbd, 0xab, 0x00, 0x21, 0x20, 0x67, 0x11, 0xa9, 0x9a, 0x99, 0x09,
+  0x28, 0x81, 0x99, 0x88, 0x41, 0x09, 0x53, 0x21, 0x11, 0xd4, 0xcd, 0xab,
+  0x08, 0x02, 0x29, 0x67, 0x35, 0xc1, 0xdd, 0x09, 0x32, 0x12, 0x88, 0x08,
+  0x01, 0xa8, 0xcb, 0xbb, 0xbc, 0x29, 0x55, 0x23, 0xa0, 0xac, 0x38, 0x23,
+  0xed, 0x0c, 0x3c, 0x00, 0xe9, 0xab, 0x41, 0x14, 0x90, 0xba, 0x08, 0x32,
+  0x01, 0x88, 0xca, 0x18, 0x36, 0xb0, 0xae, 0x20, 0x25, 0xa8, 0xac, 0x28,
+  0x13, 0x98, 0xcb, 0x2a, 0x24, 0x91, 0x90, 0x10, 0x21, 0x85, 0xc8, 0x58,
+  0x36, 0xf9, 0xef, 0x18, 0x32, 0x02, 0x9a, 0x40, 0x22, 0xb8, 0xbc, 0x89,
+  0x9a, 0x0a, 0x21, 0x13, 0xa9, 0x39, 0x37, 0x03, 0xfc, 0x8b, 0x43, 0x02,
+  0xb9, 0x1a, 0x23, 0x91, 0xbc, 0x09, 0x88, 0x38, 0x25, 0xb1, 0xaa, 0x73,
+  0x81, 0xcb, 0x89, 0x12, 0x21, 0xa8, 0xad, 0x88, 0x22, 0xa1, 0xac, 0x28,
+  0x46, 0x01, 0xa0, 0x0a, 0x31, 0x46, 0xb0, 0xdf, 0x8a, 0x11, 0x23, 0x02,
+  0x00, 0x11, 0x12, 0xc9, 0xbc, 0xbb, 0x9a, 0x80, 0x13, 0x82, 0xca, 0x28,
+  0x55, 0xa0, 0xce, 0x1a, 0x44, 0x03, 0x80, 0x09, 0x31, 0x02, 0xca, 0xcd,
+  0x89, 0x31, 0x01, 0x9a, 0x19, 0x37, 0x92, 0xcc, 0x1a, 0x10, 0x08, 0x08,
+  0x98, 0x40, 0x21, 0x31, 0xb2, 0x9e, 0x28, 0x24, 0xf8, 0x0b, 0x73, 0x23,
+  0xea, 0xac, 0x19, 0x32, 0x81, 0x88, 0x22, 0x12, 0xeb, 0xab, 0x09, 0x02,
+  0x18, 0x82, 0x32, 0xbb, 0x80, 0x74, 0x01, 0x9a, 0x9d, 0x2a, 0x42, 0x36,
+  0x02, 0xdb, 0x89, 0x99, 0x0a, 0x0c, 0x08, 0x82, 0x62, 0x28, 0x08, 0x8a,
+  0x8a, 0x84, 0x0b, 0x43, 0x54, 0x84, 0x89, 0x89, 0x80, 0x30, 0xc3, 0xfb,
+  0xba, 0x5a, 0x11, 0xa0, 0x20, 0x32, 0xc0, 0xbb, 0xff, 0x99, 0x10, 0x25,
+  0x83, 0x81, 0xc9, 0x8b, 0x21, 0xc1, 0xbc, 0x10, 0x25, 0x83, 0x10, 0x01,
+  0x80, 0xbe, 0xa0, 0x3a, 0xab, 0x7b, 0x34, 0x91, 0xac, 0xab, 0x10, 0x32,
+  0x02, 0x08, 0xbc, 0xaf, 0x19, 0x52, 0x10, 0x02, 0x08, 0xb8, 0x0c, 0x87,
+  0xa0, 0xa9, 0x3b, 0x33, 0x73, 0xa9, 0x53, 0x01, 0xa8, 0x9d, 0x28, 0xa8,
+  0xb0, 0xb8, 0xfc, 0x0d, 0x45, 0xf8, 0x31, 0x00, 0x54, 0x22, 0xa8, 0xab,
+  0x39, 0x12, 0xa2, 0xdc, 0x19, 0x33, 0x08, 0xaa, 0x08, 0x33, 0x34, 0x08,
+  0xc8, 0xef, 0x99, 0x18, 0x53, 0x02, 0x10, 0x21, 0xea, 0xbc, 0x9c, 0x81,
+  0x81, 0x21, 0x73, 0x04, 0xb8, 0xd9, 0x8a, 0x18, 0x21, 0x11, 0x16, 0x90,
+  0x90, 0x89, 0xc9, 0x80, 0x22, 0x24, 0xa8, 0x80, 0xbb, 0x40, 0x48, 0x78,
+  0xb9, 0xae, 0x19, 0x54, 0x22, 0x99, 0xab, 0x0d, 0x00, 0x9a, 0x08, 0x48,
+  0x43, 0x01, 0x0a, 0xd8, 0x8b, 0x70, 0x92, 0xba, 0x0d, 0x30, 0x14, 0x98,
+  0xb9, 0x21, 0x02, 0xb8, 0xae, 0x0a, 0x02, 0x8b, 0x80, 0x75, 0x92, 0xfb,
+  0x88, 0x11, 0x81, 0x10, 0x40, 0x98, 0x22, 0x52, 0xa0, 0xcd, 0x49, 0x02,
+  0x18, 0xa0, 0xaa, 0x3a, 0x86, 0x80, 0x20, 0x80, 0xcf, 0x89, 0x33, 0xa0,
+  0x20, 0x86, 0xa0, 0xaa, 0x80, 0x0e, 0x23, 0x02, 0xb8, 0xbb, 0x53, 0xb8,
+  0x40, 0xb8, 0xff, 0x88, 0x31, 0x14, 0x08, 0xa9, 0x80, 0x80, 0x0d, 0xaa,
+  0xa0, 0xb8, 0xbb, 0x74, 0x17, 0x80, 0x8a, 0x90, 0xb9, 0x89, 0x46, 0x02,
+  0x09, 0x19, 0x01, 0xda, 0x19, 0x22, 0x04, 0x08, 0x08, 0x3b, 0x78, 0x92,
+  0xda, 0x0a, 0x08, 0xfa, 0x8f, 0x31, 0x14, 0x00, 0x09, 0x98, 0x9a, 0x08,
+  0x9a, 0x9d, 0x28, 0x84, 0x02, 0x08, 0x02, 0xc8, 0xfa, 0xad, 0x11, 0x31,
+  0x21, 0x80, 0x80, 0x16, 0xc9, 0xeb, 0x09, 0x38, 0x91, 0xaa, 0x52, 0x82,
+  0xaa, 0x23, 0x80, 0xbf, 0x8c, 0x12, 0x44, 0x22, 0x13, 0xbc, 0x0c, 0x23,
+  0x28, 0xbd, 0x28, 0x15, 0x98, 0xca, 0x21, 0x80, 0x20, 0xc0, 0xde, 0x19,
+  0x54, 0x02, 0x99, 0x90, 0x08, 0x08, 0xc8, 0xbe, 0x10, 0x34, 0x81, 0xb9,
+  0x12, 0x02, 0xbe, 0xa9, 0xa9, 0x38, 0x72, 0x13, 0xc9, 0x08, 0x14, 0xa0,
+  0xfc, 0x1a, 0x00, 0x08, 0x89, 0x62, 0x11, 0x18, 0xd7, 0xff, 0x2d, 0x00,
+  0x82, 0xfa, 0x0b, 0x21, 0x13, 0x00, 0x28, 0x07, 0x09, 0x19, 0xa0, 0x9e,
+  0x21, 0x01, 0x38, 0x72, 0x08, 0xab, 0xac, 0x00, 0xa8, 0xde, 0x20, 0x36,
+  0x00, 0xb8, 0x88, 0x99, 0x08, 0x08, 0x8d, 0x40, 0x61, 0x90, 0x89, 0x41,
+  0x28, 0xa8, 0x89, 0xdd, 0x9a, 0x31, 0x05, 0xb8, 0xaa, 0x42, 0x01, 0xc8,
+  0xaa, 0x02, 0xe8, 0x39, 0x64, 0x88, 0x18, 0x01, 0xce, 0x09, 0x21, 0x02,
+  0x18, 0x32, 0xa2, 0xb0, 0x0b, 0xb8, 0x34, 0x40, 0xc0, 0x9f, 0x08, 0x14,
+  0xa0, 0x08, 0x23, 0x84, 0xdf, 0x1b, 0x44, 0x00, 0x89, 0x08, 0x99, 0x1c,
+  0xa0, 0xcb, 0x48, 0x83, 0xc9, 0x2a, 0x14, 0xa2, 0x80, 0xad, 0x0a, 0x08,
+  0x36, 0x80, 0xaa, 0x60, 0x91, 0x08, 0x8d, 0x80, 0x80, 0xea, 0x28, 0x14,
+  0x82, 0x20, 0xea, 0xcd, 0x20, 0x10, 0x80, 0x40, 0x33, 0x01, 0xa8, 0xf0,
+  0x99, 0x08, 0x82, 0x80, 0x73, 0x48, 0x08, 0x98, 0x8a, 0x0a, 0xfb, 0x9f,
+  0x41, 0x13, 0x08, 0x01, 0x90, 0x9a, 0x89, 0xe0, 0x9c, 0x41, 0x02, 0x98,
+  0x10, 0x24, 0x0a, 0x08, 0xde, 0x9c, 0x20, 0x33, 0x81, 0xa9, 0xb9, 0x00,
+  0x08, 0xbc, 0x80, 0x80, 0xbd, 0x08, 0x58, 0x73, 0x86, 0xc8, 0x8a, 0x12,
+  0x08, 0x8b, 0x24, 0x23, 0xb0, 0x33, 0x33, 0x0c, 0x08, 0x8c, 0x07, 0x3a,
+  0x88, 0xb0, 0x0c, 0x48, 0xf3, 0xce, 0x08, 0x12, 0x04, 0x80, 0x21, 0xb9,
+  0x8b, 0xa2, 0xea, 0x19, 0x36, 0x90, 0x0b, 0x11, 0xa2, 0x0d, 0xa8, 0xaf,
+  0x28, 0x24, 0x01, 0x0a, 0x08, 0xa8, 0xeb, 0x89, 0x22, 0xb0, 0xc0, 0x8a,
+  0x70, 0x23, 0x22, 0xea, 0xa9, 0x20, 0x22, 0xb8, 0x70, 0x12, 0xa0, 0x0b,
+  0xae, 0x40, 0x23, 0x08, 0x80, 0x48, 0x32, 0xc0, 0xbb, 0xdb, 0x3a, 0x83,
+  0x0c, 0x48, 0x57, 0x08, 0x99, 0x89, 0x9a, 0x2a, 0x08, 0x8b, 0x70, 0x85,
+  0xb0, 0x03, 0x2e, 0x00, 0xea, 0x89, 0x21, 0x83, 0xa0, 0xca, 0x9c, 0x80,
+  0x34, 0x22, 0xa8, 0x08, 0x43, 0xfb, 0x8d, 0x18, 0x23, 0xa2, 0x0c, 0x28,
+  0x02, 0x88, 0xc0, 0x9e, 0x28, 0x22, 0xb0, 0x37, 0x15, 0x98, 0xb9, 0x08,
+  0x08, 0x02, 0x8b, 0x84, 0x04, 0x33, 0x80, 0xe0, 0xeb, 0xca, 0x89, 0xa0,
+  0x38, 0x57, 0x82, 0x9a, 0x09, 0x08, 0x8a, 0x0a, 0xf8, 0x1c, 0x32, 0x80,
+  0x8c, 0x22, 0x22, 0x8a, 0xfb, 0x9a, 0xac, 0x40, 0x23, 0x82, 0x32, 0x08,
+  0xec, 0xeb, 0x19, 0x32, 0x91, 0xae, 0x10, 0x11, 0x23, 0x84, 0xa9, 0x8c,
+  0x80, 0x02, 0xbb, 0x48, 0x37, 0x10, 0x20, 0x22, 0xb0, 0xbc, 0xfb, 0x2a,
+  0x14, 0x14, 0xa0, 0xa0, 0xd8, 0xaa, 0x20, 0x8a, 0x8b, 0x77, 0x80, 0x09,
+  0x18, 0x89, 0x80, 0xac, 0x9c, 0x28, 0x27, 0xa8, 0xaa, 0x24, 0x43, 0xa1,
+  0xc9, 0xbb, 0x0e, 0x31, 0x33, 0x98, 0xda, 0x80, 0x80, 0xaa, 0x23, 0x84,
+  0xf0, 0x9b, 0x41, 0x03, 0x82, 0x80, 0xbe, 0x2a, 0x27, 0x91, 0x89, 0x10,
+  0x82, 0x80, 0x70, 0x91, 0xca, 0x8b, 0x52, 0x83, 0x84, 0xa0, 0x89, 0x38,
+  0x3b, 0xb4, 0xcf, 0xac, 0x30, 0x16, 0x82, 0x90, 0xaa, 0x90, 0x2a, 0xa8,
+  0x0e, 0x2a, 0x94, 0xaa, 0x70, 0x12, 0x90, 0x9a, 0xa8, 0x8a, 0x70, 0x13,
+  0x80, 0xaa, 0x32, 0x07, 0xc8, 0xbb, 0x89, 0x02, 0x8b, 0xbb, 0x84, 0x84,
+  0x80, 0x07, 0xa0, 0xa8, 0xf8, 0xa0, 0x42, 0x43, 0x01, 0xaa, 0x3a, 0xb2,
+  0x80, 0x3c, 0xc0, 0x30, 0x04, 0x43, 0x80, 0xf0, 0x09, 0xdb, 0xae, 0x41,
+  0x24, 0xa1, 0x8b, 0x01, 0x91, 0xaa, 0xd2, 0xae, 0x30, 0x26, 0x91, 0x9b,
+  0x30, 0x11, 0x89, 0xaa, 0x9e, 0x0a, 0x34, 0x82, 0x80, 0x8a, 0x80, 0xfb,
+  0x8d, 0x10, 0x82, 0xd0, 0x9a, 0x2a, 0x15, 0x80, 0x20, 0xe0, 0x08, 0x78,
+  0x91, 0x09, 0x38, 0x82, 0xcb, 0x00, 0x2a, 0x00, 0x20, 0x30, 0x33, 0x0c,
+  0x8f, 0x10, 0x20, 0xb0, 0x08, 0x3c, 0x84, 0x80, 0x80, 0xff, 0x0b, 0x34,
+  0x93, 0x09, 0x9a, 0xaa, 0x0f, 0x91, 0xb9, 0x0a, 0x37, 0x91, 0x98, 0x39,
+  0x94, 0xa0, 0x9d, 0x9a, 0x28, 0x46, 0x12, 0x98, 0xcb, 0x80, 0xa0, 0xaa,
+  0x38, 0x03, 0xbc, 0xbc, 0x70, 0x82, 0x38, 0x88, 0xca, 0xaf, 0x12, 0x21,
+  0x82, 0x02, 0x33, 0x08, 0x04, 0x8c, 0x80, 0x8c, 0x34, 0x04, 0xc3, 0x80,
+  0x34, 0xc3, 0x0b, 0xec, 0x8f, 0x38, 0x24, 0x91, 0x09, 0x80, 0xc9, 0x89,
+  0xd9, 0xaa, 0x20, 0x14, 0xa2, 0x5a, 0x43, 0x11, 0x89, 0xda, 0xeb, 0x0a,
+  0x21, 0x32, 0x9a, 0x28, 0x33, 0xb8, 0xaf, 0x8a, 0xa2, 0xfb, 0x21, 0x21,
+  0x02, 0x08, 0xb6, 0xa8, 0xba, 0x26, 0x21, 0x08, 0x63, 0x08, 0xaa, 0x80,
+  0x73, 0x91, 0xaa, 0x80, 0x30, 0x48, 0x33, 0xc8, 0xbb, 0x8c, 0x80, 0xff,
+  0x49, 0x02, 0x01, 0x00, 0xa0, 0xa9, 0xb2, 0xff, 0x28, 0x80, 0xa9, 0x71,
+  0x34, 0xb0, 0x9d, 0x20, 0xa0, 0xbc, 0x30, 0x04, 0x98, 0x68, 0x03, 0xb9,
+  0x9b, 0x10, 0xeb, 0x9b, 0x30, 0x23, 0x18, 0x63, 0x84, 0xba, 0xab, 0x91,
+  0x19, 0x63, 0x82, 0x18, 0x71, 0x80, 0xbc, 0x08, 0x22, 0x08, 0x33, 0x22,
+  0x3b, 0x77, 0x94, 0xff, 0x8b, 0x42, 0x81, 0xab, 0x62, 0x14, 0xa0, 0x8b,
+  0x22, 0xd0, 0x9c, 0x20, 0x92, 0xbb, 0x60, 0x13, 0xda, 0x0a, 0x12, 0xc8,
+  0x8c, 0x31, 0x23, 0x98, 0x20, 0x12, 0xa9, 0x9b, 0x80, 0xcd, 0x09, 0x45,
+  0x82, 0x90, 0x00, 0x90, 0xa9, 0x90, 0x89, 0x50, 0x24, 0xa0, 0x9d, 0x89,
+  0xaa, 0x1a, 0x43, 0x08, 0x54, 0x24, 0xc0, 0x9a, 0x31, 0x23, 0x99, 0xf0,
+  0xff, 0x0f, 0x31, 0x81, 0xaa, 0x51, 0x15, 0xa8, 0x8b, 0x21, 0xb8, 0xad,
+  0x21, 0x91, 0x9b, 0x61, 0x83, 0xdb, 0x19, 0x13, 0x71, 0xfe, 0x45, 0x00,
+  0xb8, 0x8b, 0x35, 0x13, 0x99, 0x09, 0x82, 0xda, 0x9a, 0x80, 0x08, 0x21,
+  0x12, 0x02, 0x42, 0x12, 0xeb, 0x9b, 0x24, 0x00, 0x09, 0xa9, 0xbd, 0x0a,
+  0xa8, 0x8d, 0x34, 0x33, 0x43, 0x45, 0x82, 0xda, 0x1a, 0x12, 0x10, 0xb8,
+  0xff, 0xff, 0x20, 0x13, 0xb8, 0x2a, 0x46, 0x91, 0xab, 0x28, 0x80, 0xbc,
+  0x19, 0x02, 0xaa, 0x51, 0x23, 0xe9, 0x8a, 0x32, 0x91, 0x9c, 0x30, 0x15,
+  0x91, 0x9a, 0x99, 0x98, 0x89, 0x89, 0x00, 0x46, 0x23, 0xdb, 0x09, 0x23,
+  0xd9, 0x09, 0x32, 0x12, 0xa9, 0xa8, 0xdc, 0x0a, 0x13, 0xb9, 0x39, 0x57,
+  0x81, 0x89, 0x20, 0x91, 0xac, 0x39, 0x13, 0x40, 0x84, 0xff, 0xbf, 0x31,
+  0x24, 0xb9, 0x39, 0x36, 0x81, 0xac, 0x19, 0xa0, 0xbb, 0x19, 0x01, 0x88,
+  0x73, 0x13, 0xd9, 0x9a, 0x22, 0x92, 0xba, 0x39, 0x46, 0x82, 0xca, 0x9a,
+  0x08, 0x80, 0x89, 0x38, 0x54, 0x23, 0xc8, 0x9c, 0x10, 0x90, 0x99, 0x21,
+  0x13, 0x91, 0x90, 0xfd, 0x8a, 0x20, 0x02, 0x09, 0x24, 0x12, 0xb8, 0x0a,
+  0x80, 0xbd, 0x39, 0x27, 0x31, 0x54, 0xf0, 0xef, 0x19, 0x33, 0x92, 0xab,
+  0x73, 0x03, 0xb9, 0x9b, 0x80, 0xc9, 0x89, 0x12, 0x80, 0x38, 0x36, 0xa1,
+  0xbe, 0x18, 0x23, 0x91, 0x9b, 0x51, 0x33, 0xe9, 0xac, 0x19, 0x11, 0x01,
+  0x00, 0x31, 0x25, 0xb1, 0xbf, 0x18, 0x01, 0x88, 0x20, 0x02, 0x80, 0x89,
+  0xc9, 0xbd, 0x20, 0x35, 0x88, 0x0a, 0x22, 0x91, 0xab, 0x08, 0x80, 0x80,
+  0x73, 0x01, 0x72, 0x06, 0xfc, 0xbf, 0x30, 0x15, 0x90, 0x09, 0x34, 0x92,
+  0xdb, 0x8a, 0x88, 0x89, 0x18, 0x11, 0x88, 0x52, 0x13, 0xe9, 0x9c, 0x20,
+  0x24, 0x91, 0xab, 0x31, 0x04, 0xfb, 0x9c, 0x10, 0x32, 0x11, 0x98, 0x10,
+  0x23, 0xf9, 0x9d, 0x10, 0x12, 0x00, 0x08, 0x00, 0x99, 0x89, 0xb9, 0xac,
+  0x0b, 0xe8, 0x3b, 0x00, 0x72, 0x33, 0xa8, 0xab, 0x29, 0x03, 0xa0, 0x1a,
+  0x44, 0x03, 0xb9, 0x9d, 0x75, 0x83, 0xff, 0x9b, 0x40, 0x24, 0xa0, 0x0a,
+  0x53, 0x01, 0xdb, 0x8a, 0x08, 0x00, 0x18, 0x80, 0x89, 0x31, 0x14, 0xc8,
+  0xae, 0x30, 0x44, 0x81, 0xac, 0x18, 0x12, 0xc9, 0xad, 0x28, 0x33, 0x23,
+  0x98, 0x9b, 0x30, 0x92, 0xef, 0x1a, 0x32, 0x12, 0x99, 0x89, 0x90, 0x89,
+  0x10, 0xba, 0x3a, 0x77, 0x81, 0xbb, 0x8a, 0x31, 0x02, 0x09, 0x11, 0x22,
+  0x02, 0xfa, 0x9d, 0x42, 0x24, 0xfa, 0xcf, 0x28, 0x24, 0x82, 0xab, 0x50,
+  0x13, 0xc9, 0xbb, 0x08, 0x21, 0x80, 0x98, 0x89, 0x30, 0x25, 0xa0, 0xce,
+  0x28, 0x45, 0x01, 0xcb, 0x0a, 0x22, 0xb0, 0xae, 0x28, 0x43, 0x12, 0x98,
+  0xaa, 0x18, 0x03, 0xfc, 0x8a, 0x53, 0x01, 0x99, 0x89, 0x18, 0x88, 0x00,
+  0xa8, 0x18, 0x54, 0x91, 0xdc, 0x09, 0x22, 0x02, 0x98, 0x19, 0x33, 0x90,
+  0xbc, 0xbb, 0x73, 0x32, 0x93, 0xff, 0xaf, 0x41, 0x23, 0xb0, 0x8b, 0x44,
+  0x82, 0xcb, 0xab, 0x10, 0x12, 0x90, 0xaa, 0x28, 0x43, 0x11, 0xd9, 0xab,
+  0x72, 0x24, 0xa1, 0xbd, 0x18, 0x12, 0xd9, 0x8b, 0x31, 0x34, 0x82, 0xaa,
+  0x89, 0x20, 0x92, 0xcf, 0x0a, 0x35, 0x92, 0xaa, 0x09, 0x11, 0x88, 0x08,
+  0x90, 0x8a, 0x55, 0xa1, 0xcd, 0x19, 0x32, 0x01, 0x98, 0x18, 0x32, 0x91,
+  0xeb, 0x9c, 0x30, 0x33, 0x34, 0xfc, 0xef, 0x18, 0x43, 0x02, 0xba, 0x28,
+  0x25, 0xb8, 0xbc, 0x0a, 0x21, 0x01, 0x99, 0x89, 0x21, 0x21, 0x81, 0xdb,
+  0x1b, 0x75, 0x13, 0xc9, 0x9c, 0x10, 0x81, 0xca, 0x0a, 0x34, 0x14, 0x90,
+  0x99, 0x09, 0x10, 0x98, 0xbe, 0x1a, 0x37, 0x91, 0xab, 0x28, 0x21, 0x80,
+  0x88, 0xc8, 0x0b, 0x35, 0xc0, 0x9f, 0x28, 0x24, 0x90, 0x8a, 0x10, 0x12,
+  0xa0, 0xcb, 0x9a, 0x21, 0xbe, 0xfc, 0x37, 0x00, 0x25, 0x21, 0xd1, 0xff,
+  0x8f, 0x31, 0x14, 0xa0, 0x0a, 0x42, 0x81, 0xbc, 0xab, 0x10, 0x13, 0x80,
+  0xa9, 0x08, 0x22, 0x13, 0xb8, 0xbd, 0x60, 0x36, 0x81, 0xcc, 0x8b, 0x21,
+  0x90, 0xac, 0x29, 0x45, 0x12, 0xa8, 0x99, 0x88, 0x11, 0x00, 0xeb, 0x9b,
+  0x63, 0x02, 0xca, 0x19, 0x12, 0x12, 0x88, 0xba, 0x0c, 0x52, 0xb1, 0xbe,
+  0x30, 0x25, 0x90, 0xab, 0x10, 0x32, 0x81, 0xda, 0x0b, 0x01, 0x12, 0x43,
+  0x13, 0xff, 0xff, 0x20, 0x33, 0x80, 0xab, 0x41, 0x12, 0xca, 0xac, 0x19,
+  0x21, 0x11, 0x99, 0x9a, 0x20, 0x22, 0x01, 0xca, 0x1a, 0x57, 0x13, 0xda,
+  0xac, 0x10, 0x82, 0xb9, 0x1a, 0x54, 0x22, 0x98, 0xab, 0x08, 0x21, 0x91,
+  0xc9, 0xbb, 0x38, 0x24, 0xd1, 0x8c, 0x52, 0x33, 0x91, 0xbc, 0x0b, 0x21,
+  0xa1, 0xcd, 0x19, 0x35, 0x92, 0xbc, 0x09, 0x63, 0x12, 0x90, 0x8a, 0x99,
+  0xa9, 0xab, 0x71, 0x16, 0xfc, 0x9f, 0x31, 0x24, 0x91, 0xab, 0x40, 0x12,
+  0xc9, 0xbb, 0x09, 0x32, 0x11, 0xb9, 0x9c, 0x10, 0x24, 0x01, 0xc9, 0x1a,
+  0x47, 0x03, 0xeb, 0x9b, 0x21, 0x81, 0xba, 0x18, 0x35, 0x12, 0xa8, 0xbb,
+  0x89, 0x42, 0x12, 0xcb, 0x8b, 0x21, 0xb9, 0x29, 0x01, 0x63, 0x35, 0x03,
+  0xfa, 0x9c, 0x11, 0x91, 0xab, 0x28, 0x44, 0x91, 0xbc, 0x0b, 0x53, 0x33,
+  0x81, 0xaa, 0x99, 0xd8, 0xbc, 0x49, 0x47, 0xf0, 0xbd, 0x30, 0x35, 0x92,
+  0xbb, 0x40, 0x23, 0xc9, 0xac, 0x09, 0x21, 0x11, 0xb9, 0x9b, 0x28, 0x43,
+  0x03, 0xc9, 0x1b, 0x66, 0x12, 0xd9, 0xab, 0x20, 0x81, 0xba, 0x0a, 0x35,
+  0x23, 0x90, 0xba, 0x8b, 0x41, 0x14, 0xb0, 0xbb, 0x20, 0xe8, 0x8c, 0x02,
+  0x10, 0x42, 0x25, 0xb0, 0x9e, 0x28, 0x02, 0xa9, 0x89, 0x21, 0x81, 0xcc,
+  0x9c, 0x30, 0x36, 0x03, 0x90, 0xaa, 0x99, 0xbc, 0x5f, 0xf7, 0x37, 0x00,
+  0x28, 0x47, 0x84, 0xfe, 0x9c, 0x41, 0x24, 0xa0, 0x8b, 0x42, 0x02, 0xcb,
+  0x9b, 0x00, 0x00, 0x01, 0x90, 0xab, 0x19, 0x45, 0x02, 0xdb, 0x2a, 0x37,
+  0x82, 0xdb, 0x8a, 0x21, 0xa8, 0x9b, 0x31, 0x22, 0x22, 0x01, 0xfb, 0x8b,
+  0x44, 0x02, 0xbb, 0x19, 0x03, 0xce, 0x1a, 0x13, 0x08, 0x44, 0x81, 0xcb,
+  0x1a, 0x24, 0xc8, 0x0b, 0x33, 0x90, 0xad, 0xba, 0x08, 0x62, 0x33, 0x23,
+  0x80, 0xca, 0xac, 0x8a, 0x10, 0x54, 0xc1, 0xff, 0x1c, 0x43, 0x12, 0xba,
+  0x39, 0x25, 0xb8, 0x9c, 0x08, 0x88, 0x08, 0x11, 0xb9, 0x9d, 0x30, 0x25,
+  0xa0, 0x8c, 0x62, 0x33, 0xb8, 0xad, 0x08, 0x80, 0xaa, 0x18, 0x02, 0x20,
+  0x34, 0xa2, 0xcf, 0x38, 0x33, 0xa0, 0x9b, 0x11, 0xd0, 0xab, 0x22, 0xa9,
+  0x58, 0x35, 0xa0, 0xae, 0x20, 0x03, 0x99, 0x28, 0x11, 0x90, 0xda, 0xbd,
+  0x19, 0x43, 0x24, 0x02, 0x91, 0xbc, 0x8a, 0xa9, 0x29, 0x67, 0xa1, 0xff,
+  0x0b, 0x34, 0x13, 0xb9, 0x29, 0x25, 0xb8, 0xac, 0x00, 0x98, 0x09, 0x32,
+  0xd8, 0x9d, 0x30, 0x23, 0xb8, 0x0c, 0x54, 0x23, 0xb9, 0xac, 0x18, 0xa8,
+  0x99, 0x21, 0x91, 0x10, 0x26, 0xb0, 0x9f, 0x30, 0x14, 0x98, 0x88, 0x80,
+  0xaa, 0x10, 0xc9, 0x9c, 0x63, 0x12, 0xba, 0x8b, 0x32, 0x01, 0x08, 0x31,
+  0x23, 0xb0, 0xef, 0x8a, 0x09, 0x31, 0x26, 0x02, 0xba, 0x1b, 0x80, 0x30,
+  0x35, 0xf3, 0xff, 0x0f, 0x32, 0x03, 0xaa, 0x38, 0x14, 0xda, 0x8a, 0x11,
+  0xa8, 0x19, 0x22, 0xd9, 0xac, 0x32, 0x13, 0xba, 0x3a, 0x47, 0x02, 0xb9,
+  0x9a, 0x98, 0xa9, 0x18, 0x23, 0xa8, 0x48, 0x15, 0xf9, 0x8b, 0x42, 0x12,
+  0x98, 0x08, 0xa0, 0x0b, 0x01, 0xeb, 0x19, 0x35, 0x01, 0xeb, 0x89, 0x10,
+  0x10, 0x11, 0x11, 0x34, 0xa1, 0xdf, 0x89, 0x18, 0x20, 0x23, 0x23, 0xe9,
+  0xc1, 0x09, 0x3e, 0x00, 0x9b, 0x18, 0x21, 0x11, 0x23, 0xff, 0xff, 0x21,
+  0x23, 0xa8, 0x1a, 0x24, 0xb8, 0x9c, 0x21, 0xa8, 0x8c, 0x32, 0xb1, 0xaf,
+  0x20, 0x12, 0xa9, 0x29, 0x35, 0x03, 0xa9, 0xa9, 0xba, 0x9b, 0x41, 0x13,
+  0xbc, 0x48, 0x14, 0xfb, 0x0a, 0x33, 0x11, 0x09, 0x12, 0xda, 0x1b, 0x14,
+  0xdb, 0x29, 0x33, 0xa8, 0xad, 0x08, 0x90, 0x30, 0x26, 0x80, 0x21, 0x83,
+  0xdf, 0x8a, 0x21, 0x80, 0x20, 0x34, 0xb0, 0xae, 0x08, 0x01, 0x21, 0x53,
+  0xf1, 0xdf, 0x1a, 0x63, 0x82, 0x99, 0x20, 0x03, 0xcc, 0x29, 0x82, 0xca,
+  0x29, 0x14, 0xda, 0x0a, 0x22, 0xa0, 0x8b, 0x63, 0x22, 0x88, 0x80, 0xb8,
+  0xad, 0x20, 0x12, 0xc9, 0x19, 0x33, 0xd8, 0x9c, 0x20, 0x02, 0x20, 0x44,
+  0xb0, 0x8e, 0x32, 0xc0, 0x9c, 0x32, 0x82, 0xbb, 0x0a, 0x90, 0x0a, 0x46,
+  0x81, 0x19, 0x53, 0xb0, 0xcd, 0x08, 0x12, 0x90, 0x30, 0x04, 0xca, 0xab,
+  0x08, 0x32, 0x43, 0x44, 0xf1, 0xff, 0x09, 0x24, 0x82, 0xa9, 0x42, 0x91,
+  0xbc, 0x30, 0x92, 0xbd, 0x31, 0x03, 0xcd, 0x18, 0x02, 0xb9, 0x39, 0x35,
+  0x81, 0x08, 0x01, 0xfa, 0x8a, 0x31, 0x80, 0x9b, 0x30, 0x03, 0xdd, 0x19,
+  0x02, 0x90, 0x30, 0x15, 0xb8, 0x28, 0x14, 0xdc, 0x0a, 0x33, 0xa0, 0xac,
+  0x08, 0xa8, 0x19, 0x36, 0x81, 0x31, 0x34, 0xd9, 0xbc, 0x18, 0x01, 0x0a,
+  0x42, 0x01, 0xbb, 0xcb, 0xa9, 0x28, 0x57, 0x12, 0x81, 0xff, 0x8f, 0x31,
+  0x13, 0xa8, 0x39, 0x14, 0xea, 0x1a, 0x13, 0xda, 0x09, 0x23, 0xc0, 0x8c,
+  0x31, 0xa0, 0x9b, 0x53, 0x03, 0x88, 0x20, 0xa2, 0xbf, 0x28, 0x12, 0xb9,
+  0x1a, 0x24, 0xc0, 0x9b, 0x31, 0xb8, 0x0c, 0x47, 0x82, 0x9a, 0x10, 0xb1,
+  0xbc, 0x20, 0x04, 0xa9, 0x19, 0xb8, 0xaf, 0x41, 0x04, 0x08, 0x21, 0x03,
+  0xeb, 0x9a, 0x00, 0x08, 0x21, 0xfd, 0x3c, 0x00, 0x31, 0x12, 0xb9, 0xbb,
+  0xdc, 0x8a, 0x42, 0x23, 0x72, 0x14, 0xfa, 0xcf, 0x28, 0x33, 0x81, 0x08,
+  0x24, 0xc0, 0x9c, 0x11, 0xc0, 0xab, 0x53, 0x81, 0xbb, 0x28, 0x82, 0xbe,
+  0x40, 0x14, 0x80, 0x20, 0x02, 0xcc, 0x8a, 0x12, 0xa8, 0x09, 0x34, 0xa0,
+  0x9d, 0x10, 0xa8, 0x8c, 0x73, 0x12, 0x88, 0x08, 0x88, 0xcb, 0x18, 0x21,
+  0x80, 0x89, 0xdb, 0xbb, 0x40, 0x23, 0x18, 0x54, 0x13, 0xb9, 0x9d, 0x99,
+  0x18, 0x22, 0x92, 0x98, 0x19, 0xde, 0xba, 0x28, 0x43, 0x32, 0x31, 0x94,
+  0x19, 0x37, 0xfb, 0xff, 0x18, 0x33, 0x80, 0x00, 0x12, 0xd9, 0x8a, 0x22,
+  0xb9, 0x0b, 0x33, 0xe8, 0x8c, 0x10, 0xb8, 0x0b, 0x36, 0x02, 0x08, 0x32,
+  0xc0, 0xac, 0x20, 0x02, 0xa9, 0x10, 0xa2, 0xdb, 0x8b, 0x89, 0xab, 0x74,
+  0x27, 0x81, 0x88, 0xa9, 0x88, 0x8a, 0x00, 0x01, 0x81, 0xfa, 0xbc, 0x8b,
+  0x31, 0x44, 0x22, 0x43, 0x81, 0xba, 0xad, 0xaa, 0x28, 0x44, 0x01, 0xb9,
+  0x9c, 0xba, 0xbb, 0x58, 0x25, 0x12, 0x91, 0x22, 0xd9, 0xaa, 0x62, 0x22,
+  0xfb, 0x8d, 0x21, 0x01, 0x98, 0x20, 0x82, 0x8a, 0x64, 0x82, 0xa9, 0x08,
+  0xc0, 0xbc, 0x88, 0xa0, 0xdb, 0x00, 0x83, 0x90, 0x41, 0x22, 0x91, 0x21,
+  0x26, 0x13, 0xba, 0xa9, 0x08, 0xab, 0xc3, 0xfb, 0x19, 0x20, 0x64, 0x13,
+  0x99, 0x0a, 0x84, 0x93, 0xaa, 0x80, 0x33, 0xf0, 0xaf, 0xaa, 0x08, 0x12,
+  0x28, 0x36, 0x21, 0x11, 0xd0, 0x99, 0xa0, 0xa2, 0x0b, 0x08, 0xc8, 0xae,
+  0x0a, 0x38, 0x80, 0x0c, 0x17, 0x01, 0x10, 0x83, 0xb0, 0xcf, 0x09, 0x68,
+  0x24, 0x98, 0x91, 0xfa, 0x8d, 0x18, 0x21, 0x23, 0x63, 0x03, 0x99, 0x20,
+  0xb8, 0xae, 0x0b, 0x90, 0x9d, 0x09, 0xb9, 0xab, 0x19, 0x36, 0x23, 0x53,
+  0x13, 0x9b, 0x39, 0x14, 0xa9, 0x20, 0x85, 0xfb, 0xd4, 0x02, 0x33, 0x00,
+  0x9d, 0x81, 0x80, 0x31, 0x35, 0x90, 0x91, 0x8a, 0xc9, 0x9b, 0x21, 0x85,
+  0xa0, 0xd9, 0xc0, 0x09, 0x28, 0x58, 0x53, 0x43, 0xa2, 0x9b, 0xb9, 0xbc,
+  0x0d, 0x11, 0x92, 0xbc, 0x29, 0xda, 0x8c, 0x33, 0x15, 0x11, 0x08, 0x8a,
+  0xda, 0xcb, 0x30, 0x16, 0x18, 0x38, 0x12, 0xd9, 0xb9, 0x8c, 0x82, 0x22,
+  0xd2, 0xbf, 0x08, 0x14, 0x11, 0x42, 0x04, 0x90, 0x19, 0x91, 0x0a, 0xda,
+  0xa9, 0xa8, 0xbd, 0x89, 0x68, 0x02, 0x08, 0x08, 0x15, 0x82, 0xa0, 0xe8,
+  0xab, 0x42, 0xa2, 0xda, 0x19, 0x04, 0x21, 0x80, 0x33, 0x48, 0x83, 0xd0,
+  0xcf, 0x1a, 0x82, 0x80, 0xa9, 0x52, 0xa2, 0xaa, 0x20, 0x80, 0x80, 0x77,
+  0x23, 0xa8, 0x89, 0x12, 0xd0, 0xdb, 0x20, 0x83, 0xc9, 0x1d, 0x91, 0xbb,
+  0xa9, 0x20, 0x38, 0x38, 0x67, 0x80, 0x18, 0xa0, 0xa0, 0x3a, 0xb2, 0x80,
+  0x4b, 0x08, 0x08, 0x9f, 0x32, 0x02, 0xaf, 0x82, 0x32, 0x02, 0x08, 0xcf,
+  0x0a, 0x28, 0x50, 0x98, 0x5a, 0x81, 0x89, 0x80, 0x80, 0xbb, 0x7c, 0x27,
+  0x98, 0x9a, 0x80, 0x01, 0xac, 0x11, 0x82, 0xa0, 0xbb, 0x24, 0xc0, 0xad,
+  0x22, 0x05, 0x2a, 0x22, 0x20, 0xc0, 0x80, 0xc0, 0xfb, 0x08, 0x88, 0x0a,
+  0x08, 0x0c, 0xac, 0x1e, 0x42, 0x03, 0x08, 0x22, 0xf0, 0x10, 0x21, 0x02,
+  0xb8, 0x4b, 0x08, 0xbc, 0x0b, 0xc8, 0x48, 0x24, 0x30, 0xf8, 0x8a, 0x80,
+  0x33, 0x8b, 0x0c, 0x08, 0x08, 0x08, 0xf8, 0x8b, 0x07, 0x04, 0xa8, 0x83,
+  0x3b, 0x24, 0x30, 0x08, 0x0d, 0x43, 0xf8, 0xbb, 0x98, 0x78, 0x93, 0x18,
+  0x12, 0xca, 0x2a, 0x20, 0x0b, 0x8b, 0x70, 0x23, 0x08, 0x8b, 0xc0, 0xf8,
+  0xa9, 0xa2, 0x52, 0x82, 0xa0, 0x3b, 0x8b, 0x8f, 0x58, 0x08, 0x82, 0x80,
+  0x0b, 0x70, 0x01, 0x2a, 0x80, 0x4b, 0xbb, 0x80, 0x70, 0x90, 0x9e, 0x89,
+  0xbd, 0xfd, 0x2c, 0x00, 0x00, 0x08, 0x02, 0x83, 0x34, 0x84, 0x84, 0xc0,
+  0xad, 0x9c, 0x2a, 0xb0, 0x30, 0x26, 0x8c, 0x89, 0x0a, 0x02, 0x48, 0x78,
+  0x80, 0x10, 0x20, 0xcd, 0x01, 0x0a, 0xa8, 0x38, 0x07, 0x9c, 0x10, 0x12,
+  0xda, 0x89, 0x40, 0x80, 0x50, 0x48, 0x21, 0xbc, 0x80, 0x80, 0xb0, 0xc0,
+  0x16, 0xa0, 0xbc, 0x28, 0x38, 0x08, 0x08, 0x08, 0x78, 0x24, 0xaa, 0x08,
+  0x08, 0x84, 0x8b, 0x80, 0xff, 0x80, 0x10, 0x01, 0x21, 0x83, 0x0b, 0x78,
+  0x00, 0xaa, 0x32, 0x08, 0xc8, 0x0c, 0xb3, 0xad, 0x1e, 0xa2, 0x8a, 0x30,
+  0x17, 0x91, 0xaa, 0x15, 0x00, 0xcb, 0x1c, 0x12, 0x20, 0x83, 0x3b, 0x8b,
+  0xcf, 0x60, 0x12, 0xa0, 0x80, 0x80, 0xaa, 0xbb, 0xc8, 0x03, 0x08, 0x08,
+  0x78, 0x83, 0xc0, 0x03, 0x08, 0xbd, 0x07, 0x21, 0xa2, 0xb8, 0x9f, 0x08,
+  0x80, 0x38, 0x30, 0x48, 0x43, 0xe8, 0x0a, 0xba, 0xb0, 0x7b, 0xa2, 0x60,
+  0x11, 0x82, 0x08, 0xb0, 0xb0, 0xc3, 0x80, 0xcb, 0x8b, 0x0c, 0x08, 0x08,
+  0x08, 0xb6, 0x27, 0x82, 0x83, 0x83, 0xcb, 0xbf, 0x21, 0x9c, 0x41, 0x30,
+  0xa2, 0x0d, 0xa1, 0x80, 0xb3, 0x70, 0x03, 0xaa, 0x20, 0xf0, 0x89, 0xa0,
+  0x22, 0xb0, 0xb8, 0x67, 0x90, 0x89, 0x12, 0x08, 0xbd, 0x10, 0xa9, 0x0b,
+  0x0b, 0x17, 0xa9, 0x52, 0xa2, 0x0a, 0x38, 0x38, 0xb4, 0x9f, 0x21, 0x0a,
+  0x9e, 0x89, 0x14, 0x10, 0x02, 0x38, 0xb8, 0x80, 0x80, 0xf0, 0x1d, 0xa2,
+  0x20, 0x87, 0x8e, 0x00, 0x88, 0x03, 0x08, 0x08, 0x68, 0x98, 0x98, 0xbd,
+  0x19, 0x02, 0xa8, 0x36, 0x96, 0x19, 0x00, 0x0a, 0xa8, 0x2a, 0x33, 0x8b,
+  0x35, 0xc3, 0x0b, 0xf8, 0x08, 0xba, 0x33, 0x08, 0x03, 0x3d, 0xfb, 0x88,
+  0x80, 0x80, 0x8b, 0x04, 0x43, 0x24, 0xc0, 0x8a, 0x8e, 0x80, 0xb0, 0xc0,
+  0x80, 0x80, 0x80, 0x00, 0x14, 0xfc, 0x20, 0x00, 0x78, 0x48, 0x38, 0xb3,
+  0x8c, 0x34, 0x83, 0x80, 0xbd, 0xaf, 0x40, 0x80, 0x28, 0x0a, 0x08, 0x48,
+  0x30, 0x80, 0x80, 0x70, 0xb8, 0x80, 0xdf, 0x38, 0x99, 0x21, 0x20, 0x03,
+  0x48, 0xc0, 0xfb, 0x80, 0x82, 0x80, 0x80, 0x30, 0xd0, 0x70, 0x01, 0x88,
+  0xb9, 0x83, 0x03, 0x80, 0x68, 0xb8, 0xc0, 0x08, 0x08, 0x08, 0x36, 0xc0,
+  0x08, 0x08, 0x08, 0x08, 0x8f, 0x34, 0xcb, 0xb8, 0x8b, 0x37, 0x8a, 0x80,
+  0x84, 0x33, 0x80, 0xd0, 0x08, 0x80, 0x08, 0x06, 0x8c, 0x00, 0xad, 0x08,
+  0x08, 0xdf, 0x51, 0x82, 0x08, 0x10, 0x0a, 0x08, 0x0b, 0x08, 0x8c, 0x80,
+  0x80, 0xcd, 0x80, 0x40, 0x43, 0x8b, 0xc0, 0x03, 0x88, 0xb5, 0x40, 0x83,
+  0x80, 0x80, 0x80, 0x80, 0x8f, 0x3d, 0x03, 0x3c, 0x80, 0xb4, 0x8c, 0xcb,
+  0x3b, 0x04, 0x03, 0x08, 0x68, 0x30, 0x0c, 0xaf, 0x89, 0x80, 0x0b, 0x48,
+  0x80, 0x80, 0x08, 0x60, 0x08, 0x84, 0x80, 0x50, 0x83, 0x40, 0x8b, 0xd0,
+  0x8b, 0x80, 0x80, 0xf0, 0x0b, 0x0c, 0x48, 0x08, 0x3c, 0x78, 0x20, 0x8a,
+  0xb0, 0xc0, 0x80, 0xc0, 0x80, 0x40, 0x08, 0x3c, 0x84, 0xc0, 0x80, 0x0c,
+  0x03, 0x07, 0xa2, 0x08, 0x08, 0x08, 0x9f, 0x02, 0x38, 0x80, 0xd0, 0x03,
+  0x03, 0x0d, 0x83, 0x3c, 0x34, 0x08, 0x08, 0x0d, 0x43, 0x8b, 0xbc, 0xc0,
+  0x48, 0x3b, 0xc0, 0xb8, 0xc8, 0x07, 0x8c, 0x00, 0x88, 0x30, 0x02, 0xb8,
+  0x3d, 0x48, 0x33, 0xc0, 0x83, 0xd0, 0xb0, 0xc8, 0xc0, 0x48, 0x38, 0x80,
+  0x80, 0x85, 0x04, 0x0c, 0xb8, 0x80, 0x80, 0xcd, 0x30, 0x03, 0x9f, 0xa0,
+  0x38, 0xb3, 0x03, 0x7d, 0x91, 0x28, 0x0a, 0xb8, 0x0b, 0x08, 0x08, 0x3f,
+  0x83, 0xb4, 0x48, 0x08, 0x08, 0x08, 0xb5, 0x08, 0x08, 0x78, 0x83, 0xcb,
+  0x08, 0x08, 0x08, 0x86, 0x80, 0x0c, 0x08, 0x88, 0xec, 0xff, 0x20, 0x00,
+  0xb7, 0x80, 0xb4, 0x80, 0x08, 0x08, 0xbe, 0xc8, 0x30, 0x27, 0xa0, 0x08,
+  0x08, 0x80, 0xb4, 0x8c, 0x84, 0x84, 0xc0, 0xb3, 0x80, 0x80, 0x80, 0x08,
+  0x80, 0x78, 0x01, 0x0e, 0x08, 0x08, 0x08, 0x88, 0x70, 0x8b, 0x00, 0x88,
+  0xb7, 0x80, 0x04, 0x03, 0xd8, 0x43, 0xfb, 0x80, 0x80, 0x20, 0xa8, 0x88,
+  0xb4, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xdf, 0x8d, 0x34,
+  0x07, 0x2a, 0xb0, 0xb0, 0x4b, 0xb8, 0x48, 0x84, 0x3b, 0xb4, 0x80, 0x0c,
+  0x03, 0x0d, 0x48, 0xbb, 0x0c, 0x33, 0xf0, 0xab, 0x32, 0x83, 0xc0, 0x08,
+  0xc8, 0x64, 0x08, 0x8c, 0x04, 0x08, 0x08, 0x88, 0x30, 0xc0, 0x8b, 0xb4,
+  0xbc, 0x84, 0x06, 0x08, 0x08, 0x08, 0x83, 0x40, 0xf0, 0x88, 0xd0, 0x28,
+  0x0a, 0x22, 0x80, 0x8b, 0x35, 0x0c, 0x78, 0xb9, 0x28, 0x08, 0x0e, 0x83,
+  0x2c, 0x08, 0xa8, 0x32, 0x03, 0x0c, 0x88, 0xbc, 0x48, 0x84, 0x30, 0x00,
+  0x58, 0x8b, 0xcc, 0x0b, 0x53, 0xb8, 0x30, 0xc0, 0x0c, 0x33, 0xbc, 0x84,
+  0xc0, 0x30, 0x43, 0xc0, 0x33, 0x80, 0x8c, 0x04, 0x08, 0x08, 0xbe, 0x30,
+  0xc0, 0x08, 0x04, 0x3c, 0xbc, 0x0b, 0x34, 0x08, 0x80, 0x08, 0x08, 0x07,
+  0x04, 0x08, 0x88, 0xe0, 0x48, 0xc0, 0x80, 0xc0, 0xc0, 0x30, 0x8b, 0x34,
+  0x40, 0xac, 0x08, 0xc8, 0x30, 0x80, 0x50, 0x80, 0x80, 0xe0, 0x08, 0x3c,
+  0xb4, 0xcb, 0x06, 0x08, 0x08, 0x08, 0xf8, 0x08, 0x08, 0x68, 0x91, 0x01,
+  0x08, 0xeb, 0x10, 0x0a, 0xa2, 0x86, 0x8b, 0x80, 0x96, 0x28, 0xaa, 0x08,
+  0x48, 0x02, 0x08, 0x08, 0xd8, 0x48, 0x80, 0x80, 0x80, 0xf0, 0x80, 0x0c,
+  0x03, 0x08, 0x88, 0xf0, 0x33, 0xf0, 0x88, 0x80, 0x80, 0x80, 0xb4, 0x48,
+  0x30, 0x40, 0x8b, 0x80, 0xb5, 0x08, 0x08, 0x08, 0xb7, 0x0c, 0x83, 0x80,
+  0xe9, 0xff, 0x22, 0x00, 0x35, 0xc0, 0xcb, 0x03, 0xf8, 0x48, 0x08, 0x08,
+  0x80, 0xb8, 0x84, 0xc0, 0x4b, 0x08, 0x83, 0x00, 0xbd, 0x88, 0x87, 0x28,
+  0x80, 0xcb, 0x30, 0x84, 0x03, 0xd0, 0x80, 0x08, 0x80, 0x78, 0x08, 0x08,
+  0x08, 0x85, 0x8b, 0x80, 0x8d, 0x80, 0x80, 0xf0, 0x30, 0x08, 0x08, 0x68,
+  0x03, 0x08, 0x50, 0x0c, 0x08, 0x1f, 0xa8, 0x80, 0x80, 0x40, 0x48, 0x0b,
+  0x03, 0xf8, 0x09, 0x02, 0xc8, 0x80, 0x80, 0x80, 0xb6, 0x03, 0x84, 0xaf,
+  0x20, 0xa8, 0x83, 0x80, 0x04, 0x8c, 0x00, 0x03, 0x0d, 0x08, 0x88, 0x00,
+  0x8f, 0x84, 0x30, 0xc8, 0x80, 0x0c, 0x48, 0x03, 0xd0, 0x80, 0x80, 0xf8,
+  0x09, 0x25, 0x28, 0xb0, 0x0b, 0xb8, 0x84, 0x80, 0xd0, 0x08, 0x08, 0x08,
+  0x78, 0x07, 0x08, 0xaa, 0xa8, 0x08, 0x88, 0x00, 0x68, 0xcb, 0x0b, 0x73,
+  0x00, 0x2a, 0x80, 0xcb, 0xbb, 0x34, 0x78, 0xa2, 0xa0, 0x3b, 0x83, 0x40,
+  0xb8, 0x58, 0xb8, 0x80, 0xd0, 0x33, 0x25, 0xb0, 0x8c, 0xbb, 0x58, 0x08,
+  0x03, 0xd8, 0xc0, 0x03, 0x08, 0x08, 0x88, 0xf0, 0x08, 0x8c, 0x84, 0x0b,
+  0x08, 0x08, 0x86, 0x40, 0x08, 0x80, 0x08, 0x80, 0x8f, 0x34, 0x08, 0xb4,
+  0xec, 0x01, 0xb2, 0x30, 0x38, 0x80, 0x8c, 0xc0, 0x48, 0x80, 0x0c, 0x08,
+  0xbd, 0x03, 0x08, 0x80, 0x08, 0x8f, 0x40, 0x17, 0x01, 0x80, 0x8a, 0x0b,
+  0x0c, 0x48, 0xb8, 0x80, 0x80, 0x3d, 0x04, 0x08, 0xb4, 0x84, 0xc0, 0x08,
+  0x58, 0x38, 0xc0, 0x80, 0x3c, 0x80, 0x80, 0x8d, 0xd0, 0x0b, 0x84, 0x30,
+  0x80, 0x80, 0xaf, 0x06, 0x28, 0x08, 0xbb, 0x40, 0xb8, 0x84, 0x80, 0x04,
+  0x08, 0x88, 0x60, 0x30, 0xd0, 0xc0, 0x80, 0x80, 0x04, 0x08, 0xd8, 0xfb,
+  0x08, 0x08, 0x02, 0x8b, 0xc0, 0x0c, 0x3b, 0x64, 0x01, 0x28, 0xb0, 0x00,
+  0xc8, 0x30, 0x80, 0x50, 0x03, 0x01, 0x25, 0x00, 0x0c, 0x48, 0x83, 0x80,
+  0xb5, 0xcb, 0xbb, 0x80, 0x44, 0x08, 0x08, 0xd0, 0x08, 0x58, 0x33, 0x08,
+  0xbd, 0xc0, 0x03, 0x03, 0xd8, 0x03, 0xc8, 0x80, 0x44, 0x08, 0x08, 0xd0,
+  0x8b, 0x08, 0x85, 0x4b, 0xb8, 0xaf, 0x28, 0x50, 0x10, 0xa0, 0xbb, 0x30,
+  0x40, 0x80, 0x80, 0xf0, 0xba, 0x8b, 0x34, 0x34, 0x08, 0x08, 0x8d, 0x40,
+  0x03, 0x88, 0x05, 0x0c, 0x08, 0x3c, 0x08, 0x08, 0x8d, 0x0c, 0x43, 0x03,
+  0x08, 0x0d, 0x8c, 0x40, 0x38, 0x80, 0xcc, 0x8a, 0x0c, 0x08, 0x07, 0x80,
+  0x80, 0x8e, 0x80, 0x05, 0x28, 0x8a, 0x80, 0x80, 0x40, 0x33, 0xdb, 0xb3,
+  0x0c, 0x06, 0x82, 0x08, 0x9e, 0x28, 0x22, 0x23, 0xc0, 0x0e, 0x1c, 0x89,
+  0x20, 0x0b, 0x0b, 0x8c, 0x00, 0x48, 0x84, 0x0b, 0x8c, 0x80, 0x35, 0x83,
+  0x0c, 0x08, 0x08, 0x08, 0x78, 0x80, 0x80, 0x8c, 0x3c, 0x04, 0x03, 0xbd,
+  0xc0, 0x30, 0x84, 0x80, 0x80, 0xbd, 0x0c, 0x43, 0x08, 0xbc, 0xc0, 0x0b,
+  0x03, 0x58, 0x80, 0xd0, 0x0b, 0x24, 0x00, 0x53, 0xb8, 0x84, 0x8e, 0x04,
+  0x01, 0xaa, 0x8b, 0x00, 0x48, 0x80, 0xe5, 0x08, 0x0a, 0x38, 0x02, 0xbc,
+  0xf0, 0x08, 0x71, 0x81, 0x80, 0x90, 0x28, 0x82, 0x80, 0xbb, 0x8c, 0xc0,
+  0x48, 0x33, 0x08, 0xf8, 0x09, 0x68, 0xa9, 0xa0, 0x08, 0x08, 0x73, 0x00,
+  0xa8, 0xba, 0x0c, 0x33, 0x97, 0x2a, 0x22, 0x83, 0xc0, 0x80, 0x40, 0x08,
+  0x08, 0x3d, 0xb4, 0x8b, 0x80, 0x0d, 0x08, 0x3d, 0x8b, 0xbc, 0x80, 0x04,
+  0x08, 0x8d, 0x00, 0x74, 0x82, 0x24, 0x88, 0x0a, 0x0b, 0x3b, 0x44, 0xbb,
+  0x80, 0x80, 0x35, 0xcb, 0xb8, 0x3c, 0x80, 0xfc, 0x2a, 0x12, 0x0d, 0x08,
+  0x38, 0x38, 0x08, 0x80, 0x08, 0x80, 0xf8, 0x0c, 0x33, 0x80, 0x80, 0x70,
+  0x83, 0x8b, 0x04, 0x08, 0x8d, 0x8b, 0x35, 0xb8, 0x16, 0x01, 0x24, 0x00,
+  0x08, 0x08, 0x78, 0x48, 0xbb, 0x80, 0x04, 0x08, 0x08, 0x05, 0xc8, 0xbc,
+  0x80, 0x80, 0x05, 0x0c, 0x08, 0x03, 0xf5, 0xa9, 0x89, 0x80, 0x63, 0x01,
+  0x2a, 0x0a, 0x08, 0x07, 0xa1, 0xaa, 0x8a, 0x03, 0x84, 0xb4, 0xb8, 0xbc,
+  0x48, 0xb3, 0x3c, 0xf0, 0x8a, 0x80, 0x86, 0x80, 0xd0, 0x19, 0x20, 0x52,
+  0x08, 0xaa, 0x15, 0x80, 0x32, 0x08, 0xb8, 0x8c, 0x80, 0xe5, 0x9a, 0x08,
+  0x32, 0x02, 0xec, 0xa9, 0x22, 0x35, 0x80, 0xb0, 0x8a, 0x84, 0x73, 0xb8,
+  0xa9, 0x0d, 0x21, 0x01, 0xa8, 0xbb, 0x08, 0x44, 0x08, 0x3c, 0xcb, 0x17,
+  0x91, 0xa8, 0xaa, 0x20, 0x17, 0x20, 0xaa, 0x0b, 0x0b, 0x73, 0xa2, 0xac,
+  0x89, 0x32, 0x33, 0xc0, 0xcb, 0x3b, 0x07, 0x01, 0x80, 0xb0, 0x48, 0xbb,
+  0xc3, 0x80, 0xbc, 0xc8, 0x30, 0x00, 0x88, 0x0e, 0x73, 0x02, 0xaa, 0x0b,
+  0x33, 0x34, 0x80, 0xbc, 0x88, 0x8c, 0x85, 0xc0, 0x3b, 0xc0, 0x43, 0xb8,
+  0xfb, 0xaa, 0x24, 0x22, 0xab, 0x08, 0x78, 0x94, 0xab, 0x20, 0x08, 0x33,
+  0x08, 0xb4, 0x88, 0x00, 0x88, 0x07, 0x08, 0x9f, 0x32, 0x02, 0xfb, 0x0a,
+  0x58, 0x08, 0x08, 0xba, 0x80, 0x70, 0xa2, 0x80, 0xb0, 0x0b, 0x08, 0x44,
+  0x08, 0xcf, 0x80, 0x12, 0x24, 0x8a, 0x0a, 0x83, 0x03, 0xc8, 0x8f, 0x12,
+  0x23, 0x0b, 0xcb, 0x0b, 0x48, 0x73, 0x94, 0xba, 0xa9, 0x22, 0x23, 0xbb,
+  0xf8, 0x39, 0x35, 0x98, 0xa8, 0x3b, 0x03, 0x58, 0xbb, 0x0c, 0x08, 0x58,
+  0xb8, 0x80, 0x80, 0x45, 0x08, 0xbc, 0xc0, 0x6a, 0x22, 0x88, 0xba, 0x0f,
+  0x61, 0x08, 0xba, 0x98, 0x28, 0x15, 0xa2, 0xaa, 0x02, 0x33, 0x08, 0x08,
+  0x8d, 0x0c, 0x43, 0x80, 0xd0, 0xbb, 0x40, 0x87, 0xa0, 0x9a, 0x6b, 0x83,
+  0xa2, 0xaa, 0x0e, 0x48, 0x01, 0xa8, 0xac, 0x80, 0x32, 0x83, 0x80, 0xd0,
+  0xff, 0xfe, 0x26, 0x00, 0x8b, 0x34, 0x04, 0x0c, 0x8b, 0x34, 0x83, 0xf0,
+  0x0b, 0x82, 0x6a, 0xa2, 0x9d, 0x80, 0x42, 0xa0, 0xa2, 0xbb, 0x80, 0x70,
+  0xa3, 0xdb, 0x0a, 0x38, 0x45, 0xa9, 0xa9, 0x38, 0x45, 0x91, 0x0a, 0x2a,
+  0x02, 0x83, 0xdb, 0x0b, 0x08, 0x44, 0xc3, 0xb0, 0x08, 0x3c, 0x40, 0x08,
+  0xaf, 0x28, 0x32, 0x08, 0xac, 0xc8, 0x30, 0x34, 0xf8, 0x28, 0x2a, 0x08,
+  0x0b, 0x0c, 0xc8, 0x70, 0x28, 0x08, 0xa8, 0x2a, 0x84, 0x3b, 0x00, 0xed,
+  0x08, 0x14, 0x89, 0x80, 0x8a, 0x30, 0x00, 0xd8, 0xf3, 0x48, 0x01, 0x0a,
+  0x08, 0x08, 0x48, 0xc0, 0xb8, 0xb4, 0x80, 0x40, 0x08, 0x8c, 0x04, 0x08,
+  0x08, 0x88, 0xce, 0x0b, 0x24, 0x84, 0x80, 0x8b, 0x50, 0xb8, 0x08, 0xd8,
+  0x08, 0x0d, 0x48, 0x08, 0x08, 0x08, 0x78, 0x02, 0x8f, 0x82, 0xa9, 0x52,
+  0x80, 0xd0, 0x08, 0x28, 0x83, 0xbb, 0x70, 0x89, 0x02, 0x38, 0xb4, 0x80,
+  0x80, 0xd0, 0xf3, 0x9c, 0x80, 0x20, 0x82, 0x20, 0x84, 0x8e, 0x04, 0xc8,
+  0x99, 0x01, 0x82, 0x80, 0x84, 0x03, 0x08, 0x84, 0x80, 0xd0, 0xf8, 0x88,
+  0x32, 0xb8, 0x00, 0x03, 0x50, 0x08, 0xd0, 0x08, 0x08, 0xd8, 0x0c, 0xb8,
+  0xc8, 0x03, 0x74, 0x10, 0x80, 0xb0, 0x70, 0x08, 0x9a, 0x28, 0x30, 0xb8,
+  0xc8, 0x08, 0x3d, 0x80, 0x80, 0x0d, 0x43, 0xb3, 0xb4, 0x0c, 0x33, 0x80,
+  0xe0, 0x4b, 0xb2, 0x30, 0x00, 0x88, 0x80, 0xf0, 0x03, 0xd8, 0x80, 0xc8,
+  0x8b, 0x04, 0x8c, 0x34, 0xcb, 0x48, 0x08, 0x08, 0x84, 0x80, 0x8c, 0x80,
+  0x50, 0x8b, 0x8c, 0x0c, 0x43, 0xc0, 0x0b, 0x48, 0x80, 0x74, 0x80, 0x82,
+  0x0a, 0xb8, 0x0b, 0x53, 0x33, 0x0c, 0x8b, 0x80, 0xf0, 0x8f, 0x30, 0x0a,
+  0x01, 0xa8, 0x23, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3f, 0x60, 0x8b,
+  0xc8, 0x80, 0x80, 0x78, 0x11, 0x00, 0x28, 0x00, 0x08, 0x03, 0x8c, 0x80,
+  0x80, 0x05, 0x08, 0x08, 0x8e, 0x80, 0x80, 0x8d, 0x40, 0x80, 0x80, 0x86,
+  0x40, 0x8b, 0xb4, 0x48, 0x60, 0xa0, 0xaa, 0x02, 0x0c, 0x8b, 0xc0, 0x80,
+  0x84, 0x80, 0xbf, 0x0a, 0x32, 0xc0, 0x03, 0x0c, 0x3c, 0x08, 0x03, 0x80,
+  0x78, 0x02, 0x08, 0x34, 0x80, 0x80, 0x78, 0x08, 0x8b, 0x40, 0x3c, 0x80,
+  0x8f, 0x28, 0x00, 0x8b, 0xc0, 0x1f, 0x82, 0x8c, 0x80, 0xa0, 0x68, 0x82,
+  0x2a, 0x23, 0xbb, 0x3b, 0x00, 0x45, 0x8b, 0x8b, 0x80, 0x80, 0x80, 0xf0,
+  0x2d, 0xb0, 0x48, 0xc0, 0x30, 0x03, 0x9f, 0x32, 0x08, 0x48, 0xfb, 0x30,
+  0x01, 0xa8, 0x3b, 0x24, 0xbb, 0x40, 0x3b, 0x07, 0x80, 0xea, 0x19, 0x80,
+  0xa0, 0x08, 0x83, 0xbc, 0x40, 0x0c, 0x08, 0x08, 0x08, 0x8d, 0x3c, 0x34,
+  0xb8, 0x08, 0x78, 0xb2, 0x30, 0x08, 0x58, 0x03, 0xc8, 0x48, 0x0b, 0xbc,
+  0x8c, 0x70, 0x19, 0xa9, 0xa8, 0x38, 0x80, 0x80, 0xe0, 0x8b, 0x04, 0x48,
+  0x8b, 0xb4, 0x40, 0x83, 0x80, 0x05, 0x08, 0x58, 0x43, 0xfb, 0x80, 0x80,
+  0xaa, 0x68, 0xa2, 0xa8, 0x3a, 0x33, 0x0c, 0x48, 0xc3, 0x8a, 0xb4, 0x3b,
+  0xcb, 0x08, 0x80, 0x68, 0x83, 0x80, 0x80, 0x60, 0xb3, 0xc3, 0xcb, 0xb8,
+  0x03, 0x75, 0xb8, 0xa9, 0x8a, 0x63, 0xa0, 0x28, 0x83, 0xaf, 0x39, 0x08,
+  0x08, 0x08, 0x43, 0x08, 0xf8, 0x2a, 0x08, 0x32, 0x43, 0x83, 0xcb, 0x78,
+  0xa0, 0x89, 0x8a, 0x70, 0x91, 0xaa, 0x8c, 0xa2, 0x32, 0xb8, 0x34, 0x08,
+  0x58, 0xb8, 0x0c, 0x08, 0x08, 0x08, 0x06, 0xc8, 0x80, 0x84, 0x40, 0x43,
+  0xae, 0x89, 0x80, 0x3a, 0xb8, 0x8c, 0x40, 0x08, 0x84, 0x84, 0x0b, 0x08,
+  0x58, 0x80, 0x50, 0xcb, 0x3b, 0x40, 0x48, 0xbb, 0x48, 0x80, 0xcf, 0x08,
+  0x51, 0x11, 0xab, 0x22, 0xa8, 0x08, 0x53, 0x08, 0x18, 0x02, 0x26, 0x00,
+  0x0c, 0x7b, 0xb8, 0x20, 0xa1, 0x33, 0xb8, 0x08, 0x04, 0x0d, 0x78, 0xc2,
+  0x0d, 0x18, 0x09, 0x01, 0xa8, 0xa2, 0xbb, 0x08, 0x44, 0x33, 0xbc, 0x03,
+  0x40, 0x0c, 0x48, 0x0b, 0x88, 0x00, 0x68, 0x80, 0x0c, 0x03, 0xd8, 0xc0,
+  0x08, 0xac, 0x48, 0x02, 0x80, 0x8c, 0xbc, 0x48, 0x80, 0x80, 0x80, 0x70,
+  0x08, 0x03, 0x04, 0x8c, 0xcb, 0x48, 0x33, 0xb4, 0x8b, 0x40, 0xb8, 0x88,
+  0xe0, 0x43, 0x8b, 0x8b, 0x80, 0x8d, 0xc0, 0x73, 0x90, 0x22, 0xbb, 0x0b,
+  0x08, 0xc5, 0x33, 0x08, 0x3c, 0x80, 0xcc, 0x33, 0x80, 0xb5, 0xcb, 0x30,
+  0x0c, 0x08, 0x48, 0xcb, 0x03, 0x88, 0x35, 0xc0, 0x8b, 0x34, 0xcb, 0x43,
+  0xb8, 0x8b, 0x40, 0xb4, 0x30, 0x00, 0xbe, 0x80, 0x34, 0x4b, 0x08, 0xbc,
+  0x43, 0x80, 0x80, 0x35, 0x8b, 0x8c, 0x80, 0x05, 0x0c, 0x08, 0x88, 0x05,
+  0xc8, 0x0f, 0x28, 0x08, 0x38, 0x8b, 0x80, 0x85, 0xb4, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xf8, 0x48, 0x80, 0xd0, 0x8b, 0xb4, 0x08, 0x07, 0xa2, 0x3a,
+  0xc3, 0x33, 0xcb, 0xcb, 0x08, 0x24, 0x4b, 0x48, 0x0b, 0x08, 0x34, 0x0c,
+  0x08, 0x84, 0xc0, 0xb8, 0x08, 0xd8, 0x43, 0x30, 0xc0, 0x3c, 0xb3, 0x88,
+  0xd0, 0x08, 0xb4, 0x88, 0x17, 0x80, 0x80, 0xc0, 0x48, 0x08, 0x0c, 0x08,
+  0x08, 0x08, 0x08, 0x37, 0xcb, 0x08, 0x58, 0x0b, 0x03, 0x0d, 0xf8, 0x2a,
+  0x14, 0xa0, 0xb0, 0x80, 0x40, 0xb2, 0x8b, 0xd0, 0x08, 0xbc, 0x48, 0x07,
+  0x88, 0x00, 0x3b, 0x38, 0xc0, 0x8b, 0x3c, 0x27, 0x91, 0xbd, 0x30, 0x22,
+  0xb0, 0x0b, 0xbc, 0x70, 0x17, 0x9a, 0x18, 0x08, 0x98, 0x0a, 0x08, 0x38,
+  0x8b, 0x80, 0xbd, 0xc8, 0x54, 0x94, 0x9a, 0x01, 0x9d, 0x41, 0xb1, 0x9e,
+  0x42, 0x91, 0x8a, 0xa0, 0x22, 0x02, 0x08, 0xc8, 0x03, 0xbc, 0xbc, 0x97,
+  0x1d, 0xfd, 0x2d, 0x00, 0x0a, 0x82, 0x8a, 0xb3, 0x70, 0x14, 0xc9, 0x4b,
+  0x11, 0x08, 0xb0, 0x00, 0x42, 0xbb, 0xbb, 0x67, 0xb0, 0x0a, 0x28, 0x01,
+  0xba, 0x80, 0x03, 0xfc, 0x80, 0x44, 0x14, 0xa9, 0x8d, 0x10, 0x90, 0x4a,
+  0xbb, 0x19, 0x37, 0x98, 0x91, 0x80, 0x80, 0xda, 0x89, 0x42, 0xc9, 0x4a,
+  0x80, 0xca, 0x30, 0x07, 0x00, 0x08, 0x81, 0xdb, 0x30, 0xa1, 0x20, 0xb0,
+  0x1e, 0x22, 0x08, 0x8b, 0x8e, 0x20, 0xba, 0x73, 0x04, 0xd9, 0x9c, 0x51,
+  0xa1, 0x8a, 0x01, 0x89, 0x33, 0x80, 0x50, 0x93, 0x08, 0xab, 0x73, 0x34,
+  0xb9, 0xaf, 0x18, 0x00, 0x21, 0x90, 0x8a, 0x0a, 0xab, 0x78, 0x10, 0xa0,
+  0x8a, 0x30, 0x03, 0x08, 0x08, 0xf8, 0xcb, 0x0b, 0xbc, 0x84, 0x30, 0x73,
+  0x22, 0x02, 0xee, 0x19, 0x23, 0x91, 0x80, 0x98, 0x9d, 0x01, 0x28, 0x80,
+  0xb0, 0x08, 0xf8, 0x0e, 0x11, 0x08, 0x08, 0x15, 0x80, 0x02, 0x0b, 0x47,
+  0x99, 0x9c, 0x28, 0x08, 0x08, 0x52, 0x22, 0x04, 0xda, 0x39, 0xc0, 0xcc,
+  0xaa, 0x0b, 0x81, 0x25, 0x03, 0x28, 0xda, 0x8b, 0x07, 0x89, 0x52, 0x91,
+  0x8b, 0x32, 0xc0, 0x8e, 0x92, 0xaa, 0x19, 0x23, 0x14, 0x22, 0xba, 0x83,
+  0xfb, 0x8f, 0x21, 0x88, 0x88, 0x30, 0x03, 0x8a, 0x16, 0x32, 0xf0, 0xaf,
+  0x20, 0x11, 0xa8, 0x18, 0x08, 0x31, 0xa1, 0x2c, 0x45, 0xb8, 0x09, 0x91,
+  0xaa, 0x22, 0xcd, 0x53, 0xf0, 0x9b, 0x41, 0x91, 0x2a, 0x02, 0x9d, 0x21,
+  0xa0, 0x60, 0x80, 0xbb, 0x41, 0xa0, 0x9a, 0x31, 0x37, 0xc1, 0x8e, 0x33,
+  0xa8, 0x0a, 0xc8, 0x29, 0x84, 0xaa, 0x53, 0xd8, 0x19, 0x01, 0x28, 0x84,
+  0xad, 0x38, 0x93, 0x19, 0x99, 0x43, 0xba, 0x49, 0x91, 0xad, 0x28, 0x21,
+  0xd8, 0x39, 0x25, 0xd0, 0x9c, 0x28, 0x80, 0x12, 0x57, 0x81, 0xdb, 0x29,
+  0x12, 0xba, 0x8a, 0xa2, 0xda, 0xfb, 0x2f, 0x00, 0xba, 0x47, 0x90, 0x0b,
+  0x81, 0x8a, 0x64, 0xa1, 0x9d, 0x32, 0x81, 0x9a, 0x10, 0x91, 0xbd, 0x21,
+  0x83, 0x14, 0xc9, 0x59, 0x82, 0x10, 0x81, 0xa9, 0x80, 0x20, 0xf0, 0x9c,
+  0x30, 0x37, 0xa9, 0x53, 0xd9, 0xac, 0x10, 0x01, 0x9a, 0x89, 0x20, 0x15,
+  0x9c, 0x10, 0x90, 0x8d, 0x46, 0x91, 0x9b, 0x38, 0x02, 0xba, 0x51, 0x81,
+  0x09, 0xba, 0x8d, 0x37, 0xb8, 0x8d, 0xb8, 0x5a, 0x05, 0xaa, 0x21, 0xb9,
+  0x80, 0x90, 0x72, 0x15, 0xa8, 0xaa, 0x09, 0x33, 0xa1, 0x19, 0xf0, 0x0b,
+  0x24, 0x88, 0xb1, 0xdf, 0x48, 0x03, 0xab, 0x88, 0x88, 0x54, 0x90, 0x8b,
+  0x81, 0x30, 0x26, 0xca, 0x0a, 0x81, 0x08, 0x13, 0xb1, 0x3b, 0xa0, 0x89,
+  0xb0, 0xad, 0x67, 0x01, 0xc9, 0x9b, 0x22, 0xb1, 0xb9, 0x18, 0xb8, 0x8e,
+  0x44, 0x91, 0x19, 0x90, 0x39, 0x57, 0xe9, 0x09, 0x22, 0xa9, 0x89, 0x18,
+  0x24, 0x83, 0xa8, 0x8d, 0x09, 0x40, 0x02, 0xeb, 0x40, 0x02, 0xb1, 0x8e,
+  0x08, 0x89, 0x51, 0x82, 0x98, 0x99, 0x52, 0xd2, 0x0b, 0x82, 0xbb, 0x5a,
+  0x37, 0x98, 0x0a, 0xa8, 0x0c, 0x35, 0x80, 0x9b, 0xa0, 0xcb, 0x71, 0x03,
+  0xda, 0x0b, 0x11, 0x98, 0x30, 0x82, 0x1b, 0x92, 0x51, 0x94, 0xad, 0x42,
+  0x13, 0xe8, 0x8b, 0x32, 0x92, 0xdc, 0x29, 0x24, 0x90, 0x9a, 0x80, 0xab,
+  0x41, 0xc0, 0x9b, 0x90, 0x39, 0x15, 0xaa, 0x32, 0x02, 0x68, 0x57, 0xfb,
+  0x19, 0x14, 0x99, 0x89, 0x90, 0x41, 0x92, 0x9d, 0x09, 0x00, 0x11, 0x81,
+  0x89, 0x03, 0x9f, 0x20, 0xa3, 0x8c, 0x63, 0x90, 0xab, 0x53, 0x92, 0x0a,
+  0x10, 0xa9, 0xbc, 0x68, 0x15, 0xdb, 0x19, 0x11, 0x01, 0x90, 0x8c, 0x11,
+  0xb9, 0xbb, 0x73, 0x23, 0xa2, 0x8c, 0x21, 0xda, 0xab, 0x42, 0x83, 0x8a,
+  0x02, 0x9f, 0x30, 0x35, 0xca, 0x49, 0xa2, 0x1c, 0x67, 0x00, 0x36, 0x00,
+  0x22, 0xc9, 0xab, 0x62, 0x82, 0xbd, 0x19, 0x11, 0x88, 0x30, 0x85, 0xbb,
+  0x73, 0x96, 0xaa, 0x32, 0xc8, 0x0a, 0x05, 0x08, 0xb8, 0x0a, 0x14, 0xca,
+  0x08, 0xb8, 0x09, 0x03, 0xba, 0x70, 0x27, 0xba, 0x50, 0xa2, 0xab, 0x32,
+  0x90, 0x01, 0xf9, 0x29, 0x15, 0xba, 0x9c, 0x22, 0xb0, 0x99, 0x71, 0x04,
+  0x9c, 0x62, 0xb1, 0x8c, 0x12, 0xaa, 0x30, 0x80, 0x11, 0xd0, 0x8a, 0x33,
+  0xc9, 0x8d, 0x21, 0x08, 0x46, 0xd9, 0x29, 0x04, 0x9c, 0x30, 0xc8, 0x1b,
+  0x37, 0xa8, 0x8a, 0x81, 0x9a, 0x10, 0x90, 0xaa, 0x19, 0x56, 0x82, 0xca,
+  0x20, 0x80, 0x9a, 0x10, 0x91, 0x20, 0x91, 0x92, 0x9b, 0x35, 0x02, 0xbf,
+  0x44, 0xe9, 0x29, 0x04, 0xba, 0x19, 0x98, 0x31, 0x84, 0xce, 0x28, 0x81,
+  0x40, 0xc2, 0x8c, 0x33, 0x01, 0x82, 0xcc, 0x40, 0x94, 0x9b, 0x83, 0xbc,
+  0x40, 0x91, 0x0a, 0xb9, 0x39, 0x83, 0x1a, 0x67, 0xb8, 0x80, 0xaa, 0x60,
+  0x03, 0xcb, 0x08, 0x10, 0x23, 0xb9, 0x1a, 0xa1, 0x1b, 0x17, 0xd9, 0x9d,
+  0x42, 0x00, 0x31, 0xc0, 0x19, 0x94, 0x9e, 0x80, 0x80, 0x09, 0x11, 0x12,
+  0xaa, 0x61, 0x25, 0x91, 0x9e, 0x82, 0xb9, 0x00, 0x98, 0x40, 0xa3, 0xbe,
+  0x40, 0xb1, 0x1c, 0x15, 0xa8, 0x11, 0xc8, 0x70, 0x82, 0xab, 0x22, 0xa9,
+  0x0a, 0x51, 0x24, 0xc8, 0xa9, 0xac, 0x62, 0x81, 0x8b, 0x80, 0x11, 0xd0,
+  0x2a, 0xb2, 0x2c, 0x37, 0xdc, 0x38, 0x82, 0x9b, 0x22, 0x89, 0x38, 0xb9,
+  0x71, 0x82, 0x8b, 0xcb, 0x19, 0x23, 0x72, 0xd2, 0x8d, 0x23, 0xb0, 0x8b,
+  0x42, 0xa1, 0x9c, 0x32, 0xa1, 0x29, 0xc1, 0x1b, 0x26, 0xcb, 0x50, 0xa2,
+  0x9c, 0x21, 0x99, 0x08, 0x42, 0x52, 0xd2, 0x9f, 0x42, 0xc8, 0x29, 0x02,
+  0x9a, 0x13, 0xba, 0x8a, 0x88, 0x72, 0x03, 0xb0, 0x9f, 0x52, 0xb8, 0x1b,
+  0x3c, 0xf2, 0x40, 0x00, 0x06, 0x99, 0x08, 0x88, 0x08, 0x22, 0xa9, 0x72,
+  0xc2, 0x0c, 0x14, 0xca, 0x40, 0xa1, 0x9b, 0x03, 0x99, 0x32, 0x83, 0xba,
+  0xbe, 0x50, 0x14, 0x99, 0x89, 0x89, 0x22, 0xb9, 0x60, 0xa1, 0x9f, 0x11,
+  0x00, 0x89, 0x30, 0x04, 0x98, 0x09, 0x02, 0xcb, 0x49, 0x03, 0xc8, 0xaa,
+  0x80, 0xdd, 0x29, 0x74, 0xa2, 0x9d, 0x44, 0xc8, 0x0a, 0x12, 0x89, 0x10,
+  0x91, 0x8a, 0x80, 0x8b, 0x64, 0x83, 0xad, 0x30, 0x11, 0xa9, 0x19, 0xa8,
+  0x28, 0x83, 0xce, 0x39, 0x13, 0x80, 0x19, 0xc2, 0xdc, 0x41, 0x91, 0x9b,
+  0x80, 0x08, 0x35, 0x91, 0x09, 0x89, 0x12, 0xf9, 0x4c, 0x05, 0xa9, 0xcc,
+  0x29, 0x14, 0x31, 0x85, 0xad, 0x00, 0x99, 0x61, 0x02, 0xbc, 0x20, 0xb8,
+  0x19, 0x24, 0x90, 0xcd, 0x39, 0x24, 0x80, 0x89, 0x80, 0xeb, 0x48, 0x82,
+  0xac, 0x43, 0x12, 0xd8, 0x0c, 0x23, 0xdb, 0x19, 0x12, 0x11, 0xba, 0x20,
+  0xb1, 0xbc, 0x3a, 0x63, 0x81, 0x9b, 0x12, 0x10, 0xc2, 0xbf, 0x71, 0x14,
+  0x9a, 0x10, 0x99, 0x22, 0xf9, 0x8a, 0xb8, 0x0d, 0x47, 0x92, 0xca, 0x18,
+  0x01, 0x98, 0x09, 0x11, 0x80, 0x09, 0x22, 0xc8, 0x9d, 0x42, 0xb0, 0x1a,
+  0x93, 0x1c, 0x47, 0xc8, 0x0b, 0x22, 0x18, 0x33, 0xfa, 0xaa, 0x21, 0x82,
+  0x08, 0x11, 0xdb, 0x8a, 0x31, 0x31, 0x33, 0xfa, 0xbb, 0x09, 0x56, 0x83,
+  0xcd, 0x28, 0x01, 0x08, 0x11, 0xb8, 0x1b, 0x11, 0x45, 0xfa, 0x2a, 0x03,
+  0x88, 0xa8, 0x8a, 0x15, 0x89, 0x31, 0xe1, 0xae, 0x42, 0x81, 0x99, 0x00,
+  0x09, 0x01, 0xc8, 0x09, 0x37, 0xba, 0x10, 0xfa, 0x38, 0x06, 0x99, 0x88,
+  0x98, 0x28, 0x91, 0x29, 0x10, 0x11, 0xfb, 0x0c, 0x23, 0x90, 0x88, 0xa8,
+  0x08, 0xa3, 0x2e, 0x27, 0x98, 0x00, 0xeb, 0x18, 0x82, 0x28, 0x25, 0xc8,
+  0x9b, 0x33, 0xb0, 0xdb, 0xc2, 0xf9, 0x38, 0x00, 0x09, 0x30, 0x06, 0x9b,
+  0x18, 0xb9, 0x1d, 0x53, 0x22, 0x90, 0xbd, 0x21, 0xca, 0x70, 0x84, 0x9c,
+  0x10, 0x98, 0x28, 0x23, 0x0a, 0xd2, 0x9f, 0x52, 0xa1, 0x8a, 0x92, 0x9c,
+  0x43, 0x11, 0xc0, 0x9d, 0x11, 0x01, 0x23, 0xb0, 0xac, 0x89, 0x63, 0xc0,
+  0x0a, 0x83, 0x8c, 0x42, 0x80, 0x32, 0xec, 0x18, 0x91, 0x18, 0x82, 0x8a,
+  0x80, 0xa9, 0x09, 0x37, 0x14, 0xba, 0x9a, 0xaa, 0x11, 0x28, 0x26, 0xec,
+  0x18, 0x21, 0x44, 0xc0, 0x0c, 0x34, 0xba, 0x8c, 0x21, 0x91, 0xa8, 0x09,
+  0x00, 0xa9, 0x71, 0xa0, 0x8d, 0x22, 0xa1, 0x1a, 0x03, 0x9b, 0x52, 0xa9,
+  0x71, 0x05, 0xb9, 0x8b, 0x43, 0xc0, 0x9d, 0x12, 0x18, 0x81, 0xac, 0x81,
+  0x11, 0x91, 0x31, 0xfd, 0x9b, 0x62, 0x83, 0x0a, 0x23, 0xdb, 0x10, 0xa8,
+  0x08, 0x12, 0x30, 0x17, 0xca, 0x8c, 0x43, 0x82, 0xbc, 0x43, 0xe0, 0x0c,
+  0x23, 0xd9, 0x29, 0x22, 0x99, 0x18, 0x81, 0xda, 0x0a, 0x56, 0xa8, 0x2b,
+  0x23, 0xc9, 0x09, 0x32, 0xc0, 0x9d, 0x10, 0x08, 0x32, 0x02, 0xcb, 0x9a,
+  0x30, 0x12, 0x9a, 0x78, 0x82, 0xcc, 0x29, 0x00, 0x32, 0xbb, 0x11, 0xab,
+  0x72, 0x57, 0xc0, 0x9c, 0x31, 0xc8, 0x1b, 0x33, 0x10, 0x12, 0xdb, 0x09,
+  0x10, 0x12, 0xaa, 0xaf, 0x20, 0x53, 0xa2, 0x9a, 0x08, 0x01, 0x98, 0xa9,
+  0x8b, 0x46, 0x01, 0x91, 0xdd, 0x1a, 0x27, 0xb8, 0x0c, 0x24, 0xb9, 0x1a,
+  0x13, 0x00, 0xa0, 0x0a, 0x92, 0xcb, 0x78, 0x81, 0x9d, 0x21, 0x92, 0xbc,
+  0x73, 0xe0, 0x2a, 0x25, 0xaa, 0x29, 0x91, 0x08, 0x88, 0x98, 0x00, 0x18,
+  0x93, 0x1c, 0x45, 0xa1, 0x9f, 0x11, 0x80, 0x89, 0x88, 0x9c, 0x73, 0x93,
+  0x9b, 0x13, 0xbb, 0x39, 0xf9, 0x40, 0xa1, 0x0a, 0xc3, 0x8c, 0x25, 0x08,
+  0xa8, 0x9c, 0x22, 0x89, 0x46, 0x81, 0x9d, 0x11, 0xd7, 0x03, 0x3b, 0x00,
+  0xaa, 0x58, 0x04, 0xbb, 0x28, 0xc8, 0x4a, 0x26, 0x9a, 0x19, 0xa9, 0x18,
+  0x90, 0x21, 0xb1, 0x50, 0x91, 0xae, 0x38, 0x91, 0x61, 0x04, 0xbc, 0x18,
+  0xb9, 0x51, 0x13, 0xea, 0xac, 0x48, 0x24, 0x90, 0x19, 0xa3, 0xef, 0x21,
+  0x82, 0x89, 0x18, 0x80, 0x89, 0x22, 0xe8, 0x38, 0x90, 0x29, 0x03, 0xdb,
+  0x0a, 0x10, 0x33, 0xb0, 0x2c, 0x27, 0xcd, 0x18, 0x80, 0xa9, 0x50, 0x02,
+  0x89, 0x80, 0xaa, 0x40, 0xb8, 0x3a, 0x27, 0xb9, 0x11, 0x9a, 0x77, 0xc9,
+  0x1a, 0x82, 0x9a, 0x31, 0x80, 0x18, 0x01, 0x8a, 0x43, 0xfd, 0x38, 0x92,
+  0x19, 0xb1, 0x9f, 0x32, 0xa2, 0x0a, 0x01, 0x89, 0x01, 0xa9, 0x38, 0x98,
+  0x19, 0x37, 0xcd, 0x40, 0x93, 0x99, 0x91, 0x2a, 0xd2, 0x8e, 0x44, 0xa8,
+  0x38, 0x85, 0xba, 0x18, 0xa8, 0x30, 0xda, 0x70, 0x93, 0x9d, 0x22, 0xa9,
+  0x19, 0x81, 0x9c, 0x71, 0x94, 0xbb, 0x40, 0xb1, 0x1c, 0x24, 0xb8, 0x9b,
+  0x31, 0x93, 0xac, 0x63, 0x02, 0xbb, 0x30, 0xb1, 0x8b, 0x11, 0xc9, 0x39,
+  0x37, 0xa1, 0x30, 0xc0, 0x9c, 0x18, 0xc9, 0x39, 0x27, 0xb9, 0x9a, 0x43,
+  0xb1, 0xbf, 0x20, 0x23, 0x21, 0xf0, 0x9c, 0x32, 0x13, 0xc9, 0x1a, 0x25,
+  0xda, 0x09, 0x23, 0x80, 0x9a, 0x18, 0x80, 0x01, 0xd8, 0x9c, 0x21, 0x26,
+  0xe9, 0x28, 0x91, 0x8d, 0x10, 0x24, 0xb8, 0x2b, 0x04, 0xbd, 0x51, 0x03,
+  0xbc, 0x39, 0x90, 0x39, 0x25, 0xcb, 0x20, 0xa0, 0x28, 0xfb, 0x3b, 0x84,
+  0x28, 0x14, 0xfb, 0x2a, 0x84, 0x9a, 0x01, 0x98, 0x41, 0xa2, 0x0c, 0xa2,
+  0x9d, 0x30, 0x15, 0x98, 0x88, 0xa9, 0x38, 0x01, 0x20, 0x18, 0x27, 0xef,
+  0x38, 0x92, 0x0b, 0x24, 0xba, 0x19, 0x12, 0xb9, 0x1a, 0x07, 0xca, 0x31,
+  0xa2, 0x29, 0xa2, 0xad, 0x28, 0x63, 0xb3, 0x0d, 0x12, 0xcc, 0x20, 0xa2,
+  0x6b, 0xfd, 0x39, 0x00, 0x29, 0x16, 0x99, 0x00, 0x9b, 0x31, 0xfb, 0x0a,
+  0x44, 0x81, 0xab, 0x39, 0x12, 0xc8, 0xad, 0x52, 0xa1, 0x0b, 0x24, 0xb0,
+  0xae, 0x40, 0x03, 0xdb, 0x58, 0x93, 0xab, 0x32, 0xb0, 0x2b, 0x83, 0x3a,
+  0x07, 0xba, 0x39, 0x92, 0x8d, 0x13, 0xc8, 0x9c, 0x44, 0x83, 0xcc, 0x28,
+  0x93, 0x9b, 0xa9, 0x01, 0x51, 0xd0, 0x19, 0x35, 0xd8, 0x19, 0x05, 0xcb,
+  0x40, 0xa2, 0xab, 0x23, 0x90, 0x08, 0x16, 0xbb, 0x30, 0xa1, 0x8e, 0x12,
+  0xaa, 0x20, 0x04, 0xdc, 0x38, 0x15, 0x98, 0x99, 0x99, 0x43, 0xa0, 0x9b,
+  0x37, 0xd9, 0x19, 0x12, 0xaa, 0x09, 0x32, 0x82, 0xba, 0xac, 0x89, 0x01,
+  0x0a, 0x37, 0x5a, 0x27, 0xd9, 0x8c, 0x22, 0xa8, 0x29, 0x83, 0x29, 0xc2,
+  0x1e, 0x13, 0xa9, 0x1b, 0x83, 0xac, 0x20, 0xa3, 0x2c, 0x47, 0xfa, 0x29,
+  0x85, 0x9a, 0x11, 0xa9, 0x29, 0x14, 0x88, 0x13, 0xce, 0x20, 0xa1, 0x9a,
+  0x11, 0x24, 0x01, 0xba, 0x8e, 0x10, 0xb8, 0x48, 0x92, 0x9c, 0x51, 0x26,
+  0xb8, 0x8b, 0x81, 0xda, 0x39, 0x37, 0xd9, 0x1a, 0x03, 0x09, 0x00, 0xa9,
+  0x51, 0x81, 0xaa, 0x01, 0x9d, 0x43, 0xb0, 0x0c, 0x13, 0xbc, 0x62, 0x90,
+  0x10, 0xa9, 0x19, 0xc4, 0x9c, 0x31, 0x01, 0xa9, 0x18, 0x91, 0x56, 0xc1,
+  0xac, 0x80, 0x49, 0x26, 0xba, 0x28, 0x05, 0xcb, 0x10, 0x90, 0x19, 0x92,
+  0x29, 0x03, 0x09, 0xa8, 0x39, 0xf8, 0x8b, 0x44, 0xb8, 0x28, 0xb1, 0x9d,
+  0x48, 0x04, 0xcb, 0x38, 0x06, 0xaa, 0x00, 0xa8, 0x45, 0xe8, 0x19, 0x84,
+  0x09, 0x11, 0xca, 0x0a, 0x02, 0x8a, 0x45, 0x91, 0xcc, 0x18, 0x33, 0xa0,
+  0x8c, 0x42, 0xd8, 0x0b, 0x43, 0x00, 0x0a, 0x14, 0xed, 0x39, 0x15, 0xa8,
+  0x8c, 0x10, 0x12, 0xa8, 0x18, 0x03, 0xdc, 0x28, 0x82, 0x8d, 0x21, 0x80,
+  0x08, 0xa8, 0x9b, 0x33, 0x23, 0xfd, 0x31, 0x00, 0xb8, 0x7b, 0x06, 0xab,
+  0x43, 0xd8, 0x29, 0x03, 0xbb, 0x30, 0x13, 0x02, 0xfb, 0x3b, 0x14, 0xda,
+  0x1a, 0x12, 0xb8, 0x38, 0x83, 0x08, 0xeb, 0x43, 0xc0, 0x8b, 0x16, 0xbc,
+  0x60, 0x83, 0xa9, 0x80, 0x1b, 0x24, 0xfa, 0x2a, 0x04, 0xa9, 0x00, 0x10,
+  0x42, 0xd2, 0x8e, 0x23, 0xea, 0x28, 0x02, 0x88, 0x99, 0x30, 0xb0, 0x0a,
+  0x04, 0xf9, 0x19, 0x25, 0x90, 0x88, 0x99, 0x9b, 0x33, 0xc8, 0x89, 0x43,
+  0xf9, 0x3a, 0x15, 0x99, 0x01, 0x89, 0xba, 0x3c, 0x16, 0x88, 0x81, 0xae,
+  0x30, 0x81, 0x00, 0x99, 0x1b, 0x83, 0x8e, 0x53, 0xa0, 0x9b, 0x21, 0x81,
+  0x53, 0xb0, 0xbc, 0x50, 0x14, 0xcb, 0x30, 0xa8, 0x51, 0xc2, 0x9d, 0x22,
+  0xa9, 0x59, 0x12, 0xa9, 0x2b, 0x15, 0xfb, 0x1a, 0x11, 0x98, 0x31, 0x94,
+  0x0b, 0x08, 0x9c, 0x73, 0xa1, 0x2a, 0xc8, 0x3a, 0x04, 0xbc, 0x20, 0x81,
+  0x49, 0xa8, 0x18, 0xfb, 0x3a, 0x27, 0xa9, 0x28, 0xa2, 0x1b, 0x83, 0xca,
+  0x31, 0x19, 0x37, 0x94, 0xbd, 0x89, 0x32, 0xa9, 0x20, 0xc1, 0x0e, 0x04,
+  0xba, 0x28, 0x24, 0xf9, 0x19, 0x04, 0x99, 0x80, 0x88, 0x11, 0xa0, 0x1a,
+  0x31, 0x47, 0xa9, 0x88, 0xaa, 0x8d, 0x31, 0x21, 0xc0, 0x3b, 0x27, 0x8c,
+  0x14, 0xec, 0x38, 0x82, 0xaa, 0x10, 0x81, 0x89, 0x02, 0x82, 0xcd, 0x5a,
+  0x26, 0x99, 0x89, 0xcb, 0x19, 0x37, 0xa2, 0xac, 0x11, 0x80, 0x19, 0x11,
+  0x9a, 0xbb, 0x6b, 0x15, 0xaa, 0x21, 0x91, 0x98, 0x9a, 0xcb, 0x78, 0x06,
+  0x99, 0x80, 0x88, 0x01, 0xeb, 0x38, 0xc1, 0x4b, 0x04, 0x9a, 0x41, 0xc9,
+  0x28, 0x04, 0xcb, 0x20, 0x92, 0x99, 0x32, 0x03, 0xe9, 0x0b, 0x13, 0xa0,
+  0x80, 0x91, 0x28, 0xca, 0x0c, 0x27, 0xd9, 0x0a, 0x88, 0x20, 0x13, 0xc9,
+  0x21, 0xb3, 0xaf, 0x10, 0x85, 0x9b, 0x03, 0x11, 0xaf, 0xff, 0x2e, 0x00,
+  0x99, 0x62, 0x91, 0xa9, 0x80, 0x89, 0xb0, 0x80, 0x27, 0x08, 0xbf, 0x19,
+  0x06, 0x9a, 0x22, 0xb0, 0x9b, 0x0a, 0x37, 0xb1, 0xaa, 0x20, 0x21, 0x0a,
+  0x27, 0x93, 0xae, 0x19, 0x14, 0x80, 0x80, 0xf0, 0x0b, 0x15, 0xbb, 0x68,
+  0xa3, 0x0b, 0xa2, 0x8a, 0x16, 0xa0, 0x9b, 0x13, 0x11, 0xa0, 0x22, 0xfa,
+  0x39, 0xa0, 0x2a, 0x83, 0x78, 0xf3, 0xac, 0x32, 0x81, 0xa9, 0x19, 0x98,
+  0x0a, 0x24, 0x26, 0xe9, 0x0b, 0x22, 0x91, 0x30, 0x83, 0xa0, 0x02, 0x0f,
+  0x31, 0xc0, 0x0a, 0x82, 0xa2, 0xb8, 0x08, 0x57, 0xab, 0x48, 0x81, 0xa9,
+  0xb0, 0x1d, 0x97, 0xbb, 0x62, 0x80, 0x18, 0xa2, 0x9e, 0x40, 0x81, 0x0c,
+  0x80, 0x9a, 0x61, 0x01, 0xb9, 0x38, 0x98, 0x39, 0x04, 0x9c, 0x28, 0xa8,
+  0x73, 0x93, 0x1d, 0x24, 0xeb, 0x08, 0x98, 0x08, 0x20, 0x01, 0x9a, 0x37,
+  0xa0, 0x89, 0x12, 0x12, 0xff, 0x0a, 0x24, 0x91, 0xab, 0x29, 0x08, 0x22,
+  0xc1, 0xae, 0x11, 0x81, 0x41, 0x14, 0xca, 0x8a, 0x00, 0x58, 0xa0, 0x18,
+  0x81, 0x63, 0xa9, 0x8b, 0xb1, 0x9f, 0x32, 0x12, 0x81, 0x06, 0xbd, 0x48,
+  0x93, 0xaf, 0x40, 0x80, 0x09, 0x12, 0xa8, 0x8a, 0x04, 0x9a, 0x13, 0x9a,
+  0xa9, 0x74, 0xa0, 0xac, 0x18, 0x22, 0x83, 0xd9, 0x78, 0x81, 0x8b, 0x34,
+  0xe1, 0x9a, 0x89, 0x28, 0x25, 0xa8, 0x0b, 0x16, 0x89, 0x88, 0x9d, 0x20,
+  0x88, 0x30, 0x01, 0x98, 0x71, 0xe1, 0x0a, 0x01, 0x10, 0x80, 0x9d, 0x09,
+  0x50, 0x82, 0xbb, 0x19, 0x10, 0x67, 0xb0, 0x8c, 0x12, 0x90, 0x00, 0x80,
+  0xa9, 0x98, 0x89, 0x37, 0x90, 0x3a, 0x84, 0xbf, 0x08, 0x42, 0xb2, 0xaf,
+  0x31, 0x13, 0xa9, 0x11, 0xe8, 0x0a, 0x33, 0x82, 0xcd, 0x18, 0x83, 0x08,
+  0x03, 0xbc, 0x21, 0xc9, 0x9b, 0x23, 0x28, 0x82, 0xbf, 0x09, 0x65, 0x04,
+  0x43, 0x07, 0x38, 0x00, 0xba, 0x8c, 0x44, 0xa1, 0x8b, 0x01, 0xba, 0x58,
+  0x02, 0xad, 0x48, 0x03, 0x19, 0x82, 0xbf, 0x20, 0x12, 0xa9, 0x88, 0x48,
+  0x84, 0x9d, 0x33, 0xd9, 0x1a, 0x04, 0xcc, 0x48, 0x23, 0x90, 0x99, 0x99,
+  0xab, 0x72, 0xa1, 0xaa, 0x31, 0xa3, 0x8d, 0x42, 0xd3, 0x8d, 0x33, 0xb9,
+  0x29, 0x94, 0x9d, 0x42, 0x80, 0x09, 0xa8, 0x70, 0xb3, 0x9f, 0x42, 0xb0,
+  0x1b, 0x23, 0x91, 0xbc, 0x09, 0x24, 0x80, 0xb0, 0x0d, 0x36, 0xb8, 0x1b,
+  0x83, 0x0c, 0x02, 0xaa, 0x19, 0x43, 0x88, 0x32, 0xfb, 0x0d, 0x34, 0xa1,
+  0xcb, 0x29, 0x15, 0xa8, 0x99, 0x0a, 0x30, 0xa1, 0x8e, 0x33, 0xd9, 0x30,
+  0x94, 0x19, 0xa0, 0xbe, 0x61, 0x92, 0x89, 0x12, 0xa0, 0x8a, 0x91, 0xa9,
+  0x27, 0xea, 0x38, 0x83, 0x10, 0xca, 0x38, 0xc4, 0x9e, 0x33, 0xa0, 0x0a,
+  0x13, 0x89, 0x62, 0xb8, 0xab, 0x22, 0xd0, 0x1a, 0x04, 0xac, 0x52, 0x08,
+  0x88, 0x9a, 0x02, 0x9f, 0x30, 0x05, 0xcc, 0x30, 0x14, 0xa9, 0x99, 0x98,
+  0x21, 0x81, 0xa0, 0x80, 0xac, 0x57, 0xa8, 0x51, 0xc1, 0x8b, 0x13, 0xc9,
+  0x40, 0x01, 0xab, 0x44, 0xc8, 0x0a, 0x90, 0x28, 0x11, 0x9a, 0xdb, 0x1a,
+  0x35, 0xba, 0x71, 0x93, 0x9e, 0x24, 0xb9, 0x0a, 0x02, 0x18, 0xa1, 0x8e,
+  0x12, 0xda, 0x38, 0x04, 0x28, 0xf8, 0x1c, 0x34, 0x98, 0x09, 0xa0, 0x89,
+  0x23, 0x90, 0xb8, 0xac, 0x39, 0x27, 0xb8, 0xab, 0x48, 0x34, 0xa8, 0x32,
+  0xfc, 0x8e, 0x22, 0x80, 0x10, 0xc8, 0x1b, 0x15, 0xa8, 0x18, 0x15, 0x98,
+  0xaa, 0x18, 0xa1, 0x5a, 0x16, 0xcd, 0x18, 0x13, 0x08, 0x01, 0xda, 0x1a,
+  0x03, 0x99, 0x11, 0xca, 0x20, 0x04, 0x30, 0xa1, 0x9d, 0x12, 0xba, 0x2a,
+  0x14, 0x29, 0x04, 0xcf, 0x19, 0x14, 0x98, 0x99, 0x41, 0xc1, 0x8c, 0x25,
+  0xa9, 0x01, 0xd9, 0x19, 0xe7, 0xfa, 0x33, 0x00, 0x33, 0x08, 0x22, 0x9c,
+  0x41, 0x11, 0xc0, 0xce, 0x10, 0x82, 0x21, 0x98, 0xbe, 0x18, 0x34, 0xa8,
+  0x61, 0xa0, 0x0d, 0x11, 0x08, 0x01, 0x90, 0x08, 0xcc, 0x3b, 0x57, 0xa9,
+  0x1a, 0xa1, 0xa9, 0x43, 0xa0, 0x8d, 0x32, 0xb1, 0x0d, 0x16, 0xb8, 0x48,
+  0x83, 0x9f, 0x20, 0x90, 0x18, 0x82, 0xd9, 0x18, 0x01, 0x9a, 0x34, 0x02,
+  0xcc, 0x8b, 0x41, 0x81, 0xab, 0x2a, 0x01, 0x08, 0x88, 0xca, 0x36, 0xb8,
+  0x8c, 0x27, 0x98, 0x08, 0x31, 0xc8, 0x0e, 0x14, 0xba, 0x18, 0x35, 0xd0,
+  0xba, 0x21, 0x21, 0x88, 0xb1, 0x9f, 0x32, 0xa2, 0x9e, 0x33, 0xb0, 0x0c,
+  0x32, 0x09, 0x08, 0x42, 0xd9, 0xaa, 0x42, 0x98, 0xaa, 0x52, 0x12, 0xbe,
+  0x20, 0xb8, 0x08, 0x24, 0x42, 0xf4, 0xab, 0x42, 0x91, 0x8b, 0x92, 0x1a,
+  0x63, 0xa1, 0x9f, 0x35, 0xba, 0x30, 0x82, 0xad, 0x11, 0x98, 0x21, 0xbb,
+  0x71, 0xc8, 0x4a, 0x14, 0xca, 0x28, 0xa1, 0x08, 0x32, 0xa9, 0x40, 0xa8,
+  0x99, 0x9a, 0x34, 0xa9, 0x0d, 0x41, 0xd1, 0x8b, 0x04, 0xcc, 0x38, 0x93,
+  0x1c, 0x83, 0x8d, 0x37, 0xb8, 0x0c, 0x04, 0xaa, 0x41, 0xa1, 0xac, 0x63,
+  0xa8, 0x2a, 0x04, 0xaa, 0x10, 0xb8, 0x79, 0x83, 0x99, 0xac, 0x30, 0x03,
+  0x08, 0xd8, 0x0b, 0x33, 0xc0, 0x62, 0xa1, 0x9d, 0x00, 0x00, 0x51, 0xb8,
+  0x4a, 0x94, 0x9c, 0x21, 0xa0, 0x29, 0xb2, 0x3c, 0x17, 0xcb, 0x30, 0xa8,
+  0x1b, 0x17, 0xb9, 0x0a, 0x32, 0xb1, 0x1a, 0x35, 0xfb, 0x2b, 0x04, 0x09,
+  0x81, 0x80, 0x09, 0x38, 0x93, 0xaa, 0x80, 0xef, 0x30, 0x93, 0x08, 0xb0,
+  0x8e, 0x41, 0x90, 0x31, 0xe3, 0x0b, 0x93, 0x9b, 0x74, 0xa0, 0x0a, 0x12,
+  0xdb, 0x39, 0x15, 0xb9, 0x28, 0xa2, 0x8e, 0x22, 0x08, 0x9b, 0x12, 0xb9,
+  0x78, 0x93, 0x9e, 0x41, 0x82, 0x9b, 0x38, 0x81, 0xa8, 0x03, 0x2f, 0x00,
+  0xbc, 0x38, 0xc0, 0x1c, 0x32, 0x98, 0x0a, 0x04, 0x28, 0xb0, 0x30, 0xf0,
+  0x0f, 0x23, 0xd0, 0x1a, 0x23, 0x08, 0x51, 0x91, 0x9e, 0x30, 0xd0, 0x2a,
+  0x16, 0xda, 0x49, 0x03, 0xbb, 0x21, 0xb9, 0x2a, 0x23, 0x89, 0xc0, 0x40,
+  0xb0, 0x8c, 0x63, 0xa1, 0x9a, 0x80, 0xfb, 0x28, 0x04, 0x99, 0x80, 0x80,
+  0x15, 0x8a, 0x31, 0xf9, 0x1b, 0x14, 0xb8, 0x8c, 0x18, 0x17, 0x90, 0x19,
+  0xc9, 0x70, 0x93, 0x9c, 0x12, 0xb9, 0x00, 0x10, 0x88, 0x9a, 0x0b, 0x21,
+  0x15, 0xcb, 0x19, 0x27, 0xba, 0x40, 0x84, 0xda, 0x28, 0x81, 0x11, 0xcb,
+  0x39, 0x32, 0xcb, 0x30, 0xb4, 0xac, 0x28, 0xa8, 0x3a, 0x37, 0xcc, 0x28,
+  0x13, 0x08, 0x08, 0x08, 0xa5, 0xad, 0x52, 0x92, 0x0c, 0x98, 0x80, 0xa0,
+  0x98, 0x88, 0x73, 0xb1, 0x60, 0xa8, 0x39, 0x15, 0x9a, 0x81, 0xab, 0x64,
+  0xc1, 0x1c, 0x03, 0xdb, 0x39, 0x04, 0xa8, 0x0a, 0xa1, 0x29, 0x27, 0xaa,
+  0x19, 0x01, 0xab, 0x0a, 0xd2, 0x0a, 0x64, 0x92, 0x98, 0x80, 0x02, 0x28,
+  0xfa, 0x3a, 0xa3, 0xbc, 0x71, 0xa3, 0x89, 0x90, 0x4a, 0x85, 0xcb, 0x33,
+  0xc0, 0x8a, 0x13, 0x82, 0xb0, 0x0a, 0x86, 0xa0, 0x0a, 0x0e, 0x21, 0x21,
+  0xb0, 0xbb, 0x80, 0x65, 0x91, 0x0f, 0x23, 0xa8, 0x1b, 0xd2, 0xad, 0x53,
+  0x82, 0xcb, 0x28, 0x94, 0xac, 0x34, 0xa1, 0x29, 0x93, 0x9e, 0x20, 0x90,
+  0x08, 0xb8, 0x14, 0x9a, 0x22, 0xb2, 0x8a, 0x48, 0xb4, 0xcf, 0x50, 0x89,
+  0x58, 0xa0, 0x0a, 0xb0, 0x39, 0x05, 0x08, 0x81, 0xcb, 0x28, 0x34, 0xea,
+  0x30, 0x07, 0xbb, 0x28, 0xb2, 0x89, 0xa2, 0x9c, 0x32, 0xd2, 0x09, 0x23,
+  0x20, 0xeb, 0x10, 0x06, 0x9d, 0x23, 0xb8, 0x6b, 0x03, 0x9b, 0x31, 0xd8,
+  0x39, 0xa1, 0xbb, 0x51, 0xb8, 0x42, 0xb1, 0x58, 0xb1, 0x9f, 0x12, 0x00,
+  0x5a, 0x00, 0x2f, 0x00, 0x88, 0xbb, 0x4a, 0x16, 0x9a, 0x2a, 0x07, 0xba,
+  0x31, 0x83, 0x89, 0x80, 0xec, 0x29, 0x83, 0xb0, 0x21, 0xf2, 0x89, 0x71,
+  0x01, 0x99, 0x98, 0x08, 0x30, 0x08, 0x08, 0x0b, 0xb8, 0x84, 0x47, 0xc8,
+  0x0e, 0x10, 0x90, 0x10, 0x11, 0xeb, 0x00, 0x01, 0x39, 0x01, 0x9f, 0x32,
+  0x91, 0x08, 0x21, 0xbd, 0x3c, 0xa2, 0x08, 0xb0, 0x7b, 0x13, 0xc9, 0x23,
+  0xaa, 0xfb, 0x89, 0x21, 0x23, 0x80, 0xeb, 0xa0, 0x34, 0xc9, 0x08, 0x22,
+  0xb8, 0x8a, 0x47, 0x11, 0xa9, 0xdc, 0x38, 0x12, 0xbb, 0x21, 0x53, 0xc2,
+  0x9a, 0x8c, 0x22, 0x9d, 0x01, 0x34, 0xa0, 0x82, 0x80, 0x80, 0xbc, 0xc0,
+  0x0c, 0x78, 0x80, 0x80, 0xaa, 0x78, 0xb8, 0x2b, 0x34, 0xc2, 0x9a, 0x08,
+  0x22, 0x43, 0xb2, 0xbf, 0x24, 0xb0, 0x8e, 0x11, 0x01, 0x08, 0xa8, 0x6a,
+  0xa9, 0xa0, 0x5a, 0x03, 0xc8, 0x28, 0xd2, 0x3b, 0x07, 0x88, 0x01, 0x81,
+  0x89, 0xaa, 0x1d, 0x07, 0xdb, 0x3a, 0x94, 0xa9, 0x43, 0xb9, 0x20, 0x91,
+  0x1b, 0x46, 0x99, 0x10, 0x81, 0xbb, 0x08, 0x3b, 0xc3, 0x9f, 0x32, 0xb1,
+  0x2a, 0xa8, 0x33, 0xb7, 0x0c, 0x23, 0xda, 0x30, 0xa2, 0x0d, 0x83, 0x29,
+  0x24, 0xfa, 0xce, 0x19, 0x43, 0x33, 0xb2, 0xba, 0xc9, 0x99, 0x42, 0x43,
+  0x82, 0xc8, 0x9a, 0xa9, 0x9d, 0x18, 0x44, 0x81, 0xc8, 0x8b, 0x13, 0x08,
+  0x43, 0xa0, 0x9c, 0x93, 0xba, 0x63, 0x41, 0x01, 0x9c, 0xc9, 0x8b, 0x34,
+  0x21, 0x80, 0xbd, 0x7a, 0x80, 0xba, 0x21, 0x08, 0x77, 0x77, 0x0e, 0x78,
+  0x88, 0xa0, 0x09, 0xf3, 0x01, 0xc3, 0x80, 0xb4, 0x08, 0xb4, 0x08, 0x88,
+  0x80, 0x00, 0x08, 0x08, 0x88, 0x00, 0x08, 0x88, 0x00, 0x88, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0x08, 0x80, 0x80, 0x08, 0x08,
+  0x80, 0x80, 0x08, 0x80
 };
-unsigned int taunt_wav_len = 91196;
+const unsigned int taunt_adpcm_len = 46336;
+const unsigned int taunt_samples = 91196;
@@ -1,4 +1,16 @@
 
 #pragma once
-extern unsigned char taunt_wav[];
-extern unsigned int taunt_wav_len;
+
+// canned audio played when there's no tuner, kept in flash as mono ima
+// adpcm.  each block is the codec state (predictor little-endian, index,
+// a spare byte) then the codes for TAUNT_BLOCK_SAMPLES samples, two to a
+// byte with the first in the low nibble.  regenerate with tauntgen
+//
+#define TAUNT_SAMPLE_RATE       (22257)
+#define TAUNT_BLOCK_SIZE        (256)
+#define TAUNT_BLOCK_HEADER      (4)
+#define TAUNT_BLOCK_SAMPLES     ((TAUNT_BLOCK_SIZE - TAUNT_BLOCK_HEADER) * 2)
+
+extern const unsigned char taunt_adpcm[];
+extern const unsigned int taunt_adpcm_len;
+extern const unsigned int taunt_samples;
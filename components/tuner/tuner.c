@@ -3,39 +3,269 @@
 #include <settings.h>
 #include <asserts.h>
 #include <errno.h>
+#include <stddef.h>
+#include <string.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(tuner, LOG_LEVEL_INF);
 
 #include <zephyr/kernel.h>
 
-#define MAX_CHANNELS    (32)
+// the station table is sorted by frequency so lookups are a binary search,
+// and when it's full the weakest station makes room
+//
+#define MAX_STATIONS    CONFIG_TUNER_MAX_STATIONS
+
+// The station table is kept in settings as one blob, a header and then
+// only the stations in use.  Boots are counted to date it since there's
+// no clock, and a table older than this is rescanned at startup
+//
+#define STATION_DB_KEY          "Stations"
+#define STATION_DB_VERSION      (1)
+#define STATION_DB_MAX_AGE      (50)
+
+struct station_db_entry
+{
+    uint16_t    freq_10kHz;
+    uint8_t     rssi;
+    uint8_t     reserved;
+    uint32_t    last_seen;
+    char        name[8];
+}
+__packed;
+
+struct station_db
+{
+    uint8_t     version;
+    uint8_t     count;
+    uint16_t    reserved;
+    uint32_t    scanned;
+
+    struct station_db_entry entries[MAX_STATIONS];
+}
+__packed;
+
+#define STATION_DB_HEADER_SIZE  (offsetof(struct station_db, entries))
+
+// the table is saved as one settings value, and an nvs item on the 4KB
+// settings sectors can be a sector less four 8 byte allocation entries
+//
+#define STATION_DB_MAX_SIZE     (4096 - 4 * 8)
+
+BUILD_ASSERT(sizeof(struct station_db) <= STATION_DB_MAX_SIZE, "station table won't fit in one settings item");
+
+// time a discovery slice may take with a radio that can scan.  At least
+// one seek is always started, but one that runs over is left going for the
+// next slice rather than waited on, so an urgent tune waits one slice at most
+//
+#define DISCO_BUDGET_MS         (60)
+
+// Calibration samples the signal on channels across the band before a
+// sweep and sets the seek thresholds a margin above the noise floor.  The
+// floor is taken as the lower quartile of the samples, since in most
+// places most channels are empty, and the thresholds are kept in a range
+// that neither stops on everything nor misses ordinary stations
+//
+#define CAL_SAMPLES             (32)
+#define CAL_HISTOGRAM_SIZE      (64)
+#define CAL_FLOOR_PERCENT       (25)
+#define CAL_RSSI_MARGIN         (6)
+#define CAL_RSSI_MIN            (6)
+#define CAL_RSSI_MAX            (30)
+#define CAL_SNR_MARGIN          (3)
+#define CAL_SNR_MIN             (2)
+#define CAL_SNR_MAX             (15)
+
+// with a second radio sweeping, the time between its slices, how long it
+// listens to each station between sweeps for a complete RDS name (four
+// 0A groups are about 350 ms on a clean signal), and how long it waits
+// after an error before sweeping again
+//
+#define SCANNER_SLICE_MS        (20)
+#define VISIT_DWELL_MS          (2000)
+#define SCANNER_RETRY_MS        (5000)
+
+// RDS names and stations on the edge of reception come and go from one
+// sweep to the next, so a scanner writes its table at most this often
+// to keep the flash from wearing out
+//
+#define SCANNER_SAVE_MS         (30 * 60 * 1000)
+
+// how a sweep went, kept for the last one with fixed seek thresholds and
+// the last with calibrated ones so they can be compared
+//
+struct tuner_sweep_result
+{
+    uint32_t    ms;
+    uint32_t    cal_ms;
+    uint32_t    found;
+    uint32_t    stations;
+    uint8_t     rssi;
+    uint8_t     snr;
+};
 
 static struct tuner_instance
 {
     tuner_state_t    state;
     tuner_t         *radio;
 
+    // an optional second radio that does all the sweeping so the first
+    // one only ever plays
+    //
+    tuner_t         *scanner;
+
     uint16_t    cur_station;
-    bool        rds_changed;
-    const char  *rds_name;
-    const char  *rds_text;
+
+    // what the thread last read back from the radio, which it publishes
+    // as the snapshot, and what reading it costs
+    //
+    struct tuner_status status;
+    uint32_t    status_polls;
+    uint32_t    status_max_us;
+    uint64_t    status_total_us;
+
+    // told when the state, station or RDS changes, status_changed is set
+    // by a poll that saw something a display would show differently
+    //
+    tuner_notify_t notify;
+    void        *notify_ctx;
+    bool        status_changed;
 
     uint32_t    cur_volume;
     uint32_t    pre_disco_freq;
     uint32_t    pre_disco_volume;
-    uint32_t    disco_station;
-    uint16_t    disco_chan;
+
+    // discovery sweeps the band from the cursor up a slice at a time.
+    // it can be paused, by tuning, and resumed where it left off
+    //
+    bool        disco_active;
+    uint32_t    disco_freq;
+    uint32_t    disco_found;
+    uint32_t    sweep;
     uint16_t    seek_threshold;
     uint32_t    min_freq;
     uint32_t    max_freq;
     uint16_t    max_chan;
     uint32_t    kHz_per_channel;
+    uint32_t    scan_ms;
+
+    // seek threshold calibration, a survey of the band at the start of
+    // the first sweep.  until there is one seek_threshold is 0 and the
+    // radio's own seek thresholds decide what a station is
+    //
+    bool        cal_enabled;
+    bool        cal_active;
+    bool        cal_done;
+    bool        cal_have_snr;
+    uint32_t    cal_freq;
+    uint32_t    cal_stride_kHz;
+    uint32_t    cal_samples;
+    uint32_t    cal_ms;
+    uint16_t    cal_rssi_hist[CAL_HISTOGRAM_SIZE];
+    uint16_t    cal_snr_hist[CAL_HISTOGRAM_SIZE];
+    uint8_t     noise_rssi;
+    uint8_t     noise_snr;
+    uint8_t     seek_snr;
+
+    struct tuner_sweep_result sweeps[2];
+
+    // between sweeps the scanner listens to each station in the table,
+    // alternates of the tuned one first, for its signal and RDS name
+    //
+    bool        visit_active;
+    uint8_t     visit_pass;
+    uint32_t    visit_station;
+    uint32_t    visit_freq;
+    int64_t     visit_until;
+    uint32_t    visits;
+    int64_t     scanner_idle_until;
+
+    // the table may differ from what was last saved, and when that was
+    //
+    bool        table_changed;
+    int64_t     saved_at;
 
-    struct station_info stations[MAX_CHANNELS];
+    // boots so far, and the boot the station table was last scanned on
+    //
+    uint32_t    boots;
+    uint32_t    scanned;
+    bool        db_loaded;
+
+    uint32_t    num_stations;
+    struct station_info stations[MAX_STATIONS];
+    uint32_t    last_seen[MAX_STATIONS];
+    uint32_t    seen_sweep[MAX_STATIONS];
 }
 m_tuner;
 
+static struct station_db s_station_db;
+
+// Only the tuner thread changes the station table, and it reads it without
+// the lock.  It holds the lock while it changes the table, and any other
+// thread takes it to copy entries out, TunerGetStations for a whole table
+//
+K_MUTEX_DEFINE(s_station_lock);
+
+// Radios can share a reset line, as the two on the dk do, and pulsing it
+// for one would reset any already brought up.  Each line is only pulsed
+// for the first radio to claim it
+//
+#define TUNER_MAX_RESETS        (4)
+
+static struct
+{
+    const void *port;
+    uint32_t    pin;
+}
+s_resets[TUNER_MAX_RESETS];
+
+// The snapshot other threads read is a seqlock.  Only the tuner thread
+// writes it, making the sequence odd while it copies in a new one, with
+// the scheduler locked so no reader can run in the middle.  A reader
+// copies it out and tries again if the sequence was odd or moved, which
+// only happens if the tuner thread preempted it
+//
+static struct tuner_snapshot s_snapshot;
+static atomic_t s_snapshot_seq;
+static uint32_t s_snapshot_retries;
+
+// Radio commands run on the tuner thread, which owns the radio.  Urgent
+// requests are taken before normal ones and between them the thread does
+// the periodic work of TunerSlice.  A discovery slice is at most about
+// DISCO_BUDGET_MS, which bounds how long an urgent request waits
+//
+#define TUNER_STACKSIZE         (2048)
+#define TUNER_PRIORITY          (2)
+#define TUNER_QUEUE_DEPTH       (8)
+
+struct tuner_request
+{
+    tuner_cmd_t     cmd;
+    uint32_t        arg;
+    tuner_done_t    done;
+    void           *ctx;
+    uint32_t        queued;
+};
+
+K_MSGQ_DEFINE(s_tuner_urgent_queue, sizeof(struct tuner_request), TUNER_QUEUE_DEPTH, 4);
+K_MSGQ_DEFINE(s_tuner_queue, sizeof(struct tuner_request), TUNER_QUEUE_DEPTH, 4);
+K_SEM_DEFINE(s_tuner_pending, 0, 2 * TUNER_QUEUE_DEPTH);
+K_SEM_DEFINE(s_tuner_start, 0, 1);
+
+// time from a request being queued to it being done, for a tune or seek
+// that's when the radio reports STC
+//
+struct tuner_cmd_stats
+{
+    uint32_t    count;
+    uint32_t    last_us;
+    uint32_t    max_us;
+    uint32_t    max_wait_us;
+    uint64_t    total_us;
+};
+
+static struct tuner_cmd_stats s_tuner_stats[TUNER_CMD_COUNT];
+
 static uint32_t TunerChanToFreq(tuner_t *in_radio, const uint16_t in_chan)
 {
     uint32_t freq_kHz = 0;
@@ -80,317 +310,1230 @@ static const char *TunerBandName(const tuner_band_t in_band)
     return rs;
 }
 
-static int TunerDiscoSlice(uint32_t *out_delay, bool *complete)
+static int TunerSaveStations(void)
 {
-    int ret = -ENOENT;
-    uint32_t freq_kHz;
-    uint16_t chan;
-    uint8_t rssi;
-    bool stereo;
-    bool afcrailed;
+    struct station_db *db = &s_station_db;
+    uint32_t station;
+    int ret;
 
-    require(m_tuner.radio, exit);
+    memset(db, 0, sizeof(*db));
+    db->version = STATION_DB_VERSION;
+    db->scanned = m_tuner.scanned;
 
-    if  (complete)
+    for (station = 0; station < m_tuner.num_stations; station++)
     {
-        *complete = false;
+        db->entries[station].freq_10kHz = m_tuner.stations[station].freq_kHz / 10;
+        db->entries[station].rssi = m_tuner.stations[station].rssi;
+        db->entries[station].last_seen = m_tuner.last_seen[station];
+        memcpy(db->entries[station].name, m_tuner.stations[station].name, sizeof(db->entries[station].name));
     }
+    db->count = station;
+
+    ret = SettingsWriteBytes(STATION_DB_KEY, 0, (uint8_t *)db,
+                             STATION_DB_HEADER_SIZE + station * sizeof(struct station_db_entry));
+    require_noerr(ret, exit);
 
-    if (m_tuner.disco_station >= MAX_CHANNELS)
+    m_tuner.db_loaded = true;
+    m_tuner.table_changed = false;
+    m_tuner.saved_at = k_uptime_get();
+    LOG_INF("Saved %u stations", station);
+exit:
+    return ret;
+}
+
+// the stations and names differ from the last table loaded or saved,
+// which is still in s_station_db.  signal levels aren't compared, they
+// move on every sweep
+//
+static bool TunerStationsDiffer(void)
+{
+    struct station_db *db = &s_station_db;
+
+    if (db->count != m_tuner.num_stations)
     {
-        m_tuner.disco_station = 0;
-        m_tuner.disco_chan = 0;
+        return true;
+    }
 
-        // clear out all channel info
-        //
-        for (chan = 0; chan < MAX_CHANNELS; chan++)
+    for (uint32_t station = 0; station < m_tuner.num_stations; station++)
+    {
+        if (    db->entries[station].freq_10kHz != m_tuner.stations[station].freq_kHz / 10
+            ||  memcmp(db->entries[station].name, m_tuner.stations[station].name, sizeof(db->entries[station].name)))
         {
-            m_tuner.stations[m_tuner.disco_chan].channel = 0;
-            m_tuner.stations[m_tuner.disco_chan].freq_kHz = 0;
-            m_tuner.stations[m_tuner.disco_chan].rssi = 0;
-            memset(m_tuner.stations[m_tuner.disco_chan].name, 0, sizeof(m_tuner.stations[m_tuner.disco_chan].name));
-            memset(m_tuner.stations[m_tuner.disco_chan].text, 0, sizeof(m_tuner.stations[m_tuner.disco_chan].text));
+            return true;
         }
+    }
 
-        // get band params from radio
-        ret = m_tuner.radio->get_band_info(m_tuner.radio, TUNER_FM, &m_tuner.min_freq, &m_tuner.max_freq, &m_tuner.kHz_per_channel);
-        require_noerr(ret, exit);
-
-        m_tuner.max_chan = TunerFreqToChan(m_tuner.radio, m_tuner.max_freq);
+    return false;
+}
 
-        LOG_INF("Scanning for channels. band:%s  fMin=%5.1f fMax=%5.1f step=%ukHz",
-                TunerBandName(TUNER_FM), (float)m_tuner.min_freq / 1000.0,
-                (float)m_tuner.max_freq / 1000.0, m_tuner.kHz_per_channel);
+// a scanner saves a changed table no more than every SCANNER_SAVE_MS, a
+// change in that time stays pending for the next chance
+//
+static void TunerScannerSave(void)
+{
+    if (!m_tuner.table_changed || k_uptime_get() - m_tuner.saved_at < SCANNER_SAVE_MS)
+    {
+        return;
     }
 
-    // set current channel
-    //
-    ret = m_tuner.radio->set_tune(m_tuner.radio, TunerChanToFreq(m_tuner.radio, m_tuner.disco_chan));
-    if (ret)
+    if (!TunerStationsDiffer())
     {
-        return ret;
+        m_tuner.table_changed = false;
+        return;
     }
 
-    // get tuned-to frequency and signal strength
-    //
-    k_msleep(10);
+    TunerSaveStations();
+}
 
-    ret = m_tuner.radio->get_rssi(m_tuner.radio, &rssi, &stereo, &afcrailed);
-    require_noerr(ret, exit);
+// get band params from radio
+//
+static int TunerBandInfo(void)
+{
+    int ret;
 
-    ret = m_tuner.radio->get_tune(m_tuner.radio, &freq_kHz);
+    ret = m_tuner.radio->get_band_info(m_tuner.radio, TUNER_FM, &m_tuner.min_freq, &m_tuner.max_freq, &m_tuner.kHz_per_channel);
     require_noerr(ret, exit);
 
-    chan = TunerFreqToChan(m_tuner.radio, freq_kHz);
+    m_tuner.max_chan = TunerFreqToChan(m_tuner.radio, m_tuner.max_freq);
+exit:
+    return ret;
+}
+
+// fill the station table from settings, anything that doesn't look right
+// leaves it empty so discovery fills it instead
+//
+static int TunerLoadStations(void)
+{
+    struct station_db *db = &s_station_db;
+    uint32_t freq_kHz;
+    size_t count = 0;
+    int ret;
+
+    k_mutex_lock(&s_station_lock, K_FOREVER);
 
-    LOG_DBG("disco check chan %u at %u 0x%04X", m_tuner.disco_chan, chan, rssi);
+    ret = TunerBandInfo();
+    require_noerr(ret, exit);
 
-    // for stations with signal, add to our database
+    // not there is the usual first boot, not an error
     //
-    if (rssi >= m_tuner.seek_threshold && !afcrailed)
+    ret = SettingsReadBytes(STATION_DB_KEY, 0, (uint8_t *)db, sizeof(*db), &count);
+    if (ret)
     {
-        LOG_INF("Disco add %d chan %d rssi 0x%04X", m_tuner.disco_station, chan, rssi);
+        goto exit;
+    }
 
-        m_tuner.stations[m_tuner.disco_station].channel = chan;
-        m_tuner.stations[m_tuner.disco_station].freq_kHz = TunerChanToFreq(m_tuner.radio, chan);
-        m_tuner.stations[m_tuner.disco_station].rssi = rssi;
+    require_action_quiet(
+                count >= STATION_DB_HEADER_SIZE
+            &&  db->version == STATION_DB_VERSION
+            &&  db->count <= MAX_STATIONS
+            &&  count == STATION_DB_HEADER_SIZE + db->count * sizeof(struct station_db_entry),
+            exit, ret = -EINVAL);
 
-        m_tuner.disco_station++;
-        if (m_tuner.disco_station >= MAX_CHANNELS)
-        {
-            // TODO evict weakest and move slots up?
-            LOG_ERR("too many channels");
-            if (complete)
-            {
-                *complete = true;
-            }
-        }
+    memset(m_tuner.stations, 0, sizeof(m_tuner.stations));
 
-        ret = 0;
+    for (uint32_t station = 0; station < db->count; station++)
+    {
+        freq_kHz = db->entries[station].freq_10kHz * 10;
+
+        // lookups rely on the table being in frequency order
+        //
+        require_action_quiet(freq_kHz >= m_tuner.min_freq && freq_kHz <= m_tuner.max_freq, exit, ret = -EINVAL);
+        require_action_quiet(station == 0 || freq_kHz > m_tuner.stations[station - 1].freq_kHz, exit, ret = -EINVAL);
+
+        m_tuner.stations[station].channel = TunerFreqToChan(m_tuner.radio, freq_kHz);
+        m_tuner.stations[station].freq_kHz = freq_kHz;
+        m_tuner.stations[station].rssi = db->entries[station].rssi ? db->entries[station].rssi : 1;
+        memcpy(m_tuner.stations[station].name, db->entries[station].name, sizeof(db->entries[station].name));
+        m_tuner.last_seen[station] = db->entries[station].last_seen;
     }
 
-    m_tuner.disco_chan = chan;
+    m_tuner.num_stations = db->count;
+    m_tuner.scanned = db->scanned;
+    m_tuner.db_loaded = true;
 
-    if (afcrailed)
+    LOG_INF("Loaded %u stations, scanned %u boots ago", db->count, m_tuner.boots - m_tuner.scanned);
+exit:
+    if (ret && ret != -ENOENT)
     {
-        // if AFCRL was set in rssi, it means we are close to a strong station
-        // so just bump up one channel
-        //
-        LOG_INF("Fudge at chan %u 0x%04X", chan, rssi);
-        m_tuner.disco_chan = chan + 1;
-
-        if (m_tuner.disco_chan > m_tuner.max_chan)
-        {
-            if (complete)
-            {
-                *complete = true;
-            }
-        }
+        LOG_WRN("Station table not loaded %d", ret);
+        memset(m_tuner.stations, 0, sizeof(m_tuner.stations));
+        m_tuner.num_stations = 0;
     }
-    else
+    k_mutex_unlock(&s_station_lock);
+    return ret;
+}
+
+// binary search for in_freq_kHz, out_index is where it is or where it
+// would go
+//
+static int TunerFindStation(uint32_t in_freq_kHz, uint32_t *out_index)
+{
+    uint32_t lo = 0;
+    uint32_t hi = m_tuner.num_stations;
+    uint32_t mid;
+
+    while (lo < hi)
     {
-        // seek up to next chan
-        //
-        ret = m_tuner.radio->seek(m_tuner.radio, true, true);
-        if (ret)
+        mid = (lo + hi) / 2;
+
+        if (m_tuner.stations[mid].freq_kHz < in_freq_kHz)
         {
-            LOG_INF("seek fail, recheck from %u", m_tuner.disco_chan);
-            m_tuner.disco_chan = chan + 1;
+            lo = mid + 1;
         }
         else
         {
-            ret = m_tuner.radio->get_tune(m_tuner.radio, &freq_kHz);
-            require_noerr(ret, exit);
+            hi = mid;
+        }
+    }
+
+    *out_index = lo;
+
+    if (lo < m_tuner.num_stations && m_tuner.stations[lo].freq_kHz == in_freq_kHz)
+    {
+        return 0;
+    }
+
+    return -ENOENT;
+}
+
+// with s_station_lock held
+//
+static void TunerRemoveStation(uint32_t in_station)
+{
+    uint32_t count = m_tuner.num_stations;
+
+    for (uint32_t station = in_station; station + 1 < count; station++)
+    {
+        m_tuner.stations[station] = m_tuner.stations[station + 1];
+        m_tuner.last_seen[station] = m_tuner.last_seen[station + 1];
+        m_tuner.seen_sweep[station] = m_tuner.seen_sweep[station + 1];
+    }
+
+    memset(&m_tuner.stations[count - 1], 0, sizeof(m_tuner.stations[0]));
+    m_tuner.num_stations--;
+    m_tuner.table_changed = true;
+}
+
+// the sweep has passed this station without finding it
+//
+static bool TunerStationGone(uint32_t in_station)
+{
+    return m_tuner.disco_active
+        && m_tuner.seen_sweep[in_station] != m_tuner.sweep
+        && m_tuner.stations[in_station].freq_kHz < m_tuner.disco_freq;
+}
+
+// merge a station found by discovery into the table, which is kept in
+// frequency order.  a station already there is refreshed, a new one goes
+// in its place or, with the table full, replaces the weakest if stronger
+//
+static void TunerStationFound(uint32_t in_freq_kHz, uint8_t in_rssi)
+{
+    uint16_t chan = TunerFreqToChan(m_tuner.radio, in_freq_kHz);
+    uint32_t freq_kHz = TunerChanToFreq(m_tuner.radio, chan);
+    uint32_t station;
+    uint32_t weakest;
+
+    if (in_rssi == 0)
+    {
+        in_rssi = 1;
+    }
+
+    m_tuner.disco_found++;
 
-            chan = TunerFreqToChan(m_tuner.radio, freq_kHz);
+    k_mutex_lock(&s_station_lock, K_FOREVER);
+
+    if (!TunerFindStation(freq_kHz, &station))
+    {
+        m_tuner.stations[station].rssi = in_rssi;
+        m_tuner.last_seen[station] = m_tuner.boots;
+        m_tuner.seen_sweep[station] = m_tuner.sweep;
+        goto exit;
+    }
 
-            LOG_INF("Seek up to chan %u 0x%04X", chan, rssi);
-            if (chan < m_tuner.disco_chan)
+    if (m_tuner.num_stations >= MAX_STATIONS)
+    {
+        // a station below here the sweep didn't find is gone already, so
+        // that's the one to drop, otherwise the weakest
+        //
+        weakest = 0;
+        for (uint32_t index = 1; index < m_tuner.num_stations; index++)
+        {
+            if (TunerStationGone(index) != TunerStationGone(weakest))
             {
-                //wrapped, all done
-                if (complete)
+                if (TunerStationGone(index))
                 {
-                    *complete = true;
+                    weakest = index;
                 }
             }
+            else if (m_tuner.stations[index].rssi < m_tuner.stations[weakest].rssi)
+            {
+                weakest = index;
+            }
+        }
+
+        if (!TunerStationGone(weakest) && m_tuner.stations[weakest].rssi >= in_rssi)
+        {
+            LOG_INF("table full, skip chan %u rssi %u", chan, in_rssi);
+            goto exit;
+        }
 
-            m_tuner.disco_chan = chan;
+        LOG_INF("table full, replace %4.1f", (float)m_tuner.stations[weakest].freq_kHz / 1000.0);
+        TunerRemoveStation(weakest);
+
+        if (weakest < station)
+        {
+            station--;
         }
     }
+
+    for (uint32_t index = m_tuner.num_stations; index > station; index--)
+    {
+        m_tuner.stations[index] = m_tuner.stations[index - 1];
+        m_tuner.last_seen[index] = m_tuner.last_seen[index - 1];
+        m_tuner.seen_sweep[index] = m_tuner.seen_sweep[index - 1];
+    }
+
+    LOG_INF("Disco add %u chan %u rssi 0x%04X", station, chan, in_rssi);
+
+    memset(&m_tuner.stations[station], 0, sizeof(m_tuner.stations[station]));
+    m_tuner.stations[station].channel = chan;
+    m_tuner.stations[station].freq_kHz = freq_kHz;
+    m_tuner.stations[station].rssi = in_rssi;
+    m_tuner.last_seen[station] = m_tuner.boots;
+    m_tuner.seen_sweep[station] = m_tuner.sweep;
+    m_tuner.num_stations++;
+    m_tuner.table_changed = true;
 exit:
-    return ret;
+    k_mutex_unlock(&s_station_lock);
 }
 
-int TunerGetTunedStationFreq(
-                        uint32_t    *out_freq_kHz
-                        )
+static int TunerScanFound(void *in_ctx, uint32_t in_freq_kHz, uint8_t in_rssi)
 {
-    int ret = -ENOENT;
+    TunerStationFound(in_freq_kHz, in_rssi);
+    return 0;
+}
 
-    require(m_tuner.radio, exit);
-    require_action(m_tuner.state == TUNER_TUNED, exit, ret = -EAGAIN);
+// the radio that sweeps the band, the second one if there is one
+//
+static tuner_t *TunerSweepRadio(void)
+{
+    return m_tuner.scanner ? m_tuner.scanner : m_tuner.radio;
+}
 
-    ret = m_tuner.radio->get_tune(m_tuner.radio, out_freq_kHz);
-exit:
-    return ret;
+// start surveying the band, a sample every cal_stride_kHz from the bottom
+//
+static void TunerCalStart(void)
+{
+    uint32_t channels = (m_tuner.max_freq - m_tuner.min_freq) / m_tuner.kHz_per_channel + 1;
+    uint32_t stride = channels / CAL_SAMPLES;
+
+    if (!stride)
+    {
+        stride = 1;
+    }
+
+    m_tuner.cal_stride_kHz = stride * m_tuner.kHz_per_channel;
+    m_tuner.cal_freq = m_tuner.min_freq;
+    m_tuner.cal_samples = 0;
+    m_tuner.cal_ms = 0;
+    m_tuner.cal_have_snr = false;
+    memset(m_tuner.cal_rssi_hist, 0, sizeof(m_tuner.cal_rssi_hist));
+    memset(m_tuner.cal_snr_hist, 0, sizeof(m_tuner.cal_snr_hist));
+    m_tuner.cal_active = true;
 }
 
-int TunerGetTunedStationRSSI(
-                        uint8_t     *out_rssi,
-                        bool        *out_stereo
-                        )
+// the lowest value at least in_percent of the samples are at or below
+//
+static uint8_t TunerCalPercentile(const uint16_t *in_hist, uint32_t in_percent)
 {
-    int ret = -ENOENT;
-    bool railed;
+    uint32_t want = (m_tuner.cal_samples * in_percent + 99) / 100;
+    uint32_t count = 0;
+    uint8_t bin;
 
-    require(m_tuner.radio, exit);
-    require_action(m_tuner.state == TUNER_TUNED, exit, ret = -EAGAIN);
+    for (bin = 0; bin < CAL_HISTOGRAM_SIZE - 1; bin++)
+    {
+        count += in_hist[bin];
+        if (count >= want)
+        {
+            break;
+        }
+    }
 
-    ret = m_tuner.radio->get_rssi(m_tuner.radio, out_rssi, out_stereo, &railed);
-exit:
-    return ret;
+    return bin;
 }
 
-int TunerGetTunedStationRDS(
-                        const char  **rds_short,
-                        const char  **rds_long
-                        )
+static uint8_t TunerCalLimit(uint32_t in_value, uint8_t in_min, uint8_t in_max)
 {
-    int ret = -ENOENT;
-    bool rds_changed;
+    if (in_value < in_min)
+    {
+        return in_min;
+    }
 
-    require(m_tuner.radio, exit);
-    require_action(m_tuner.state == TUNER_TUNED, exit, ret = -EAGAIN);
+    if (in_value > in_max)
+    {
+        return in_max;
+    }
 
-    ret = m_tuner.radio->get_rds(m_tuner.radio, &rds_changed, rds_short, rds_long);
-exit:
-    return ret;
+    return in_value;
 }
 
-int TunerSetVolume(const uint32_t in_volume_percent)
+// the survey is done, set the seek thresholds from its noise floor
+//
+static int TunerCalDone(void)
 {
-    int ret = -ENOENT;
+    uint8_t rssi;
+    uint8_t snr = 0;
+    int ret = -ENODATA;
 
-    require(m_tuner.radio, exit);
+    m_tuner.cal_active = false;
 
-    if (m_tuner.state < TUNER_READY)
+    require(m_tuner.cal_samples, exit);
+
+    m_tuner.noise_rssi = TunerCalPercentile(m_tuner.cal_rssi_hist, CAL_FLOOR_PERCENT);
+    rssi = TunerCalLimit(m_tuner.noise_rssi + CAL_RSSI_MARGIN, CAL_RSSI_MIN, CAL_RSSI_MAX);
+
+    // a radio that doesn't measure SNR reports 0, its SNR threshold is
+    // left as it is
+    //
+    m_tuner.noise_snr = 0;
+    if (m_tuner.cal_have_snr)
     {
-        ret = -EAGAIN;
-        goto exit;
+        m_tuner.noise_snr = TunerCalPercentile(m_tuner.cal_snr_hist, CAL_FLOOR_PERCENT);
+        snr = TunerCalLimit(m_tuner.noise_snr + CAL_SNR_MARGIN, CAL_SNR_MIN, CAL_SNR_MAX);
     }
 
-    ret = m_tuner.radio->set_volume(m_tuner.radio, in_volume_percent);
+    ret = TunerSweepRadio()->set_seek_threshold(TunerSweepRadio(), rssi, snr);
     require_noerr(ret, exit);
 
-    m_tuner.cur_volume = in_volume_percent;
-    ret = SettingsWriteUint32("Vol", 0, in_volume_percent);
-    require_noerr(ret, exit);
+    m_tuner.seek_threshold = rssi;
+    m_tuner.seek_snr = snr;
+    m_tuner.cal_done = true;
+
+    LOG_INF("Noise floor rssi %u snr %u from %u samples in %u ms, seek at rssi %u snr %u",
+            m_tuner.noise_rssi, m_tuner.noise_snr, m_tuner.cal_samples, m_tuner.cal_ms, rssi, snr);
 exit:
     return ret;
 }
 
-int TunerTuneTo(uint32_t freq_kHz)
+// sample the band from the survey cursor on, for about DISCO_BUDGET_MS
+//
+static int TunerCalStep(void)
 {
-    int ret = -ENOENT;
-
-    require(m_tuner.radio, exit);
+    tuner_t *radio = TunerSweepRadio();
+    int64_t start = k_uptime_get();
+    struct tuner_status status;
+    int ret = 0;
 
-    if (m_tuner.state < TUNER_READY)
+    while (m_tuner.cal_freq <= m_tuner.max_freq)
     {
-        ret = -EAGAIN;
-        goto exit;
+        ret = radio->set_tune(radio, m_tuner.cal_freq);
+        require_noerr(ret, exit);
+
+        ret = radio->get_status(radio, &status);
+        require_noerr(ret, exit);
+
+        m_tuner.cal_rssi_hist[MIN(status.rssi, CAL_HISTOGRAM_SIZE - 1)]++;
+        m_tuner.cal_snr_hist[MIN(status.snr, CAL_HISTOGRAM_SIZE - 1)]++;
+        if (status.snr)
+        {
+            m_tuner.cal_have_snr = true;
+        }
+
+        m_tuner.cal_samples++;
+        m_tuner.cal_freq += m_tuner.cal_stride_kHz;
+
+        if ((k_uptime_get() - start) >= DISCO_BUDGET_MS)
+        {
+            break;
+        }
     }
 
-    ret = m_tuner.radio->set_tune(m_tuner.radio, freq_kHz);
-    require_noerr(ret, exit);
+    m_tuner.cal_ms += (uint32_t)(k_uptime_get() - start);
 
-    m_tuner.state = TUNER_TUNED;
+    if (m_tuner.cal_freq > m_tuner.max_freq)
+    {
+        ret = TunerCalDone();
+    }
+exit:
+    return ret;
+}
 
-    ret = SettingsWriteUint32("Freq", 0, freq_kHz);
+// start a sweep from the bottom of the band.  the table is kept, what the
+// sweep finds is merged in as it goes
+//
+static int TunerSweepStart(void)
+{
+    int ret;
+
+    ret = TunerBandInfo();
     require_noerr(ret, exit);
 
-    m_tuner.cur_station = MAX_CHANNELS;
+    m_tuner.sweep++;
+    m_tuner.disco_active = true;
+    m_tuner.disco_freq = m_tuner.min_freq;
+    m_tuner.disco_found = 0;
+    m_tuner.scan_ms = 0;
 
-    for (uint16_t station = 0; station < MAX_CHANNELS; station++)
+    // the first sweep surveys the band for its seek thresholds first
+    //
+    m_tuner.cal_active = false;
+    if (m_tuner.cal_enabled && !m_tuner.cal_done && TunerSweepRadio()->set_seek_threshold)
     {
-        if (m_tuner.stations[station].rssi > 0)
-        {
-            if (m_tuner.stations[station].freq_kHz == freq_kHz)
-            {
-                m_tuner.cur_station = station;
-                break;
-            }
-        }
+        TunerCalStart();
     }
 
+    LOG_INF("Scanning for channels. band:%s  fMin=%5.1f fMax=%5.1f step=%ukHz",
+            TunerBandName(TUNER_FM), (float)m_tuner.min_freq / 1000.0,
+            (float)m_tuner.max_freq / 1000.0, m_tuner.kHz_per_channel);
 exit:
     return ret;
 }
 
-int TunerDiscoverStations(void)
+// the sweep covered the whole band, so anything it didn't find is gone
+//
+static void TunerSweepDone(void)
 {
-    int ret = -ENOENT;
+    struct tuner_sweep_result *result = &m_tuner.sweeps[m_tuner.cal_done ? 1 : 0];
+    uint32_t station = 0;
+    bool save;
 
-    require(m_tuner.radio, exit);
+    k_mutex_lock(&s_station_lock, K_FOREVER);
+
+    while (station < m_tuner.num_stations)
+    {
+        if (m_tuner.seen_sweep[station] != m_tuner.sweep)
+        {
+            LOG_INF("Disco drop %4.1f", (float)m_tuner.stations[station].freq_kHz / 1000.0);
+            TunerRemoveStation(station);
+        }
+        else
+        {
+            station++;
+        }
+    }
+
+    k_mutex_unlock(&s_station_lock);
+
+    // a scanner sweeps over and over, so its table is always written on
+    // the first sweep of a boot to date it, and otherwise as
+    // TunerScannerSave allows
+    //
+    save = !m_tuner.scanner || m_tuner.scanned != m_tuner.boots;
+
+    m_tuner.disco_active = false;
+    m_tuner.scanned = m_tuner.boots;
+
+    result->ms = m_tuner.scan_ms;
+    result->cal_ms = m_tuner.cal_done ? m_tuner.cal_ms : 0;
+    result->found = m_tuner.disco_found;
+    result->stations = m_tuner.num_stations;
+    result->rssi = m_tuner.seek_threshold;
+    result->snr = m_tuner.seek_snr;
+
+    LOG_INF("Scan found %u stations in %u ms, seek thresholds %s",
+            m_tuner.disco_found, m_tuner.scan_ms, m_tuner.cal_done ? "calibrated" : "fixed");
+
+    if (save)
+    {
+        TunerSaveStations();
+    }
+    else
+    {
+        TunerScannerSave();
+    }
+}
+
+// one candidate per slice for radios that can't scan, tune the cursor,
+// check it, then seek on from it
+//
+static int TunerDiscoSlice(bool *complete)
+{
+    tuner_t *radio = TunerSweepRadio();
+    int ret = -ENOENT;
+    uint32_t freq_kHz;
+    uint8_t rssi;
+    bool stereo;
+    bool afcrailed;
+
+    require(radio, exit);
+
+    *complete = false;
+
+    // set current channel
+    //
+    ret = radio->set_tune(radio, m_tuner.disco_freq);
+    require_noerr(ret, exit);
+
+    // get tuned-to frequency and signal strength
+    //
+    k_msleep(10);
+
+    ret = radio->get_rssi(radio, &rssi, &stereo, &afcrailed);
+    require_noerr(ret, exit);
+
+    ret = radio->get_tune(radio, &freq_kHz);
+    require_noerr(ret, exit);
+
+    LOG_DBG("disco check %u at %u 0x%04X", m_tuner.disco_freq, freq_kHz, rssi);
+
+    // for stations with signal, add to our database
+    //
+    if (rssi >= m_tuner.seek_threshold && !afcrailed)
+    {
+        TunerStationFound(freq_kHz, rssi);
+    }
+
+    if (afcrailed)
+    {
+        // if AFCRL was set in rssi, it means we are close to a strong station
+        // so just bump up one channel
+        //
+        LOG_INF("Fudge at %u 0x%04X", freq_kHz, rssi);
+        m_tuner.disco_freq = freq_kHz + m_tuner.kHz_per_channel;
+    }
+    else
+    {
+        // seek up to next chan
+        //
+        ret = radio->seek(radio, true, true);
+        if (ret)
+        {
+            LOG_INF("seek fail, recheck from %u", freq_kHz);
+            m_tuner.disco_freq = freq_kHz + m_tuner.kHz_per_channel;
+            ret = 0;
+        }
+        else
+        {
+            ret = radio->get_tune(radio, &m_tuner.disco_freq);
+            require_noerr(ret, exit);
+
+            LOG_INF("Seek up to %u 0x%04X", m_tuner.disco_freq, rssi);
+            if (m_tuner.disco_freq <= freq_kHz)
+            {
+                //wrapped, all done
+                *complete = true;
+            }
+        }
+    }
+
+    if (m_tuner.disco_freq > m_tuner.max_freq)
+    {
+        *complete = true;
+    }
+exit:
+    return ret;
+}
+
+// a budgeted piece of the sweep, from the cursor on
+//
+static int TunerDiscoStep(bool *complete)
+{
+    tuner_t *radio = TunerSweepRadio();
+    int64_t start = k_uptime_get();
+    uint32_t next_kHz;
+    int ret;
+
+    *complete = false;
+
+    if (m_tuner.cal_active)
+    {
+        return TunerCalStep();
+    }
+
+    if (radio->scan)
+    {
+        ret = radio->scan(radio, m_tuner.disco_freq, DISCO_BUDGET_MS,
+                                  TunerScanFound, NULL, &next_kHz);
+        if (!ret)
+        {
+            if (next_kHz == 0)
+            {
+                *complete = true;
+            }
+            else
+            {
+                m_tuner.disco_freq = next_kHz;
+            }
+        }
+    }
+    else
+    {
+        ret = TunerDiscoSlice(complete);
+    }
+
+    m_tuner.scan_ms += (uint32_t)(k_uptime_get() - start);
+    return ret;
+}
+
+// read the tuned station's status from the radio into the cache
+//
+static int TunerPollStatus(void)
+{
+    struct tuner_status *status = &m_tuner.status;
+    uint32_t freq_kHz = status->freq_kHz;
+    bool stereo = status->stereo;
+    uint32_t start;
+    uint32_t elapsed_us;
+    int ret = -EAGAIN;
+
+    require(m_tuner.state == TUNER_TUNED, exit);
+
+    start = k_cycle_get_32();
+    ret = m_tuner.radio->get_status(m_tuner.radio, status);
+    elapsed_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+    require_noerr(ret, exit);
+
+    m_tuner.status_polls++;
+    m_tuner.status_total_us += elapsed_us;
+    if (elapsed_us > m_tuner.status_max_us)
+    {
+        m_tuner.status_max_us = elapsed_us;
+    }
+
+    if (    status->rds_changed
+        ||  freq_kHz != status->freq_kHz
+        ||  stereo != status->stereo)
+    {
+        m_tuner.status_changed = true;
+    }
+exit:
+    return ret;
+}
+
+// tuner thread only, publish what it knows now if a reader would see
+// anything different from the last snapshot
+//
+static void TunerPublish(void)
+{
+    struct tuner_snapshot next;
+    const struct tuner_status *status = &m_tuner.status;
+
+    memset(&next, 0, sizeof(next));
+    next.version = s_snapshot.version;
+    next.state = m_tuner.state;
+
+    if (m_tuner.state == TUNER_TUNED)
+    {
+        next.freq_kHz = status->freq_kHz;
+        next.rssi = status->rssi;
+        next.snr = status->snr;
+        next.stereo = status->stereo;
+
+        // the radio's RDS strings are only good until its next call
+        //
+        if (status->rds_short)
+        {
+            strncpy(next.rds_short, status->rds_short, sizeof(next.rds_short) - 1);
+        }
+        if (status->rds_long)
+        {
+            strncpy(next.rds_long, status->rds_long, sizeof(next.rds_long) - 1);
+        }
+    }
+
+    if (!memcmp(&next, &s_snapshot, sizeof(next)))
+    {
+        return;
+    }
+
+    next.version++;
+
+    k_sched_lock();
+    atomic_inc(&s_snapshot_seq);
+    memcpy(&s_snapshot, &next, sizeof(s_snapshot));
+    atomic_inc(&s_snapshot_seq);
+    k_sched_unlock();
+}
+
+int TunerGetSnapshot(
+                        struct tuner_snapshot *out_snapshot
+                        )
+{
+    int ret = -EINVAL;
+    atomic_val_t seq;
+
+    require(out_snapshot, exit);
+    require_action(m_tuner.radio, exit, ret = -ENOENT);
+
+    while (true)
+    {
+        seq = atomic_get(&s_snapshot_seq);
+        compiler_barrier();
+        memcpy(out_snapshot, &s_snapshot, sizeof(*out_snapshot));
+        compiler_barrier();
+
+        if (!(seq & 1) && seq == atomic_get(&s_snapshot_seq))
+        {
+            break;
+        }
+
+        s_snapshot_retries++;
+    }
+
+    ret = 0;
+exit:
+    return ret;
+}
+
+int TunerGetTunedStationFreq(
+                        uint32_t    *out_freq_kHz
+                        )
+{
+    struct tuner_snapshot snapshot;
+    int ret;
+
+    ret = TunerGetSnapshot(&snapshot);
+    require_noerr(ret, exit);
+    require_action_quiet(snapshot.state == TUNER_TUNED, exit, ret = -EAGAIN);
+
+    *out_freq_kHz = snapshot.freq_kHz;
+exit:
+    return ret;
+}
+
+int TunerGetTunedStationRSSI(
+                        uint8_t     *out_rssi,
+                        bool        *out_stereo
+                        )
+{
+    struct tuner_snapshot snapshot;
+    int ret;
+
+    ret = TunerGetSnapshot(&snapshot);
+    require_noerr(ret, exit);
+    require_action_quiet(snapshot.state == TUNER_TUNED, exit, ret = -EAGAIN);
+
+    *out_rssi = snapshot.rssi;
+    *out_stereo = snapshot.stereo;
+exit:
+    return ret;
+}
+
+int TunerSetVolume(const uint32_t in_volume_percent)
+{
+    int ret = -ENOENT;
+
+    require(m_tuner.radio, exit);
+
+    if (m_tuner.state < TUNER_READY)
+    {
+        ret = -EAGAIN;
+        goto exit;
+    }
+
+    ret = m_tuner.radio->set_volume(m_tuner.radio, in_volume_percent);
+    require_noerr(ret, exit);
+
+    m_tuner.cur_volume = in_volume_percent;
+    ret = SettingsWriteUint32("Vol", 0, in_volume_percent);
+    require_noerr(ret, exit);
+exit:
+    return ret;
+}
+
+// tuning pauses discovery, it keeps its place to pick up from later
+//
+static int TunerPauseDiscovery(void)
+{
+    int ret = 0;
+
+    if (m_tuner.state == TUNER_DISCOVERY)
+    {
+        LOG_INF("Discovery paused at %u", m_tuner.disco_freq);
+        m_tuner.state = TUNER_READY;
+    }
+
+    if (m_tuner.state < TUNER_READY)
+    {
+        ret = -EAGAIN;
+    }
+
+    return ret;
+}
+
+// the radio has settled on freq_kHz
+//
+static int TunerTuned(uint32_t freq_kHz)
+{
+    uint32_t station;
+    int ret;
+
+    m_tuner.state = TUNER_TUNED;
+
+    // the signal and RDS are picked up on the next slice
+    //
+    memset(&m_tuner.status, 0, sizeof(m_tuner.status));
+    m_tuner.status.freq_kHz = freq_kHz;
+
+    if (TunerFindStation(freq_kHz, &station))
+    {
+        station = MAX_STATIONS;
+    }
+
+    m_tuner.cur_station = station;
+
+    ret = SettingsWriteUint32("Freq", 0, freq_kHz);
+    require_noerr(ret, exit);
+exit:
+    return ret;
+}
+
+int TunerTuneTo(uint32_t freq_kHz)
+{
+    int ret = -ENOENT;
+
+    require(m_tuner.radio, exit);
+
+    ret = TunerPauseDiscovery();
+    if (ret)
+    {
+        goto exit;
+    }
+
+    ret = m_tuner.radio->set_tune(m_tuner.radio, freq_kHz);
+    require_noerr(ret, exit);
+
+    ret = TunerTuned(freq_kHz);
+exit:
+    return ret;
+}
+
+// seek to the next station or step one channel, up or down
+//
+static int TunerStep(bool in_seek, bool in_up)
+{
+    uint32_t freq_kHz;
+    int ret = -ENOENT;
+
+    require(m_tuner.radio, exit);
+
+    ret = TunerPauseDiscovery();
+    if (ret)
+    {
+        goto exit;
+    }
+
+    if (in_seek)
+    {
+        ret = m_tuner.radio->seek(m_tuner.radio, in_up, true);
+    }
+    else
+    {
+        ret = m_tuner.radio->tune(m_tuner.radio, in_up, true);
+    }
+    require_noerr(ret, exit);
+
+    ret = m_tuner.radio->get_tune(m_tuner.radio, &freq_kHz);
+    require_noerr(ret, exit);
+
+    ret = TunerTuned(freq_kHz);
+exit:
+    return ret;
+}
+
+// switch between calibrated and the radio's fixed seek thresholds, then
+// sweep again from the bottom with them so the two can be compared
+//
+static int TunerCalibrate(bool in_enable)
+{
+    int ret = -ENOTSUP;
+
+    require_action_quiet(TunerSweepRadio()->set_seek_threshold, exit, ret = -ENOTSUP);
+
+    m_tuner.cal_enabled = in_enable;
+    m_tuner.cal_done = false;
+
+    if (!in_enable)
+    {
+        ret = TunerSweepRadio()->set_seek_threshold(TunerSweepRadio(), 0, 0);
+        require_noerr(ret, exit);
+
+        m_tuner.seek_threshold = 0;
+        m_tuner.seek_snr = 0;
+    }
+
+    if (m_tuner.state == TUNER_DISCOVERY)
+    {
+        ret = TunerSweepStart();
+    }
+    else
+    {
+        m_tuner.disco_active = false;
+        ret = TunerDiscoverStations();
+    }
+exit:
+    return ret;
+}
+
+int TunerDiscoverStations(void)
+{
+    int ret = -ENOENT;
+
+    require(m_tuner.radio, exit);
+
+    if (m_tuner.state == TUNER_DISCOVERY)
+    {
+        ret = 0;
+        goto exit;
+    }
+
+    if (m_tuner.state < TUNER_READY)
+    {
+        ret = -EAGAIN;
+        goto exit;
+    }
+
+    // the scanner is always sweeping, or visiting between sweeps, so this
+    // only starts the next sweep now
+    //
+    if (m_tuner.scanner)
+    {
+        ret = 0;
+        if (!m_tuner.disco_active)
+        {
+            m_tuner.visit_active = false;
+            ret = TunerSweepStart();
+        }
+        goto exit;
+    }
+
+    m_tuner.pre_disco_volume = m_tuner.cur_volume;
+    m_tuner.pre_disco_freq = 0;
+    TunerGetTunedStationFreq(&m_tuner.pre_disco_freq);
+
+    // resume a paused sweep, or start one
+    //
+    if (!m_tuner.disco_active)
+    {
+        ret = TunerSweepStart();
+        require_noerr(ret, exit);
+    }
+    else
+    {
+        LOG_INF("Discovery resumed at %u", m_tuner.disco_freq);
+    }
+
+    m_tuner.state = TUNER_DISCOVERY;
+    ret = 0;
+
+exit:
+    return ret;
+}
+
+bool TunerDiscoveryPaused(void)
+{
+    return !m_tuner.scanner && m_tuner.disco_active && m_tuner.state != TUNER_DISCOVERY;
+}
+
+bool TunerHasScanner(void)
+{
+    return m_tuner.scanner != NULL;
+}
+
+bool TunerStationsStale(void)
+{
+    return !m_tuner.db_loaded || (m_tuner.boots - m_tuner.scanned) >= STATION_DB_MAX_AGE;
+}
+
+bool TunerHasFastScan(void)
+{
+    return m_tuner.radio && TunerSweepRadio()->scan;
+}
+
+int TunerGetStations(
+                        struct station_info *out_stations,
+                        uint32_t        in_max_stations,
+                        uint32_t        *out_num_stations
+                        )
+{
+    int ret = -EINVAL;
+
+    require(out_stations && out_num_stations, exit);
+
+    *out_num_stations = 0;
+
+    require_action_quiet(m_tuner.state >= TUNER_READY, exit, ret = -EAGAIN);
+
+    k_mutex_lock(&s_station_lock, K_FOREVER);
+    *out_num_stations = MIN(m_tuner.num_stations, in_max_stations);
+    memcpy(out_stations, m_tuner.stations, *out_num_stations * sizeof(*out_stations));
+    k_mutex_unlock(&s_station_lock);
+
+    ret = 0;
+exit:
+    return ret;
+}
+
+// an alternate is another frequency carrying the tuned programme, as far
+// as the RDS names tell
+//
+static bool TunerIsAlternate(uint32_t in_station)
+{
+    const struct station_info *info = &m_tuner.stations[in_station];
+    uint32_t tuned;
+
+    if (    m_tuner.state != TUNER_TUNED
+        ||  !info->name[0]
+        ||  info->freq_kHz == m_tuner.status.freq_kHz
+        ||  TunerFindStation(m_tuner.status.freq_kHz, &tuned))
+    {
+        return false;
+    }
+
+    return !strncmp(info->name, m_tuner.stations[tuned].name, sizeof(info->name));
+}
+
+// pick the next station to visit, alternates on the first pass round the
+// table and the rest on the second.  false once the round is done
+//
+static bool TunerVisitNext(void)
+{
+    uint32_t station;
+
+    while (m_tuner.visit_pass < 2)
+    {
+        while (m_tuner.visit_station < m_tuner.num_stations)
+        {
+            station = m_tuner.visit_station++;
+
+            if (TunerIsAlternate(station) == (m_tuner.visit_pass == 0))
+            {
+                m_tuner.visit_freq = m_tuner.stations[station].freq_kHz;
+                return true;
+            }
+        }
+
+        m_tuner.visit_pass++;
+        m_tuner.visit_station = 0;
+    }
+
+    return false;
+}
+
+// tune the scanner to the next station, or listen to the one it's on until
+// it has a whole name or has had VISIT_DWELL_MS.  the table is looked up
+// by frequency since a sweep can have moved it
+//
+static int TunerVisitStep(void)
+{
+    struct tuner_status status;
+    uint32_t station;
+    bool named;
+    int ret = 0;
+
+    if (!m_tuner.visit_freq)
+    {
+        if (!TunerVisitNext())
+        {
+            m_tuner.visit_active = false;
+            goto exit;
+        }
+
+        ret = m_tuner.scanner->set_tune(m_tuner.scanner, m_tuner.visit_freq);
+        require_noerr(ret, exit);
+
+        m_tuner.visit_until = k_uptime_get() + VISIT_DWELL_MS;
+        goto exit;
+    }
 
-    m_tuner.pre_disco_volume = m_tuner.cur_volume;
-    TunerGetTunedStationFreq(&m_tuner.pre_disco_freq);
+    ret = m_tuner.scanner->get_status(m_tuner.scanner, &status);
+    require_noerr(ret, exit);
 
-    if (m_tuner.state < TUNER_READY)
+    named = status.rds_short && strnlen(status.rds_short, 8) == 8;
+    if (!named && k_uptime_get() < m_tuner.visit_until)
     {
-        ret = -EAGAIN;
+        goto exit;
     }
-    else
+
+    k_mutex_lock(&s_station_lock, K_FOREVER);
+
+    if (!TunerFindStation(m_tuner.visit_freq, &station))
     {
-        m_tuner.disco_station = MAX_CHANNELS;
-        m_tuner.state = TUNER_DISCOVERY;
-        ret = 0;
+        m_tuner.stations[station].rssi = status.rssi ? status.rssi : 1;
+
+        if (named && memcmp(m_tuner.stations[station].name, status.rds_short, 8))
+        {
+            memcpy(m_tuner.stations[station].name, status.rds_short, 8);
+            m_tuner.stations[station].name[8] = '\0';
+            m_tuner.table_changed = true;
+
+            LOG_INF("Station %4.1f is %s", (float)m_tuner.visit_freq / 1000.0, m_tuner.stations[station].name);
+        }
     }
 
+    k_mutex_unlock(&s_station_lock);
+
+    m_tuner.visits++;
+    m_tuner.visit_freq = 0;
 exit:
+    if (ret)
+    {
+        // skip a station the scanner can't tune or read
+        //
+        m_tuner.visit_freq = 0;
+    }
     return ret;
 }
 
-int TunerGetStations(struct station_info **stations, uint32_t *num_stations)
+// with a second radio the band is swept over and over behind whatever the
+// first is playing, with a round of visits to the stations in between
+//
+static void TunerScannerSlice(uint32_t *delay)
 {
-    int ret = -ENOENT;
-    uint32_t nstations;
+    bool complete;
+    int ret;
 
-    if (stations)
+    if (m_tuner.disco_active)
     {
-        *stations = m_tuner.stations;
-    }
+        ret = TunerDiscoStep(&complete);
+        if (ret)
+        {
+            LOG_WRN("Sweep stopped %d", ret);
+            m_tuner.disco_active = false;
+            m_tuner.scanner_idle_until = k_uptime_get() + SCANNER_RETRY_MS;
+        }
+        else if (complete)
+        {
+            TunerSweepDone();
 
-    if (num_stations)
-    {
-        *num_stations = 0;
-    }
+            m_tuner.visit_active = true;
+            m_tuner.visit_pass = 0;
+            m_tuner.visit_station = 0;
+            m_tuner.visit_freq = 0;
 
-    if (m_tuner.state < TUNER_READY)
-    {
-        ret = -EAGAIN;
-        goto exit;
+            // let the main loop know there's a fresh table
+            //
+            m_tuner.status_changed = true;
+        }
     }
+    else if (m_tuner.visit_active)
+    {
+        TunerVisitStep();
 
-    for (nstations = 0; nstations < MAX_CHANNELS; nstations++)
+        if (!m_tuner.visit_active)
+        {
+            TunerScannerSave();
+        }
+    }
+    else if (k_uptime_get() >= m_tuner.scanner_idle_until)
     {
-        if (m_tuner.stations[nstations].rssi == 0)
+        ret = TunerSweepStart();
+        if (ret)
         {
-            break;
+            m_tuner.scanner_idle_until = k_uptime_get() + SCANNER_RETRY_MS;
         }
     }
 
-    if (num_stations)
+    if (*delay > SCANNER_SLICE_MS)
     {
-        *num_stations = nstations;
+        *delay = SCANNER_SLICE_MS;
     }
-
-    ret = 0;
-exit:
-    return ret;
 }
 
-int TunerSlice(uint32_t *delay, tuner_state_t *state)
+// the periodic work, run by the tuner thread between commands
+//
+static int TunerSlice(uint32_t *delay, tuner_state_t *state)
 {
     bool complete;
     int ret = -ENOENT;
@@ -400,15 +1543,27 @@ int TunerSlice(uint32_t *delay, tuner_state_t *state)
     switch (m_tuner.state)
     {
     case TUNER_INIT:
-        m_tuner.state = TUNER_DISCOVERY;
         break;
 
     case TUNER_DISCOVERY:
-        ret = TunerDiscoSlice(delay, &complete);
+        ret = TunerDiscoStep(&complete);
         if (ret || complete)
         {
+            if (complete)
+            {
+                TunerSweepDone();
+            }
+            else
+            {
+                LOG_WRN("Discovery stopped %d", ret);
+                m_tuner.disco_active = false;
+            }
+
             m_tuner.state = TUNER_READY;
-            TunerTuneTo(m_tuner.pre_disco_freq);
+            if (m_tuner.pre_disco_freq)
+            {
+                TunerTuneTo(m_tuner.pre_disco_freq);
+            }
             TunerSetVolume(m_tuner.pre_disco_volume);
             break;
         }
@@ -421,11 +1576,16 @@ int TunerSlice(uint32_t *delay, tuner_state_t *state)
         break;
 
     case TUNER_TUNED:
-        ret = TunerGetTunedStationRDS(&m_tuner.rds_name, &m_tuner.rds_text);
+        TunerPollStatus();
         *delay = 20;
         break;
     }
 
+    if (m_tuner.scanner && m_tuner.state >= TUNER_READY)
+    {
+        TunerScannerSlice(delay);
+    }
+
     ret = 0;
 
     if (state)
@@ -437,7 +1597,215 @@ exit:
     return ret;
 }
 
-int TunerInit(tuner_t *radio, const tuner_seek_threshold_t seek_threshold)
+static int TunerRunRequest(const struct tuner_request *in_req)
+{
+    int ret = -EINVAL;
+
+    switch (in_req->cmd)
+    {
+    case TUNER_CMD_TUNE:
+        ret = TunerTuneTo(in_req->arg);
+        break;
+
+    case TUNER_CMD_SEEK:
+        ret = TunerStep(true, in_req->arg != 0);
+        break;
+
+    case TUNER_CMD_STEP:
+        ret = TunerStep(false, in_req->arg != 0);
+        break;
+
+    case TUNER_CMD_VOLUME:
+        ret = TunerSetVolume(in_req->arg);
+        break;
+
+    case TUNER_CMD_SCAN:
+        if (in_req->arg)
+        {
+            // drop any paused sweep and start again from the bottom
+            //
+            m_tuner.disco_active = false;
+        }
+        ret = TunerDiscoverStations();
+        break;
+
+    case TUNER_CMD_RDS:
+        ret = TunerPollStatus();
+        break;
+
+    case TUNER_CMD_CALIBRATE:
+        ret = TunerCalibrate(in_req->arg != 0);
+        break;
+
+    default:
+        break;
+    }
+
+    return ret;
+}
+
+static void TunerRequestStats(const struct tuner_request *in_req, uint32_t in_started)
+{
+    struct tuner_cmd_stats *stats = &s_tuner_stats[in_req->cmd];
+    uint32_t now = k_cycle_get_32();
+    uint32_t wait_us = k_cyc_to_us_floor32(in_started - in_req->queued);
+    uint32_t done_us = k_cyc_to_us_floor32(now - in_req->queued);
+
+    stats->count++;
+    stats->last_us = done_us;
+    stats->total_us += done_us;
+    if (done_us > stats->max_us)
+    {
+        stats->max_us = done_us;
+    }
+    if (wait_us > stats->max_wait_us)
+    {
+        stats->max_wait_us = wait_us;
+    }
+}
+
+static void TunerNotify(void)
+{
+    m_tuner.status_changed = false;
+    TunerPublish();
+
+    if (m_tuner.notify)
+    {
+        m_tuner.notify(m_tuner.notify_ctx);
+    }
+}
+
+static void _TunerTaskMain(void *p1, void *p2, void *p3)
+{
+    struct tuner_request req;
+    tuner_state_t state;
+    int64_t next_slice = 0;
+    int64_t wait_ms;
+    uint32_t started;
+    uint32_t delay;
+    int ret;
+
+    k_sem_take(&s_tuner_start, K_FOREVER);
+
+    while (true)
+    {
+        if (k_uptime_get() >= next_slice)
+        {
+            state = m_tuner.state;
+            delay = 100;
+            TunerSlice(&delay, NULL);
+            next_slice = k_uptime_get() + delay;
+
+            if (state != m_tuner.state || m_tuner.status_changed)
+            {
+                TunerNotify();
+            }
+            else
+            {
+                TunerPublish();
+            }
+        }
+
+        wait_ms = next_slice - k_uptime_get();
+        if (wait_ms < 0)
+        {
+            wait_ms = 0;
+        }
+
+        if (k_sem_take(&s_tuner_pending, K_MSEC(wait_ms)))
+        {
+            continue;
+        }
+
+        if (    k_msgq_get(&s_tuner_urgent_queue, &req, K_NO_WAIT)
+            &&  k_msgq_get(&s_tuner_queue, &req, K_NO_WAIT))
+        {
+            continue;
+        }
+
+        started = k_cycle_get_32();
+        ret = TunerRunRequest(&req);
+        TunerRequestStats(&req, started);
+
+        if (ret)
+        {
+            LOG_WRN("tuner cmd %u (%u) failed %d", req.cmd, req.arg, ret);
+        }
+
+        if (req.done)
+        {
+            req.done(req.ctx, req.cmd, ret);
+        }
+
+        TunerNotify();
+    }
+}
+
+K_THREAD_DEFINE(s_tuner_thread_id, TUNER_STACKSIZE, _TunerTaskMain, NULL, NULL, NULL, TUNER_PRIORITY, 0, 0);
+
+int TunerRequest(
+                        tuner_cmd_t         in_cmd,
+                        uint32_t            in_arg,
+                        tuner_priority_t    in_priority,
+                        tuner_done_t        in_done,
+                        void               *in_ctx
+                        )
+{
+    struct tuner_request req;
+    int ret = -ENOENT;
+
+    require(m_tuner.radio, exit);
+    require_action(in_cmd < TUNER_CMD_COUNT, exit, ret = -EINVAL);
+
+    req.cmd = in_cmd;
+    req.arg = in_arg;
+    req.done = in_done;
+    req.ctx = in_ctx;
+    req.queued = k_cycle_get_32();
+
+    ret = k_msgq_put(in_priority == TUNER_PRIORITY_URGENT ? &s_tuner_urgent_queue : &s_tuner_queue,
+                     &req, K_NO_WAIT);
+    require_action(ret == 0, exit, ret = -EBUSY);
+
+    k_sem_give(&s_tuner_pending);
+exit:
+    return ret;
+}
+
+tuner_state_t TunerGetState(void)
+{
+    return m_tuner.state;
+}
+
+int TunerSetNotify(tuner_notify_t in_notify, void *in_ctx)
+{
+    m_tuner.notify_ctx = in_ctx;
+    m_tuner.notify = in_notify;
+    return 0;
+}
+
+bool TunerClaimReset(const void *in_port, uint32_t in_pin)
+{
+    int slot;
+
+    for (slot = 0; slot < TUNER_MAX_RESETS && s_resets[slot].port; slot++)
+    {
+        if (s_resets[slot].port == in_port && s_resets[slot].pin == in_pin)
+        {
+            return false;
+        }
+    }
+
+    if (slot < TUNER_MAX_RESETS)
+    {
+        s_resets[slot].port = in_port;
+        s_resets[slot].pin = in_pin;
+    }
+
+    return true;
+}
+
+int TunerInit(tuner_t *radio, tuner_t *scanner, const tuner_seek_threshold_t seek_threshold)
 {
     int ret = -EINVAL;
     uint32_t freq;
@@ -446,10 +1814,24 @@ int TunerInit(tuner_t *radio, const tuner_seek_threshold_t seek_threshold)
     require(radio, exit);
     m_tuner.state = TUNER_INIT;
     m_tuner.radio = radio;
+    m_tuner.cal_enabled = IS_ENABLED(CONFIG_TUNER_SEEK_CALIBRATE);
     ret = m_tuner.radio->init(m_tuner.radio, seek_threshold);
     require_noerr(ret, exit);
     m_tuner.state = TUNER_READY;
 
+    // count this boot and pick up the stations from last time so they're
+    // there before the disk is enumerated
+    //
+    ret = SettingsReadUint32("Boots", 0, &m_tuner.boots);
+    if (ret)
+    {
+        m_tuner.boots = 0;
+    }
+    m_tuner.boots++;
+    SettingsWriteUint32("Boots", 0, m_tuner.boots);
+
+    TunerLoadStations();
+
     ret = SettingsReadUint32("Freq", 0, &freq);
     if (!ret)
     {
@@ -465,6 +1847,33 @@ int TunerInit(tuner_t *radio, const tuner_seek_threshold_t seek_threshold)
     ret = TunerSetVolume(vol);
     require_noerr(ret, exit);
 
+    // a second radio only sweeps and is never heard, without one the
+    // first does both
+    //
+    if (scanner)
+    {
+        ret = scanner->init(scanner, seek_threshold);
+        if (!ret)
+        {
+            ret = scanner->set_volume(scanner, 0);
+        }
+
+        if (ret)
+        {
+            LOG_WRN("No second radio %d, discovery will interrupt listening", ret);
+            ret = 0;
+        }
+        else
+        {
+            LOG_INF("Second radio sweeps the band");
+            m_tuner.scanner = scanner;
+        }
+    }
+
+    // the radios are the tuner thread's from here on
+    //
+    TunerPublish();
+    k_sem_give(&s_tuner_start);
 exit:
     return ret;
 }
@@ -488,7 +1897,7 @@ static int _CommandSetVol(const struct shell *s, size_t argc, char **argv)
         vol = 100;
     }
 
-    TunerSetVolume(vol);
+    TunerRequest(TUNER_CMD_VOLUME, vol, TUNER_PRIORITY_URGENT, NULL, NULL);
     return 0;
 }
 
@@ -501,107 +1910,127 @@ static int _CommandSetFreq(const struct shell *s, size_t argc, char **argv)
         freq = strtoul(argv[1], NULL, 0);
     }
 
-    TunerTuneTo(freq);
+    TunerRequest(TUNER_CMD_TUNE, freq, TUNER_PRIORITY_URGENT, NULL, NULL);
     return 0;
 }
 
 static int _CommandSetStation(const struct shell *s, size_t argc, char **argv)
 {
     uint32_t station = 0;
+    uint32_t count;
+    uint32_t freq_kHz = 0;
 
     if (argc > 1)
     {
         station = strtoul(argv[1], NULL, 0);
     }
 
-    if (station >= MAX_CHANNELS)
+    k_mutex_lock(&s_station_lock, K_FOREVER);
+    count = m_tuner.num_stations;
+    if (station < count)
     {
-        shell_print(s, "station should be < %u", MAX_CHANNELS);
-        return 0;
+        freq_kHz = m_tuner.stations[station].freq_kHz;
     }
+    k_mutex_unlock(&s_station_lock);
 
-    if (m_tuner.stations[station].rssi == 0)
+    if (station >= count)
     {
-        shell_print(s, "station %u wasn't discovered", station);
+        shell_print(s, "station should be < %u", count);
         return 0;
     }
 
-    if (m_tuner.radio)
-    {
-        m_tuner.radio->set_tune(m_tuner.radio, m_tuner.stations[station].freq_kHz);
-    }
+    TunerRequest(TUNER_CMD_TUNE, freq_kHz, TUNER_PRIORITY_URGENT, NULL, NULL);
     return 0;
 }
 
 static int _CommandSeekUp(const struct shell *s, size_t argc, char **argv)
 {
-    if (m_tuner.radio)
-    {
-        m_tuner.radio->seek(m_tuner.radio, true, true);
-    }
-
+    TunerRequest(TUNER_CMD_SEEK, true, TUNER_PRIORITY_URGENT, NULL, NULL);
     return 0;
 }
 
 static int _CommandSeekDown(const struct shell *s, size_t argc, char **argv)
 {
-    if (m_tuner.radio)
-    {
-        m_tuner.radio->seek(m_tuner.radio, false, true);
-    }
-
+    TunerRequest(TUNER_CMD_SEEK, false, TUNER_PRIORITY_URGENT, NULL, NULL);
     return 0;
 }
 
 static int _CommandTuneUp(const struct shell *s, size_t argc, char **argv)
 {
-    if (m_tuner.radio)
-    {
-        m_tuner.radio->tune(m_tuner.radio, true, true);
-    }
-
+    TunerRequest(TUNER_CMD_STEP, true, TUNER_PRIORITY_URGENT, NULL, NULL);
     return 0;
 }
 
 static int _CommandTuneDown(const struct shell *s, size_t argc, char **argv)
 {
-    if (m_tuner.radio)
-    {
-        m_tuner.radio->tune(m_tuner.radio, false, true);
-    }
-
+    TunerRequest(TUNER_CMD_STEP, false, TUNER_PRIORITY_URGENT, NULL, NULL);
     return 0;
 }
 
 static int _CommandPrint(const struct shell *s, size_t argc, char **argv)
 {
-    shell_print(s, "Station List:");
+    struct station_info info;
+    uint32_t count;
 
-    for (int station = 0; station < MAX_CHANNELS; station++)
+    shell_print(s, "Station List: %u of %u", m_tuner.num_stations, MAX_STATIONS);
+
+    // an entry at a time, so the tuner thread isn't held up by the shell
+    //
+    for (int station = 0; ; station++)
     {
-        if (m_tuner.stations[station].rssi == 0)
+        k_mutex_lock(&s_station_lock, K_FOREVER);
+        count = m_tuner.num_stations;
+        if (station < count)
+        {
+            info = m_tuner.stations[station];
+        }
+        k_mutex_unlock(&s_station_lock);
+
+        if (station >= count)
         {
             break;
         }
 
-        shell_print(s, "%2d %4.1f  rssi:%u  S:%8s T:%s",
+        shell_print(s, "%2d %4.1f  rssi:%u  S:%8s",
                 station,
-                (float)(m_tuner.stations[station].freq_kHz) / 1000.0,
-                m_tuner.stations[station].rssi,
-                m_tuner.stations[station].name,
-                m_tuner.stations[station].text);
+                (float)info.freq_kHz / 1000.0,
+                info.rssi,
+                info.name);
     }
 
-    uint32_t freq_kHz;
-    uint8_t rssi;
-    bool stereo;
-    int ret;
+    if (m_tuner.state == TUNER_TUNED)
+    {
+        shell_print(s, "Current tune: %5.1f  rssi: %u %s",
+                (float)m_tuner.status.freq_kHz / 1000.0, m_tuner.status.rssi, m_tuner.status.stereo ? "st" : "mono");
+    }
+    else if (m_tuner.state == TUNER_DISCOVERY)
+    {
+        shell_print(s, "Discovering at %5.1f, found %u", (float)m_tuner.disco_freq / 1000.0, m_tuner.disco_found);
+    }
 
-    ret = m_tuner.radio->get_tune(m_tuner.radio, &freq_kHz);
-    ret = m_tuner.radio->get_rssi(m_tuner.radio, &rssi, &stereo, NULL);
+    if (m_tuner.scanner)
+    {
+        if (m_tuner.disco_active)
+        {
+            shell_print(s, "Scanner sweeping at %5.1f, found %u", (float)m_tuner.disco_freq / 1000.0, m_tuner.disco_found);
+        }
+        else if (m_tuner.visit_active)
+        {
+            shell_print(s, "Scanner visiting %5.1f, %s", (float)m_tuner.visit_freq / 1000.0,
+                    m_tuner.visit_pass ? "stations" : "alternates");
+        }
+        shell_print(s, "Scanner sweeps %u, visits %u", m_tuner.sweep, m_tuner.visits);
+    }
 
-    shell_print(s, "Current tune: %5.1f  rssi: %u %s",
-            (float)freq_kHz / 1000.0, rssi, stereo ? "st" : "mono");
+    if (m_tuner.db_loaded)
+    {
+        shell_print(s, "Stations saved, scanned %u boots ago%s",
+                m_tuner.boots - m_tuner.scanned, TunerStationsStale() ? " (stale)" : "");
+    }
+    if (TunerDiscoveryPaused())
+    {
+        shell_print(s, "Discovery paused at %5.1f", (float)m_tuner.disco_freq / 1000.0);
+    }
 
     return 0;
 }
@@ -640,49 +2069,91 @@ static int _CommandPoll(const struct shell *s, size_t argc, char **argv)
 
 static int _CommandDisco(const struct shell *s, size_t argc, char **argv)
 {
-    int timeout = 30;
-    bool complete = false;
-    uint32_t delay;
-    tuner_state_t state;
+    TunerRequest(TUNER_CMD_SCAN, false, TUNER_PRIORITY_NORMAL, NULL, NULL);
+    return 0;
+}
+
+static int _CommandScan(const struct shell *s, size_t argc, char **argv)
+{
+    TunerRequest(TUNER_CMD_SCAN, true, TUNER_PRIORITY_NORMAL, NULL, NULL);
+    return 0;
+}
+
+static int _CommandCal(const struct shell *s, size_t argc, char **argv)
+{
+    static const char *names[2] = { "fixed", "calibrated" };
+    struct tuner_sweep_result *result;
 
     if (argc > 1)
     {
-        timeout = strtol(argv[1], NULL, 0);
+        TunerRequest(TUNER_CMD_CALIBRATE, !strcmp(argv[1], "on"), TUNER_PRIORITY_NORMAL, NULL, NULL);
+        return 0;
     }
 
-    timeout *= 1000;
+    shell_print(s, "seek: %s, noise floor rssi %u snr %u, threshold rssi %u snr %u",
+            m_tuner.cal_done ? "calibrated" : (m_tuner.cal_enabled ? "not calibrated yet" : "fixed"),
+            m_tuner.noise_rssi, m_tuner.noise_snr, m_tuner.seek_threshold, m_tuner.seek_snr);
 
-    // setup for discovery
-    m_tuner.disco_station = MAX_CHANNELS;
-    m_tuner.state = TUNER_DISCOVERY;
-    TunerSlice(&delay, &state);
+    for (int i = 0; i < 2; i++)
+    {
+        result = &m_tuner.sweeps[i];
+        if (!result->ms)
+        {
+            continue;
+        }
+
+        shell_print(s, "last %-10s sweep: %u found, %u kept, %u ms + %u ms survey, rssi %u snr %u",
+                names[i], result->found, result->stations, result->ms, result->cal_ms,
+                result->rssi, result->snr);
+    }
+    return 0;
+}
+
+static int _CommandStats(const struct shell *s, size_t argc, char **argv)
+{
+    static const char *names[TUNER_CMD_COUNT] = { "tune", "seek", "step", "vol", "scan", "rds", "cal" };
+    struct tuner_cmd_stats *stats;
 
-    // drive to completion
-    do
+    if (argc > 1 && !strcmp(argv[1], "clear"))
     {
-        delay = 20;
-        TunerDiscoSlice(&delay, &complete);
-        k_msleep(delay);
+        memset(s_tuner_stats, 0, sizeof(s_tuner_stats));
+        m_tuner.status_polls = 0;
+        m_tuner.status_max_us = 0;
+        m_tuner.status_total_us = 0;
+        s_snapshot_retries = 0;
+        return 0;
     }
-    while(!complete && timeout-- > 0);
-    m_tuner.state = TUNER_READY;
 
-    LOG_INF("Stations:");
-    for (uint16_t curchan = 0; curchan < MAX_CHANNELS; curchan++)
+    shell_print(s, "cmd    count   last ms  avg ms  max ms  max wait ms");
+
+    for (int cmd = 0; cmd < TUNER_CMD_COUNT; cmd++)
     {
-        if (m_tuner.stations[curchan].rssi == 0)
+        stats = &s_tuner_stats[cmd];
+        if (stats->count == 0)
         {
-            break;
+            continue;
         }
 
-        LOG_INF("%d %4.1f  rssi:%u  S:%8s T:%s",
-                curchan,
-                (float)m_tuner.stations[curchan].freq_kHz / 1000.0,
-                m_tuner.stations[curchan].rssi,
-                m_tuner.stations[curchan].name,
-                m_tuner.stations[curchan].text);
+        shell_print(s, "%-5s %6u  %7.1f %7.1f %7.1f  %7.1f",
+                names[cmd], stats->count,
+                (float)stats->last_us / 1000.0,
+                (float)(stats->total_us / stats->count) / 1000.0,
+                (float)stats->max_us / 1000.0,
+                (float)stats->max_wait_us / 1000.0);
     }
 
+    if (m_tuner.status_polls)
+    {
+        shell_print(s, "status: %u reads, avg %u us max %u us",
+                m_tuner.status_polls, (uint32_t)(m_tuner.status_total_us / m_tuner.status_polls),
+                m_tuner.status_max_us);
+    }
+
+    shell_print(s, "snapshot: version %u, %u reader retries",
+            s_snapshot.version, s_snapshot_retries);
+
+    shell_print(s, "queued: %u urgent, %u normal",
+            k_msgq_num_used_get(&s_tuner_urgent_queue), k_msgq_num_used_get(&s_tuner_queue));
     return 0;
 }
 
@@ -696,7 +2167,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(_sub_tuner_commands,
        SHELL_CMD(tuned,         NULL,  "Tune Down", _CommandTuneDown),
        SHELL_CMD(print,         NULL,  "Print out info", _CommandPrint),
        SHELL_CMD_ARG(poll,      NULL,  "Poll staton rds [seconds (30)]", _CommandPoll, 1, 2),
-       SHELL_CMD_ARG(disco,     NULL,  "Discover Stations [seconds (30)]", _CommandDisco, 1, 2),
+       SHELL_CMD(disco,         NULL,  "Discover or resume discovering stations", _CommandDisco),
+       SHELL_CMD(scan,          NULL,  "Rescan the band from the bottom", _CommandScan),
+       SHELL_CMD_ARG(cal,       NULL,  "Seek calibration and sweep results, [on|off] to rescan with it", _CommandCal, 1, 2),
+       SHELL_CMD_ARG(stats,     NULL,  "Request latency, to STC for tunes [clear]", _CommandStats, 1, 2),
        SHELL_SUBCMD_SET_END );
 
 SHELL_CMD_REGISTER(tuner, &_sub_tuner_commands, "Tuner commands", NULL);
@@ -32,15 +32,54 @@ typedef enum
 }
 tuner_band_t;
 
+// one entry in the station table, radio text isn't kept per station since
+// it only means anything for the station that's tuned
+//
 struct station_info
 {
     uint32_t    freq_kHz;
-    uint8_t     channel;
+    uint16_t    channel;
     uint8_t     rssi;
     char        name[9];
-    char        text[65];
 };
 
+// the tuned station as a display shows it.  snr is 0 from radios that
+// don't measure it and the RDS strings stay the radio's, they are only
+// valid until the next call
+//
+struct tuner_status
+{
+    uint32_t    freq_kHz;
+    uint8_t     rssi;
+    uint8_t     snr;
+    bool        stereo;
+    bool        afc_railed;
+    bool        rds_ready;
+    bool        rds_changed;
+    const char  *rds_short;
+    const char  *rds_long;
+};
+
+// what the tuner thread last published, readers get a copy of their own
+// so nothing changes under them.  the station fields are only set when
+// state is TUNER_TUNED, and version moves on whenever anything changes
+//
+struct tuner_snapshot
+{
+    uint32_t        version;
+    tuner_state_t   state;
+    uint32_t        freq_kHz;
+    uint8_t         rssi;
+    uint8_t         snr;
+    bool            stereo;
+    char            rds_short[9];
+    char            rds_long[65];
+};
+
+// called for each station a scan finds, return non-zero to stop the scan
+//
+typedef int (*tuner_scan_cb_t)(void *in_ctx, uint32_t in_freq_kHz, uint8_t in_rssi);
+
 typedef struct _tuner
 {
     int (*init)(struct _tuner *in_tuner, tuner_seek_threshold_t in_threshold);
@@ -69,18 +108,93 @@ typedef struct _tuner
                         const char  **out_rds_short,
                         const char  **out_rds_long
                     );
+    // everything in tuner_status in as few bus transactions as the radio
+    // allows, for polling the tuned station
+    //
+    int (*get_status)(
+                        struct _tuner *in_tuner,
+                        struct tuner_status *out_status
+                    );
     int (*tune)(struct _tuner *in_tuner, bool in_up, bool in_wrap);
     int (*seek)(struct _tuner *in_tuner, bool in_up, bool in_wrap);
 
+    // optional, the RSSI and SNR (in dB) a seek has to see to stop on a
+    // channel.  0 puts back the one chosen at init
+    //
+    int (*set_seek_threshold)(struct _tuner *in_tuner, uint8_t in_rssi, uint8_t in_snr);
+
+    // optional, sweep the band up from in_from_kHz reporting every station
+    // found, for about in_budget_ms (0 for no limit).  out_next_kHz is
+    // where to carry on from, or 0 once the top of the band is reached.
+    // without it discovery steps one seek per slice
+    //
+    int (*scan)(
+                        struct _tuner *in_tuner,
+                        uint32_t    in_from_kHz,
+                        uint32_t    in_budget_ms,
+                        tuner_scan_cb_t in_found,
+                        void        *in_ctx,
+                        uint32_t    *out_next_kHz
+                    );
+
     void *priv;
 }
 tuner_t;
 
-int TunerRequestTuneTo(uint32_t freq_kHz);
+// commands for the tuner thread, which owns the radio once TunerInit
+// has succeeded
+//
+typedef enum
+{
+    TUNER_CMD_TUNE,         // arg is the frequency in kHz
+    TUNER_CMD_SEEK,         // arg is non-zero to seek up
+    TUNER_CMD_STEP,         // one channel, arg is non-zero for up
+    TUNER_CMD_VOLUME,       // arg is the volume in percent
+    TUNER_CMD_SCAN,         // discover or resume, arg non-zero to restart
+    TUNER_CMD_RDS,          // read the signal and RDS now
+    TUNER_CMD_CALIBRATE,    // arg non-zero to recalibrate seeks, 0 for fixed, then rescan
+    TUNER_CMD_COUNT
+}
+tuner_cmd_t;
+
+typedef enum
+{
+    TUNER_PRIORITY_URGENT,
+    TUNER_PRIORITY_NORMAL
+}
+tuner_priority_t;
+
+// called on the tuner thread when a request is done, keep it short
+//
+typedef void (*tuner_done_t)(void *in_ctx, tuner_cmd_t in_cmd, int in_result);
+
+int TunerRequest(
+                        tuner_cmd_t         in_cmd,
+                        uint32_t            in_arg,
+                        tuner_priority_t    in_priority,
+                        tuner_done_t        in_done,
+                        void               *in_ctx
+                        );
+tuner_state_t TunerGetState(void);
 
+// called on the tuner thread after a request, and when the state, the
+// tuned station or its RDS changes.  the new snapshot is already published
+//
+typedef void (*tuner_notify_t)(void *in_ctx);
+
+int TunerSetNotify(tuner_notify_t in_notify, void *in_ctx);
+
+// these drive the radio directly so only the tuner thread (or TunerInit)
+// calls them, anywhere else use TunerRequest
+//
 int TunerSetVolume(uint32_t in_volume_percent);
 int TunerTuneTo(uint32_t in_freq_kHz);
 int TunerDiscoverStations(void);
+
+bool TunerHasFastScan(void);
+bool TunerHasScanner(void);
+bool TunerStationsStale(void);
+bool TunerDiscoveryPaused(void);
 int TunerGetTunedStationFreq(
                         uint32_t        *out_freq_kHz
                         );
@@ -88,11 +202,30 @@ int TunerGetTunedStationRSSI(
                         uint8_t         *out_rssi,
                         bool            *out_stereo
                         );
-int TunerGetTunedStationRDS(
-                        const char      **out_rds_short,
-                        const char      **out_rds_long
+
+// any thread, copies the last published snapshot without going near
+// the radio
+//
+int TunerGetSnapshot(
+                        struct tuner_snapshot *out_snapshot
+                        );
+
+// any thread, copies up to in_max_stations of the station table in
+// frequency order.  -EAGAIN until the radio is up
+//
+int TunerGetStations(
+                        struct station_info *out_stations,
+                        uint32_t        in_max_stations,
+                        uint32_t        *out_num_stations
                         );
-int TunerGetStations(struct station_info **out_stations, uint32_t *out_num_stations);
-int TunerSlice(uint32_t *out_delay, tuner_state_t *out_state);
-int TunerInit(tuner_t *in_radio, const tuner_seek_threshold_t in_seek_threshold);
+
+// in_scanner is an optional second radio, it sweeps the band and visits
+// the stations found while in_radio plays
+//
+int TunerInit(tuner_t *in_radio, tuner_t *in_scanner, const tuner_seek_threshold_t in_seek_threshold);
+
+// for a radio driver's init, true if it should pulse its reset line,
+// false if another radio sharing the line already has
+//
+bool TunerClaimReset(const void *in_port, uint32_t in_pin);
 
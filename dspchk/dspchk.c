@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "audiodsp.h"
+
+// the spectrum analyzer's setup, see components/audioin/spectrum.c
+//
+#define BENCH_SAMPLE_RATE	(44100 / 4)
+#define BENCH_WINDOW		(256)
+#define BENCH_BANDS		(7)
+
+// Run the audiodsp unit test on the host: metering, agc, goertzel,
+// resampling and adpcm.  audiodsp.c is built with UNIT_TEST, and every
+// require that trips inside it is reported and counted here
+//
+// With -b it times the goertzel kernel on a spectrum analyzer window
+// instead, next to a plain float radix-2 FFT of the same window, so the
+// kernel's cost can be checked without the target's "spectrum bench"
+//
+static int s_asserts;
+
+static const uint16_t s_band_freqs[BENCH_BANDS] =
+{
+	60, 150, 300, 600, 1200, 2400, 4000
+};
+
+void assert_err(const char *file, const int line)
+{
+	fprintf(stderr, "assert %s:%d\n", file, line);
+	s_asserts++;
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+// in place iterative radix-2 FFT, the reference for what the bank replaces
+//
+static void fft(float *re, float *im, int n)
+{
+	int i, j, k, len;
+
+	for (i = 1, j = 0; i < n; i++)
+	{
+		int bit = n >> 1;
+
+		for (; j & bit; bit >>= 1)
+		{
+			j ^= bit;
+		}
+		j ^= bit;
+
+		if (i < j)
+		{
+			float t;
+
+			t = re[i]; re[i] = re[j]; re[j] = t;
+			t = im[i]; im[i] = im[j]; im[j] = t;
+		}
+	}
+
+	for (len = 2; len <= n; len <<= 1)
+	{
+		float ang = -2 * M_PI / len;
+		float wr = cosf(ang);
+		float wi = sinf(ang);
+
+		for (i = 0; i < n; i += len)
+		{
+			float cr = 1;
+			float ci = 0;
+
+			for (k = 0; k < len / 2; k++)
+			{
+				float ur = re[i + k];
+				float ui = im[i + k];
+				float vr = re[i + k + len / 2] * cr - im[i + k + len / 2] * ci;
+				float vi = re[i + k + len / 2] * ci + im[i + k + len / 2] * cr;
+				float t;
+
+				re[i + k] = ur + vr;
+				im[i + k] = ui + vi;
+				re[i + k + len / 2] = ur - vr;
+				im[i + k + len / 2] = ui - vi;
+
+				t = cr * wr - ci * wi;
+				ci = cr * wi + ci * wr;
+				cr = t;
+			}
+		}
+	}
+}
+
+static int bench(uint32_t runs)
+{
+	static int16_t window[BENCH_WINDOW];
+	static float re[BENCH_WINDOW];
+	static float im[BENCH_WINDOW];
+	struct dsp_goertzel bank;
+	uint32_t levels[BENCH_BANDS];
+	volatile float sink = 0;
+	uint64_t start;
+	uint64_t goertzel_ns;
+	uint64_t fft_ns;
+	uint32_t run;
+	int sample;
+	int ret;
+
+	ret = AudioDspGoertzelInit(&bank, s_band_freqs, BENCH_BANDS, BENCH_SAMPLE_RATE);
+	if (ret)
+	{
+		fprintf(stderr, "Can't set up the bank %d\n", ret);
+		return 1;
+	}
+
+	// the same window as the target's "spectrum bench"
+	//
+	for (sample = 0; sample < BENCH_WINDOW; sample++)
+	{
+		window[sample] = (int16_t)((sample * 7919) & 0x7FFF) - 16384;
+	}
+
+	start = now_ns();
+	for (run = 0; run < runs; run++)
+	{
+		AudioDspGoertzel(&bank, window, BENCH_WINDOW, levels);
+		sink += levels[run % BENCH_BANDS];
+	}
+	goertzel_ns = (now_ns() - start) / runs;
+
+	start = now_ns();
+	for (run = 0; run < runs; run++)
+	{
+		for (sample = 0; sample < BENCH_WINDOW; sample++)
+		{
+			re[sample] = window[sample];
+			im[sample] = 0;
+		}
+		fft(re, im, BENCH_WINDOW);
+		sink += re[run % BENCH_WINDOW];
+	}
+	fft_ns = (now_ns() - start) / runs;
+
+	printf("goertzel %u bands x %u samples: %lu ns per window, %.2f ns per sample-band\n",
+			BENCH_BANDS, BENCH_WINDOW, (unsigned long)goertzel_ns,
+			(double)goertzel_ns / (BENCH_BANDS * BENCH_WINDOW));
+	printf("float fft %u points: %lu ns per window, %.1fx the bank\n",
+			BENCH_WINDOW, (unsigned long)fft_ns, goertzel_ns ? (double)fft_ns / goertzel_ns : 0.0);
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	int ret;
+
+	if (argc > 1 && !strcmp(argv[1], "-b"))
+	{
+		return bench(argc > 2 ? strtoul(argv[2], NULL, 0) : 100000);
+	}
+
+	if (argc > 1)
+	{
+		fprintf(stderr, "Usage %s [-b [runs]]\n"
+				"  -b  time the goertzel kernel against an fft (default 100000 runs)\n",
+				argv[0]);
+		return -1;
+	}
+
+	ret = AudioDspUnitTest();
+	if (ret || s_asserts)
+	{
+		printf("audiodsp unit test failed %d, %d asserts\n", ret, s_asserts);
+		return 1;
+	}
+
+	printf("audiodsp unit test ok\n");
+	return 0;
+}
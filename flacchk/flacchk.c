@@ -0,0 +1,337 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "flac.h"
+
+#define SECTOR_SIZE		512
+#define SAMPLE_RATE		44100
+#define MAX_GROUP_FRAMES	(FLAC_MAX_BLOCK_FRAMES + 64 * SECTOR_SIZE / 4)
+
+// Run the radio's sector aligned FLAC encoder on the host over a test
+// pattern or a raw capture, and write both the stream and the pcm a
+// decoder should get back from it.  "make test" then checks the stream
+// with the reference decoder
+//
+// The pcm written accounts for blocks the encoder had to make lossy, so a
+// decode always has to match it exactly
+//
+enum pattern
+{
+	PAT_MUSIC,
+	PAT_SINE,
+	PAT_NOISE,
+	PAT_SILENCE,
+	PAT_MIXED,
+	PAT_FILE,
+};
+
+static const char *s_pattern_names[] =
+{
+	"music", "sine", "noise", "silence", "mixed",
+};
+
+static enum pattern s_pattern;
+static FILE *s_in;
+static uint64_t s_frame;
+static uint32_t s_seed = 12345;
+
+// everything read for the group being encoded, the first read is the
+// compressed block and the rest are fillers
+//
+static uint32_t s_group[MAX_GROUP_FRAMES];
+static uint32_t s_group_frames;
+static uint32_t s_block_frames;
+static int s_reads;
+
+void assert_err(const char *file, const int line)
+{
+	fprintf(stderr, "assert %s:%d\n", file, line);
+}
+
+static int16_t noise(void)
+{
+	s_seed = s_seed * 1103515245 + 12345;
+	return (int16_t)(s_seed >> 16);
+}
+
+static uint32_t pack(int left, int right)
+{
+	if (left > 32767) left = 32767;
+	if (left < -32768) left = -32768;
+	if (right > 32767) right = 32767;
+	if (right < -32768) right = -32768;
+
+	return ((uint32_t)(uint16_t)right << 16) | (uint16_t)left;
+}
+
+static uint32_t generate(enum pattern pattern)
+{
+	double t = (double)s_frame / SAMPLE_RATE;
+	double env;
+	int left;
+	int right;
+
+	switch (pattern)
+	{
+	case PAT_SINE:
+		left = (int)(12000 * sin(2 * M_PI * 440 * t));
+		right = (int)(12000 * sin(2 * M_PI * 660 * t));
+		break;
+
+	case PAT_NOISE:
+		left = noise();
+		right = noise();
+		break;
+
+	case PAT_SILENCE:
+		left = right = 0;
+		break;
+
+	case PAT_MIXED:
+		// a second each of music, silence and noise
+		switch ((s_frame / SAMPLE_RATE) % 3)
+		{
+		case 0:
+			return generate(PAT_MUSIC);
+		case 1:
+			return generate(PAT_SILENCE);
+		default:
+			return generate(PAT_NOISE);
+		}
+
+	case PAT_MUSIC:
+	default:
+		// a few harmonics under a beating envelope, mostly correlated
+		// channels and a little hiss like off-air audio
+		env = 0.6 + 0.4 * sin(2 * M_PI * 1.5 * t);
+		left = (int)(env * (7000 * sin(2 * M_PI * 220 * t) + 3000 * sin(2 * M_PI * 660 * t)
+				+ 1500 * sin(2 * M_PI * 1870 * t))) + noise() / 512;
+		right = (int)(env * (6000 * sin(2 * M_PI * 220 * t + 0.3) + 3500 * sin(2 * M_PI * 660 * t)
+				+ 900 * sin(2 * M_PI * 3100 * t))) + noise() / 512;
+		break;
+	}
+
+	return pack(left, right);
+}
+
+static int read_frames(uint32_t *out_frames, uint32_t count, void *ctx)
+{
+	uint8_t bytes[4];
+
+	if (s_group_frames + count > MAX_GROUP_FRAMES)
+	{
+		return -1;
+	}
+
+	for (uint32_t frame = 0; frame < count; frame++)
+	{
+		if (s_pattern == PAT_FILE)
+		{
+			if (fread(bytes, 1, 4, s_in) != 4)
+			{
+				// loop the capture
+				fseek(s_in, 0, SEEK_SET);
+				if (fread(bytes, 1, 4, s_in) != 4)
+				{
+					return -1;
+				}
+			}
+			out_frames[frame] = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+		}
+		else
+		{
+			out_frames[frame] = generate(s_pattern);
+		}
+		s_frame++;
+	}
+
+	memcpy(s_group + s_group_frames, out_frames, count * 4);
+	s_group_frames += count;
+
+	if (s_reads++ == 0)
+	{
+		s_block_frames = count;
+	}
+	return 0;
+}
+
+// drop low bits from the block as the encoder did
+//
+static void write_pcm(FILE *out, uint32_t shift)
+{
+	uint16_t mask = (uint16_t)(0xFFFF << shift);
+
+	for (uint32_t frame = 0; frame < s_group_frames; frame++)
+	{
+		uint32_t value = s_group[frame];
+		uint8_t bytes[4];
+
+		if (frame < s_block_frames)
+		{
+			value &= ((uint32_t)mask << 16) | mask;
+		}
+
+		bytes[0] = value;
+		bytes[1] = value >> 8;
+		bytes[2] = value >> 16;
+		bytes[3] = value >> 24;
+		fwrite(bytes, 1, 4, out);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	static struct flac_encoder enc;
+	static uint8_t group[64 * SECTOR_SIZE];
+	uint8_t header[FLAC_HEADER_SIZE];
+	FILE *flac_out;
+	FILE *pcm_out;
+	char *progname;
+	char *flac_name = NULL;
+	char *pcm_name = NULL;
+	uint32_t sectors = 8;
+	uint32_t groups = 100;
+	uint32_t shifts = 0;
+	uint64_t fill_bytes = 0;
+	int ret;
+
+	progname = *argv++;
+	argc--;
+
+	while (argc > 0)
+	{
+		if (!strcmp(*argv, "-g") && argc > 1)
+		{
+			argv++;
+			argc--;
+			sectors = strtoul(*argv, NULL, 0);
+		}
+		else if (!strcmp(*argv, "-n") && argc > 1)
+		{
+			argv++;
+			argc--;
+			groups = strtoul(*argv, NULL, 0);
+		}
+		else if (!strcmp(*argv, "-p") && argc > 1)
+		{
+			argv++;
+			argc--;
+			for (s_pattern = PAT_MUSIC; s_pattern < PAT_FILE; s_pattern++)
+			{
+				if (!strcmp(*argv, s_pattern_names[s_pattern]))
+				{
+					break;
+				}
+			}
+		}
+		else if (!strcmp(*argv, "-i") && argc > 1)
+		{
+			argv++;
+			argc--;
+			s_pattern = PAT_FILE;
+			s_in = fopen(*argv, "rb");
+			if (!s_in)
+			{
+				fprintf(stderr, "Can't open %s\n", *argv);
+				return -1;
+			}
+		}
+		else if (**argv == '-')
+		{
+			break;
+		}
+		else if (!flac_name)
+		{
+			flac_name = *argv;
+		}
+		else
+		{
+			pcm_name = *argv;
+		}
+		argv++;
+		argc--;
+	}
+
+	if (!flac_name || !pcm_name || argc > 0 || sectors < 2 || sectors > 64)
+	{
+		fprintf(stderr, "Usage %s [-g <sectors>] [-n <groups>] [-p <pattern> | -i <raw pcm>] <out.flac> <out.raw>\n"
+				"  -g  sectors per group, 2..64 (default 8)\n"
+				"  -n  groups to encode (default 100)\n"
+				"  -p  music, sine, noise, silence or mixed (default music)\n"
+				"  -i  16 bit stereo little-endian pcm to encode instead, looped\n",
+				progname);
+		return -1;
+	}
+
+	flac_out = fopen(flac_name, "wb");
+	pcm_out = fopen(pcm_name, "wb");
+	if (!flac_out || !pcm_out)
+	{
+		fprintf(stderr, "Can't create output files\n");
+		return -1;
+	}
+
+	ret = FlacEncoderInit(&enc, SAMPLE_RATE, sectors * SECTOR_SIZE, read_frames, NULL);
+	if (!ret)
+	{
+		ret = FlacEncodeHeader(&enc, header);
+	}
+	if (ret)
+	{
+		fprintf(stderr, "Can't start encoder %d\n", ret);
+		return -1;
+	}
+
+	fwrite(header, 1, FLAC_HEADER_SIZE, flac_out);
+
+	for (uint32_t count = 0; count < groups; count++)
+	{
+		uint64_t fill_before = enc.fill_in_frames;
+
+		s_group_frames = 0;
+		s_reads = 0;
+
+		memset(group, 0xA5, sizeof(group));
+
+		ret = FlacEncodeGroup(&enc, group);
+		if (ret)
+		{
+			fprintf(stderr, "Group %u failed %d\n", count, ret);
+			return -1;
+		}
+
+		// every group has to start with a frame and be filled right to
+		// the end, so it can be served as whole sectors
+		//
+		if (group[0] != 0xFF || group[1] != 0xF9)
+		{
+			fprintf(stderr, "Group %u doesn't start on a frame\n", count);
+			return -1;
+		}
+
+		if (enc.shift)
+		{
+			shifts += enc.shift;
+		}
+		fill_bytes += (enc.fill_in_frames - fill_before) * 4;
+
+		fwrite(group, 1, sectors * SECTOR_SIZE, flac_out);
+		write_pcm(pcm_out, enc.shift);
+	}
+
+	fclose(flac_out);
+	fclose(pcm_out);
+
+	printf("%u groups of %u sectors, %llu frames in %llu bytes, %.1f%% of pcm\n",
+			groups, sectors, (unsigned long long)enc.in_frames, (unsigned long long)enc.out_bytes,
+			100.0 * enc.out_bytes / (enc.in_frames * 4));
+	printf("  blocks %u  lossy %u (%u bits dropped)  fillers %u carrying %.1f%%  next block %u frames\n",
+			enc.blocks, enc.lossy_blocks, shifts, enc.fill_frames,
+			100.0 * fill_bytes / enc.out_bytes, enc.block_frames);
+
+	return 0;
+}
@@ -1,5 +1,6 @@
 
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 #include "autoconf.h"
 #include <zephyr/logging/log.h>
@@ -14,22 +15,153 @@ LOG_MODULE_REGISTER(main, LOG_LEVEL_INF);
 #endif
 #include "settings.h"
 #include "audioin.h"
+#if CONFIG_AUDIO_SPECTRUM
+#include "spectrum.h"
+#endif
+#if CONFIG_AUDIO_TIMESHIFT
+#include "timeshift.h"
+#endif
 #include "si4703.h"
 #include "si473x.h"
 #include "vfs.h"
 
-static uint32_t s_requested_freq;
 static bool s_have_display;
 static bool s_have_tuner;
 
-int TunerRequestTuneTo(uint32_t freq_kHz)
+// the disk is laid out from a copy of the station table, the tuner thread
+// goes on changing its own
+//
+static struct station_info s_station_list[CONFIG_TUNER_MAX_STATIONS];
+
+// main sleeps in k_poll until another thread has something for it, the
+// only timeouts are real deadlines: display scrolling and refresh, and BLE
+// advertising.  an event's stamp is when it was first raised, to measure
+// how long main takes to react
+//
+#define MAIN_NO_DEADLINE        UINT32_MAX
+#define DISPLAY_SCROLL_MS       (600)
+#define DISPLAY_SPECTRUM_MS     (200)
+
+// discovery paused by a tune carries on once nothing has read audio for
+// this long
+//
+#define DISCOVERY_QUIET_MS      (10000)
+
+enum
 {
-    s_requested_freq = freq_kHz;
-    return 0;
+    MAIN_EVENT_TUNER,
+    MAIN_EVENT_AUDIO,
+    MAIN_EVENT_COUNT
+};
+
+K_SEM_DEFINE(s_tuner_event, 0, 1);
+K_SEM_DEFINE(s_audio_event, 0, 1);
+
+static struct k_poll_event s_events[MAIN_EVENT_COUNT] =
+{
+    K_POLL_EVENT_STATIC_INITIALIZER(K_POLL_TYPE_SEM_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY, &s_tuner_event, 0),
+    K_POLL_EVENT_STATIC_INITIALIZER(K_POLL_TYPE_SEM_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY, &s_audio_event, 0),
+};
+
+static atomic_t s_event_stamp[MAIN_EVENT_COUNT];
+
+static struct main_loop_stats
+{
+    int64_t     start_ms;
+    uint32_t    wakes;
+    uint32_t    timeouts;
+    uint32_t    events[MAIN_EVENT_COUNT];
+    uint32_t    max_react_us;
+    uint64_t    total_react_us;
+}
+s_loop_stats;
+
+static void MainRaise(int in_event, struct k_sem *in_sem)
+{
+    // 0 means not pending, so a stamp of 0 is nudged
+    //
+    atomic_cas(&s_event_stamp[in_event], 0, (atomic_val_t)(k_cycle_get_32() | 1));
+    k_sem_give(in_sem);
+}
+
+static void TunerEvent(void *in_ctx)
+{
+    MainRaise(MAIN_EVENT_TUNER, &s_tuner_event);
+}
+
+static void AudioEvent(void *in_ctx)
+{
+    MainRaise(MAIN_EVENT_AUDIO, &s_audio_event);
+}
+
+// wait for an event or the deadline, and count what woke us
+//
+static void MainWait(uint32_t in_delay_ms)
+{
+    uint32_t stamp;
+    uint32_t react_us;
+    int ret;
+
+    ret = k_poll(s_events, MAIN_EVENT_COUNT, in_delay_ms == MAIN_NO_DEADLINE ? K_FOREVER : K_MSEC(in_delay_ms));
+
+    s_loop_stats.wakes++;
+    if (ret == -EAGAIN)
+    {
+        s_loop_stats.timeouts++;
+    }
+
+    for (int event = 0; event < MAIN_EVENT_COUNT; event++)
+    {
+        if (s_events[event].state == K_POLL_STATE_SEM_AVAILABLE)
+        {
+            k_sem_take(s_events[event].sem, K_NO_WAIT);
+            s_events[event].state = K_POLL_STATE_NOT_READY;
+
+            stamp = (uint32_t)atomic_set(&s_event_stamp[event], 0);
+            if (stamp)
+            {
+                react_us = k_cyc_to_us_floor32(k_cycle_get_32() - stamp);
+
+                s_loop_stats.events[event]++;
+                s_loop_stats.total_react_us += react_us;
+                if (react_us > s_loop_stats.max_react_us)
+                {
+                    s_loop_stats.max_react_us = react_us;
+                }
+            }
+        }
+    }
+}
+
+// a request of ours is still with the tuner thread
+//
+static atomic_t s_tuner_busy;
+
+static void TunerRequestDone(void *in_ctx, tuner_cmd_t in_cmd, int in_result)
+{
+    atomic_set(&s_tuner_busy, 0);
+}
+
+static int RequestTuner(tuner_cmd_t in_cmd, uint32_t in_arg, tuner_priority_t in_priority)
+{
+    int ret;
+
+    atomic_set(&s_tuner_busy, 1);
+
+    ret = TunerRequest(in_cmd, in_arg, in_priority, TunerRequestDone, NULL);
+    if (ret)
+    {
+        atomic_set(&s_tuner_busy, 0);
+    }
+
+    return ret;
 }
 
 #if CONFIG_DISPLAY
-static void UpdateDisplay(void)
+// io_delay is lowered to when the display next needs redrawing without
+// anything else changing
+//
+static void UpdateDisplay(uint32_t *io_delay)
 {
     //static char rds_name[65];
     static char rds_text[65];
@@ -39,8 +171,8 @@ static void UpdateDisplay(void)
     static bool stereo;
 
     char rds_display[65];
+    struct tuner_snapshot snapshot;
     uint32_t curfreq;
-    uint8_t  currssi;
     bool     curstereo;
     const char *rdsn;
     const char *rdst;
@@ -52,16 +184,21 @@ static void UpdateDisplay(void)
         return;
     }
 
-    ret = TunerGetTunedStationFreq(&curfreq);
-    ret = TunerGetTunedStationRSSI(&currssi, &curstereo);
-    ret = TunerGetTunedStationRDS(&rdsn, &rdst);
+    // a copy of what the tuner thread last published, no bus traffic
+    //
+    ret = TunerGetSnapshot(&snapshot);
 
-    if (!ret)
+    if (!ret && snapshot.state == TUNER_TUNED)
     {
         char freqtext[8];
         bool rds_dirty = false;
         int i;
 
+        curfreq = snapshot.freq_kHz;
+        curstereo = snapshot.stereo;
+        rdsn = snapshot.rds_short;
+        rdst = snapshot.rds_long;
+
         snprintf(freqtext, sizeof(freqtext), "%5.1f", (float)curfreq / 1000.0);
 
         if (curfreq != freq)
@@ -106,10 +243,16 @@ static void UpdateDisplay(void)
 
             if (rds_len > rds_room)
             {
-                if ((now - rds_scroll) > 600)
+                if ((now - rds_scroll) >= DISPLAY_SCROLL_MS)
                 {
                     rds_dirty = true;
                     rds_offset++;
+                    rds_scroll = now;
+                }
+
+                if (DISPLAY_SCROLL_MS - (now - rds_scroll) < *io_delay)
+                {
+                    *io_delay = DISPLAY_SCROLL_MS - (now - rds_scroll);
                 }
             }
 
@@ -154,18 +297,35 @@ static void UpdateDisplay(void)
         }
 #endif
     }
+
+#if CONFIG_AUDIO_SPECTRUM
+    {
+        uint8_t levels[SPECTRUM_BANDS];
+
+        // spectrum bars in the corner under the stereo indicator
+        //
+        ret = SpectrumGetLevels(levels, SPECTRUM_BANDS);
+        if (!ret)
+        {
+            DisplayBars(100, 20, 3, 12, levels, SPECTRUM_BANDS);
+        }
+
+        if (DISPLAY_SPECTRUM_MS < *io_delay)
+        {
+            *io_delay = DISPLAY_SPECTRUM_MS;
+        }
+    }
+#endif
 }
 #endif
 
 int main(void)
 {
     int ret;
-    struct station_info *station_list;
 
     printk("-- Hello --");
 
-    uint32_t delay = 2000;
-    uint32_t min_delay;
+    uint32_t delay;
 
     ret = SettingsInit();
     require_noerr(ret, exit);
@@ -178,14 +338,13 @@ int main(void)
         s_have_display = true;
     }
 #endif
-    station_list = NULL;
     s_have_tuner = false;
 
 #if CONFIG_473X_DIGITAL
     // init audio as controller (not controllee) since 473x needs
     // to be the controllee in digital mode
     //
-    ret = AudioInit(false);
+    ret = AudioInit(true);
 #else
     // be I2S controllee normally
     //
@@ -198,12 +357,37 @@ int main(void)
     //
     AudioStart();
 
-    // bring up i2c tunner, volume set to 0
+#if CONFIG_AUDIO_SPECTRUM
+    if (s_have_display)
+    {
+        ret = SpectrumInit();
+        require_noerr(ret, exit);
+    }
+#endif
+
+#if CONFIG_AUDIO_TIMESHIFT
+    // without the log the radio still plays, there's just no rewind
+    //
+    ret = TimeshiftInit();
+    if (ret)
+    {
+        LOG_ERR("No time-shift log %d", ret);
+    }
+#endif
+
+    // bring up i2c tunner, volume set to 0.  with both radios fitted the
+    // si473x plays, it has the digital audio path, and the si4703 sweeps
     //
-    ret = TunerInit(SI473XGetRadio(), TUNER_SEEK_BETTER);
+    tuner_t *scanner = NULL;
+
+#if CONFIG_TUNER_DUAL
+    scanner = SI4703GetRadio();
+#endif
+
+    ret = TunerInit(SI473XGetRadio(), scanner, TUNER_SEEK_BETTER);
     if (ret)
     {
-        ret = TunerInit(SI4703GetRadio(), TUNER_SEEK_BETTER);
+        ret = TunerInit(SI4703GetRadio(), NULL, TUNER_SEEK_BETTER);
     }
 
     if (ret)
@@ -221,62 +405,69 @@ int main(void)
     require_noerr(ret, exit);
 #endif
 
-    bool got_stations = true; // set to false to do a disco on startup
+    // the stations saved last time are used as is unless they're stale,
+    // then rediscovered on startup when the radio can scan the band in one
+    // go.  a slice at a time discovery takes too long to hold up the disk
+    //
+    bool got_stations = !(TunerHasFastScan() && TunerStationsStale());
     bool setup_vdisk = false;
     bool tuner_ready = false;
     tuner_state_t tuner_state;
 
     if (!s_have_tuner)
     {
-        ret = vfs_init(station_list, 0, s_have_tuner);
+        ret = vfs_init(s_station_list, 0, s_have_tuner);
         setup_vdisk = true;
     }
     else
     {
+        TunerSetNotify(TunerEvent, NULL);
+
         // using usbms interface, go to near full volume for
         // best dynamic range of A/D
         //
-        TunerSetVolume(95);
+        TunerRequest(TUNER_CMD_VOLUME, 95, TUNER_PRIORITY_URGENT, NULL, NULL);
     }
 
+    AudioSetNotify(AudioEvent, NULL);
+    s_loop_stats.start_ms = k_uptime_get();
+
     while (true)
     {
-        min_delay = delay;
-        delay = 200;
+        delay = MAIN_NO_DEADLINE;
 
 #if CONFIG_BT
         ret = BLEslice(&delay);
-        if (delay < min_delay)
-        {
-            min_delay = delay;
-        }
 #endif
-        if (s_have_tuner)
+        // the tuner thread does the radio work, this only watches its
+        // state and asks for things
+        //
+        if (s_have_tuner && !atomic_get(&s_tuner_busy))
         {
-            ret = TunerSlice(&delay, &tuner_state);
-            if (delay < min_delay)
-            {
-                min_delay = delay;
-            }
-
+            tuner_state = TunerGetState();
             tuner_ready = tuner_state == TUNER_READY || tuner_state == TUNER_TUNED;
 
             if (tuner_ready && !got_stations)
             {
                 got_stations = true;
 
-                TunerDiscoverStations();
+                RequestTuner(TUNER_CMD_SCAN, false, TUNER_PRIORITY_NORMAL);
             }
+            // a second radio refreshes a stale table in the background.
+            // the disk doesn't wait for that, a sweep can take a long time
+            // or keep failing, so it shows the table that was loaded and
+            // the refreshed one is saved for the next boot
+            //
             else if (tuner_ready && got_stations && !setup_vdisk)
             {
                 uint32_t num_stations;
 
-                ret = TunerGetStations(&station_list, &num_stations);
+                ret = TunerGetStations(s_station_list, ARRAY_SIZE(s_station_list), &num_stations);
                 if (!ret)
                 {
                     setup_vdisk = true;
 
-                    ret = vfs_init(station_list, num_stations, s_have_tuner);
+                    ret = vfs_init(s_station_list, num_stations, s_have_tuner);
                     if (ret)
                     {
                         break;
@@ -285,22 +476,37 @@ int main(void)
             }
             else if (tuner_ready)
             {
-                if (s_requested_freq != 0)
+                // capture runs from boot and may be held running, so
+                // "nobody is listening" has to come from the reads
+                //
+                uint32_t quiet_ms = AudioReadIdleMs();
+
+                if (TunerDiscoveryPaused() && quiet_ms >= DISCOVERY_QUIET_MS)
                 {
-                    LOG_INF("TUNE --------- Requested freg %u", s_requested_freq);
-                    TunerTuneTo(s_requested_freq);
-                    s_requested_freq = 0;
+                    // a tune request paused discovery, carry on with it
+                    // now that nobody is listening
+                    //
+                    RequestTuner(TUNER_CMD_SCAN, false, TUNER_PRIORITY_NORMAL);
                 }
-#if CONFIG_DISPLAY
-                else if (s_have_display && tuner_state == TUNER_TUNED)
+                else
                 {
-                    UpdateDisplay();
-                }
+#if CONFIG_DISPLAY
+                    if (s_have_display && tuner_state == TUNER_TUNED)
+                    {
+                        UpdateDisplay(&delay);
+                    }
 #endif
+                    // nothing else wakes main when the reads stop
+                    //
+                    if (TunerDiscoveryPaused())
+                    {
+                        delay = MIN(delay, DISCOVERY_QUIET_MS - quiet_ms);
+                    }
+                }
             }
         }
 
-        k_msleep(min_delay);
+        MainWait(delay);
     }
 exit:
     while (true)
@@ -311,3 +517,37 @@ exit:
     return ret;
 }
 
+
+#if CONFIG_SHELL
+
+#include <zephyr/shell/shell.h>
+
+static int _CommandStats(const struct shell *s, size_t argc, char **argv)
+{
+    struct main_loop_stats *stats = &s_loop_stats;
+    uint32_t elapsed_ms = (uint32_t)(k_uptime_get() - stats->start_ms);
+    uint32_t reacted = stats->events[MAIN_EVENT_TUNER] + stats->events[MAIN_EVENT_AUDIO];
+
+    if (argc > 1 && !strcmp(argv[1], "clear"))
+    {
+        memset(stats, 0, sizeof(*stats));
+        stats->start_ms = k_uptime_get();
+        return 0;
+    }
+
+    shell_print(s, "wakes %u in %u s, %.2f/s, %u timeouts",
+            stats->wakes, elapsed_ms / 1000,
+            elapsed_ms ? (float)stats->wakes * 1000.0 / elapsed_ms : 0.0, stats->timeouts);
+    shell_print(s, "events tuner %u audio %u, react avg %u us max %u us",
+            stats->events[MAIN_EVENT_TUNER], stats->events[MAIN_EVENT_AUDIO],
+            reacted ? (uint32_t)(stats->total_react_us / reacted) : 0, stats->max_react_us);
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(_sub_main_commands,
+       SHELL_CMD_ARG(stats,     NULL,  "Loop wake-ups and reaction time [clear]", _CommandStats, 1, 1),
+       SHELL_SUBCMD_SET_END );
+
+SHELL_CMD_REGISTER(main, &_sub_main_commands, "Main loop", NULL);
+
+#endif
@@ -46,6 +46,13 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(usb_vmsc, LOG_LEVEL_INF);
 
+#if defined(CONFIG_AUDIO_RAMFUNC) && CONFIG_AUDIO_RAMFUNC
+#include <zephyr/linker/section_tags.h>
+#define MSC_RAMFUNC __ramfunc
+#else
+#define MSC_RAMFUNC
+#endif
+
 /* MSC Subclass and Protocol Codes */
 #define SCSI_TRANSPARENT_SUBCLASS	0x06
 #define BULK_ONLY_TRANSPORT_PROTOCOL	0x50
@@ -451,7 +458,8 @@ static bool readCapacity(void)
 	return write(capacity, sizeof(capacity));
 }
 
-static void thread_memory_read_done(void)
+/* runs for every packet of every sector the host reads */
+static MSC_RAMFUNC void thread_memory_read_done(void)
 {
 	uint32_t n = length;
 
@@ -2,11 +2,20 @@
 #include "vdisk.h"
 #include "asserts.h"
 #include "audioin.h"
+#include "audiodsp.h"
+#if CONFIG_VDISK_FLAC
+#include "flac.h"
+#endif
+#if CONFIG_AUDIO_TIMESHIFT
+#include "timeshift.h"
+#endif
 #include <zephyr/types.h>
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/disk.h>
 #include <zephyr/init.h>
 #include <zephyr/device.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
 #include <string.h>
 #include <errno.h>
 
@@ -36,23 +45,114 @@ static uint8_t s_wav_header_live[] = {
   0x00, 0x00, 0x00, 0x80    // data section byte length - 2Gb
 };
 
-static uint8_t s_wav_header_dead[] = {
-  0x52, 0x49, 0x46, 0x46,   // "RIFF"
-  0x8c, 0x64, 0x01, 0x00,   // file size
-  0x57, 0x41, 0x56, 0x45,   // "WAVE"
-  0x66, 0x6d, 0x74, 0x20,   // "fmt "
-  0x10, 0x00, 0x00, 0x00,   // fmt section byte length
-  0x01, 0x00,               // PCM format (1)
-  0x01, 0x00,               // channels (1)
-  0xf1, 0x56, 0x00, 0x00,   // sample rate 22257
-  0xf1, 0x56, 0x00, 0x00,   // bitrate - same
-  0x01, 0x00,               // 1 byte per frame
-  0x08, 0x00,               // 8 bits per sample
-  0x64, 0x61, 0x74, 0x61,   // "data"
-  0x00, 0x00, 0x00, 0x80    // data section length - 2Gb
+#define WAV_HEADER_SIZE (sizeof(s_wav_header_live))
+
+// With no tuner the wav file plays the canned taunt, decoded from flash a
+// block at a time and stretched to the live file's 44.1k stereo so the
+// host sees the same format either way.  It repeats every
+// VDISK_TAUNT_FRAMES frames
+//
+#define VDISK_TAUNT_FRAMES          ((uint32_t)(((uint64_t)taunt_samples * 44100) / TAUNT_SAMPLE_RATE))
+
+static int16_t s_taunt_pcm[TAUNT_BLOCK_SAMPLES];
+static int32_t s_taunt_block = -1;
+
+// files other than the wav file(s) each have their own sequential cluster
+// chain after the wav files, starting on a FAT sector boundary
+//
+#define VDISK_EXTRA_FILES           (CONFIG_VDISK_FLAC || CONFIG_VDISK_LIVE_FORMATS || CONFIG_AUDIO_TIMESHIFT)
+#define VDISK_CLUSTER_SECTORS       (64)
+#define VDISK_MAX_EXTRA_FILES       (4)
+
+#if VDISK_EXTRA_FILES
+struct vdisk_chain
+{
+    uint32_t    first_cluster;
+    uint32_t    last_cluster;
 };
 
-#define WAV_HEADER_SIZE (sizeof(s_wav_header_live))
+static struct vdisk_chain s_chains[VDISK_MAX_EXTRA_FILES];
+static uint32_t s_num_chains;
+#endif
+
+#if CONFIG_VDISK_FLAC
+// The flac file runs to near the end of the volume, or up to the other
+// live files and the rewind file.  Its first sector is the stream header and the rest are encoded a
+// group of sectors at a time, each group starting and ending on a frame
+//
+#define VDISK_FLAC_FIRST_CLUSTER    (66048)
+#if CONFIG_VDISK_LIVE_FORMATS
+#define VDISK_FLAC_CLUSTERS         (16384)
+#elif CONFIG_AUDIO_TIMESHIFT
+#define VDISK_FLAC_CLUSTERS         (28672)
+#else
+#define VDISK_FLAC_CLUSTERS         (31744)
+#endif
+#define VDISK_FLAC_LAST_CLUSTER     (VDISK_FLAC_FIRST_CLUSTER + VDISK_FLAC_CLUSTERS - 1)
+#define VDISK_FLAC_START_SECTOR     ((VDISK_FLAC_FIRST_CLUSTER - 3) * VDISK_CLUSTER_SECTORS)
+#define VDISK_FLAC_SECTORS          (VDISK_FLAC_CLUSTERS * VDISK_CLUSTER_SECTORS)
+#define VDISK_FLAC_SIZE             ((uint32_t)VDISK_FLAC_SECTORS * VFAT_SECTOR_SIZE)
+#define VDISK_FLAC_GROUP_SECTORS    CONFIG_VDISK_FLAC_GROUP_SECTORS
+
+static const char s_flac_lfn[] = "TeslaRadio.flac";
+static const char s_flac_sfn[] = "TESLAR~1FLA";
+
+static struct flac_encoder s_flac;
+static uint8_t s_flac_group[VDISK_FLAC_GROUP_SECTORS * VFAT_SECTOR_SIZE];
+static int32_t s_flac_group_index = -1;
+#endif
+
+#if CONFIG_VDISK_LIVE_FORMATS
+// The same live audio in other formats, each its own file converted from
+// the capture rate.  Which conversion runs is picked by the file the host
+// reads, and the first sector of a file restarts its conversion.  That
+// sector is the header then silence so frames stay sector aligned
+//
+struct vdisk_live_format
+{
+    const char *lfn;
+    const char *sfn;
+    uint32_t    rate;
+    uint32_t    channels;
+    uint32_t    first_cluster;
+    uint32_t    clusters;
+};
+
+// about 50 minutes of 22k mono and 23 of 48k stereo
+//
+static const struct vdisk_live_format s_live_formats[] =
+{
+    { "TeslaRadio-22k-mono.wav", "TESLAR~2WAV", 22050, 1, 82432, 4096 },
+    { "TeslaRadio-48k.wav",      "TESLAR~3WAV", 48000, 2, 86528, 8192 },
+};
+
+#define VDISK_LIVE_FORMATS          (sizeof(s_live_formats) / sizeof(s_live_formats[0]))
+#define VDISK_LIVE_IN_FRAMES        (128)
+
+static uint8_t s_live_headers[VDISK_LIVE_FORMATS][WAV_HEADER_SIZE];
+static struct dsp_resampler s_live_resampler;
+static int s_live_format = -1;
+static uint32_t s_live_in[VDISK_LIVE_IN_FRAMES];
+static uint32_t s_live_in_count;
+static uint32_t s_live_in_used;
+#endif
+
+#if CONFIG_AUDIO_TIMESHIFT
+// Rewind.wav is the time-shift log as pcm, as long as the log reaches back.
+// Reading its first sector anchors it at the oldest audio in the log, the
+// end of the file is live and reads there wait for the audio to arrive
+//
+#define VDISK_REWIND_FIRST_CLUSTER  (94720)
+#define VDISK_REWIND_MAX_CLUSTERS   (2048)
+#define VDISK_REWIND_START_SECTOR   ((VDISK_REWIND_FIRST_CLUSTER - 3) * VDISK_CLUSTER_SECTORS)
+#define VDISK_REWIND_SECTOR_FRAMES  (VFAT_SECTOR_SIZE / sizeof(uint32_t))
+
+static const char s_rewind_lfn[] = "Rewind.wav";
+static const char s_rewind_sfn[] = "REWIND  WAV";
+
+static uint8_t s_rewind_header[WAV_HEADER_SIZE];
+static uint32_t s_rewind_sectors;
+#endif
 
 static uint32_t s_start_sectors[VFAT_ROOT_DIR_COUNT];
 static uint32_t s_start_stations[VFAT_ROOT_DIR_COUNT];
@@ -69,6 +169,516 @@ static int disk_ram_access_init(struct disk_info *disk)
     return 0;
 }
 
+// taunt sample at in_index, decoding its block if it isn't the cached one
+//
+static int16_t vdisk_taunt_sample(uint32_t in_index)
+{
+    struct dsp_adpcm state;
+    const uint8_t *block;
+    int32_t block_index;
+
+    if (in_index >= taunt_samples)
+    {
+        in_index -= taunt_samples;
+    }
+
+    block_index = in_index / TAUNT_BLOCK_SAMPLES;
+
+    if (block_index != s_taunt_block)
+    {
+        block = taunt_adpcm + block_index * TAUNT_BLOCK_SIZE;
+
+        state.predictor = (int16_t)sys_get_le16(block);
+        state.index = block[2];
+        state.reserved = 0;
+
+        AudioDspAdpcmDecodeMono(&state, block + TAUNT_BLOCK_HEADER, TAUNT_BLOCK_SAMPLES, s_taunt_pcm);
+        s_taunt_block = block_index;
+    }
+
+    return s_taunt_pcm[in_index % TAUNT_BLOCK_SAMPLES];
+}
+
+// in_count stereo frames of the taunt at 44.1k starting at in_frame,
+// linearly interpolated from the stored rate
+//
+static void vdisk_taunt_frames(uint32_t in_frame, uint32_t *out_frames, uint32_t in_count)
+{
+    uint64_t pos;
+    uint32_t index;
+    uint32_t frac;
+    int32_t a;
+    int32_t b;
+    uint16_t sample;
+
+    in_frame %= VDISK_TAUNT_FRAMES;
+
+    while (in_count > 0)
+    {
+        // source position in 16.16 fixed point
+        //
+        pos = ((uint64_t)in_frame * TAUNT_SAMPLE_RATE << 16) / 44100;
+        index = (uint32_t)(pos >> 16);
+        frac = (uint32_t)(pos & 0xFFFF);
+
+        a = vdisk_taunt_sample(index);
+        b = vdisk_taunt_sample(index + 1);
+
+        sample = (uint16_t)(int16_t)(a + (((b - a) * (int32_t)frac) >> 16));
+        *out_frames++ = ((uint32_t)sample << 16) | sample;
+
+        if (++in_frame >= VDISK_TAUNT_FRAMES)
+        {
+            in_frame = 0;
+        }
+        in_count--;
+    }
+}
+
+#if VDISK_EXTRA_FILES
+// build a pcm wav header for a file of in_size bytes
+//
+static void vdisk_wav_header(uint8_t *out_header, uint32_t in_rate, uint32_t in_channels, uint32_t in_size)
+{
+    uint32_t frame_bytes = in_channels * sizeof(int16_t);
+
+    memcpy(out_header, s_wav_header_live, WAV_HEADER_SIZE);
+    sys_put_le32(in_size - 8, out_header + 4);
+    sys_put_le16(in_channels, out_header + 22);
+    sys_put_le32(in_rate, out_header + 24);
+    sys_put_le32(in_rate * frame_bytes, out_header + 28);
+    sys_put_le16(frame_bytes, out_header + 32);
+    sys_put_le32(in_size - WAV_HEADER_SIZE, out_header + WAV_HEADER_SIZE - 4);
+}
+#endif
+
+#if CONFIG_VDISK_FLAC || CONFIG_VDISK_LIVE_FORMATS
+static int vdisk_read_live_audio(uint32_t *out_frames, uint32_t in_count, void *in_ctx)
+{
+    int ret;
+
+    if (!AudioActive())
+    {
+        // keep the stream valid with silence
+        //
+        memset(out_frames, 0, in_count * sizeof(uint32_t));
+        return 0;
+    }
+
+    ret = AudioReadSamples(out_frames, in_count * sizeof(uint32_t), 1500);
+    if (ret < 0)
+    {
+        return ret;
+    }
+    if (ret < in_count * sizeof(uint32_t))
+    {
+        LOG_WRN("live underrun, concealed %d bytes", in_count * sizeof(uint32_t) - ret);
+    }
+
+    return 0;
+}
+#endif
+
+#if CONFIG_VDISK_LIVE_FORMATS
+static void vdisk_live_read(int format, uint8_t *buff, uint32_t sector, uint32_t count)
+{
+    const struct vdisk_live_format *live = &s_live_formats[format];
+    uint32_t out_frames = VFAT_SECTOR_SIZE / (live->channels * sizeof(int16_t));
+    uint32_t made;
+    uint32_t chunk_made;
+    int16_t *out;
+    int used;
+
+    while (count > 0)
+    {
+        if (sector == 0 || format != s_live_format)
+        {
+            AudioDspResamplerInit(&s_live_resampler, 44100, live->rate, live->channels);
+            s_live_format = format;
+            s_live_in_count = 0;
+            s_live_in_used = 0;
+        }
+
+        if (sector == 0)
+        {
+            memset(buff, 0, VFAT_SECTOR_SIZE);
+            memcpy(buff, s_live_headers[format], WAV_HEADER_SIZE);
+        }
+        else if (sector < live->clusters * VDISK_CLUSTER_SECTORS)
+        {
+            out = (int16_t *)buff;
+            made = 0;
+
+            while (made < out_frames)
+            {
+                if (s_live_in_used >= s_live_in_count)
+                {
+                    vdisk_read_live_audio(s_live_in, VDISK_LIVE_IN_FRAMES, NULL);
+                    s_live_in_count = VDISK_LIVE_IN_FRAMES;
+                    s_live_in_used = 0;
+                }
+
+                used = AudioDspResample(&s_live_resampler, s_live_in + s_live_in_used, s_live_in_count - s_live_in_used,
+                                        out + made * live->channels, out_frames - made, &chunk_made);
+                if (used < 0)
+                {
+                    memset(buff, 0, VFAT_SECTOR_SIZE);
+                    break;
+                }
+                s_live_in_used += used;
+                made += chunk_made;
+            }
+        }
+        else
+        {
+            memset(buff, 0, VFAT_SECTOR_SIZE);
+        }
+
+        buff += VFAT_SECTOR_SIZE;
+        sector++;
+        count--;
+    }
+}
+#endif
+
+#if CONFIG_VDISK_FLAC
+
+static void vdisk_flac_read(uint8_t *buff, uint32_t sector, uint32_t count)
+{
+    int ret;
+
+    while (count > 0)
+    {
+        if (sector == 0)
+        {
+            if (s_flac.groups)
+            {
+                LOG_INF("flac stream %u groups, %u%% of pcm, %u of %u blocks lossy",
+                        s_flac.groups,
+                        (uint32_t)(s_flac.out_bytes * 100 / (s_flac.in_frames * sizeof(uint32_t))),
+                        s_flac.lossy_blocks, s_flac.blocks);
+            }
+
+            ret = FlacEncodeHeader(&s_flac, buff);
+            if (ret)
+            {
+                LOG_ERR("flac header %d", ret);
+            }
+            s_flac_group_index = -1;
+        }
+        else if (sector < VDISK_FLAC_SECTORS)
+        {
+            int32_t group = (sector - 1) / VDISK_FLAC_GROUP_SECTORS;
+            uint32_t offset = (sector - 1) % VDISK_FLAC_GROUP_SECTORS;
+
+            // a group is encoded when the host asks for any sector of it
+            // that isn't cached, normally its first.  If the host skipped
+            // ahead the decoder picks the stream up again at the next group
+            //
+            if (group != s_flac_group_index)
+            {
+                ret = FlacEncodeGroup(&s_flac, s_flac_group);
+                if (ret)
+                {
+                    LOG_ERR("flac group %d", ret);
+                    memset(s_flac_group, 0, sizeof(s_flac_group));
+                }
+                s_flac_group_index = group;
+            }
+
+            memcpy(buff, s_flac_group + offset * VFAT_SECTOR_SIZE, VFAT_SECTOR_SIZE);
+        }
+        else
+        {
+            memset(buff, 0, VFAT_SECTOR_SIZE);
+        }
+
+        buff += VFAT_SECTOR_SIZE;
+        sector++;
+        count--;
+    }
+}
+#endif
+
+#if CONFIG_AUDIO_TIMESHIFT
+static void vdisk_rewind_read(uint8_t *buff, uint32_t sector, uint32_t count)
+{
+    int ret;
+
+    while (count > 0)
+    {
+        if (sector == 0)
+        {
+            // the header then silence up to the first whole frame of the
+            // second sector
+            //
+            TimeshiftRewindAnchor();
+
+            memset(buff, 0, VFAT_SECTOR_SIZE);
+            memcpy(buff, s_rewind_header, WAV_HEADER_SIZE);
+        }
+        else if (sector < s_rewind_sectors)
+        {
+            ret = TimeshiftRead(sector * VDISK_REWIND_SECTOR_FRAMES - WAV_HEADER_SIZE / sizeof(uint32_t),
+                                (uint32_t *)buff, VDISK_REWIND_SECTOR_FRAMES, 1500);
+            if (ret)
+            {
+                LOG_ERR("rewind read %d", ret);
+                memset(buff, 0, VFAT_SECTOR_SIZE);
+            }
+        }
+        else
+        {
+            memset(buff, 0, VFAT_SECTOR_SIZE);
+        }
+
+        buff += VFAT_SECTOR_SIZE;
+        sector++;
+        count--;
+    }
+}
+#endif
+
+#if VDISK_EXTRA_FILES
+// fill in any of the extra files' chains that fall in a FAT sector, they
+// are sequential like the first file
+//
+static void vdisk_fat_chains(uint32_t *fatptr, uint32_t sector)
+{
+    uint32_t first = sector * (VFAT_SECTOR_SIZE / 4);
+    uint32_t last = first + VFAT_SECTOR_SIZE / 4 - 1;
+    uint32_t cluster;
+
+    for (int chain = 0; chain < s_num_chains; chain++)
+    {
+        for (cluster = first; cluster <= last; cluster++)
+        {
+            if (cluster < s_chains[chain].first_cluster || cluster > s_chains[chain].last_cluster)
+            {
+                continue;
+            }
+            if (cluster == s_chains[chain].last_cluster)
+            {
+                fatptr[cluster - first] = 0x0FFFFFFF;
+            }
+            else
+            {
+                fatptr[cluster - first] = cluster + 1;
+            }
+        }
+    }
+}
+#endif
+
+// cycles spent reading data sectors.  the best case is the synthesis
+// alone, live audio reads also include any wait for the audio to arrive
+//
+static uint64_t s_data_sectors;
+static uint64_t s_data_cycles;
+static uint32_t s_data_min_cycles = UINT32_MAX;
+static uint32_t s_data_max_cycles;
+
+static void vdisk_sector_stats(uint32_t in_cycles, uint32_t in_sectors)
+{
+    uint32_t per_sector;
+
+    if (in_sectors == 0)
+    {
+        return;
+    }
+
+    per_sector = in_cycles / in_sectors;
+
+    s_data_sectors += in_sectors;
+    s_data_cycles += in_cycles;
+
+    if (per_sector < s_data_min_cycles)
+    {
+        s_data_min_cycles = per_sector;
+    }
+    if (per_sector > s_data_max_cycles)
+    {
+        s_data_max_cycles = per_sector;
+    }
+}
+
+// the tuner thread has the new station (STC), let the audio through
+//
+static void vdisk_retuned(void *in_ctx, tuner_cmd_t in_cmd, int in_result)
+{
+    AudioRetuneEnd();
+}
+
+// the data section, where the wav file(s) and any extra files are
+// synthesized.  this runs for every sector the host streams so it's
+// placed in RAM with CONFIG_AUDIO_RAMFUNC.  returns the sectors not read
+//
+DSP_RAMFUNC static uint32_t vdisk_data_read(uint8_t *buff, uint32_t sector, uint32_t count, uint32_t remain)
+{
+    uint32_t *src_ptr;
+    uint32_t *dst_ptr;
+    uint32_t sector_offset = 0;
+    uint32_t frame;
+    int dstdex;
+    int copy_cnt;
+    bool is_start_sector = false;
+
+#if CONFIG_AUDIO_TIMESHIFT
+    if (sector >= VDISK_REWIND_START_SECTOR)
+    {
+        vdisk_rewind_read(buff, sector - VDISK_REWIND_START_SECTOR, (count < remain) ? count : remain);
+        return 0;
+    }
+#endif
+#if CONFIG_VDISK_LIVE_FORMATS
+    for (int format = VDISK_LIVE_FORMATS - 1; format >= 0; format--)
+    {
+        uint32_t start = (s_live_formats[format].first_cluster - 3) * VDISK_CLUSTER_SECTORS;
+
+        if (sector >= start)
+        {
+            vdisk_live_read(format, buff, sector - start, (count < remain) ? count : remain);
+            return 0;
+        }
+    }
+#endif
+#if CONFIG_VDISK_FLAC
+    if (sector >= VDISK_FLAC_START_SECTOR)
+    {
+        vdisk_flac_read(buff, sector - VDISK_FLAC_START_SECTOR, (count < remain) ? count : remain);
+        return 0;
+    }
+#endif
+
+    dst_ptr = (uint32_t *)buff;
+    dstdex = 0;
+
+    // reading data from the starting sector of (one of) s wav file means
+    // wanting to tune to that station index if there are multiple files
+    //
+    for (int ss = 0; ss < VFAT_ROOT_DIR_COUNT; ss++)
+    {
+        if (sector == s_start_sectors[ss])
+        {
+            if (VFAT_ROOT_DIR_COUNT > 1)
+            {
+                LOG_INF("data read at sec %u starts wav file index %d", sector, ss);
+
+                if (s_have_tuner)
+                {
+                    // tune to this station
+                    if (s_start_stations[ss] != 0)
+                    {
+                       AudioRetuneBegin();
+                       TunerRequest(TUNER_CMD_TUNE, s_start_stations[ss], TUNER_PRIORITY_URGENT,
+                                    vdisk_retuned, NULL);
+                    }
+                }
+
+                // start i2s stream if not running already
+                //
+                if (!AudioActive())
+                {
+                    AudioStart();
+                }
+            }
+
+            is_start_sector = true;
+            break;
+        }
+
+        if (
+                ss > 0
+            &&  sector > s_start_sectors[ss]
+            && (
+                    (ss == VFAT_ROOT_DIR_COUNT - 1)
+                ||  (sector < s_start_sectors[ss + 1])
+            )
+        )
+        {
+            // the sector is within the first cluster of a file above the first file, after the start,
+            // so map that as if its the same relative sector in the first file
+            //
+            sector_offset = s_start_sectors[ss] - s_start_sectors[0];
+            break;
+        }
+    }
+
+    while (count > 0 && remain > 0)
+    {
+        LOG_DBG("in sector %u (offset=%u)", sector - sector_offset, sector_offset);
+
+        // synthesize data
+        if (is_start_sector)
+        {
+            int hdrdex = 0;
+
+            src_ptr = (uint32_t *)s_wav_header_live;
+
+            // prepend wave header
+            while (dstdex < WAV_HEADER_SIZE / 4)
+            {
+                dst_ptr[dstdex++] = src_ptr[hdrdex++];
+            }
+
+            frame = 0;
+            copy_cnt = VFAT_SECTOR_SIZE - WAV_HEADER_SIZE;
+        }
+        else
+        {
+            frame = ((sector - sector_offset) * VFAT_SECTOR_SIZE - WAV_HEADER_SIZE) / 4;
+            copy_cnt = VFAT_SECTOR_SIZE;
+        }
+
+        if (AudioActive())
+        {
+            // if audio pipe is active, source data from it except first sector
+            // which we fill with 0
+            //
+            if (is_start_sector)
+            {
+                copy_cnt /= 4;
+
+                while (copy_cnt > 0)
+                {
+                    dst_ptr[dstdex++] = 0;
+                    copy_cnt--;
+                }
+            }
+            else
+            {
+                int ret;
+
+                // pull exactly one sector from the audio ring, however
+                // the ring blocks are sized, waiting up to 1.5s for it.
+                // anything that doesn't arrive in time is concealed
+                //
+                ret = AudioReadSamples(dst_ptr + dstdex, VFAT_SECTOR_SIZE, 1500);
+                if (ret < VFAT_SECTOR_SIZE)
+                {
+                    LOG_WRN("underrun, concealed %d bytes", VFAT_SECTOR_SIZE - ret);
+                }
+
+                dstdex += VFAT_SECTOR_SIZE / 4;
+            }
+        }
+        else
+        {
+            // audio pipe not active, source data from canned file
+            //
+            vdisk_taunt_frames(frame, dst_ptr + dstdex, copy_cnt / 4);
+            dstdex += copy_cnt / 4;
+        }
+
+        is_start_sector = false;
+        sector++;
+        count--;
+        remain--;
+    }
+
+    return count;
+}
+
 static int disk_ram_access_read(struct disk_info *disk, uint8_t *buff,
                                 uint32_t sector, uint32_t count)
 {
@@ -196,6 +806,9 @@ static int disk_ram_access_read(struct disk_info *disk, uint8_t *buff,
             else
             {
                 memset(fatptr, 0, VFAT_SECTOR_SIZE);
+#if VDISK_EXTRA_FILES
+                vdisk_fat_chains(fatptr, sector);
+#endif
             }
 
             fatptr += VFAT_SECTOR_SIZE / 4;
@@ -206,191 +819,11 @@ static int disk_ram_access_read(struct disk_info *disk, uint8_t *buff,
     }
     else if (section == SECTION_DATA)
     {
-        uint32_t *src_ptr;
-        uint32_t *dst_ptr;
-        uint32_t sector_offset = 0;
-        int srcdex;
-        int dstdex;
-        int copy_cnt;
-        bool is_start_sector = false;
-
-        dst_ptr = (uint32_t *)buff;
-        dstdex = 0;
-
-        // reading data from the starting sector of (one of) s wav file means
-        // wanting to tune to that station index if there are multiple files
-        //
-        for (int ss = 0; ss < VFAT_ROOT_DIR_COUNT; ss++)
-        {
-            if (sector == s_start_sectors[ss])
-            {
-                if (VFAT_ROOT_DIR_COUNT > 1)
-                {
-                    LOG_INF("data read at sec %u starts wav file index %d", sector, ss);
-
-                    if (s_have_tuner)
-                    {
-                        // tune to this station
-                        if (s_start_stations[ss] != 0)
-                        {
-                           TunerRequestTuneTo(s_start_stations[ss]);
-                        }
-                    }
-
-                    // start i2s stream if not running already
-                    //
-                    if (!AudioActive())
-                    {
-                        AudioStart();
-                    }
-                }
-
-                is_start_sector = true;
-                break;
-            }
-
-            if (
-                    ss > 0
-                &&  sector > s_start_sectors[ss]
-                && (
-                        (ss == VFAT_ROOT_DIR_COUNT - 1)
-                    ||  (sector < s_start_sectors[ss + 1])
-                )
-            )
-            {
-                // the sector is within the first cluster of a file above the first file, after the start,
-                // so map that as if its the same relative sector in the first file
-                //
-                sector_offset = s_start_sectors[ss] - s_start_sectors[0];
-                break;
-            }
-        }
-
-        while (count > 0 && remain > 0)
-        {
-            LOG_DBG("in sector %u (offset=%u)", sector - sector_offset, sector_offset);
-
-            // synthesize data
-            if (is_start_sector)
-            {
-                int hdrdex = 0;
-
-                is_start_sector = false;
-
-                if (s_have_tuner)
-                {
-                    src_ptr = (uint32_t *)s_wav_header_live;
-                }
-                else
-                {
-                    src_ptr = (uint32_t *)s_wav_header_dead;
-                }
-
-                // prepend wave header
-                while (dstdex < WAV_HEADER_SIZE / 4)
-                {
-                    dst_ptr[dstdex++] = src_ptr[hdrdex++];
-                }
-
-                srcdex = 0;
-                copy_cnt = VFAT_SECTOR_SIZE - WAV_HEADER_SIZE;
-            }
-            else
-            {
-                srcdex = ((sector - sector_offset) * VFAT_SECTOR_SIZE - WAV_HEADER_SIZE) % taunt_wav_len;
-                copy_cnt = VFAT_SECTOR_SIZE;
-            }
-
-            if (AudioActive())
-            {
-                // if audio pipe is active, source data from it except first sector
-                // which we fill with 0
-                //
-                if (is_start_sector)
-                {
-                    srcdex /= 4;
-                    copy_cnt /= 4;
-
-                    while (copy_cnt > 0)
-                    {
-                        dst_ptr[dstdex++] = 0;
-                        copy_cnt--;
-                    }
-                }
-                else
-                {
-                    void *samples;
-                    size_t sample_bytes;
-                    int timer;
-                    int ret;
-
-                    srcdex = 0;
-                    sample_bytes = 0;
-                    samples = NULL;
-                    timer = 1500;
-
-                    while (timer > 0)
-                    {
-                        // timeout getting samples
-                        ret = AudioGetSamples(&samples, &sample_bytes);
-                        if (!ret)
-                        {
-                            verify(sample_bytes == VFAT_SECTOR_SIZE);
-                            break;
-                        }
-
-                        timer-= 10;
-                        k_msleep(10);
-                    }
-
-                    if (sample_bytes > 0)
-                    {
-                        src_ptr = (uint32_t *)samples;
-                        copy_cnt = sample_bytes / 4;
-                        while (copy_cnt > 0)
-                        {
-                            dst_ptr[dstdex++] = src_ptr[srcdex++];
-                            copy_cnt--;
-                        }
-                    }
-                    else
-                    {
-                        LOG_WRN("underrun");
-
-                        copy_cnt = sample_bytes / 4;
-                        while (copy_cnt > 0)
-                        {
-                            dst_ptr[dstdex++] = 0;
-                            copy_cnt--;
-                        }
-                    }
-                }
-            }
-            else
-            {
-                // audio pipe not active, source data from canned file
-                //
-                src_ptr = (uint32_t *)taunt_wav;
-                srcdex /= 4;
-                copy_cnt /= 4;
-
-                while (copy_cnt > 0)
-                {
-                    dst_ptr[dstdex++] = src_ptr[srcdex++];
-
-                    if (srcdex >= taunt_wav_len / 4)
-                    {
-                        srcdex = 0;
-                    }
-
-                    copy_cnt--;
-                }
-            }
+        uint32_t start = k_cycle_get_32();
+        uint32_t sectors = count;
 
-            sector++;
-            count--;
-            remain--;
-        }
+        count = vdisk_data_read(buff, sector, count, remain);
+        vdisk_sector_stats(k_cycle_get_32() - start, sectors - count);
     }
     else
     {
@@ -701,6 +1134,157 @@ void vdisk_setup_dir(struct station_info *stations, uint32_t num_stations)
     }
 }
 
+#if VDISK_EXTRA_FILES
+// fill an lfn entry with up to 13 characters of the name from in_index
+//
+static void vdisk_set_lfn(uint8_t *entry, uint8_t order, const char *name, uint32_t in_index, uint8_t csum)
+{
+    static const uint8_t char_offs[13] = { 1, 3, 5, 7, 9, 14, 16, 18, 20, 22, 24, 28, 30 };
+    uint32_t len = strlen(name);
+
+    memset(entry, 0, 32);
+    entry[0] = order;
+    entry[AT_OFF] = AT_LFN;
+    entry[CSUM_OFF] = csum;
+
+    for (int i = 0; i < 13; i++, in_index++)
+    {
+        // name is nul terminated then padded with 0xFFFF
+        //
+        if (in_index < len)
+        {
+            entry[char_offs[i]] = name[in_index];
+        }
+        else if (in_index > len)
+        {
+            entry[char_offs[i]] = 0xFF;
+            entry[char_offs[i] + 1] = 0xFF;
+        }
+    }
+}
+
+// add a file after the last entry in the root dir, with the same
+// timestamps as the wav file, and remember its cluster chain
+//
+static int vdisk_add_file(const char *lfn, const char *sfn, uint32_t first_cluster, uint32_t clusters, uint32_t size)
+{
+    uint8_t *dir = (uint8_t *)section_sectors[SECTION_ROOTDIR].sectors[0];
+    uint8_t *wav_entry = NULL;
+    uint8_t *entry;
+    uint32_t ent_off;
+    uint32_t lfn_ents = (strlen(lfn) + 12) / 13;
+    uint8_t csum;
+
+    for (ent_off = 0; ent_off < VFAT_SECTOR_SIZE; ent_off += 32)
+    {
+        if (dir[ent_off] == 0)
+        {
+            break;
+        }
+        if (dir[ent_off + AT_OFF] != AT_LFN && !wav_entry)
+        {
+            wav_entry = dir + ent_off;
+        }
+    }
+
+    if (!wav_entry || ent_off + (lfn_ents + 1) * 32 > VFAT_SECTOR_SIZE || s_num_chains >= VDISK_MAX_EXTRA_FILES)
+    {
+        LOG_ERR("No room for %s", lfn);
+        return -ENOSPC;
+    }
+
+    csum = vdisk_csum_lfn(sfn);
+
+    // lfn entries go in reverse order, the first marked as the last
+    //
+    for (uint32_t ent = 0; ent < lfn_ents; ent++)
+    {
+        uint32_t order = lfn_ents - ent;
+
+        vdisk_set_lfn(dir + ent_off, order | ((ent == 0) ? 0x40 : 0), lfn, (order - 1) * 13, csum);
+        ent_off += 32;
+    }
+
+    entry = dir + ent_off;
+    memcpy(entry, wav_entry, 32);
+    memcpy(entry, sfn, 11);
+
+    entry[CLUST_LOW] = first_cluster & 0xFF;
+    entry[CLUST_LOW + 1] = (first_cluster >> 8) & 0xFF;
+    entry[CLUST_HIGH] = (first_cluster >> 16) & 0xFF;
+    entry[CLUST_HIGH + 1] = (first_cluster >> 24) & 0xFF;
+    entry[SIZE_OFF] = size & 0xFF;
+    entry[SIZE_OFF + 1] = (size >> 8) & 0xFF;
+    entry[SIZE_OFF + 2] = (size >> 16) & 0xFF;
+    entry[SIZE_OFF + 3] = (size >> 24) & 0xFF;
+
+    s_chains[s_num_chains].first_cluster = first_cluster;
+    s_chains[s_num_chains].last_cluster = first_cluster + clusters - 1;
+    s_num_chains++;
+
+    // the generated layout's data section ends with the first file, so
+    // stretch it over the rest of the volume
+    //
+    section_sectors[SECTION_DATA].count = VFAT_SECTOR_COUNT - section_sectors[SECTION_DATA].start_sector;
+    return 0;
+}
+#endif
+
+#if CONFIG_VDISK_FLAC
+static void vdisk_setup_flac(void)
+{
+    if (vdisk_add_file(s_flac_lfn, s_flac_sfn, VDISK_FLAC_FIRST_CLUSTER, VDISK_FLAC_CLUSTERS, VDISK_FLAC_SIZE))
+    {
+        return;
+    }
+
+    FlacEncoderInit(&s_flac, 44100, sizeof(s_flac_group), vdisk_read_live_audio, NULL);
+}
+#endif
+
+#if CONFIG_VDISK_LIVE_FORMATS
+static void vdisk_setup_live_formats(void)
+{
+    for (int format = 0; format < VDISK_LIVE_FORMATS; format++)
+    {
+        const struct vdisk_live_format *live = &s_live_formats[format];
+        uint32_t size = live->clusters * VDISK_CLUSTER_SECTORS * VFAT_SECTOR_SIZE;
+
+        vdisk_wav_header(s_live_headers[format], live->rate, live->channels, size);
+        vdisk_add_file(live->lfn, live->sfn, live->first_cluster, live->clusters, size);
+    }
+}
+#endif
+
+#if CONFIG_AUDIO_TIMESHIFT
+// the rewind file is sized to what the log can hold, and is only there
+// when the log is running
+//
+static void vdisk_setup_rewind(void)
+{
+    uint32_t clusters;
+    uint32_t size;
+
+    if (TimeshiftSpanFrames() == 0)
+    {
+        return;
+    }
+
+    s_rewind_sectors = 1 + TimeshiftSpanFrames() / VDISK_REWIND_SECTOR_FRAMES;
+    clusters = (s_rewind_sectors + VDISK_CLUSTER_SECTORS - 1) / VDISK_CLUSTER_SECTORS;
+    if (clusters > VDISK_REWIND_MAX_CLUSTERS)
+    {
+        clusters = VDISK_REWIND_MAX_CLUSTERS;
+        s_rewind_sectors = clusters * VDISK_CLUSTER_SECTORS;
+    }
+    size = s_rewind_sectors * VFAT_SECTOR_SIZE;
+
+    vdisk_wav_header(s_rewind_header, 44100, 2, size);
+
+    vdisk_add_file(s_rewind_lfn, s_rewind_sfn, VDISK_REWIND_FIRST_CLUSTER, clusters, size);
+}
+#endif
+
 int vdisk_init(struct station_info *stations, uint32_t num_stations, bool have_tuner)
 {
     s_have_tuner = have_tuner;
@@ -714,8 +1298,54 @@ int vdisk_init(struct station_info *stations, uint32_t num_stations, bool have_t
         vdisk_setup_dir(stations, num_stations);
     }
 
+#if CONFIG_VDISK_FLAC
+    vdisk_setup_flac();
+#endif
+#if CONFIG_VDISK_LIVE_FORMATS
+    vdisk_setup_live_formats();
+#endif
+#if CONFIG_AUDIO_TIMESHIFT
+    vdisk_setup_rewind();
+#endif
+
     return disk_access_register(&ram_disk);
 }
 
 //SYS_INIT(disk_ram_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
 
+
+#if CONFIG_SHELL
+
+#include <zephyr/shell/shell.h>
+
+static void vdisk_cmd_stats(const struct shell *shell, size_t argc, char **argv)
+{
+    if (s_data_sectors == 0)
+    {
+        shell_print(shell, "no data sectors read");
+    }
+    else
+    {
+        shell_print(shell, "%u data sectors  cyc/sector best %u  avg %u  worst %u  (%s)",
+                (uint32_t)s_data_sectors, s_data_min_cycles,
+                (uint32_t)(s_data_cycles / s_data_sectors), s_data_max_cycles,
+                IS_ENABLED(CONFIG_AUDIO_RAMFUNC) ? "ram" : "flash");
+    }
+
+    if (argc > 1 && !strcmp(argv[1], "clear"))
+    {
+        s_data_sectors = 0;
+        s_data_cycles = 0;
+        s_data_min_cycles = UINT32_MAX;
+        s_data_max_cycles = 0;
+    }
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(s_sub_vdisk,
+    SHELL_CMD_ARG(stats, NULL, "Data sector read cycles [clear]", vdisk_cmd_stats, 1, 1),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(vdisk, &s_sub_vdisk, "Virtual disk", NULL);
+
+#endif
@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#ifndef AUDIO_RING_SIZE
+#define AUDIO_RING_SIZE		(8)
+#endif
+
+#include "audioring.h"
+
+#define BLOCK_WORDS		(64)
+
+// Run the audioin output ring between two pthreads on the host.  The
+// producer stamps every word of a block with the block sequence and the
+// consumer copies blocks out in random sized pieces the way the usb disk
+// reader does, so torn, reordered, lost or repeated blocks all show up.
+// Both sides yield at random to keep hitting the full and empty edges.
+//
+// "make test" also runs it under ThreadSanitizer, which checks the sample
+// writes and reads are ordered by head and tail the way the ring claims.
+// The "audio ringtest" shell command is still the one to use for the cost
+// of ring operations on the target
+//
+static struct audio_ring s_ring;
+static uint32_t s_samples[AUDIO_RING_SIZE][BLOCK_WORDS];
+static bool s_running;
+
+static uint64_t s_produced;
+static uint64_t s_full;
+static uint64_t s_consumed;
+static uint64_t s_empty;
+static uint64_t s_errors;
+
+static void *producer(void *arg)
+{
+	unsigned int seed = 1;
+	uint32_t *dst;
+	int word;
+
+	while (__atomic_load_n(&s_running, __ATOMIC_RELAXED))
+	{
+		dst = _RingHeadBlock(&s_ring)->samples;
+
+		for (word = 0; word < BLOCK_WORDS; word++)
+		{
+			dst[word] = s_ring.seq;
+		}
+
+		if (_RingPublish(&s_ring, sizeof(uint32_t) * BLOCK_WORDS))
+		{
+			s_full++;
+			sched_yield();
+			continue;
+		}
+
+		s_produced++;
+
+		if (!(rand_r(&seed) & 7))
+		{
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+static void *consumer(void *arg)
+{
+	unsigned int seed = 2;
+	struct audio_block *block;
+	uint32_t copy[BLOCK_WORDS];
+	uint32_t expect = 0;
+	uint32_t offset = 0;
+	uint32_t bytes;
+	int word;
+
+	while (__atomic_load_n(&s_running, __ATOMIC_RELAXED) || _RingCount(&s_ring))
+	{
+		block = _RingPeek(&s_ring);
+		if (!block)
+		{
+			s_empty++;
+			sched_yield();
+			continue;
+		}
+
+		// copy a random piece of what is left, a word at a time
+		//
+		bytes = sizeof(uint32_t) * (1 + rand_r(&seed) % BLOCK_WORDS);
+		if (bytes > block->bytes - offset)
+		{
+			bytes = block->bytes - offset;
+		}
+
+		memcpy((uint8_t *)copy + offset, (uint8_t *)block->samples + offset, bytes);
+		offset += bytes;
+
+		if (!(rand_r(&seed) & 7))
+		{
+			sched_yield();
+		}
+
+		if (offset < block->bytes)
+		{
+			continue;
+		}
+
+		if (block->seq != expect)
+		{
+			fprintf(stderr, "block %u after %u\n", block->seq, expect - 1);
+			s_errors++;
+		}
+
+		for (word = 0; word < BLOCK_WORDS; word++)
+		{
+			if (copy[word] != block->seq)
+			{
+				fprintf(stderr, "block %u word %d is %u\n", block->seq, word, copy[word]);
+				s_errors++;
+				break;
+			}
+		}
+
+		expect = block->seq + 1;
+		offset = 0;
+		_RingRelease(&s_ring);
+		s_consumed++;
+	}
+
+	return NULL;
+}
+
+int main(int argc, char **argv)
+{
+	pthread_t prod_thread;
+	pthread_t cons_thread;
+	char *progname;
+	uint32_t seconds = 5;
+	int block;
+
+	progname = *argv++;
+	argc--;
+
+	while (argc > 0)
+	{
+		if (!strcmp(*argv, "-t") && argc > 1)
+		{
+			argv++;
+			argc--;
+			seconds = strtoul(*argv, NULL, 0);
+		}
+		else
+		{
+			fprintf(stderr, "Usage %s [-t <seconds>]\n"
+					"  -t  how long to run (default 5)\n",
+					progname);
+			return -1;
+		}
+		argv++;
+		argc--;
+	}
+
+	for (block = 0; block < AUDIO_RING_SIZE; block++)
+	{
+		s_ring.blocks[block].samples = s_samples[block];
+	}
+
+	// start the indices just short of the 2^32 wrap so that is covered too
+	//
+	s_ring.head = (atomic_t)(uint32_t)(0 - 16 * AUDIO_RING_SIZE);
+	s_ring.tail = s_ring.head;
+
+	s_running = true;
+
+	if (
+			pthread_create(&prod_thread, NULL, producer, NULL)
+		||	pthread_create(&cons_thread, NULL, consumer, NULL)
+	)
+	{
+		fprintf(stderr, "Can't start threads\n");
+		return -1;
+	}
+
+	sleep(seconds);
+	__atomic_store_n(&s_running, false, __ATOMIC_RELAXED);
+
+	pthread_join(prod_thread, NULL);
+	pthread_join(cons_thread, NULL);
+
+	if (s_consumed != s_produced)
+	{
+		fprintf(stderr, "produced %lu but consumed %lu\n",
+				(unsigned long)s_produced, (unsigned long)s_consumed);
+		s_errors++;
+	}
+
+	printf("ring %u: produced %lu consumed %lu full %lu empty %lu errors %lu\n",
+			AUDIO_RING_SIZE, (unsigned long)s_produced, (unsigned long)s_consumed,
+			(unsigned long)s_full, (unsigned long)s_empty, (unsigned long)s_errors);
+	printf("worst put %u ns  get %u ns  block age %u ns\n",
+			s_ring.max_put_cycles, s_ring.max_get_cycles, s_ring.max_age_cycles);
+
+	return s_errors ? 1 : 0;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+
+// Just enough of the Zephyr kernel for audioring.h to build on a host.
+// Zephyr's atomic_get and atomic_set are sequentially consistent, so the
+// builtins are used with __ATOMIC_SEQ_CST to keep the same ordering, and
+// the cycle counter is the monotonic clock in ns
+//
+typedef long atomic_t;
+typedef long atomic_val_t;
+
+#define RING_CYCLES_PER_SEC	(1000000000u)
+
+static inline atomic_val_t atomic_get(const atomic_t *target)
+{
+	return __atomic_load_n(target, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_set(atomic_t *target, atomic_val_t value)
+{
+	return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline uint32_t k_cycle_get_32(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t)((uint64_t)now.tv_sec * RING_CYCLES_PER_SEC + now.tv_nsec);
+}
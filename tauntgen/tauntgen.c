@@ -0,0 +1,136 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "audiodsp.h"
+#include "taunt.h"
+
+// Convert the canned audio played with no tuner into the blocked ima adpcm
+// the radio keeps in flash, and write it out as components/tones/taunt.c
+//
+// Input is raw mono pcm, 8 bit unsigned (the original taunt) or 16 bit
+// signed little-endian with -16.  The rate isn't stored, the radio assumes
+// TAUNT_SAMPLE_RATE
+//
+void assert_err(const char *file, const int line)
+{
+	fprintf(stderr, "assert %s:%d\n", file, line);
+}
+
+int main(int argc, char **argv)
+{
+	static int16_t samples[TAUNT_BLOCK_SAMPLES];
+	uint8_t block[TAUNT_BLOCK_SIZE];
+	struct dsp_adpcm state = { 0 };
+	char *progname;
+	char *in_name = NULL;
+	char *out_name = NULL;
+	uint32_t limit = 0;
+	uint32_t total = 0;
+	uint32_t blocks = 0;
+	uint32_t bytes = 0;
+	int wide = 0;
+	FILE *in;
+	FILE *out;
+
+	progname = *argv++;
+	argc--;
+
+	while (argc > 0)
+	{
+		if (!strcmp(*argv, "-16"))
+		{
+			wide = 1;
+		}
+		else if (!strcmp(*argv, "-n") && argc > 1)
+		{
+			argv++;
+			argc--;
+			limit = strtoul(*argv, NULL, 0);
+		}
+		else if (**argv == '-')
+		{
+			break;
+		}
+		else if (!in_name)
+		{
+			in_name = *argv;
+		}
+		else
+		{
+			out_name = *argv;
+		}
+		argv++;
+		argc--;
+	}
+
+	if (!in_name || !out_name || argc > 0)
+	{
+		fprintf(stderr, "Usage %s [-16] [-n <samples>] <in.raw> <taunt.c>\n"
+				"  -16  input is 16 bit signed, default 8 bit unsigned\n"
+				"  -n   only use the first n samples\n",
+				progname);
+		return -1;
+	}
+
+	in = fopen(in_name, "rb");
+	out = fopen(out_name, "w");
+	if (!in || !out)
+	{
+		fprintf(stderr, "Can't open files\n");
+		return -1;
+	}
+
+	fprintf(out, "\n// generated by tauntgen, %u Hz mono ima adpcm in %u byte blocks\n//\n",
+			TAUNT_SAMPLE_RATE, TAUNT_BLOCK_SIZE);
+	fprintf(out, "#include \"taunt.h\"\n\nconst unsigned char taunt_adpcm[] = {");
+
+	while (1)
+	{
+		uint32_t count = 0;
+
+		memset(samples, 0, sizeof(samples));
+
+		while (count < TAUNT_BLOCK_SAMPLES && (!limit || total < limit))
+		{
+			uint8_t bytes_in[2];
+
+			if (fread(bytes_in, 1, wide ? 2 : 1, in) != (wide ? 2 : 1))
+			{
+				break;
+			}
+			samples[count++] = wide ? (int16_t)(bytes_in[0] | (bytes_in[1] << 8)) : (int16_t)((bytes_in[0] - 128) << 8);
+			total++;
+		}
+
+		if (count == 0)
+		{
+			break;
+		}
+
+		// each block starts with the codec state so it decodes on its own
+		//
+		block[0] = (uint8_t)state.predictor;
+		block[1] = (uint8_t)(state.predictor >> 8);
+		block[2] = state.index;
+		block[3] = 0;
+
+		AudioDspAdpcmEncodeMono(&state, samples, TAUNT_BLOCK_SAMPLES, block + TAUNT_BLOCK_HEADER);
+
+		for (int byte = 0; byte < TAUNT_BLOCK_SIZE; byte++, bytes++)
+		{
+			fprintf(out, "%s0x%02x", (bytes % 12) ? ", " : (bytes ? ",\n  " : "\n  "), block[byte]);
+		}
+		blocks++;
+	}
+
+	fprintf(out, "\n};\nconst unsigned int taunt_adpcm_len = %u;\nconst unsigned int taunt_samples = %u;\n", bytes, total);
+
+	fclose(in);
+	fclose(out);
+
+	printf("%u samples in %u blocks, %u bytes\n", total, blocks, bytes);
+	return 0;
+}